@@ -0,0 +1,227 @@
+// headless rendering benchmark (ted --bench).
+// each fixture file is put through a few scripted scenarios (scrolling, typing, etc.),
+// and we print percentiles of the CPU time spent on each part of the frame.
+
+#include "ted-internal.h"
+
+/// frames at the start of each scenario which aren't measured
+#define BENCH_WARMUP_FRAMES 10
+/// frames measured for each scenario
+#define BENCH_FRAMES 200
+
+typedef struct {
+	/// CPU time for the whole frame, not including SDL_GL_SwapWindow
+	double total;
+	double timers[BENCH_TIMER_COUNT];
+} BenchFrame;
+
+typedef struct {
+	const char *name;
+	/// do whatever this scenario does on frame number `frame`
+	void (*step)(Ted *ted, u32 frame);
+	/// clean up after the last frame (can be NULL)
+	void (*finish)(Ted *ted);
+} BenchScenario;
+
+static bool bench_running;
+static double bench_timers[BENCH_TIMER_COUNT];
+static const char *const bench_timer_names[BENCH_TIMER_COUNT] = {
+	[BENCH_BUFFER_RENDER] = "buffer_render",
+	[BENCH_SYNTAX_HIGHLIGHT] = " syntax highlight",
+	[BENCH_TEXT_LAYOUT] = " text layout",
+	[BENCH_GL_SUBMIT] = "GL submission",
+	[BENCH_SWAP] = "swap",
+};
+// dynamic array of frames measured for the current scenario
+static BenchFrame *bench_frames;
+// dynamic array of buffers which are being benchmarked
+static TextBuffer **bench_fixtures;
+static u32 bench_fixture, bench_scenario, bench_frame;
+
+// scroll down a page, going back to the top once we reach the end of the file.
+static void bench_page_down(Ted *ted) {
+	TextBuffer *buffer = ted->active_buffer;
+	if (!buffer) return;
+	u32 nlines = buffer_line_count(buffer);
+	if (buffer_last_line_on_screen(buffer) + 1 >= nlines)
+		command_execute(ted, CMD_PAGE_UP, nlines);
+	else
+		command_execute(ted, CMD_PAGE_DOWN, 1);
+}
+
+static void bench_scroll_step(Ted *ted, u32 frame) {
+	(void)frame;
+	bench_page_down(ted);
+}
+
+static void bench_select_all_step(Ted *ted, u32 frame) {
+	if (frame == 0)
+		command_execute(ted, CMD_SELECT_ALL, 0);
+	else
+		bench_page_down(ted);
+}
+
+static void bench_select_all_finish(Ted *ted) {
+	command_execute(ted, CMD_CLEAR_SELECTION, 0);
+}
+
+static void bench_find_step(Ted *ted, u32 frame) {
+	if (frame == 0) {
+		command_execute(ted, CMD_FIND, 0);
+		command_execute_string_argument(ted, CMD_INSERT_TEXT, "e");
+	} else {
+		// go to next match
+		command_execute(ted, CMD_NEWLINE, 0);
+	}
+}
+
+static void bench_find_finish(Ted *ted) {
+	command_execute(ted, CMD_ESCAPE, 0);
+}
+
+static void bench_split_step(Ted *ted, u32 frame) {
+	if (frame == 0) {
+		// (this needs at least two fixtures, otherwise there's nothing to split)
+		command_execute(ted, CMD_SPLIT_VERTICAL, 0);
+	} else {
+		// scroll each side in turn
+		command_execute(ted, CMD_SPLIT_SWITCH, 0);
+		bench_page_down(ted);
+	}
+}
+
+static void bench_split_finish(Ted *ted) {
+	command_execute(ted, CMD_SPLIT_JOIN, 0);
+}
+
+static void bench_type_step(Ted *ted, u32 frame) {
+	static const char text[] = "for (int i = 0; i < count; ++i) { total += values[i] * 2; } // \"typing\"\n";
+	if (frame == 0) {
+		// start typing in the middle of the file
+		TextBuffer *buffer = ted->active_buffer;
+		command_execute(ted, CMD_START_OF_FILE, 0);
+		command_execute(ted, CMD_DOWN, buffer ? buffer_line_count(buffer) / 2 : 0);
+		command_execute(ted, CMD_END_OF_LINE, 0);
+		command_execute(ted, CMD_NEWLINE, 0);
+		return;
+	}
+	char c = text[(frame - 1) % (sizeof text - 1)];
+	if (c == '\n') {
+		command_execute(ted, CMD_NEWLINE, 0);
+	} else {
+		char str[2] = {c, 0};
+		command_execute_string_argument(ted, CMD_INSERT_TEXT, str);
+	}
+}
+
+static const BenchScenario bench_scenarios[] = {
+	{"scroll", bench_scroll_step, NULL},
+	{"select all", bench_select_all_step, bench_select_all_finish},
+	{"find", bench_find_step, bench_find_finish},
+	{"split view", bench_split_step, bench_split_finish},
+	// this one modifies the buffer, so it goes last
+	{"type", bench_type_step, NULL},
+};
+
+static int bench_double_cmp(const void *av, const void *bv) {
+	double a = *(const double *)av, b = *(const double *)bv;
+	return a < b ? -1 : a > b ? 1 : 0;
+}
+
+// print the percentiles of `samples` (which get sorted) in milliseconds
+static void bench_print_row(const char *name, double *samples, u32 n) {
+	qsort(samples, n, sizeof *samples, bench_double_cmp);
+	printf("  %-20s", name);
+	static const double percentiles[] = {0.5, 0.9, 0.99};
+	for (size_t i = 0; i < arr_count(percentiles); ++i) {
+		u32 index = (u32)(percentiles[i] * (n - 1) + 0.5);
+		printf(" %9.3f", samples[index] * 1000);
+	}
+	printf(" %9.3f\n", samples[n - 1] * 1000);
+}
+
+static void bench_print_scenario(void) {
+	u32 n = arr_len(bench_frames);
+	if (!n) return;
+	const char *path = buffer_get_path(bench_fixtures[bench_fixture]);
+	printf("%s: %s (%" PRIu32 " frames)\n", path ? path_filename(path) : "untitled",
+		bench_scenarios[bench_scenario].name, n);
+	printf("  %-20s %9s %9s %9s %9s\n", "(ms)", "p50", "p90", "p99", "max");
+	double *samples = calloc(n, sizeof *samples);
+	if (!samples) return;
+	for (u32 i = 0; i < n; ++i)
+		samples[i] = bench_frames[i].total;
+	bench_print_row("frame", samples, n);
+	for (int t = 0; t < BENCH_TIMER_COUNT; ++t) {
+		for (u32 i = 0; i < n; ++i)
+			samples[i] = bench_frames[i].timers[t];
+		bench_print_row(bench_timer_names[t], samples, n);
+	}
+	free(samples);
+	fflush(stdout);
+}
+
+void bench_start(Ted *ted) {
+	arr_foreach_ptr(ted->buffers, TextBufferPtr, pbuffer) {
+		arr_add(bench_fixtures, *pbuffer);
+	}
+	if (arr_len(bench_fixtures) == 0) {
+		fprintf(stderr, "Usage: ted --bench <fixture files...>\n");
+		exit(EXIT_FAILURE);
+	}
+	bench_running = true;
+	bench_fixture = bench_scenario = bench_frame = 0;
+}
+
+double bench_time_start(void) {
+	return bench_running ? time_get_seconds() : 0;
+}
+
+double bench_time_end(BenchTimer timer, double start) {
+	if (!bench_running) return 0;
+	double elapsed = time_get_seconds() - start;
+	bench_timers[timer] += elapsed;
+	return elapsed;
+}
+
+void bench_frame_begin(Ted *ted) {
+	if (!bench_running) return;
+	memset(bench_timers, 0, sizeof bench_timers);
+	if (bench_frame == 0)
+		ted_switch_to_buffer(ted, bench_fixtures[bench_fixture]);
+	bench_scenarios[bench_scenario].step(ted, bench_frame);
+}
+
+void bench_frame_end(Ted *ted, double frame_time) {
+	if (!bench_running) return;
+	if (bench_frame >= BENCH_WARMUP_FRAMES) {
+		BenchFrame *frame = arr_addp(bench_frames);
+		if (frame) {
+			frame->total = frame_time;
+			memcpy(frame->timers, bench_timers, sizeof bench_timers);
+		}
+	}
+	if (++bench_frame < BENCH_WARMUP_FRAMES + BENCH_FRAMES)
+		return;
+
+	// done with this scenario
+	const BenchScenario *scenario = &bench_scenarios[bench_scenario];
+	if (scenario->finish)
+		scenario->finish(ted);
+	bench_print_scenario();
+	arr_clear(bench_frames);
+	bench_frame = 0;
+	if (++bench_scenario < arr_count(bench_scenarios))
+		return;
+	bench_scenario = 0;
+	if (++bench_fixture < arr_len(bench_fixtures))
+		return;
+	// all done
+	ted->quit = true;
+}
+
+void bench_quit(void) {
+	bench_running = false;
+	arr_free(bench_frames);
+	arr_free(bench_fixtures);
+}
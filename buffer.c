@@ -19,10 +19,53 @@ typedef struct Line Line;
 /// A single undoable edit to a buffer
 typedef struct BufferEdit BufferEdit;
 
+/// summary of a line used to draw the minimap.
+///
+/// this is only kept up to date while the minimap is shown.
+typedef struct {
+	/// column of the first non-blank character (at most 255)
+	u8 indent;
+	/// column after the last non-blank character (at most 255)
+	u8 end;
+	/// most common \ref SyntaxCharType of the non-blank characters
+	SyntaxCharType type;
+} LineSummary;
+
+/// a run of characters which an LSP server gave a semantic token type
+typedef struct {
+	/// index of the first character in the line
+	u32 index;
+	u16 len;
+	SyntaxCharType type;
+} SemanticRun;
+
+/// an LSP inlay hint, shown before a character in a line
+typedef struct {
+	/// index of the character the hint is shown before (this can be the line's length)
+	u32 index;
+	u32 len;
+	char32_t *label;
+} LineHint;
+
+/// a range of lines hidden by folding
+typedef struct {
+	/// the line before the hidden ones, which is shown with a marker after it
+	u32 start;
+	/// last hidden line
+	u32 end;
+	/// total number of lines hidden by this fold and all the ones before it
+	u32 hidden_through;
+} Fold;
+
 struct Line {
 	SyntaxState syntax;
+	LineSummary summary;
 	u32 len;
 	char32_t *str;
+	/// dynamic array of semantic token runs, sorted by index and not overlapping
+	SemanticRun *semantic;
+	/// dynamic array of inlay hints, sorted by index
+	LineHint *hints;
 };
 
 // This refers to replacing prev_len characters (found in prev_text) at pos with new_len characters
@@ -35,6 +78,18 @@ struct BufferEdit {
 	double time; // time at start of edit (i.e. the time just before the edit), in seconds since epoch
 };
 
+/// glyph geometry for a line which was rendered recently
+typedef struct {
+	/// hash of the line's contents and syntax state
+	u64 hash;
+	u32 len;
+	/// value of \ref TextBuffer.render_count when this was last used
+	u32 last_used;
+	/// fractional part of the y coordinate the line was rendered at
+	float y_frac;
+	TextRun *run;
+} LineRenderCache;
+
 typedef struct {
 	MessageType severity;
 	BufferPos pos;
@@ -50,10 +105,16 @@ struct TextBuffer {
 	Ted *ted;
 	/// number of characters scrolled in the x direction (multiply by space width to get pixels)
 	double scroll_x;
-	/// number of characters scrolled in the y direction
+	/// number of rows scrolled in the y direction.
+	///
+	/// there is one row for every line which isn't hidden by a fold (see \ref folds).
 	double scroll_y;
 	/// last write time to \ref path
 	double last_write_time;
+	/// has the file watcher told us about a change to \ref path which we haven't checked yet?
+	bool disk_change_pending;
+	/// if the file watcher couldn't watch \ref path, when we should next try to watch it again
+	double watch_retry_time;
 	/// the language the buffer has been manually set to, or \ref LANG_NONE if it hasn't been set to anything
 	i64 manual_language;
 	/// position of cursor
@@ -102,7 +163,8 @@ struct TextBuffer {
 	
 	/// if false, need to recompute settings.
 	bool settings_computed;
-	Settings settings;
+	/// shared with other buffers which have the same applicable configs
+	SharedSettings *settings;
 	/// which LSP this document is open in
 	LSPID lsp_opened_in;
 	/// determining which LSP to use for a buffer takes some work,
@@ -122,6 +184,35 @@ struct TextBuffer {
 	u32 frame_latest_line_modified;
 
 	Diagnostic *diagnostics;
+	/// which version of the document's diagnostics \ref diagnostics came from (see \ref buffer_publish_diagnostics)
+	u32 diagnostics_generation;
+	/// has \ref buffer_set_semantic_tokens been called?
+	bool has_semantic_tokens;
+	/// dynamic array of folded ranges, sorted by start and not overlapping
+	Fold *folds;
+
+	/// recently rendered lines, so we don't have to syntax highlight + lay them out every frame
+	LineRenderCache *line_render_cache;
+	/// hash of everything other than the lines themselves which affects \ref line_render_cache
+	u64 line_render_cache_key;
+	/// number of times \ref buffer_render has been called
+	u32 render_count;
+
+	/// minimap texture, with one row of pixels for every \ref minimap_lines_per_row lines (0 if it hasn't been created)
+	GLuint minimap_texture;
+	/// number of rows in \ref minimap_texture
+	u32 minimap_rows;
+	/// see \ref minimap_texture
+	u32 minimap_lines_per_row;
+	/// number of lines when \ref minimap_texture was last updated
+	u32 minimap_nlines;
+	/// range of lines whose summaries have changed since \ref minimap_texture was last updated
+	/// (empty if \ref minimap_dirty_start > \ref minimap_dirty_end)
+	u32 minimap_dirty_start, minimap_dirty_end;
+	/// hash of everything other than the lines themselves which affects the minimap
+	u64 minimap_key;
+	/// is the user dragging the mouse on the minimap?
+	bool minimap_dragging;
 
 	/// lines
 	Line *lines;
@@ -489,6 +580,12 @@ Language buffer_language(TextBuffer *buffer) {
 			}
 		}
 	}
+	if (match_score == 0) {
+		// extensions given in language definitions have the lowest priority
+		Language lang = syntax_language_from_definition_extensions(filename);
+		if (lang != LANG_NONE)
+			match = lang;
+	}
 	
 	return match;
 }
@@ -547,10 +644,13 @@ LSP *buffer_lsp(TextBuffer *buffer) {
 Settings *buffer_settings(TextBuffer *buffer) {
 	Ted *ted = buffer->ted;
 	if (!buffer->settings_computed) {
-		ted_compute_settings(ted, buffer->path, buffer_language(buffer), &buffer->settings);
+		ted_release_settings_later(ted, &buffer->settings);
+		buffer->settings = ted_get_settings(ted, buffer->path, buffer_language(buffer));
 		buffer->settings_computed = true;
+		// publish diagnostics again in case show-diagnostics changed
+		buffer->diagnostics_generation = 0;
 	}
-	return &buffer->settings;
+	return &buffer->settings->settings;
 }
 
 void buffer_recompute_settings(TextBuffer *buffer) {
@@ -772,6 +872,12 @@ static void buffer_pos_check_valid(TextBuffer *buffer, BufferPos p) {
 static bool buffer_line_valid(Line *line) {
 	if (line->len && !line->str)
 		return false;
+	u32 prev_end = 0;
+	arr_foreach_ptr(line->semantic, const SemanticRun, run) {
+		if (run->len == 0 || run->index < prev_end || run->index + run->len > line->len)
+			return false;
+		prev_end = run->index + run->len;
+	}
 	return true;
 }
 
@@ -787,6 +893,15 @@ void buffer_check_valid(TextBuffer *buffer) {
 		Line *line = &buffer->lines[i];
 		assert(buffer_line_valid(line));
 	}
+	u32 prev_fold_end = 0, hidden = 0;
+	arr_foreach_ptr(buffer->folds, const Fold, fold) {
+		assert(fold->start < fold->end);
+		assert(fold->end < buffer->nlines);
+		assert(fold == buffer->folds || fold->start > prev_fold_end);
+		hidden += fold->end - fold->start;
+		assert(fold->hidden_through == hidden);
+		prev_fold_end = fold->end;
+	}
 }
 #else
 static void buffer_pos_check_valid(TextBuffer *buffer, BufferPos p) {
@@ -982,8 +1097,227 @@ static void buffer_line_append_char(TextBuffer *buffer, Line *line, char32_t c)
 		line->str[line->len-1] = c;
 }
 
+static void line_hints_clear(Line *line) {
+	arr_foreach_ptr(line->hints, LineHint, hint) {
+		free(hint->label);
+	}
+	arr_clear(line->hints);
+}
+
 static void buffer_line_free(Line *line) {
 	free(line->str);
+	arr_free(line->semantic);
+	line_hints_clear(line);
+	arr_free(line->hints);
+}
+
+// move semantic token runs after `end - pos` characters were inserted at `pos`.
+static void buffer_semantic_runs_insert(TextBuffer *buffer, BufferPos pos, BufferPos end) {
+	Line *line = &buffer->lines[pos.line];
+	if (!line->semantic) return;
+	if (pos.line == end.line) {
+		const u32 n = end.index - pos.index;
+		arr_foreach_ptr(line->semantic, SemanticRun, run) {
+			if (run->index >= pos.index) {
+				run->index += n;
+			} else if (run->index + run->len > pos.index) {
+				// typing inside a token makes it longer
+				run->len = (u16)min_u32(run->len + n, U16_MAX);
+			}
+		}
+		return;
+	}
+	
+	// everything after pos got moved to the last line of the insertion
+	Line *last_line = &buffer->lines[end.line];
+	u32 nkept = arr_len(line->semantic);
+	for (u32 i = 0; i < arr_len(line->semantic); ++i) {
+		SemanticRun *run = &line->semantic[i];
+		const u32 run_end = run->index + run->len;
+		if (run_end <= pos.index) continue;
+		if (nkept > i) nkept = i;
+		SemanticRun moved = *run;
+		if (run->index < pos.index) {
+			// split the run in two
+			moved.index = pos.index;
+			moved.len = (u16)(run_end - pos.index);
+			run->len = (u16)(pos.index - run->index);
+			++nkept;
+		}
+		moved.index = moved.index - pos.index + end.index;
+		arr_add(last_line->semantic, moved);
+	}
+	if (nkept < arr_len(line->semantic))
+		arr_remove_multiple(line->semantic, nkept, arr_len(line->semantic) - nkept);
+}
+
+// where index `x` of a line ends up after the characters in [p, e) are deleted from it
+static u32 semantic_index_after_deletion(u32 x, u32 p, u32 e) {
+	if (x <= p) return x;
+	if (x < e) return p;
+	return x - (e - p);
+}
+
+// update semantic token runs for the deletion of the text from `pos` to `end`.
+//
+// this has to be called *before* the text is deleted.
+static void buffer_semantic_runs_delete(TextBuffer *buffer, BufferPos pos, BufferPos end) {
+	Line *line = &buffer->lines[pos.line];
+	if (pos.line == end.line) {
+		for (u32 i = 0; i < arr_len(line->semantic); ) {
+			SemanticRun *run = &line->semantic[i];
+			u32 start = semantic_index_after_deletion(run->index, pos.index, end.index);
+			u32 stop = semantic_index_after_deletion(run->index + run->len, pos.index, end.index);
+			if (stop > start) {
+				run->index = start;
+				run->len = (u16)(stop - start);
+				++i;
+			} else {
+				// entire run was deleted
+				arr_remove(line->semantic, i);
+			}
+		}
+		return;
+	}
+	
+	// the rest of the first line is deleted
+	for (u32 i = 0; i < arr_len(line->semantic); ++i) {
+		SemanticRun *run = &line->semantic[i];
+		if (run->index >= pos.index) {
+			arr_remove_multiple(line->semantic, i, arr_len(line->semantic) - i);
+			break;
+		}
+		if (run->index + run->len > pos.index)
+			run->len = (u16)(pos.index - run->index);
+	}
+	// and the rest of the last line is joined onto it
+	const Line *last_line = &buffer->lines[end.line];
+	arr_foreach_ptr(last_line->semantic, const SemanticRun, run) {
+		const u32 run_end = run->index + run->len;
+		if (run_end <= end.index) continue;
+		const u32 start = max_u32(run->index, end.index);
+		SemanticRun joined = {
+			.index = pos.index + (start - end.index),
+			.len = (u16)(run_end - start),
+			.type = run->type,
+		};
+		arr_add(line->semantic, joined);
+	}
+}
+
+// recompute Fold.hidden_through after folds are added, removed, or moved
+static void buffer_folds_update(TextBuffer *buffer) {
+	u32 hidden = 0;
+	arr_foreach_ptr(buffer->folds, Fold, fold) {
+		hidden += fold->end - fold->start;
+		fold->hidden_through = hidden;
+	}
+}
+
+// move inlay hints after `end - pos` characters were inserted at `pos`.
+//
+// hints at `pos` are moved along with the text after them.
+static void buffer_inlay_hints_insert(TextBuffer *buffer, BufferPos pos, BufferPos end) {
+	Line *line = &buffer->lines[pos.line];
+	if (!line->hints) return;
+	if (pos.line == end.line) {
+		const u32 n = end.index - pos.index;
+		arr_foreach_ptr(line->hints, LineHint, hint) {
+			if (hint->index >= pos.index)
+				hint->index += n;
+		}
+		return;
+	}
+	
+	// everything after pos got moved to the last line of the insertion
+	Line *last_line = &buffer->lines[end.line];
+	u32 i;
+	for (i = 0; i < arr_len(line->hints) && line->hints[i].index < pos.index; ++i);
+	const u32 nkept = i;
+	for (; i < arr_len(line->hints); ++i) {
+		LineHint moved = line->hints[i];
+		moved.index = moved.index - pos.index + end.index;
+		arr_add(last_line->hints, moved);
+	}
+	if (nkept < arr_len(line->hints))
+		arr_remove_multiple(line->hints, nkept, arr_len(line->hints) - nkept);
+}
+
+// update inlay hints for the deletion of the text from `pos` to `end`.
+// hints before deleted characters are removed.
+//
+// this has to be called *before* the text is deleted.
+static void buffer_inlay_hints_delete(TextBuffer *buffer, BufferPos pos, BufferPos end) {
+	Line *line = &buffer->lines[pos.line];
+	if (pos.line == end.line) {
+		for (u32 i = 0; i < arr_len(line->hints); ) {
+			LineHint *hint = &line->hints[i];
+			if (hint->index < pos.index) {
+				++i;
+			} else if (hint->index >= end.index) {
+				hint->index -= end.index - pos.index;
+				++i;
+			} else {
+				free(hint->label);
+				arr_remove(line->hints, i);
+			}
+		}
+		return;
+	}
+	
+	// the rest of the first line is deleted
+	for (u32 i = 0; i < arr_len(line->hints); ) {
+		LineHint *hint = &line->hints[i];
+		if (hint->index >= pos.index) {
+			free(hint->label);
+			arr_remove(line->hints, i);
+		} else {
+			++i;
+		}
+	}
+	// and the rest of the last line is joined onto it
+	Line *last_line = &buffer->lines[end.line];
+	for (u32 i = 0; i < arr_len(last_line->hints); ) {
+		LineHint *hint = &last_line->hints[i];
+		if (hint->index >= end.index) {
+			LineHint joined = *hint;
+			joined.index = pos.index + (hint->index - end.index);
+			arr_add(line->hints, joined);
+			// the label belongs to `line` now
+			arr_remove(last_line->hints, i);
+		} else {
+			++i;
+		}
+	}
+}
+
+// update folds for an edit to the lines from `first_line` to `last_line` (before the edit)
+// which changed the number of lines by `delta`.
+// `after_text` should be true if the edit was at or after the last visible character of `first_line`
+// (e.g. typing a newline at the end of the line), so that a fold after the line can just move down.
+static void buffer_folds_edit(TextBuffer *buffer, u32 first_line, u32 last_line, i64 delta, bool after_text) {
+	for (u32 i = 0; i < arr_len(buffer->folds); ) {
+		Fold *fold = &buffer->folds[i];
+		if (fold->end < first_line) {
+			// before the edit
+			++i;
+		} else if (fold->start > last_line) {
+			// after the edit
+			fold->start = (u32)(fold->start + delta);
+			fold->end = (u32)(fold->end + delta);
+			++i;
+		} else if (first_line == fold->start && last_line == fold->start && (delta == 0 || after_text)) {
+			// only the line before the hidden ones was changed,
+			// or lines were added after its text (which the fold goes after)
+			fold->start = (u32)(fold->start + delta);
+			fold->end = (u32)(fold->end + delta);
+			++i;
+		} else {
+			// hidden lines were changed -- unfold
+			arr_remove(buffer->folds, i);
+		}
+	}
+	buffer_folds_update(buffer);
 }
 
 static void diagnostic_free(Diagnostic *diagnostic) {
@@ -997,6 +1331,14 @@ static void buffer_diagnostics_clear(TextBuffer *buffer) {
 		diagnostic_free(d);
 	}
 	arr_clear(buffer->diagnostics);
+	buffer->diagnostics_generation = 0;
+}
+
+static void buffer_line_render_cache_clear(TextBuffer *buffer) {
+	arr_foreach_ptr(buffer->line_render_cache, LineRenderCache, entry) {
+		text_run_free(entry->run);
+	}
+	arr_clear(buffer->line_render_cache);
 }
 
 static void buffer_free_inner(TextBuffer *buffer) {
@@ -1014,6 +1356,8 @@ static void buffer_free_inner(TextBuffer *buffer) {
 		buffer_line_free(&lines[i]);
 	}
 	free(lines);
+	if (buffer->path)
+		file_watcher_remove(ted->file_watcher, buffer->path);
 	free(buffer->path);
 
 	arr_foreach_ptr(buffer->undo_history, BufferEdit, edit)
@@ -1021,9 +1365,16 @@ static void buffer_free_inner(TextBuffer *buffer) {
 	arr_foreach_ptr(buffer->redo_history, BufferEdit, edit)
 		buffer_edit_free(edit);
 	buffer_diagnostics_clear(buffer);
+	buffer_line_render_cache_clear(buffer);
+	arr_free(buffer->folds);
+	if (buffer->minimap_texture) {
+		// draw anything which is using the texture before it goes away
+		gl_frame_flush();
+		glDeleteTextures(1, &buffer->minimap_texture);
+	}
 	arr_free(buffer->undo_history);
 	arr_free(buffer->redo_history);
-	settings_free(&buffer->settings);
+	shared_settings_decref(&buffer->settings);
 	memset(buffer, 0, sizeof *buffer);
 }
 
@@ -1085,7 +1436,15 @@ static void buffer_render_char(TextBuffer *buffer, Font *font, TextRenderState *
 	}
 }
 
+static void buffer_render_inlay_hint(Font *font, TextRenderState *state, const LineHint *hint) {
+	for (u32 i = 0; i < hint->len; ++i)
+		text_char_with_state(font, state, hint->label[i]);
+}
+
 // convert line character index to offset in pixels
+//
+// inlay hints before the character count, but not ones at `index`
+// (so the cursor is drawn before them, and characters are drawn after).
 static double buffer_index_to_xoff(TextBuffer *buffer, u32 line_number, u32 index) {
 	if (line_number >= buffer->nlines) {
 		assert(0);
@@ -1098,7 +1457,10 @@ static double buffer_index_to_xoff(TextBuffer *buffer, u32 line_number, u32 inde
 	Font *font = buffer_font(buffer);
 	TextRenderState state = text_render_state_default;
 	state.render = false;
+	const LineHint *hint = line->hints, *hints_end = hint + arr_len(line->hints);
 	for (u32 i = 0; i < index; ++i) {
+		for (; hint < hints_end && hint->index <= i; ++hint)
+			buffer_render_inlay_hint(font, &state, hint);
 		buffer_render_char(buffer, font, &state, str[i]);
 	}
 	return state.x;
@@ -1118,7 +1480,14 @@ static u32 buffer_xoff_to_index(TextBuffer *buffer, u32 line_number, double xoff
 	Font *font = buffer_font(buffer);
 	TextRenderState state = text_render_state_default;
 	state.render = false;
+	const LineHint *hint = line->hints, *hints_end = hint + arr_len(line->hints);
 	for (u32 i = 0; i < line->len; ++i) {
+		for (; hint < hints_end && hint->index <= i; ++hint)
+			buffer_render_inlay_hint(font, &state, hint);
+		if (state.x > xoff) {
+			// clicked on an inlay hint
+			return i;
+		}
 		double x0 = state.x;
 		buffer_render_char(buffer, font, &state, str[i]);
 		double x1 = state.x;
@@ -1144,6 +1513,73 @@ u32 buffer_column_count(TextBuffer *buffer) {
 }
 
 
+// index of the first fold which starts at or after `line` (arr_len(buffer->folds) if there is none)
+static u32 buffer_fold_search(TextBuffer *buffer, u32 line) {
+	u32 lo = 0, hi = arr_len(buffer->folds);
+	while (lo < hi) {
+		u32 mid = lo + (hi - lo) / 2;
+		if (buffer->folds[mid].start < line)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return lo;
+}
+
+// number of lines hidden by the first `nfolds` folds
+static u32 buffer_hidden_lines_in_folds(TextBuffer *buffer, u32 nfolds) {
+	return nfolds ? buffer->folds[nfolds - 1].hidden_through : 0;
+}
+
+// returns the fold hiding `line`, or NULL if it isn't hidden
+static Fold *buffer_fold_hiding_line(TextBuffer *buffer, u32 line) {
+	u32 i = buffer_fold_search(buffer, line);
+	if (i == 0) return NULL;
+	Fold *fold = &buffer->folds[i - 1];
+	return line <= fold->end ? fold : NULL;
+}
+
+// number of rows the buffer is displayed in
+static u32 buffer_row_count(TextBuffer *buffer) {
+	return buffer->nlines - buffer_hidden_lines_in_folds(buffer, arr_len(buffer->folds));
+}
+
+// which row `line` is displayed in.
+// lines hidden by a fold are considered to be in the same row as the line before the fold.
+static u32 buffer_line_to_row(TextBuffer *buffer, u32 line) {
+	u32 i = buffer_fold_search(buffer, line);
+	if (i > 0 && line <= buffer->folds[i - 1].end) {
+		// hidden
+		--i;
+		line = buffer->folds[i].start;
+	}
+	return line - buffer_hidden_lines_in_folds(buffer, i);
+}
+
+// which line is displayed in `row` (or the last row, if `row` is past the end of the buffer)
+static u32 buffer_row_to_line(TextBuffer *buffer, u32 row) {
+	row = min_u32(row, buffer_row_count(buffer) - 1);
+	// find the first fold whose first line is displayed at or after `row`
+	u32 lo = 0, hi = arr_len(buffer->folds);
+	while (lo < hi) {
+		u32 mid = lo + (hi - lo) / 2;
+		if (buffer->folds[mid].start - buffer_hidden_lines_in_folds(buffer, mid) < row)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return row + buffer_hidden_lines_in_folds(buffer, lo);
+}
+
+// unfold so that `line` is visible
+static void buffer_reveal_line(TextBuffer *buffer, u32 line) {
+	Fold *fold = buffer_fold_hiding_line(buffer, line);
+	if (fold) {
+		arr_remove(buffer->folds, (u32)(fold - buffer->folds));
+		buffer_folds_update(buffer);
+	}
+}
+
 float buffer_display_lines(TextBuffer *buffer) {
 	return (buffer->y2 - buffer->y1) / text_font_char_height(buffer_font(buffer));
 }
@@ -1158,10 +1594,10 @@ static void buffer_correct_scroll(TextBuffer *buffer) {
 		buffer->scroll_x = 0;
 	if (buffer->scroll_y < 0)
 		buffer->scroll_y = 0;
-	u32 nlines = buffer_line_count(buffer), ncols = buffer_column_count(buffer);
+	u32 nrows = buffer_row_count(buffer), ncols = buffer_column_count(buffer);
 	double max_scroll_x = (double)ncols  - buffer_display_cols(buffer);
 	max_scroll_x += 2; // allow "overscroll" (makes it so you can see the cursor when it's on the right side of the screen)
-	double max_scroll_y = (double)nlines - buffer_display_lines(buffer);
+	double max_scroll_y = (double)nrows - buffer_display_lines(buffer);
 	if (max_scroll_x <= 0) {
 		buffer->scroll_x = 0;
 	} else if (buffer->scroll_x > max_scroll_x) {
@@ -1187,7 +1623,7 @@ vec2 buffer_pos_to_pixels(TextBuffer *buffer, BufferPos pos) {
 	double xoff = buffer_index_to_xoff(buffer, line, index);
 	Font *font = buffer_font(buffer);
 	float x = (float)((double)xoff - buffer->scroll_x * text_font_char_width(font, ' ')) + buffer->x1;
-	float y = (float)((double)line - buffer->scroll_y) * text_font_char_height(font) + buffer->y1;
+	float y = (float)((double)buffer_line_to_row(buffer, line) - buffer->scroll_y) * text_font_char_height(font) + buffer->y1;
 	return (vec2){x, y};
 }
 
@@ -1211,8 +1647,8 @@ bool buffer_pixels_to_pos(TextBuffer *buffer, vec2 pixel_coords, BufferPos *pos)
 	
 	double xoff = x + buffer->scroll_x * text_font_char_width(font, ' ');
 	
-	u32 line = (u32)floor(y / text_font_char_height(font) + buffer->scroll_y);
-	if (line >= buffer->nlines) line = buffer->nlines - 1;
+	u32 row = (u32)floor(y / text_font_char_height(font) + buffer->scroll_y);
+	u32 line = buffer_row_to_line(buffer, row);
 	u32 index = buffer_xoff_to_index(buffer, line, xoff);
 	pos->line = line;
 	pos->index = index;
@@ -1239,7 +1675,8 @@ bool buffer_clip_rect(TextBuffer *buffer, Rect *r) {
 void buffer_scroll_to_pos(TextBuffer *buffer, BufferPos pos) {
 	const Settings *settings = buffer_settings(buffer);
 	Font *font = buffer_font(buffer);
-	double line = pos.line;
+	buffer_reveal_line(buffer, pos.line);
+	double line = buffer_line_to_row(buffer, pos.line);
 	double space_width = text_font_char_width(font, ' ');
 	double char_height = text_font_char_height(font);
 	double col = buffer_index_to_xoff(buffer, pos.line, pos.index) / space_width;
@@ -1270,7 +1707,8 @@ void buffer_scroll_to_pos(TextBuffer *buffer, BufferPos pos) {
 }
 
 void buffer_scroll_center_pos(TextBuffer *buffer, BufferPos pos) {
-	double line = pos.line;
+	buffer_reveal_line(buffer, pos.line);
+	double line = buffer_line_to_row(buffer, pos.line);
 	Font *font = buffer_font(buffer);
 	float space_width = text_font_char_width(font, ' ');
 	float char_height = text_font_char_height(font);
@@ -1290,8 +1728,9 @@ void buffer_set_manual_language(TextBuffer *buffer, u32 language) {
 }
 
 void buffer_center_cursor(TextBuffer *buffer) {
-	double cursor_line = buffer->cursor_pos.line;
-	double cursor_col  = buffer_index_to_xoff(buffer, (u32)cursor_line, buffer->cursor_pos.index)
+	buffer_reveal_line(buffer, buffer->cursor_pos.line);
+	double cursor_line = buffer_line_to_row(buffer, buffer->cursor_pos.line);
+	double cursor_col  = buffer_index_to_xoff(buffer, buffer->cursor_pos.line, buffer->cursor_pos.index)
 		/ text_font_char_width(buffer_font(buffer), ' ');
 	double display_lines = buffer_display_lines(buffer);
 	double display_cols = buffer_display_cols(buffer);
@@ -1367,33 +1806,22 @@ static i64 buffer_pos_move_vertically(TextBuffer *buffer, BufferPos *pos, i64 by
 	// tab|hello world
 	// tab|tab|more text
 	// the character above the 'm' is the 'o', not the 'e'
-	if (by < 0) {
-		by = -by;
-		double xoff = buffer_index_to_xoff(buffer, pos->line, pos->index);
-		if (pos->line < by) {
-			i64 ret = pos->line;
-			pos->line = 0;
-			return -ret;
-		}
-		pos->line -= (u32)by;
-		pos->index = buffer_xoff_to_index(buffer, pos->line, xoff);
-		u32 line_len = buffer->lines[pos->line].len;
-		if (pos->index >= line_len) pos->index = line_len;
-		return -by;
-	} else if (by > 0) {
-		double xoff = buffer_index_to_xoff(buffer, pos->line, pos->index);
-		if (pos->line + by >= buffer->nlines) {
-			i64 ret = buffer->nlines-1 - pos->line;
-			pos->line = buffer->nlines-1;
-			return ret;
-		}
-		pos->line += (u32)by;
-		pos->index = buffer_xoff_to_index(buffer, pos->line, xoff);
-		u32 line_len = buffer->lines[pos->line].len;
-		if (pos->index >= line_len) pos->index = line_len;
-		return by;
-	}
-	return 0;
+	// also, we move by rows rather than lines, so that folded lines are skipped over.
+	if (by == 0) return 0;
+	const i64 row = buffer_line_to_row(buffer, pos->line);
+	const i64 nrows = buffer_row_count(buffer);
+	if (row + by < 0 || row + by >= nrows) {
+		// reached the start/end of the file
+		const i64 new_row = by < 0 ? 0 : nrows - 1;
+		pos->line = buffer_row_to_line(buffer, (u32)new_row);
+		return new_row - row;
+	}
+	double xoff = buffer_index_to_xoff(buffer, pos->line, pos->index);
+	pos->line = buffer_row_to_line(buffer, (u32)(row + by));
+	pos->index = buffer_xoff_to_index(buffer, pos->line, xoff);
+	u32 line_len = buffer->lines[pos->line].len;
+	if (pos->index >= line_len) pos->index = line_len;
+	return by;
 }
 
 i64 buffer_pos_move_left(TextBuffer *buffer, BufferPos *pos, i64 by) {
@@ -2107,6 +2535,15 @@ BufferPos buffer_insert_text_at_pos(TextBuffer *buffer, BufferPos pos, String32
 	arr_foreach_ptr(buffer->diagnostics, Diagnostic, d) {
 		buffer_pos_move_according_to_edit(&d->pos, &info);
 	}
+	buffer_semantic_runs_insert(buffer, pos, b);
+	buffer_inlay_hints_insert(buffer, pos, b);
+	{
+		// is there nothing but whitespace after the inserted text?
+		const Line *last_line = &buffer->lines[b.line];
+		u32 i = b.index;
+		while (i < last_line->len && is32_space(last_line->str[i])) ++i;
+		buffer_folds_edit(buffer, pos.line, pos.line, (i64)b.line - (i64)pos.line, i == last_line->len);
+	}
 	
 	signature_help_retrigger(buffer->ted);
 	arr_foreach_ptr(buffer->ted->edit_notifys, EditNotifyInfo, n) {
@@ -2577,6 +3014,9 @@ void buffer_delete_chars_at_pos(TextBuffer *buffer, BufferPos pos, i64 nchars_)
 	Line *line = &buffer->lines[line_idx], *lines_end = &buffer->lines[buffer->nlines];
 	const BufferPos end_pos = buffer_pos_advance(buffer, pos, nchars);
 	const LSPPosition end_pos_lsp = buffer_pos_to_lsp_position(buffer, end_pos);
+	buffer_semantic_runs_delete(buffer, pos, end_pos);
+	buffer_inlay_hints_delete(buffer, pos, end_pos);
+	buffer_folds_edit(buffer, pos.line, end_pos.line, (i64)pos.line - (i64)end_pos.line, false);
 
 	if (nchars + index > line->len) {
 		// delete rest of line
@@ -3131,6 +3571,7 @@ Status buffer_load_file(TextBuffer *buffer, const char *path) {
 					buffer->frame_latest_line_modified = nlines - 1;
 					buffer->lines_capacity = lines_capacity;
 					buffer->path = path_copy;
+					file_watcher_add(buffer->ted->file_watcher, path_copy);
 					buffer->last_write_time = modified_time;
 					if (!(fs_path_permission(path) & FS_PERMISSION_WRITE)) {
 						// can't write to this file; make the buffer view only.
@@ -3144,6 +3585,14 @@ Status buffer_load_file(TextBuffer *buffer, const char *path) {
 					
 					// this will send a didOpen request if needed
 					buffer_lsp(buffer);
+					
+					// start rasterizing any unusual characters in the file now,
+					// so we don't have to do it all at once when it's first rendered
+					Font *font = buffer_font(buffer);
+					if (font) {
+						for (u32 i = 0; i < nlines; ++i)
+							text_font_prefetch(font, lines[i].str, lines[i].len);
+					}
 				}
 				
 			}
@@ -3180,9 +3629,37 @@ void buffer_reload(TextBuffer *buffer) {
 bool buffer_externally_changed(TextBuffer *buffer) {
 	if (!buffer_is_named_file(buffer))
 		return false;
+	// we're checking right now, so any change the file watcher told us about is accounted for
+	buffer->disk_change_pending = false;
 	return buffer->last_write_time != timespec_to_seconds(time_last_modified(buffer->path));
 }
 
+void buffer_file_changed_on_disk(TextBuffer *buffer) {
+	buffer->disk_change_pending = true;
+}
+
+bool buffer_maybe_externally_changed(TextBuffer *buffer) {
+	Ted *ted = buffer->ted;
+	FileWatcher *watcher = ted->file_watcher;
+	if (!watcher) {
+		// no way of knowing without checking
+		return buffer_is_named_file(buffer);
+	}
+	if (buffer->disk_change_pending)
+		return true;
+	if (buffer_is_named_file(buffer) && !file_watcher_is_watching(watcher, buffer->path)) {
+		// watching the file failed (e.g. we ran out of inotify watches),
+		// so we have to check it ourselves. every so often, try watching it again.
+		if (ted->frame_time >= buffer->watch_retry_time) {
+			buffer->watch_retry_time = ted->frame_time + 1.0;
+			file_watcher_remove(watcher, buffer->path);
+			file_watcher_add(watcher, buffer->path);
+		}
+		return true;
+	}
+	return false;
+}
+
 void buffer_new_file(TextBuffer *buffer, const char *path) {
 	if (path && !path_is_absolute(path)) {
 		buffer_error(buffer, "Cannot create %s: path is not absolute", path);
@@ -3191,8 +3668,11 @@ void buffer_new_file(TextBuffer *buffer, const char *path) {
 	
 	buffer_clear(buffer);
 
-	if (path)
+	if (path) {
 		buffer->path = buffer_strdup(buffer, path);
+		if (buffer->path)
+			file_watcher_add(buffer->ted->file_watcher, buffer->path);
+	}
 	buffer->lines_capacity = 4;
 	buffer->lines = buffer_calloc(buffer, buffer->lines_capacity, sizeof *buffer->lines);
 	buffer->nlines = 1;
@@ -3356,6 +3836,9 @@ bool buffer_save_as(TextBuffer *buffer, const char *new_path) {
 			buffer_send_lsp_did_close(buffer, lsp, prev_path);
 		buffer->last_lsp_check = -INFINITY;
 		// we'll send a didOpen the next time buffer_lsp is called.
+		if (prev_path)
+			file_watcher_remove(buffer->ted->file_watcher, prev_path);
+		file_watcher_add(buffer->ted->file_watcher, buffer->path);
 		free(prev_path);
 		buffer_detect_indentation(buffer);
 		return true;
@@ -3367,12 +3850,14 @@ bool buffer_save_as(TextBuffer *buffer, const char *new_path) {
 }
 
 u32 buffer_first_rendered_line(TextBuffer *buffer) {
-	return (u32)buffer->scroll_y;
+	return buffer_row_to_line(buffer, (u32)buffer->scroll_y);
 }
 
 u32 buffer_last_rendered_line(TextBuffer *buffer) {
-	u32 line = buffer_first_rendered_line(buffer) + (u32)buffer_display_lines(buffer) + 1;
-	return clamp_u32(line, 0, buffer->nlines);
+	u32 row = (u32)buffer->scroll_y + (u32)buffer_display_lines(buffer) + 1;
+	if (row >= buffer_row_count(buffer))
+		return buffer->nlines;
+	return buffer_row_to_line(buffer, row);
 }
 
 void buffer_goto_word_at_cursor(TextBuffer *buffer, GotoType type) {
@@ -3474,6 +3959,190 @@ bool buffer_cursor_move_to_matching_bracket(TextBuffer *buffer) {
 	return false;
 }
 
+/// width of the minimap texture, in columns of text
+#define MINIMAP_COLUMNS 128
+/// height of a line in the minimap in pixels (unless the whole file doesn't fit)
+#define MINIMAP_LINE_HEIGHT 2.0f
+
+// compute line->summary for the minimap.
+// `char_types` should be NULL if the line isn't syntax highlighted.
+static void line_summarize(Line *line, const SyntaxCharType *char_types, u32 tab_width) {
+	u32 type_counts[SYNTAX_TODO + 1] = {0};
+	u32 col = 0, first = U32_MAX, end = 0;
+	for (u32 i = 0; i < line->len; ++i) {
+		char32_t c = line->str[i];
+		if (c == '\t') {
+			col = (col / tab_width + 1) * tab_width;
+			continue;
+		}
+		if (!is32_space(c)) {
+			if (first == U32_MAX) first = col;
+			end = col + 1;
+			if (char_types && char_types[i] < arr_count(type_counts))
+				++type_counts[char_types[i]];
+		}
+		++col;
+	}
+	SyntaxCharType type = SYNTAX_NORMAL;
+	for (u32 t = 0; t < arr_count(type_counts); ++t) {
+		if (type_counts[t] > type_counts[type])
+			type = (SyntaxCharType)t;
+	}
+	line->summary = (LineSummary){
+		.indent = (u8)min_u32(first == U32_MAX ? 0 : first, U8_MAX),
+		.end = (u8)min_u32(end, U8_MAX),
+		.type = type,
+	};
+}
+
+// redraw rows [row0, row1) of the minimap texture from the line summaries
+static void buffer_minimap_update_rows(TextBuffer *buffer, u32 row0, u32 row1) {
+	if (row0 >= row1) return;
+	const Settings *settings = buffer_settings(buffer);
+	const u32 lines_per_row = buffer->minimap_lines_per_row;
+	const u32 nrows = row1 - row0;
+	const size_t row_size = MINIMAP_COLUMNS * 4;
+	u8 *pixels = calloc(nrows, row_size);
+	if (!pixels) return;
+	for (u32 r = 0; r < nrows; ++r) {
+		u8 *row = &pixels[r * row_size];
+		const u32 line0 = (row0 + r) * lines_per_row;
+		const u32 line1 = min_u32(line0 + lines_per_row, buffer->nlines);
+		for (u32 l = line0; l < line1; ++l) {
+			const LineSummary summary = buffer->lines[l].summary;
+			const u32 end = min_u32(summary.end, MINIMAP_COLUMNS);
+			const u32 color = settings_color(settings, syntax_char_type_to_color_setting(summary.type));
+			for (u32 x = summary.indent; x < end; ++x) {
+				u8 *pixel = &row[4 * x];
+				pixel[0] = (u8)(color >> 24);
+				pixel[1] = (u8)(color >> 16);
+				pixel[2] = (u8)(color >> 8);
+				// tone it down a bit so that the view & markers stand out
+				pixel[3] = (u8)((color & 0xff) * 3 / 4);
+			}
+		}
+	}
+	glBindTexture(GL_TEXTURE_2D, buffer->minimap_texture);
+	glTexSubImage2D(GL_TEXTURE_2D, 0, 0, (GLint)row0, MINIMAP_COLUMNS, (GLsizei)nrows, GL_RGBA, GL_UNSIGNED_BYTE, pixels);
+	gl_frame_stats.upload_bytes += nrows * row_size;
+	free(pixels);
+}
+
+// bring the minimap texture up to date for a minimap which is `height` pixels tall.
+//
+// the line summaries are downsampled so that the texture never has more rows than
+// the minimap has pixels, so the minimap can always be drawn as a single quad.
+static void buffer_minimap_update(TextBuffer *buffer, float height) {
+	const u32 nlines = buffer->nlines;
+	const u32 max_rows = max_u32(1, (u32)height);
+	const u32 lines_per_row = (nlines + max_rows - 1) / max_rows;
+	const u32 rows = (nlines + lines_per_row - 1) / lines_per_row;
+	if (!buffer->minimap_texture || lines_per_row != buffer->minimap_lines_per_row
+		|| rows != buffer->minimap_rows) {
+		// texture needs to be resized
+		if (!buffer->minimap_texture) {
+			glGenTextures(1, &buffer->minimap_texture);
+			glBindTexture(GL_TEXTURE_2D, buffer->minimap_texture);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+			glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+		}
+		glBindTexture(GL_TEXTURE_2D, buffer->minimap_texture);
+		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, MINIMAP_COLUMNS, (GLsizei)rows, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+		buffer->minimap_lines_per_row = lines_per_row;
+		buffer->minimap_rows = rows;
+		buffer_minimap_update_rows(buffer, 0, rows);
+	} else {
+		u32 start = buffer->minimap_dirty_start, end = buffer->minimap_dirty_end;
+		if (nlines != buffer->minimap_nlines) {
+			// everything after the edit has moved
+			if (start > end) start = 0;
+			end = nlines - 1;
+		}
+		if (start <= end)
+			buffer_minimap_update_rows(buffer, start / lines_per_row, min_u32(end / lines_per_row + 1, rows));
+	}
+	buffer->minimap_nlines = nlines;
+	buffer->minimap_dirty_start = U32_MAX;
+	buffer->minimap_dirty_end = 0;
+}
+
+// draw the minimap in `r`, and handle clicking on it
+static void buffer_render_minimap(TextBuffer *buffer, Rect r) {
+	Ted *ted = buffer->ted;
+	const Settings *settings = buffer_settings(buffer);
+	buffer_minimap_update(buffer, r.size.y);
+	
+	const u32 rows = buffer->minimap_rows;
+	const float row_height = minf(MINIMAP_LINE_HEIGHT * (float)buffer->minimap_lines_per_row, r.size.y / (float)rows);
+	const float line_height = row_height / (float)buffer->minimap_lines_per_row;
+	float x1, y1, x2, y2;
+	rect_coords(r, &x1, &y1, &x2, &y2);
+	
+	// click or drag to scroll
+	if (!menu_is_any_open(ted)) {
+		arr_foreach_ptr(ted->mouse_clicks[SDL_BUTTON_LEFT], MouseClick, click) {
+			if (rect_contains_point(r, click->pos))
+				buffer->minimap_dragging = true;
+		}
+	}
+	if (!(ted->mouse_state & SDL_BUTTON_LMASK))
+		buffer->minimap_dragging = false;
+	if (buffer->minimap_dragging) {
+		double line = clampd((ted->mouse_pos.y - y1) / line_height, 0, buffer->nlines - 1);
+		buffer->scroll_y = buffer_line_to_row(buffer, (u32)line) + (line - floor(line))
+			- buffer_display_lines(buffer) * 0.5;
+		buffer_correct_scroll(buffer);
+	}
+	
+	gl_geometry_rect(r, settings_color(settings, COLOR_MINIMAP_BG));
+	gl_image_rect(rect4(x1, y1, x2, y1 + (float)rows * row_height), buffer->minimap_texture);
+	
+	{
+		// part of the file which is on screen (the minimap shows folded lines, so this can be taller than the screen)
+		const float display_lines = buffer_display_lines(buffer);
+		const u32 first_row = (u32)buffer->scroll_y;
+		const u32 last_row = min_u32((u32)(buffer->scroll_y + display_lines), buffer_row_count(buffer) - 1);
+		const u32 first_line = buffer_row_to_line(buffer, first_row);
+		const u32 last_line = buffer_row_to_line(buffer, last_row);
+		const float hidden_on_screen = (float)((last_line - first_line) - (last_row - first_row));
+		gl_geometry_rect(rect_xywh(x1, y1 + (float)(buffer->scroll_y + (first_line - first_row)) * line_height,
+			x2 - x1, maxf((display_lines + hidden_on_screen) * line_height, 2)),
+			settings_color(settings, COLOR_MINIMAP_VIEW));
+	}
+	
+	const float marker_height = maxf(line_height, 2);
+	if (ted->find && find_search_buffer(ted) == buffer) {
+		// find results
+		const u32 color = settings_color(settings, COLOR_FIND_HL);
+		const u32 nresults = arr_len(ted->find_results);
+		i64 prev_y = -1;
+		for (u32 i = 0; i < nresults; ++i) {
+			const float y = y1 + (float)find_result_line(ted, i) * line_height;
+			// lots of results can end up on the same pixel -- only draw one of them
+			if ((i64)y == prev_y) continue;
+			prev_y = (i64)y;
+			gl_geometry_rect(rect_xywh(x1, y, x2 - x1, marker_height), color);
+		}
+	}
+	{
+		// diagnostics
+		const float marker_width = (x2 - x1) * 0.25f;
+		i64 prev_y = -1;
+		arr_foreach_ptr(buffer->diagnostics, Diagnostic, diagnostic) {
+			const float y = y1 + (float)diagnostic->pos.line * line_height;
+			if ((i64)y == prev_y) continue;
+			prev_y = (i64)y;
+			ColorSetting color_setting = 0;
+			ted_color_settings_for_message_type(diagnostic->severity, NULL, &color_setting);
+			gl_geometry_rect(rect_xywh(x2 - marker_width, y, marker_width, marker_height),
+				settings_color(settings, color_setting) | 0xff);
+		}
+	}
+	gl_geometry_draw();
+}
+
 // Render the text buffer in the given rectangle
 void buffer_render(TextBuffer *buffer, Rect r) {
 	const Settings *settings = buffer_settings(buffer);
@@ -3487,6 +4156,7 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 		buffer->y1 = buffer->y2 = r.pos.y;
 		return;
 	}
+	const double render_start = bench_time_start();
 	
 	float x1, y1, x2, y2;
 	rect_coords(r, &x1, &y1, &x2, &y2);
@@ -3502,7 +4172,11 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 	const float padding = settings->padding;
 	const float border_thickness = settings->border_thickness;
 	
+	const u32 start_row = (u32)buffer->scroll_y;
 	u32 start_line = buffer_first_rendered_line(buffer); // line to start rendering from
+	// first fold which might be on screen
+	const u32 start_fold = buffer_fold_search(buffer, start_line);
+	const u32 nfolds = arr_len(buffer->folds);
 	
 	{
 		const u32 border_color = settings_color(settings, COLOR_BORDER); // color of border around buffer
@@ -3516,10 +4190,10 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 	y2 -= border_thickness;
 	
 	
-	float render_start_y = y1 - (float)(buffer->scroll_y - start_line) * char_height; // where the 1st line is rendered
+	float render_start_y = y1 - (float)(buffer->scroll_y - start_row) * char_height; // where the 1st line is rendered
 
 
-	if (!settings->show_diagnostics || !lsp) {
+	if ((!settings->show_diagnostics || !lsp) && buffer->diagnostics) {
 		buffer_diagnostics_clear(buffer);
 	}
 
@@ -3543,6 +4217,7 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 		float y = render_start_y;
 		const u32 cursor_line = buffer->cursor_pos.line;
 		const float diagnostic_x2 = x1 + line_number_width + 2;
+		u32 fold = start_fold;
 		for (u32 line = start_line; line < nlines; ++line) {
 			char str[32] = {0};
 			strbuf_printf(str, "%" PRIu32, line + 1); // convert line number to string
@@ -3590,6 +4265,10 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 			y += char_height;
 			
 			if (y > y2) break;
+			if (fold < nfolds && buffer->folds[fold].start == line) {
+				// skip over hidden lines
+				line = buffer->folds[fold++].end;
+			}
 		}
 
 		x1 = diagnostic_x2;
@@ -3597,11 +4276,26 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 		gl_geometry_rect(rect_xywh(x1, y1, border_thickness, y2 - y1), settings_color(settings, COLOR_LINE_NUMBERS_SEPARATOR));
 		x1 += border_thickness;
 	}
+	
+	Rect minimap_rect = {0};
+	if (!buffer->is_line_buffer && settings->minimap) {
+		const float minimap_width = settings->minimap_width;
+		if (x2 - x1 > 2 * minimap_width) {
+			minimap_rect = rect4(x2 - minimap_width, y1, x2, y2);
+			x2 -= minimap_width + border_thickness;
+			// line separating text from minimap
+			gl_geometry_rect(rect_xywh(x2, y1, border_thickness, y2 - y1), settings_color(settings, COLOR_BORDER));
+		}
+	}
+	const bool minimap = minimap_rect.size.x > 0;
 
 	if (x2 < x1) x2 = x1;
 	if (y2 < y1) y2 = y1;
 	buffer->x1 = x1; buffer->y1 = y1; buffer->x2 = x2; buffer->y2 = y2;
-	if (x1 == x2 || y1 == y2) return;
+	if (x1 == x2 || y1 == y2) {
+		bench_time_end(BENCH_BUFFER_RENDER, render_start);
+		return;
+	}
 
 	if (buffer->is_line_buffer) {
 		// handle clicks
@@ -3656,7 +4350,16 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 			sel_start = buffer->selection_pos;
 		} else assert(0);
 
-		for (u32 line_idx = max_u32(sel_start.line, start_line); line_idx <= sel_end.line; ++line_idx) {
+		const u32 first_line = max_u32(sel_start.line, start_line);
+		u32 fold = buffer_fold_search(buffer, first_line);
+		if (fold > 0 && buffer->folds[fold - 1].end >= first_line)
+			--fold; // first line is hidden
+		for (u32 line_idx = first_line; line_idx <= sel_end.line; ++line_idx) {
+			if (fold < nfolds && buffer->folds[fold].start < line_idx) {
+				// this line is hidden
+				line_idx = buffer->folds[fold++].end;
+				continue;
+			}
 			Line *line = &buffer->lines[line_idx];
 			u32 index1 = line_idx == sel_start.line ? sel_start.index : 0;
 			u32 index2 = line_idx == sel_end.line ? sel_end.index : line->len;
@@ -3676,6 +4379,7 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 					hl_p1,
 					(vec2){(float)highlight_width, char_height}
 				);
+				if (hl_p1.y > y2) break; // rest of the selection is off screen
 				buffer_clip_rect(buffer, &hl_rect);
 				gl_geometry_rect(hl_rect, settings_color(settings, buffer->view_only ? COLOR_VIEW_ONLY_SELECTION_BG : COLOR_SELECTION_BG));
 			}
@@ -3689,26 +4393,69 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 	SyntaxCharType *char_types = NULL;
 	bool syntax_highlighting = language && language != LANG_TEXT && settings->syntax_highlighting;
 
+	if (minimap) {
+		struct {
+			u32 tab_width;
+			Language language;
+			bool syntax_highlighting;
+			u64 colors_hash;
+		} minimap_key;
+		memset(&minimap_key, 0, sizeof minimap_key); // make sure padding is zeroed
+		minimap_key.tab_width = buffer_tab_width(buffer);
+		minimap_key.language = language;
+		minimap_key.syntax_highlighting = syntax_highlighting;
+		minimap_key.colors_hash = str_hash((const char *)settings->colors, sizeof settings->colors);
+		u64 key = str_hash((const char *)&minimap_key, sizeof minimap_key);
+		if (key != buffer->minimap_key) {
+			buffer->minimap_key = key;
+			// recompute all the line summaries
+			buffer->frame_earliest_line_modified = 0;
+			buffer->frame_latest_line_modified = nlines - 1;
+		}
+	} else {
+		// the line summaries aren't kept up to date without the minimap
+		buffer->minimap_key = 0;
+	}
+
 	if (buffer->frame_latest_line_modified >= buffer->frame_earliest_line_modified
-		&& syntax_highlighting) {
-		// update syntax cache
+		&& (syntax_highlighting || minimap)) {
+		// update syntax cache and line summaries
+		const double highlight_start = bench_time_start();
 		if (buffer->frame_latest_line_modified >= buffer->nlines)
 			buffer->frame_latest_line_modified = buffer->nlines - 1;
 		Line *earliest = &buffer->lines[buffer->frame_earliest_line_modified];
 		Line *latest = &buffer->lines[buffer->frame_latest_line_modified];
 		Line *buffer_last_line = &buffer->lines[buffer->nlines - 1];
 		Line *start = earliest == buffer->lines ? earliest : earliest - 1;
+		const u32 tab_width = buffer_tab_width(buffer);
 
-		for (Line *line = start; line != buffer_last_line; ++line) {
+		Line *line = start;
+		for (; ; ++line) {
 			SyntaxState syntax = line->syntax;
-			syntax_highlight(&syntax, language, line->str, line->len, NULL);
-			if (line > latest && line[1].syntax == syntax) {
+			if (minimap) {
+				if (syntax_highlighting) {
+					if (arr_len(char_types) < line->len)
+						arr_set_len(char_types, line->len);
+					syntax_highlight(&syntax, language, line->str, line->len, char_types);
+				}
+				line_summarize(line, syntax_highlighting ? char_types : NULL, tab_width);
+			} else {
+				syntax_highlight(&syntax, language, line->str, line->len, NULL);
+			}
+			if (line == buffer_last_line)
+				break;
+			if (line > latest && (!syntax_highlighting || line[1].syntax == syntax)) {
 				// no further necessary changes to the cache
 				break;
-			} else {
-				line[1].syntax = syntax;
 			}
+			if (syntax_highlighting)
+				line[1].syntax = syntax;
 		}
+		if (minimap) {
+			buffer->minimap_dirty_start = min_u32(buffer->minimap_dirty_start, (u32)(start - buffer->lines));
+			buffer->minimap_dirty_end = max_u32(buffer->minimap_dirty_end, (u32)(line - buffer->lines));
+		}
+		bench_time_end(BENCH_SYNTAX_HIGHLIGHT, highlight_start);
 	}
 	buffer->frame_earliest_line_modified = U32_MAX;
 	buffer->frame_latest_line_modified = 0;
@@ -3727,30 +4474,141 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 	if (!syntax_highlighting)
 		settings_color_floats(settings, COLOR_TEXT, text_state.color);
 
+	{
+		// lines which haven't changed since the last frame can be drawn
+		// by just moving their old geometry, as long as nothing else has changed.
+		struct {
+			u32 font_generation;
+			u32 tab_width;
+			Language language;
+			bool syntax_highlighting;
+			float x_render_offset, min_x, max_x;
+			u64 colors_hash;
+		} cache_key;
+		memset(&cache_key, 0, sizeof cache_key); // make sure padding is zeroed
+		cache_key.font_generation = text_font_generation(font);
+		cache_key.tab_width = buffer_tab_width(buffer);
+		cache_key.language = language;
+		cache_key.syntax_highlighting = syntax_highlighting;
+		cache_key.x_render_offset = text_state.x_render_offset;
+		cache_key.min_x = text_state.min_x;
+		cache_key.max_x = text_state.max_x;
+		cache_key.colors_hash = str_hash((const char *)settings->colors, sizeof settings->colors);
+		u64 key = str_hash((const char *)&cache_key, sizeof cache_key);
+		if (key != buffer->line_render_cache_key) {
+			buffer_line_render_cache_clear(buffer);
+			buffer->line_render_cache_key = key;
+		}
+	}
+	const u32 render_count = ++buffer->render_count;
+	const double layout_start = bench_time_start();
+	// time spent highlighting in the loop below, which doesn't count as layout
+	double line_highlight_time = 0;
+
 	buffer->first_line_on_screen = start_line;
 	buffer->last_line_on_screen = 0;
+	u32 fold = start_fold;
 	for (u32 line_idx = start_line; line_idx < nlines; ++line_idx) {
 		Line *line = &lines[line_idx];
-		if (arr_len(char_types) < line->len) {
-			arr_set_len(char_types, line->len);
+		const bool folded = fold < nfolds && buffer->folds[fold].start == line_idx;
+		// only cache lines which aren't clipped vertically
+		// (leave a margin of a line for glyphs which stick out)
+		const bool cacheable = text_state.y - char_height >= y1
+			&& text_state.y + 2 * char_height <= y2;
+		LineRenderCache *cached = NULL;
+		u64 hash = 0;
+		if (cacheable) {
+			hash = str_hash((const char *)line->str, line->len * sizeof *line->str);
+			if (syntax_highlighting) {
+				hash = hash * 0x100000001b3 + line->syntax;
+				if (line->semantic)
+					hash ^= str_hash((const char *)line->semantic, arr_size_in_bytes(line->semantic));
+			}
+			arr_foreach_ptr(line->hints, const LineHint, hint) {
+				hash = hash * 0x100000001b3 + hint->index;
+				hash ^= str_hash((const char *)hint->label, hint->len * sizeof *hint->label);
+			}
+			if (folded)
+				hash = hash * 0x100000001b3 + 1;
+			const float y_frac = (float)(text_state.y - floor(text_state.y));
+			arr_foreach_ptr(buffer->line_render_cache, LineRenderCache, entry) {
+				if (entry->hash == hash && entry->len == line->len && entry->y_frac == y_frac) {
+					cached = entry;
+					break;
+				}
+			}
+			if (!cached) {
+				cached = arr_addp(buffer->line_render_cache);
+				if (cached) {
+					cached->hash = hash;
+					cached->len = line->len;
+					cached->y_frac = y_frac;
+				}
+			}
 		}
-		if (syntax_highlighting) {
-			SyntaxState syntax_state = line->syntax;
-			syntax_highlight(&syntax_state, language, line->str, line->len, char_types);
+		if (cached) {
+			cached->last_used = render_count;
 		}
-		for (u32 i = 0; i < line->len; ++i) {
-			char32_t c = line->str[i];
+		
+		if (cached && cached->run) {
+			text_run_draw(cached->run, text_state.y);
+		} else {
+			if (cached)
+				text_run_record_start(font);
+			if (arr_len(char_types) < line->len) {
+				arr_set_len(char_types, line->len);
+			}
 			if (syntax_highlighting) {
-				SyntaxCharType type = char_types[i];
-				ColorSetting color = syntax_char_type_to_color_setting(type);
-				color_u32_to_floats(settings_color(settings, color), text_state.color);
+				const double highlight_start = bench_time_start();
+				SyntaxState syntax_state = line->syntax;
+				syntax_highlight(&syntax_state, language, line->str, line->len, char_types);
+				arr_foreach_ptr(line->semantic, const SemanticRun, run) {
+					for (u32 i = run->index; i < run->index + run->len && i < line->len; ++i) {
+						// keep TODOs in comments highlighted
+						if (char_types[i] != SYNTAX_TODO || run->type != SYNTAX_COMMENT)
+							char_types[i] = run->type;
+					}
+				}
+				line_highlight_time += bench_time_end(BENCH_SYNTAX_HIGHLIGHT, highlight_start);
+			}
+			const LineHint *hint = line->hints, *hints_end = hint + arr_len(line->hints);
+			for (u32 i = 0; i <= line->len; ++i) {
+				if (hint < hints_end && hint->index <= i) {
+					// draw inlay hints before this character
+					settings_color_floats(settings, COLOR_INLAY_HINT, text_state.color);
+					for (; hint < hints_end && hint->index <= i; ++hint)
+						buffer_render_inlay_hint(font, &text_state, hint);
+					if (!syntax_highlighting)
+						settings_color_floats(settings, COLOR_TEXT, text_state.color);
+				}
+				if (i == line->len) break;
+				char32_t c = line->str[i];
+				if (syntax_highlighting) {
+					SyntaxCharType type = char_types[i];
+					ColorSetting color = syntax_char_type_to_color_setting(type);
+					color_u32_to_floats(settings_color(settings, color), text_state.color);
+				}
+				buffer_render_char(buffer, font, &text_state, c);
+			}
+			if (folded) {
+				// show that there's more here
+				settings_color_floats(settings, COLOR_COMMENT, text_state.color);
+				for (const char *p = " ..."; *p; ++p)
+					buffer_render_char(buffer, font, &text_state, (char32_t)*p);
+				if (!syntax_highlighting)
+					settings_color_floats(settings, COLOR_TEXT, text_state.color);
 			}
-			buffer_render_char(buffer, font, &text_state, c);
+			if (cached)
+				cached->run = text_run_record_end(font, text_state.y);
 		}
 
 		// next line
 		text_state_break_kerning(&text_state);
 		text_state.x = 0;
+		if (folded) {
+			// skip over hidden lines
+			line_idx = buffer->folds[fold++].end;
+		}
 		if (text_state.y > text_state.max_y) {
 			buffer->last_line_on_screen = line_idx;
 			// made it to the bottom of the buffer view.
@@ -3760,9 +4618,21 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 	}
 	if (buffer->last_line_on_screen == 0) buffer->last_line_on_screen = nlines - 1;
 	
+	// forget about lines which weren't on screen this frame
+	for (u32 i = 0; i < arr_len(buffer->line_render_cache); ) {
+		LineRenderCache *entry = &buffer->line_render_cache[i];
+		if (entry->last_used != render_count) {
+			text_run_free(entry->run);
+			arr_remove(buffer->line_render_cache, i);
+		} else {
+			++i;
+		}
+	}
+	
 	arr_free(char_types);
 
 	text_render(font);
+	bench_time_end(BENCH_TEXT_LAYOUT, layout_start + line_highlight_time);
 
 	if (ted->active_buffer == buffer) {
 		
@@ -3813,6 +4683,9 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 		gl_geometry_draw();
 	}
 	
+	if (minimap)
+		buffer_render_minimap(buffer, minimap_rect);
+	
 	if (hover_diagnostic) {
 		const vec2 mouse_pos = ted_mouse_pos(ted);
 		const float diagnostic_x1 = mouse_pos.x,
@@ -3842,6 +4715,7 @@ void buffer_render(TextBuffer *buffer, Rect r) {
 		gl_geometry_draw();
 		text_render(font);
 	}
+	bench_time_end(BENCH_BUFFER_RENDER, render_start);
 }
 
 void buffer_indent_lines(TextBuffer *buffer, u32 first_line, u32 last_line) {
@@ -4066,20 +4940,6 @@ void buffer_highlight_lsp_range(TextBuffer *buffer, LSPRange range, ColorSetting
 	}
 }
 
-static MessageType diagnostic_severity(const LSPDiagnostic *diagnostic) {
-	switch (diagnostic->severity) {
-	case LSP_DIAGNOSTIC_SEVERITY_ERROR:
-		return MESSAGE_ERROR;
-	case LSP_DIAGNOSTIC_SEVERITY_WARNING:
-		return MESSAGE_WARNING;
-	case LSP_DIAGNOSTIC_SEVERITY_INFORMATION:
-	case LSP_DIAGNOSTIC_SEVERITY_HINT:
-		return MESSAGE_INFO;
-	}
-	assert(0);
-	return MESSAGE_INFO;
-}
-
 static int diagnostic_cmp(const void *av, const void *bv) {
 	const Diagnostic *a = av, *b = bv;
 	// first sort by line
@@ -4093,29 +4953,545 @@ static int diagnostic_cmp(const void *av, const void *bv) {
 	return 0;
 }
 
-void buffer_publish_diagnostics(TextBuffer *buffer, const LSPRequest *request, LSPDiagnostic *diagnostics) {
+void buffer_publish_diagnostics(TextBuffer *buffer, u32 generation, const StoredDiagnostic *diagnostics, size_t ndiagnostics, const char *strings) {
 	const Settings *settings = buffer_settings(buffer);
 	buffer_diagnostics_clear(buffer);
+	// (record the generation even if we're not showing them, so that they aren't published again every frame)
+	buffer->diagnostics_generation = generation;
 	if (!settings->show_diagnostics) {
 		return;
 	}
-	arr_foreach_ptr(diagnostics, const LSPDiagnostic, diagnostic) {
+	for (size_t i = 0; i < ndiagnostics; ++i) {
+		const StoredDiagnostic *diagnostic = &diagnostics[i];
 		Diagnostic *d = arr_addp(buffer->diagnostics);
+		if (!d) break;
 		d->pos = buffer_pos_from_lsp(buffer, diagnostic->range.start);
-		d->severity = diagnostic_severity(diagnostic);
+		d->severity = diagnostic->severity;
 		char message[280];
-		const char *code = lsp_request_string(request, diagnostic->code);
+		const char *code = &strings[diagnostic->code];
 		if (*code) {
 			str_printf(message, sizeof message - 4, "[%s] %s", code,
-				lsp_request_string(request, diagnostic->message));
+				&strings[diagnostic->message]);
 		} else {
 			str_cpy(message, sizeof message - 4,
-				lsp_request_string(request, diagnostic->message));
+				&strings[diagnostic->message]);
 		}
 		strcpy(&message[sizeof message - 4], "...");
 		d->message = str_dup(message);
-		const char *url = lsp_request_string(request, diagnostic->code_description_uri);
+		const char *url = &strings[diagnostic->url];
 		d->url = *url ? str_dup(url) : NULL;
 	}
 	arr_qsort(buffer->diagnostics, diagnostic_cmp);
 }
+
+u32 buffer_diagnostics_generation(TextBuffer *buffer) {
+	return buffer->diagnostics_generation;
+}
+
+void buffer_set_semantic_tokens(TextBuffer *buffer, u32 first_line, u32 last_line, const SemanticToken *tokens, size_t ntokens) {
+	buffer->has_semantic_tokens = true;
+	if (first_line >= buffer->nlines) return;
+	if (last_line >= buffer->nlines) last_line = buffer->nlines - 1;
+	for (u32 l = first_line; l <= last_line; ++l) {
+		arr_clear(buffer->lines[l].semantic);
+	}
+	// position of the end of the previous token, so that converting
+	// from UTF-16 doesn't need to start from the beginning of the line every time.
+	u32 line_idx = U32_MAX, index = 0, utf16 = 0;
+	for (size_t t = 0; t < ntokens; ++t) {
+		const SemanticToken *token = &tokens[t];
+		if (token->pos.line < first_line) continue;
+		if (token->pos.line > last_line) break;
+		const Line *line = &buffer->lines[token->pos.line];
+		if (token->pos.line != line_idx || token->pos.character < utf16) {
+			line_idx = token->pos.line;
+			index = utf16 = 0;
+		}
+		while (index < line->len && utf16 < token->pos.character) {
+			utf16 += line->str[index] >= 0x10000 ? 2 : 1;
+			++index;
+		}
+		const u32 start = index;
+		const u64 end_utf16 = (u64)token->pos.character + token->len;
+		while (index < line->len && utf16 < end_utf16) {
+			utf16 += line->str[index] >= 0x10000 ? 2 : 1;
+			++index;
+		}
+		if (index == start) continue;
+		SemanticRun *prev = arr_lastp(line->semantic);
+		if (prev && prev->index + prev->len > start) continue; // overlapping token
+		SemanticRun run = {
+			.index = start,
+			.len = (u16)min_u32(index - start, U16_MAX),
+			.type = token->type,
+		};
+		arr_add(buffer->lines[line_idx].semantic, run);
+	}
+}
+
+void buffer_clear_semantic_tokens(TextBuffer *buffer) {
+	for (u32 l = 0; l < buffer->nlines; ++l) {
+		arr_clear(buffer->lines[l].semantic);
+	}
+	buffer->has_semantic_tokens = false;
+}
+
+bool buffer_has_semantic_tokens(TextBuffer *buffer) {
+	return buffer->has_semantic_tokens;
+}
+
+static int line_hint_cmp(const void *av, const void *bv) {
+	const LineHint *a = av, *b = bv;
+	if (a->index < b->index) return -1;
+	if (a->index > b->index) return 1;
+	return 0;
+}
+
+void buffer_set_inlay_hints(TextBuffer *buffer, u32 first_line, u32 last_line, const InlayHint *hints, size_t nhints) {
+	if (first_line >= buffer->nlines) return;
+	if (last_line >= buffer->nlines) last_line = buffer->nlines - 1;
+	for (u32 l = first_line; l <= last_line; ++l) {
+		line_hints_clear(&buffer->lines[l]);
+	}
+	for (size_t h = 0; h < nhints; ++h) {
+		const InlayHint *hint = &hints[h];
+		if (hint->pos.line < first_line || hint->pos.line > last_line)
+			continue;
+		String32 label = str32_from_utf8(hint->label);
+		if (!label.len) {
+			str32_free(&label);
+			continue;
+		}
+		for (size_t i = 0; i < label.len; ++i) {
+			// hints have to fit on one line
+			if (label.str[i] == '\t' || label.str[i] == '\n' || label.str[i] == '\r')
+				label.str[i] = ' ';
+		}
+		const BufferPos pos = buffer_pos_from_lsp(buffer, hint->pos);
+		LineHint line_hint = {
+			.index = pos.index,
+			.len = (u32)label.len,
+			.label = label.str,
+		};
+		arr_add(buffer->lines[pos.line].hints, line_hint);
+	}
+	for (u32 l = first_line; l <= last_line; ++l) {
+		// (the server doesn't have to send them in order)
+		arr_qsort(buffer->lines[l].hints, line_hint_cmp);
+	}
+}
+
+void buffer_clear_inlay_hints(TextBuffer *buffer) {
+	for (u32 l = 0; l < buffer->nlines; ++l) {
+		line_hints_clear(&buffer->lines[l]);
+	}
+}
+
+// put `line` at the top of the screen (plus `frac` of a row), e.g. after folds have changed
+static void buffer_scroll_to_line(TextBuffer *buffer, u32 line, double frac) {
+	buffer->scroll_y = buffer_line_to_row(buffer, line) + frac;
+	buffer_correct_scroll(buffer);
+}
+
+bool buffer_fold(TextBuffer *buffer, u32 start, u32 end) {
+	if (end >= buffer->nlines) end = buffer->nlines - 1;
+	if (start >= end || buffer_fold_hiding_line(buffer, start))
+		return false;
+	const u32 top_line = buffer_first_rendered_line(buffer);
+	const double frac = buffer->scroll_y - floor(buffer->scroll_y);
+	// folds inside this one are merged into it
+	u32 i = buffer_fold_search(buffer, start);
+	while (i < arr_len(buffer->folds) && buffer->folds[i].start <= end) {
+		end = max_u32(end, buffer->folds[i].end);
+		arr_remove(buffer->folds, i);
+	}
+	Fold fold = {.start = start, .end = end};
+	arr_insert(buffer->folds, i, fold);
+	buffer_folds_update(buffer);
+	if (buffer->cursor_pos.line > start && buffer->cursor_pos.line <= end) {
+		// don't leave the cursor somewhere hidden
+		buffer->cursor_pos = (BufferPos){.line = start, .index = buffer->lines[start].len};
+		buffer->selection = false;
+	}
+	buffer_scroll_to_line(buffer, top_line, frac);
+	return true;
+}
+
+bool buffer_unfold(TextBuffer *buffer, u32 line) {
+	Fold *fold = buffer_fold_hiding_line(buffer, line);
+	if (!fold) {
+		u32 i = buffer_fold_search(buffer, line);
+		if (i < arr_len(buffer->folds) && buffer->folds[i].start == line)
+			fold = &buffer->folds[i];
+	}
+	if (!fold) return false;
+	const u32 top_line = buffer_first_rendered_line(buffer);
+	const double frac = buffer->scroll_y - floor(buffer->scroll_y);
+	arr_remove(buffer->folds, (u32)(fold - buffer->folds));
+	buffer_folds_update(buffer);
+	buffer_scroll_to_line(buffer, top_line, frac);
+	return true;
+}
+
+void buffer_unfold_all(TextBuffer *buffer) {
+	if (!buffer->folds) return;
+	const u32 top_line = buffer_first_rendered_line(buffer);
+	const double frac = buffer->scroll_y - floor(buffer->scroll_y);
+	arr_clear(buffer->folds);
+	buffer_scroll_to_line(buffer, top_line, frac);
+}
+
+bool buffer_line_is_folded(TextBuffer *buffer, u32 line) {
+	u32 i = buffer_fold_search(buffer, line);
+	return i < arr_len(buffer->folds) && buffer->folds[i].start == line;
+}
+
+// highlight `line`, putting the character types in `*char_types` (which is resized as needed)
+static void buffer_line_char_types(TextBuffer *buffer, const Line *line, SyntaxCharType **char_types) {
+	if (arr_len(*char_types) < line->len)
+		arr_set_len(*char_types, line->len);
+	SyntaxState syntax = line->syntax;
+	if (line->len)
+		syntax_highlight(&syntax, buffer_language(buffer), line->str, line->len, *char_types);
+}
+
+// is this a character we should look at when matching brackets for folding?
+static bool fold_char_is_code(SyntaxCharType type) {
+	return type != SYNTAX_COMMENT && type != SYNTAX_STRING
+		&& type != SYNTAX_CHARACTER && type != SYNTAX_TODO;
+}
+
+// fold up to the bracket matching the first one which isn't closed on `line_idx`
+static bool buffer_fold_range_from_brackets(TextBuffer *buffer, u32 line_idx, u32 *end, SyntaxCharType **char_types) {
+	const Language language = buffer_language(buffer);
+	const Line *line = &buffer->lines[line_idx];
+	buffer_line_char_types(buffer, line, char_types);
+	u32 depth = 0;
+	for (u32 i = 0; i < line->len; ++i) {
+		char32_t c = line->str[i];
+		if (!fold_char_is_code((*char_types)[i]) || !syntax_matching_bracket(language, c))
+			continue;
+		if (syntax_is_opening_bracket(language, c))
+			++depth;
+		else if (depth)
+			--depth;
+	}
+	if (!depth) return false;
+
+	for (u32 l = line_idx + 1; l < buffer->nlines; ++l) {
+		line = &buffer->lines[l];
+		buffer_line_char_types(buffer, line, char_types);
+		bool first_char = true;
+		for (u32 i = 0; i < line->len; ++i) {
+			char32_t c = line->str[i];
+			if (is32_space(c)) continue;
+			if (fold_char_is_code((*char_types)[i]) && syntax_matching_bracket(language, c)) {
+				if (syntax_is_opening_bracket(language, c)) {
+					++depth;
+				} else if (--depth == 0) {
+					// keep the closing bracket visible if it starts the line
+					*end = first_char ? l - 1 : l;
+					return *end > line_idx;
+				}
+			}
+			first_char = false;
+		}
+	}
+	return false;
+}
+
+// number of columns of indentation `line` has (U32_MAX if it's blank)
+static u32 buffer_line_indent_columns(TextBuffer *buffer, const Line *line) {
+	const u32 tab_width = buffer_tab_width(buffer);
+	u32 col = 0;
+	for (u32 i = 0; i < line->len; ++i) {
+		char32_t c = line->str[i];
+		if (c == '\t')
+			col = (col / tab_width + 1) * tab_width;
+		else if (is32_space(c))
+			++col;
+		else
+			return col;
+	}
+	return U32_MAX;
+}
+
+// fold the lines after `line_idx` which are indented more than it
+static bool buffer_fold_range_from_indentation(TextBuffer *buffer, u32 line_idx, u32 *end) {
+	const u32 indent = buffer_line_indent_columns(buffer, &buffer->lines[line_idx]);
+	if (indent == U32_MAX) return false;
+	*end = line_idx;
+	for (u32 l = line_idx + 1; l < buffer->nlines; ++l) {
+		const u32 line_indent = buffer_line_indent_columns(buffer, &buffer->lines[l]);
+		if (line_indent == U32_MAX) continue; // blank lines don't end the range
+		if (line_indent <= indent) break;
+		*end = l;
+	}
+	return *end > line_idx;
+}
+
+bool buffer_fold_range_at_line(TextBuffer *buffer, u32 line, u32 *end) {
+	if (line >= buffer->nlines) return false;
+	SyntaxCharType *char_types = NULL;
+	bool found = buffer_fold_range_from_brackets(buffer, line, end, &char_types)
+		|| buffer_fold_range_from_indentation(buffer, line, end);
+	arr_free(char_types);
+	return found;
+}
+
+// replace the buffer's contents with `text`
+static void buffer_test_set_text(TextBuffer *buffer, const char *text) {
+	buffer_new_file(buffer, NULL);
+	buffer_insert_utf8_at_pos(buffer, buffer_pos_start_of_file(buffer), text);
+}
+
+// check the semantic runs on `line`, written as  index+len:type  separated by spaces
+static void buffer_test_expect_semantic_runs(TextBuffer *buffer, u32 line, const char *expected) {
+	StrBuilder got = str_builder_new();
+	arr_foreach_ptr(buffer->lines[line].semantic, const SemanticRun, run) {
+		str_builder_appendf(&got, "%s%" PRIu32 "+%u:%u", arr_len(got.str) > 1 ? " " : "",
+			run->index, (unsigned)run->len, (unsigned)run->type);
+	}
+	if (!streq(got.str, expected)) {
+		fprintf(stderr, "semantic runs on line %" PRIu32 " are \"%s\" (expected \"%s\")\n", line, got.str, expected);
+		exit(1);
+	}
+	str_builder_free(&got);
+}
+
+static void buffer_test_semantic_runs(Ted *ted) {
+	TextBuffer *buffer = buffer_new(ted);
+	const SemanticToken tokens[] = {
+		{.pos = {0, 0}, .len = 3, .type = SYNTAX_KEYWORD},
+		{.pos = {0, 4}, .len = 3, .type = SYNTAX_CONSTANT},
+		{.pos = {0, 10}, .len = 3, .type = SYNTAX_BUILTIN},
+		{.pos = {1, 0}, .len = 3, .type = SYNTAX_KEYWORD},
+		{.pos = {1, 4}, .len = 3, .type = SYNTAX_CONSTANT},
+	};
+	const char *const text = "int foo = bar;\nint baz;";
+	
+	// single-line edits
+	buffer_test_set_text(buffer, text);
+	buffer_set_semantic_tokens(buffer, 0, 1, tokens, arr_count(tokens));
+	buffer_test_expect_semantic_runs(buffer, 0, "0+3:1 4+3:7 10+3:2");
+	// typing inside a token makes it longer
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 5}, "xy");
+	buffer_test_expect_semantic_runs(buffer, 0, "0+3:1 4+5:7 12+3:2");
+	// typing at the start of a token moves it
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 0}, "a");
+	buffer_test_expect_semantic_runs(buffer, 0, "1+3:1 5+5:7 13+3:2");
+	// deleting part of a token
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 2}, 2);
+	buffer_test_expect_semantic_runs(buffer, 0, "1+1:1 3+5:7 11+3:2");
+	// deleting a whole token
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 3}, 6);
+	buffer_test_expect_semantic_runs(buffer, 0, "1+1:1 5+3:2");
+	buffer_test_expect_semantic_runs(buffer, 1, "0+3:1 4+3:7");
+	
+	// splitting a line in the middle of a token
+	buffer_test_set_text(buffer, text);
+	buffer_set_semantic_tokens(buffer, 0, 1, tokens, arr_count(tokens));
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 5}, "\n  ");
+	buffer_test_expect_semantic_runs(buffer, 0, "0+3:1 4+1:7");
+	buffer_test_expect_semantic_runs(buffer, 1, "2+2:7 7+3:2");
+	buffer_test_expect_semantic_runs(buffer, 2, "0+3:1 4+3:7");
+	// and joining it back together (the token stays in two pieces)
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 5}, 3);
+	buffer_test_expect_semantic_runs(buffer, 0, "0+3:1 4+1:7 5+2:7 10+3:2");
+	buffer_test_expect_semantic_runs(buffer, 1, "0+3:1 4+3:7");
+	
+	// inserting several lines before the tokens
+	buffer_test_set_text(buffer, text);
+	buffer_set_semantic_tokens(buffer, 0, 1, tokens, arr_count(tokens));
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 0}, "a\nb\nc");
+	buffer_test_expect_semantic_runs(buffer, 0, "");
+	buffer_test_expect_semantic_runs(buffer, 2, "1+3:1 5+3:7 11+3:2");
+	buffer_test_expect_semantic_runs(buffer, 3, "0+3:1 4+3:7");
+	
+	// deleting across lines joins the end of the last line onto the first
+	buffer_test_set_text(buffer, text);
+	buffer_set_semantic_tokens(buffer, 0, 1, tokens, arr_count(tokens));
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 5}, 14);
+	buffer_test_expect_semantic_runs(buffer, 0, "0+3:1 4+1:7 5+3:7");
+	if (buffer->nlines != 1) {
+		fprintf(stderr, "multi-line deletion left %" PRIu32 " lines\n", buffer->nlines);
+		exit(1);
+	}
+	buffer_free(buffer);
+}
+
+// check the inlay hints on `line`, written as  index:label  separated by spaces
+static void buffer_test_expect_inlay_hints(TextBuffer *buffer, u32 line, const char *expected) {
+	StrBuilder got = str_builder_new();
+	arr_foreach_ptr(buffer->lines[line].hints, const LineHint, hint) {
+		char *label = str32_to_utf8_cstr(str32(hint->label, hint->len));
+		str_builder_appendf(&got, "%s%" PRIu32 ":%s", arr_len(got.str) > 1 ? " " : "",
+			hint->index, label);
+		free(label);
+	}
+	if (!streq(got.str, expected)) {
+		fprintf(stderr, "inlay hints on line %" PRIu32 " are \"%s\" (expected \"%s\")\n", line, got.str, expected);
+		exit(1);
+	}
+	str_builder_free(&got);
+}
+
+static void buffer_test_inlay_hints(Ted *ted) {
+	TextBuffer *buffer = buffer_new(ted);
+	const InlayHint hints[] = {
+		{.pos = {0, 4}, .label = "x"},
+		{.pos = {0, 7}, .label = "y"},
+		{.pos = {0, 10}, .label = "t"},
+		{.pos = {1, 4}, .label = "z"},
+	};
+	const char *const text = "foo(a, b);\nbar(c);";
+	
+	// typing at a hint moves it along with the text after it
+	buffer_test_set_text(buffer, text);
+	buffer_set_inlay_hints(buffer, 0, 1, hints, arr_count(hints));
+	buffer_test_expect_inlay_hints(buffer, 0, "4:x 7:y 10:t");
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 4}, "qq");
+	buffer_test_expect_inlay_hints(buffer, 0, "6:x 9:y 12:t");
+	// typing after a hint doesn't
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 7}, "r");
+	buffer_test_expect_inlay_hints(buffer, 0, "6:x 10:y 13:t");
+	// a hint at the end of the line stays at the end
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 13}, " ");
+	buffer_test_expect_inlay_hints(buffer, 0, "6:x 10:y 14:t");
+	buffer_test_expect_inlay_hints(buffer, 1, "4:z");
+	
+	// splitting a line at a hint
+	buffer_test_set_text(buffer, text);
+	buffer_set_inlay_hints(buffer, 0, 1, hints, arr_count(hints));
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){0, 7}, "\n  ");
+	buffer_test_expect_inlay_hints(buffer, 0, "4:x");
+	buffer_test_expect_inlay_hints(buffer, 1, "2:y 5:t");
+	buffer_test_expect_inlay_hints(buffer, 2, "4:z");
+	// and joining it back together
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 7}, 3);
+	buffer_test_expect_inlay_hints(buffer, 0, "4:x 7:y 10:t");
+	buffer_test_expect_inlay_hints(buffer, 1, "4:z");
+	
+	// deleting the character after a hint removes it
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 4}, 3);
+	buffer_test_expect_inlay_hints(buffer, 0, "4:y 7:t");
+	// deleting the characters before a hint doesn't
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 2}, 2);
+	buffer_test_expect_inlay_hints(buffer, 0, "2:y 5:t");
+	
+	// deleting across lines
+	buffer_test_set_text(buffer, text);
+	buffer_set_inlay_hints(buffer, 0, 1, hints, arr_count(hints));
+	buffer_delete_chars_at_pos(buffer, (BufferPos){0, 5}, 10);
+	buffer_test_expect_inlay_hints(buffer, 0, "4:x 5:z");
+	buffer_free(buffer);
+}
+
+// check the folds, written as  start-end  separated by spaces
+static void buffer_test_expect_folds(TextBuffer *buffer, const char *expected) {
+	StrBuilder got = str_builder_new();
+	arr_foreach_ptr(buffer->folds, const Fold, fold) {
+		str_builder_appendf(&got, "%s%" PRIu32 "-%" PRIu32, arr_len(got.str) > 1 ? " " : "", fold->start, fold->end);
+	}
+	if (!streq(got.str, expected)) {
+		fprintf(stderr, "folds are \"%s\" (expected \"%s\")\n", got.str, expected);
+		exit(1);
+	}
+	str_builder_free(&got);
+	
+	// rows and lines should convert back and forth
+	u32 row = 0;
+	for (u32 line = 0; line < buffer->nlines; ++line) {
+		const Fold *hiding = buffer_fold_hiding_line(buffer, line);
+		const u32 visible_line = hiding ? hiding->start : line;
+		if (!hiding && line > 0)
+			++row;
+		if (buffer_line_to_row(buffer, line) != row || buffer_row_to_line(buffer, row) != visible_line) {
+			fprintf(stderr, "with folds \"%s\", line %" PRIu32 " is in row %" PRIu32 " and row %" PRIu32 " shows line %" PRIu32
+				" (expected row %" PRIu32 ", line %" PRIu32 ")\n", expected, line, buffer_line_to_row(buffer, line),
+				row, buffer_row_to_line(buffer, row), row, visible_line);
+			exit(1);
+		}
+	}
+	if (buffer_row_count(buffer) != row + 1) {
+		fprintf(stderr, "with folds \"%s\", there are %" PRIu32 " rows (expected %" PRIu32 ")\n", expected, buffer_row_count(buffer), row + 1);
+		exit(1);
+	}
+}
+
+// start over with lines 0 to 19, and the given folds
+static void buffer_test_reset_folds(TextBuffer *buffer, const u32 *folds, size_t nfolds) {
+	StrBuilder text = str_builder_new();
+	for (int i = 0; i < 20; ++i)
+		str_builder_appendf(&text, i ? "\nline%d" : "line%d", i);
+	buffer_test_set_text(buffer, text.str);
+	str_builder_free(&text);
+	for (size_t i = 0; i + 1 < nfolds; i += 2)
+		buffer_fold(buffer, folds[i], folds[i + 1]);
+}
+
+static void buffer_test_folds(Ted *ted) {
+	TextBuffer *buffer = buffer_new(ted);
+	buffer_test_reset_folds(buffer, NULL, 0);
+	buffer_test_expect_folds(buffer, "");
+	
+	// adjacent folds (the first line of the second one comes right after the hidden lines of the first)
+	const u32 adjacent[] = {2, 4, 5, 7};
+	buffer_test_reset_folds(buffer, adjacent, arr_count(adjacent));
+	buffer_test_expect_folds(buffer, "2-4 5-7");
+	// folds inside a new fold get merged into it
+	buffer_fold(buffer, 10, 12);
+	buffer_fold(buffer, 9, 11);
+	buffer_test_expect_folds(buffer, "2-4 5-7 9-12");
+	buffer_fold(buffer, 1, 6);
+	buffer_test_expect_folds(buffer, "1-7 9-12");
+	// can't fold starting from a hidden line
+	if (buffer_fold(buffer, 3, 8)) {
+		fprintf(stderr, "buffer_fold started a fold on a hidden line\n");
+		exit(1);
+	}
+	buffer_fold(buffer, 0, 19);
+	buffer_test_expect_folds(buffer, "0-19");
+	
+	const u32 fold[] = {5, 8};
+	// edits before a fold move it
+	buffer_test_reset_folds(buffer, fold, arr_count(fold));
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){1, 2}, "a\nb\n");
+	buffer_test_expect_folds(buffer, "7-10");
+	buffer_delete_chars_at_pos(buffer, (BufferPos){1, 2}, 4);
+	buffer_test_expect_folds(buffer, "5-8");
+	// edits after a fold don't affect it
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){9, 0}, "a\nb\n");
+	buffer_delete_chars_at_pos(buffer, (BufferPos){12, 0}, 10);
+	buffer_test_expect_folds(buffer, "5-8");
+	// editing the line before the hidden lines keeps the fold
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){5, 0}, "x");
+	buffer_delete_chars_at_pos(buffer, (BufferPos){5, 1}, 2);
+	buffer_test_expect_folds(buffer, "5-8");
+	// ...as does adding lines after its text
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){5, buffer->lines[5].len}, "\n");
+	buffer_test_expect_folds(buffer, "6-9");
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){6, 0}, "  \nfoo");
+	buffer_test_expect_folds(buffer, "7-10");
+	// but splitting it in the middle unfolds
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){7, 1}, "\n");
+	buffer_test_expect_folds(buffer, "");
+	// edits to the hidden lines unfold
+	buffer_test_reset_folds(buffer, fold, arr_count(fold));
+	buffer_insert_utf8_at_pos(buffer, (BufferPos){7, 0}, "x");
+	buffer_test_expect_folds(buffer, "");
+	buffer_test_reset_folds(buffer, fold, arr_count(fold));
+	buffer_delete_chars_at_pos(buffer, (BufferPos){8, 0}, 1);
+	buffer_test_expect_folds(buffer, "");
+	// deleting lines starting before the fold and ending inside it unfolds
+	buffer_test_reset_folds(buffer, fold, arr_count(fold));
+	buffer_delete_chars_at_pos(buffer, (BufferPos){3, 0}, 20);
+	buffer_test_expect_folds(buffer, "");
+	buffer_free(buffer);
+}
+
+void buffer_test(Ted *ted) {
+	buffer_test_semantic_runs(ted);
+	buffer_test_inlay_hints(ted);
+	buffer_test_folds(ted);
+}
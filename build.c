@@ -16,6 +16,8 @@ struct BuildError {
 };
 
 void build_stop(Ted *ted) {
+	// (the build buffer might be showing usages which are still coming in)
+	usages_cancel_lookup(ted);
 	if (ted->building)
 		process_kill(&ted->build_process);
 	ted->building = false;
@@ -230,109 +232,123 @@ static bool is_source_path(char32_t c) {
 		|| strchr(allowed_ascii_symbols_in_path, (char)c);
 }
 
-void build_check_for_errors(Ted *ted) {
-	const Settings *settings = ted_active_settings(ted);
-	
+// parse line `line_idx` of the build output. returns true and fills out `*error` if it's an error.
+static bool build_parse_error_line(Ted *ted, u32 line_idx, BuildError *error) {
 	TextBuffer *buffer = ted->build_buffer;
-	arr_clear(ted->build_errors);
-	for (u32 line_idx = 0; line_idx < buffer_line_count(buffer); ++line_idx) {
-		String32 line = buffer_get_line(buffer, line_idx);
-		if (line.len < 3) {
-			continue;
+	String32 line = buffer_get_line(buffer, line_idx);
+	if (line.len < 3) {
+		return false;
+	}
+	bool is_error = true;
+	// well, for a bit of time i thought rust was weird
+	// and treated tabs as 4 columns
+	// apparently its just a bug, which ive filed here
+	// https://github.com/rust-lang/rust/issues/109537
+	// we could treat ::: references as 4-columns-per-tab,
+	// but then that would be wrong if the bug gets fixed.
+	// all this is to say that columns_per_tab is currently always 1,
+	// but might be useful at some point.
+	u8 columns_per_tab = 1;
+	char32_t *p = line.str, *end = p + line.len;
+	
+	{
+		// rust errors look like:
+		// "     --> file:line:column"
+		// and can also include stuff like
+		// "     ::: file:line:column"
+		while (p != end && *p == ' ') {
+			++p;
 		}
-		bool is_error = true;
-		// well, for a bit of time i thought rust was weird
-		// and treated tabs as 4 columns
-		// apparently its just a bug, which ive filed here
-		// https://github.com/rust-lang/rust/issues/109537
-		// we could treat ::: references as 4-columns-per-tab,
-		// but then that would be wrong if the bug gets fixed.
-		// all this is to say that columns_per_tab is currently always 1,
-		// but might be useful at some point.
-		u8 columns_per_tab = 1;
-		char32_t *p = line.str, *end = p + line.len;
-		
-		{
-			// rust errors look like:
-			// "     --> file:line:column"
-			// and can also include stuff like
-			// "     ::: file:line:column"
-			while (p != end && *p == ' ') {
-				++p;
-			}
-			if (end - p >= 4) {
-				String32 first4 = str32(p, 4);
-				if (str32_cmp_ascii(first4, "::: ") == 0 || str32_cmp_ascii(first4, "--> ") == 0) {
-					p += 4;
-				}
+		if (end - p >= 4) {
+			String32 first4 = str32(p, 4);
+			if (str32_cmp_ascii(first4, "::: ") == 0 || str32_cmp_ascii(first4, "--> ") == 0) {
+				p += 4;
 			}
 		}
+	}
+
+	// check if we have something like main.c:5 or main.c(5)
 	
-		// check if we have something like main.c:5 or main.c(5)
-		
-		// get file name
-		char32_t *filename_start = p;
-		while (p != end) {
-			if ((*p == ':' || *p == '(')
-				&& p != line.str + 1) // don't catch "C:\thing\whatever.c" as "filename: C, line number: \thing\whatever.c"
-				break;
-			if (!is_source_path(*p)) {
-				is_error = false;
-				break;
-			}
-			++p;
+	// get file name
+	char32_t *filename_start = p;
+	while (p != end) {
+		if ((*p == ':' || *p == '(')
+			&& p != line.str + 1) // don't catch "C:\thing\whatever.c" as "filename: C, line number: \thing\whatever.c"
+			break;
+		if (!is_source_path(*p)) {
+			is_error = false;
+			break;
 		}
-		if (p == end) is_error = false;
-		u32 filename_len = (u32)(p - filename_start);
-		if (filename_len == 0) is_error = false;
-	
-		if (is_error) {
-			++p; // move past : or (
-			int line_number = parse_nonnegative_integer(&p, end);
-			if (p != end && line_number > 0) {
-				// it's an error
-				line_number -= 1; // line numbers in output start from 1.
-				int column_number = 0;
-				// check if there's a column number
-				if (*p == ':') {
-					++p; // move past :
-					int num = parse_nonnegative_integer(&p, end);
-					if (num > 0) {
-						column_number = num - 1; // column numbers in output start from 1
-					}
+		++p;
+	}
+	if (p == end) is_error = false;
+	u32 filename_len = (u32)(p - filename_start);
+	if (filename_len == 0) is_error = false;
+
+	if (is_error) {
+		++p; // move past : or (
+		int line_number = parse_nonnegative_integer(&p, end);
+		if (p != end && line_number > 0) {
+			// it's an error
+			line_number -= 1; // line numbers in output start from 1.
+			int column_number = 0;
+			// check if there's a column number
+			if (*p == ':') {
+				++p; // move past :
+				int num = parse_nonnegative_integer(&p, end);
+				if (num > 0) {
+					column_number = num - 1; // column numbers in output start from 1
 				}
-				char *filename = str32_to_utf8_cstr(str32(filename_start, filename_len));
-				if (filename) {
-					char full_path[TED_PATH_MAX];
-					const char *pfilename = filename;
+			}
+			char *filename = str32_to_utf8_cstr(str32(filename_start, filename_len));
+			if (filename) {
+				char full_path[TED_PATH_MAX];
+				const char *pfilename = filename;
+				path_full(ted->build_dir, pfilename, full_path, sizeof full_path);
+				// if the file does not exist, try stripping ../
+				// this can solve "file not found" problems if your build command involves
+				// cd'ing to a directory inside build_dir
+				while (fs_path_type(full_path) == FS_NON_EXISTENT
+					&& (str_has_prefix(pfilename, "../")
+					#if _WIN32
+					|| str_has_prefix(pfilename, "..\\")
+					#endif
+					)) {
+					pfilename += 3;
 					path_full(ted->build_dir, pfilename, full_path, sizeof full_path);
-					// if the file does not exist, try stripping ../
-					// this can solve "file not found" problems if your build command involves
-					// cd'ing to a directory inside build_dir
-					while (fs_path_type(full_path) == FS_NON_EXISTENT
-						&& (str_has_prefix(pfilename, "../")
-						#if _WIN32
-						|| str_has_prefix(pfilename, "..\\")
-						#endif
-						)) {
-						pfilename += 3;
-						path_full(ted->build_dir, pfilename, full_path, sizeof full_path);
-					}
-										
-					BuildError error = {
-						.path = str_dup(full_path),
-						.line = (u32)line_number,
-						.column = (u32)column_number,
-						.columns_per_tab = columns_per_tab,
-						.build_output_line = line_idx
-					};
-					arr_add(ted->build_errors, error);
-					free(filename);
 				}
+									
+				*error = (BuildError){
+					.path = str_dup(full_path),
+					.line = (u32)line_number,
+					.column = (u32)column_number,
+					.columns_per_tab = columns_per_tab,
+					.build_output_line = line_idx
+				};
+				free(filename);
+				return true;
 			}
 		}
 	}
-	
+	return false;
+}
+
+static void build_parse_errors(Ted *ted) {
+	TextBuffer *buffer = ted->build_buffer;
+	arr_foreach_ptr(ted->build_errors, BuildError, err) {
+		free(err->path);
+	}
+	arr_clear(ted->build_errors);
+	for (u32 line_idx = 0; line_idx < buffer_line_count(buffer); ++line_idx) {
+		BuildError error = {0};
+		if (build_parse_error_line(ted, line_idx, &error))
+			arr_add(ted->build_errors, error);
+	}
+}
+
+void build_check_for_errors(Ted *ted) {
+	const Settings *settings = ted_active_settings(ted);
+	build_parse_errors(ted);
 	if (settings->jump_to_build_error) {
 		// go to the first error (if there is one)
 		ted->build_error = 0;
@@ -340,6 +356,35 @@ void build_check_for_errors(Ted *ted) {
 	}
 }
 
+void build_lines_inserted(Ted *ted, const u32 *lines, u32 nlines) {
+	BuildError *errors = NULL;
+	const u32 current = ted->build_error;
+	ted->build_error = 0;
+	// merge the errors we already have (whose lines have moved down) with the ones on the new lines
+	u32 e = 0, l = 0;
+	while (e < arr_len(ted->build_errors) || l < nlines) {
+		if (e < arr_len(ted->build_errors)) {
+			BuildError *err = &ted->build_errors[e];
+			// `err->build_output_line + l` is where its line is now,
+			// if the first `l` new lines come before it
+			if (l == nlines || lines[l] > err->build_output_line + l) {
+				err->build_output_line += l;
+				if (e == current)
+					ted->build_error = arr_len(errors);
+				arr_add(errors, *err);
+				++e;
+				continue;
+			}
+		}
+		BuildError error = {0};
+		if (build_parse_error_line(ted, lines[l], &error))
+			arr_add(errors, error);
+		++l;
+	}
+	arr_free(ted->build_errors);
+	ted->build_errors = errors;
+}
+
 void build_frame(Ted *ted, float x1, float y1, float x2, float y2) {
 	TextBuffer *buffer = ted->build_buffer;
 	assert(ted->build_shown);
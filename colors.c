@@ -59,6 +59,9 @@ static ColorName color_names[] = {
 	{COLOR_LINE_NUMBERS, "line-numbers"},
 	{COLOR_CURSOR_LINE_NUMBER, "cursor-line-number"},
 	{COLOR_LINE_NUMBERS_SEPARATOR, "line-numbers-separator"},
+	{COLOR_MINIMAP_BG, "minimap-bg"},
+	{COLOR_MINIMAP_VIEW, "minimap-view"},
+	{COLOR_INLAY_HINT, "inlay-hint"},
 };
 
 static_assert_if_possible(arr_count(color_names) == COLOR_COUNT)
@@ -67,6 +67,11 @@ typedef enum {
 	COLOR_CURSOR_LINE_NUMBER,
 	COLOR_LINE_NUMBERS_SEPARATOR,
 	
+	COLOR_MINIMAP_BG,
+	COLOR_MINIMAP_VIEW,
+	
+	COLOR_INLAY_HINT,
+	
 
 	COLOR_COUNT
 } ColorSetting;
@@ -72,6 +72,11 @@ static CommandName command_names[] = {
 	{"find-usages", CMD_FIND_USAGES},
 	{"copy-path", CMD_COPY_PATH},
 	{"goto-definition", CMD_GOTO_DEFINITION},
+	{"outline", CMD_OUTLINE},
+	{"incoming-calls", CMD_INCOMING_CALLS},
+	{"outgoing-calls", CMD_OUTGOING_CALLS},
+	{"supertypes", CMD_SUPERTYPES},
+	{"subtypes", CMD_SUBTYPES},
 	{"goto-definition-at-cursor", CMD_GOTO_DEFINITION_AT_CURSOR},
 	{"goto-declaration-at-cursor", CMD_GOTO_DECLARATION_AT_CURSOR},
 	{"goto-type-definition-at-cursor", CMD_GOTO_TYPE_DEFINITION_AT_CURSOR},
@@ -107,6 +112,8 @@ static CommandName command_names[] = {
 	{"rename-symbol", CMD_RENAME_SYMBOL},
 	{"format-file", CMD_FORMAT_FILE},
 	{"format-selection", CMD_FORMAT_SELECTION},
+	{"fold", CMD_FOLD},
+	{"unfold-all", CMD_UNFOLD_ALL},
 };
 
 static_assert_if_possible(arr_count(command_names) == CMD_COUNT)
@@ -338,6 +345,8 @@ void command_execute_ex(Ted *ted, Command c, const CommandArgument *full_argumen
 			buffer = ted->line_buffer;
 			ted_switch_to_buffer(ted, buffer);
 			buffer_select_all(buffer);
+		} else if (menu_is_open(ted, MENU_HIERARCHY) && buffer == ted->line_buffer) {
+			hierarchy_toggle_expanded(ted);
 		} else if (autocomplete_is_open(ted) || autocomplete_has_phantom(ted)) {
 			autocomplete_select_completion(ted);
 		} else if (buffer) {
@@ -492,6 +501,24 @@ void command_execute_ex(Ted *ted, Command c, const CommandArgument *full_argumen
 	case CMD_GOTO_DEFINITION:
 		menu_open(ted, MENU_GOTO_DEFINITION);
 		break;
+	case CMD_OUTLINE:
+		if (buffer && !buffer_is_line_buffer(buffer) && document_symbols_available(ted, buffer))
+			menu_open(ted, MENU_OUTLINE);
+		else
+			ted_flash_error_cursor(ted);
+		break;
+	case CMD_INCOMING_CALLS:
+		hierarchy_open(ted, HIERARCHY_INCOMING_CALLS);
+		break;
+	case CMD_OUTGOING_CALLS:
+		hierarchy_open(ted, HIERARCHY_OUTGOING_CALLS);
+		break;
+	case CMD_SUPERTYPES:
+		hierarchy_open(ted, HIERARCHY_SUPERTYPES);
+		break;
+	case CMD_SUBTYPES:
+		hierarchy_open(ted, HIERARCHY_SUBTYPES);
+		break;
 	case CMD_GOTO_DEFINITION_AT_CURSOR: {
 		if (buffer && buffer_is_named_file(buffer)) {
 			buffer_goto_word_at_cursor(buffer, GOTO_DEFINITION);
@@ -711,5 +738,13 @@ void command_execute_ex(Ted *ted, Command c, const CommandArgument *full_argumen
 	case CMD_FORMAT_SELECTION:
 		format_selection(ted);
 		break;
+	case CMD_FOLD:
+		if (buffer && !buffer_is_line_buffer(buffer))
+			folding_toggle(ted, buffer);
+		break;
+	case CMD_UNFOLD_ALL:
+		if (buffer)
+			buffer_unfold_all(buffer);
+		break;
 	}
 }
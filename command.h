@@ -112,8 +112,19 @@ typedef enum {
 	CMD_GOTO_DEFINITION_AT_CURSOR,
 	CMD_GOTO_DECLARATION_AT_CURSOR,
 	CMD_GOTO_TYPE_DEFINITION_AT_CURSOR,
+	/// menu of symbols in the current file
+	CMD_OUTLINE,
+	/// show what calls the function at the cursor
+	CMD_INCOMING_CALLS,
+	/// show what the function at the cursor calls
+	CMD_OUTGOING_CALLS,
+	CMD_SUPERTYPES,
+	CMD_SUBTYPES,
 	CMD_FORMAT_FILE,
 	CMD_FORMAT_SELECTION,
+	/// fold the lines at the cursor, or unfold them if they're already folded
+	CMD_FOLD,
+	CMD_UNFOLD_ALL,
 	CMD_LSP_RESET,
 	
 	CMD_COPY,
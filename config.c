@@ -106,6 +106,9 @@ static const SettingBool settings_bool[] = {
 	{"phantom-completions", &settings_zero.phantom_completions, true},
 	{"signature-help-enabled", &settings_zero.signature_help_enabled, true},
 	{"document-links", &settings_zero.document_links, true},
+	{"semantic-tokens", &settings_zero.semantic_tokens, true},
+	{"inlay-hints", &settings_zero.inlay_hints, true},
+	{"breadcrumbs", &settings_zero.breadcrumbs, true},
 	{"lsp-enabled", &settings_zero.lsp_enabled, true},
 	{"lsp-log", &settings_zero.lsp_log, true},
 	{"hover-enabled", &settings_zero.hover_enabled, true},
@@ -120,6 +123,7 @@ static const SettingBool settings_bool[] = {
 	{"jump-to-build-error", &settings_zero.jump_to_build_error, true},
 	{"force-monospace", &settings_zero.force_monospace, true},
 	{"show-diagnostics", &settings_zero.show_diagnostics, true},
+	{"minimap", &settings_zero.minimap, true},
 };
 static const SettingBool setting_auto_add_newline = SETTING_AUTO_ADD_NEWLINE;
 static const SettingBool setting_indent_with_spaces = SETTING_INDENT_WITH_SPACES;
@@ -143,6 +147,7 @@ static const SettingU16 settings_u16[] = {
 	{"error-display-time", &settings_zero.error_display_time, 0, U16_MAX, false},
 	{"framerate-cap", &settings_zero.framerate_cap, 3, 1000, false},
 	{"lsp-port", &settings_zero.lsp_port, 0, 65535, true},
+	{"minimap-width", &settings_zero.minimap_width, 10, 1000, true},
 };
 const SettingU16 setting_text_size_dpi_aware = {NULL, &settings_zero.text_size, 0, U16_MAX, false};
 static const SettingU32 settings_u32[] = {
@@ -179,9 +184,7 @@ bool config_applies_to(Config *cfg, const char *path, Language language) {
 	if (cfg->path) {
 		if (!path)
 			return false;
-		pcre2_match_data_8 *match_data = pcre2_match_data_create_from_pattern_8(cfg->path, NULL);
-		bool match = pcre2_match_8(cfg->path, (const u8 *)path, PCRE2_ZERO_TERMINATED, 0, 0, match_data, NULL) > 0;
-		pcre2_match_data_free_8(match_data);
+		bool match = pcre2_match_8(cfg->path, (const u8 *)path, PCRE2_ZERO_TERMINATED, 0, 0, cfg->path_match_data, NULL) > 0;
 		if (!match)
 			return false;
 	}
@@ -254,6 +257,7 @@ typedef struct {
 } ConfigReader;
 
 static void config_verr(ConfigReader *cfg, const char *fmt, va_list args) {
+	++cfg->ted->config_error_count;
 	if (cfg->error) return;
 	cfg->error = true;
 	char error[1024] = {0};
@@ -290,6 +294,9 @@ static void settings_free_set(Settings *settings, const bool *set) {
 			free((void *)act->argument.string);
 		}
 		arr_free(settings->key_actions);
+		free(settings->key_action_table.displacements);
+		free(settings->key_action_table.slots);
+		memset(&settings->key_action_table, 0, sizeof settings->key_action_table);
 	}
 	if (set[offsetof(Settings, bg_shader)])
 		gl_rc_sab_decref(&settings->bg_shader);
@@ -314,6 +321,7 @@ void settings_free(Settings *settings) {
 
 static void config_free(Config *cfg) {
 	settings_free(&cfg->settings);
+	pcre2_match_data_free_8(cfg->path_match_data);
 	pcre2_code_free_8(cfg->path);
 	free(cfg->path_regex);
 	rc_str_decref(&cfg->source);
@@ -938,17 +946,171 @@ static void config_parse_line(ConfigReader *reader, Config *cfg) {
 	}
 }
 
-static int key_action_qsort_cmp_combo(const void *av, const void *bv) {
-	const KeyAction *a = av, *b = bv;
-	if (a->key_combo.value < b->key_combo.value)
+// sorts indices into key actions by key combo, then by index
+static int key_action_index_cmp(void *context, const void *av, const void *bv) {
+	const KeyAction *actions = context;
+	const u32 a = *(const u32 *)av, b = *(const u32 *)bv;
+	const u64 a_combo = actions[a].key_combo.value, b_combo = actions[b].key_combo.value;
+	if (a_combo < b_combo)
 		return -1;
-	if (a->key_combo.value > b->key_combo.value)
+	if (a_combo > b_combo)
+		return 1;
+	if (a < b)
+		return -1;
+	if (a > b)
 		return 1;
 	return 0;
 }
 
+// sort key actions by key combo, and remove duplicates.
+// if a key combo appears multiple times, the last action wins
+// (since that comes from the config with the highest priority).
+static void settings_sort_key_actions(Settings *settings) {
+	KeyAction *actions = settings->key_actions;
+	const u32 n = arr_len(actions);
+	if (n == 0) return;
+	u32 *order = calloc(n, sizeof *order);
+	if (!order) return;
+	for (u32 i = 0; i < n; ++i)
+		order[i] = i;
+	qsort_with_context(order, n, sizeof *order, key_action_index_cmp, actions);
+	KeyAction *sorted = NULL;
+	arr_reserve(sorted, n);
+	for (u32 i = 0; i < n; ++i) {
+		KeyAction *action = &actions[order[i]];
+		if (i + 1 < n && actions[order[i + 1]].key_combo.value == action->key_combo.value) {
+			// overridden
+			free((void *)action->argument.string);
+			continue;
+		}
+		arr_add(sorted, *action);
+	}
+	free(order);
+	arr_free(settings->key_actions);
+	settings->key_actions = sorted;
+}
+
+// which bucket a key combo belongs to
+static u32 key_action_table_bucket(const KeyActionTable *table, KeyCombo key_combo) {
+	return (u32)((key_combo.value * 0x9e3779b97f4a7c15) >> 32) % table->nbuckets;
+}
+
+// which slot a key combo belongs to, given the displacement for its bucket
+static u32 key_action_table_slot(const KeyActionTable *table, KeyCombo key_combo, u32 displacement) {
+	u64 h = (key_combo.value ^ ((u64)displacement * 0xc2b2ae3d27d4eb4f)) * 0xff51afd7ed558ccd;
+	h ^= h >> 29;
+	h *= 0xc4ceb9fe1a85ec53;
+	return (u32)(h >> (64 - table->slot_bits));
+}
+
+// build a perfect hash table for key_actions, using "hash, displace":
+// key combos are split up into buckets, and then for each bucket (largest first)
+// we find a hash function which maps all of its combos to empty slots.
+static void settings_build_key_action_table(Settings *settings) {
+	KeyActionTable *table = &settings->key_action_table;
+	const KeyAction *actions = settings->key_actions;
+	const u32 n = arr_len(actions);
+	if (n == 0) return;
+	table->nbuckets = n / 4 + 1;
+	table->slot_bits = 1;
+	while ((1u << table->slot_bits) < 2 * n)
+		++table->slot_bits;
+	
+	// sort combos by bucket, so that each bucket's combos are contiguous
+	u32 *bucket_start = calloc(table->nbuckets + 1, sizeof *bucket_start);
+	u32 *bucket_entries = calloc(n, sizeof *bucket_entries);
+	u32 *buckets_by_size = calloc(table->nbuckets, sizeof *buckets_by_size);
+	table->displacements = calloc(table->nbuckets, sizeof *table->displacements);
+	if (!bucket_start || !bucket_entries || !buckets_by_size || !table->displacements)
+		goto fail;
+	for (u32 i = 0; i < n; ++i)
+		++bucket_start[key_action_table_bucket(table, actions[i].key_combo) + 1];
+	for (u32 b = 0; b < table->nbuckets; ++b)
+		bucket_start[b + 1] += bucket_start[b];
+	{
+		u32 *fill = calloc(table->nbuckets, sizeof *fill);
+		if (!fill) goto fail;
+		for (u32 i = 0; i < n; ++i) {
+			u32 b = key_action_table_bucket(table, actions[i].key_combo);
+			bucket_entries[bucket_start[b] + fill[b]++] = i;
+		}
+		free(fill);
+	}
+	// sort buckets by size (insertion sort is fine -- most buckets have 0-8 combos)
+	for (u32 b = 0; b < table->nbuckets; ++b) {
+		u32 size = bucket_start[b + 1] - bucket_start[b];
+		u32 j = b;
+		for (; j > 0; --j) {
+			u32 other = buckets_by_size[j - 1];
+			if (bucket_start[other + 1] - bucket_start[other] >= size)
+				break;
+			buckets_by_size[j] = other;
+		}
+		buckets_by_size[j] = b;
+	}
+	
+	while (1) {
+		const u32 nslots = 1u << table->slot_bits;
+		free(table->slots);
+		table->slots = malloc(nslots * sizeof *table->slots);
+		if (!table->slots) goto fail;
+		memset(table->slots, 0xff, nslots * sizeof *table->slots);
+		bool success = true;
+		for (u32 i = 0; success && i < table->nbuckets; ++i) {
+			const u32 b = buckets_by_size[i];
+			const u32 *entries = &bucket_entries[bucket_start[b]];
+			const u32 count = bucket_start[b + 1] - bucket_start[b];
+			if (count == 0) break; // remaining buckets are all empty
+			u32 d;
+			for (d = 0; d < 10000; ++d) {
+				u32 j;
+				for (j = 0; j < count; ++j) {
+					u32 slot = key_action_table_slot(table, actions[entries[j]].key_combo, d);
+					if (table->slots[slot] != U32_MAX)
+						break;
+					// temporarily occupy slot so we can check for collisions within this bucket
+					table->slots[slot] = entries[j];
+				}
+				if (j == count) break;
+				// undo
+				for (u32 k = 0; k < j; ++k)
+					table->slots[key_action_table_slot(table, actions[entries[k]].key_combo, d)] = U32_MAX;
+			}
+			if (d == 10000)
+				success = false;
+			else
+				table->displacements[b] = d;
+		}
+		if (success) break;
+		// this is extremely unlikely, but just in case
+		++table->slot_bits;
+	}
+	free(bucket_start);
+	free(bucket_entries);
+	free(buckets_by_size);
+	return;
+fail:
+	free(bucket_start);
+	free(bucket_entries);
+	free(buckets_by_size);
+	free(table->displacements);
+	free(table->slots);
+	memset(table, 0, sizeof *table);
+}
+
+const KeyAction *settings_key_action(const Settings *settings, KeyCombo key_combo) {
+	const KeyActionTable *table = &settings->key_action_table;
+	if (!table->slots) return NULL;
+	u32 displacement = table->displacements[key_action_table_bucket(table, key_combo)];
+	u32 index = table->slots[key_action_table_slot(table, key_combo, displacement)];
+	if (index == U32_MAX) return NULL;
+	const KeyAction *action = &settings->key_actions[index];
+	return action->key_combo.value == key_combo.value ? action : NULL;
+}
+
 void settings_finalize(Ted *ted, Settings *settings) {
-	arr_qsort(settings->key_actions, key_action_qsort_cmp_combo);
+	settings_sort_key_actions(settings);
+	settings_build_key_action_table(settings);
 	settings->text_size = clamp_u16((u16)roundf((float)settings->text_size_no_dpi * ted_get_ui_scaling(ted)), TEXT_SIZE_MIN, TEXT_SIZE_MAX);
 #if _WIN32
 	settings->crlf |= settings->crlf_windows;
@@ -977,13 +1139,39 @@ static void config_compile_regex(Config *cfg, ConfigReader *reader) {
 		int error_code = 0;
 		PCRE2_SIZE error_offset = 0;
 		cfg->path = pcre2_compile_8((const u8 *)regex, PCRE2_ZERO_TERMINATED, PCRE2_ANCHORED, &error_code, &error_offset, NULL);
-		if (!cfg->path) {
+		if (cfg->path) {
+			// (this fails harmlessly if PCRE2 was built without JIT support)
+			pcre2_jit_compile_8(cfg->path, PCRE2_JIT_COMPLETE);
+			cfg->path_match_data = pcre2_match_data_create_from_pattern_8(cfg->path, NULL);
+		} else {
 			config_err(reader, "Bad regex (at offset %u): %s", (unsigned)error_offset, regex);
 			free(cfg->path_regex); cfg->path_regex = NULL;
 		}
 	}
 }
 
+// remember that we read this config file, and watch it for changes
+static void config_add_file(Ted *ted, const char *path) {
+	arr_add(ted->config_files, str_dup(path));
+	FileStamp stamp = {
+		.size = fs_file_size(path),
+		.modified = time_last_modified(path),
+	};
+	arr_add(ted->config_file_stamps, stamp);
+	file_watcher_add(ted->file_watcher, path);
+}
+
+bool config_file_changed(Ted *ted, const char *path) {
+	for (u32 i = 0; i < arr_len(ted->config_files); ++i) {
+		if (!streq(ted->config_files[i], path))
+			continue;
+		const FileStamp *stamp = &ted->config_file_stamps[i];
+		return fs_file_size(path) != stamp->size
+			|| !timespec_eq(time_last_modified(path), stamp->modified);
+	}
+	return false;
+}
+
 static bool regex_char_needs_escaping(char c) {
 	return strchr("\\^.$|()[]*+?{}-", c);
 }
@@ -1007,15 +1195,19 @@ static void config_read_ted_cfg(Ted *ted, RcStr *cfg_path_rc, const char ***incl
 				strbuf_cat(text, ", which");
 			strbuf_catf(text, " includes %s", cfg_path);
 			ted_error(ted, "%s", text);
+			++ted->config_error_count;
 			return;
 		}
 	}
 	arr_add(*include_stack, cfg_path);
+	config_add_file(ted, cfg_path);
 	
 	FILE *fp = fopen(cfg_path, "rb");
 	if (!fp) {
 		return;
 	}
+	// configs are about to change, so any cached settings are invalid
+	++ted->config_generation;
 	
 	ConfigReader reader_data = {
 		.ted = ted,
@@ -1153,8 +1345,10 @@ static void config_read_ted_cfg(Ted *ted, RcStr *cfg_path_rc, const char ***incl
 			config_err(reader, "Config has text before first section header.");
 		}
 	}
-	if (ferror(fp))
+	if (ferror(fp)) {
 		ted_error(ted, "Error reading %s.", cfg_path);
+		++ted->config_error_count;
+	}
 	fclose(fp);
 	arr_remove_last(*include_stack);
 }
@@ -1420,8 +1614,10 @@ error:
 
 static void config_read_editorconfig(Ted *ted, RcStr *path_rc) {
 	const char *const path = rc_str(path_rc, "");
+	config_add_file(ted, path);
 	FILE *fp = fopen(path, "r");
 	if (!fp) return;
+	++ted->config_generation;
 	ConfigReader reader_data = {
 		.ted = ted,
 		.filename = path,
@@ -1535,22 +1731,34 @@ void config_free_all(Ted *ted) {
 		config_free(cfg);
 	}
 	arr_clear(ted->all_configs);
-	settings_free(&ted->default_settings);
+	str_hash_table_clear(&ted->config_paths);
+	arr_foreach_ptr(ted->config_files, char *, path) {
+		file_watcher_remove(ted->file_watcher, *path);
+		free(*path);
+	}
+	arr_clear(ted->config_files);
+	arr_clear(ted->config_file_stamps);
+	ted->config_error_count = 0;
+	// release cached settings.
+	// (buffers might still be using them, so they aren't necessarily freed here)
+	++ted->config_generation;
+	arr_foreach_ptr(ted->settings_cache, SharedSettingsPtr, s) {
+		shared_settings_decref(s);
+	}
+	arr_clear(ted->settings_cache);
+	// force recompute default settings
+	strcpy(ted->default_settings_cwd, "//");
 }
 
 void config_read(Ted *ted, const char *path, ConfigFormat format) {
 	const char **include_stack = NULL;
 	config_init_settings();
 	// check if we've already read this
-	arr_foreach_ptr(ted->all_configs, Config, c) {
-		if (streq(rc_str(c->source, ""), path))
-			return;
-	}
+	// (we remember the path even if it doesn't exist, so we don't try to read it again)
+	if (str_hash_table_get(&ted->config_paths, path))
+		return;
+	str_hash_table_insert(&ted->config_paths, path);
 	RcStr *source_rc = rc_str_new(path, -1);
-	// add dummy config so even if `path` doesn't exist we don't try to read it again
-	Config *dummy = arr_addp(ted->all_configs);
-	dummy->source = rc_str_copy(source_rc);
-	dummy->language = LANG_INVALID;
 	switch (format) {
 	case CONFIG_NONE:
 		assert(0);
@@ -1567,6 +1775,321 @@ void config_read(Ted *ted, const char *path, ConfigFormat format) {
 	rc_str_decref(&source_rc);
 }
 
+// --- config snapshot ---
+// parsing all of ted.cfg (and the theme it includes) every time ted starts
+// up takes a while, so we save the parsed configs in a binary file
+// which is used as long as none of the config files have changed.
+
+#define CONFIG_SNAPSHOT_FILENAME "config-snapshot.bin"
+#define CONFIG_SNAPSHOT_VERSION "\x7fTEDCFG2"
+
+static u64 config_snapshot_hash_setting(u64 hash, const char *name, const void *control) {
+	hash = hash * 1000003 + str_hash(name, strlen(name));
+	return hash * 1000003 + (u64)((const char *)control - (const char *)&settings_zero);
+}
+
+// this changes if the layout of Settings (probably) changes,
+// in which case the raw bytes in the snapshot are meaningless.
+static u64 config_snapshot_layout_hash(void) {
+	u64 hash = sizeof(Settings);
+	hash = hash * 1000003 + sizeof(KeyAction);
+	hash = hash * 1000003 + sizeof(LanguageExtension);
+	hash = hash * 1000003 + CMD_COUNT;
+	hash = hash * 1000003 + COLOR_COUNT;
+	#define HASH_SETTINGS(table) \
+		for (size_t i = 0; i < arr_count(table); ++i) \
+			hash = config_snapshot_hash_setting(hash, table[i].name, table[i].control);
+	HASH_SETTINGS(settings_bool)
+	HASH_SETTINGS(settings_u8)
+	HASH_SETTINGS(settings_u16)
+	HASH_SETTINGS(settings_u32)
+	HASH_SETTINGS(settings_float)
+	HASH_SETTINGS(settings_string)
+	HASH_SETTINGS(settings_key_combo)
+	#undef HASH_SETTINGS
+	return hash;
+}
+
+static void config_snapshot_write(FILE *fp, const void *data, size_t size) {
+	fwrite(data, 1, size, fp);
+}
+
+static void config_snapshot_write_u8(FILE *fp, u8 x) {
+	config_snapshot_write(fp, &x, sizeof x);
+}
+
+static void config_snapshot_write_u32(FILE *fp, u32 x) {
+	config_snapshot_write(fp, &x, sizeof x);
+}
+
+static void config_snapshot_write_u64(FILE *fp, u64 x) {
+	config_snapshot_write(fp, &x, sizeof x);
+}
+
+static void config_snapshot_write_cstr(FILE *fp, const char *s) {
+	config_snapshot_write(fp, s, strlen(s) + 1);
+}
+
+// identifies the version of the file at `path` (or its nonexistence)
+static void config_snapshot_write_file_stamp(FILE *fp, const char *path) {
+	struct timespec modified = time_last_modified(path);
+	config_snapshot_write_cstr(fp, path);
+	config_snapshot_write_u64(fp, (u64)fs_file_size(path));
+	config_snapshot_write_u64(fp, (u64)modified.tv_sec);
+	config_snapshot_write_u64(fp, (u64)modified.tv_nsec);
+}
+
+static void config_snapshot_write_config(FILE *fp, const Config *cfg) {
+	const Settings *settings = &cfg->settings;
+	config_snapshot_write_cstr(fp, rc_str(cfg->source, ""));
+	config_snapshot_write_u8(fp, (u8)cfg->format);
+	config_snapshot_write_u8(fp, cfg->is_editorconfig_root);
+	config_snapshot_write_u32(fp, cfg->language);
+	config_snapshot_write_u8(fp, cfg->path_regex != NULL);
+	if (cfg->path_regex)
+		config_snapshot_write_cstr(fp, cfg->path_regex);
+	config_snapshot_write(fp, cfg->settings_set, sizeof cfg->settings_set);
+	// pointers in here are garbage when read back. they're replaced below.
+	config_snapshot_write(fp, settings, sizeof *settings);
+	for (size_t i = 0; i < arr_count(settings_string); ++i) {
+		const ptrdiff_t offset = (char *)settings_string[i].control - (char *)&settings_zero;
+		if (cfg->settings_set[offset])
+			config_snapshot_write_cstr(fp, rc_str(*(RcStr *const *)((const char *)settings + offset), ""));
+	}
+	config_snapshot_write_u32(fp, arr_len(settings->language_extensions));
+	config_snapshot_write(fp, settings->language_extensions, arr_size_in_bytes(settings->language_extensions));
+	config_snapshot_write_u32(fp, arr_len(settings->key_actions));
+	arr_foreach_ptr(settings->key_actions, const KeyAction, action) {
+		config_snapshot_write_u64(fp, action->key_combo.value);
+		config_snapshot_write_u32(fp, (u32)action->command);
+		config_snapshot_write_u64(fp, (u64)action->argument.number);
+		config_snapshot_write_u8(fp, action->argument.string != NULL);
+		if (action->argument.string)
+			config_snapshot_write_cstr(fp, action->argument.string);
+	}
+}
+
+void config_snapshot_save(Ted *ted, const char *const *paths, size_t npaths) {
+	if (ted->config_error_count) {
+		// we want the errors to show up again next time
+		return;
+	}
+	arr_foreach_ptr(ted->all_configs, const Config, cfg) {
+		if (cfg->settings.bg_shader || cfg->settings.bg_texture) {
+			// these need to be recreated from the config files anyways
+			return;
+		}
+	}
+	char filename1[TED_PATH_MAX], filename2[TED_PATH_MAX];
+	strbuf_printf(filename1, "%s%c_" CONFIG_SNAPSHOT_FILENAME, ted->local_data_dir, PATH_SEPARATOR);
+	strbuf_printf(filename2, "%s%c" CONFIG_SNAPSHOT_FILENAME, ted->local_data_dir, PATH_SEPARATOR);
+	FILE *fp = fopen(filename1, "wb");
+	if (!fp) return;
+	config_snapshot_write_cstr(fp, CONFIG_SNAPSHOT_VERSION);
+	config_snapshot_write_u64(fp, config_snapshot_layout_hash());
+	config_snapshot_write_cstr(fp, TED_VERSION);
+	config_snapshot_write_cstr(fp, ted->home);
+	// language IDs are stored in the snapshot, and languages can be defined in syntax/*.cfg files
+	config_snapshot_write_u64(fp, syntax_languages_hash());
+	config_snapshot_write_u32(fp, (u32)npaths);
+	for (size_t i = 0; i < npaths; ++i)
+		config_snapshot_write_cstr(fp, paths[i]);
+	config_snapshot_write_u32(fp, arr_len(ted->config_files));
+	arr_foreach_ptr(ted->config_files, char *, path) {
+		config_snapshot_write_file_stamp(fp, *path);
+	}
+	config_snapshot_write_u32(fp, arr_len(ted->all_configs));
+	arr_foreach_ptr(ted->all_configs, const Config, cfg) {
+		config_snapshot_write_config(fp, cfg);
+	}
+	bool success = !ferror(fp);
+	success &= fclose(fp) == 0;
+	if (success) {
+		os_rename_overwrite(filename1, filename2);
+	} else {
+		remove(filename1);
+	}
+}
+
+typedef struct {
+	const char *data;
+	const char *end;
+	bool error;
+} ConfigSnapshotReader;
+
+static void config_snapshot_read(ConfigSnapshotReader *reader, void *out, size_t size) {
+	if (reader->error || (size_t)(reader->end - reader->data) < size) {
+		reader->error = true;
+		memset(out, 0, size);
+		return;
+	}
+	if (size) memcpy(out, reader->data, size);
+	reader->data += size;
+}
+
+static u8 config_snapshot_read_u8(ConfigSnapshotReader *reader) {
+	u8 x = 0;
+	config_snapshot_read(reader, &x, sizeof x);
+	return x;
+}
+
+static u32 config_snapshot_read_u32(ConfigSnapshotReader *reader) {
+	u32 x = 0;
+	config_snapshot_read(reader, &x, sizeof x);
+	return x;
+}
+
+static u64 config_snapshot_read_u64(ConfigSnapshotReader *reader) {
+	u64 x = 0;
+	config_snapshot_read(reader, &x, sizeof x);
+	return x;
+}
+
+// returns a pointer into the snapshot data, or "" on error.
+static const char *config_snapshot_read_cstr(ConfigSnapshotReader *reader) {
+	if (reader->error) return "";
+	const char *nul = memchr(reader->data, '\0', (size_t)(reader->end - reader->data));
+	if (!nul) {
+		reader->error = true;
+		return "";
+	}
+	const char *s = reader->data;
+	reader->data = nul + 1;
+	return s;
+}
+
+// has the file changed since the snapshot was written?
+static bool config_snapshot_read_file_stamp(ConfigSnapshotReader *reader, const char **path_out) {
+	const char *path = config_snapshot_read_cstr(reader);
+	*path_out = path;
+	u64 size = config_snapshot_read_u64(reader);
+	u64 sec = config_snapshot_read_u64(reader);
+	u64 nsec = config_snapshot_read_u64(reader);
+	if (reader->error) return false;
+	struct timespec modified = time_last_modified(path);
+	return (u64)fs_file_size(path) == size
+		&& (u64)modified.tv_sec == sec
+		&& (u64)modified.tv_nsec == nsec;
+}
+
+static bool config_snapshot_read_config(Ted *ted, ConfigSnapshotReader *reader, Config *cfg) {
+	Settings *settings = &cfg->settings;
+	cfg->source = rc_str_new(config_snapshot_read_cstr(reader), -1);
+	cfg->format = (ConfigFormat)config_snapshot_read_u8(reader);
+	cfg->is_editorconfig_root = config_snapshot_read_u8(reader);
+	cfg->language = config_snapshot_read_u32(reader);
+	if (config_snapshot_read_u8(reader))
+		cfg->path_regex = str_dup(config_snapshot_read_cstr(reader));
+	config_snapshot_read(reader, cfg->settings_set, sizeof cfg->settings_set);
+	config_snapshot_read(reader, settings, sizeof *settings);
+	settings->bg_shader = NULL;
+	settings->bg_texture = NULL;
+	settings->language_extensions = NULL;
+	settings->key_actions = NULL;
+	memset(&settings->key_action_table, 0, sizeof settings->key_action_table);
+	for (size_t i = 0; i < arr_count(settings_string); ++i) {
+		const ptrdiff_t offset = (char *)settings_string[i].control - (char *)&settings_zero;
+		RcStr **control = (RcStr **)((char *)settings + offset);
+		*control = cfg->settings_set[offset] ? rc_str_new(config_snapshot_read_cstr(reader), -1) : NULL;
+	}
+	if (cfg->settings_set[offsetof(Settings, bg_shader)] || cfg->settings_set[offsetof(Settings, bg_texture)]) {
+		// we never write these
+		reader->error = true;
+	}
+	u32 nextensions = config_snapshot_read_u32(reader);
+	if (reader->error || nextensions > (size_t)(reader->end - reader->data) / sizeof(LanguageExtension))
+		return false;
+	arr_set_len(settings->language_extensions, nextensions);
+	config_snapshot_read(reader, settings->language_extensions, arr_size_in_bytes(settings->language_extensions));
+	u32 nactions = config_snapshot_read_u32(reader);
+	for (u32 i = 0; i < nactions && !reader->error; ++i) {
+		KeyAction action = {0};
+		action.key_combo.value = config_snapshot_read_u64(reader);
+		action.command = (Command)config_snapshot_read_u32(reader);
+		action.argument.number = (i64)config_snapshot_read_u64(reader);
+		if (config_snapshot_read_u8(reader))
+			action.argument.string = str_dup(config_snapshot_read_cstr(reader));
+		arr_add(settings->key_actions, action);
+	}
+	if (reader->error)
+		return false;
+	if (cfg->path_regex) {
+		ConfigReader config_reader = {
+			.ted = ted,
+			.filename = rc_str(cfg->source, ""),
+		};
+		config_compile_regex(cfg, &config_reader);
+		if (!cfg->path)
+			return false;
+	}
+	return true;
+}
+
+bool config_snapshot_load(Ted *ted, const char *const *paths, size_t npaths) {
+	if (arr_len(ted->all_configs)) {
+		// the snapshot replaces all configs
+		return false;
+	}
+	char filename[TED_PATH_MAX];
+	strbuf_printf(filename, "%s%c" CONFIG_SNAPSHOT_FILENAME, ted->local_data_dir, PATH_SEPARATOR);
+	// the snapshot is always replaced with a rename (see config_snapshot_save),
+	// never rewritten in place, so it can't be truncated out from under the mapping.
+	size_t size = 0;
+	const u8 *data = fs_map_file(filename, &size);
+	if (!data) return false;
+	
+	ConfigSnapshotReader reader_data = {
+		.data = (const char *)data,
+		.end = (const char *)data + size,
+	}, *reader = &reader_data;
+	bool valid = streq(config_snapshot_read_cstr(reader), CONFIG_SNAPSHOT_VERSION)
+		&& config_snapshot_read_u64(reader) == config_snapshot_layout_hash()
+		&& streq(config_snapshot_read_cstr(reader), TED_VERSION)
+		&& streq(config_snapshot_read_cstr(reader), ted->home)
+		&& config_snapshot_read_u64(reader) == syntax_languages_hash()
+		&& config_snapshot_read_u32(reader) == npaths;
+	for (size_t i = 0; valid && i < npaths; ++i) {
+		valid &= streq(config_snapshot_read_cstr(reader), paths[i]);
+	}
+	u32 nfiles = valid ? config_snapshot_read_u32(reader) : 0;
+	const char **files = NULL;
+	for (u32 i = 0; valid && i < nfiles; ++i) {
+		const char *file = NULL;
+		valid &= config_snapshot_read_file_stamp(reader, &file);
+		arr_add(files, file);
+	}
+	Config *configs = NULL;
+	u32 nconfigs = valid ? config_snapshot_read_u32(reader) : 0;
+	for (u32 i = 0; valid && i < nconfigs; ++i) {
+		Config *cfg = arr_addp(configs);
+		valid &= config_snapshot_read_config(ted, reader, cfg);
+	}
+	valid &= !reader->error && reader->data == reader->end;
+	if (valid) {
+		arr_foreach_ptr(files, const char *, file) {
+			config_add_file(ted, *file);
+		}
+	}
+	arr_free(files);
+	fs_unmap_file(data, size);
+	
+	if (!valid) {
+		arr_foreach_ptr(configs, Config, cfg) {
+			config_free(cfg);
+		}
+		arr_free(configs);
+		return false;
+	}
+	
+	ted->all_configs = configs;
+	for (size_t i = 0; i < npaths; ++i)
+		str_hash_table_insert(&ted->config_paths, paths[i]);
+	++ted->config_generation;
+	// force recompute default settings
+	strcpy(ted->default_settings_cwd, "//");
+	return true;
+}
+
 
 static char *last_separator(char *path) {
 	for (int i = (int)strlen(path) - 1; i >= 0; --i)
@@ -1768,6 +2291,48 @@ static void config_test_editorconfig_glob_to_regex(Ted *ted) {
 	}
 }
 
+static void config_test_key_action_table(void) {
+	Settings settings = {0};
+	const u32 n = 500;
+	for (u32 i = 0; i < n; ++i) {
+		KeyAction action = {
+			.key_combo = KEY_COMBO(i % 8, 'a' + i / 8),
+			.command = CMD_NOOP,
+			.argument = {.number = i},
+		};
+		arr_add(settings.key_actions, action);
+	}
+	// override some of them
+	for (u32 i = 0; i < n; i += 7) {
+		KeyAction action = {
+			.key_combo = KEY_COMBO(i % 8, 'a' + i / 8),
+			.command = CMD_NOOP,
+			.argument = {.number = -(i64)i},
+		};
+		arr_add(settings.key_actions, action);
+	}
+	settings_sort_key_actions(&settings);
+	settings_build_key_action_table(&settings);
+	if (arr_len(settings.key_actions) != n) {
+		println("expected %u key actions after removing duplicates, got %u", n, arr_len(settings.key_actions));
+		exit(1);
+	}
+	for (u32 i = 0; i < n; ++i) {
+		const KeyAction *action = settings_key_action(&settings, KEY_COMBO(i % 8, 'a' + i / 8));
+		i64 expected = i % 7 == 0 ? -(i64)i : i;
+		if (!action || action->argument.number != expected) {
+			println("wrong key action for key combo #%u", i);
+			exit(1);
+		}
+	}
+	if (settings_key_action(&settings, KEY_COMBO(0, 'a' + n))) {
+		println("found key action for unbound key combo");
+		exit(1);
+	}
+	settings_free(&settings);
+}
+
 void config_test(Ted *ted) {
 	config_test_editorconfig_glob_to_regex(ted);
+	config_test_key_action_table();
 }
@@ -78,6 +78,11 @@ static void find_free_pattern(Ted *ted) {
 	arr_clear(ted->find_results);
 }
 
+u32 find_result_line(Ted *ted, u32 index) {
+	assert(index < arr_len(ted->find_results));
+	return ted->find_results[index].start.line;
+}
+
 float find_menu_height(Ted *ted) {
 	Font *font = ted->font;
 	float char_height = text_font_char_height(font);
@@ -196,12 +196,33 @@ typedef struct {
 } GLSimpleTriangle;
 
 static GLSimpleTriangle *gl_geometry_triangles;
+/// index of the first triangle which hasn't been put in a batch yet
+static u32 gl_geometry_batch_start;
+/// batches to draw at the end of the frame
+static GlBatch *gl_batches;
+GlFrameStats gl_frame_stats;
 static GLuint gl_geometry_program;
 static GLuint gl_geometry_v_pos;
 static GLuint gl_geometry_v_color;
 static GLint gl_geometry_u_window_size;
 static GLuint gl_geometry_vbo, gl_geometry_vao;
 
+typedef struct {
+	vec2 pos;
+	vec2 tex_coord;
+} GLImageVertex;
+typedef struct {
+	GLImageVertex verts[6];
+} GLImageQuad;
+
+static GLImageQuad *gl_image_quads;
+static GLuint gl_image_program;
+static GLuint gl_image_v_pos;
+static GLuint gl_image_v_tex_coord;
+static GLint gl_image_u_window_size;
+static GLint gl_image_u_sampler;
+static GLuint gl_image_vbo, gl_image_vao;
+
 void gl_geometry_init(void) {
 	const char *vshader_code = "attribute vec2 v_pos;\n\
 	attribute vec4 v_color;\n\
@@ -227,6 +248,32 @@ void gl_geometry_init(void) {
 	glGenBuffers(1, &gl_geometry_vbo);
 	if (gl_version_major >= 3)
 		glGenVertexArrays(1, &gl_geometry_vao);
+	
+	const char *image_vshader_code = "attribute vec2 v_pos;\n\
+	attribute vec2 v_tex_coord;\n\
+	uniform vec2 u_window_size;\n\
+	OUT vec2 tex_coord;\n\
+	void main() {\n\
+		vec2 p = v_pos * (2.0 / u_window_size);\n\
+		gl_Position = vec4(p.x - 1.0, 1.0 - p.y, 0.0, 1.0);\n\
+		tex_coord = v_tex_coord;\n\
+	}\n\
+	";
+	const char *image_fshader_code = "IN vec2 tex_coord;\n\
+	uniform sampler2D sampler;\n\
+	void main() {\n\
+		gl_FragColor = texture2D(sampler, tex_coord);\n\
+	}\n\
+	";
+	gl_image_program = gl_compile_and_link_shaders(NULL, image_vshader_code, image_fshader_code);
+	gl_image_v_pos = gl_attrib_location(gl_image_program, "v_pos");
+	gl_image_v_tex_coord = gl_attrib_location(gl_image_program, "v_tex_coord");
+	gl_image_u_window_size = gl_uniform_location(gl_image_program, "u_window_size");
+	gl_image_u_sampler = gl_uniform_location(gl_image_program, "sampler");
+	
+	glGenBuffers(1, &gl_image_vbo);
+	if (gl_version_major >= 3)
+		glGenVertexArrays(1, &gl_image_vao);
 }
 
 void gl_geometry_rect(Rect r, u32 color_rgba) {
@@ -265,25 +312,148 @@ void gl_geometry_rect_border(Rect r, float border_thickness, u32 color) {
 }
 
 void gl_geometry_draw(void) {
-	size_t ntriangles = arr_len(gl_geometry_triangles);
+	u32 ntriangles = arr_len(gl_geometry_triangles);
+	if (ntriangles > gl_geometry_batch_start) {
+		gl_add_batch((GlBatch){
+			.font = NULL,
+			.first = gl_geometry_batch_start,
+			.count = ntriangles - gl_geometry_batch_start,
+		});
+		gl_geometry_batch_start = ntriangles;
+	}
+}
+
+void gl_image_rect(Rect r, GLuint texture) {
+	if (r.size.x <= 0 || r.size.y <= 0 || !texture)
+		return;
+	// make sure anything queued before this is drawn below it
+	gl_geometry_draw();
 	
-	if (ntriangles == 0) return;
+	float x1 = rect_x1(r), y1 = rect_y1(r), x2 = rect_x2(r), y2 = rect_y2(r);
+	GLImageQuad quad = {{
+		{{x1, y1}, {0, 0}},
+		{{x1, y2}, {0, 1}},
+		{{x2, y2}, {1, 1}},
+		{{x2, y2}, {1, 1}},
+		{{x2, y1}, {1, 0}},
+		{{x1, y1}, {0, 0}},
+	}};
+	arr_add(gl_image_quads, quad);
+	gl_add_batch((GlBatch){
+		.font = NULL,
+		.texture = texture,
+		.first = arr_len(gl_image_quads) - 1,
+		.count = 1,
+	});
+}
 
+void gl_add_batch(GlBatch batch) {
+	// text batches which aren't separated by geometry can be drawn in any order
+	// (text_render has always drawn each font texture separately anyways),
+	// so text can be merged with any batch since the last geometry batch.
+	for (u32 i = arr_len(gl_batches); i-- > 0; ) {
+		GlBatch *prev = &gl_batches[i];
+		if (prev->font == batch.font && prev->texture == batch.texture
+			&& prev->first + prev->count == batch.first) {
+			prev->count += batch.count;
+			return;
+		}
+		if (!prev->font || !batch.font)
+			break;
+	}
+	arr_add(gl_batches, batch);
+}
+
+static void gl_geometry_setup(void) {
 	if (gl_version_major >= 3)
 		glBindVertexArray(gl_geometry_vao);
-
 	glBindBuffer(GL_ARRAY_BUFFER, gl_geometry_vbo);
-	glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(ntriangles * sizeof(GLSimpleTriangle)), gl_geometry_triangles, GL_STREAM_DRAW);
 	glVertexAttribPointer(gl_geometry_v_pos,   2, GL_FLOAT, 0, sizeof(GLSimpleVertex), (void *)offsetof(GLSimpleVertex, pos));
 	glEnableVertexAttribArray(gl_geometry_v_pos);
 	glVertexAttribPointer(gl_geometry_v_color, 4, GL_FLOAT, 0, sizeof(GLSimpleVertex), (void *)offsetof(GLSimpleVertex, color));
 	glEnableVertexAttribArray(gl_geometry_v_color);
-
 	glUseProgram(gl_geometry_program);
 	glUniform2f(gl_geometry_u_window_size, gl_window_width, gl_window_height);
-	glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(3 * ntriangles));
+}
+
+static void gl_image_setup(void) {
+	if (gl_version_major >= 3)
+		glBindVertexArray(gl_image_vao);
+	glBindBuffer(GL_ARRAY_BUFFER, gl_image_vbo);
+	glVertexAttribPointer(gl_image_v_pos,       2, GL_FLOAT, 0, sizeof(GLImageVertex), (void *)offsetof(GLImageVertex, pos));
+	glEnableVertexAttribArray(gl_image_v_pos);
+	glVertexAttribPointer(gl_image_v_tex_coord, 2, GL_FLOAT, 0, sizeof(GLImageVertex), (void *)offsetof(GLImageVertex, tex_coord));
+	glEnableVertexAttribArray(gl_image_v_tex_coord);
+	glUseProgram(gl_image_program);
+	glUniform2f(gl_image_u_window_size, gl_window_width, gl_window_height);
+	glUniform1i(gl_image_u_sampler, 0);
+	glActiveTexture(GL_TEXTURE0);
+}
+
+// batches which use the same program can be drawn one after the other without setting things up again.
+static int gl_batch_program(const GlBatch *batch) {
+	if (batch->font) return 2; // text
+	if (batch->texture) return 1; // image
+	return 0; // geometry
+}
+
+void gl_frame_flush(void) {
+	u32 nbatches = arr_len(gl_batches);
+	if (!nbatches) return;
+	
+	// upload everything first
+	const u32 ntriangles = gl_geometry_batch_start;
+	if (ntriangles) {
+		const size_t size = ntriangles * sizeof(GLSimpleTriangle);
+		glBindBuffer(GL_ARRAY_BUFFER, gl_geometry_vbo);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)size, gl_geometry_triangles, GL_STREAM_DRAW);
+		gl_frame_stats.upload_bytes += size;
+	}
+	const u32 nimage_quads = arr_len(gl_image_quads);
+	if (nimage_quads) {
+		const size_t size = nimage_quads * sizeof(GLImageQuad);
+		glBindBuffer(GL_ARRAY_BUFFER, gl_image_vbo);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)size, gl_image_quads, GL_STREAM_DRAW);
+		gl_frame_stats.upload_bytes += size;
+	}
+	text_upload_batches(gl_batches, nbatches);
 	
-	arr_clear(gl_geometry_triangles);
+	for (u32 i = 0; i < nbatches; ++i) {
+		const GlBatch *batch = &gl_batches[i];
+		const bool same_program = i > 0 && gl_batch_program(&gl_batches[i - 1]) == gl_batch_program(batch);
+		if (batch->font) {
+			text_draw_batch(batch, !same_program);
+		} else if (batch->texture) {
+			if (!same_program)
+				gl_image_setup();
+			glBindTexture(GL_TEXTURE_2D, batch->texture);
+			glDrawArrays(GL_TRIANGLES, (GLint)(6 * batch->first), (GLsizei)(6 * batch->count));
+			++gl_frame_stats.draw_calls;
+		} else {
+			if (!same_program)
+				gl_geometry_setup();
+			glDrawArrays(GL_TRIANGLES, (GLint)(3 * batch->first), (GLsizei)(3 * batch->count));
+			++gl_frame_stats.draw_calls;
+		}
+	}
+	text_end_batches();
+	// if i remove this i get
+	//    Texture state usage warning: The texture object (0) bound to texture image unit 0 does not have a defined base level and cannot be used for texture mapping
+	// (even with no other draw calls) which is really weird but whatever this is probably good practice anyways.
+	glUseProgram(0);
+	if (gl_version_major >= 3)
+		glBindVertexArray(0);
+	
+	arr_set_len(gl_batches, 0);
+	arr_set_len(gl_image_quads, 0);
+	if (ntriangles == arr_len(gl_geometry_triangles)) {
+		// (keep the memory around for next frame)
+		arr_set_len(gl_geometry_triangles, 0);
+	} else {
+		// keep the triangles which haven't been put in a batch yet
+		arr_remove_multiple(gl_geometry_triangles, 0, ntriangles);
+	}
+	gl_geometry_batch_start = 0;
 }
 
 GLuint gl_load_texture_from_image(const char *path) {
@@ -8,6 +8,8 @@ struct Definitions {
 	double last_request_time;
 	/// last query string which we sent a request for
 	char *last_request_query;
+	/// have we gotten any (partial) results for `last_request` yet?
+	bool last_request_got_results;
 	/// for "go to definition of..." menu
 	Selector *selector;
 	/// an array of all definitions (gotten from workspace/symbols) for "go to definition" menu
@@ -19,7 +21,7 @@ void definition_cancel_lookup(Ted *ted) {
 	ted_cancel_lsp_request(ted, &defs->last_request);
 }
 
-static SymbolKind symbol_kind_to_ted(LSPSymbolKind kind) {
+SymbolKind symbol_kind_to_ted(LSPSymbolKind kind) {
 	switch (kind) {
 	case LSP_SYMBOL_OTHER:
 	case LSP_SYMBOL_FILE:
@@ -155,7 +157,8 @@ void definitions_process_lsp_response(Ted *ted, LSP *lsp, const LSPResponse *res
 		return;
 	}
 	
-	defs->last_request.id = 0;
+	if (!response->partial)
+		defs->last_request.id = 0;
 	
 	switch (response->request.type) {
 	case LSP_REQUEST_DEFINITION:
@@ -198,11 +201,18 @@ void definitions_process_lsp_response(Ted *ted, LSP *lsp, const LSPResponse *res
 		const LSPResponseWorkspaceSymbols *response_syms = &response->data.workspace_symbols;
 		const LSPSymbolInformation *symbols = response_syms->symbols;
 		
-		definitions_clear_entries(defs);
-		arr_set_len(defs->all_definitions, arr_len(symbols));
+		if (!defs->last_request_got_results) {
+			// replace the results for the old query
+			definitions_clear_entries(defs);
+			defs->last_request_got_results = true;
+		}
+		// results might come in a bit at a time, so we add them to the end
+		// (and the selector keeps its order and cursor position)
+		const u32 first_new = arr_len(defs->all_definitions);
+		arr_set_len(defs->all_definitions, first_new + arr_len(symbols));
 		for (size_t i = 0; i < arr_len(symbols); ++i) {
 			const LSPSymbolInformation *symbol = &symbols[i];
-			SymbolInfo *def = &defs->all_definitions[i];
+			SymbolInfo *def = &defs->all_definitions[first_new + i];
 			
 			def->name = str_dup(lsp_response_string(response, symbol->name));
 			SymbolKind kind = symbol_kind_to_ted(symbol->kind);
@@ -217,10 +227,13 @@ void definitions_process_lsp_response(Ted *ted, LSP *lsp, const LSPResponse *res
 				has_container ? ", " : "",
 				filename,
 				def->position.pos.line + 1);
+			SelectorEntry entry = {
+				.color = def->color,
+				.name = def->name,
+				.detail = def->detail,
+			};
+			selector_add_entry(defs->selector, &entry);
 		}
-		
-		definitions_selector_update_entries(ted);
-		
 		} break;
 	default:
 		debug_println("?? bad request type in %s : %u:%u", __func__,  response->request.id, response->request.type);
@@ -243,6 +256,7 @@ void definitions_send_request_if_needed(Ted *ted) {
 	syms->query = lsp_request_add_string(&request, query);
 	definition_cancel_lookup(ted); // cancel old request
 	defs->last_request = lsp_send_request(lsp, &request);
+	defs->last_request_got_results = false;
 	defs->last_request_time = ted->frame_time;
 	free(defs->last_request_query);
 	defs->last_request_query = query;
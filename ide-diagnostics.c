@@ -0,0 +1,383 @@
+// LSP diagnostics
+// servers either push diagnostics to us (textDocument/publishDiagnostics), or we pull them
+// (textDocument/diagnostic for the files on screen, workspace/diagnostic for everything else).
+// either way, they're kept here in a compact form, and only turned into
+// Diagnostics (with BufferPos's and formatted messages) when a buffer on screen needs them.
+
+#include "ted-internal.h"
+
+/// wait this long after the last edit before pulling diagnostics again
+#define DIAGNOSTICS_DEBOUNCE 0.5
+/// wait this long before trying again after an error
+#define DIAGNOSTICS_RETRY 2.0
+/// give up on textDocument/diagnostic requests which take longer than this
+#define DIAGNOSTICS_TIMEOUT 10.0
+/// wait this long after a workspace/diagnostic response before asking again.
+/// (servers which support it hold the request open until something changes,
+/// but we don't want to ask the others over and over as fast as they can answer.)
+#define DIAGNOSTICS_WORKSPACE_INTERVAL 3.0
+
+typedef struct {
+	LSPID lsp;
+	LSPDocumentID document;
+	/// value of \ref DiagnosticStore.generation when the diagnostics were last changed
+	u32 generation;
+	/// `resultId` of the last pull diagnostics report (NULL if we don't have one)
+	char *result_id;
+	/// dynamic array
+	StoredDiagnostic *diagnostics;
+	/// dynamic array of null-terminated strings used by \ref diagnostics.
+	/// starts with a null byte, so that offset 0 is the empty string.
+	char *strings;
+	/// textDocument/diagnostic request
+	LSPServerRequestID request;
+	/// time when \ref request was sent
+	double request_time;
+	/// has the document been edited since the last request?
+	bool dirty;
+	/// don't send a request before this time
+	double next_request_time;
+	/// have we sent a textDocument/diagnostic request for this document?
+	bool requested;
+} DiagnosticDocument;
+
+/// workspace/diagnostic state for a server
+///
+/// there's at most one request at a time, and it never times out --
+/// the server can take as long as it likes to answer it.
+typedef struct {
+	LSPID lsp;
+	LSPServerRequestID request;
+	/// don't send a request before this time
+	/// (INFINITY while waiting for a response, or if the server doesn't support workspace diagnostics)
+	double next_request_time;
+} WorkspaceDiagnostics;
+
+struct DiagnosticStore {
+	/// incremented whenever any document's diagnostics change
+	u32 generation;
+	EditNotifyID edit_notify;
+	/// dynamic array
+	DiagnosticDocument *documents;
+	/// dynamic array
+	WorkspaceDiagnostics *workspaces;
+};
+
+static DiagnosticDocument *diagnostics_get_document(Ted *ted, LSPID lsp, LSPDocumentID document) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	arr_foreach_ptr(store->documents, DiagnosticDocument, doc) {
+		if (doc->lsp == lsp && doc->document == document)
+			return doc;
+	}
+	return NULL;
+}
+
+static DiagnosticDocument *diagnostics_get_or_add_document(Ted *ted, LSPID lsp, LSPDocumentID document) {
+	DiagnosticDocument *doc = diagnostics_get_document(ted, lsp, document);
+	if (doc) return doc;
+	DiagnosticStore *store = ted->diagnostic_store;
+	doc = arr_addp(store->documents);
+	if (!doc) return NULL;
+	doc->lsp = lsp;
+	doc->document = document;
+	return doc;
+}
+
+static void diagnostics_edit_notify(void *context, TextBuffer *buffer, const EditInfo *info) {
+	(void)info;
+	Ted *ted = context;
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp) return;
+	DiagnosticDocument *doc = diagnostics_get_document(ted, lsp_get_id(lsp), buffer_lsp_document_id(buffer));
+	if (doc) {
+		doc->dirty = true;
+		doc->next_request_time = ted->frame_time + DIAGNOSTICS_DEBOUNCE;
+	}
+}
+
+void diagnostics_init(Ted *ted) {
+	ted->diagnostic_store = calloc(1, sizeof *ted->diagnostic_store);
+	ted->diagnostic_store->edit_notify = ted_add_edit_notify(ted, diagnostics_edit_notify, ted);
+}
+
+static void diagnostics_document_free(Ted *ted, DiagnosticDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->request);
+	free(doc->result_id);
+	arr_free(doc->diagnostics);
+	arr_free(doc->strings);
+	memset(doc, 0, sizeof *doc);
+}
+
+void diagnostics_quit(Ted *ted) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	arr_foreach_ptr(store->documents, DiagnosticDocument, doc) {
+		diagnostics_document_free(ted, doc);
+	}
+	arr_foreach_ptr(store->workspaces, WorkspaceDiagnostics, ws) {
+		ted_cancel_lsp_request(ted, &ws->request);
+	}
+	arr_free(store->documents);
+	arr_free(store->workspaces);
+	ted_remove_edit_notify(ted, store->edit_notify);
+	free(store);
+	ted->diagnostic_store = NULL;
+}
+
+static u32 diagnostics_add_string(DiagnosticDocument *doc, const char *string) {
+	if (!*string) return 0;
+	u32 offset = arr_len(doc->strings);
+	size_t len = strlen(string);
+	arr_set_len(doc->strings, offset + len + 1);
+	if (!doc->strings) return 0;
+	memcpy(&doc->strings[offset], string, len + 1);
+	return offset;
+}
+
+static MessageType diagnostic_severity(const LSPDiagnostic *diagnostic) {
+	switch (diagnostic->severity) {
+	case LSP_DIAGNOSTIC_SEVERITY_ERROR:
+		return MESSAGE_ERROR;
+	case LSP_DIAGNOSTIC_SEVERITY_WARNING:
+		return MESSAGE_WARNING;
+	case LSP_DIAGNOSTIC_SEVERITY_INFORMATION:
+	case LSP_DIAGNOSTIC_SEVERITY_HINT:
+		return MESSAGE_INFO;
+	}
+	assert(0);
+	return MESSAGE_INFO;
+}
+
+/// remove all of `doc`'s diagnostics (call this before adding new ones)
+static void diagnostics_clear_document(Ted *ted, DiagnosticDocument *doc) {
+	arr_clear(doc->diagnostics);
+	arr_clear(doc->strings);
+	arr_add(doc->strings, '\0');
+	doc->generation = ++ted->diagnostic_store->generation;
+}
+
+static void diagnostics_add(DiagnosticDocument *doc, const LSPDiagnostic *diagnostic,
+	const char *message, const char *code, const char *url) {
+	StoredDiagnostic *d = arr_addp(doc->diagnostics);
+	if (!d) return;
+	d->range = diagnostic->range;
+	d->severity = diagnostic_severity(diagnostic);
+	d->message = diagnostics_add_string(doc, message);
+	d->code = diagnostics_add_string(doc, code);
+	d->url = diagnostics_add_string(doc, url);
+}
+
+void diagnostics_process_publish(Ted *ted, LSP *lsp, const LSPRequest *request) {
+	assert(request->type == LSP_REQUEST_PUBLISH_DIAGNOSTICS);
+	const LSPRequestPublishDiagnostics *pub = &request->data.publish_diagnostics;
+	DiagnosticDocument *doc = diagnostics_get_or_add_document(ted, lsp_get_id(lsp), pub->document);
+	if (!doc) return;
+	diagnostics_clear_document(ted, doc);
+	arr_foreach_ptr(pub->diagnostics, const LSPDiagnostic, diagnostic) {
+		diagnostics_add(doc, diagnostic,
+			lsp_request_string(request, diagnostic->message),
+			lsp_request_string(request, diagnostic->code),
+			lsp_request_string(request, diagnostic->code_description_uri));
+	}
+	// this didn't come from a pull request, so the result ID is out of date
+	free(doc->result_id);
+	doc->result_id = NULL;
+}
+
+static void diagnostics_process_report(Ted *ted, LSPID lsp, const LSPResponse *response, const LSPDiagnosticReport *report) {
+	DiagnosticDocument *doc = diagnostics_get_or_add_document(ted, lsp, report->document);
+	if (!doc) return;
+	const char *result_id = lsp_response_string(response, report->result_id);
+	free(doc->result_id);
+	doc->result_id = *result_id ? str_dup(result_id) : NULL;
+	if (report->unchanged)
+		return; // nothing to do!
+	diagnostics_clear_document(ted, doc);
+	const LSPDiagnostic *diagnostics = &response->data.diagnostic.diagnostics[report->diagnostics_start];
+	for (u32 i = 0; i < report->diagnostics_count; ++i) {
+		const LSPDiagnostic *diagnostic = &diagnostics[i];
+		diagnostics_add(doc, diagnostic,
+			lsp_response_string(response, diagnostic->message),
+			lsp_response_string(response, diagnostic->code),
+			lsp_response_string(response, diagnostic->code_description_uri));
+	}
+}
+
+static WorkspaceDiagnostics *diagnostics_get_workspace(Ted *ted, LSPID lsp) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	arr_foreach_ptr(store->workspaces, WorkspaceDiagnostics, ws) {
+		if (ws->lsp == lsp)
+			return ws;
+	}
+	WorkspaceDiagnostics *ws = arr_addp(store->workspaces);
+	if (ws) ws->lsp = lsp;
+	return ws;
+}
+
+void diagnostics_process_refresh(Ted *ted, LSP *lsp) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	const LSPID lsp_id = lsp_get_id(lsp);
+	arr_foreach_ptr(store->documents, DiagnosticDocument, doc) {
+		if (doc->lsp != lsp_id) continue;
+		// (a response to a request we've already sent might be out of date)
+		ted_cancel_lsp_request(ted, &doc->request);
+		doc->dirty = true;
+		doc->next_request_time = ted->frame_time;
+	}
+	WorkspaceDiagnostics *ws = diagnostics_get_workspace(ted, lsp_id);
+	if (ws) {
+		ted_cancel_lsp_request(ted, &ws->request);
+		ws->next_request_time = ted->frame_time;
+	}
+}
+
+void diagnostics_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	const LSPRequest *request = &response->request;
+	const bool failed = !lsp_string_is_empty(response->error);
+	switch (request->type) {
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC: {
+		DiagnosticDocument *doc = NULL;
+		arr_foreach_ptr(store->documents, DiagnosticDocument, d) {
+			if (d->request.id == request->id) {
+				doc = d;
+				break;
+			}
+		}
+		if (!doc) return; // request was cancelled
+		doc->request.id = 0;
+		if (failed) {
+			doc->dirty = true;
+			doc->next_request_time = ted->frame_time + DIAGNOSTICS_RETRY;
+			return;
+		}
+		const LSPID lsp = doc->lsp; // doc might be moved by diagnostics_get_or_add_document
+		arr_foreach_ptr(response->data.diagnostic.reports, const LSPDiagnosticReport, report) {
+			diagnostics_process_report(ted, lsp, response, report);
+		}
+		} break;
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC: {
+		WorkspaceDiagnostics *ws = NULL;
+		arr_foreach_ptr(store->workspaces, WorkspaceDiagnostics, w) {
+			if (w->request.id == request->id) {
+				ws = w;
+				break;
+			}
+		}
+		if (!ws) return;
+		ws->request.id = 0;
+		ws->next_request_time = ted->frame_time + (failed ? DIAGNOSTICS_RETRY : DIAGNOSTICS_WORKSPACE_INTERVAL);
+		if (failed) return;
+		const LSPID lsp = ws->lsp;
+		arr_foreach_ptr(response->data.diagnostic.reports, const LSPDiagnosticReport, report) {
+			diagnostics_process_report(ted, lsp, response, report);
+		}
+		} break;
+	default:
+		break;
+	}
+}
+
+static void diagnostics_send_document_request(Ted *ted, LSP *lsp, DiagnosticDocument *doc) {
+	LSPRequest request = {.type = LSP_REQUEST_DOCUMENT_DIAGNOSTIC};
+	LSPRequestDocumentDiagnostic *diagnostic = &request.data.document_diagnostic;
+	diagnostic->document = doc->document;
+	if (doc->result_id)
+		diagnostic->previous_result_id = lsp_request_add_string(&request, doc->result_id);
+	doc->request = lsp_send_request(lsp, &request);
+	doc->request_time = ted->frame_time;
+	doc->requested = true;
+	doc->dirty = false;
+}
+
+static void diagnostics_send_workspace_request(Ted *ted, LSP *lsp, WorkspaceDiagnostics *ws) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	LSPRequest request = {.type = LSP_REQUEST_WORKSPACE_DIAGNOSTIC};
+	LSPRequestWorkspaceDiagnostic *diagnostic = &request.data.workspace_diagnostic;
+	arr_foreach_ptr(store->documents, const DiagnosticDocument, doc) {
+		if (doc->lsp != ws->lsp || !doc->result_id) continue;
+		LSPPreviousResultID *prev = arr_addp(diagnostic->previous_result_ids);
+		if (!prev) break;
+		prev->document = doc->document;
+		prev->result_id = lsp_request_add_string(&request, doc->result_id);
+	}
+	ws->request = lsp_send_request(lsp, &request);
+	// the next request is scheduled when we get the response.
+	// (if the request didn't go through, the server doesn't support workspace diagnostics)
+	ws->next_request_time = INFINITY;
+}
+
+// pull diagnostics for a buffer on screen if needed, and make sure it has the latest ones
+static void diagnostics_update_buffer(Ted *ted, TextBuffer *buffer) {
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp || !lsp_is_initialized(lsp)) return;
+	const LSPID lsp_id = lsp_get_id(lsp);
+	DiagnosticDocument *doc = diagnostics_get_or_add_document(ted, lsp_id, buffer_lsp_document_id(buffer));
+	if (!doc) return;
+
+	if (doc->request.id && ted->frame_time - doc->request_time > DIAGNOSTICS_TIMEOUT) {
+		// server is taking too long -- ask again
+		ted_cancel_lsp_request(ted, &doc->request);
+		doc->dirty = true;
+	}
+	if (!doc->request.id && (!doc->requested
+		|| (doc->dirty && ted->frame_time >= doc->next_request_time))) {
+		// (if the server doesn't support pull diagnostics, this does nothing)
+		diagnostics_send_document_request(ted, lsp, doc);
+	}
+
+	if (doc->generation && doc->generation != buffer_diagnostics_generation(buffer)) {
+		buffer_publish_diagnostics(buffer, doc->generation,
+			doc->diagnostics, arr_len(doc->diagnostics), doc->strings);
+	}
+}
+
+void diagnostics_frame(Ted *ted) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	// forget about servers which have been shut down
+	for (u32 i = 0; i < arr_len(store->documents); ) {
+		DiagnosticDocument *doc = &store->documents[i];
+		if (!ted_get_lsp_by_id(ted, doc->lsp)) {
+			diagnostics_document_free(ted, doc);
+			arr_remove(store->documents, i);
+		} else {
+			++i;
+		}
+	}
+	for (u32 i = 0; i < arr_len(store->workspaces); ) {
+		if (!ted_get_lsp_by_id(ted, store->workspaces[i].lsp)) {
+			arr_remove(store->workspaces, i);
+		} else {
+			++i;
+		}
+	}
+
+	arr_foreach_ptr(ted->nodes, NodePtr, pnode) {
+		Node *node = *pnode;
+		TextBuffer *buffer = node_get_tab(node, node_active_tab(node));
+		if (buffer)
+			diagnostics_update_buffer(ted, buffer);
+	}
+
+	for (int i = 0; ted->lsps[i]; ++i) {
+		LSP *lsp = ted->lsps[i];
+		if (!lsp_is_initialized(lsp)) continue;
+		WorkspaceDiagnostics *ws = diagnostics_get_workspace(ted, lsp_get_id(lsp));
+		if (!ws) continue;
+		if (!ws->request.id && ted->frame_time >= ws->next_request_time)
+			diagnostics_send_workspace_request(ted, lsp, ws);
+	}
+}
+
+double diagnostics_next_update_time(Ted *ted) {
+	DiagnosticStore *store = ted->diagnostic_store;
+	double t = INFINITY;
+	arr_foreach_ptr(store->documents, const DiagnosticDocument, doc) {
+		if (doc->dirty && !doc->request.id)
+			t = mind(t, doc->next_request_time);
+	}
+	arr_foreach_ptr(store->workspaces, const WorkspaceDiagnostics, ws) {
+		if (!ws->request.id)
+			t = mind(t, ws->next_request_time);
+	}
+	return t;
+}
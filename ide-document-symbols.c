@@ -0,0 +1,513 @@
+// LSP document symbols (textDocument/documentSymbol)
+// these are used for the outline menu and the "breadcrumb" above each buffer.
+//
+// we keep a tree of symbols for each buffer on screen. it's stored in pre-order,
+// so that a symbol's descendants come right after it and the symbols are
+// sorted by their first line -- this lets us find the symbol containing a line
+// with a binary search (see document_symbols_enclosing).
+//
+// the server gives us the whole tree every time. since usually very little has
+// changed, we line the new tree up against the old one and keep the old names/details
+// if they're the same, and only rebuild the outline menu's entries if anything
+// other than the positions has changed.
+
+#include "ted-internal.h"
+
+/// wait this long after the last edit before asking for new symbols
+#define DOCUMENT_SYMBOLS_DEBOUNCE 0.5
+/// wait this long before trying again after an error
+#define DOCUMENT_SYMBOLS_RETRY 2.0
+/// when a new symbol doesn't match the next old one, how far ahead we look for it
+/// (i.e. how many symbols can be added/removed in one place without losing track)
+#define DOCUMENT_SYMBOLS_DIFF_LOOKAHEAD 16
+
+typedef struct {
+	char *name;
+	/// NULL if there isn't one
+	char *detail;
+	SymbolKind kind;
+	/// index of the symbol containing this one, or `U32_MAX` for top-level symbols
+	u32 parent;
+	/// number of ancestors
+	u32 depth;
+	/// lines spanned by the symbol's definition
+	u32 first_line, last_line;
+	/// position of the symbol's name
+	BufferPos pos;
+} DocumentSymbol;
+
+typedef struct {
+	TextBuffer *buffer;
+	LSPID lsp;
+	LSPDocumentID document;
+	LSPServerRequestID request;
+	/// dynamic array in pre-order (see top of file)
+	DocumentSymbol *symbols;
+	/// incremented whenever anything other than the positions of \ref symbols changes
+	u32 generation;
+	/// have we gotten any symbols?
+	bool have_symbols;
+	/// number of edits made to the buffer
+	u32 edit_count;
+	/// value of \ref edit_count when \ref request was sent
+	u32 request_edit_count;
+	/// value of \ref edit_count when \ref symbols were requested
+	u32 symbols_edit_count;
+	/// don't send any requests before this time
+	double next_request_time;
+	/// the server doesn't support document symbols
+	bool unsupported;
+} DocumentSymbolsDocument;
+
+struct DocumentSymbols {
+	EditNotifyID edit_notify;
+	/// dynamic array
+	DocumentSymbolsDocument *documents;
+	/// for the outline menu
+	Selector *selector;
+	/// buffer the outline menu is showing
+	TextBuffer *outline_buffer;
+	/// generation of the symbols in \ref selector
+	u32 outline_generation;
+};
+
+static void document_symbols_free_strings(DocumentSymbol *symbol) {
+	free(symbol->name);
+	free(symbol->detail);
+	symbol->name = symbol->detail = NULL;
+}
+
+static void document_symbols_document_free(Ted *ted, DocumentSymbolsDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->request);
+	arr_foreach_ptr(doc->symbols, DocumentSymbol, symbol) {
+		document_symbols_free_strings(symbol);
+	}
+	arr_free(doc->symbols);
+	memset(doc, 0, sizeof *doc);
+}
+
+static DocumentSymbolsDocument *document_symbols_get_document(Ted *ted, TextBuffer *buffer) {
+	DocumentSymbols *ds = ted->document_symbols;
+	arr_foreach_ptr(ds->documents, DocumentSymbolsDocument, doc) {
+		if (doc->buffer == buffer)
+			return doc;
+	}
+	return NULL;
+}
+
+static void document_symbols_remove_document(Ted *ted, DocumentSymbolsDocument *doc) {
+	DocumentSymbols *ds = ted->document_symbols;
+	document_symbols_document_free(ted, doc);
+	arr_remove(ds->documents, (u32)(doc - ds->documents));
+}
+
+// move a line number to where it is after an edit
+static u32 document_symbols_edit_line(const EditInfo *info, u32 line) {
+	const u32 nlines = info->end.line - info->pos.line;
+	if (info->chars_inserted) {
+		return line > info->pos.line ? line + nlines : line;
+	} else {
+		if (line > info->end.line) return line - nlines;
+		if (line > info->pos.line) return info->pos.line;
+		return line;
+	}
+}
+
+// move a position to where it is after an edit
+static BufferPos document_symbols_edit_pos(const EditInfo *info, BufferPos p) {
+	const BufferPos pos = info->pos, end = info->end;
+	if (info->chars_inserted) {
+		if (p.line == pos.line && p.index >= pos.index) {
+			p.index = p.index - pos.index + end.index;
+			p.line = end.line;
+		} else if (p.line > pos.line) {
+			p.line += end.line - pos.line;
+		}
+	} else {
+		if (buffer_pos_cmp(p, end) >= 0) {
+			if (p.line == end.line) {
+				p.index = p.index - end.index + pos.index;
+				p.line = pos.line;
+			} else {
+				p.line -= end.line - pos.line;
+			}
+		} else if (buffer_pos_cmp(p, pos) > 0) {
+			p = pos;
+		}
+	}
+	return p;
+}
+
+static void document_symbols_edit_notify(void *context, TextBuffer *buffer, const EditInfo *info) {
+	Ted *ted = context;
+	DocumentSymbols *ds = ted->document_symbols;
+	arr_foreach_ptr(ds->documents, DocumentSymbolsDocument, doc) {
+		if (doc->buffer != buffer) continue;
+		++doc->edit_count;
+		doc->next_request_time = ted->frame_time + DOCUMENT_SYMBOLS_DEBOUNCE;
+		// keep the symbols (roughly) in the right place until we hear back from the server.
+		// this doesn't change the order of the symbols.
+		arr_foreach_ptr(doc->symbols, DocumentSymbol, symbol) {
+			symbol->first_line = document_symbols_edit_line(info, symbol->first_line);
+			symbol->last_line = document_symbols_edit_line(info, symbol->last_line);
+			symbol->pos = document_symbols_edit_pos(info, symbol->pos);
+		}
+	}
+}
+
+/// index of the innermost symbol containing `line`, or `U32_MAX` if there isn't one.
+static u32 document_symbols_enclosing(const DocumentSymbolsDocument *doc, u32 line) {
+	const DocumentSymbol *symbols = doc->symbols;
+	// find the last symbol starting at or before `line`
+	u32 lo = 0, hi = arr_len(symbols);
+	while (lo < hi) {
+		const u32 mid = lo + (hi - lo) / 2;
+		if (symbols[mid].first_line <= line)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	if (lo == 0) return U32_MAX;
+	// since the symbols are in pre-order, if that symbol doesn't contain `line`,
+	// the innermost one which does must be one of its ancestors.
+	u32 i = lo - 1;
+	while (i != U32_MAX && symbols[i].last_line < line)
+		i = symbols[i].parent;
+	return i;
+}
+
+static void document_symbols_update_buffer(Ted *ted, TextBuffer *buffer) {
+	DocumentSymbols *ds = ted->document_symbols;
+	DocumentSymbolsDocument *doc = document_symbols_get_document(ted, buffer);
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp) {
+		if (doc) document_symbols_remove_document(ted, doc);
+		return;
+	}
+	if (!lsp_is_initialized(lsp))
+		return;
+
+	LSPDocumentID document = buffer_lsp_document_id(buffer);
+	if (doc && (doc->lsp != lsp_get_id(lsp) || doc->document != document)) {
+		// different server/file -- start over
+		document_symbols_remove_document(ted, doc);
+		doc = NULL;
+	}
+	if (!doc) {
+		doc = arr_addp(ds->documents);
+		if (!doc) return;
+		doc->buffer = buffer;
+		doc->lsp = lsp_get_id(lsp);
+		doc->document = document;
+	}
+	if (doc->unsupported || doc->request.id)
+		return;
+	if (doc->have_symbols && doc->symbols_edit_count == doc->edit_count)
+		return; // up to date
+	if (ted->frame_time < doc->next_request_time)
+		return;
+
+	LSPRequest request = {.type = LSP_REQUEST_DOCUMENT_SYMBOLS};
+	request.data.document_symbols.document = document;
+	doc->request = lsp_send_request(lsp, &request);
+	doc->request_edit_count = doc->edit_count;
+	if (!doc->request.id)
+		doc->unsupported = true;
+}
+
+void document_symbols_frame(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	// forget about closed buffers
+	for (u32 i = 0; i < arr_len(ds->documents); ) {
+		DocumentSymbolsDocument *doc = &ds->documents[i];
+		if (!ted_is_regular_buffer(ted, doc->buffer)) {
+			document_symbols_remove_document(ted, doc);
+		} else {
+			++i;
+		}
+	}
+
+	// only buffers which are on screen get updated
+	arr_foreach_ptr(ted->nodes, NodePtr, pnode) {
+		Node *node = *pnode;
+		TextBuffer *buffer = node_get_tab(node, node_active_tab(node));
+		if (buffer)
+			document_symbols_update_buffer(ted, buffer);
+	}
+}
+
+double document_symbols_next_update_time(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	double t = INFINITY;
+	arr_foreach_ptr(ds->documents, const DocumentSymbolsDocument, doc) {
+		if (!doc->unsupported && !doc->request.id
+			&& (!doc->have_symbols || doc->symbols_edit_count != doc->edit_count))
+			t = mind(t, doc->next_request_time);
+	}
+	return t;
+}
+
+typedef struct {
+	u32 first_line;
+	u32 index;
+	u32 depth;
+	/// index into the response's symbols
+	u32 lsp_index;
+} DocumentSymbolOrder;
+
+// sort by start position, with parents before children which start in the same place.
+// (sorting by depth before column would put e.g. `struct A { int x; }; struct B {};`
+// in the order A, B, x, which isn't pre-order.)
+static int document_symbol_order_cmp(const void *av, const void *bv) {
+	const DocumentSymbolOrder *a = av, *b = bv;
+	if (a->first_line != b->first_line)
+		return a->first_line < b->first_line ? -1 : 1;
+	if (a->index != b->index)
+		return a->index < b->index ? -1 : 1;
+	if (a->depth != b->depth)
+		return a->depth < b->depth ? -1 : 1;
+	return 0;
+}
+
+/// is `old` the same symbol as `new` (apart from its position)?
+static bool document_symbols_same(const DocumentSymbol *old, const DocumentSymbol *new,
+	const char *name, const char *detail) {
+	return old->kind == new->kind && old->depth == new->depth
+		&& streq(old->name, name)
+		&& streq(old->detail ? old->detail : "", detail);
+}
+
+/// replace `doc`'s symbols with the ones in `response`,
+/// keeping as much of the old tree as we can.
+static void document_symbols_apply(DocumentSymbolsDocument *doc, const LSPResponse *response) {
+	TextBuffer *buffer = doc->buffer;
+	const LSPDocumentSymbol *lsp_symbols = response->data.document_symbols.symbols;
+	const u32 n = arr_len(lsp_symbols);
+
+	// put the symbols in pre-order. the server should already be sending them in order,
+	// but it doesn't have to.
+	DocumentSymbolOrder *order = calloc(n + 1, sizeof *order);
+	u32 *depths = calloc(n + 1, sizeof *depths);
+	u32 *new_index = calloc(n + 1, sizeof *new_index);
+	for (u32 i = 0; i < n; ++i) {
+		const u32 parent = lsp_symbols[i].parent;
+		// (parents always come before their children in the response)
+		depths[i] = parent < i ? depths[parent] + 1 : 0;
+		order[i].first_line = lsp_symbols[i].range.start.line;
+		order[i].depth = depths[i];
+		order[i].index = buffer_pos_from_lsp(buffer, lsp_symbols[i].range.start).index;
+		order[i].lsp_index = i;
+	}
+	qsort(order, n, sizeof *order, document_symbol_order_cmp);
+	for (u32 i = 0; i < n; ++i)
+		new_index[order[i].lsp_index] = i;
+
+	DocumentSymbol *old = doc->symbols;
+	const u32 nold = arr_len(old);
+	DocumentSymbol *symbols = NULL;
+	arr_set_len(symbols, n);
+	bool changed = n != nold;
+	u32 j = 0; // next old symbol which hasn't been matched up
+	for (u32 i = 0; i < n && symbols; ++i) {
+		const LSPDocumentSymbol *lsp_symbol = &lsp_symbols[order[i].lsp_index];
+		DocumentSymbol *symbol = &symbols[i];
+		symbol->kind = symbol_kind_to_ted(lsp_symbol->kind);
+		symbol->depth = order[i].depth;
+		symbol->parent = lsp_symbol->parent < n ? new_index[lsp_symbol->parent] : U32_MAX;
+		symbol->first_line = lsp_symbol->range.start.line;
+		symbol->last_line = max_u32(lsp_symbol->range.end.line, symbol->first_line);
+		symbol->pos = buffer_pos_from_lsp(buffer, lsp_symbol->selection_range.start);
+
+		const char *name = lsp_response_string(response, lsp_symbol->name);
+		const char *detail = lsp_response_string(response, lsp_symbol->detail);
+		u32 match = U32_MAX;
+		for (u32 k = j; k < nold && k <= j + DOCUMENT_SYMBOLS_DIFF_LOOKAHEAD; ++k) {
+			if (document_symbols_same(&old[k], symbol, name, detail)) {
+				match = k;
+				break;
+			}
+		}
+		if (match == U32_MAX) {
+			symbol->name = str_dup(name);
+			symbol->detail = *detail ? str_dup(detail) : NULL;
+			changed = true;
+		} else {
+			if (match != j || old[match].parent != symbol->parent)
+				changed = true;
+			// anything we skipped over has been removed
+			for (; j < match; ++j)
+				document_symbols_free_strings(&old[j]);
+			symbol->name = old[match].name;
+			symbol->detail = old[match].detail;
+			old[match].name = old[match].detail = NULL;
+			j = match + 1;
+		}
+	}
+	for (; j < nold; ++j)
+		document_symbols_free_strings(&old[j]);
+	arr_free(doc->symbols);
+	doc->symbols = symbols;
+	if (changed)
+		++doc->generation;
+
+	free(order);
+	free(depths);
+	free(new_index);
+}
+
+void document_symbols_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	DocumentSymbols *ds = ted->document_symbols;
+	const LSPRequest *request = &response->request;
+	if (request->type != LSP_REQUEST_DOCUMENT_SYMBOLS)
+		return;
+	DocumentSymbolsDocument *doc = NULL;
+	arr_foreach_ptr(ds->documents, DocumentSymbolsDocument, d) {
+		if (request->id == d->request.id) {
+			doc = d;
+			break;
+		}
+	}
+	if (!doc) return; // request was cancelled
+	doc->request.id = 0;
+	if (!lsp_string_is_empty(response->error)) {
+		doc->next_request_time = ted->frame_time + DOCUMENT_SYMBOLS_RETRY;
+		return;
+	}
+	if (doc->request_edit_count != doc->edit_count) {
+		// positions are out of date -- we'll ask again
+		return;
+	}
+	document_symbols_apply(doc, response);
+	doc->symbols_edit_count = doc->request_edit_count;
+	doc->have_symbols = true;
+}
+
+bool document_symbols_breadcrumb(Ted *ted, TextBuffer *buffer, char *out, size_t out_size) {
+	if (out_size) *out = '\0';
+	const DocumentSymbolsDocument *doc = document_symbols_get_document(ted, buffer);
+	if (!doc || !doc->have_symbols)
+		return false;
+	u32 i = document_symbols_enclosing(doc, buffer_cursor_pos(buffer).line);
+	if (i == U32_MAX)
+		return true;
+	// go up to the top-level symbol, then write the names on the way back down
+	u32 path[32];
+	u32 depth = 0;
+	for (; i != U32_MAX && depth < arr_count(path); i = doc->symbols[i].parent)
+		path[depth++] = i;
+	while (depth--) {
+		str_cat(out, out_size, doc->symbols[path[depth]].name);
+		if (depth) str_cat(out, out_size, " > ");
+	}
+	return true;
+}
+
+bool document_symbols_available(Ted *ted, TextBuffer *buffer) {
+	const DocumentSymbolsDocument *doc = document_symbols_get_document(ted, buffer);
+	return doc && !doc->unsupported;
+}
+
+/// put the symbols for the outline menu's buffer into the selector (if they've changed)
+static void outline_update_entries(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	const DocumentSymbolsDocument *doc = document_symbols_get_document(ted, ds->outline_buffer);
+	if (!doc || !doc->have_symbols || doc->generation == ds->outline_generation)
+		return;
+	Selector *sel = ds->selector;
+	u32 cursor = selector_get_cursor(sel);
+	selector_clear_entries(sel);
+	arr_foreach_ptr(doc->symbols, const DocumentSymbol, symbol) {
+		// indent symbols to show the tree structure
+		char name[256];
+		const u32 indent = min_u32(symbol->depth, 16);
+		memset(name, ' ', 2 * indent);
+		name[2 * indent] = '\0';
+		strbuf_cat(name, symbol->name);
+		SelectorEntry entry = {
+			.color = color_for_symbol_kind(symbol->kind),
+			.name = name,
+			.detail = symbol->detail,
+			.userdata = (u64)(symbol - doc->symbols),
+		};
+		selector_add_entry(sel, &entry);
+	}
+	if (ds->outline_generation == 0) {
+		// start at the symbol the cursor is in
+		u32 enclosing = document_symbols_enclosing(doc, buffer_cursor_pos(doc->buffer).line);
+		cursor = enclosing == U32_MAX ? 0 : enclosing;
+	}
+	selector_set_cursor(sel, min_u32(cursor, arr_len(doc->symbols) ? arr_len(doc->symbols) - 1 : 0));
+	ds->outline_generation = doc->generation;
+}
+
+static void outline_menu_open(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	ds->outline_buffer = ted->prev_active_buffer;
+	// (generations start at 1 once there are symbols)
+	ds->outline_generation = 0;
+	selector_clear(ds->selector);
+	outline_update_entries(ted);
+	ted_switch_to_buffer(ted, ted->line_buffer);
+	buffer_select_all(ted->active_buffer);
+}
+
+static bool outline_menu_close(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	selector_clear(ds->selector);
+	ds->outline_buffer = NULL;
+	return true;
+}
+
+static void outline_menu_update(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	Selector *sel = ds->selector;
+	outline_update_entries(ted);
+	char *chosen = selector_update(ted, sel);
+	if (!chosen) return;
+	free(chosen);
+	SelectorEntry entry = {0};
+	const DocumentSymbolsDocument *doc = document_symbols_get_document(ted, ds->outline_buffer);
+	if (!doc || !selector_get_cursor_entry(sel, &entry) || entry.userdata >= arr_len(doc->symbols)) {
+		menu_close(ted);
+		return;
+	}
+	TextBuffer *buffer = doc->buffer;
+	const BufferPos pos = doc->symbols[entry.userdata].pos;
+	menu_close(ted);
+	buffer_cursor_move_to_pos(buffer, pos);
+	buffer_center_cursor(buffer);
+}
+
+static void outline_menu_render(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	Rect bounds = selection_menu_render_bg(ted);
+	selector_set_bounds(ds->selector, bounds);
+	selector_render(ted, ds->selector);
+}
+
+void document_symbols_init(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols = ted_calloc(ted, 1, sizeof *ted->document_symbols);
+	ds->edit_notify = ted_add_edit_notify(ted, document_symbols_edit_notify, ted);
+	ds->selector = selector_new();
+
+	MenuInfo info = {
+		.open = outline_menu_open,
+		.close = outline_menu_close,
+		.render = outline_menu_render,
+		.update = outline_menu_update,
+	};
+	strbuf_cpy(info.name, MENU_OUTLINE);
+	menu_register(ted, &info);
+}
+
+void document_symbols_quit(Ted *ted) {
+	DocumentSymbols *ds = ted->document_symbols;
+	arr_foreach_ptr(ds->documents, DocumentSymbolsDocument, doc) {
+		document_symbols_document_free(ted, doc);
+	}
+	arr_free(ds->documents);
+	ted_remove_edit_notify(ted, ds->edit_notify);
+	selector_free(ds->selector);
+	free(ds);
+	ted->document_symbols = NULL;
+}
@@ -0,0 +1,214 @@
+// folding ranges of lines
+// if the LSP server supports textDocument/foldingRange, we keep the ranges for
+// buffers on screen up to date, so that folding happens as soon as the user asks for it.
+// otherwise (or while we're waiting for the server), ranges are found from
+// brackets and indentation (see buffer_fold_range_at_line).
+
+#include "ted-internal.h"
+
+/// wait this long after the last edit before asking for new ranges
+#define FOLDING_DEBOUNCE 0.5
+/// wait this long before trying again after an error
+#define FOLDING_RETRY 2.0
+
+typedef struct {
+	TextBuffer *buffer;
+	LSPID lsp;
+	LSPDocumentID document;
+	LSPServerRequestID request;
+	/// dynamic array of ranges from the last response
+	LSPFoldingRange *ranges;
+	/// number of edits made to the buffer
+	u32 edit_count;
+	/// value of \ref edit_count when \ref request was sent
+	u32 request_edit_count;
+	/// value of \ref edit_count when the request for \ref ranges was sent
+	u32 ranges_edit_count;
+	/// have we gotten any ranges?
+	bool have_ranges;
+	/// don't send any requests before this time
+	double next_request_time;
+	/// the server doesn't support folding ranges
+	bool unsupported;
+} FoldingDocument;
+
+struct Folding {
+	EditNotifyID edit_notify;
+	/// dynamic array
+	FoldingDocument *documents;
+};
+
+static void folding_edit_notify(void *context, TextBuffer *buffer, const EditInfo *info) {
+	(void)info;
+	Ted *ted = context;
+	Folding *folding = ted->folding;
+	arr_foreach_ptr(folding->documents, FoldingDocument, doc) {
+		if (doc->buffer == buffer) {
+			++doc->edit_count;
+			doc->next_request_time = ted->frame_time + FOLDING_DEBOUNCE;
+		}
+	}
+}
+
+void folding_init(Ted *ted) {
+	ted->folding = calloc(1, sizeof *ted->folding);
+	ted->folding->edit_notify = ted_add_edit_notify(ted, folding_edit_notify, ted);
+}
+
+static void folding_document_free(Ted *ted, FoldingDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->request);
+	arr_free(doc->ranges);
+	memset(doc, 0, sizeof *doc);
+}
+
+void folding_quit(Ted *ted) {
+	Folding *folding = ted->folding;
+	arr_foreach_ptr(folding->documents, FoldingDocument, doc) {
+		folding_document_free(ted, doc);
+	}
+	arr_free(folding->documents);
+	ted_remove_edit_notify(ted, folding->edit_notify);
+	free(folding);
+	ted->folding = NULL;
+}
+
+static FoldingDocument *folding_get_document(Ted *ted, TextBuffer *buffer) {
+	Folding *folding = ted->folding;
+	arr_foreach_ptr(folding->documents, FoldingDocument, doc) {
+		if (doc->buffer == buffer)
+			return doc;
+	}
+	return NULL;
+}
+
+static void folding_remove_document(Ted *ted, FoldingDocument *doc) {
+	Folding *folding = ted->folding;
+	folding_document_free(ted, doc);
+	arr_remove(folding->documents, (u32)(doc - folding->documents));
+}
+
+static void folding_update_buffer(Ted *ted, TextBuffer *buffer) {
+	Folding *folding = ted->folding;
+	FoldingDocument *doc = folding_get_document(ted, buffer);
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp) {
+		if (doc) folding_remove_document(ted, doc);
+		return;
+	}
+	if (!lsp_is_initialized(lsp))
+		return;
+
+	LSPDocumentID document = buffer_lsp_document_id(buffer);
+	if (doc && (doc->lsp != lsp_get_id(lsp) || doc->document != document)) {
+		// different server/file -- start over
+		folding_remove_document(ted, doc);
+		doc = NULL;
+	}
+	if (!doc) {
+		doc = arr_addp(folding->documents);
+		if (!doc) return;
+		doc->buffer = buffer;
+		doc->lsp = lsp_get_id(lsp);
+		doc->document = document;
+	}
+	if (doc->unsupported || doc->request.id)
+		return;
+	if (doc->have_ranges && doc->ranges_edit_count == doc->edit_count)
+		return; // up to date
+	if (ted->frame_time < doc->next_request_time)
+		return;
+
+	LSPRequest request = {.type = LSP_REQUEST_FOLDING_RANGE};
+	request.data.folding_range.document = document;
+	doc->request = lsp_send_request(lsp, &request);
+	doc->request_edit_count = doc->edit_count;
+	if (!doc->request.id)
+		doc->unsupported = true;
+}
+
+void folding_frame(Ted *ted) {
+	Folding *folding = ted->folding;
+	// forget about closed buffers
+	for (u32 i = 0; i < arr_len(folding->documents); ) {
+		FoldingDocument *doc = &folding->documents[i];
+		if (!ted_is_regular_buffer(ted, doc->buffer)) {
+			folding_remove_document(ted, doc);
+		} else {
+			++i;
+		}
+	}
+
+	// only buffers which are on screen get updated
+	arr_foreach_ptr(ted->nodes, NodePtr, pnode) {
+		Node *node = *pnode;
+		TextBuffer *buffer = node_get_tab(node, node_active_tab(node));
+		if (buffer)
+			folding_update_buffer(ted, buffer);
+	}
+}
+
+double folding_next_update_time(Ted *ted) {
+	Folding *folding = ted->folding;
+	double t = INFINITY;
+	arr_foreach_ptr(folding->documents, const FoldingDocument, doc) {
+		if (!doc->unsupported && !doc->request.id
+			&& (!doc->have_ranges || doc->ranges_edit_count != doc->edit_count))
+			t = mind(t, doc->next_request_time);
+	}
+	return t;
+}
+
+void folding_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	Folding *folding = ted->folding;
+	const LSPRequest *request = &response->request;
+	if (request->type != LSP_REQUEST_FOLDING_RANGE)
+		return;
+	FoldingDocument *doc = NULL;
+	arr_foreach_ptr(folding->documents, FoldingDocument, d) {
+		if (request->id == d->request.id) {
+			doc = d;
+			break;
+		}
+	}
+	if (!doc) return; // request was cancelled
+	doc->request.id = 0;
+	if (!lsp_string_is_empty(response->error)) {
+		doc->next_request_time = ted->frame_time + FOLDING_RETRY;
+		return;
+	}
+	arr_free(doc->ranges);
+	doc->ranges = arr_copy(response->data.folding_range.ranges);
+	doc->ranges_edit_count = doc->request_edit_count;
+	doc->have_ranges = true;
+}
+
+/// find the innermost range from the server which contains `line`.
+/// returns false if there isn't one, or the ranges are out of date.
+static bool folding_lsp_range_at_line(Ted *ted, TextBuffer *buffer, u32 line, u32 *start, u32 *end) {
+	const FoldingDocument *doc = folding_get_document(ted, buffer);
+	if (!doc || !doc->have_ranges || doc->ranges_edit_count != doc->edit_count)
+		return false;
+	const LSPFoldingRange *best = NULL;
+	arr_foreach_ptr(doc->ranges, const LSPFoldingRange, range) {
+		if (range->start_line > line || range->end_line < line)
+			continue;
+		if (!best || range->start_line > best->start_line
+			|| (range->start_line == best->start_line && range->end_line < best->end_line))
+			best = range;
+	}
+	if (!best) return false;
+	*start = best->start_line;
+	*end = best->end_line;
+	return true;
+}
+
+void folding_toggle(Ted *ted, TextBuffer *buffer) {
+	const u32 line = buffer_cursor_pos(buffer).line;
+	if (buffer_unfold(buffer, line))
+		return;
+	u32 start = line, end = 0;
+	if (!folding_lsp_range_at_line(ted, buffer, line, &start, &end)
+		&& !buffer_fold_range_at_line(buffer, line, &end))
+		return;
+	buffer_fold(buffer, start, end);
+}
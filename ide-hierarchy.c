@@ -0,0 +1,482 @@
+// call and type hierarchies (e.g. "what calls this function?")
+//
+// these are shown as a tree in a menu. a function can have thousands of callers,
+// and each of those has its own callers, so nothing is fetched until the user
+// expands a node, and we never wait for the server.
+// the children of each item are cached by the item's position, so if a function
+// shows up more than once in the tree, we only ask about it once.
+// if a node is collapsed before its children arrive, the request is cancelled.
+
+#include "ted-internal.h"
+
+typedef struct {
+	char *name;
+	/// NULL if there isn't one
+	char *detail;
+	/// `data` field from the server, as JSON text (NULL if there isn't one)
+	char *data;
+	LSPSymbolKind kind;
+	LSPDocumentID document;
+	LSPRange range;
+	LSPRange selection_range;
+} HierarchyItem;
+
+typedef struct {
+	/// request for the children of this item, if we're waiting on one
+	LSPServerRequestID request;
+	/// have we gotten the children?
+	bool fetched;
+	/// number of expanded nodes waiting for \ref request
+	u32 waiting;
+	/// dynamic array of children. this is never changed once \ref fetched is set.
+	HierarchyItem *items;
+} HierarchyCacheEntry;
+
+typedef struct {
+	/// points into \ref Hierarchy.roots or a \ref HierarchyCacheEntry's items
+	const HierarchyItem *item;
+	u32 depth;
+	bool expanded;
+	/// have the nodes for the children been created?
+	bool has_children;
+	/// dynamic array of indices into \ref Hierarchy.nodes
+	u32 *children;
+} HierarchyNode;
+
+struct Hierarchy {
+	HierarchyType type;
+	LSPID lsp;
+	/// textDocument/prepareCallHierarchy or textDocument/prepareTypeHierarchy request
+	LSPServerRequestID prepare_request;
+	double prepare_request_time;
+	/// dynamic array of items at the cursor
+	HierarchyItem *roots;
+	/// dynamic array. the first `arr_len(roots)` nodes are for the roots.
+	HierarchyNode *nodes;
+	/// maps LSPDocumentPosition (of each item's name) to HierarchyCacheEntry
+	StrHashTable cache;
+	Selector *selector;
+	/// do the selector entries need to be rebuilt?
+	bool entries_stale;
+};
+
+/// entry userdata for "loading..." entries
+#define HIERARCHY_LOADING U64_MAX
+
+static void hierarchy_item_free(HierarchyItem *item) {
+	free(item->name);
+	free(item->detail);
+	free(item->data);
+	memset(item, 0, sizeof *item);
+}
+
+static void hierarchy_items_free(HierarchyItem **items) {
+	arr_foreach_ptr(*items, HierarchyItem, item) {
+		hierarchy_item_free(item);
+	}
+	arr_free(*items);
+}
+
+static void hierarchy_items_from_lsp(HierarchyItem **items, const LSPResponse *response) {
+	arr_foreach_ptr(response->data.hierarchy.items, const LSPHierarchyItem, lsp_item) {
+		HierarchyItem *item = arr_addp(*items);
+		if (!item) break;
+		const char *detail = lsp_response_string(response, lsp_item->detail);
+		const char *data = lsp_response_string(response, lsp_item->data);
+		item->name = str_dup(lsp_response_string(response, lsp_item->name));
+		item->detail = *detail ? str_dup(detail) : NULL;
+		item->data = *data ? str_dup(data) : NULL;
+		item->kind = lsp_item->kind;
+		item->document = lsp_item->document;
+		item->range = lsp_item->range;
+		item->selection_range = lsp_item->selection_range;
+	}
+}
+
+static LSPDocumentPosition hierarchy_item_position(const HierarchyItem *item) {
+	LSPDocumentPosition pos;
+	// (zero any padding, since this is used as a hash table key)
+	memset(&pos, 0, sizeof pos);
+	pos.document = item->document;
+	pos.pos = item->selection_range.start;
+	return pos;
+}
+
+/// get the cache entry for `item`'s children, adding one if there isn't one already
+static HierarchyCacheEntry *hierarchy_cache_get(Hierarchy *hierarchy, const HierarchyItem *item) {
+	LSPDocumentPosition key = hierarchy_item_position(item);
+	return str_hash_table_insert_with_len(&hierarchy->cache, (const char *)&key, sizeof key);
+}
+
+/// get the cache entry for `item`'s children, or NULL if there isn't one
+static HierarchyCacheEntry *hierarchy_cache_find(Hierarchy *hierarchy, const HierarchyItem *item) {
+	LSPDocumentPosition key = hierarchy_item_position(item);
+	return str_hash_table_get_with_len(&hierarchy->cache, (const char *)&key, sizeof key);
+}
+
+/// cancel all requests and forget everything
+static void hierarchy_clear(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	ted_cancel_lsp_request(ted, &hierarchy->prepare_request);
+	arr_foreach_ptr(hierarchy->cache.slots, StrHashTableSlotPtr, pslot) {
+		if (!*pslot) continue;
+		HierarchyCacheEntry *entry = (HierarchyCacheEntry *)(*pslot)->data;
+		ted_cancel_lsp_request(ted, &entry->request);
+		hierarchy_items_free(&entry->items);
+	}
+	str_hash_table_clear(&hierarchy->cache);
+	arr_foreach_ptr(hierarchy->nodes, HierarchyNode, node) {
+		arr_free(node->children);
+	}
+	arr_free(hierarchy->nodes);
+	hierarchy_items_free(&hierarchy->roots);
+	hierarchy->entries_stale = true;
+}
+
+static LSPRequestType hierarchy_children_request_type(HierarchyType type) {
+	switch (type) {
+	case HIERARCHY_INCOMING_CALLS: return LSP_REQUEST_INCOMING_CALLS;
+	case HIERARCHY_OUTGOING_CALLS: return LSP_REQUEST_OUTGOING_CALLS;
+	case HIERARCHY_SUPERTYPES: return LSP_REQUEST_SUPERTYPES;
+	case HIERARCHY_SUBTYPES: return LSP_REQUEST_SUBTYPES;
+	}
+	assert(0);
+	return LSP_REQUEST_INCOMING_CALLS;
+}
+
+static const char *hierarchy_title(HierarchyType type) {
+	switch (type) {
+	case HIERARCHY_INCOMING_CALLS: return "Incoming calls";
+	case HIERARCHY_OUTGOING_CALLS: return "Outgoing calls";
+	case HIERARCHY_SUPERTYPES: return "Supertypes";
+	case HIERARCHY_SUBTYPES: return "Subtypes";
+	}
+	assert(0);
+	return "";
+}
+
+/// create nodes for the children of `nodes[index]` from its cache entry
+static void hierarchy_node_add_children(Hierarchy *hierarchy, u32 index, const HierarchyCacheEntry *entry) {
+	if (hierarchy->nodes[index].has_children)
+		return;
+	const u32 depth = hierarchy->nodes[index].depth + 1;
+	u32 *children = NULL;
+	arr_foreach_ptr(entry->items, const HierarchyItem, item) {
+		HierarchyNode *child = arr_addp(hierarchy->nodes);
+		if (!child) break;
+		child->item = item;
+		child->depth = depth;
+		arr_add(children, arr_len(hierarchy->nodes) - 1);
+	}
+	// (hierarchy->nodes may have been reallocated)
+	HierarchyNode *node = &hierarchy->nodes[index];
+	node->children = children;
+	node->has_children = true;
+}
+
+static void hierarchy_expand(Ted *ted, u32 index) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	HierarchyNode *node = &hierarchy->nodes[index];
+	if (node->expanded) return;
+	node->expanded = true;
+	hierarchy->entries_stale = true;
+	HierarchyCacheEntry *entry = hierarchy_cache_get(hierarchy, node->item);
+	if (entry->fetched) {
+		hierarchy_node_add_children(hierarchy, index, entry);
+		return;
+	}
+	++entry->waiting;
+	if (entry->request.id)
+		return; // already asked
+	LSP *lsp = ted_get_lsp_by_id(ted, hierarchy->lsp);
+	if (lsp) {
+		const HierarchyItem *item = node->item;
+		LSPRequest request = {.type = hierarchy_children_request_type(hierarchy->type)};
+		LSPHierarchyItem *lsp_item = &request.data.hierarchy.item;
+		lsp_item->name = lsp_request_add_string(&request, item->name);
+		lsp_item->detail = lsp_request_add_string(&request, item->detail ? item->detail : "");
+		lsp_item->data = lsp_request_add_string(&request, item->data ? item->data : "");
+		lsp_item->kind = item->kind;
+		lsp_item->document = item->document;
+		lsp_item->range = item->range;
+		lsp_item->selection_range = item->selection_range;
+		entry->request = lsp_send_request(lsp, &request);
+	}
+	if (!entry->request.id) {
+		// the server is gone or doesn't support this -- just say there's nothing here
+		entry->waiting = 0;
+		entry->fetched = true;
+		hierarchy_node_add_children(hierarchy, index, entry);
+	}
+}
+
+/// collapse `nodes[index]` and everything under it.
+static void hierarchy_collapse(Ted *ted, u32 index) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	HierarchyNode *node = &hierarchy->nodes[index];
+	if (!node->expanded) return;
+	node->expanded = false;
+	hierarchy->entries_stale = true;
+	if (node->has_children) {
+		arr_foreach_ptr(node->children, const u32, child) {
+			hierarchy_collapse(ted, *child);
+		}
+		return;
+	}
+	// we were waiting for the children
+	HierarchyCacheEntry *entry = hierarchy_cache_find(hierarchy, node->item);
+	if (!entry) return;
+	if (entry->waiting) --entry->waiting;
+	if (!entry->waiting && entry->request.id) {
+		// no one else wants this -- don't make the server do any more work on it
+		ted_cancel_lsp_request(ted, &entry->request);
+	}
+}
+
+static void hierarchy_add_entries(Ted *ted, u32 index) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	const HierarchyNode *node = &hierarchy->nodes[index];
+	const HierarchyItem *item = node->item;
+	LSP *lsp = ted_get_lsp_by_id(ted, hierarchy->lsp);
+	const u32 indent = min_u32(node->depth, 32);
+
+	char name[256];
+	memset(name, ' ', 2 * indent);
+	name[2 * indent] = '\0';
+	const HierarchyCacheEntry *entry = hierarchy_cache_find(hierarchy, item);
+	if (entry && entry->fetched && !arr_len(entry->items))
+		strbuf_cat(name, "  "); // nothing to expand
+	else
+		strbuf_cat(name, node->expanded ? "- " : "+ ");
+	strbuf_cat(name, item->name);
+
+	char detail[TED_PATH_MAX + 64];
+	if (item->detail) {
+		strbuf_cpy(detail, item->detail);
+	} else {
+		const char *path = lsp ? lsp_document_path(lsp, item->document) : "";
+		strbuf_printf(detail, "%s:%" PRIu32, path_filename(path), item->selection_range.start.line + 1);
+	}
+	SelectorEntry selector_entry = {
+		.color = color_for_symbol_kind(symbol_kind_to_ted(item->kind)),
+		.name = name,
+		.detail = detail,
+		.userdata = index,
+	};
+	selector_add_entry(hierarchy->selector, &selector_entry);
+
+	if (!node->expanded)
+		return;
+	if (!node->has_children) {
+		memset(name, ' ', 2 * indent + 4);
+		name[2 * indent + 4] = '\0';
+		strbuf_cat(name, "loading...");
+		SelectorEntry loading = {
+			.color = COLOR_COMMENT,
+			.name = name,
+			.userdata = HIERARCHY_LOADING,
+		};
+		selector_add_entry(hierarchy->selector, &loading);
+		return;
+	}
+	const u32 *children = node->children;
+	for (u32 i = 0; i < arr_len(children); ++i)
+		hierarchy_add_entries(ted, children[i]);
+}
+
+static void hierarchy_update_entries(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	if (!hierarchy->entries_stale) return;
+	Selector *sel = hierarchy->selector;
+	// keep the cursor on the same node
+	SelectorEntry cursor_entry = {0};
+	u64 cursor_node = selector_get_cursor_entry(sel, &cursor_entry) ? cursor_entry.userdata : 0;
+	selector_clear_entries(sel);
+	for (u32 i = 0; i < arr_len(hierarchy->roots); ++i)
+		hierarchy_add_entries(ted, i);
+	for (u32 i = 0; ; ++i) {
+		SelectorEntry entry = {0};
+		if (!selector_get_entry(sel, i, &entry)) break;
+		if (entry.userdata == cursor_node) {
+			selector_set_cursor(sel, i);
+			break;
+		}
+	}
+	hierarchy->entries_stale = false;
+}
+
+void hierarchy_open(Ted *ted, HierarchyType type) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	TextBuffer *buffer = ted->active_buffer;
+	if (!buffer) return;
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp) {
+		ted_flash_error_cursor(ted);
+		return;
+	}
+	hierarchy_clear(ted);
+	hierarchy->type = type;
+	hierarchy->lsp = lsp_get_id(lsp);
+	const bool is_call = type == HIERARCHY_INCOMING_CALLS || type == HIERARCHY_OUTGOING_CALLS;
+	LSPRequest request = {.type = is_call ? LSP_REQUEST_PREPARE_CALL_HIERARCHY : LSP_REQUEST_PREPARE_TYPE_HIERARCHY};
+	request.data.hierarchy.position = buffer_cursor_pos_as_lsp_document_position(buffer);
+	hierarchy->prepare_request = lsp_send_request(lsp, &request);
+	hierarchy->prepare_request_time = ted->frame_time;
+	if (!hierarchy->prepare_request.id)
+		ted_flash_error_cursor(ted); // not supported
+}
+
+void hierarchy_toggle_expanded(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	SelectorEntry entry = {0};
+	if (!selector_get_cursor_entry(hierarchy->selector, &entry) || entry.userdata >= arr_len(hierarchy->nodes))
+		return;
+	const u32 index = (u32)entry.userdata;
+	if (hierarchy->nodes[index].expanded)
+		hierarchy_collapse(ted, index);
+	else
+		hierarchy_expand(ted, index);
+}
+
+void hierarchy_frame(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	if (hierarchy->prepare_request.id && ted->frame_time - hierarchy->prepare_request_time > 0.2)
+		ted->cursor = ted->cursor_wait; // this request is takin a while
+}
+
+void hierarchy_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	const LSPRequest *request = &response->request;
+	switch (request->type) {
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+		if (request->id != hierarchy->prepare_request.id)
+			return;
+		hierarchy->prepare_request.id = 0;
+		if (!lsp_string_is_empty(response->error) || !arr_len(response->data.hierarchy.items)) {
+			ted_flash_error_cursor(ted);
+			return;
+		}
+		hierarchy_items_from_lsp(&hierarchy->roots, response);
+		arr_foreach_ptr(hierarchy->roots, const HierarchyItem, item) {
+			HierarchyNode *node = arr_addp(hierarchy->nodes);
+			if (node) node->item = item;
+		}
+		menu_open(ted, MENU_HIERARCHY);
+		if (arr_len(hierarchy->nodes) == 1) {
+			// there's only one thing to look at
+			hierarchy_expand(ted, 0);
+		}
+		return;
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES:
+		break;
+	default:
+		return;
+	}
+
+	HierarchyCacheEntry *entry = NULL;
+	arr_foreach_ptr(hierarchy->cache.slots, StrHashTableSlotPtr, pslot) {
+		if (!*pslot) continue;
+		HierarchyCacheEntry *e = (HierarchyCacheEntry *)(*pslot)->data;
+		if (e->request.id == request->id) {
+			entry = e;
+			break;
+		}
+	}
+	if (!entry) return; // request was cancelled
+	entry->request.id = 0;
+	entry->waiting = 0;
+	const bool error = !lsp_string_is_empty(response->error);
+	if (!error) {
+		hierarchy_items_from_lsp(&entry->items, response);
+		entry->fetched = true;
+	}
+	for (u32 i = 0; i < arr_len(hierarchy->nodes); ++i) {
+		HierarchyNode *node = &hierarchy->nodes[i];
+		if (!node->expanded || node->has_children
+			|| hierarchy_cache_find(hierarchy, node->item) != entry)
+			continue;
+		if (error)
+			node->expanded = false; // (the user can try again)
+		else
+			hierarchy_node_add_children(hierarchy, i, entry);
+	}
+	hierarchy->entries_stale = true;
+}
+
+static void hierarchy_menu_open(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	selector_clear(hierarchy->selector);
+	hierarchy->entries_stale = true;
+	hierarchy_update_entries(ted);
+	selector_set_cursor(hierarchy->selector, 0);
+	ted_switch_to_buffer(ted, ted->line_buffer);
+	buffer_select_all(ted->active_buffer);
+}
+
+static bool hierarchy_menu_close(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	hierarchy_clear(ted);
+	selector_clear(hierarchy->selector);
+	return true;
+}
+
+static void hierarchy_menu_update(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	Selector *sel = hierarchy->selector;
+	hierarchy_update_entries(ted);
+	char *chosen = selector_update(ted, sel);
+	if (!chosen) return;
+	free(chosen);
+	SelectorEntry entry = {0};
+	if (!selector_get_cursor_entry(sel, &entry) || entry.userdata >= arr_len(hierarchy->nodes))
+		return;
+	const HierarchyItem *item = hierarchy->nodes[entry.userdata].item;
+	// (we need to get these before menu_close, since that frees the items)
+	LSPDocumentPosition position = hierarchy_item_position(item);
+	LSP *lsp = ted_get_lsp_by_id(ted, hierarchy->lsp);
+	menu_close(ted);
+	if (lsp)
+		ted_go_to_lsp_document_position(ted, lsp, position);
+}
+
+static void hierarchy_menu_render(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	const Settings *settings = ted_active_settings(ted);
+	Font *font_bold = ted->font_bold;
+	Rect bounds = selection_menu_render_bg(ted);
+	char title[128];
+	strbuf_printf(title, "%s (Tab to expand/collapse)", hierarchy_title(hierarchy->type));
+	text_utf8(font_bold, title, bounds.pos.x, bounds.pos.y, settings_color(settings, COLOR_TEXT));
+	rect_shrink_top(&bounds, text_font_char_height(font_bold) * 0.75f + settings->padding);
+	text_render(font_bold);
+	selector_set_bounds(hierarchy->selector, bounds);
+	selector_render(ted, hierarchy->selector);
+}
+
+void hierarchy_init(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy = ted_calloc(ted, 1, sizeof *ted->hierarchy);
+	str_hash_table_create(&hierarchy->cache, sizeof(HierarchyCacheEntry));
+	hierarchy->selector = selector_new();
+
+	MenuInfo info = {
+		.open = hierarchy_menu_open,
+		.close = hierarchy_menu_close,
+		.render = hierarchy_menu_render,
+		.update = hierarchy_menu_update,
+	};
+	strbuf_cpy(info.name, MENU_HIERARCHY);
+	menu_register(ted, &info);
+}
+
+void hierarchy_quit(Ted *ted) {
+	Hierarchy *hierarchy = ted->hierarchy;
+	hierarchy_clear(ted);
+	arr_free(hierarchy->cache.slots);
+	selector_free(hierarchy->selector);
+	free(hierarchy);
+	ted->hierarchy = NULL;
+}
@@ -0,0 +1,262 @@
+// LSP inlay hints (e.g. parameter names and inferred types)
+// we only ask for the lines on screen, plus a margin so that scrolling a bit
+// doesn't need a round trip. hints are stored with the buffer's lines and get
+// moved around by edits (see buffer_inlay_hints_insert), so they stay in the
+// right place while we wait for the server to give us new ones.
+
+#include "ted-internal.h"
+
+/// wait this long after the last edit/scroll before asking for new hints
+#define INLAY_HINTS_DEBOUNCE 0.25
+/// wait this long before trying again after an error
+#define INLAY_HINTS_RETRY 2.0
+
+typedef struct {
+	TextBuffer *buffer;
+	LSPID lsp;
+	LSPDocumentID document;
+	LSPServerRequestID request;
+	/// range of lines we have hints for
+	u32 range_first, range_last;
+	/// range of lines \ref request is for
+	u32 request_first, request_last;
+	/// range of lines we wanted hints for as of the last frame
+	u32 wanted_first, wanted_last;
+	/// have we gotten any hints for this document?
+	bool have_range;
+	/// number of edits made to the buffer
+	u32 edit_count;
+	/// value of \ref edit_count when \ref request was sent
+	u32 request_edit_count;
+	/// value of \ref edit_count when the hints in [range_first, range_last] were requested
+	u32 range_edit_count;
+	/// don't send any requests before this time
+	double next_request_time;
+	/// the server doesn't support inlay hints
+	bool unsupported;
+} InlayHintsDocument;
+
+struct InlayHints {
+	EditNotifyID edit_notify;
+	/// dynamic array
+	InlayHintsDocument *documents;
+};
+
+static void inlay_hints_edit_notify(void *context, TextBuffer *buffer, const EditInfo *info) {
+	(void)info;
+	Ted *ted = context;
+	InlayHints *hints = ted->inlay_hints;
+	arr_foreach_ptr(hints->documents, InlayHintsDocument, doc) {
+		if (doc->buffer == buffer) {
+			++doc->edit_count;
+			doc->next_request_time = ted->frame_time + INLAY_HINTS_DEBOUNCE;
+		}
+	}
+}
+
+void inlay_hints_init(Ted *ted) {
+	ted->inlay_hints = calloc(1, sizeof *ted->inlay_hints);
+	ted->inlay_hints->edit_notify = ted_add_edit_notify(ted, inlay_hints_edit_notify, ted);
+}
+
+static void inlay_hints_document_free(Ted *ted, InlayHintsDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->request);
+	memset(doc, 0, sizeof *doc);
+}
+
+void inlay_hints_quit(Ted *ted) {
+	InlayHints *hints = ted->inlay_hints;
+	arr_foreach_ptr(hints->documents, InlayHintsDocument, doc) {
+		inlay_hints_document_free(ted, doc);
+	}
+	arr_free(hints->documents);
+	ted_remove_edit_notify(ted, hints->edit_notify);
+	free(hints);
+	ted->inlay_hints = NULL;
+}
+
+static InlayHintsDocument *inlay_hints_get_document(Ted *ted, TextBuffer *buffer) {
+	InlayHints *hints = ted->inlay_hints;
+	arr_foreach_ptr(hints->documents, InlayHintsDocument, doc) {
+		if (doc->buffer == buffer)
+			return doc;
+	}
+	return NULL;
+}
+
+static void inlay_hints_remove_document(Ted *ted, InlayHintsDocument *doc) {
+	InlayHints *hints = ted->inlay_hints;
+	inlay_hints_document_free(ted, doc);
+	arr_remove(hints->documents, (u32)(doc - hints->documents));
+}
+
+/// lines we want hints for: the ones on screen, plus a screenful above and below.
+static void inlay_hints_wanted_range(TextBuffer *buffer, u32 *first, u32 *last) {
+	u32 first_on_screen = buffer_first_line_on_screen(buffer);
+	u32 last_on_screen = buffer_last_line_on_screen(buffer);
+	u32 margin = last_on_screen - first_on_screen + 1;
+	*first = first_on_screen > margin ? first_on_screen - margin : 0;
+	*last = last_on_screen + margin;
+	u32 nlines = buffer_line_count(buffer);
+	if (*last >= nlines) *last = nlines - 1;
+}
+
+/// do we have current hints for all the lines on screen?
+static bool inlay_hints_up_to_date(const InlayHintsDocument *doc) {
+	return doc->have_range && doc->range_edit_count == doc->edit_count
+		&& doc->range_first <= buffer_first_line_on_screen(doc->buffer)
+		&& doc->range_last >= buffer_last_line_on_screen(doc->buffer);
+}
+
+static void inlay_hints_update_buffer(Ted *ted, TextBuffer *buffer) {
+	InlayHints *hints = ted->inlay_hints;
+	InlayHintsDocument *doc = inlay_hints_get_document(ted, buffer);
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp || !buffer_settings(buffer)->inlay_hints) {
+		if (doc) {
+			inlay_hints_remove_document(ted, doc);
+			buffer_clear_inlay_hints(buffer);
+		}
+		return;
+	}
+	if (!lsp_is_initialized(lsp))
+		return;
+
+	LSPDocumentID document = buffer_lsp_document_id(buffer);
+	if (doc && (doc->lsp != lsp_get_id(lsp) || doc->document != document)) {
+		// different server/file -- start over
+		inlay_hints_remove_document(ted, doc);
+		buffer_clear_inlay_hints(buffer);
+		doc = NULL;
+	}
+	u32 first = 0, last = 0;
+	inlay_hints_wanted_range(buffer, &first, &last);
+	if (!doc) {
+		doc = arr_addp(hints->documents);
+		if (!doc) return;
+		doc->buffer = buffer;
+		doc->lsp = lsp_get_id(lsp);
+		doc->document = document;
+		doc->wanted_first = first;
+		doc->wanted_last = last;
+	}
+	if (doc->unsupported)
+		return;
+
+	if (first != doc->wanted_first || last != doc->wanted_last) {
+		// scrolled -- wait for it to stop
+		doc->wanted_first = first;
+		doc->wanted_last = last;
+		doc->next_request_time = maxd(doc->next_request_time, ted->frame_time + INLAY_HINTS_DEBOUNCE);
+	}
+	if (inlay_hints_up_to_date(doc))
+		return;
+	if (doc->request.id && doc->request_edit_count == doc->edit_count
+		&& doc->request_first <= first && doc->request_last >= last)
+		return; // we've already asked for this
+	if (ted->frame_time < doc->next_request_time)
+		return;
+
+	// if the last request hasn't been sent yet, this drops it from the queue,
+	// so scrolling/typing quickly won't flood the server.
+	ted_cancel_lsp_request(ted, &doc->request);
+	LSPRequest request = {.type = LSP_REQUEST_INLAY_HINT};
+	LSPRequestInlayHint *req = &request.data.inlay_hint;
+	req->document = document;
+	req->range.start = (LSPPosition){.line = first, .character = 0};
+	req->range.end = buffer_pos_to_lsp_position(buffer,
+		(BufferPos){.line = last, .index = buffer_line_len(buffer, last)});
+	doc->request = lsp_send_request(lsp, &request);
+	if (!doc->request.id) {
+		doc->unsupported = true;
+		return;
+	}
+	doc->request_edit_count = doc->edit_count;
+	doc->request_first = first;
+	doc->request_last = last;
+	doc->next_request_time = ted->frame_time + INLAY_HINTS_DEBOUNCE;
+}
+
+void inlay_hints_frame(Ted *ted) {
+	InlayHints *hints = ted->inlay_hints;
+	// forget about closed buffers
+	for (u32 i = 0; i < arr_len(hints->documents); ) {
+		InlayHintsDocument *doc = &hints->documents[i];
+		if (!ted_is_regular_buffer(ted, doc->buffer)) {
+			inlay_hints_remove_document(ted, doc);
+		} else {
+			++i;
+		}
+	}
+
+	// only buffers which are on screen get updated
+	arr_foreach_ptr(ted->nodes, NodePtr, pnode) {
+		Node *node = *pnode;
+		TextBuffer *buffer = node_get_tab(node, node_active_tab(node));
+		if (buffer)
+			inlay_hints_update_buffer(ted, buffer);
+	}
+}
+
+double inlay_hints_next_update_time(Ted *ted) {
+	InlayHints *hints = ted->inlay_hints;
+	double t = INFINITY;
+	arr_foreach_ptr(hints->documents, const InlayHintsDocument, doc) {
+		if (doc->unsupported)
+			continue;
+		if (!inlay_hints_up_to_date(doc) && (!doc->request.id || doc->request_edit_count != doc->edit_count))
+			t = mind(t, doc->next_request_time);
+	}
+	return t;
+}
+
+void inlay_hints_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	InlayHints *hints = ted->inlay_hints;
+	const LSPRequest *request = &response->request;
+	if (request->type != LSP_REQUEST_INLAY_HINT)
+		return;
+	InlayHintsDocument *doc = NULL;
+	arr_foreach_ptr(hints->documents, InlayHintsDocument, d) {
+		if (request->id == d->request.id) {
+			doc = d;
+			break;
+		}
+	}
+	if (!doc) return; // request was cancelled
+	doc->request.id = 0;
+	if (!lsp_string_is_empty(response->error)) {
+		doc->next_request_time = ted->frame_time + INLAY_HINTS_RETRY;
+		return;
+	}
+	if (doc->request_edit_count != doc->edit_count) {
+		// positions are out of date -- the hints we have now have been moved
+		// along with the edits, so they're better than these ones.
+		return;
+	}
+
+	const LSPResponseInlayHint *r = &response->data.inlay_hint;
+	InlayHint *buffer_hints = NULL;
+	char **labels = NULL;
+	arr_foreach_ptr(r->hints, const LSPInlayHint, hint) {
+		const char *label = lsp_response_string(response, hint->label);
+		char *s = a_sprintf("%s%s%s", hint->padding_left ? " " : "", label,
+			hint->padding_right ? " " : "");
+		arr_add(labels, s);
+		InlayHint *h = arr_addp(buffer_hints);
+		if (h) {
+			h->pos = hint->position;
+			h->label = s;
+		}
+	}
+	buffer_set_inlay_hints(doc->buffer, doc->request_first, doc->request_last,
+		buffer_hints, arr_len(buffer_hints));
+	arr_foreach_ptr(labels, char *, s) {
+		free(*s);
+	}
+	arr_free(labels);
+	arr_free(buffer_hints);
+	doc->range_first = doc->request_first;
+	doc->range_last = doc->request_last;
+	doc->range_edit_count = doc->request_edit_count;
+	doc->have_range = true;
+}
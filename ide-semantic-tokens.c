@@ -0,0 +1,405 @@
+// LSP semantic tokens
+// we ask the server for the tokens in the visible part of the buffer first (if it supports range requests),
+// then for the whole document, and after that only for what changed (if it supports delta requests).
+// the tokens are stored in the buffer's lines, which are shifted around as the buffer is edited,
+// so the colors stay (mostly) right while we wait for the server.
+
+#include "ted-internal.h"
+
+/// wait this long after the last edit before asking for new tokens
+#define SEMANTIC_TOKENS_DEBOUNCE 0.25
+/// wait this long before trying again after an error
+#define SEMANTIC_TOKENS_RETRY 1.0
+/// give up on requests which take longer than this
+#define SEMANTIC_TOKENS_TIMEOUT 10.0
+
+typedef struct {
+	TextBuffer *buffer;
+	LSPID lsp;
+	LSPDocumentID document;
+	/// `resultId` of the last full/delta response (NULL if we don't have one)
+	char *result_id;
+	/// dynamic array of integers from the last full/delta response, in the server's format.
+	///
+	/// we need to keep this around to apply delta responses to it.
+	u32 *data;
+	/// full or delta request
+	LSPServerRequestID full_request;
+	LSPServerRequestID range_request;
+	/// time when \ref full_request was sent
+	double full_request_time;
+	/// value of \ref edit_count when \ref full_request was sent
+	u32 full_request_edit_count;
+	/// value of \ref edit_count when \ref range_request was sent
+	u32 range_request_edit_count;
+	/// lines which \ref range_request is for
+	u32 range_first_line, range_last_line;
+	/// number of edits made to the buffer
+	u32 edit_count;
+	/// has the buffer been changed since the last request?
+	bool dirty;
+	/// don't send any requests before this time
+	double next_request_time;
+	/// have we sent any requests for this document?
+	bool requested;
+	/// have we gotten tokens for the whole document?
+	bool have_full;
+	/// the server only supports range requests
+	bool range_only;
+	/// the server doesn't support semantic tokens at all
+	bool unsupported;
+} SemanticTokensDocument;
+
+struct SemanticTokens {
+	EditNotifyID edit_notify;
+	/// dynamic array
+	SemanticTokensDocument *documents;
+};
+
+static void semantic_tokens_edit_notify(void *context, TextBuffer *buffer, const EditInfo *info) {
+	(void)info;
+	Ted *ted = context;
+	SemanticTokens *st = ted->semantic_tokens;
+	arr_foreach_ptr(st->documents, SemanticTokensDocument, doc) {
+		if (doc->buffer == buffer) {
+			doc->dirty = true;
+			++doc->edit_count;
+			doc->next_request_time = ted->frame_time + SEMANTIC_TOKENS_DEBOUNCE;
+		}
+	}
+}
+
+void semantic_tokens_init(Ted *ted) {
+	ted->semantic_tokens = calloc(1, sizeof *ted->semantic_tokens);
+	ted->semantic_tokens->edit_notify = ted_add_edit_notify(ted, semantic_tokens_edit_notify, ted);
+}
+
+static void semantic_tokens_document_free(Ted *ted, SemanticTokensDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->full_request);
+	ted_cancel_lsp_request(ted, &doc->range_request);
+	free(doc->result_id);
+	arr_free(doc->data);
+	memset(doc, 0, sizeof *doc);
+}
+
+void semantic_tokens_quit(Ted *ted) {
+	SemanticTokens *st = ted->semantic_tokens;
+	arr_foreach_ptr(st->documents, SemanticTokensDocument, doc) {
+		semantic_tokens_document_free(ted, doc);
+	}
+	arr_free(st->documents);
+	ted_remove_edit_notify(ted, st->edit_notify);
+	free(st);
+	ted->semantic_tokens = NULL;
+}
+
+/// which color to use for a token type.
+/// returns false for types which we don't color specially (e.g. variables).
+static bool semantic_token_type_to_syntax(LSPSemanticTokenType type, SyntaxCharType *syntax) {
+	switch (type) {
+	case LSP_SEMANTIC_TOKEN_KEYWORD:
+	case LSP_SEMANTIC_TOKEN_MODIFIER:
+		*syntax = SYNTAX_KEYWORD;
+		return true;
+	case LSP_SEMANTIC_TOKEN_NAMESPACE:
+	case LSP_SEMANTIC_TOKEN_TYPE:
+	case LSP_SEMANTIC_TOKEN_CLASS:
+	case LSP_SEMANTIC_TOKEN_ENUM:
+	case LSP_SEMANTIC_TOKEN_INTERFACE:
+	case LSP_SEMANTIC_TOKEN_STRUCT:
+	case LSP_SEMANTIC_TOKEN_TYPE_PARAMETER:
+		*syntax = SYNTAX_BUILTIN;
+		return true;
+	case LSP_SEMANTIC_TOKEN_ENUM_MEMBER:
+	case LSP_SEMANTIC_TOKEN_NUMBER:
+		*syntax = SYNTAX_CONSTANT;
+		return true;
+	case LSP_SEMANTIC_TOKEN_COMMENT:
+		*syntax = SYNTAX_COMMENT;
+		return true;
+	case LSP_SEMANTIC_TOKEN_STRING:
+	case LSP_SEMANTIC_TOKEN_REGEXP:
+		*syntax = SYNTAX_STRING;
+		return true;
+	case LSP_SEMANTIC_TOKEN_MACRO:
+		*syntax = SYNTAX_PREPROCESSOR;
+		return true;
+	case LSP_SEMANTIC_TOKEN_OTHER:
+	case LSP_SEMANTIC_TOKEN_PARAMETER:
+	case LSP_SEMANTIC_TOKEN_VARIABLE:
+	case LSP_SEMANTIC_TOKEN_PROPERTY:
+	case LSP_SEMANTIC_TOKEN_EVENT:
+	case LSP_SEMANTIC_TOKEN_FUNCTION:
+	case LSP_SEMANTIC_TOKEN_METHOD:
+	case LSP_SEMANTIC_TOKEN_OPERATOR:
+	case LSP_SEMANTIC_TOKEN_DECORATOR:
+		break;
+	}
+	return false;
+}
+
+/// give the tokens in `data` to the buffer
+static void semantic_tokens_apply(LSP *lsp, TextBuffer *buffer, const u32 *data, u32 first_line, u32 last_line) {
+	SemanticToken *tokens = NULL;
+	u32 line = 0, character = 0;
+	for (u32 i = 0; i + 5 <= arr_len(data); i += 5) {
+		// tokens are encoded relative to the previous one
+		const u32 delta_line = data[i], delta_start = data[i+1];
+		line += delta_line;
+		character = delta_line ? delta_start : character + delta_start;
+		SyntaxCharType type = 0;
+		if (!semantic_token_type_to_syntax(lsp_semantic_token_type(lsp, data[i+3]), &type))
+			continue;
+		SemanticToken token = {
+			.pos = {.line = line, .character = character},
+			.len = data[i+2],
+			.type = type,
+		};
+		arr_add(tokens, token);
+	}
+	buffer_set_semantic_tokens(buffer, first_line, last_line, tokens, arr_len(tokens));
+	arr_free(tokens);
+}
+
+static int semantic_tokens_edit_cmp(const void *av, const void *bv) {
+	const LSPSemanticTokensEdit *a = av, *b = bv;
+	// sort by start, descending
+	if (a->start > b->start) return -1;
+	if (a->start < b->start) return 1;
+	return 0;
+}
+
+/// apply a delta response to `doc->data`
+static void semantic_tokens_apply_edits(SemanticTokensDocument *doc, const LSPResponseSemanticTokens *response) {
+	LSPSemanticTokensEdit *edits = arr_copy(response->edits);
+	// go from back to front so that the indices of the remaining edits aren't affected
+	arr_qsort(edits, semantic_tokens_edit_cmp);
+	arr_foreach_ptr(edits, const LSPSemanticTokensEdit, edit) {
+		u32 len = arr_len(doc->data);
+		u32 start = min_u32(edit->start, len);
+		u32 delete_count = min_u32(edit->delete_count, len - start);
+		if (delete_count)
+			arr_remove_multiple(doc->data, start, delete_count);
+		if (edit->data_len) {
+			arr_insert_multiple(doc->data, start, edit->data_len);
+			if (doc->data)
+				memcpy(&doc->data[start], &response->data[edit->data_start], edit->data_len * sizeof *doc->data);
+		}
+	}
+	arr_free(edits);
+}
+
+static SemanticTokensDocument *semantic_tokens_get_document(Ted *ted, TextBuffer *buffer) {
+	SemanticTokens *st = ted->semantic_tokens;
+	arr_foreach_ptr(st->documents, SemanticTokensDocument, doc) {
+		if (doc->buffer == buffer)
+			return doc;
+	}
+	return NULL;
+}
+
+static void semantic_tokens_remove_document(Ted *ted, SemanticTokensDocument *doc) {
+	SemanticTokens *st = ted->semantic_tokens;
+	semantic_tokens_document_free(ted, doc);
+	arr_remove(st->documents, (u32)(doc - st->documents));
+}
+
+/// send a range request for the lines on screen
+static void semantic_tokens_send_range_request(Ted *ted, LSP *lsp, SemanticTokensDocument *doc) {
+	TextBuffer *buffer = doc->buffer;
+	u32 first_line = buffer_first_line_on_screen(buffer);
+	u32 last_line = buffer_last_line_on_screen(buffer);
+	ted_cancel_lsp_request(ted, &doc->range_request);
+	LSPRequest request = {.type = LSP_REQUEST_SEMANTIC_TOKENS_RANGE};
+	LSPRequestSemanticTokens *req = &request.data.semantic_tokens;
+	req->document = doc->document;
+	req->range.start = (LSPPosition){.line = first_line, .character = 0};
+	req->range.end = buffer_pos_to_lsp_position(buffer,
+		(BufferPos){.line = last_line, .index = buffer_line_len(buffer, last_line)});
+	doc->range_request = lsp_send_request(lsp, &request);
+	doc->range_request_edit_count = doc->edit_count;
+	doc->range_first_line = first_line;
+	doc->range_last_line = last_line;
+}
+
+/// send a full or delta request. returns false if the server doesn't support either.
+static bool semantic_tokens_send_full_request(Ted *ted, LSP *lsp, SemanticTokensDocument *doc) {
+	ted_cancel_lsp_request(ted, &doc->full_request);
+	if (doc->result_id) {
+		LSPRequest request = {.type = LSP_REQUEST_SEMANTIC_TOKENS_DELTA};
+		LSPRequestSemanticTokens *req = &request.data.semantic_tokens;
+		req->document = doc->document;
+		req->previous_result_id = lsp_request_add_string(&request, doc->result_id);
+		doc->full_request = lsp_send_request(lsp, &request);
+	}
+	if (!doc->full_request.id) {
+		LSPRequest request = {.type = LSP_REQUEST_SEMANTIC_TOKENS};
+		request.data.semantic_tokens.document = doc->document;
+		doc->full_request = lsp_send_request(lsp, &request);
+	}
+	doc->full_request_time = ted->frame_time;
+	doc->full_request_edit_count = doc->edit_count;
+	return doc->full_request.id != 0;
+}
+
+static void semantic_tokens_update_buffer(Ted *ted, TextBuffer *buffer) {
+	SemanticTokens *st = ted->semantic_tokens;
+	SemanticTokensDocument *doc = semantic_tokens_get_document(ted, buffer);
+	LSP *lsp = buffer_lsp(buffer);
+	if (!lsp || !buffer_settings(buffer)->semantic_tokens) {
+		if (doc) {
+			semantic_tokens_remove_document(ted, doc);
+			buffer_clear_semantic_tokens(buffer);
+		}
+		return;
+	}
+	if (!lsp_is_initialized(lsp))
+		return;
+
+	LSPDocumentID document = buffer_lsp_document_id(buffer);
+	if (doc && (doc->lsp != lsp_get_id(lsp) || doc->document != document
+		|| (doc->requested && !doc->unsupported && !doc->range_request.id && !doc->full_request.id
+			&& !doc->dirty && !buffer_has_semantic_tokens(buffer)))) {
+		// different server/file, or the buffer was reloaded -- start over
+		semantic_tokens_remove_document(ted, doc);
+		buffer_clear_semantic_tokens(buffer);
+		doc = NULL;
+	}
+	if (!doc) {
+		doc = arr_addp(st->documents);
+		if (!doc) return;
+		doc->buffer = buffer;
+		doc->lsp = lsp_get_id(lsp);
+		doc->document = document;
+	}
+	if (doc->unsupported)
+		return;
+
+	if (doc->full_request.id && ted->frame_time - doc->full_request_time > SEMANTIC_TOKENS_TIMEOUT) {
+		// server is taking too long -- ask again
+		ted_cancel_lsp_request(ted, &doc->full_request);
+		doc->dirty = true;
+	}
+
+	if (!doc->requested) {
+		// get the visible part of the file quickly, then the rest of it.
+		semantic_tokens_send_range_request(ted, lsp, doc);
+		if (!semantic_tokens_send_full_request(ted, lsp, doc)) {
+			doc->range_only = true;
+			if (!doc->range_request.id)
+				doc->unsupported = true;
+		}
+		doc->requested = true;
+		doc->dirty = false;
+		return;
+	}
+
+	if (doc->range_only) {
+		bool scrolled = buffer_first_line_on_screen(buffer) != doc->range_first_line
+			|| buffer_last_line_on_screen(buffer) != doc->range_last_line;
+		if (!doc->range_request.id && (scrolled || doc->dirty)
+			&& ted->frame_time >= doc->next_request_time) {
+			semantic_tokens_send_range_request(ted, lsp, doc);
+			doc->dirty = false;
+		}
+	} else if (doc->dirty && !doc->full_request.id && ted->frame_time >= doc->next_request_time) {
+		semantic_tokens_send_full_request(ted, lsp, doc);
+		doc->dirty = false;
+	}
+}
+
+void semantic_tokens_frame(Ted *ted) {
+	SemanticTokens *st = ted->semantic_tokens;
+	// forget about closed buffers
+	for (u32 i = 0; i < arr_len(st->documents); ) {
+		SemanticTokensDocument *doc = &st->documents[i];
+		if (!ted_is_regular_buffer(ted, doc->buffer)) {
+			semantic_tokens_remove_document(ted, doc);
+		} else {
+			++i;
+		}
+	}
+
+	// only buffers which are on screen get updated
+	arr_foreach_ptr(ted->nodes, NodePtr, pnode) {
+		Node *node = *pnode;
+		TextBuffer *buffer = node_get_tab(node, node_active_tab(node));
+		if (buffer)
+			semantic_tokens_update_buffer(ted, buffer);
+	}
+}
+
+double semantic_tokens_next_update_time(Ted *ted) {
+	SemanticTokens *st = ted->semantic_tokens;
+	double t = INFINITY;
+	arr_foreach_ptr(st->documents, const SemanticTokensDocument, doc) {
+		if (doc->dirty && !doc->full_request.id && !doc->range_request.id)
+			t = mind(t, doc->next_request_time);
+	}
+	return t;
+}
+
+void semantic_tokens_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	SemanticTokens *st = ted->semantic_tokens;
+	const LSPRequest *request = &response->request;
+	if (request->type != LSP_REQUEST_SEMANTIC_TOKENS
+		&& request->type != LSP_REQUEST_SEMANTIC_TOKENS_DELTA
+		&& request->type != LSP_REQUEST_SEMANTIC_TOKENS_RANGE)
+		return;
+	SemanticTokensDocument *doc = NULL;
+	arr_foreach_ptr(st->documents, SemanticTokensDocument, d) {
+		if (request->id == d->full_request.id || request->id == d->range_request.id) {
+			doc = d;
+			break;
+		}
+	}
+	if (!doc) return; // request was cancelled
+	LSP *lsp = ted_get_lsp_by_id(ted, doc->lsp);
+	TextBuffer *buffer = doc->buffer;
+	const bool is_range = request->id == doc->range_request.id;
+	if (is_range)
+		doc->range_request.id = 0;
+	else
+		doc->full_request.id = 0;
+
+	if (!lsp_string_is_empty(response->error)) {
+		if (request->type == LSP_REQUEST_SEMANTIC_TOKENS_DELTA) {
+			// maybe the server forgot about our previous result. get everything next time.
+			free(doc->result_id);
+			doc->result_id = NULL;
+		}
+		doc->dirty = true;
+		doc->next_request_time = ted->frame_time + SEMANTIC_TOKENS_RETRY;
+		return;
+	}
+	if (!lsp) return;
+
+	const LSPResponseSemanticTokens *tokens = &response->data.semantic_tokens;
+	if (is_range) {
+		if (doc->range_request_edit_count != doc->edit_count)
+			return; // out of date
+		if (doc->have_full && doc->full_request_edit_count == doc->range_request_edit_count)
+			return; // we already have these tokens from a full response
+		semantic_tokens_apply(lsp, buffer, tokens->data, doc->range_first_line, doc->range_last_line);
+		return;
+	}
+
+	if (tokens->is_delta) {
+		semantic_tokens_apply_edits(doc, tokens);
+	} else {
+		arr_free(doc->data);
+		doc->data = arr_copy(tokens->data);
+	}
+	free(doc->result_id);
+	const char *result_id = lsp_response_string(response, tokens->result_id);
+	doc->result_id = *result_id ? str_dup(result_id) : NULL;
+
+	if (doc->full_request_edit_count != doc->edit_count) {
+		// the buffer was edited while we were waiting.
+		// the data is still needed for the next delta, but the positions are wrong now.
+		doc->dirty = true;
+		return;
+	}
+	semantic_tokens_apply(lsp, buffer, doc->data, 0, U32_MAX);
+	doc->have_full = true;
+}
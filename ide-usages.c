@@ -1,9 +1,16 @@
 // find usages of symbol
+// results are shown in the build buffer, one line per usage, sorted by path and
+// then line number. servers can send them a batch at a time (with $/progress),
+// in which case each batch is merged into what's already there.
 
 #include "ted-internal.h"
 struct Usages {
 	LSPServerRequestID last_request;
 	double last_request_time;
+	/// usages gotten so far for `last_request`.
+	/// sorted with \ref lsp_references_location_cmp.
+	/// `locations[i]` is on line `i` of the build buffer.
+	LSPLocation *locations;
 };
 
 void usages_init(Ted *ted) {
@@ -11,6 +18,7 @@ void usages_init(Ted *ted) {
 }
 
 void usages_quit(Ted *ted) {
+	arr_free(ted->usages->locations);
 	free(ted->usages);
 	ted->usages = NULL;
 }
@@ -18,6 +26,7 @@ void usages_quit(Ted *ted) {
 void usages_cancel_lookup(Ted *ted) {
 	Usages *usages = ted->usages;
 	ted_cancel_lsp_request(ted, &usages->last_request);
+	arr_clear(usages->locations);
 }
 
 void usages_find(Ted *ted) {
@@ -37,104 +46,172 @@ void usages_find(Ted *ted) {
 	usages->last_request_time = ted->frame_time;
 }
 
-
-void usages_process_lsp_response(Ted *ted, const LSPResponse *response) {
+/// add `locations` (which must be sorted) to the build buffer.
+/// returns a dynamic array of the build buffer lines they ended up on.
+static u32 *usages_add_locations(Ted *ted, LSP *lsp, const LSPLocation *locations) {
 	Usages *usages = ted->usages;
-	if (response->request.type != LSP_REQUEST_REFERENCES)
-		return; // not for us
-	if (response->request.id != usages->last_request.id)
-		return;
-	LSP *lsp = ted_get_lsp_by_id(ted, usages->last_request.lsp);
-	const LSPResponseReferences *refs = &response->data.references;
-	if (lsp && arr_len(refs->locations)) { 
-		TextBuffer *buffer = ted->build_buffer;
-		build_setup_buffer(ted);
-		ted->build_shown = true;
-		char last_path[TED_PATH_MAX] = {0};
-		TextBuffer *last_buffer = NULL;
-		FILE *last_file = NULL;
-		u32 last_line = 0;
+	TextBuffer *buffer = ted->build_buffer;
+	const u32 nold = arr_len(usages->locations), nnew = arr_len(locations);
+	char last_path[TED_PATH_MAX] = {0};
+	TextBuffer *last_buffer = NULL;
+	FILE *last_file = NULL;
+	u32 last_line = 0;
+	// build buffer line for each of `locations`
+	char **texts = NULL;
+	
+	arr_foreach_ptr(locations, const LSPLocation, location) {
+		const char *path = lsp_document_path(lsp, location->document);
 		
-		arr_foreach_ptr(refs->locations, LSPLocation, location) {
-			const char *path = lsp_document_path(lsp, location->document);
-			
-			if (!paths_eq(path, last_path)) {
-				// it's a new file!
-				strbuf_cpy(last_path, path);
-				if (last_file) {
+		if (!paths_eq(path, last_path)) {
+			// it's a new file!
+			strbuf_cpy(last_path, path);
+			if (last_file) {
+				fclose(last_file);
+				last_file = NULL;
+			}
+			last_buffer = ted_get_buffer_with_file(ted, path);
+			if (!last_buffer) {
+				last_file = fopen(path, "rb");
+				last_line = 0;
+			}
+		}
+		
+		u32 line = location->range.start.line;
+		
+		char *line_text = NULL;
+		if (last_buffer) {
+			// read the line from the buffer
+			if (line < buffer_line_count(last_buffer)) {
+				line_text = buffer_get_line_utf8(last_buffer, line);
+			}
+		} else if (last_file) {
+			// read the line from the file
+			while (last_line < line) {
+				int c = getc(last_file);
+				if (c == '\n') ++last_line;
+				if (c == EOF) {
 					fclose(last_file);
 					last_file = NULL;
-				}
-				last_buffer = ted_get_buffer_with_file(ted, path);
-				if (!last_buffer) {
-					last_file = fopen(path, "rb");
-					last_line = 0;
+					break;
 				}
 			}
 			
-			u32 line = location->range.start.line;
-			
-			char *line_text = NULL;
-			if (last_buffer) {
-				// read the line from the buffer
-				if (line < buffer_line_count(last_buffer)) {
-					line_text = buffer_get_line_utf8(last_buffer, line);
-				}
-			} else if (last_file) {
-				// read the line from the file
-				while (last_line < line) {
+			line_text = calloc(1, 1024);
+			if (last_file && last_line == line) {
+				char *p = line_text;
+				for (u32 i = 0; i < 1023; ++i, ++p) {
 					int c = getc(last_file);
-					if (c == '\n') ++last_line;
+					if (c == '\n') {
+						++last_line;
+						break;
+					}
 					if (c == EOF) {
 						fclose(last_file);
 						last_file = NULL;
 						break;
 					}
-				}
-				
-				line_text = calloc(1, 1024);
-				if (last_file && last_line == line) {
-					char *p = line_text;
-					for (u32 i = 0; i < 1023; ++i, ++p) {
-						int c = getc(last_file);
-						if (c == '\n') {
-							++last_line;
-							break;
-						}
-						if (c == EOF) {
-							fclose(last_file);
-							last_file = NULL;
-							break;
-						}
-						line_text[i] = (char)c;
-					}
+					line_text[i] = (char)c;
 				}
 			}
-			
-			char text[1024];
-			strbuf_printf(text, "%s:%u: %s\n",
-				path,
-				line + 1,
-				line_text ? line_text + strspn(line_text, "\t ") : "");
-			free(line_text);
-			buffer_insert_utf8_at_cursor(buffer, text);
-			buffer_cursor_move_to_end_of_file(buffer);
 		}
-		if (last_file)
-			fclose(last_file);
-		buffer_set_view_only(buffer, true);
-		
-		// the build directory doesn't really matter since we're using absolute paths
-		// but might as well set it to something reasonable.
-		char *root = ted_get_root_dir(ted);
-		build_set_working_directory(ted, root);
-		free(root);
 		
-		build_check_for_errors(ted);
+		char text[1024];
+		strbuf_printf(text, "%s:%u: %s\n",
+			path,
+			line + 1,
+			line_text ? line_text + strspn(line_text, "\t ") : "");
+		free(line_text);
+		arr_add(texts, str_dup(text));
+	}
+	if (last_file)
+		fclose(last_file);
+	
+	u32 *new_lines = NULL;
+	StrBuilder text = str_builder_new();
+	buffer_set_view_only(buffer, false);
+	if (!nold || lsp_references_location_cmp(lsp, &usages->locations[nold - 1], &locations[0]) <= 0) {
+		// they all go at the end (servers usually send them in order, so this is the common case)
+		for (u32 i = 0; i < nnew; ++i) {
+			str_builder_append(&text, texts[i]);
+			arr_add(new_lines, nold + i);
+			arr_add(usages->locations, locations[i]);
+		}
+		buffer_insert_utf8_at_pos(buffer, (BufferPos){.line = nold, .index = 0}, text.str);
 	} else {
+		// merge them into what's already there and rewrite the buffer
+		LSPLocation *merged = NULL;
+		const u32 cursor_line = buffer_cursor_pos(buffer).line;
+		u32 new_cursor_line = 0;
+		u32 o = 0, n = 0;
+		while (o < nold || n < nnew) {
+			if (n < nnew && (o == nold || lsp_references_location_cmp(lsp, &locations[n], &usages->locations[o]) < 0)) {
+				str_builder_append(&text, texts[n]);
+				arr_add(new_lines, arr_len(merged));
+				arr_add(merged, locations[n]);
+				++n;
+			} else {
+				char *line = buffer_get_line_utf8(buffer, o);
+				str_builder_appendf(&text, "%s\n", line);
+				free(line);
+				if (o == cursor_line)
+					new_cursor_line = arr_len(merged);
+				arr_add(merged, usages->locations[o]);
+				++o;
+			}
+		}
+		arr_free(usages->locations);
+		usages->locations = merged;
+		buffer_delete_chars_between(buffer, buffer_pos_start_of_file(buffer), buffer_pos_end_of_file(buffer));
+		buffer_insert_utf8_at_pos(buffer, buffer_pos_start_of_file(buffer), text.str);
+		// keep the cursor on the same usage
+		buffer_cursor_move_to_pos(buffer, (BufferPos){.line = new_cursor_line, .index = 0});
+	}
+	buffer_set_view_only(buffer, true);
+	str_builder_free(&text);
+	arr_foreach_ptr(texts, char *, t)
+		free(*t);
+	arr_free(texts);
+	return new_lines;
+}
+
+void usages_process_lsp_response(Ted *ted, const LSPResponse *response) {
+	Usages *usages = ted->usages;
+	if (response->request.type != LSP_REQUEST_REFERENCES)
+		return; // not for us
+	if (response->request.id != usages->last_request.id)
+		return;
+	LSP *lsp = ted_get_lsp_by_id(ted, usages->last_request.lsp);
+	const LSPResponseReferences *refs = &response->data.references;
+	if (lsp && arr_len(refs->locations)) { 
+		if (!arr_len(usages->locations)) {
+			// first results
+			build_setup_buffer(ted);
+			ted->build_shown = true;
+			u32 *new_lines = usages_add_locations(ted, lsp, refs->locations);
+			arr_free(new_lines);
+			buffer_cursor_move_to_end_of_file(ted->build_buffer);
+			
+			// the build directory doesn't really matter since we're using absolute paths
+			// but might as well set it to something reasonable.
+			char *root = ted_get_root_dir(ted);
+			build_set_working_directory(ted, root);
+			free(root);
+			
+			build_check_for_errors(ted);
+		} else {
+			// more results -- don't move the cursor around,
+			// and only look for errors in the new lines
+			u32 *new_lines = usages_add_locations(ted, lsp, refs->locations);
+			build_lines_inserted(ted, new_lines, arr_len(new_lines));
+			arr_free(new_lines);
+		}
+	} else if (!response->partial && !arr_len(usages->locations)) {
 		ted_flash_error_cursor(ted);
 	}
-	usages->last_request.id = 0;
+	if (!response->partial) {
+		usages->last_request.id = 0;
+		arr_clear(usages->locations);
+	}
 }
 
 void usages_frame(Ted *ted) {
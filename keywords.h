@@ -2,466 +2,141 @@
 // This file was auto-generated by keywords.py
 typedef struct {
 	const char *str;
+	u8 len;
 	SyntaxCharType type;
 } Keyword;
 typedef struct {
+	/// keywords, in the order given by their hashes
 	const Keyword *keywords;
-	size_t len;
-} KeywordList;
-
-static const Keyword syntax_keywords_c_A[10] = {{"ATOMIC_ADDRESS_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR16_T_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR32_T_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_FLAG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_INT_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_LLONG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_LONG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_SHORT_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_WCHAR_T_LOCK_FREE", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_B[1] = {{"BUFSIZ", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_C[4] = {{"CHAR_BIT", SYNTAX_CONSTANT},{"CHAR_MAX", SYNTAX_CONSTANT},{"CHAR_MIN", SYNTAX_CONSTANT},{"CLOCKS_PER_SEC", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_D[11] = {{"DBL_DIG", SYNTAX_CONSTANT},{"DBL_EPSILON", SYNTAX_CONSTANT},{"DBL_HAS_SUBNORM", SYNTAX_CONSTANT},{"DBL_MANT_DIG", SYNTAX_CONSTANT},{"DBL_MAX", SYNTAX_CONSTANT},{"DBL_MAX_10_EXP", SYNTAX_CONSTANT},{"DBL_MAX_EXP", SYNTAX_CONSTANT},{"DBL_MIN", SYNTAX_CONSTANT},{"DBL_MIN_EXP", SYNTAX_CONSTANT},{"DBL_TRUE_MIN", SYNTAX_CONSTANT},{"DECIMAL_DIG", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_E[127] = {{"E2BIG", SYNTAX_CONSTANT},{"EACCES", SYNTAX_CONSTANT},{"EADDRINUSE", SYNTAX_CONSTANT},{"EADDRNOTAVAIL", SYNTAX_CONSTANT},{"EADV", SYNTAX_CONSTANT},{"EAFNOSUPPORT", SYNTAX_CONSTANT},{"EAGAIN", SYNTAX_CONSTANT},{"EALREADY", SYNTAX_CONSTANT},{"EBADE", SYNTAX_CONSTANT},{"EBADF", SYNTAX_CONSTANT},{"EBADFD", SYNTAX_CONSTANT},{"EBADMSG", SYNTAX_CONSTANT},{"EBADR", SYNTAX_CONSTANT},{"EBADRQC", SYNTAX_CONSTANT},{"EBADSLT", SYNTAX_CONSTANT},{"EBFONT", SYNTAX_CONSTANT},{"EBUSY", SYNTAX_CONSTANT},{"ECHILD", SYNTAX_CONSTANT},{"ECHRNG", SYNTAX_CONSTANT},{"ECOMM", SYNTAX_CONSTANT},{"ECONNABORTED", SYNTAX_CONSTANT},{"ECONNREFUSED", SYNTAX_CONSTANT},{"ECONNRESET", SYNTAX_CONSTANT},{"EDEADLK", SYNTAX_CONSTANT},{"EDEADLOCK", SYNTAX_CONSTANT},{"EDESTADDRREQ", SYNTAX_CONSTANT},{"EDOM", SYNTAX_CONSTANT},{"EDOTDOT", SYNTAX_CONSTANT},{"EDQUOT", SYNTAX_CONSTANT},{"EEXIST", SYNTAX_CONSTANT},{"EFAULT", SYNTAX_CONSTANT},{"EFBIG", SYNTAX_CONSTANT},{"EHOSTDOWN", SYNTAX_CONSTANT},{"EHOSTUNREACH", SYNTAX_CONSTANT},{"EIDRM", SYNTAX_CONSTANT},{"EILSEQ", SYNTAX_CONSTANT},{"EINPROGRESS", SYNTAX_CONSTANT},{"EINTR", SYNTAX_CONSTANT},{"EINVAL", SYNTAX_CONSTANT},{"EIO", SYNTAX_CONSTANT},{"EISCONN", SYNTAX_CONSTANT},{"EISDIR", SYNTAX_CONSTANT},{"EISNAM", SYNTAX_CONSTANT},{"EL2HLT", SYNTAX_CONSTANT},{"EL2NSYNC", SYNTAX_CONSTANT},{"EL3HLT", SYNTAX_CONSTANT},{"EL3RST", SYNTAX_CONSTANT},{"ELIBACC", SYNTAX_CONSTANT},{"ELIBBAD", SYNTAX_CONSTANT},{"ELIBEXEC", SYNTAX_CONSTANT},{"ELIBMAX", SYNTAX_CONSTANT},{"ELIBSCN", SYNTAX_CONSTANT},{"ELNRNG", SYNTAX_CONSTANT},{"ELOOP", SYNTAX_CONSTANT},{"EMEDIUMTYPE", SYNTAX_CONSTANT},{"EMFILE", SYNTAX_CONSTANT},{"EMLINK", SYNTAX_CONSTANT},{"EMSGSIZE", SYNTAX_CONSTANT},{"EMULTIHOP", SYNTAX_CONSTANT},{"ENAMETOOLONG", SYNTAX_CONSTANT},{"ENAVAIL", SYNTAX_CONSTANT},{"ENETDOWN", SYNTAX_CONSTANT},{"ENETRESET", SYNTAX_CONSTANT},{"ENETUNREACH", SYNTAX_CONSTANT},{"ENFILE", SYNTAX_CONSTANT},{"ENOANO", SYNTAX_CONSTANT},{"ENOBUFS", SYNTAX_CONSTANT},{"ENOCSI", SYNTAX_CONSTANT},{"ENODATA", SYNTAX_CONSTANT},{"ENODEV", SYNTAX_CONSTANT},{"ENOENT", SYNTAX_CONSTANT},{"ENOEXEC", SYNTAX_CONSTANT},{"ENOLCK", SYNTAX_CONSTANT},{"ENOLINK", SYNTAX_CONSTANT},{"ENOMEDIUM", SYNTAX_CONSTANT},{"ENOMEM", SYNTAX_CONSTANT},{"ENOMSG", SYNTAX_CONSTANT},{"ENONET", SYNTAX_CONSTANT},{"ENOPKG", SYNTAX_CONSTANT},{"ENOPROTOOPT", SYNTAX_CONSTANT},{"ENOSPC", SYNTAX_CONSTANT},{"ENOSR", SYNTAX_CONSTANT},{"ENOSTR", SYNTAX_CONSTANT},{"ENOSYS", SYNTAX_CONSTANT},{"ENOTBLK", SYNTAX_CONSTANT},{"ENOTCONN", SYNTAX_CONSTANT},{"ENOTDIR", SYNTAX_CONSTANT},{"ENOTEMPTY", SYNTAX_CONSTANT},{"ENOTNAM", SYNTAX_CONSTANT},{"ENOTSOCK", SYNTAX_CONSTANT},{"ENOTTY", SYNTAX_CONSTANT},{"ENOTUNIQ", SYNTAX_CONSTANT},{"ENXIO", SYNTAX_CONSTANT},{"EOF", SYNTAX_CONSTANT},{"EOPNOTSUPP", SYNTAX_CONSTANT},{"EOVERFLOW", SYNTAX_CONSTANT},{"EPERM", SYNTAX_CONSTANT},{"EPFNOSUPPORT", SYNTAX_CONSTANT},{"EPIPE", SYNTAX_CONSTANT},{"EPROTO", SYNTAX_CONSTANT},{"EPROTONOSUPPORT", SYNTAX_CONSTANT},{"EPROTOTYPE", SYNTAX_CONSTANT},{"ERANGE", SYNTAX_CONSTANT},{"EREMCHG", SYNTAX_CONSTANT},{"EREMOTE", SYNTAX_CONSTANT},{"EREMOTEIO", SYNTAX_CONSTANT},{"ERESTART", SYNTAX_CONSTANT},{"EROFS", SYNTAX_CONSTANT},{"ESHUTDOWN", SYNTAX_CONSTANT},{"ESOCKTNOSUPPORT", SYNTAX_CONSTANT},{"ESPIPE", SYNTAX_CONSTANT},{"ESRCH", SYNTAX_CONSTANT},{"ESRMNT", SYNTAX_CONSTANT},{"ESTALE", SYNTAX_CONSTANT},{"ESTRPIPE", SYNTAX_CONSTANT},{"ETIME", SYNTAX_CONSTANT},{"ETIMEDOUT", SYNTAX_CONSTANT},{"ETOOMANYREFS", SYNTAX_CONSTANT},{"ETXTBSY", SYNTAX_CONSTANT},{"EUCLEAN", SYNTAX_CONSTANT},{"EUNATCH", SYNTAX_CONSTANT},{"EUSERS", SYNTAX_CONSTANT},{"EWOULDBLOCK", SYNTAX_CONSTANT},{"EXDEV", SYNTAX_CONSTANT},{"EXFULL", SYNTAX_CONSTANT},{"EXIT_FAILURE", SYNTAX_CONSTANT},{"EXIT_SUCCESS", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_F[38] = {{"FE_ALL_EXCEPT", SYNTAX_CONSTANT},{"FE_DFL_ENV", SYNTAX_CONSTANT},{"FE_DIVBYZERO", SYNTAX_CONSTANT},{"FE_DOWNWARD", SYNTAX_CONSTANT},{"FE_INEXACT", SYNTAX_CONSTANT},{"FE_INVALID", SYNTAX_CONSTANT},{"FE_OVERFLOW", SYNTAX_CONSTANT},{"FE_TONEAREST", SYNTAX_CONSTANT},{"FE_TOWARDZERO", SYNTAX_CONSTANT},{"FE_UNDERFLOW", SYNTAX_CONSTANT},{"FE_UPWARD", SYNTAX_CONSTANT},{"FILE", SYNTAX_BUILTIN},{"FILENAME_MAX", SYNTAX_CONSTANT},{"FLT_DECIMAL_DIG", SYNTAX_CONSTANT},{"FLT_DIG", SYNTAX_CONSTANT},{"FLT_EVAL_METHOD", SYNTAX_CONSTANT},{"FLT_HAS_SUBNORM", SYNTAX_CONSTANT},{"FLT_MANT_DIG", SYNTAX_CONSTANT},{"FLT_MAX", SYNTAX_CONSTANT},{"FLT_MAX_10_EXP", SYNTAX_CONSTANT},{"FLT_MAX_EXP", SYNTAX_CONSTANT},{"FLT_MIN", SYNTAX_CONSTANT},{"FLT_MIN_10_EXP", SYNTAX_CONSTANT},{"FLT_MIN_EXP", SYNTAX_CONSTANT},{"FLT_RADIX", SYNTAX_CONSTANT},{"FLT_ROUNDS", SYNTAX_CONSTANT},{"FLT_TRUE_MIN", SYNTAX_CONSTANT},{"FOPEN_MAX", SYNTAX_CONSTANT},{"FP_FAST_FMA", SYNTAX_CONSTANT},{"FP_FAST_FMAF", SYNTAX_CONSTANT},{"FP_FAST_FMAL", SYNTAX_CONSTANT},{"FP_ILOGB0", SYNTAX_CONSTANT},{"FP_ILOGBNAN", SYNTAX_CONSTANT},{"FP_INFINITE", SYNTAX_CONSTANT},{"FP_NAN", SYNTAX_CONSTANT},{"FP_NORMAL", SYNTAX_CONSTANT},{"FP_SUBNORMAL", SYNTAX_CONSTANT},{"FP_ZERO", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_H[3] = {{"HUGE_VAL", SYNTAX_CONSTANT},{"HUGE_VALF", SYNTAX_CONSTANT},{"HUGE_VALL", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_I[32] = {{"I", SYNTAX_CONSTANT},{"INFINITY", SYNTAX_CONSTANT},{"INT16_MAX", SYNTAX_CONSTANT},{"INT16_MIN", SYNTAX_CONSTANT},{"INT32_MAX", SYNTAX_CONSTANT},{"INT32_MIN", SYNTAX_CONSTANT},{"INT64_MAX", SYNTAX_CONSTANT},{"INT64_MIN", SYNTAX_CONSTANT},{"INT8_MAX", SYNTAX_CONSTANT},{"INT8_MIN", SYNTAX_CONSTANT},{"INTMAX_MAX", SYNTAX_CONSTANT},{"INTMAX_MIN", SYNTAX_CONSTANT},{"INTPTR_MAX", SYNTAX_CONSTANT},{"INTPTR_MIN", SYNTAX_CONSTANT},{"INT_FAST16_MAX", SYNTAX_CONSTANT},{"INT_FAST16_MIN", SYNTAX_CONSTANT},{"INT_FAST32_MAX", SYNTAX_CONSTANT},{"INT_FAST32_MIN", SYNTAX_CONSTANT},{"INT_FAST64_MAX", SYNTAX_CONSTANT},{"INT_FAST64_MIN", SYNTAX_CONSTANT},{"INT_FAST8_MAX", SYNTAX_CONSTANT},{"INT_FAST8_MIN", SYNTAX_CONSTANT},{"INT_LEAST16_MAX", SYNTAX_CONSTANT},{"INT_LEAST16_MIN", SYNTAX_CONSTANT},{"INT_LEAST32_MAX", SYNTAX_CONSTANT},{"INT_LEAST32_MIN", SYNTAX_CONSTANT},{"INT_LEAST64_MAX", SYNTAX_CONSTANT},{"INT_LEAST64_MIN", SYNTAX_CONSTANT},{"INT_LEAST8_MAX", SYNTAX_CONSTANT},{"INT_LEAST8_MIN", SYNTAX_CONSTANT},{"INT_MAX", SYNTAX_CONSTANT},{"INT_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_L[22] = {{"LC_ALL", SYNTAX_CONSTANT},{"LC_COLLATE", SYNTAX_CONSTANT},{"LC_CTYPE", SYNTAX_CONSTANT},{"LC_MONETARY", SYNTAX_CONSTANT},{"LC_NUMERIC", SYNTAX_CONSTANT},{"LC_TIME", SYNTAX_CONSTANT},{"LDBL_DECIMAL_DIG", SYNTAX_CONSTANT},{"LDBL_DIG", SYNTAX_CONSTANT},{"LDBL_EPSILON", SYNTAX_CONSTANT},{"LDBL_MANT_DIG", SYNTAX_CONSTANT},{"LDBL_MAX", SYNTAX_CONSTANT},{"LDBL_MAX_10_EXP", SYNTAX_CONSTANT},{"LDBL_MAX_EXP", SYNTAX_CONSTANT},{"LDBL_MIN", SYNTAX_CONSTANT},{"LDBL_MIN_10_EXP", SYNTAX_CONSTANT},{"LDBL_MIN_EXP", SYNTAX_CONSTANT},{"LDBL_TRUE_MIN", SYNTAX_CONSTANT},{"LLONG_MAX", SYNTAX_CONSTANT},{"LLONG_MIN", SYNTAX_CONSTANT},{"LONG_MAX", SYNTAX_CONSTANT},{"LONG_MIN", SYNTAX_CONSTANT},{"L_tmpnam", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_M[4] = {{"MATH_ERREXCEPT", SYNTAX_CONSTANT},{"MATH_ERRNO", SYNTAX_CONSTANT},{"MB_CUR_MAX", SYNTAX_CONSTANT},{"MB_LEN_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_N[3] = {{"NAN", SYNTAX_CONSTANT},{"NDEBUG", SYNTAX_CONSTANT},{"NULL", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_O[1] = {{"ONCE_FLAG_INIT", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_P[86] = {{"PRIX16", SYNTAX_CONSTANT},{"PRIX32", SYNTAX_CONSTANT},{"PRIX64", SYNTAX_CONSTANT},{"PRIX8", SYNTAX_CONSTANT},{"PRIXFAST16", SYNTAX_CONSTANT},{"PRIXFAST32", SYNTAX_CONSTANT},{"PRIXFAST64", SYNTAX_CONSTANT},{"PRIXFAST8", SYNTAX_CONSTANT},{"PRIXLEAST16", SYNTAX_CONSTANT},{"PRIXLEAST32", SYNTAX_CONSTANT},{"PRIXLEAST64", SYNTAX_CONSTANT},{"PRIXLEAST8", SYNTAX_CONSTANT},{"PRIXMAX", SYNTAX_CONSTANT},{"PRIXPTR", SYNTAX_CONSTANT},{"PRId16", SYNTAX_CONSTANT},{"PRId32", SYNTAX_CONSTANT},{"PRId64", SYNTAX_CONSTANT},{"PRId8", SYNTAX_CONSTANT},{"PRIdFAST16", SYNTAX_CONSTANT},{"PRIdFAST32", SYNTAX_CONSTANT},{"PRIdFAST64", SYNTAX_CONSTANT},{"PRIdFAST8", SYNTAX_CONSTANT},{"PRIdLEAST16", SYNTAX_CONSTANT},{"PRIdLEAST32", SYNTAX_CONSTANT},{"PRIdLEAST64", SYNTAX_CONSTANT},{"PRIdLEAST8", SYNTAX_CONSTANT},{"PRIdMAX", SYNTAX_CONSTANT},{"PRIdPTR", SYNTAX_CONSTANT},{"PRIi16", SYNTAX_CONSTANT},{"PRIi32", SYNTAX_CONSTANT},{"PRIi64", SYNTAX_CONSTANT},{"PRIi8", SYNTAX_CONSTANT},{"PRIiFAST16", SYNTAX_CONSTANT},{"PRIiFAST32", SYNTAX_CONSTANT},{"PRIiFAST64", SYNTAX_CONSTANT},{"PRIiFAST8", SYNTAX_CONSTANT},{"PRIiLEAST16", SYNTAX_CONSTANT},{"PRIiLEAST32", SYNTAX_CONSTANT},{"PRIiLEAST64", SYNTAX_CONSTANT},{"PRIiLEAST8", SYNTAX_CONSTANT},{"PRIiMAX", SYNTAX_CONSTANT},{"PRIiPTR", SYNTAX_CONSTANT},{"PRIo16", SYNTAX_CONSTANT},{"PRIo32", SYNTAX_CONSTANT},{"PRIo64", SYNTAX_CONSTANT},{"PRIo8", SYNTAX_CONSTANT},{"PRIoFAST16", SYNTAX_CONSTANT},{"PRIoFAST32", SYNTAX_CONSTANT},{"PRIoFAST64", SYNTAX_CONSTANT},{"PRIoFAST8", SYNTAX_CONSTANT},{"PRIoLEAST16", SYNTAX_CONSTANT},{"PRIoLEAST32", SYNTAX_CONSTANT},{"PRIoLEAST64", SYNTAX_CONSTANT},{"PRIoLEAST8", SYNTAX_CONSTANT},{"PRIoMAX", SYNTAX_CONSTANT},{"PRIoPTR", SYNTAX_CONSTANT},{"PRIu16", SYNTAX_CONSTANT},{"PRIu32", SYNTAX_CONSTANT},{"PRIu64", SYNTAX_CONSTANT},{"PRIu8", SYNTAX_CONSTANT},{"PRIuFAST16", SYNTAX_CONSTANT},{"PRIuFAST32", SYNTAX_CONSTANT},{"PRIuFAST64", SYNTAX_CONSTANT},{"PRIuFAST8", SYNTAX_CONSTANT},{"PRIuLEAST16", SYNTAX_CONSTANT},{"PRIuLEAST32", SYNTAX_CONSTANT},{"PRIuLEAST64", SYNTAX_CONSTANT},{"PRIuLEAST8", SYNTAX_CONSTANT},{"PRIuMAX", SYNTAX_CONSTANT},{"PRIuPTR", SYNTAX_CONSTANT},{"PRIx16", SYNTAX_CONSTANT},{"PRIx32", SYNTAX_CONSTANT},{"PRIx64", SYNTAX_CONSTANT},{"PRIx8", SYNTAX_CONSTANT},{"PRIxFAST16", SYNTAX_CONSTANT},{"PRIxFAST32", SYNTAX_CONSTANT},{"PRIxFAST64", SYNTAX_CONSTANT},{"PRIxFAST8", SYNTAX_CONSTANT},{"PRIxLEAST16", SYNTAX_CONSTANT},{"PRIxLEAST32", SYNTAX_CONSTANT},{"PRIxLEAST64", SYNTAX_CONSTANT},{"PRIxLEAST8", SYNTAX_CONSTANT},{"PRIxMAX", SYNTAX_CONSTANT},{"PRIxPTR", SYNTAX_CONSTANT},{"PTRDIFF_MAX", SYNTAX_CONSTANT},{"PTRDIFF_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_R[1] = {{"RSIZE_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_S[121] = {{"SCHAR_MAX", SYNTAX_CONSTANT},{"SCHAR_MIN", SYNTAX_CONSTANT},{"SCNd16", SYNTAX_CONSTANT},{"SCNd32", SYNTAX_CONSTANT},{"SCNd64", SYNTAX_CONSTANT},{"SCNd8", SYNTAX_CONSTANT},{"SCNdFAST16", SYNTAX_CONSTANT},{"SCNdFAST32", SYNTAX_CONSTANT},{"SCNdFAST64", SYNTAX_CONSTANT},{"SCNdFAST8", SYNTAX_CONSTANT},{"SCNdLEAST16", SYNTAX_CONSTANT},{"SCNdLEAST32", SYNTAX_CONSTANT},{"SCNdLEAST64", SYNTAX_CONSTANT},{"SCNdLEAST8", SYNTAX_CONSTANT},{"SCNdMAX", SYNTAX_CONSTANT},{"SCNdPTR", SYNTAX_CONSTANT},{"SCNi16", SYNTAX_CONSTANT},{"SCNi32", SYNTAX_CONSTANT},{"SCNi64", SYNTAX_CONSTANT},{"SCNi8", SYNTAX_CONSTANT},{"SCNiFAST16", SYNTAX_CONSTANT},{"SCNiFAST32", SYNTAX_CONSTANT},{"SCNiFAST64", SYNTAX_CONSTANT},{"SCNiFAST8", SYNTAX_CONSTANT},{"SCNiLEAST16", SYNTAX_CONSTANT},{"SCNiLEAST32", SYNTAX_CONSTANT},{"SCNiLEAST64", SYNTAX_CONSTANT},{"SCNiLEAST8", SYNTAX_CONSTANT},{"SCNiMAX", SYNTAX_CONSTANT},{"SCNiPTR", SYNTAX_CONSTANT},{"SCNo16", SYNTAX_CONSTANT},{"SCNo32", SYNTAX_CONSTANT},{"SCNo64", SYNTAX_CONSTANT},{"SCNo8", SYNTAX_CONSTANT},{"SCNoFAST16", SYNTAX_CONSTANT},{"SCNoFAST32", SYNTAX_CONSTANT},{"SCNoFAST64", SYNTAX_CONSTANT},{"SCNoFAST8", SYNTAX_CONSTANT},{"SCNoLEAST16", SYNTAX_CONSTANT},{"SCNoLEAST32", SYNTAX_CONSTANT},{"SCNoLEAST64", SYNTAX_CONSTANT},{"SCNoLEAST8", SYNTAX_CONSTANT},{"SCNoMAX", SYNTAX_CONSTANT},{"SCNoPTR", SYNTAX_CONSTANT},{"SCNu16", SYNTAX_CONSTANT},{"SCNu32", SYNTAX_CONSTANT},{"SCNu64", SYNTAX_CONSTANT},{"SCNu8", SYNTAX_CONSTANT},{"SCNuFAST16", SYNTAX_CONSTANT},{"SCNuFAST32", SYNTAX_CONSTANT},{"SCNuFAST64", SYNTAX_CONSTANT},{"SCNuFAST8", SYNTAX_CONSTANT},{"SCNuLEAST16", SYNTAX_CONSTANT},{"SCNuLEAST32", SYNTAX_CONSTANT},{"SCNuLEAST64", SYNTAX_CONSTANT},{"SCNuLEAST8", SYNTAX_CONSTANT},{"SCNuMAX", SYNTAX_CONSTANT},{"SCNuPTR", SYNTAX_CONSTANT},{"SCNx16", SYNTAX_CONSTANT},{"SCNx32", SYNTAX_CONSTANT},{"SCNx64", SYNTAX_CONSTANT},{"SCNx8", SYNTAX_CONSTANT},{"SCNxFAST16", SYNTAX_CONSTANT},{"SCNxFAST32", SYNTAX_CONSTANT},{"SCNxFAST64", SYNTAX_CONSTANT},{"SCNxFAST8", SYNTAX_CONSTANT},{"SCNxLEAST16", SYNTAX_CONSTANT},{"SCNxLEAST32", SYNTAX_CONSTANT},{"SCNxLEAST64", SYNTAX_CONSTANT},{"SCNxLEAST8", SYNTAX_CONSTANT},{"SCNxMAX", SYNTAX_CONSTANT},{"SCNxPTR", SYNTAX_CONSTANT},{"SEEK_CUR", SYNTAX_CONSTANT},{"SEEK_END", SYNTAX_CONSTANT},{"SEEK_SET", SYNTAX_CONSTANT},{"SHRT_MAX", SYNTAX_CONSTANT},{"SHRT_MIN", SYNTAX_CONSTANT},{"SIGABRT", SYNTAX_CONSTANT},{"SIGALRM", SYNTAX_CONSTANT},{"SIGBUS", SYNTAX_CONSTANT},{"SIGCHLD", SYNTAX_CONSTANT},{"SIGCLD", SYNTAX_CONSTANT},{"SIGCONT", SYNTAX_CONSTANT},{"SIGEMT", SYNTAX_CONSTANT},{"SIGFPE", SYNTAX_CONSTANT},{"SIGHUP", SYNTAX_CONSTANT},{"SIGILL", SYNTAX_CONSTANT},{"SIGINFO", SYNTAX_CONSTANT},{"SIGINT", SYNTAX_CONSTANT},{"SIGIO", SYNTAX_CONSTANT},{"SIGIOT", SYNTAX_CONSTANT},{"SIGKILL", SYNTAX_CONSTANT},{"SIGLOST", SYNTAX_CONSTANT},{"SIGPIPE", SYNTAX_CONSTANT},{"SIGPOLL", SYNTAX_CONSTANT},{"SIGPROF", SYNTAX_CONSTANT},{"SIGPWR", SYNTAX_CONSTANT},{"SIGQUIT", SYNTAX_CONSTANT},{"SIGSEGV", SYNTAX_CONSTANT},{"SIGSTKFLT", SYNTAX_CONSTANT},{"SIGSTOP", SYNTAX_CONSTANT},{"SIGSYS", SYNTAX_CONSTANT},{"SIGTERM", SYNTAX_CONSTANT},{"SIGTRAP", SYNTAX_CONSTANT},{"SIGTSTP", SYNTAX_CONSTANT},{"SIGTTIN", SYNTAX_CONSTANT},{"SIGTTOU", SYNTAX_CONSTANT},{"SIGUNUSED", SYNTAX_CONSTANT},{"SIGURG", SYNTAX_CONSTANT},{"SIGUSR1", SYNTAX_CONSTANT},{"SIGUSR2", SYNTAX_CONSTANT},{"SIGVTALRM", SYNTAX_CONSTANT},{"SIGWINCH", SYNTAX_CONSTANT},{"SIGXCPU", SYNTAX_CONSTANT},{"SIGXFSZ", SYNTAX_CONSTANT},{"SIG_ATOMIC_MAX", SYNTAX_CONSTANT},{"SIG_ATOMIC_MIN", SYNTAX_CONSTANT},{"SIG_DFL", SYNTAX_CONSTANT},{"SIG_ERR", SYNTAX_CONSTANT},{"SIG_IGN", SYNTAX_CONSTANT},{"SIZE_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_T[4] = {{"TIME_UTC", SYNTAX_CONSTANT},{"TMP_MAX", SYNTAX_CONSTANT},{"TMP_MAX_S", SYNTAX_CONSTANT},{"TSS_DTOR_ITERATIONS", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_U[19] = {{"UCHAR_MAX", SYNTAX_CONSTANT},{"UINT16_MAX", SYNTAX_CONSTANT},{"UINT32_MAX", SYNTAX_CONSTANT},{"UINT64_MAX", SYNTAX_CONSTANT},{"UINT8_MAX", SYNTAX_CONSTANT},{"UINTMAX_MAX", SYNTAX_CONSTANT},{"UINTPTR_MAX", SYNTAX_CONSTANT},{"UINT_FAST16_MAX", SYNTAX_CONSTANT},{"UINT_FAST32_MAX", SYNTAX_CONSTANT},{"UINT_FAST64_MAX", SYNTAX_CONSTANT},{"UINT_FAST8_MAX", SYNTAX_CONSTANT},{"UINT_LEAST16_MAX", SYNTAX_CONSTANT},{"UINT_LEAST32_MAX", SYNTAX_CONSTANT},{"UINT_LEAST64_MAX", SYNTAX_CONSTANT},{"UINT_LEAST8_MAX", SYNTAX_CONSTANT},{"UINT_MAX", SYNTAX_CONSTANT},{"ULLONG_MAX", SYNTAX_CONSTANT},{"ULONG_MAX", SYNTAX_CONSTANT},{"USHRT_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_W[5] = {{"WCHAR_MAX", SYNTAX_CONSTANT},{"WCHAR_MIN", SYNTAX_CONSTANT},{"WEOF", SYNTAX_CONSTANT},{"WINT_MAX", SYNTAX_CONSTANT},{"WINT_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_x5f[13] = {{"_Alignas", SYNTAX_KEYWORD},{"_Alignof", SYNTAX_KEYWORD},{"_Atomic", SYNTAX_KEYWORD},{"_Bool", SYNTAX_KEYWORD},{"_Complex", SYNTAX_KEYWORD},{"_Generic", SYNTAX_KEYWORD},{"_IOFBF", SYNTAX_CONSTANT},{"_IOLBF", SYNTAX_CONSTANT},{"_IONBF", SYNTAX_CONSTANT},{"_Imaginary", SYNTAX_KEYWORD},{"_Noreturn", SYNTAX_KEYWORD},{"_Static_assert", SYNTAX_KEYWORD},{"_Thread_local", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_a[42] = {{"alignas", SYNTAX_BUILTIN},{"alignof", SYNTAX_BUILTIN},{"atomic_address", SYNTAX_BUILTIN},{"atomic_bool", SYNTAX_BUILTIN},{"atomic_char", SYNTAX_BUILTIN},{"atomic_char16_t", SYNTAX_BUILTIN},{"atomic_char32_t", SYNTAX_BUILTIN},{"atomic_flag", SYNTAX_BUILTIN},{"atomic_int", SYNTAX_BUILTIN},{"atomic_int_fast16_t", SYNTAX_BUILTIN},{"atomic_int_fast32_t", SYNTAX_BUILTIN},{"atomic_int_fast64_t", SYNTAX_BUILTIN},{"atomic_int_fast8_t", SYNTAX_BUILTIN},{"atomic_int_least16_t", SYNTAX_BUILTIN},{"atomic_int_least32_t", SYNTAX_BUILTIN},{"atomic_int_least64_t", SYNTAX_BUILTIN},{"atomic_int_least8_t", SYNTAX_BUILTIN},{"atomic_intmax_t", SYNTAX_BUILTIN},{"atomic_intptr_t", SYNTAX_BUILTIN},{"atomic_llong", SYNTAX_BUILTIN},{"atomic_long", SYNTAX_BUILTIN},{"atomic_ptrdiff_t", SYNTAX_BUILTIN},{"atomic_schar", SYNTAX_BUILTIN},{"atomic_short", SYNTAX_BUILTIN},{"atomic_size_t", SYNTAX_BUILTIN},{"atomic_uchar", SYNTAX_BUILTIN},{"atomic_uint", SYNTAX_BUILTIN},{"atomic_uint_fast16_t", SYNTAX_BUILTIN},{"atomic_uint_fast32_t", SYNTAX_BUILTIN},{"atomic_uint_fast64_t", SYNTAX_BUILTIN},{"atomic_uint_fast8_t", SYNTAX_BUILTIN},{"atomic_uint_least16_t", SYNTAX_BUILTIN},{"atomic_uint_least32_t", SYNTAX_BUILTIN},{"atomic_uint_least64_t", SYNTAX_BUILTIN},{"atomic_uint_least8_t", SYNTAX_BUILTIN},{"atomic_uintmax_t", SYNTAX_BUILTIN},{"atomic_uintptr_t", SYNTAX_BUILTIN},{"atomic_ullong", SYNTAX_BUILTIN},{"atomic_ulong", SYNTAX_BUILTIN},{"atomic_ushort", SYNTAX_BUILTIN},{"atomic_wchar_t", SYNTAX_BUILTIN},{"auto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_b[5] = {{"blkcnt64_t", SYNTAX_BUILTIN},{"blkcnt_t", SYNTAX_BUILTIN},{"blksize_t", SYNTAX_BUILTIN},{"bool", SYNTAX_BUILTIN},{"break", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_c[12] = {{"caddr_t", SYNTAX_BUILTIN},{"case", SYNTAX_KEYWORD},{"char", SYNTAX_KEYWORD},{"char16_t", SYNTAX_BUILTIN},{"char32_t", SYNTAX_BUILTIN},{"char8_t", SYNTAX_BUILTIN},{"clock_t", SYNTAX_BUILTIN},{"cnd_t", SYNTAX_BUILTIN},{"complex", SYNTAX_BUILTIN},{"const", SYNTAX_KEYWORD},{"constraint_handler_t", SYNTAX_BUILTIN},{"continue", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_d[7] = {{"daddr_t", SYNTAX_BUILTIN},{"default", SYNTAX_KEYWORD},{"dev_t", SYNTAX_BUILTIN},{"div_t", SYNTAX_BUILTIN},{"do", SYNTAX_KEYWORD},{"double", SYNTAX_KEYWORD},{"double_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_e[4] = {{"else", SYNTAX_KEYWORD},{"enum", SYNTAX_KEYWORD},{"errno_t", SYNTAX_BUILTIN},{"extern", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_f[11] = {{"false", SYNTAX_CONSTANT},{"fenv_t", SYNTAX_BUILTIN},{"fexcept_t", SYNTAX_BUILTIN},{"float", SYNTAX_KEYWORD},{"float_t", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"fpos_t", SYNTAX_BUILTIN},{"fsblkcnt64_t", SYNTAX_BUILTIN},{"fsblkcnt_t", SYNTAX_BUILTIN},{"fsfilcnt64_t", SYNTAX_BUILTIN},{"fsfilcnt_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_g[2] = {{"gid_t", SYNTAX_BUILTIN},{"goto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_i[20] = {{"id_t", SYNTAX_BUILTIN},{"if", SYNTAX_KEYWORD},{"imaxdiv_t", SYNTAX_BUILTIN},{"inline", SYNTAX_KEYWORD},{"ino_t", SYNTAX_BUILTIN},{"int", SYNTAX_KEYWORD},{"int16_t", SYNTAX_BUILTIN},{"int32_t", SYNTAX_BUILTIN},{"int64_t", SYNTAX_BUILTIN},{"int8_t", SYNTAX_BUILTIN},{"int_fast16_t", SYNTAX_BUILTIN},{"int_fast32_t", SYNTAX_BUILTIN},{"int_fast64_t", SYNTAX_BUILTIN},{"int_fast8_t", SYNTAX_BUILTIN},{"int_least16_t", SYNTAX_BUILTIN},{"int_least32_t", SYNTAX_BUILTIN},{"int_least64_t", SYNTAX_BUILTIN},{"int_least8_t", SYNTAX_BUILTIN},{"intmax_t", SYNTAX_BUILTIN},{"intptr_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_j[1] = {{"jmp_buf", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_k[1] = {{"key_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_l[3] = {{"ldiv_t", SYNTAX_BUILTIN},{"lldiv_t", SYNTAX_BUILTIN},{"long", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_m[16] = {{"math_errhandling", SYNTAX_BUILTIN},{"max_align_t", SYNTAX_BUILTIN},{"mbstate_t", SYNTAX_BUILTIN},{"memory_order", SYNTAX_BUILTIN},{"memory_order_acq_rel", SYNTAX_BUILTIN},{"memory_order_acquire", SYNTAX_BUILTIN},{"memory_order_consume", SYNTAX_BUILTIN},{"memory_order_relaxed", SYNTAX_BUILTIN},{"memory_order_release", SYNTAX_BUILTIN},{"memory_order_seq_cst", SYNTAX_BUILTIN},{"mode_t", SYNTAX_BUILTIN},{"mtx_plain", SYNTAX_CONSTANT},{"mtx_recursive", SYNTAX_CONSTANT},{"mtx_t", SYNTAX_BUILTIN},{"mtx_timed", SYNTAX_CONSTANT},{"mtx_try", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_c_n[2] = {{"nlink_t", SYNTAX_BUILTIN},{"noreturn", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_o[4] = {{"off64_t", SYNTAX_BUILTIN},{"off_t", SYNTAX_BUILTIN},{"offsetof", SYNTAX_BUILTIN},{"once_flag", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_p[2] = {{"pid_t", SYNTAX_BUILTIN},{"ptrdiff_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_r[4] = {{"register", SYNTAX_KEYWORD},{"restrict", SYNTAX_KEYWORD},{"return", SYNTAX_KEYWORD},{"rsize_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_s[13] = {{"short", SYNTAX_KEYWORD},{"sig_atomic_t", SYNTAX_BUILTIN},{"signed", SYNTAX_KEYWORD},{"size_t", SYNTAX_BUILTIN},{"sizeof", SYNTAX_KEYWORD},{"ssize_t", SYNTAX_BUILTIN},{"static", SYNTAX_KEYWORD},{"static_assert", SYNTAX_BUILTIN},{"stderr", SYNTAX_CONSTANT},{"stdin", SYNTAX_CONSTANT},{"stdout", SYNTAX_CONSTANT},{"struct", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_t[12] = {{"thrd_busy", SYNTAX_CONSTANT},{"thrd_error", SYNTAX_CONSTANT},{"thrd_nomem", SYNTAX_CONSTANT},{"thrd_start_t", SYNTAX_BUILTIN},{"thrd_success", SYNTAX_CONSTANT},{"thrd_t", SYNTAX_BUILTIN},{"thrd_timeout", SYNTAX_CONSTANT},{"time_t", SYNTAX_BUILTIN},{"true", SYNTAX_CONSTANT},{"tss_dtor_t", SYNTAX_BUILTIN},{"tss_t", SYNTAX_BUILTIN},{"typedef", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_u[18] = {{"uid_t", SYNTAX_BUILTIN},{"uint16_t", SYNTAX_BUILTIN},{"uint32_t", SYNTAX_BUILTIN},{"uint64_t", SYNTAX_BUILTIN},{"uint8_t", SYNTAX_BUILTIN},{"uint_fast16_t", SYNTAX_BUILTIN},{"uint_fast32_t", SYNTAX_BUILTIN},{"uint_fast64_t", SYNTAX_BUILTIN},{"uint_fast8_t", SYNTAX_BUILTIN},{"uint_least16_t", SYNTAX_BUILTIN},{"uint_least32_t", SYNTAX_BUILTIN},{"uint_least64_t", SYNTAX_BUILTIN},{"uint_least8_t", SYNTAX_BUILTIN},{"uintmax_t", SYNTAX_BUILTIN},{"uintptr_t", SYNTAX_BUILTIN},{"union", SYNTAX_KEYWORD},{"unsigned", SYNTAX_KEYWORD},{"useconds_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_v[3] = {{"va_list", SYNTAX_BUILTIN},{"void", SYNTAX_KEYWORD},{"volatile", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_c_w[5] = {{"wchar_t", SYNTAX_BUILTIN},{"wctrans_t", SYNTAX_BUILTIN},{"wctype_t", SYNTAX_BUILTIN},{"while", SYNTAX_KEYWORD},{"wint_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_c_x[1] = {{"xtime", SYNTAX_BUILTIN}};
-static const KeywordList syntax_all_keywords_c[128] = {
-	['A'] = {syntax_keywords_c_A, arr_count(syntax_keywords_c_A)}, ['B'] = {syntax_keywords_c_B, arr_count(syntax_keywords_c_B)}, ['C'] = {syntax_keywords_c_C, arr_count(syntax_keywords_c_C)}, ['D'] = {syntax_keywords_c_D, arr_count(syntax_keywords_c_D)}, ['E'] = {syntax_keywords_c_E, arr_count(syntax_keywords_c_E)}, ['F'] = {syntax_keywords_c_F, arr_count(syntax_keywords_c_F)}, ['H'] = {syntax_keywords_c_H, arr_count(syntax_keywords_c_H)}, ['I'] = {syntax_keywords_c_I, arr_count(syntax_keywords_c_I)}, ['L'] = {syntax_keywords_c_L, arr_count(syntax_keywords_c_L)}, ['M'] = {syntax_keywords_c_M, arr_count(syntax_keywords_c_M)}, ['N'] = {syntax_keywords_c_N, arr_count(syntax_keywords_c_N)}, ['O'] = {syntax_keywords_c_O, arr_count(syntax_keywords_c_O)}, ['P'] = {syntax_keywords_c_P, arr_count(syntax_keywords_c_P)}, ['R'] = {syntax_keywords_c_R, arr_count(syntax_keywords_c_R)}, ['S'] = {syntax_keywords_c_S, arr_count(syntax_keywords_c_S)}, ['T'] = {syntax_keywords_c_T, arr_count(syntax_keywords_c_T)}, ['U'] = {syntax_keywords_c_U, arr_count(syntax_keywords_c_U)}, ['W'] = {syntax_keywords_c_W, arr_count(syntax_keywords_c_W)}, ['_'] = {syntax_keywords_c_x5f, arr_count(syntax_keywords_c_x5f)}, ['a'] = {syntax_keywords_c_a, arr_count(syntax_keywords_c_a)}, ['b'] = {syntax_keywords_c_b, arr_count(syntax_keywords_c_b)}, ['c'] = {syntax_keywords_c_c, arr_count(syntax_keywords_c_c)}, ['d'] = {syntax_keywords_c_d, arr_count(syntax_keywords_c_d)}, ['e'] = {syntax_keywords_c_e, arr_count(syntax_keywords_c_e)}, ['f'] = {syntax_keywords_c_f, arr_count(syntax_keywords_c_f)}, ['g'] = {syntax_keywords_c_g, arr_count(syntax_keywords_c_g)}, ['i'] = {syntax_keywords_c_i, arr_count(syntax_keywords_c_i)}, ['j'] = {syntax_keywords_c_j, arr_count(syntax_keywords_c_j)}, ['k'] = {syntax_keywords_c_k, arr_count(syntax_keywords_c_k)}, ['l'] = {syntax_keywords_c_l, arr_count(syntax_keywords_c_l)}, ['m'] = {syntax_keywords_c_m, arr_count(syntax_keywords_c_m)}, ['n'] = {syntax_keywords_c_n, arr_count(syntax_keywords_c_n)}, ['o'] = {syntax_keywords_c_o, arr_count(syntax_keywords_c_o)}, ['p'] = {syntax_keywords_c_p, arr_count(syntax_keywords_c_p)}, ['r'] = {syntax_keywords_c_r, arr_count(syntax_keywords_c_r)}, ['s'] = {syntax_keywords_c_s, arr_count(syntax_keywords_c_s)}, ['t'] = {syntax_keywords_c_t, arr_count(syntax_keywords_c_t)}, ['u'] = {syntax_keywords_c_u, arr_count(syntax_keywords_c_u)}, ['v'] = {syntax_keywords_c_v, arr_count(syntax_keywords_c_v)}, ['w'] = {syntax_keywords_c_w, arr_count(syntax_keywords_c_w)}, ['x'] = {syntax_keywords_c_x, arr_count(syntax_keywords_c_x)}
+	/// displacement for each bucket
+	const u16 *displacements;
+	u32 len;
+	u32 nbuckets;
+	/// number of character positions used in the hash
+	u32 npositions;
+	/// character positions used in the hash. negative positions count from the end of the identifier.
+	i8 positions[12];
+	/// multiplier for each character position
+	u32 multipliers[12];
+} KeywordTable;
+
+static const Keyword syntax_keywords_c[693] = {{"LDBL_MAX_10_EXP", 15, SYNTAX_CONSTANT},{"ino_t", 5, SYNTAX_BUILTIN},{"atomic_bool", 11, SYNTAX_BUILTIN},{"ENOLINK", 7, SYNTAX_CONSTANT},{"INT64_MIN", 9, SYNTAX_CONSTANT},{"PRIu8", 5, SYNTAX_CONSTANT},{"EMFILE", 6, SYNTAX_CONSTANT},{"continue", 8, SYNTAX_KEYWORD},{"SCNi32", 6, SYNTAX_CONSTANT},{"ETIMEDOUT", 9, SYNTAX_CONSTANT},{"SIGXFSZ", 7, SYNTAX_CONSTANT},{"PRIiLEAST32", 11, SYNTAX_CONSTANT},{"ENONET", 6, SYNTAX_CONSTANT},{"SCNuFAST8", 9, SYNTAX_CONSTANT},{"time_t", 6, SYNTAX_BUILTIN},{"SCNdLEAST64", 11, SYNTAX_CONSTANT},{"mtx_timed", 9, SYNTAX_CONSTANT},{"PRIo32", 6, SYNTAX_CONSTANT},{"unsigned", 8, SYNTAX_KEYWORD},{"xtime", 5, SYNTAX_BUILTIN},{"INFINITY", 8, SYNTAX_CONSTANT},{"INT_LEAST16_MAX", 15, SYNTAX_CONSTANT},{"ENOTSOCK", 8, SYNTAX_CONSTANT},{"ESTRPIPE", 8, SYNTAX_CONSTANT},{"EMSGSIZE", 8, SYNTAX_CONSTANT},{"PRIi32", 6, SYNTAX_CONSTANT},{"WINT_MAX", 8, SYNTAX_CONSTANT},{"PRIdLEAST32", 11, SYNTAX_CONSTANT},{"EL2NSYNC", 8, SYNTAX_CONSTANT},{"ERANGE", 6, SYNTAX_CONSTANT},{"alignas", 7, SYNTAX_BUILTIN},{"UINT_FAST8_MAX", 14, SYNTAX_CONSTANT},{"fsfilcnt64_t", 12, SYNTAX_BUILTIN},{"PRIuFAST32", 10, SYNTAX_CONSTANT},{"do", 2, SYNTAX_KEYWORD},{"EADDRINUSE", 10, SYNTAX_CONSTANT},{"SCNuPTR", 7, SYNTAX_CONSTANT},{"MATH_ERREXCEPT", 14, SYNTAX_CONSTANT},{"SCNiMAX", 7, SYNTAX_CONSTANT},{"EISNAM", 6, SYNTAX_CONSTANT},{"ECOMM", 5, SYNTAX_CONSTANT},{"PRIuFAST16", 10, SYNTAX_CONSTANT},{"SCNoFAST16", 10, SYNTAX_CONSTANT},{"SCNuFAST64", 10, SYNTAX_CONSTANT},{"DBL_MAX", 7, SYNTAX_CONSTANT},{"FLT_ROUNDS", 10, SYNTAX_CONSTANT},{"ENOTUNIQ", 8, SYNTAX_CONSTANT},{"PRId64", 6, SYNTAX_CONSTANT},{"PRIxFAST64", 10, SYNTAX_CONSTANT},{"HUGE_VAL", 8, SYNTAX_CONSTANT},{"sizeof", 6, SYNTAX_KEYWORD},{"EMLINK", 6, SYNTAX_CONSTANT},{"uint_least32_t", 14, SYNTAX_BUILTIN},{"wctrans_t", 9, SYNTAX_BUILTIN},{"SEEK_SET", 8, SYNTAX_CONSTANT},{"char16_t", 8, SYNTAX_BUILTIN},{"SIGTRAP", 7, SYNTAX_CONSTANT},{"EREMOTEIO", 9, SYNTAX_CONSTANT},{"INT16_MIN", 9, SYNTAX_CONSTANT},{"atomic_uint_least32_t", 21, SYNTAX_BUILTIN},{"atomic_uintmax_t", 16, SYNTAX_BUILTIN},{"UINT_MAX", 8, SYNTAX_CONSTANT},{"WINT_MIN", 8, SYNTAX_CONSTANT},{"SCNx32", 6, SYNTAX_CONSTANT},{"FOPEN_MAX", 9, SYNTAX_CONSTANT},{"INT_FAST64_MIN", 14, SYNTAX_CONSTANT},{"EREMCHG", 7, SYNTAX_CONSTANT},{"NULL", 4, SYNTAX_CONSTANT},{"fexcept_t", 9, SYNTAX_BUILTIN},{"TSS_DTOR_ITERATIONS", 19, SYNTAX_CONSTANT},{"ENOLCK", 6, SYNTAX_CONSTANT},{"ESTALE", 6, SYNTAX_CONSTANT},{"UINT64_MAX", 10, SYNTAX_CONSTANT},{"SCNo16", 6, SYNTAX_CONSTANT},{"atomic_int_fast16_t", 19, SYNTAX_BUILTIN},{"SIGHUP", 6, SYNTAX_CONSTANT},{"INT32_MIN", 9, SYNTAX_CONSTANT},{"PRIxFAST32", 10, SYNTAX_CONSTANT},{"SIGIO", 5, SYNTAX_CONSTANT},{"SIG_ATOMIC_MAX", 14, SYNTAX_CONSTANT},{"uint_fast64_t", 13, SYNTAX_BUILTIN},{"mode_t", 6, SYNTAX_BUILTIN},{"LDBL_MIN_10_EXP", 15, SYNTAX_CONSTANT},{"ATOMIC_LLONG_LOCK_FREE", 22, SYNTAX_CONSTANT},{"atomic_wchar_t", 14, SYNTAX_BUILTIN},{"FP_INFINITE", 11, SYNTAX_CONSTANT},{"SIGSTOP", 7, SYNTAX_CONSTANT},{"EACCES", 6, SYNTAX_CONSTANT},{"mtx_plain", 9, SYNTAX_CONSTANT},{"int", 3, SYNTAX_KEYWORD},{"SCNxPTR", 7, SYNTAX_CONSTANT},{"WEOF", 4, SYNTAX_CONSTANT},{"_Thread_local", 13, SYNTAX_KEYWORD},{"register", 8, SYNTAX_KEYWORD},{"PRIuLEAST64", 11, SYNTAX_CONSTANT},{"FP_ILOGBNAN", 11, SYNTAX_CONSTANT},{"SCNxFAST32", 10, SYNTAX_CONSTANT},{"for", 3, SYNTAX_KEYWORD},{"atomic_ulong", 12, SYNTAX_BUILTIN},{"UINT_LEAST16_MAX", 16, SYNTAX_CONSTANT},{"ECONNRESET", 10, SYNTAX_CONSTANT},{"PRIdLEAST8", 10, SYNTAX_CONSTANT},{"DBL_MAX_EXP", 11, SYNTAX_CONSTANT},{"stdout", 6, SYNTAX_CONSTANT},{"SEEK_CUR", 8, SYNTAX_CONSTANT},{"INT_FAST8_MIN", 13, SYNTAX_CONSTANT},{"PRIXFAST64", 10, SYNTAX_CONSTANT},{"EUCLEAN", 7, SYNTAX_CONSTANT},{"SIGTSTP", 7, SYNTAX_CONSTANT},{"int_fast16_t", 12, SYNTAX_BUILTIN},{"SIGTTIN", 7, SYNTAX_CONSTANT},{"SCHAR_MIN", 9, SYNTAX_CONSTANT},{"mtx_recursive", 13, SYNTAX_CONSTANT},{"INT_FAST16_MAX", 14, SYNTAX_CONSTANT},{"LDBL_MIN", 8, SYNTAX_CONSTANT},{"ENOPROTOOPT", 11, SYNTAX_CONSTANT},{"PRIi8", 5, SYNTAX_CONSTANT},{"PRIiFAST16", 10, SYNTAX_CONSTANT},{"PRIx64", 6, SYNTAX_CONSTANT},{"nlink_t", 7, SYNTAX_BUILTIN},{"EISDIR", 6, SYNTAX_CONSTANT},{"EHOSTDOWN", 9, SYNTAX_CONSTANT},{"E2BIG", 5, SYNTAX_CONSTANT},{"fsblkcnt64_t", 12, SYNTAX_BUILTIN},{"ENFILE", 6, SYNTAX_CONSTANT},{"atomic_int", 10, SYNTAX_BUILTIN},{"EBADF", 5, SYNTAX_CONSTANT},{"_Bool", 5, SYNTAX_KEYWORD},{"PRIuFAST8", 9, SYNTAX_CONSTANT},{"blkcnt_t", 8, SYNTAX_BUILTIN},{"SCNdFAST16", 10, SYNTAX_CONSTANT},{"EALREADY", 8, SYNTAX_CONSTANT},{"int8_t", 6, SYNTAX_BUILTIN},{"LC_ALL", 6, SYNTAX_CONSTANT},{"EWOULDBLOCK", 11, SYNTAX_CONSTANT},{"SCNoFAST8", 9, SYNTAX_CONSTANT},{"atomic_size_t", 13, SYNTAX_BUILTIN},{"EIDRM", 5, SYNTAX_CONSTANT},{"FE_INEXACT", 10, SYNTAX_CONSTANT},{"PRIdPTR", 7, SYNTAX_CONSTANT},{"ENAVAIL", 7, SYNTAX_CONSTANT},{"FE_DOWNWARD", 11, SYNTAX_CONSTANT},{"EFBIG", 5, SYNTAX_CONSTANT},{"ptrdiff_t", 9, SYNTAX_BUILTIN},{"const", 5, SYNTAX_KEYWORD},{"SCNu32", 6, SYNTAX_CONSTANT},{"EBFONT", 6, SYNTAX_CONSTANT},{"UINT8_MAX", 9, SYNTAX_CONSTANT},{"UINT_LEAST32_MAX", 16, SYNTAX_CONSTANT},{"PRIxMAX", 7, SYNTAX_CONSTANT},{"UCHAR_MAX", 9, SYNTAX_CONSTANT},{"PRIuFAST64", 10, SYNTAX_CONSTANT},{"SCNu16", 6, SYNTAX_CONSTANT},{"SCNdFAST32", 10, SYNTAX_CONSTANT},{"errno_t", 7, SYNTAX_BUILTIN},{"PRId8", 5, SYNTAX_CONSTANT},{"PTRDIFF_MAX", 11, SYNTAX_CONSTANT},{"PTRDIFF_MIN", 11, SYNTAX_CONSTANT},{"EREMOTE", 7, SYNTAX_CONSTANT},{"atomic_schar", 12, SYNTAX_BUILTIN},{"atomic_int_least8_t", 19, SYNTAX_BUILTIN},{"DBL_DIG", 7, SYNTAX_CONSTANT},{"EXDEV", 5, SYNTAX_CONSTANT},{"ATOMIC_SHORT_LOCK_FREE", 22, SYNTAX_CONSTANT},{"stderr", 6, SYNTAX_CONSTANT},{"complex", 7, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"FLT_MAX", 7, SYNTAX_CONSTANT},{"uint_least16_t", 14, SYNTAX_BUILTIN},{"EPROTOTYPE", 10, SYNTAX_CONSTANT},{"PRIoLEAST64", 11, SYNTAX_CONSTANT},{"SCNiLEAST64", 11, SYNTAX_CONSTANT},{"EFAULT", 6, SYNTAX_CONSTANT},{"SIGILL", 6, SYNTAX_CONSTANT},{"uint16_t", 8, SYNTAX_BUILTIN},{"INT8_MAX", 8, SYNTAX_CONSTANT},{"UINT_FAST64_MAX", 15, SYNTAX_CONSTANT},{"wctype_t", 8, SYNTAX_BUILTIN},{"SIGURG", 6, SYNTAX_CONSTANT},{"SCNoLEAST16", 11, SYNTAX_CONSTANT},{"SCNoLEAST8", 10, SYNTAX_CONSTANT},{"PRIiMAX", 7, SYNTAX_CONSTANT},{"ATOMIC_FLAG_LOCK_FREE", 21, SYNTAX_CONSTANT},{"ETXTBSY", 7, SYNTAX_CONSTANT},{"CHAR_MAX", 8, SYNTAX_CONSTANT},{"EXIT_FAILURE", 12, SYNTAX_CONSTANT},{"uid_t", 5, SYNTAX_BUILTIN},{"EBADSLT", 7, SYNTAX_CONSTANT},{"intmax_t", 8, SYNTAX_BUILTIN},{"ATOMIC_WCHAR_T_LOCK_FREE", 24, SYNTAX_CONSTANT},{"EL3HLT", 6, SYNTAX_CONSTANT},{"LDBL_MAX", 8, SYNTAX_CONSTANT},{"INT_LEAST32_MAX", 15, SYNTAX_CONSTANT},{"SIGWINCH", 8, SYNTAX_CONSTANT},{"PRId32", 6, SYNTAX_CONSTANT},{"EOF", 3, SYNTAX_CONSTANT},{"EEXIST", 6, SYNTAX_CONSTANT},{"FLT_MAX_EXP", 11, SYNTAX_CONSTANT},{"INT_FAST32_MAX", 14, SYNTAX_CONSTANT},{"SCNoLEAST64", 11, SYNTAX_CONSTANT},{"LC_COLLATE", 10, SYNTAX_CONSTANT},{"EISCONN", 7, SYNTAX_CONSTANT},{"rsize_t", 7, SYNTAX_BUILTIN},{"tss_t", 5, SYNTAX_BUILTIN},{"SCNx16", 6, SYNTAX_CONSTANT},{"else", 4, SYNTAX_KEYWORD},{"PRIXLEAST16", 11, SYNTAX_CONSTANT},{"ENOSPC", 6, SYNTAX_CONSTANT},{"PRIX32", 6, SYNTAX_CONSTANT},{"SIGTTOU", 7, SYNTAX_CONSTANT},{"ENOTNAM", 7, SYNTAX_CONSTANT},{"int64_t", 7, SYNTAX_BUILTIN},{"ATOMIC_CHAR_LOCK_FREE", 21, SYNTAX_CONSTANT},{"atomic_uint_fast64_t", 20, SYNTAX_BUILTIN},{"ELIBMAX", 7, SYNTAX_CONSTANT},{"DECIMAL_DIG", 11, SYNTAX_CONSTANT},{"ENETUNREACH", 11, SYNTAX_CONSTANT},{"EADDRNOTAVAIL", 13, SYNTAX_CONSTANT},{"SIGINFO", 7, SYNTAX_CONSTANT},{"atomic_flag", 11, SYNTAX_BUILTIN},{"LC_CTYPE", 8, SYNTAX_CONSTANT},{"FE_INVALID", 10, SYNTAX_CONSTANT},{"PRIuLEAST16", 11, SYNTAX_CONSTANT},{"PRIdFAST64", 10, SYNTAX_CONSTANT},{"SIG_DFL", 7, SYNTAX_CONSTANT},{"_Complex", 8, SYNTAX_KEYWORD},{"PRIo8", 5, SYNTAX_CONSTANT},{"FLT_RADIX", 9, SYNTAX_CONSTANT},{"short", 5, SYNTAX_KEYWORD},{"SIGFPE", 6, SYNTAX_CONSTANT},{"SCNiFAST32", 10, SYNTAX_CONSTANT},{"EXFULL", 6, SYNTAX_CONSTANT},{"PRIoMAX", 7, SYNTAX_CONSTANT},{"SIGVTALRM", 9, SYNTAX_CONSTANT},{"ESRCH", 5, SYNTAX_CONSTANT},{"ENOBUFS", 7, SYNTAX_CONSTANT},{"pid_t", 5, SYNTAX_BUILTIN},{"thrd_error", 10, SYNTAX_CONSTANT},{"SCNdPTR", 7, SYNTAX_CONSTANT},{"SCNxFAST64", 10, SYNTAX_CONSTANT},{"_Alignof", 8, SYNTAX_KEYWORD},{"PRIx16", 6, SYNTAX_CONSTANT},{"ELNRNG", 6, SYNTAX_CONSTANT},{"PRIX64", 6, SYNTAX_CONSTANT},{"LONG_MAX", 8, SYNTAX_CONSTANT},{"PRIiPTR", 7, SYNTAX_CONSTANT},{"uint_least8_t", 13, SYNTAX_BUILTIN},{"double", 6, SYNTAX_KEYWORD},{"FILE", 4, SYNTAX_BUILTIN},{"EROFS", 5, SYNTAX_CONSTANT},{"SCNoLEAST32", 11, SYNTAX_CONSTANT},{"if", 2, SYNTAX_KEYWORD},{"SCNxLEAST8", 10, SYNTAX_CONSTANT},{"SCNi64", 6, SYNTAX_CONSTANT},{"static_assert", 13, SYNTAX_BUILTIN},{"PRIoFAST16", 10, SYNTAX_CONSTANT},{"CHAR_BIT", 8, SYNTAX_CONSTANT},{"atomic_intptr_t", 15, SYNTAX_BUILTIN},{"SCNiFAST64", 10, SYNTAX_CONSTANT},{"SCNdLEAST16", 11, SYNTAX_CONSTANT},{"EUNATCH", 7, SYNTAX_CONSTANT},{"ESRMNT", 6, SYNTAX_CONSTANT},{"gid_t", 5, SYNTAX_BUILTIN},{"EPROTO", 6, SYNTAX_CONSTANT},{"SCNiFAST8", 9, SYNTAX_CONSTANT},{"SCNxLEAST64", 11, SYNTAX_CONSTANT},{"SIGSYS", 6, SYNTAX_CONSTANT},{"int_least64_t", 13, SYNTAX_BUILTIN},{"SIGPROF", 7, SYNTAX_CONSTANT},{"UINTMAX_MAX", 11, SYNTAX_CONSTANT},{"EILSEQ", 6, SYNTAX_CONSTANT},{"ECHILD", 6, SYNTAX_CONSTANT},{"TMP_MAX", 7, SYNTAX_CONSTANT},{"bool", 4, SYNTAX_BUILTIN},{"EBADFD", 6, SYNTAX_CONSTANT},{"ldiv_t", 6, SYNTAX_BUILTIN},{"SIGALRM", 7, SYNTAX_CONSTANT},{"EINVAL", 6, SYNTAX_CONSTANT},{"atomic_char32_t", 15, SYNTAX_BUILTIN},{"SCNoFAST64", 10, SYNTAX_CONSTANT},{"ENETRESET", 9, SYNTAX_CONSTANT},{"fenv_t", 6, SYNTAX_BUILTIN},{"ENOSYS", 6, SYNTAX_CONSTANT},{"atomic_char16_t", 15, SYNTAX_BUILTIN},{"INTPTR_MIN", 10, SYNTAX_CONSTANT},{"ENODEV", 6, SYNTAX_CONSTANT},{"SCNiLEAST8", 10, SYNTAX_CONSTANT},{"atomic_long", 11, SYNTAX_BUILTIN},{"SCNiLEAST16", 11, SYNTAX_CONSTANT},{"FE_ALL_EXCEPT", 13, SYNTAX_CONSTANT},{"FP_SUBNORMAL", 12, SYNTAX_CONSTANT},{"wint_t", 6, SYNTAX_BUILTIN},{"LC_MONETARY", 11, SYNTAX_CONSTANT},{"EHOSTUNREACH", 12, SYNTAX_CONSTANT},{"atomic_uintptr_t", 16, SYNTAX_BUILTIN},{"EUSERS", 6, SYNTAX_CONSTANT},{"thrd_t", 6, SYNTAX_BUILTIN},{"mtx_try", 7, SYNTAX_CONSTANT},{"fsfilcnt_t", 10, SYNTAX_BUILTIN},{"UINTPTR_MAX", 11, SYNTAX_CONSTANT},{"uint_fast16_t", 13, SYNTAX_BUILTIN},{"atomic_uint_least16_t", 21, SYNTAX_BUILTIN},{"PRIuLEAST8", 10, SYNTAX_CONSTANT},{"int_least16_t", 13, SYNTAX_BUILTIN},{"fpos_t", 6, SYNTAX_BUILTIN},{"SCNxMAX", 7, SYNTAX_CONSTANT},{"atomic_uchar", 12, SYNTAX_BUILTIN},{"PRIdLEAST16", 11, SYNTAX_CONSTANT},{"FLT_MIN_10_EXP", 14, SYNTAX_CONSTANT},{"atomic_ptrdiff_t", 16, SYNTAX_BUILTIN},{"PRIXFAST32", 10, SYNTAX_CONSTANT},{"PRIxLEAST16", 11, SYNTAX_CONSTANT},{"FE_OVERFLOW", 11, SYNTAX_CONSTANT},{"INT32_MAX", 9, SYNTAX_CONSTANT},{"EOPNOTSUPP", 10, SYNTAX_CONSTANT},{"atomic_uint_least64_t", 21, SYNTAX_BUILTIN},{"CLOCKS_PER_SEC", 14, SYNTAX_CONSTANT},{"SCNuFAST16", 10, SYNTAX_CONSTANT},{"DBL_MANT_DIG", 12, SYNTAX_CONSTANT},{"alignof", 7, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"auto", 4, SYNTAX_KEYWORD},{"atomic_uint_fast16_t", 20, SYNTAX_BUILTIN},{"atomic_intmax_t", 15, SYNTAX_BUILTIN},{"_Static_assert", 14, SYNTAX_KEYWORD},{"atomic_short", 12, SYNTAX_BUILTIN},{"PRIxFAST8", 9, SYNTAX_CONSTANT},{"ENOEXEC", 7, SYNTAX_CONSTANT},{"PRIiFAST8", 9, SYNTAX_CONSTANT},{"UINT16_MAX", 10, SYNTAX_CONSTANT},{"LDBL_MANT_DIG", 13, SYNTAX_CONSTANT},{"off64_t", 7, SYNTAX_BUILTIN},{"PRIXFAST16", 10, SYNTAX_CONSTANT},{"int_fast32_t", 12, SYNTAX_BUILTIN},{"LLONG_MIN", 9, SYNTAX_CONSTANT},{"signed", 6, SYNTAX_KEYWORD},{"atomic_int_least32_t", 20, SYNTAX_BUILTIN},{"SCHAR_MAX", 9, SYNTAX_CONSTANT},{"offsetof", 8, SYNTAX_BUILTIN},{"ECONNREFUSED", 12, SYNTAX_CONSTANT},{"ATOMIC_ADDRESS_LOCK_FREE", 24, SYNTAX_CONSTANT},{"SIGINT", 6, SYNTAX_CONSTANT},{"TIME_UTC", 8, SYNTAX_CONSTANT},{"PRIi64", 6, SYNTAX_CONSTANT},{"ENOMSG", 6, SYNTAX_CONSTANT},{"SCNd16", 6, SYNTAX_CONSTANT},{"INT_LEAST32_MIN", 15, SYNTAX_CONSTANT},{"PRIoPTR", 7, SYNTAX_CONSTANT},{"FE_UNDERFLOW", 12, SYNTAX_CONSTANT},{"PRIXPTR", 7, SYNTAX_CONSTANT},{"HUGE_VALF", 9, SYNTAX_CONSTANT},{"FP_ZERO", 7, SYNTAX_CONSTANT},{"SCNuLEAST16", 11, SYNTAX_CONSTANT},{"static", 6, SYNTAX_KEYWORD},{"DBL_HAS_SUBNORM", 15, SYNTAX_CONSTANT},{"SCNdLEAST8", 10, SYNTAX_CONSTANT},{"SCNx8", 5, SYNTAX_CONSTANT},{"ENOMEDIUM", 9, SYNTAX_CONSTANT},{"SCNo32", 6, SYNTAX_CONSTANT},{"INT_LEAST16_MIN", 15, SYNTAX_CONSTANT},{"PRIu64", 6, SYNTAX_CONSTANT},{"memory_order_seq_cst", 20, SYNTAX_BUILTIN},{"FE_TONEAREST", 12, SYNTAX_CONSTANT},{"USHRT_MAX", 9, SYNTAX_CONSTANT},{"ERESTART", 8, SYNTAX_CONSTANT},{"CHAR_MIN", 8, SYNTAX_CONSTANT},{"atomic_char", 11, SYNTAX_BUILTIN},{"ELIBEXEC", 8, SYNTAX_CONSTANT},{"memory_order_relaxed", 20, SYNTAX_BUILTIN},{"INT_LEAST64_MIN", 15, SYNTAX_CONSTANT},{"WCHAR_MIN", 9, SYNTAX_CONSTANT},{"PRIuMAX", 7, SYNTAX_CONSTANT},{"clock_t", 7, SYNTAX_BUILTIN},{"INT_FAST8_MAX", 13, SYNTAX_CONSTANT},{"ELIBACC", 7, SYNTAX_CONSTANT},{"int_fast64_t", 12, SYNTAX_BUILTIN},{"FLT_MIN_EXP", 11, SYNTAX_CONSTANT},{"caddr_t", 7, SYNTAX_BUILTIN},{"EL3RST", 6, SYNTAX_CONSTANT},{"INT16_MAX", 9, SYNTAX_CONSTANT},{"EMULTIHOP", 9, SYNTAX_CONSTANT},{"once_flag", 9, SYNTAX_BUILTIN},{"ENOSR", 5, SYNTAX_CONSTANT},{"default", 7, SYNTAX_KEYWORD},{"ATOMIC_CHAR16_T_LOCK_FREE", 25, SYNTAX_CONSTANT},{"PRIX8", 5, SYNTAX_CONSTANT},{"_Alignas", 8, SYNTAX_KEYWORD},{"float", 5, SYNTAX_KEYWORD},{"PRIiFAST64", 10, SYNTAX_CONSTANT},{"SIGCLD", 6, SYNTAX_CONSTANT},{"LC_TIME", 7, SYNTAX_CONSTANT},{"SIG_IGN", 7, SYNTAX_CONSTANT},{"SIZE_MAX", 8, SYNTAX_CONSTANT},{"cnd_t", 5, SYNTAX_BUILTIN},{"FLT_TRUE_MIN", 12, SYNTAX_CONSTANT},{"SCNi8", 5, SYNTAX_CONSTANT},{"ENOTCONN", 8, SYNTAX_CONSTANT},{"restrict", 8, SYNTAX_KEYWORD},{"atomic_address", 14, SYNTAX_BUILTIN},{"FP_FAST_FMA", 11, SYNTAX_CONSTANT},{"SIGPWR", 6, SYNTAX_CONSTANT},{"UINT_LEAST64_MAX", 16, SYNTAX_CONSTANT},{"memory_order_acq_rel", 20, SYNTAX_BUILTIN},{"ENOTEMPTY", 9, SYNTAX_CONSTANT},{"ESPIPE", 6, SYNTAX_CONSTANT},{"SIGCHLD", 7, SYNTAX_CONSTANT},{"BUFSIZ", 6, SYNTAX_CONSTANT},{"SCNi16", 6, SYNTAX_CONSTANT},{"SIGUSR1", 7, SYNTAX_CONSTANT},{"union", 5, SYNTAX_KEYWORD},{"thrd_timeout", 12, SYNTAX_CONSTANT},{"PRIXLEAST64", 11, SYNTAX_CONSTANT},{"WCHAR_MAX", 9, SYNTAX_CONSTANT},{"thrd_busy", 9, SYNTAX_CONSTANT},{"ENODATA", 7, SYNTAX_CONSTANT},{"volatile", 8, SYNTAX_KEYWORD},{"EBADRQC", 7, SYNTAX_CONSTANT},{"PRIxLEAST32", 11, SYNTAX_CONSTANT},{"PRIiFAST32", 10, SYNTAX_CONSTANT},{"EDQUOT", 6, SYNTAX_CONSTANT},{"SCNoPTR", 7, SYNTAX_CONSTANT},{"PRIoFAST32", 10, SYNTAX_CONSTANT},{"SIGUNUSED", 9, SYNTAX_CONSTANT},{"SCNuFAST32", 10, SYNTAX_CONSTANT},{"UINT32_MAX", 10, SYNTAX_CONSTANT},{"SCNiPTR", 7, SYNTAX_CONSTANT},{"ONCE_FLAG_INIT", 14, SYNTAX_CONSTANT},{"FILENAME_MAX", 12, SYNTAX_CONSTANT},{"PRIdMAX", 7, SYNTAX_CONSTANT},{"SIGXCPU", 7, SYNTAX_CONSTANT},{"SCNxLEAST16", 11, SYNTAX_CONSTANT},{"SCNu8", 5, SYNTAX_CONSTANT},{"SCNxFAST8", 9, SYNTAX_CONSTANT},{"FP_NORMAL", 9, SYNTAX_CONSTANT},{"EAFNOSUPPORT", 12, SYNTAX_CONSTANT},{"fsblkcnt_t", 10, SYNTAX_BUILTIN},{"lldiv_t", 7, SYNTAX_BUILTIN},{"EL2HLT", 6, SYNTAX_CONSTANT},{"atomic_uint", 11, SYNTAX_BUILTIN},{"SCNuLEAST32", 11, SYNTAX_CONSTANT},{"char32_t", 8, SYNTAX_BUILTIN},{"SIGABRT", 7, SYNTAX_CONSTANT},{"SCNdFAST64", 10, SYNTAX_CONSTANT},{"SCNoMAX", 7, SYNTAX_CONSTANT},{"void", 4, SYNTAX_KEYWORD},{"DBL_MIN", 7, SYNTAX_CONSTANT},{"PRIu32", 6, SYNTAX_CONSTANT},{"EAGAIN", 6, SYNTAX_CONSTANT},{"FLT_DIG", 7, SYNTAX_CONSTANT},{"SCNdMAX", 7, SYNTAX_CONSTANT},{"FE_DIVBYZERO", 12, SYNTAX_CONSTANT},{"struct", 6, SYNTAX_KEYWORD},{"PRIxPTR", 7, SYNTAX_CONSTANT},{"INT_MAX", 7, SYNTAX_CONSTANT},{"SCNdLEAST32", 11, SYNTAX_CONSTANT},{"FLT_MAX_10_EXP", 14, SYNTAX_CONSTANT},{"id_t", 4, SYNTAX_BUILTIN},{"EMEDIUMTYPE", 11, SYNTAX_CONSTANT},{"memory_order_consume", 20, SYNTAX_BUILTIN},{"SCNu64", 6, SYNTAX_CONSTANT},{"INT_LEAST8_MIN", 14, SYNTAX_CONSTANT},{"SIGEMT", 6, SYNTAX_CONSTANT},{"atomic_int_least64_t", 20, SYNTAX_BUILTIN},{"INT_FAST16_MIN", 14, SYNTAX_CONSTANT},{"INT_MIN", 7, SYNTAX_CONSTANT},{"SCNo64", 6, SYNTAX_CONSTANT},{"SCNoFAST32", 10, SYNTAX_CONSTANT},{"LDBL_DECIMAL_DIG", 16, SYNTAX_CONSTANT},{"PRIx32", 6, SYNTAX_CONSTANT},{"PRIdFAST32", 10, SYNTAX_CONSTANT},{"ETOOMANYREFS", 12, SYNTAX_CONSTANT},{"PRIXMAX", 7, SYNTAX_CONSTANT},{"uintptr_t", 9, SYNTAX_BUILTIN},{"FLT_MIN", 7, SYNTAX_CONSTANT},{"SEEK_END", 8, SYNTAX_CONSTANT},{"typedef", 7, SYNTAX_KEYWORD},{"ECONNABORTED", 12, SYNTAX_CONSTANT},{"key_t", 5, SYNTAX_BUILTIN},{"switch", 6, SYNTAX_KEYWORD},{"I", 1, SYNTAX_CONSTANT},{"mbstate_t", 9, SYNTAX_BUILTIN},{"dev_t", 5, SYNTAX_BUILTIN},{"EIO", 3, SYNTAX_CONSTANT},{"FP_NAN", 6, SYNTAX_CONSTANT},{"SCNo8", 5, SYNTAX_CONSTANT},{"SIGSEGV", 7, SYNTAX_CONSTANT},{"DBL_MAX_10_EXP", 14, SYNTAX_CONSTANT},{"blkcnt64_t", 10, SYNTAX_BUILTIN},{"PRIxLEAST8", 10, SYNTAX_CONSTANT},{"atomic_int_fast8_t", 18, SYNTAX_BUILTIN},{"imaxdiv_t", 9, SYNTAX_BUILTIN},{"FP_FAST_FMAL", 12, SYNTAX_CONSTANT},{"int_least32_t", 13, SYNTAX_BUILTIN},{"_Generic", 8, SYNTAX_KEYWORD},{"FE_UPWARD", 9, SYNTAX_CONSTANT},{"ENOENT", 6, SYNTAX_CONSTANT},{"SCNiLEAST32", 11, SYNTAX_CONSTANT},{"SIGSTKFLT", 9, SYNTAX_CONSTANT},{"off_t", 5, SYNTAX_BUILTIN},{"SCNd8", 5, SYNTAX_CONSTANT},{"SCNuLEAST8", 10, SYNTAX_CONSTANT},{"PRIuLEAST32", 11, SYNTAX_CONSTANT},{"SIG_ERR", 7, SYNTAX_CONSTANT},{"PRIXFAST8", 9, SYNTAX_CONSTANT},{"SCNx64", 6, SYNTAX_CONSTANT},{"EBADMSG", 7, SYNTAX_CONSTANT},{"EDEADLK", 7, SYNTAX_CONSTANT},{"SHRT_MAX", 8, SYNTAX_CONSTANT},{"SIGLOST", 7, SYNTAX_CONSTANT},{"PRIoLEAST8", 10, SYNTAX_CONSTANT},{"goto", 4, SYNTAX_KEYWORD},{"false", 5, SYNTAX_CONSTANT},{"INT_LEAST64_MAX", 15, SYNTAX_CONSTANT},{"ELOOP", 5, SYNTAX_CONSTANT},{"PRIdFAST8", 9, SYNTAX_CONSTANT},{"EADV", 4, SYNTAX_CONSTANT},{"return", 6, SYNTAX_KEYWORD},{"PRIi16", 6, SYNTAX_CONSTANT},{"LDBL_MIN_EXP", 12, SYNTAX_CONSTANT},{"atomic_uint_fast8_t", 19, SYNTAX_BUILTIN},{"SCNuMAX", 7, SYNTAX_CONSTANT},{"SIGTERM", 7, SYNTAX_CONSTANT},{"MATH_ERRNO", 10, SYNTAX_CONSTANT},{"thrd_success", 12, SYNTAX_CONSTANT},{"atomic_ullong", 13, SYNTAX_BUILTIN},{"SIGBUS", 6, SYNTAX_CONSTANT},{"EBADR", 5, SYNTAX_CONSTANT},{"ESHUTDOWN", 9, SYNTAX_CONSTANT},{"int_fast8_t", 11, SYNTAX_BUILTIN},{"atomic_ushort", 13, SYNTAX_BUILTIN},{"memory_order_release", 20, SYNTAX_BUILTIN},{"ENAMETOOLONG", 12, SYNTAX_CONSTANT},{"while", 5, SYNTAX_KEYWORD},{"atomic_int_fast32_t", 19, SYNTAX_BUILTIN},{"ELIBSCN", 7, SYNTAX_CONSTANT},{"PRIxLEAST64", 11, SYNTAX_CONSTANT},{"mtx_t", 5, SYNTAX_BUILTIN},{"float_t", 7, SYNTAX_BUILTIN},{"INT8_MIN", 8, SYNTAX_CONSTANT},{"sig_atomic_t", 12, SYNTAX_BUILTIN},{"FLT_HAS_SUBNORM", 15, SYNTAX_CONSTANT},{"ECHRNG", 6, SYNTAX_CONSTANT},{"UINT_FAST32_MAX", 15, SYNTAX_CONSTANT},{"SCNxFAST16", 10, SYNTAX_CONSTANT},{"LDBL_TRUE_MIN", 13, SYNTAX_CONSTANT},{"SIGPIPE", 7, SYNTAX_CONSTANT},{"NDEBUG", 6, SYNTAX_CONSTANT},{"LDBL_EPSILON", 12, SYNTAX_CONSTANT},{"EINTR", 5, SYNTAX_CONSTANT},{"HUGE_VALL", 9, SYNTAX_CONSTANT},{"SIGKILL", 7, SYNTAX_CONSTANT},{"char8_t", 7, SYNTAX_BUILTIN},{"LC_NUMERIC", 10, SYNTAX_CONSTANT},{"EPFNOSUPPORT", 12, SYNTAX_CONSTANT},{"DBL_MIN_EXP", 11, SYNTAX_CONSTANT},{"memory_order", 12, SYNTAX_BUILTIN},{"atomic_int_least16_t", 20, SYNTAX_BUILTIN},{"PRId16", 6, SYNTAX_CONSTANT},{"PRIoFAST64", 10, SYNTAX_CONSTANT},{"PRIoFAST8", 9, SYNTAX_CONSTANT},{"math_errhandling", 16, SYNTAX_BUILTIN},{"LONG_MIN", 8, SYNTAX_CONSTANT},{"PRIXLEAST32", 11, SYNTAX_CONSTANT},{"DBL_EPSILON", 11, SYNTAX_CONSTANT},{"_IONBF", 6, SYNTAX_CONSTANT},{"int16_t", 7, SYNTAX_BUILTIN},{"SIGIOT", 6, SYNTAX_CONSTANT},{"INTPTR_MAX", 10, SYNTAX_CONSTANT},{"long", 4, SYNTAX_KEYWORD},{"EXIT_SUCCESS", 12, SYNTAX_CONSTANT},{"SIG_ATOMIC_MIN", 14, SYNTAX_CONSTANT},{"FP_ILOGB0", 9, SYNTAX_CONSTANT},{"NAN", 3, SYNTAX_CONSTANT},{"ULONG_MAX", 9, SYNTAX_CONSTANT},{"thrd_nomem", 10, SYNTAX_CONSTANT},{"UINT_LEAST8_MAX", 15, SYNTAX_CONSTANT},{"_IOLBF", 6, SYNTAX_CONSTANT},{"int_least8_t", 12, SYNTAX_BUILTIN},{"PRIdFAST16", 10, SYNTAX_CONSTANT},{"PRIoLEAST32", 11, SYNTAX_CONSTANT},{"tss_dtor_t", 10, SYNTAX_BUILTIN},{"constraint_handler_t", 20, SYNTAX_BUILTIN},{"intptr_t", 8, SYNTAX_BUILTIN},{"double_t", 8, SYNTAX_BUILTIN},{"char", 4, SYNTAX_KEYWORD},{"PRIx8", 5, SYNTAX_CONSTANT},{"RSIZE_MAX", 9, SYNTAX_CONSTANT},{"EPIPE", 5, SYNTAX_CONSTANT},{"va_list", 7, SYNTAX_BUILTIN},{"uint8_t", 7, SYNTAX_BUILTIN},{"SHRT_MIN", 8, SYNTAX_CONSTANT},{"SCNxLEAST32", 11, SYNTAX_CONSTANT},{"uint32_t", 8, SYNTAX_BUILTIN},{"L_tmpnam", 8, SYNTAX_CONSTANT},{"EPROTONOSUPPORT", 15, SYNTAX_CONSTANT},{"ENOTTY", 6, SYNTAX_CONSTANT},{"ENOTBLK", 7, SYNTAX_CONSTANT},{"ssize_t", 7, SYNTAX_BUILTIN},{"SIGPOLL", 7, SYNTAX_CONSTANT},{"ENXIO", 5, SYNTAX_CONSTANT},{"INT_LEAST8_MAX", 14, SYNTAX_CONSTANT},{"TMP_MAX_S", 9, SYNTAX_CONSTANT},{"uint_least64_t", 14, SYNTAX_BUILTIN},{"FP_FAST_FMAF", 12, SYNTAX_CONSTANT},{"LLONG_MAX", 9, SYNTAX_CONSTANT},{"stdin", 5, SYNTAX_CONSTANT},{"thrd_start_t", 12, SYNTAX_BUILTIN},{"PRIu16", 6, SYNTAX_CONSTANT},{"inline", 6, SYNTAX_KEYWORD},{"SCNdFAST8", 9, SYNTAX_CONSTANT},{"SCNuLEAST64", 11, SYNTAX_CONSTANT},{"PRIxFAST16", 10, SYNTAX_CONSTANT},{"PRIiLEAST16", 11, SYNTAX_CONSTANT},{"INT64_MAX", 9, SYNTAX_CONSTANT},{"INT_FAST64_MAX", 14, SYNTAX_CONSTANT},{"SIGUSR2", 7, SYNTAX_CONSTANT},{"ENOPKG", 6, SYNTAX_CONSTANT},{"FLT_EVAL_METHOD", 15, SYNTAX_CONSTANT},{"ENOSTR", 6, SYNTAX_CONSTANT},{"jmp_buf", 7, SYNTAX_BUILTIN},{"_Noreturn", 9, SYNTAX_KEYWORD},{"EBUSY", 5, SYNTAX_CONSTANT},{"useconds_t", 10, SYNTAX_BUILTIN},{"EINPROGRESS", 11, SYNTAX_CONSTANT},{"PRIdLEAST64", 11, SYNTAX_CONSTANT},{"max_align_t", 11, SYNTAX_BUILTIN},{"MB_LEN_MAX", 10, SYNTAX_CONSTANT},{"atomic_llong", 12, SYNTAX_BUILTIN},{"PRIo16", 6, SYNTAX_CONSTANT},{"PRIo64", 6, SYNTAX_CONSTANT},{"noreturn", 8, SYNTAX_BUILTIN},{"EDESTADDRREQ", 12, SYNTAX_CONSTANT},{"EDOM", 4, SYNTAX_CONSTANT},{"LDBL_MAX_EXP", 12, SYNTAX_CONSTANT},{"EOVERFLOW", 9, SYNTAX_CONSTANT},{"SCNd64", 6, SYNTAX_CONSTANT},{"ATOMIC_CHAR32_T_LOCK_FREE", 25, SYNTAX_CONSTANT},{"memory_order_acquire", 20, SYNTAX_BUILTIN},{"UINT_FAST16_MAX", 15, SYNTAX_CONSTANT},{"EDEADLOCK", 9, SYNTAX_CONSTANT},{"uint_fast8_t", 12, SYNTAX_BUILTIN},{"FE_TOWARDZERO", 13, SYNTAX_CONSTANT},{"_Imaginary", 10, SYNTAX_KEYWORD},{"blksize_t", 9, SYNTAX_BUILTIN},{"INT_FAST32_MIN", 14, SYNTAX_CONSTANT},{"EPERM", 5, SYNTAX_CONSTANT},{"PRIuPTR", 7, SYNTAX_CONSTANT},{"PRIoLEAST16", 11, SYNTAX_CONSTANT},{"ULLONG_MAX", 10, SYNTAX_CONSTANT},{"PRIiLEAST8", 10, SYNTAX_CONSTANT},{"ENOTDIR", 7, SYNTAX_CONSTANT},{"extern", 6, SYNTAX_KEYWORD},{"_Atomic", 7, SYNTAX_KEYWORD},{"SCNd32", 6, SYNTAX_CONSTANT},{"ELIBBAD", 7, SYNTAX_CONSTANT},{"FE_DFL_ENV", 10, SYNTAX_CONSTANT},{"case", 4, SYNTAX_KEYWORD},{"EBADE", 5, SYNTAX_CONSTANT},{"ATOMIC_INT_LOCK_FREE", 20, SYNTAX_CONSTANT},{"PRIXLEAST8", 10, SYNTAX_CONSTANT},{"LDBL_DIG", 8, SYNTAX_CONSTANT},{"size_t", 6, SYNTAX_BUILTIN},{"ENOMEM", 6, SYNTAX_CONSTANT},{"uint_fast32_t", 13, SYNTAX_BUILTIN},{"atomic_uint_fast32_t", 20, SYNTAX_BUILTIN},{"uintmax_t", 9, SYNTAX_BUILTIN},{"PRIiLEAST64", 11, SYNTAX_CONSTANT},{"ENOANO", 6, SYNTAX_CONSTANT},{"FLT_MANT_DIG", 12, SYNTAX_CONSTANT},{"ENOCSI", 6, SYNTAX_CONSTANT},{"atomic_int_fast64_t", 19, SYNTAX_BUILTIN},{"ETIME", 5, SYNTAX_CONSTANT},{"INTMAX_MAX", 10, SYNTAX_CONSTANT},{"ESOCKTNOSUPPORT", 15, SYNTAX_CONSTANT},{"int32_t", 7, SYNTAX_BUILTIN},{"enum", 4, SYNTAX_KEYWORD},{"atomic_uint_least8_t", 20, SYNTAX_BUILTIN},{"div_t", 5, SYNTAX_BUILTIN},{"wchar_t", 7, SYNTAX_BUILTIN},{"ENETDOWN", 8, SYNTAX_CONSTANT},{"SIGCONT", 7, SYNTAX_CONSTANT},{"uint64_t", 8, SYNTAX_BUILTIN},{"DBL_TRUE_MIN", 12, SYNTAX_CONSTANT},{"INTMAX_MIN", 10, SYNTAX_CONSTANT},{"daddr_t", 7, SYNTAX_BUILTIN},{"SCNiFAST16", 10, SYNTAX_CONSTANT},{"EDOTDOT", 7, SYNTAX_CONSTANT},{"PRIX16", 6, SYNTAX_CONSTANT},{"FLT_DECIMAL_DIG", 15, SYNTAX_CONSTANT},{"SIGQUIT", 7, SYNTAX_CONSTANT},{"MB_CUR_MAX", 10, SYNTAX_CONSTANT},{"_IOFBF", 6, SYNTAX_CONSTANT},{"ATOMIC_LONG_LOCK_FREE", 21, SYNTAX_CONSTANT}};
+static const u16 syntax_keyword_displacements_c[231] = {1,1,0,0,27,3,11,8,9,13,22,6,26,61,2,0,8,50,14,16,22,1,0,10,54,1,1,18,2,10,17,9,48,64,6,2,9,1,1,2,22,1,0,0,23,11,5,17,12,11,22,16,9,6,44,10,2,0,41,19,7,4,1,31,35,38,6,6,0,0,15,0,3,3,0,29,20,20,0,0,0,5,4,104,5,3,35,13,5,24,2,7,0,52,8,5,3,0,17,16,5,7,34,10,119,10,93,8,28,6,37,48,38,15,24,22,8,4,0,15,23,0,28,0,4,40,11,4,55,6,126,73,39,61,20,121,48,1,0,28,61,15,44,22,3,15,30,8,50,1,3,108,20,4,1,0,75,0,79,6,0,10,10,9,66,51,7,62,29,4,580,4,10,210,46,0,31,94,6,5,34,0,3,169,53,120,47,283,3,161,42,35,2,55,243,38,42,78,505,187,72,401,665,1,99,2,5,183,11,48,45,109,13,30,25,120,51,456,14,0,0,14,0,48,4,160,38,4,51,515,147};
+static const KeywordTable syntax_all_keywords_c = {
+	syntax_keywords_c, syntax_keyword_displacements_c, 693, 231, 9,
+	{-3, -5, -2, 3, -13, 11, 1, 6, 2},
+	{0x7b57b045u, 0x3dba2031u, 0x94fe88f3u, 0xa8b74ba7u, 0xea54ab27u, 0x59345c7du, 0x27be7221u, 0xed63f8f3u, 0x5c8b7de1u}
 };
 
-static const Keyword syntax_keywords_cpp_A[10] = {{"ATOMIC_ADDRESS_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR16_T_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR32_T_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_CHAR_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_FLAG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_INT_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_LLONG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_LONG_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_SHORT_LOCK_FREE", SYNTAX_CONSTANT},{"ATOMIC_WCHAR_T_LOCK_FREE", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_B[1] = {{"BUFSIZ", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_C[4] = {{"CHAR_BIT", SYNTAX_CONSTANT},{"CHAR_MAX", SYNTAX_CONSTANT},{"CHAR_MIN", SYNTAX_CONSTANT},{"CLOCKS_PER_SEC", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_D[11] = {{"DBL_DIG", SYNTAX_CONSTANT},{"DBL_EPSILON", SYNTAX_CONSTANT},{"DBL_HAS_SUBNORM", SYNTAX_CONSTANT},{"DBL_MANT_DIG", SYNTAX_CONSTANT},{"DBL_MAX", SYNTAX_CONSTANT},{"DBL_MAX_10_EXP", SYNTAX_CONSTANT},{"DBL_MAX_EXP", SYNTAX_CONSTANT},{"DBL_MIN", SYNTAX_CONSTANT},{"DBL_MIN_EXP", SYNTAX_CONSTANT},{"DBL_TRUE_MIN", SYNTAX_CONSTANT},{"DECIMAL_DIG", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_E[127] = {{"E2BIG", SYNTAX_CONSTANT},{"EACCES", SYNTAX_CONSTANT},{"EADDRINUSE", SYNTAX_CONSTANT},{"EADDRNOTAVAIL", SYNTAX_CONSTANT},{"EADV", SYNTAX_CONSTANT},{"EAFNOSUPPORT", SYNTAX_CONSTANT},{"EAGAIN", SYNTAX_CONSTANT},{"EALREADY", SYNTAX_CONSTANT},{"EBADE", SYNTAX_CONSTANT},{"EBADF", SYNTAX_CONSTANT},{"EBADFD", SYNTAX_CONSTANT},{"EBADMSG", SYNTAX_CONSTANT},{"EBADR", SYNTAX_CONSTANT},{"EBADRQC", SYNTAX_CONSTANT},{"EBADSLT", SYNTAX_CONSTANT},{"EBFONT", SYNTAX_CONSTANT},{"EBUSY", SYNTAX_CONSTANT},{"ECHILD", SYNTAX_CONSTANT},{"ECHRNG", SYNTAX_CONSTANT},{"ECOMM", SYNTAX_CONSTANT},{"ECONNABORTED", SYNTAX_CONSTANT},{"ECONNREFUSED", SYNTAX_CONSTANT},{"ECONNRESET", SYNTAX_CONSTANT},{"EDEADLK", SYNTAX_CONSTANT},{"EDEADLOCK", SYNTAX_CONSTANT},{"EDESTADDRREQ", SYNTAX_CONSTANT},{"EDOM", SYNTAX_CONSTANT},{"EDOTDOT", SYNTAX_CONSTANT},{"EDQUOT", SYNTAX_CONSTANT},{"EEXIST", SYNTAX_CONSTANT},{"EFAULT", SYNTAX_CONSTANT},{"EFBIG", SYNTAX_CONSTANT},{"EHOSTDOWN", SYNTAX_CONSTANT},{"EHOSTUNREACH", SYNTAX_CONSTANT},{"EIDRM", SYNTAX_CONSTANT},{"EILSEQ", SYNTAX_CONSTANT},{"EINPROGRESS", SYNTAX_CONSTANT},{"EINTR", SYNTAX_CONSTANT},{"EINVAL", SYNTAX_CONSTANT},{"EIO", SYNTAX_CONSTANT},{"EISCONN", SYNTAX_CONSTANT},{"EISDIR", SYNTAX_CONSTANT},{"EISNAM", SYNTAX_CONSTANT},{"EL2HLT", SYNTAX_CONSTANT},{"EL2NSYNC", SYNTAX_CONSTANT},{"EL3HLT", SYNTAX_CONSTANT},{"EL3RST", SYNTAX_CONSTANT},{"ELIBACC", SYNTAX_CONSTANT},{"ELIBBAD", SYNTAX_CONSTANT},{"ELIBEXEC", SYNTAX_CONSTANT},{"ELIBMAX", SYNTAX_CONSTANT},{"ELIBSCN", SYNTAX_CONSTANT},{"ELNRNG", SYNTAX_CONSTANT},{"ELOOP", SYNTAX_CONSTANT},{"EMEDIUMTYPE", SYNTAX_CONSTANT},{"EMFILE", SYNTAX_CONSTANT},{"EMLINK", SYNTAX_CONSTANT},{"EMSGSIZE", SYNTAX_CONSTANT},{"EMULTIHOP", SYNTAX_CONSTANT},{"ENAMETOOLONG", SYNTAX_CONSTANT},{"ENAVAIL", SYNTAX_CONSTANT},{"ENETDOWN", SYNTAX_CONSTANT},{"ENETRESET", SYNTAX_CONSTANT},{"ENETUNREACH", SYNTAX_CONSTANT},{"ENFILE", SYNTAX_CONSTANT},{"ENOANO", SYNTAX_CONSTANT},{"ENOBUFS", SYNTAX_CONSTANT},{"ENOCSI", SYNTAX_CONSTANT},{"ENODATA", SYNTAX_CONSTANT},{"ENODEV", SYNTAX_CONSTANT},{"ENOENT", SYNTAX_CONSTANT},{"ENOEXEC", SYNTAX_CONSTANT},{"ENOLCK", SYNTAX_CONSTANT},{"ENOLINK", SYNTAX_CONSTANT},{"ENOMEDIUM", SYNTAX_CONSTANT},{"ENOMEM", SYNTAX_CONSTANT},{"ENOMSG", SYNTAX_CONSTANT},{"ENONET", SYNTAX_CONSTANT},{"ENOPKG", SYNTAX_CONSTANT},{"ENOPROTOOPT", SYNTAX_CONSTANT},{"ENOSPC", SYNTAX_CONSTANT},{"ENOSR", SYNTAX_CONSTANT},{"ENOSTR", SYNTAX_CONSTANT},{"ENOSYS", SYNTAX_CONSTANT},{"ENOTBLK", SYNTAX_CONSTANT},{"ENOTCONN", SYNTAX_CONSTANT},{"ENOTDIR", SYNTAX_CONSTANT},{"ENOTEMPTY", SYNTAX_CONSTANT},{"ENOTNAM", SYNTAX_CONSTANT},{"ENOTSOCK", SYNTAX_CONSTANT},{"ENOTTY", SYNTAX_CONSTANT},{"ENOTUNIQ", SYNTAX_CONSTANT},{"ENXIO", SYNTAX_CONSTANT},{"EOF", SYNTAX_CONSTANT},{"EOPNOTSUPP", SYNTAX_CONSTANT},{"EOVERFLOW", SYNTAX_CONSTANT},{"EPERM", SYNTAX_CONSTANT},{"EPFNOSUPPORT", SYNTAX_CONSTANT},{"EPIPE", SYNTAX_CONSTANT},{"EPROTO", SYNTAX_CONSTANT},{"EPROTONOSUPPORT", SYNTAX_CONSTANT},{"EPROTOTYPE", SYNTAX_CONSTANT},{"ERANGE", SYNTAX_CONSTANT},{"EREMCHG", SYNTAX_CONSTANT},{"EREMOTE", SYNTAX_CONSTANT},{"EREMOTEIO", SYNTAX_CONSTANT},{"ERESTART", SYNTAX_CONSTANT},{"EROFS", SYNTAX_CONSTANT},{"ESHUTDOWN", SYNTAX_CONSTANT},{"ESOCKTNOSUPPORT", SYNTAX_CONSTANT},{"ESPIPE", SYNTAX_CONSTANT},{"ESRCH", SYNTAX_CONSTANT},{"ESRMNT", SYNTAX_CONSTANT},{"ESTALE", SYNTAX_CONSTANT},{"ESTRPIPE", SYNTAX_CONSTANT},{"ETIME", SYNTAX_CONSTANT},{"ETIMEDOUT", SYNTAX_CONSTANT},{"ETOOMANYREFS", SYNTAX_CONSTANT},{"ETXTBSY", SYNTAX_CONSTANT},{"EUCLEAN", SYNTAX_CONSTANT},{"EUNATCH", SYNTAX_CONSTANT},{"EUSERS", SYNTAX_CONSTANT},{"EWOULDBLOCK", SYNTAX_CONSTANT},{"EXDEV", SYNTAX_CONSTANT},{"EXFULL", SYNTAX_CONSTANT},{"EXIT_FAILURE", SYNTAX_CONSTANT},{"EXIT_SUCCESS", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_F[38] = {{"FE_ALL_EXCEPT", SYNTAX_CONSTANT},{"FE_DFL_ENV", SYNTAX_CONSTANT},{"FE_DIVBYZERO", SYNTAX_CONSTANT},{"FE_DOWNWARD", SYNTAX_CONSTANT},{"FE_INEXACT", SYNTAX_CONSTANT},{"FE_INVALID", SYNTAX_CONSTANT},{"FE_OVERFLOW", SYNTAX_CONSTANT},{"FE_TONEAREST", SYNTAX_CONSTANT},{"FE_TOWARDZERO", SYNTAX_CONSTANT},{"FE_UNDERFLOW", SYNTAX_CONSTANT},{"FE_UPWARD", SYNTAX_CONSTANT},{"FILE", SYNTAX_BUILTIN},{"FILENAME_MAX", SYNTAX_CONSTANT},{"FLT_DECIMAL_DIG", SYNTAX_CONSTANT},{"FLT_DIG", SYNTAX_CONSTANT},{"FLT_EVAL_METHOD", SYNTAX_CONSTANT},{"FLT_HAS_SUBNORM", SYNTAX_CONSTANT},{"FLT_MANT_DIG", SYNTAX_CONSTANT},{"FLT_MAX", SYNTAX_CONSTANT},{"FLT_MAX_10_EXP", SYNTAX_CONSTANT},{"FLT_MAX_EXP", SYNTAX_CONSTANT},{"FLT_MIN", SYNTAX_CONSTANT},{"FLT_MIN_10_EXP", SYNTAX_CONSTANT},{"FLT_MIN_EXP", SYNTAX_CONSTANT},{"FLT_RADIX", SYNTAX_CONSTANT},{"FLT_ROUNDS", SYNTAX_CONSTANT},{"FLT_TRUE_MIN", SYNTAX_CONSTANT},{"FOPEN_MAX", SYNTAX_CONSTANT},{"FP_FAST_FMA", SYNTAX_CONSTANT},{"FP_FAST_FMAF", SYNTAX_CONSTANT},{"FP_FAST_FMAL", SYNTAX_CONSTANT},{"FP_ILOGB0", SYNTAX_CONSTANT},{"FP_ILOGBNAN", SYNTAX_CONSTANT},{"FP_INFINITE", SYNTAX_CONSTANT},{"FP_NAN", SYNTAX_CONSTANT},{"FP_NORMAL", SYNTAX_CONSTANT},{"FP_SUBNORMAL", SYNTAX_CONSTANT},{"FP_ZERO", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_H[3] = {{"HUGE_VAL", SYNTAX_CONSTANT},{"HUGE_VALF", SYNTAX_CONSTANT},{"HUGE_VALL", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_I[32] = {{"I", SYNTAX_CONSTANT},{"INFINITY", SYNTAX_CONSTANT},{"INT16_MAX", SYNTAX_CONSTANT},{"INT16_MIN", SYNTAX_CONSTANT},{"INT32_MAX", SYNTAX_CONSTANT},{"INT32_MIN", SYNTAX_CONSTANT},{"INT64_MAX", SYNTAX_CONSTANT},{"INT64_MIN", SYNTAX_CONSTANT},{"INT8_MAX", SYNTAX_CONSTANT},{"INT8_MIN", SYNTAX_CONSTANT},{"INTMAX_MAX", SYNTAX_CONSTANT},{"INTMAX_MIN", SYNTAX_CONSTANT},{"INTPTR_MAX", SYNTAX_CONSTANT},{"INTPTR_MIN", SYNTAX_CONSTANT},{"INT_FAST16_MAX", SYNTAX_CONSTANT},{"INT_FAST16_MIN", SYNTAX_CONSTANT},{"INT_FAST32_MAX", SYNTAX_CONSTANT},{"INT_FAST32_MIN", SYNTAX_CONSTANT},{"INT_FAST64_MAX", SYNTAX_CONSTANT},{"INT_FAST64_MIN", SYNTAX_CONSTANT},{"INT_FAST8_MAX", SYNTAX_CONSTANT},{"INT_FAST8_MIN", SYNTAX_CONSTANT},{"INT_LEAST16_MAX", SYNTAX_CONSTANT},{"INT_LEAST16_MIN", SYNTAX_CONSTANT},{"INT_LEAST32_MAX", SYNTAX_CONSTANT},{"INT_LEAST32_MIN", SYNTAX_CONSTANT},{"INT_LEAST64_MAX", SYNTAX_CONSTANT},{"INT_LEAST64_MIN", SYNTAX_CONSTANT},{"INT_LEAST8_MAX", SYNTAX_CONSTANT},{"INT_LEAST8_MIN", SYNTAX_CONSTANT},{"INT_MAX", SYNTAX_CONSTANT},{"INT_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_L[22] = {{"LC_ALL", SYNTAX_CONSTANT},{"LC_COLLATE", SYNTAX_CONSTANT},{"LC_CTYPE", SYNTAX_CONSTANT},{"LC_MONETARY", SYNTAX_CONSTANT},{"LC_NUMERIC", SYNTAX_CONSTANT},{"LC_TIME", SYNTAX_CONSTANT},{"LDBL_DECIMAL_DIG", SYNTAX_CONSTANT},{"LDBL_DIG", SYNTAX_CONSTANT},{"LDBL_EPSILON", SYNTAX_CONSTANT},{"LDBL_MANT_DIG", SYNTAX_CONSTANT},{"LDBL_MAX", SYNTAX_CONSTANT},{"LDBL_MAX_10_EXP", SYNTAX_CONSTANT},{"LDBL_MAX_EXP", SYNTAX_CONSTANT},{"LDBL_MIN", SYNTAX_CONSTANT},{"LDBL_MIN_10_EXP", SYNTAX_CONSTANT},{"LDBL_MIN_EXP", SYNTAX_CONSTANT},{"LDBL_TRUE_MIN", SYNTAX_CONSTANT},{"LLONG_MAX", SYNTAX_CONSTANT},{"LLONG_MIN", SYNTAX_CONSTANT},{"LONG_MAX", SYNTAX_CONSTANT},{"LONG_MIN", SYNTAX_CONSTANT},{"L_tmpnam", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_M[4] = {{"MATH_ERREXCEPT", SYNTAX_CONSTANT},{"MATH_ERRNO", SYNTAX_CONSTANT},{"MB_CUR_MAX", SYNTAX_CONSTANT},{"MB_LEN_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_N[3] = {{"NAN", SYNTAX_CONSTANT},{"NDEBUG", SYNTAX_CONSTANT},{"NULL", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_O[1] = {{"ONCE_FLAG_INIT", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_P[86] = {{"PRIX16", SYNTAX_CONSTANT},{"PRIX32", SYNTAX_CONSTANT},{"PRIX64", SYNTAX_CONSTANT},{"PRIX8", SYNTAX_CONSTANT},{"PRIXFAST16", SYNTAX_CONSTANT},{"PRIXFAST32", SYNTAX_CONSTANT},{"PRIXFAST64", SYNTAX_CONSTANT},{"PRIXFAST8", SYNTAX_CONSTANT},{"PRIXLEAST16", SYNTAX_CONSTANT},{"PRIXLEAST32", SYNTAX_CONSTANT},{"PRIXLEAST64", SYNTAX_CONSTANT},{"PRIXLEAST8", SYNTAX_CONSTANT},{"PRIXMAX", SYNTAX_CONSTANT},{"PRIXPTR", SYNTAX_CONSTANT},{"PRId16", SYNTAX_CONSTANT},{"PRId32", SYNTAX_CONSTANT},{"PRId64", SYNTAX_CONSTANT},{"PRId8", SYNTAX_CONSTANT},{"PRIdFAST16", SYNTAX_CONSTANT},{"PRIdFAST32", SYNTAX_CONSTANT},{"PRIdFAST64", SYNTAX_CONSTANT},{"PRIdFAST8", SYNTAX_CONSTANT},{"PRIdLEAST16", SYNTAX_CONSTANT},{"PRIdLEAST32", SYNTAX_CONSTANT},{"PRIdLEAST64", SYNTAX_CONSTANT},{"PRIdLEAST8", SYNTAX_CONSTANT},{"PRIdMAX", SYNTAX_CONSTANT},{"PRIdPTR", SYNTAX_CONSTANT},{"PRIi16", SYNTAX_CONSTANT},{"PRIi32", SYNTAX_CONSTANT},{"PRIi64", SYNTAX_CONSTANT},{"PRIi8", SYNTAX_CONSTANT},{"PRIiFAST16", SYNTAX_CONSTANT},{"PRIiFAST32", SYNTAX_CONSTANT},{"PRIiFAST64", SYNTAX_CONSTANT},{"PRIiFAST8", SYNTAX_CONSTANT},{"PRIiLEAST16", SYNTAX_CONSTANT},{"PRIiLEAST32", SYNTAX_CONSTANT},{"PRIiLEAST64", SYNTAX_CONSTANT},{"PRIiLEAST8", SYNTAX_CONSTANT},{"PRIiMAX", SYNTAX_CONSTANT},{"PRIiPTR", SYNTAX_CONSTANT},{"PRIo16", SYNTAX_CONSTANT},{"PRIo32", SYNTAX_CONSTANT},{"PRIo64", SYNTAX_CONSTANT},{"PRIo8", SYNTAX_CONSTANT},{"PRIoFAST16", SYNTAX_CONSTANT},{"PRIoFAST32", SYNTAX_CONSTANT},{"PRIoFAST64", SYNTAX_CONSTANT},{"PRIoFAST8", SYNTAX_CONSTANT},{"PRIoLEAST16", SYNTAX_CONSTANT},{"PRIoLEAST32", SYNTAX_CONSTANT},{"PRIoLEAST64", SYNTAX_CONSTANT},{"PRIoLEAST8", SYNTAX_CONSTANT},{"PRIoMAX", SYNTAX_CONSTANT},{"PRIoPTR", SYNTAX_CONSTANT},{"PRIu16", SYNTAX_CONSTANT},{"PRIu32", SYNTAX_CONSTANT},{"PRIu64", SYNTAX_CONSTANT},{"PRIu8", SYNTAX_CONSTANT},{"PRIuFAST16", SYNTAX_CONSTANT},{"PRIuFAST32", SYNTAX_CONSTANT},{"PRIuFAST64", SYNTAX_CONSTANT},{"PRIuFAST8", SYNTAX_CONSTANT},{"PRIuLEAST16", SYNTAX_CONSTANT},{"PRIuLEAST32", SYNTAX_CONSTANT},{"PRIuLEAST64", SYNTAX_CONSTANT},{"PRIuLEAST8", SYNTAX_CONSTANT},{"PRIuMAX", SYNTAX_CONSTANT},{"PRIuPTR", SYNTAX_CONSTANT},{"PRIx16", SYNTAX_CONSTANT},{"PRIx32", SYNTAX_CONSTANT},{"PRIx64", SYNTAX_CONSTANT},{"PRIx8", SYNTAX_CONSTANT},{"PRIxFAST16", SYNTAX_CONSTANT},{"PRIxFAST32", SYNTAX_CONSTANT},{"PRIxFAST64", SYNTAX_CONSTANT},{"PRIxFAST8", SYNTAX_CONSTANT},{"PRIxLEAST16", SYNTAX_CONSTANT},{"PRIxLEAST32", SYNTAX_CONSTANT},{"PRIxLEAST64", SYNTAX_CONSTANT},{"PRIxLEAST8", SYNTAX_CONSTANT},{"PRIxMAX", SYNTAX_CONSTANT},{"PRIxPTR", SYNTAX_CONSTANT},{"PTRDIFF_MAX", SYNTAX_CONSTANT},{"PTRDIFF_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_R[1] = {{"RSIZE_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_S[121] = {{"SCHAR_MAX", SYNTAX_CONSTANT},{"SCHAR_MIN", SYNTAX_CONSTANT},{"SCNd16", SYNTAX_CONSTANT},{"SCNd32", SYNTAX_CONSTANT},{"SCNd64", SYNTAX_CONSTANT},{"SCNd8", SYNTAX_CONSTANT},{"SCNdFAST16", SYNTAX_CONSTANT},{"SCNdFAST32", SYNTAX_CONSTANT},{"SCNdFAST64", SYNTAX_CONSTANT},{"SCNdFAST8", SYNTAX_CONSTANT},{"SCNdLEAST16", SYNTAX_CONSTANT},{"SCNdLEAST32", SYNTAX_CONSTANT},{"SCNdLEAST64", SYNTAX_CONSTANT},{"SCNdLEAST8", SYNTAX_CONSTANT},{"SCNdMAX", SYNTAX_CONSTANT},{"SCNdPTR", SYNTAX_CONSTANT},{"SCNi16", SYNTAX_CONSTANT},{"SCNi32", SYNTAX_CONSTANT},{"SCNi64", SYNTAX_CONSTANT},{"SCNi8", SYNTAX_CONSTANT},{"SCNiFAST16", SYNTAX_CONSTANT},{"SCNiFAST32", SYNTAX_CONSTANT},{"SCNiFAST64", SYNTAX_CONSTANT},{"SCNiFAST8", SYNTAX_CONSTANT},{"SCNiLEAST16", SYNTAX_CONSTANT},{"SCNiLEAST32", SYNTAX_CONSTANT},{"SCNiLEAST64", SYNTAX_CONSTANT},{"SCNiLEAST8", SYNTAX_CONSTANT},{"SCNiMAX", SYNTAX_CONSTANT},{"SCNiPTR", SYNTAX_CONSTANT},{"SCNo16", SYNTAX_CONSTANT},{"SCNo32", SYNTAX_CONSTANT},{"SCNo64", SYNTAX_CONSTANT},{"SCNo8", SYNTAX_CONSTANT},{"SCNoFAST16", SYNTAX_CONSTANT},{"SCNoFAST32", SYNTAX_CONSTANT},{"SCNoFAST64", SYNTAX_CONSTANT},{"SCNoFAST8", SYNTAX_CONSTANT},{"SCNoLEAST16", SYNTAX_CONSTANT},{"SCNoLEAST32", SYNTAX_CONSTANT},{"SCNoLEAST64", SYNTAX_CONSTANT},{"SCNoLEAST8", SYNTAX_CONSTANT},{"SCNoMAX", SYNTAX_CONSTANT},{"SCNoPTR", SYNTAX_CONSTANT},{"SCNu16", SYNTAX_CONSTANT},{"SCNu32", SYNTAX_CONSTANT},{"SCNu64", SYNTAX_CONSTANT},{"SCNu8", SYNTAX_CONSTANT},{"SCNuFAST16", SYNTAX_CONSTANT},{"SCNuFAST32", SYNTAX_CONSTANT},{"SCNuFAST64", SYNTAX_CONSTANT},{"SCNuFAST8", SYNTAX_CONSTANT},{"SCNuLEAST16", SYNTAX_CONSTANT},{"SCNuLEAST32", SYNTAX_CONSTANT},{"SCNuLEAST64", SYNTAX_CONSTANT},{"SCNuLEAST8", SYNTAX_CONSTANT},{"SCNuMAX", SYNTAX_CONSTANT},{"SCNuPTR", SYNTAX_CONSTANT},{"SCNx16", SYNTAX_CONSTANT},{"SCNx32", SYNTAX_CONSTANT},{"SCNx64", SYNTAX_CONSTANT},{"SCNx8", SYNTAX_CONSTANT},{"SCNxFAST16", SYNTAX_CONSTANT},{"SCNxFAST32", SYNTAX_CONSTANT},{"SCNxFAST64", SYNTAX_CONSTANT},{"SCNxFAST8", SYNTAX_CONSTANT},{"SCNxLEAST16", SYNTAX_CONSTANT},{"SCNxLEAST32", SYNTAX_CONSTANT},{"SCNxLEAST64", SYNTAX_CONSTANT},{"SCNxLEAST8", SYNTAX_CONSTANT},{"SCNxMAX", SYNTAX_CONSTANT},{"SCNxPTR", SYNTAX_CONSTANT},{"SEEK_CUR", SYNTAX_CONSTANT},{"SEEK_END", SYNTAX_CONSTANT},{"SEEK_SET", SYNTAX_CONSTANT},{"SHRT_MAX", SYNTAX_CONSTANT},{"SHRT_MIN", SYNTAX_CONSTANT},{"SIGABRT", SYNTAX_CONSTANT},{"SIGALRM", SYNTAX_CONSTANT},{"SIGBUS", SYNTAX_CONSTANT},{"SIGCHLD", SYNTAX_CONSTANT},{"SIGCLD", SYNTAX_CONSTANT},{"SIGCONT", SYNTAX_CONSTANT},{"SIGEMT", SYNTAX_CONSTANT},{"SIGFPE", SYNTAX_CONSTANT},{"SIGHUP", SYNTAX_CONSTANT},{"SIGILL", SYNTAX_CONSTANT},{"SIGINFO", SYNTAX_CONSTANT},{"SIGINT", SYNTAX_CONSTANT},{"SIGIO", SYNTAX_CONSTANT},{"SIGIOT", SYNTAX_CONSTANT},{"SIGKILL", SYNTAX_CONSTANT},{"SIGLOST", SYNTAX_CONSTANT},{"SIGPIPE", SYNTAX_CONSTANT},{"SIGPOLL", SYNTAX_CONSTANT},{"SIGPROF", SYNTAX_CONSTANT},{"SIGPWR", SYNTAX_CONSTANT},{"SIGQUIT", SYNTAX_CONSTANT},{"SIGSEGV", SYNTAX_CONSTANT},{"SIGSTKFLT", SYNTAX_CONSTANT},{"SIGSTOP", SYNTAX_CONSTANT},{"SIGSYS", SYNTAX_CONSTANT},{"SIGTERM", SYNTAX_CONSTANT},{"SIGTRAP", SYNTAX_CONSTANT},{"SIGTSTP", SYNTAX_CONSTANT},{"SIGTTIN", SYNTAX_CONSTANT},{"SIGTTOU", SYNTAX_CONSTANT},{"SIGUNUSED", SYNTAX_CONSTANT},{"SIGURG", SYNTAX_CONSTANT},{"SIGUSR1", SYNTAX_CONSTANT},{"SIGUSR2", SYNTAX_CONSTANT},{"SIGVTALRM", SYNTAX_CONSTANT},{"SIGWINCH", SYNTAX_CONSTANT},{"SIGXCPU", SYNTAX_CONSTANT},{"SIGXFSZ", SYNTAX_CONSTANT},{"SIG_ATOMIC_MAX", SYNTAX_CONSTANT},{"SIG_ATOMIC_MIN", SYNTAX_CONSTANT},{"SIG_DFL", SYNTAX_CONSTANT},{"SIG_ERR", SYNTAX_CONSTANT},{"SIG_IGN", SYNTAX_CONSTANT},{"SIZE_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_T[4] = {{"TIME_UTC", SYNTAX_CONSTANT},{"TMP_MAX", SYNTAX_CONSTANT},{"TMP_MAX_S", SYNTAX_CONSTANT},{"TSS_DTOR_ITERATIONS", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_U[19] = {{"UCHAR_MAX", SYNTAX_CONSTANT},{"UINT16_MAX", SYNTAX_CONSTANT},{"UINT32_MAX", SYNTAX_CONSTANT},{"UINT64_MAX", SYNTAX_CONSTANT},{"UINT8_MAX", SYNTAX_CONSTANT},{"UINTMAX_MAX", SYNTAX_CONSTANT},{"UINTPTR_MAX", SYNTAX_CONSTANT},{"UINT_FAST16_MAX", SYNTAX_CONSTANT},{"UINT_FAST32_MAX", SYNTAX_CONSTANT},{"UINT_FAST64_MAX", SYNTAX_CONSTANT},{"UINT_FAST8_MAX", SYNTAX_CONSTANT},{"UINT_LEAST16_MAX", SYNTAX_CONSTANT},{"UINT_LEAST32_MAX", SYNTAX_CONSTANT},{"UINT_LEAST64_MAX", SYNTAX_CONSTANT},{"UINT_LEAST8_MAX", SYNTAX_CONSTANT},{"UINT_MAX", SYNTAX_CONSTANT},{"ULLONG_MAX", SYNTAX_CONSTANT},{"ULONG_MAX", SYNTAX_CONSTANT},{"USHRT_MAX", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_W[5] = {{"WCHAR_MAX", SYNTAX_CONSTANT},{"WCHAR_MIN", SYNTAX_CONSTANT},{"WEOF", SYNTAX_CONSTANT},{"WINT_MAX", SYNTAX_CONSTANT},{"WINT_MIN", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_cpp_x5f[13] = {{"_Alignas", SYNTAX_KEYWORD},{"_Alignof", SYNTAX_KEYWORD},{"_Atomic", SYNTAX_KEYWORD},{"_Bool", SYNTAX_KEYWORD},{"_Complex", SYNTAX_KEYWORD},{"_Generic", SYNTAX_KEYWORD},{"_IOFBF", SYNTAX_CONSTANT},{"_IOLBF", SYNTAX_CONSTANT},{"_IONBF", SYNTAX_CONSTANT},{"_Imaginary", SYNTAX_KEYWORD},{"_Noreturn", SYNTAX_KEYWORD},{"_Static_assert", SYNTAX_KEYWORD},{"_Thread_local", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_a[48] = {{"alignas", SYNTAX_BUILTIN},{"alignof", SYNTAX_BUILTIN},{"and", SYNTAX_KEYWORD},{"and_eq", SYNTAX_KEYWORD},{"asm", SYNTAX_KEYWORD},{"atomic_address", SYNTAX_BUILTIN},{"atomic_bool", SYNTAX_BUILTIN},{"atomic_cancel", SYNTAX_KEYWORD},{"atomic_char", SYNTAX_BUILTIN},{"atomic_char16_t", SYNTAX_BUILTIN},{"atomic_char32_t", SYNTAX_BUILTIN},{"atomic_commit", SYNTAX_KEYWORD},{"atomic_flag", SYNTAX_BUILTIN},{"atomic_int", SYNTAX_BUILTIN},{"atomic_int_fast16_t", SYNTAX_BUILTIN},{"atomic_int_fast32_t", SYNTAX_BUILTIN},{"atomic_int_fast64_t", SYNTAX_BUILTIN},{"atomic_int_fast8_t", SYNTAX_BUILTIN},{"atomic_int_least16_t", SYNTAX_BUILTIN},{"atomic_int_least32_t", SYNTAX_BUILTIN},{"atomic_int_least64_t", SYNTAX_BUILTIN},{"atomic_int_least8_t", SYNTAX_BUILTIN},{"atomic_intmax_t", SYNTAX_BUILTIN},{"atomic_intptr_t", SYNTAX_BUILTIN},{"atomic_llong", SYNTAX_BUILTIN},{"atomic_long", SYNTAX_BUILTIN},{"atomic_noexcept", SYNTAX_KEYWORD},{"atomic_ptrdiff_t", SYNTAX_BUILTIN},{"atomic_schar", SYNTAX_BUILTIN},{"atomic_short", SYNTAX_BUILTIN},{"atomic_size_t", SYNTAX_BUILTIN},{"atomic_uchar", SYNTAX_BUILTIN},{"atomic_uint", SYNTAX_BUILTIN},{"atomic_uint_fast16_t", SYNTAX_BUILTIN},{"atomic_uint_fast32_t", SYNTAX_BUILTIN},{"atomic_uint_fast64_t", SYNTAX_BUILTIN},{"atomic_uint_fast8_t", SYNTAX_BUILTIN},{"atomic_uint_least16_t", SYNTAX_BUILTIN},{"atomic_uint_least32_t", SYNTAX_BUILTIN},{"atomic_uint_least64_t", SYNTAX_BUILTIN},{"atomic_uint_least8_t", SYNTAX_BUILTIN},{"atomic_uintmax_t", SYNTAX_BUILTIN},{"atomic_uintptr_t", SYNTAX_BUILTIN},{"atomic_ullong", SYNTAX_BUILTIN},{"atomic_ulong", SYNTAX_BUILTIN},{"atomic_ushort", SYNTAX_BUILTIN},{"atomic_wchar_t", SYNTAX_BUILTIN},{"auto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_b[7] = {{"bitand", SYNTAX_KEYWORD},{"bitor", SYNTAX_KEYWORD},{"blkcnt64_t", SYNTAX_BUILTIN},{"blkcnt_t", SYNTAX_BUILTIN},{"blksize_t", SYNTAX_BUILTIN},{"bool", SYNTAX_KEYWORD},{"break", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_c[23] = {{"caddr_t", SYNTAX_BUILTIN},{"case", SYNTAX_KEYWORD},{"catch", SYNTAX_KEYWORD},{"char", SYNTAX_KEYWORD},{"char16_t", SYNTAX_BUILTIN},{"char32_t", SYNTAX_BUILTIN},{"char8_t", SYNTAX_BUILTIN},{"class", SYNTAX_KEYWORD},{"clock_t", SYNTAX_BUILTIN},{"cnd_t", SYNTAX_BUILTIN},{"co_await", SYNTAX_KEYWORD},{"co_return", SYNTAX_KEYWORD},{"co_yield", SYNTAX_KEYWORD},{"compl", SYNTAX_KEYWORD},{"complex", SYNTAX_BUILTIN},{"concept", SYNTAX_KEYWORD},{"const", SYNTAX_KEYWORD},{"const_cast", SYNTAX_KEYWORD},{"consteval", SYNTAX_KEYWORD},{"constexpr", SYNTAX_KEYWORD},{"constinit", SYNTAX_KEYWORD},{"constraint_handler_t", SYNTAX_BUILTIN},{"continue", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_d[10] = {{"daddr_t", SYNTAX_BUILTIN},{"decltype", SYNTAX_KEYWORD},{"default", SYNTAX_KEYWORD},{"delete", SYNTAX_KEYWORD},{"dev_t", SYNTAX_BUILTIN},{"div_t", SYNTAX_BUILTIN},{"do", SYNTAX_KEYWORD},{"double", SYNTAX_KEYWORD},{"double_t", SYNTAX_BUILTIN},{"dynamic_cast", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_e[6] = {{"else", SYNTAX_KEYWORD},{"enum", SYNTAX_KEYWORD},{"errno_t", SYNTAX_BUILTIN},{"explicit", SYNTAX_KEYWORD},{"export", SYNTAX_KEYWORD},{"extern", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_f[12] = {{"false", SYNTAX_CONSTANT},{"fenv_t", SYNTAX_BUILTIN},{"fexcept_t", SYNTAX_BUILTIN},{"float", SYNTAX_KEYWORD},{"float_t", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"fpos_t", SYNTAX_BUILTIN},{"friend", SYNTAX_KEYWORD},{"fsblkcnt64_t", SYNTAX_BUILTIN},{"fsblkcnt_t", SYNTAX_BUILTIN},{"fsfilcnt64_t", SYNTAX_BUILTIN},{"fsfilcnt_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_g[2] = {{"gid_t", SYNTAX_BUILTIN},{"goto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_i[20] = {{"id_t", SYNTAX_BUILTIN},{"if", SYNTAX_KEYWORD},{"imaxdiv_t", SYNTAX_BUILTIN},{"inline", SYNTAX_KEYWORD},{"ino_t", SYNTAX_BUILTIN},{"int", SYNTAX_KEYWORD},{"int16_t", SYNTAX_BUILTIN},{"int32_t", SYNTAX_BUILTIN},{"int64_t", SYNTAX_BUILTIN},{"int8_t", SYNTAX_BUILTIN},{"int_fast16_t", SYNTAX_BUILTIN},{"int_fast32_t", SYNTAX_BUILTIN},{"int_fast64_t", SYNTAX_BUILTIN},{"int_fast8_t", SYNTAX_BUILTIN},{"int_least16_t", SYNTAX_BUILTIN},{"int_least32_t", SYNTAX_BUILTIN},{"int_least64_t", SYNTAX_BUILTIN},{"int_least8_t", SYNTAX_BUILTIN},{"intmax_t", SYNTAX_BUILTIN},{"intptr_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_j[1] = {{"jmp_buf", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_k[1] = {{"key_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_l[3] = {{"ldiv_t", SYNTAX_BUILTIN},{"lldiv_t", SYNTAX_BUILTIN},{"long", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_m[17] = {{"math_errhandling", SYNTAX_BUILTIN},{"max_align_t", SYNTAX_BUILTIN},{"mbstate_t", SYNTAX_BUILTIN},{"memory_order", SYNTAX_BUILTIN},{"memory_order_acq_rel", SYNTAX_BUILTIN},{"memory_order_acquire", SYNTAX_BUILTIN},{"memory_order_consume", SYNTAX_BUILTIN},{"memory_order_relaxed", SYNTAX_BUILTIN},{"memory_order_release", SYNTAX_BUILTIN},{"memory_order_seq_cst", SYNTAX_BUILTIN},{"mode_t", SYNTAX_BUILTIN},{"mtx_plain", SYNTAX_CONSTANT},{"mtx_recursive", SYNTAX_CONSTANT},{"mtx_t", SYNTAX_BUILTIN},{"mtx_timed", SYNTAX_CONSTANT},{"mtx_try", SYNTAX_CONSTANT},{"mutable", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_n[8] = {{"namespace", SYNTAX_KEYWORD},{"new", SYNTAX_KEYWORD},{"nlink_t", SYNTAX_BUILTIN},{"noexcept", SYNTAX_KEYWORD},{"noreturn", SYNTAX_BUILTIN},{"not", SYNTAX_KEYWORD},{"not_eq", SYNTAX_KEYWORD},{"nullptr", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_o[7] = {{"off64_t", SYNTAX_BUILTIN},{"off_t", SYNTAX_BUILTIN},{"offsetof", SYNTAX_BUILTIN},{"once_flag", SYNTAX_BUILTIN},{"operator", SYNTAX_KEYWORD},{"or", SYNTAX_KEYWORD},{"or_eq", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_p[5] = {{"pid_t", SYNTAX_BUILTIN},{"private", SYNTAX_KEYWORD},{"protected", SYNTAX_KEYWORD},{"ptrdiff_t", SYNTAX_BUILTIN},{"public", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_r[7] = {{"reflexpr", SYNTAX_KEYWORD},{"register", SYNTAX_KEYWORD},{"reinterpret_cast", SYNTAX_KEYWORD},{"requires", SYNTAX_KEYWORD},{"restrict", SYNTAX_KEYWORD},{"return", SYNTAX_KEYWORD},{"rsize_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_s[15] = {{"short", SYNTAX_KEYWORD},{"sig_atomic_t", SYNTAX_BUILTIN},{"signed", SYNTAX_KEYWORD},{"size_t", SYNTAX_BUILTIN},{"sizeof", SYNTAX_KEYWORD},{"ssize_t", SYNTAX_BUILTIN},{"static", SYNTAX_KEYWORD},{"static_assert", SYNTAX_BUILTIN},{"static_cast", SYNTAX_KEYWORD},{"stderr", SYNTAX_CONSTANT},{"stdin", SYNTAX_CONSTANT},{"stdout", SYNTAX_CONSTANT},{"struct", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD},{"synchronized", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_t[19] = {{"template", SYNTAX_KEYWORD},{"this", SYNTAX_KEYWORD},{"thrd_busy", SYNTAX_CONSTANT},{"thrd_error", SYNTAX_CONSTANT},{"thrd_nomem", SYNTAX_CONSTANT},{"thrd_start_t", SYNTAX_BUILTIN},{"thrd_success", SYNTAX_CONSTANT},{"thrd_t", SYNTAX_BUILTIN},{"thrd_timeout", SYNTAX_CONSTANT},{"thread_local", SYNTAX_KEYWORD},{"throw", SYNTAX_KEYWORD},{"time_t", SYNTAX_BUILTIN},{"true", SYNTAX_CONSTANT},{"try", SYNTAX_KEYWORD},{"tss_dtor_t", SYNTAX_BUILTIN},{"tss_t", SYNTAX_BUILTIN},{"typedef", SYNTAX_KEYWORD},{"typeid", SYNTAX_KEYWORD},{"typename", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_u[19] = {{"uid_t", SYNTAX_BUILTIN},{"uint16_t", SYNTAX_BUILTIN},{"uint32_t", SYNTAX_BUILTIN},{"uint64_t", SYNTAX_BUILTIN},{"uint8_t", SYNTAX_BUILTIN},{"uint_fast16_t", SYNTAX_BUILTIN},{"uint_fast32_t", SYNTAX_BUILTIN},{"uint_fast64_t", SYNTAX_BUILTIN},{"uint_fast8_t", SYNTAX_BUILTIN},{"uint_least16_t", SYNTAX_BUILTIN},{"uint_least32_t", SYNTAX_BUILTIN},{"uint_least64_t", SYNTAX_BUILTIN},{"uint_least8_t", SYNTAX_BUILTIN},{"uintmax_t", SYNTAX_BUILTIN},{"uintptr_t", SYNTAX_BUILTIN},{"union", SYNTAX_KEYWORD},{"unsigned", SYNTAX_KEYWORD},{"useconds_t", SYNTAX_BUILTIN},{"using", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_v[4] = {{"va_list", SYNTAX_BUILTIN},{"virtual", SYNTAX_KEYWORD},{"void", SYNTAX_KEYWORD},{"volatile", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_cpp_w[5] = {{"wchar_t", SYNTAX_KEYWORD},{"wctrans_t", SYNTAX_BUILTIN},{"wctype_t", SYNTAX_BUILTIN},{"while", SYNTAX_KEYWORD},{"wint_t", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_cpp_x[3] = {{"xor", SYNTAX_KEYWORD},{"xor_eq", SYNTAX_KEYWORD},{"xtime", SYNTAX_BUILTIN}};
-static const KeywordList syntax_all_keywords_cpp[128] = {
-	['A'] = {syntax_keywords_cpp_A, arr_count(syntax_keywords_cpp_A)}, ['B'] = {syntax_keywords_cpp_B, arr_count(syntax_keywords_cpp_B)}, ['C'] = {syntax_keywords_cpp_C, arr_count(syntax_keywords_cpp_C)}, ['D'] = {syntax_keywords_cpp_D, arr_count(syntax_keywords_cpp_D)}, ['E'] = {syntax_keywords_cpp_E, arr_count(syntax_keywords_cpp_E)}, ['F'] = {syntax_keywords_cpp_F, arr_count(syntax_keywords_cpp_F)}, ['H'] = {syntax_keywords_cpp_H, arr_count(syntax_keywords_cpp_H)}, ['I'] = {syntax_keywords_cpp_I, arr_count(syntax_keywords_cpp_I)}, ['L'] = {syntax_keywords_cpp_L, arr_count(syntax_keywords_cpp_L)}, ['M'] = {syntax_keywords_cpp_M, arr_count(syntax_keywords_cpp_M)}, ['N'] = {syntax_keywords_cpp_N, arr_count(syntax_keywords_cpp_N)}, ['O'] = {syntax_keywords_cpp_O, arr_count(syntax_keywords_cpp_O)}, ['P'] = {syntax_keywords_cpp_P, arr_count(syntax_keywords_cpp_P)}, ['R'] = {syntax_keywords_cpp_R, arr_count(syntax_keywords_cpp_R)}, ['S'] = {syntax_keywords_cpp_S, arr_count(syntax_keywords_cpp_S)}, ['T'] = {syntax_keywords_cpp_T, arr_count(syntax_keywords_cpp_T)}, ['U'] = {syntax_keywords_cpp_U, arr_count(syntax_keywords_cpp_U)}, ['W'] = {syntax_keywords_cpp_W, arr_count(syntax_keywords_cpp_W)}, ['_'] = {syntax_keywords_cpp_x5f, arr_count(syntax_keywords_cpp_x5f)}, ['a'] = {syntax_keywords_cpp_a, arr_count(syntax_keywords_cpp_a)}, ['b'] = {syntax_keywords_cpp_b, arr_count(syntax_keywords_cpp_b)}, ['c'] = {syntax_keywords_cpp_c, arr_count(syntax_keywords_cpp_c)}, ['d'] = {syntax_keywords_cpp_d, arr_count(syntax_keywords_cpp_d)}, ['e'] = {syntax_keywords_cpp_e, arr_count(syntax_keywords_cpp_e)}, ['f'] = {syntax_keywords_cpp_f, arr_count(syntax_keywords_cpp_f)}, ['g'] = {syntax_keywords_cpp_g, arr_count(syntax_keywords_cpp_g)}, ['i'] = {syntax_keywords_cpp_i, arr_count(syntax_keywords_cpp_i)}, ['j'] = {syntax_keywords_cpp_j, arr_count(syntax_keywords_cpp_j)}, ['k'] = {syntax_keywords_cpp_k, arr_count(syntax_keywords_cpp_k)}, ['l'] = {syntax_keywords_cpp_l, arr_count(syntax_keywords_cpp_l)}, ['m'] = {syntax_keywords_cpp_m, arr_count(syntax_keywords_cpp_m)}, ['n'] = {syntax_keywords_cpp_n, arr_count(syntax_keywords_cpp_n)}, ['o'] = {syntax_keywords_cpp_o, arr_count(syntax_keywords_cpp_o)}, ['p'] = {syntax_keywords_cpp_p, arr_count(syntax_keywords_cpp_p)}, ['r'] = {syntax_keywords_cpp_r, arr_count(syntax_keywords_cpp_r)}, ['s'] = {syntax_keywords_cpp_s, arr_count(syntax_keywords_cpp_s)}, ['t'] = {syntax_keywords_cpp_t, arr_count(syntax_keywords_cpp_t)}, ['u'] = {syntax_keywords_cpp_u, arr_count(syntax_keywords_cpp_u)}, ['v'] = {syntax_keywords_cpp_v, arr_count(syntax_keywords_cpp_v)}, ['w'] = {syntax_keywords_cpp_w, arr_count(syntax_keywords_cpp_w)}, ['x'] = {syntax_keywords_cpp_x, arr_count(syntax_keywords_cpp_x)}
+static const Keyword syntax_keywords_cpp[747] = {{"BUFSIZ", 6, SYNTAX_CONSTANT},{"SCNx64", 6, SYNTAX_CONSTANT},{"TIME_UTC", 8, SYNTAX_CONSTANT},{"FE_DOWNWARD", 11, SYNTAX_CONSTANT},{"ENOTDIR", 7, SYNTAX_CONSTANT},{"mtx_timed", 9, SYNTAX_CONSTANT},{"ULLONG_MAX", 10, SYNTAX_CONSTANT},{"not_eq", 6, SYNTAX_KEYWORD},{"va_list", 7, SYNTAX_BUILTIN},{"_Thread_local", 13, SYNTAX_KEYWORD},{"SCNi32", 6, SYNTAX_CONSTANT},{"continue", 8, SYNTAX_KEYWORD},{"for", 3, SYNTAX_KEYWORD},{"ssize_t", 7, SYNTAX_BUILTIN},{"atomic_noexcept", 15, SYNTAX_KEYWORD},{"ESPIPE", 6, SYNTAX_CONSTANT},{"static_cast", 11, SYNTAX_KEYWORD},{"EILSEQ", 6, SYNTAX_CONSTANT},{"xor_eq", 6, SYNTAX_KEYWORD},{"SCNoLEAST64", 11, SYNTAX_CONSTANT},{"DECIMAL_DIG", 11, SYNTAX_CONSTANT},{"SIGFPE", 6, SYNTAX_CONSTANT},{"UINTPTR_MAX", 11, SYNTAX_CONSTANT},{"LDBL_MIN_EXP", 12, SYNTAX_CONSTANT},{"thrd_busy", 9, SYNTAX_CONSTANT},{"mtx_plain", 9, SYNTAX_CONSTANT},{"SIGCHLD", 7, SYNTAX_CONSTANT},{"requires", 8, SYNTAX_KEYWORD},{"thrd_start_t", 12, SYNTAX_BUILTIN},{"DBL_MIN", 7, SYNTAX_CONSTANT},{"PRIuFAST8", 9, SYNTAX_CONSTANT},{"LDBL_MIN", 8, SYNTAX_CONSTANT},{"EINPROGRESS", 11, SYNTAX_CONSTANT},{"dynamic_cast", 12, SYNTAX_KEYWORD},{"atomic_schar", 12, SYNTAX_BUILTIN},{"ENOEXEC", 7, SYNTAX_CONSTANT},{"SIGPROF", 7, SYNTAX_CONSTANT},{"dev_t", 5, SYNTAX_BUILTIN},{"lldiv_t", 7, SYNTAX_BUILTIN},{"SCNuMAX", 7, SYNTAX_CONSTANT},{"CHAR_MAX", 8, SYNTAX_CONSTANT},{"ECONNABORTED", 12, SYNTAX_CONSTANT},{"PRIi8", 5, SYNTAX_CONSTANT},{"EPFNOSUPPORT", 12, SYNTAX_CONSTANT},{"PRIi64", 6, SYNTAX_CONSTANT},{"atomic_flag", 11, SYNTAX_BUILTIN},{"ENOTTY", 6, SYNTAX_CONSTANT},{"PRIdLEAST32", 11, SYNTAX_CONSTANT},{"stdout", 6, SYNTAX_CONSTANT},{"PRIoLEAST64", 11, SYNTAX_CONSTANT},{"INT_FAST64_MIN", 14, SYNTAX_CONSTANT},{"wchar_t", 7, SYNTAX_KEYWORD},{"PRIx16", 6, SYNTAX_CONSTANT},{"PRIX16", 6, SYNTAX_CONSTANT},{"PRIoPTR", 7, SYNTAX_CONSTANT},{"atomic_int_least16_t", 20, SYNTAX_BUILTIN},{"SCNuLEAST16", 11, SYNTAX_CONSTANT},{"extern", 6, SYNTAX_KEYWORD},{"CHAR_MIN", 8, SYNTAX_CONSTANT},{"ENOSPC", 6, SYNTAX_CONSTANT},{"memory_order", 12, SYNTAX_BUILTIN},{"PRIXMAX", 7, SYNTAX_CONSTANT},{"FP_FAST_FMA", 11, SYNTAX_CONSTANT},{"ATOMIC_LLONG_LOCK_FREE", 22, SYNTAX_CONSTANT},{"break", 5, SYNTAX_KEYWORD},{"bitor", 5, SYNTAX_KEYWORD},{"int_fast32_t", 12, SYNTAX_BUILTIN},{"memory_order_consume", 20, SYNTAX_BUILTIN},{"ELIBBAD", 7, SYNTAX_CONSTANT},{"LDBL_EPSILON", 12, SYNTAX_CONSTANT},{"atomic_ushort", 13, SYNTAX_BUILTIN},{"INT8_MAX", 8, SYNTAX_CONSTANT},{"ATOMIC_ADDRESS_LOCK_FREE", 24, SYNTAX_CONSTANT},{"FE_INVALID", 10, SYNTAX_CONSTANT},{"ptrdiff_t", 9, SYNTAX_BUILTIN},{"FLT_MIN_EXP", 11, SYNTAX_CONSTANT},{"PRIiPTR", 7, SYNTAX_CONSTANT},{"static_assert", 13, SYNTAX_BUILTIN},{"EWOULDBLOCK", 11, SYNTAX_CONSTANT},{"wint_t", 6, SYNTAX_BUILTIN},{"compl", 5, SYNTAX_KEYWORD},{"LDBL_MAX_EXP", 12, SYNTAX_CONSTANT},{"ATOMIC_CHAR16_T_LOCK_FREE", 25, SYNTAX_CONSTANT},{"FLT_MANT_DIG", 12, SYNTAX_CONSTANT},{"EXIT_SUCCESS", 12, SYNTAX_CONSTANT},{"SCNd32", 6, SYNTAX_CONSTANT},{"FLT_ROUNDS", 10, SYNTAX_CONSTANT},{"ENODATA", 7, SYNTAX_CONSTANT},{"ULONG_MAX", 9, SYNTAX_CONSTANT},{"float", 5, SYNTAX_KEYWORD},{"wctype_t", 8, SYNTAX_BUILTIN},{"restrict", 8, SYNTAX_KEYWORD},{"template", 8, SYNTAX_KEYWORD},{"off64_t", 7, SYNTAX_BUILTIN},{"cnd_t", 5, SYNTAX_BUILTIN},{"FP_ZERO", 7, SYNTAX_CONSTANT},{"EPERM", 5, SYNTAX_CONSTANT},{"FE_TOWARDZERO", 13, SYNTAX_CONSTANT},{"LDBL_MIN_10_EXP", 15, SYNTAX_CONSTANT},{"fsfilcnt64_t", 12, SYNTAX_BUILTIN},{"SIGINT", 6, SYNTAX_CONSTANT},{"ENONET", 6, SYNTAX_CONSTANT},{"SCNoPTR", 7, SYNTAX_CONSTANT},{"PRIX8", 5, SYNTAX_CONSTANT},{"true", 4, SYNTAX_CONSTANT},{"EISCONN", 7, SYNTAX_CONSTANT},{"ERESTART", 8, SYNTAX_CONSTANT},{"ENOCSI", 6, SYNTAX_CONSTANT},{"stderr", 6, SYNTAX_CONSTANT},{"_Generic", 8, SYNTAX_KEYWORD},{"INT32_MAX", 9, SYNTAX_CONSTANT},{"LONG_MAX", 8, SYNTAX_CONSTANT},{"INT_LEAST16_MIN", 15, SYNTAX_CONSTANT},{"EMULTIHOP", 9, SYNTAX_CONSTANT},{"double_t", 8, SYNTAX_BUILTIN},{"_IOFBF", 6, SYNTAX_CONSTANT},{"SIGLOST", 7, SYNTAX_CONSTANT},{"EBADMSG", 7, SYNTAX_CONSTANT},{"EXFULL", 6, SYNTAX_CONSTANT},{"const_cast", 10, SYNTAX_KEYWORD},{"jmp_buf", 7, SYNTAX_BUILTIN},{"EPROTO", 6, SYNTAX_CONSTANT},{"SIGWINCH", 8, SYNTAX_CONSTANT},{"SCNiMAX", 7, SYNTAX_CONSTANT},{"friend", 6, SYNTAX_KEYWORD},{"ERANGE", 6, SYNTAX_CONSTANT},{"PRIu8", 5, SYNTAX_CONSTANT},{"PTRDIFF_MAX", 11, SYNTAX_CONSTANT},{"_Alignof", 8, SYNTAX_KEYWORD},{"protected", 9, SYNTAX_KEYWORD},{"SHRT_MAX", 8, SYNTAX_CONSTANT},{"ENOLINK", 7, SYNTAX_CONSTANT},{"SCNdFAST16", 10, SYNTAX_CONSTANT},{"INT_FAST16_MIN", 14, SYNTAX_CONSTANT},{"INT_FAST16_MAX", 14, SYNTAX_CONSTANT},{"atomic_uint_least64_t", 21, SYNTAX_BUILTIN},{"intmax_t", 8, SYNTAX_BUILTIN},{"EDOTDOT", 7, SYNTAX_CONSTANT},{"PRIiMAX", 7, SYNTAX_CONSTANT},{"PRIdFAST64", 10, SYNTAX_CONSTANT},{"ELNRNG", 6, SYNTAX_CONSTANT},{"co_return", 9, SYNTAX_KEYWORD},{"uint8_t", 7, SYNTAX_BUILTIN},{"PRIi32", 6, SYNTAX_CONSTANT},{"ENXIO", 5, SYNTAX_CONSTANT},{"ATOMIC_INT_LOCK_FREE", 20, SYNTAX_CONSTANT},{"LDBL_DIG", 8, SYNTAX_CONSTANT},{"INTMAX_MIN", 10, SYNTAX_CONSTANT},{"FE_UPWARD", 9, SYNTAX_CONSTANT},{"FLT_EVAL_METHOD", 15, SYNTAX_CONSTANT},{"ENOLCK", 6, SYNTAX_CONSTANT},{"SIGCONT", 7, SYNTAX_CONSTANT},{"noreturn", 8, SYNTAX_BUILTIN},{"atomic_uint_fast16_t", 20, SYNTAX_BUILTIN},{"ETOOMANYREFS", 12, SYNTAX_CONSTANT},{"SCNxLEAST16", 11, SYNTAX_CONSTANT},{"off_t", 5, SYNTAX_BUILTIN},{"fsblkcnt64_t", 12, SYNTAX_BUILTIN},{"PRIdLEAST16", 11, SYNTAX_CONSTANT},{"ENOTBLK", 7, SYNTAX_CONSTANT},{"SCNoFAST32", 10, SYNTAX_CONSTANT},{"PRIx64", 6, SYNTAX_CONSTANT},{"double", 6, SYNTAX_KEYWORD},{"SIGUSR2", 7, SYNTAX_CONSTANT},{"atomic_uintmax_t", 16, SYNTAX_BUILTIN},{"SIGKILL", 7, SYNTAX_CONSTANT},{"DBL_DIG", 7, SYNTAX_CONSTANT},{"atomic_uint_least16_t", 21, SYNTAX_BUILTIN},{"ldiv_t", 6, SYNTAX_BUILTIN},{"SIG_ATOMIC_MIN", 14, SYNTAX_CONSTANT},{"unsigned", 8, SYNTAX_KEYWORD},{"gid_t", 5, SYNTAX_BUILTIN},{"constexpr", 9, SYNTAX_KEYWORD},{"SCNx16", 6, SYNTAX_CONSTANT},{"ENETUNREACH", 11, SYNTAX_CONSTANT},{"PRIuFAST64", 10, SYNTAX_CONSTANT},{"uint_fast32_t", 13, SYNTAX_BUILTIN},{"EBADF", 5, SYNTAX_CONSTANT},{"INT_LEAST32_MAX", 15, SYNTAX_CONSTANT},{"PRIuFAST16", 10, SYNTAX_CONSTANT},{"DBL_MAX", 7, SYNTAX_CONSTANT},{"SIGURG", 6, SYNTAX_CONSTANT},{"EMEDIUMTYPE", 11, SYNTAX_CONSTANT},{"blksize_t", 9, SYNTAX_BUILTIN},{"DBL_HAS_SUBNORM", 15, SYNTAX_CONSTANT},{"I", 1, SYNTAX_CONSTANT},{"PRIx8", 5, SYNTAX_CONSTANT},{"PRIxLEAST8", 10, SYNTAX_CONSTANT},{"namespace", 9, SYNTAX_KEYWORD},{"PRIxFAST64", 10, SYNTAX_CONSTANT},{"SIGPOLL", 7, SYNTAX_CONSTANT},{"atomic_int_fast16_t", 19, SYNTAX_BUILTIN},{"LC_MONETARY", 11, SYNTAX_CONSTANT},{"UCHAR_MAX", 9, SYNTAX_CONSTANT},{"typedef", 7, SYNTAX_KEYWORD},{"uintmax_t", 9, SYNTAX_BUILTIN},{"CLOCKS_PER_SEC", 14, SYNTAX_CONSTANT},{"UINT8_MAX", 9, SYNTAX_CONSTANT},{"SCNiLEAST32", 11, SYNTAX_CONSTANT},{"int16_t", 7, SYNTAX_BUILTIN},{"PRId8", 5, SYNTAX_CONSTANT},{"ENOSR", 5, SYNTAX_CONSTANT},{"int64_t", 7, SYNTAX_BUILTIN},{"INT_LEAST16_MAX", 15, SYNTAX_CONSTANT},{"EREMOTE", 7, SYNTAX_CONSTANT},{"memory_order_acq_rel", 20, SYNTAX_BUILTIN},{"EOF", 3, SYNTAX_CONSTANT},{"LONG_MIN", 8, SYNTAX_CONSTANT},{"INT_LEAST32_MIN", 15, SYNTAX_CONSTANT},{"nullptr", 7, SYNTAX_KEYWORD},{"SCNxMAX", 7, SYNTAX_CONSTANT},{"export", 6, SYNTAX_KEYWORD},{"operator", 8, SYNTAX_KEYWORD},{"co_await", 8, SYNTAX_KEYWORD},{"SCNdPTR", 7, SYNTAX_CONSTANT},{"atomic_uint", 11, SYNTAX_BUILTIN},{"atomic_uint_fast8_t", 19, SYNTAX_BUILTIN},{"FE_INEXACT", 10, SYNTAX_CONSTANT},{"SIG_DFL", 7, SYNTAX_CONSTANT},{"int_least64_t", 13, SYNTAX_BUILTIN},{"EADDRINUSE", 10, SYNTAX_CONSTANT},{"new", 3, SYNTAX_KEYWORD},{"SCNd8", 5, SYNTAX_CONSTANT},{"EFBIG", 5, SYNTAX_CONSTANT},{"SCNo8", 5, SYNTAX_CONSTANT},{"UINT16_MAX", 10, SYNTAX_CONSTANT},{"EPROTOTYPE", 10, SYNTAX_CONSTANT},{"uint64_t", 8, SYNTAX_BUILTIN},{"pid_t", 5, SYNTAX_BUILTIN},{"LDBL_TRUE_MIN", 13, SYNTAX_CONSTANT},{"SCNo32", 6, SYNTAX_CONSTANT},{"SIGTRAP", 7, SYNTAX_CONSTANT},{"ENOANO", 6, SYNTAX_CONSTANT},{"do", 2, SYNTAX_KEYWORD},{"INT_LEAST64_MIN", 15, SYNTAX_CONSTANT},{"SCNoFAST64", 10, SYNTAX_CONSTANT},{"EINVAL", 6, SYNTAX_CONSTANT},{"atomic_int", 10, SYNTAX_BUILTIN},{"PRIuLEAST32", 11, SYNTAX_CONSTANT},{"SCNi16", 6, SYNTAX_CONSTANT},{"atomic_short", 12, SYNTAX_BUILTIN},{"ENOTSOCK", 8, SYNTAX_CONSTANT},{"INT_MIN", 7, SYNTAX_CONSTANT},{"div_t", 5, SYNTAX_BUILTIN},{"UINT_FAST8_MAX", 14, SYNTAX_CONSTANT},{"EDQUOT", 6, SYNTAX_CONSTANT},{"NULL", 4, SYNTAX_CONSTANT},{"ECONNREFUSED", 12, SYNTAX_CONSTANT},{"UINT64_MAX", 10, SYNTAX_CONSTANT},{"FP_SUBNORMAL", 12, SYNTAX_CONSTANT},{"MB_LEN_MAX", 10, SYNTAX_CONSTANT},{"SIGSTKFLT", 9, SYNTAX_CONSTANT},{"SIGTTIN", 7, SYNTAX_CONSTANT},{"PRIo16", 6, SYNTAX_CONSTANT},{"stdin", 5, SYNTAX_CONSTANT},{"SCNdLEAST16", 11, SYNTAX_CONSTANT},{"SCNxLEAST32", 11, SYNTAX_CONSTANT},{"PRIXFAST16", 10, SYNTAX_CONSTANT},{"SCNuFAST32", 10, SYNTAX_CONSTANT},{"SCNxLEAST64", 11, SYNTAX_CONSTANT},{"FLT_HAS_SUBNORM", 15, SYNTAX_CONSTANT},{"PRIxLEAST32", 11, SYNTAX_CONSTANT},{"PRIXFAST64", 10, SYNTAX_CONSTANT},{"FLT_RADIX", 9, SYNTAX_CONSTANT},{"FP_NAN", 6, SYNTAX_CONSTANT},{"ENAMETOOLONG", 12, SYNTAX_CONSTANT},{"_IONBF", 6, SYNTAX_CONSTANT},{"INTMAX_MAX", 10, SYNTAX_CONSTANT},{"SIGVTALRM", 9, SYNTAX_CONSTANT},{"memory_order_acquire", 20, SYNTAX_BUILTIN},{"_Noreturn", 9, SYNTAX_KEYWORD},{"case", 4, SYNTAX_KEYWORD},{"uint32_t", 8, SYNTAX_BUILTIN},{"SCNu32", 6, SYNTAX_CONSTANT},{"_Atomic", 7, SYNTAX_KEYWORD},{"tss_dtor_t", 10, SYNTAX_BUILTIN},{"PRId64", 6, SYNTAX_CONSTANT},{"atomic_size_t", 13, SYNTAX_BUILTIN},{"INT_FAST32_MAX", 14, SYNTAX_CONSTANT},{"LC_CTYPE", 8, SYNTAX_CONSTANT},{"FE_TONEAREST", 12, SYNTAX_CONSTANT},{"_Alignas", 8, SYNTAX_KEYWORD},{"PRIXLEAST32", 11, SYNTAX_CONSTANT},{"int_least32_t", 13, SYNTAX_BUILTIN},{"SCNoFAST8", 9, SYNTAX_CONSTANT},{"LDBL_MANT_DIG", 13, SYNTAX_CONSTANT},{"FLT_MAX", 7, SYNTAX_CONSTANT},{"SCNiFAST8", 9, SYNTAX_CONSTANT},{"mtx_try", 7, SYNTAX_CONSTANT},{"PRIXLEAST64", 11, SYNTAX_CONSTANT},{"atomic_char", 11, SYNTAX_BUILTIN},{"char16_t", 8, SYNTAX_BUILTIN},{"PRIuMAX", 7, SYNTAX_CONSTANT},{"ENOTUNIQ", 8, SYNTAX_CONSTANT},{"bitand", 6, SYNTAX_KEYWORD},{"SCNd16", 6, SYNTAX_CONSTANT},{"uid_t", 5, SYNTAX_BUILTIN},{"SCNxFAST32", 10, SYNTAX_CONSTANT},{"FLT_MAX_10_EXP", 14, SYNTAX_CONSTANT},{"WEOF", 4, SYNTAX_CONSTANT},{"float_t", 7, SYNTAX_BUILTIN},{"SCNd64", 6, SYNTAX_CONSTANT},{"SCNi64", 6, SYNTAX_CONSTANT},{"SIGTERM", 7, SYNTAX_CONSTANT},{"PRIiFAST8", 9, SYNTAX_CONSTANT},{"SCNx8", 5, SYNTAX_CONSTANT},{"char8_t", 7, SYNTAX_BUILTIN},{"uint_least8_t", 13, SYNTAX_BUILTIN},{"DBL_MIN_EXP", 11, SYNTAX_CONSTANT},{"int", 3, SYNTAX_KEYWORD},{"INFINITY", 8, SYNTAX_CONSTANT},{"atomic_commit", 13, SYNTAX_KEYWORD},{"_Bool", 5, SYNTAX_KEYWORD},{"PRIoFAST32", 10, SYNTAX_CONSTANT},{"ENOBUFS", 7, SYNTAX_CONSTANT},{"PRIiFAST64", 10, SYNTAX_CONSTANT},{"mtx_t", 5, SYNTAX_BUILTIN},{"PRIXPTR", 7, SYNTAX_CONSTANT},{"HUGE_VAL", 8, SYNTAX_CONSTANT},{"EREMCHG", 7, SYNTAX_CONSTANT},{"atomic_int_least32_t", 20, SYNTAX_BUILTIN},{"EDOM", 4, SYNTAX_CONSTANT},{"INT_FAST8_MAX", 13, SYNTAX_CONSTANT},{"not", 3, SYNTAX_KEYWORD},{"SIGBUS", 6, SYNTAX_CONSTANT},{"EL2NSYNC", 8, SYNTAX_CONSTANT},{"ETIME", 5, SYNTAX_CONSTANT},{"PRIi16", 6, SYNTAX_CONSTANT},{"PRIx32", 6, SYNTAX_CONSTANT},{"SCNo64", 6, SYNTAX_CONSTANT},{"SIGTSTP", 7, SYNTAX_CONSTANT},{"ESRMNT", 6, SYNTAX_CONSTANT},{"FLT_MIN_10_EXP", 14, SYNTAX_CONSTANT},{"PRIdPTR", 7, SYNTAX_CONSTANT},{"time_t", 6, SYNTAX_BUILTIN},{"INT64_MIN", 9, SYNTAX_CONSTANT},{"ECHILD", 6, SYNTAX_CONSTANT},{"PRIo64", 6, SYNTAX_CONSTANT},{"daddr_t", 7, SYNTAX_BUILTIN},{"PRIuPTR", 7, SYNTAX_CONSTANT},{"private", 7, SYNTAX_KEYWORD},{"ENETRESET", 9, SYNTAX_CONSTANT},{"WINT_MAX", 8, SYNTAX_CONSTANT},{"atomic_uint_fast64_t", 20, SYNTAX_BUILTIN},{"SCNxFAST64", 10, SYNTAX_CONSTANT},{"PRIoLEAST32", 11, SYNTAX_CONSTANT},{"SIGTTOU", 7, SYNTAX_CONSTANT},{"SCNiFAST64", 10, SYNTAX_CONSTANT},{"SEEK_SET", 8, SYNTAX_CONSTANT},{"FP_FAST_FMAF", 12, SYNTAX_CONSTANT},{"L_tmpnam", 8, SYNTAX_CONSTANT},{"UINT_LEAST64_MAX", 16, SYNTAX_CONSTANT},{"ENOTCONN", 8, SYNTAX_CONSTANT},{"PRIX32", 6, SYNTAX_CONSTANT},{"SCNiFAST32", 10, SYNTAX_CONSTANT},{"int_least8_t", 12, SYNTAX_BUILTIN},{"ETIMEDOUT", 9, SYNTAX_CONSTANT},{"atomic_address", 14, SYNTAX_BUILTIN},{"xor", 3, SYNTAX_KEYWORD},{"uint_fast64_t", 13, SYNTAX_BUILTIN},{"uint_least16_t", 14, SYNTAX_BUILTIN},{"EBFONT", 6, SYNTAX_CONSTANT},{"EBADE", 5, SYNTAX_CONSTANT},{"PRIXLEAST16", 11, SYNTAX_CONSTANT},{"bool", 4, SYNTAX_KEYWORD},{"blkcnt64_t", 10, SYNTAX_BUILTIN},{"SCNo16", 6, SYNTAX_CONSTANT},{"void", 4, SYNTAX_KEYWORD},{"atomic_int_fast32_t", 19, SYNTAX_BUILTIN},{"LLONG_MIN", 9, SYNTAX_CONSTANT},{"while", 5, SYNTAX_KEYWORD},{"EDEADLK", 7, SYNTAX_CONSTANT},{"memory_order_release", 20, SYNTAX_BUILTIN},{"else", 4, SYNTAX_KEYWORD},{"SIGIO", 5, SYNTAX_CONSTANT},{"SCNxFAST8", 9, SYNTAX_CONSTANT},{"INT_LEAST8_MAX", 14, SYNTAX_CONSTANT},{"ENFILE", 6, SYNTAX_CONSTANT},{"co_yield", 8, SYNTAX_KEYWORD},{"TSS_DTOR_ITERATIONS", 19, SYNTAX_CONSTANT},{"UINT_LEAST8_MAX", 15, SYNTAX_CONSTANT},{"SIGEMT", 6, SYNTAX_CONSTANT},{"char32_t", 8, SYNTAX_BUILTIN},{"PRIo8", 5, SYNTAX_CONSTANT},{"complex", 7, SYNTAX_BUILTIN},{"EACCES", 6, SYNTAX_CONSTANT},{"atomic_ulong", 12, SYNTAX_BUILTIN},{"ONCE_FLAG_INIT", 14, SYNTAX_CONSTANT},{"SIGALRM", 7, SYNTAX_CONSTANT},{"SCNuLEAST32", 11, SYNTAX_CONSTANT},{"or", 2, SYNTAX_KEYWORD},{"FE_DIVBYZERO", 12, SYNTAX_CONSTANT},{"long", 4, SYNTAX_KEYWORD},{"PRIiLEAST8", 10, SYNTAX_CONSTANT},{"PRIuLEAST8", 10, SYNTAX_CONSTANT},{"ATOMIC_CHAR_LOCK_FREE", 21, SYNTAX_CONSTANT},{"EADV", 4, SYNTAX_CONSTANT},{"ECHRNG", 6, SYNTAX_CONSTANT},{"ECOMM", 5, SYNTAX_CONSTANT},{"explicit", 8, SYNTAX_KEYWORD},{"enum", 4, SYNTAX_KEYWORD},{"_Imaginary", 10, SYNTAX_KEYWORD},{"static", 6, SYNTAX_KEYWORD},{"SCNxPTR", 7, SYNTAX_CONSTANT},{"once_flag", 9, SYNTAX_BUILTIN},{"EOPNOTSUPP", 10, SYNTAX_CONSTANT},{"concept", 7, SYNTAX_KEYWORD},{"PRIxLEAST64", 11, SYNTAX_CONSTANT},{"WCHAR_MIN", 9, SYNTAX_CONSTANT},{"SIGPIPE", 7, SYNTAX_CONSTANT},{"SIGINFO", 7, SYNTAX_CONSTANT},{"FP_INFINITE", 11, SYNTAX_CONSTANT},{"EBADFD", 6, SYNTAX_CONSTANT},{"PRIu16", 6, SYNTAX_CONSTANT},{"SCNu8", 5, SYNTAX_CONSTANT},{"ESTALE", 6, SYNTAX_CONSTANT},{"UINTMAX_MAX", 11, SYNTAX_CONSTANT},{"INT64_MAX", 9, SYNTAX_CONSTANT},{"atomic_wchar_t", 14, SYNTAX_BUILTIN},{"ENOPROTOOPT", 11, SYNTAX_CONSTANT},{"INT32_MIN", 9, SYNTAX_CONSTANT},{"PRId16", 6, SYNTAX_CONSTANT},{"ESOCKTNOSUPPORT", 15, SYNTAX_CONSTANT},{"atomic_cancel", 13, SYNTAX_KEYWORD},{"ino_t", 5, SYNTAX_BUILTIN},{"SCNiFAST16", 10, SYNTAX_CONSTANT},{"struct", 6, SYNTAX_KEYWORD},{"MATH_ERRNO", 10, SYNTAX_CONSTANT},{"EINTR", 5, SYNTAX_CONSTANT},{"RSIZE_MAX", 9, SYNTAX_CONSTANT},{"UINT_LEAST16_MAX", 16, SYNTAX_CONSTANT},{"FP_ILOGB0", 9, SYNTAX_CONSTANT},{"PRIoLEAST8", 10, SYNTAX_CONSTANT},{"SCNuFAST16", 10, SYNTAX_CONSTANT},{"DBL_MANT_DIG", 12, SYNTAX_CONSTANT},{"int_fast8_t", 11, SYNTAX_BUILTIN},{"SCNu16", 6, SYNTAX_CONSTANT},{"int_least16_t", 13, SYNTAX_BUILTIN},{"LC_NUMERIC", 10, SYNTAX_CONSTANT},{"LC_TIME", 7, SYNTAX_CONSTANT},{"size_t", 6, SYNTAX_BUILTIN},{"EMFILE", 6, SYNTAX_CONSTANT},{"INT_LEAST64_MAX", 15, SYNTAX_CONSTANT},{"SCNdFAST8", 9, SYNTAX_CONSTANT},{"atomic_char16_t", 15, SYNTAX_BUILTIN},{"SIGQUIT", 7, SYNTAX_CONSTANT},{"NAN", 3, SYNTAX_CONSTANT},{"ETXTBSY", 7, SYNTAX_CONSTANT},{"goto", 4, SYNTAX_KEYWORD},{"SCNoLEAST32", 11, SYNTAX_CONSTANT},{"const", 5, SYNTAX_KEYWORD},{"ENOMEDIUM", 9, SYNTAX_CONSTANT},{"register", 8, SYNTAX_KEYWORD},{"HUGE_VALF", 9, SYNTAX_CONSTANT},{"uint_fast16_t", 13, SYNTAX_BUILTIN},{"SCNdFAST32", 10, SYNTAX_CONSTANT},{"DBL_MAX_EXP", 11, SYNTAX_CONSTANT},{"PRIuLEAST16", 11, SYNTAX_CONSTANT},{"fexcept_t", 9, SYNTAX_BUILTIN},{"SCNdFAST64", 10, SYNTAX_CONSTANT},{"MB_CUR_MAX", 10, SYNTAX_CONSTANT},{"PRIXLEAST8", 10, SYNTAX_CONSTANT},{"PRIxMAX", 7, SYNTAX_CONSTANT},{"inline", 6, SYNTAX_KEYWORD},{"PRIXFAST32", 10, SYNTAX_CONSTANT},{"INT_FAST64_MAX", 14, SYNTAX_CONSTANT},{"SCNu64", 6, SYNTAX_CONSTANT},{"rsize_t", 7, SYNTAX_BUILTIN},{"EEXIST", 6, SYNTAX_CONSTANT},{"SIG_IGN", 7, SYNTAX_CONSTANT},{"ENOMSG", 6, SYNTAX_CONSTANT},{"_Complex", 8, SYNTAX_KEYWORD},{"mutable", 7, SYNTAX_KEYWORD},{"public", 6, SYNTAX_KEYWORD},{"ENOPKG", 6, SYNTAX_CONSTANT},{"atomic_ullong", 13, SYNTAX_BUILTIN},{"alignof", 7, SYNTAX_BUILTIN},{"SCNoLEAST8", 10, SYNTAX_CONSTANT},{"SCNuPTR", 7, SYNTAX_CONSTANT},{"if", 2, SYNTAX_KEYWORD},{"SIGUSR1", 7, SYNTAX_CONSTANT},{"LDBL_MAX_10_EXP", 15, SYNTAX_CONSTANT},{"PRIoFAST8", 9, SYNTAX_CONSTANT},{"memory_order_relaxed", 20, SYNTAX_BUILTIN},{"atomic_uchar", 12, SYNTAX_BUILTIN},{"thrd_nomem", 10, SYNTAX_CONSTANT},{"EPROTONOSUPPORT", 15, SYNTAX_CONSTANT},{"EUCLEAN", 7, SYNTAX_CONSTANT},{"PRIxFAST32", 10, SYNTAX_CONSTANT},{"ESRCH", 5, SYNTAX_CONSTANT},{"constraint_handler_t", 20, SYNTAX_BUILTIN},{"SCHAR_MAX", 9, SYNTAX_CONSTANT},{"offsetof", 8, SYNTAX_BUILTIN},{"union", 5, SYNTAX_KEYWORD},{"asm", 3, SYNTAX_KEYWORD},{"_IOLBF", 6, SYNTAX_CONSTANT},{"PRIxLEAST16", 11, SYNTAX_CONSTANT},{"PRIoFAST16", 10, SYNTAX_CONSTANT},{"INT_FAST8_MIN", 13, SYNTAX_CONSTANT},{"atomic_char32_t", 15, SYNTAX_BUILTIN},{"USHRT_MAX", 9, SYNTAX_CONSTANT},{"FILENAME_MAX", 12, SYNTAX_CONSTANT},{"EXDEV", 5, SYNTAX_CONSTANT},{"EBADSLT", 7, SYNTAX_CONSTANT},{"DBL_TRUE_MIN", 12, SYNTAX_CONSTANT},{"EISNAM", 6, SYNTAX_CONSTANT},{"PRIoLEAST16", 11, SYNTAX_CONSTANT},{"synchronized", 12, SYNTAX_KEYWORD},{"EL2HLT", 6, SYNTAX_CONSTANT},{"SIGPWR", 6, SYNTAX_CONSTANT},{"SCNxLEAST8", 10, SYNTAX_CONSTANT},{"ENODEV", 6, SYNTAX_CONSTANT},{"UINT32_MAX", 10, SYNTAX_CONSTANT},{"SIGHUP", 6, SYNTAX_CONSTANT},{"LC_ALL", 6, SYNTAX_CONSTANT},{"SCNuFAST64", 10, SYNTAX_CONSTANT},{"ENOSTR", 6, SYNTAX_CONSTANT},{"SIGABRT", 7, SYNTAX_CONSTANT},{"ENOTNAM", 7, SYNTAX_CONSTANT},{"reflexpr", 8, SYNTAX_KEYWORD},{"this", 4, SYNTAX_KEYWORD},{"ENOTEMPTY", 9, SYNTAX_CONSTANT},{"FP_NORMAL", 9, SYNTAX_CONSTANT},{"throw", 5, SYNTAX_KEYWORD},{"PRIo32", 6, SYNTAX_CONSTANT},{"E2BIG", 5, SYNTAX_CONSTANT},{"nlink_t", 7, SYNTAX_BUILTIN},{"ENOMEM", 6, SYNTAX_CONSTANT},{"LDBL_MAX", 8, SYNTAX_CONSTANT},{"FE_DFL_ENV", 10, SYNTAX_CONSTANT},{"PTRDIFF_MIN", 11, SYNTAX_CONSTANT},{"ENETDOWN", 8, SYNTAX_CONSTANT},{"sizeof", 6, SYNTAX_KEYWORD},{"SCNdLEAST8", 10, SYNTAX_CONSTANT},{"ELIBACC", 7, SYNTAX_CONSTANT},{"thrd_error", 10, SYNTAX_CONSTANT},{"tss_t", 5, SYNTAX_BUILTIN},{"int_fast16_t", 12, SYNTAX_BUILTIN},{"FILE", 4, SYNTAX_BUILTIN},{"EPIPE", 5, SYNTAX_CONSTANT},{"mbstate_t", 9, SYNTAX_BUILTIN},{"EHOSTDOWN", 9, SYNTAX_CONSTANT},{"alignas", 7, SYNTAX_BUILTIN},{"ENOSYS", 6, SYNTAX_CONSTANT},{"fsblkcnt_t", 10, SYNTAX_BUILTIN},{"PRIdMAX", 7, SYNTAX_CONSTANT},{"EXIT_FAILURE", 12, SYNTAX_CONSTANT},{"EOVERFLOW", 9, SYNTAX_CONSTANT},{"EMSGSIZE", 8, SYNTAX_CONSTANT},{"FLT_MAX_EXP", 11, SYNTAX_CONSTANT},{"DBL_MAX_10_EXP", 14, SYNTAX_CONSTANT},{"ESTRPIPE", 8, SYNTAX_CONSTANT},{"SCNxFAST16", 10, SYNTAX_CONSTANT},{"PRIdFAST8", 9, SYNTAX_CONSTANT},{"EBUSY", 5, SYNTAX_CONSTANT},{"ELIBSCN", 7, SYNTAX_CONSTANT},{"TMP_MAX_S", 9, SYNTAX_CONSTANT},{"thrd_t", 6, SYNTAX_BUILTIN},{"atomic_int_least64_t", 20, SYNTAX_BUILTIN},{"uint_least32_t", 14, SYNTAX_BUILTIN},{"WINT_MIN", 8, SYNTAX_CONSTANT},{"using", 5, SYNTAX_KEYWORD},{"SIGCLD", 6, SYNTAX_CONSTANT},{"ELIBMAX", 7, SYNTAX_CONSTANT},{"int8_t", 6, SYNTAX_BUILTIN},{"EIO", 3, SYNTAX_CONSTANT},{"ESHUTDOWN", 9, SYNTAX_CONSTANT},{"PRIxPTR", 7, SYNTAX_CONSTANT},{"SCNuFAST8", 9, SYNTAX_CONSTANT},{"uintptr_t", 9, SYNTAX_BUILTIN},{"key_t", 5, SYNTAX_BUILTIN},{"EBADR", 5, SYNTAX_CONSTANT},{"imaxdiv_t", 9, SYNTAX_BUILTIN},{"FOPEN_MAX", 9, SYNTAX_CONSTANT},{"EAGAIN", 6, SYNTAX_CONSTANT},{"_Static_assert", 14, SYNTAX_KEYWORD},{"int32_t", 7, SYNTAX_BUILTIN},{"INT_MAX", 7, SYNTAX_CONSTANT},{"SEEK_END", 8, SYNTAX_CONSTANT},{"atomic_long", 11, SYNTAX_BUILTIN},{"typeid", 6, SYNTAX_KEYWORD},{"ATOMIC_FLAG_LOCK_FREE", 21, SYNTAX_CONSTANT},{"INTPTR_MIN", 10, SYNTAX_CONSTANT},{"FLT_MIN", 7, SYNTAX_CONSTANT},{"constinit", 9, SYNTAX_KEYWORD},{"SIGIOT", 6, SYNTAX_CONSTANT},{"CHAR_BIT", 8, SYNTAX_CONSTANT},{"SCNi8", 5, SYNTAX_CONSTANT},{"mode_t", 6, SYNTAX_BUILTIN},{"default", 7, SYNTAX_KEYWORD},{"errno_t", 7, SYNTAX_BUILTIN},{"SCNdLEAST64", 11, SYNTAX_CONSTANT},{"EDESTADDRREQ", 12, SYNTAX_CONSTANT},{"SIGXCPU", 7, SYNTAX_CONSTANT},{"EHOSTUNREACH", 12, SYNTAX_CONSTANT},{"fsfilcnt_t", 10, SYNTAX_BUILTIN},{"EBADRQC", 7, SYNTAX_CONSTANT},{"ELIBEXEC", 8, SYNTAX_CONSTANT},{"SCHAR_MIN", 9, SYNTAX_CONSTANT},{"SCNiPTR", 7, SYNTAX_CONSTANT},{"PRIuFAST32", 10, SYNTAX_CONSTANT},{"MATH_ERREXCEPT", 14, SYNTAX_CONSTANT},{"PRIX64", 6, SYNTAX_CONSTANT},{"reinterpret_cast", 16, SYNTAX_KEYWORD},{"EAFNOSUPPORT", 12, SYNTAX_CONSTANT},{"atomic_llong", 12, SYNTAX_BUILTIN},{"virtual", 7, SYNTAX_KEYWORD},{"FLT_DIG", 7, SYNTAX_CONSTANT},{"false", 5, SYNTAX_CONSTANT},{"PRIu32", 6, SYNTAX_CONSTANT},{"FP_FAST_FMAL", 12, SYNTAX_CONSTANT},{"SCNuLEAST64", 11, SYNTAX_CONSTANT},{"caddr_t", 7, SYNTAX_BUILTIN},{"atomic_intmax_t", 15, SYNTAX_BUILTIN},{"SHRT_MIN", 8, SYNTAX_CONSTANT},{"PRIuLEAST64", 11, SYNTAX_CONSTANT},{"thrd_timeout", 12, SYNTAX_CONSTANT},{"PRIoMAX", 7, SYNTAX_CONSTANT},{"and", 3, SYNTAX_KEYWORD},{"memory_order_seq_cst", 20, SYNTAX_BUILTIN},{"PRIdLEAST64", 11, SYNTAX_CONSTANT},{"PRIdLEAST8", 10, SYNTAX_CONSTANT},{"typename", 8, SYNTAX_KEYWORD},{"thread_local", 12, SYNTAX_KEYWORD},{"FLT_DECIMAL_DIG", 15, SYNTAX_CONSTANT},{"ENOENT", 6, SYNTAX_CONSTANT},{"atomic_ptrdiff_t", 16, SYNTAX_BUILTIN},{"PRIdFAST32", 10, SYNTAX_CONSTANT},{"UINT_MAX", 8, SYNTAX_CONSTANT},{"blkcnt_t", 8, SYNTAX_BUILTIN},{"SIZE_MAX", 8, SYNTAX_CONSTANT},{"atomic_uint_fast32_t", 20, SYNTAX_BUILTIN},{"LLONG_MAX", 9, SYNTAX_CONSTANT},{"UINT_LEAST32_MAX", 16, SYNTAX_CONSTANT},{"clock_t", 7, SYNTAX_BUILTIN},{"INT_FAST32_MIN", 14, SYNTAX_CONSTANT},{"noexcept", 8, SYNTAX_KEYWORD},{"PRIXFAST8", 9, SYNTAX_CONSTANT},{"EUNATCH", 7, SYNTAX_CONSTANT},{"intptr_t", 8, SYNTAX_BUILTIN},{"SCNdMAX", 7, SYNTAX_CONSTANT},{"SIGUNUSED", 9, SYNTAX_CONSTANT},{"LDBL_DECIMAL_DIG", 16, SYNTAX_CONSTANT},{"INT16_MIN", 9, SYNTAX_CONSTANT},{"atomic_intptr_t", 15, SYNTAX_BUILTIN},{"uint16_t", 8, SYNTAX_BUILTIN},{"ATOMIC_CHAR32_T_LOCK_FREE", 25, SYNTAX_CONSTANT},{"PRIiLEAST32", 11, SYNTAX_CONSTANT},{"xtime", 5, SYNTAX_BUILTIN},{"UINT_FAST32_MAX", 15, SYNTAX_CONSTANT},{"HUGE_VALL", 9, SYNTAX_CONSTANT},{"SCNuLEAST8", 10, SYNTAX_CONSTANT},{"SIGSTOP", 7, SYNTAX_CONSTANT},{"consteval", 9, SYNTAX_KEYWORD},{"PRIxFAST16", 10, SYNTAX_CONSTANT},{"atomic_uint_least8_t", 20, SYNTAX_BUILTIN},{"LC_COLLATE", 10, SYNTAX_CONSTANT},{"EUSERS", 6, SYNTAX_CONSTANT},{"atomic_int_least8_t", 19, SYNTAX_BUILTIN},{"char", 4, SYNTAX_KEYWORD},{"catch", 5, SYNTAX_KEYWORD},{"signed", 6, SYNTAX_KEYWORD},{"try", 3, SYNTAX_KEYWORD},{"atomic_int_fast8_t", 18, SYNTAX_BUILTIN},{"NDEBUG", 6, SYNTAX_CONSTANT},{"atomic_bool", 11, SYNTAX_BUILTIN},{"PRIiFAST32", 10, SYNTAX_CONSTANT},{"ATOMIC_LONG_LOCK_FREE", 21, SYNTAX_CONSTANT},{"FLT_TRUE_MIN", 12, SYNTAX_CONSTANT},{"id_t", 4, SYNTAX_BUILTIN},{"EIDRM", 5, SYNTAX_CONSTANT},{"PRId32", 6, SYNTAX_CONSTANT},{"INT16_MAX", 9, SYNTAX_CONSTANT},{"SIGXFSZ", 7, SYNTAX_CONSTANT},{"FE_UNDERFLOW", 12, SYNTAX_CONSTANT},{"SCNdLEAST32", 11, SYNTAX_CONSTANT},{"ECONNRESET", 10, SYNTAX_CONSTANT},{"decltype", 8, SYNTAX_KEYWORD},{"return", 6, SYNTAX_KEYWORD},{"short", 5, SYNTAX_KEYWORD},{"or_eq", 5, SYNTAX_KEYWORD},{"fenv_t", 6, SYNTAX_BUILTIN},{"auto", 4, SYNTAX_KEYWORD},{"FE_OVERFLOW", 11, SYNTAX_CONSTANT},{"PRIiLEAST16", 11, SYNTAX_CONSTANT},{"atomic_uint_least32_t", 21, SYNTAX_BUILTIN},{"ELOOP", 5, SYNTAX_CONSTANT},{"volatile", 8, SYNTAX_KEYWORD},{"INT_LEAST8_MIN", 14, SYNTAX_CONSTANT},{"SCNoMAX", 7, SYNTAX_CONSTANT},{"ATOMIC_SHORT_LOCK_FREE", 22, SYNTAX_CONSTANT},{"delete", 6, SYNTAX_KEYWORD},{"useconds_t", 10, SYNTAX_BUILTIN},{"EISDIR", 6, SYNTAX_CONSTANT},{"switch", 6, SYNTAX_KEYWORD},{"sig_atomic_t", 12, SYNTAX_BUILTIN},{"SCNiLEAST16", 11, SYNTAX_CONSTANT},{"WCHAR_MAX", 9, SYNTAX_CONSTANT},{"UINT_FAST64_MAX", 15, SYNTAX_CONSTANT},{"EMLINK", 6, SYNTAX_CONSTANT},{"class", 5, SYNTAX_KEYWORD},{"FE_ALL_EXCEPT", 13, SYNTAX_CONSTANT},{"math_errhandling", 16, SYNTAX_BUILTIN},{"PRIiFAST16", 10, SYNTAX_CONSTANT},{"SCNiLEAST8", 10, SYNTAX_CONSTANT},{"atomic_int_fast64_t", 19, SYNTAX_BUILTIN},{"wctrans_t", 9, SYNTAX_BUILTIN},{"thrd_success", 12, SYNTAX_CONSTANT},{"fpos_t", 6, SYNTAX_BUILTIN},{"UINT_FAST16_MAX", 15, SYNTAX_CONSTANT},{"max_align_t", 11, SYNTAX_BUILTIN},{"SIGSYS", 6, SYNTAX_CONSTANT},{"EREMOTEIO", 9, SYNTAX_CONSTANT},{"and_eq", 6, SYNTAX_KEYWORD},{"SCNoFAST16", 10, SYNTAX_CONSTANT},{"PRIxFAST8", 9, SYNTAX_CONSTANT},{"EFAULT", 6, SYNTAX_CONSTANT},{"INT8_MIN", 8, SYNTAX_CONSTANT},{"SIG_ERR", 7, SYNTAX_CONSTANT},{"ATOMIC_WCHAR_T_LOCK_FREE", 24, SYNTAX_CONSTANT},{"SCNoLEAST16", 11, SYNTAX_CONSTANT},{"int_fast64_t", 12, SYNTAX_BUILTIN},{"PRIoFAST64", 10, SYNTAX_CONSTANT},{"SEEK_CUR", 8, SYNTAX_CONSTANT},{"ENAVAIL", 7, SYNTAX_CONSTANT},{"FP_ILOGBNAN", 11, SYNTAX_CONSTANT},{"EALREADY", 8, SYNTAX_CONSTANT},{"EL3RST", 6, SYNTAX_CONSTANT},{"SIGILL", 6, SYNTAX_CONSTANT},{"TMP_MAX", 7, SYNTAX_CONSTANT},{"PRIiLEAST64", 11, SYNTAX_CONSTANT},{"EDEADLOCK", 9, SYNTAX_CONSTANT},{"PRIdFAST16", 10, SYNTAX_CONSTANT},{"EL3HLT", 6, SYNTAX_CONSTANT},{"EROFS", 5, SYNTAX_CONSTANT},{"mtx_recursive", 13, SYNTAX_CONSTANT},{"EADDRNOTAVAIL", 13, SYNTAX_CONSTANT},{"PRIu64", 6, SYNTAX_CONSTANT},{"atomic_uintptr_t", 16, SYNTAX_BUILTIN},{"uint_fast8_t", 12, SYNTAX_BUILTIN},{"SCNx32", 6, SYNTAX_CONSTANT},{"INTPTR_MAX", 10, SYNTAX_CONSTANT},{"SCNiLEAST64", 11, SYNTAX_CONSTANT},{"SIGSEGV", 7, SYNTAX_CONSTANT},{"SIG_ATOMIC_MAX", 14, SYNTAX_CONSTANT},{"DBL_EPSILON", 11, SYNTAX_CONSTANT},{"uint_least64_t", 14, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_cpp[249] = {2,35,6,8,3,0,0,0,7,0,0,1,4,29,2,2,9,3,3,32,5,0,0,1,0,57,13,19,4,9,30,4,17,8,12,0,5,12,23,29,5,0,0,6,36,4,28,13,25,17,11,9,27,0,12,0,30,1,0,0,45,15,10,80,53,27,0,105,19,50,54,2,22,6,39,111,60,131,1,0,3,9,2,110,0,12,1,5,54,33,5,57,1,2,9,63,1,2,0,82,19,0,3,2,6,22,5,26,0,15,0,1,19,16,0,3,149,28,26,12,12,1,50,0,181,30,12,4,66,1,172,7,141,15,47,8,0,158,170,15,184,5,0,74,23,34,28,0,7,209,219,12,0,32,17,8,170,7,51,46,2,2,237,11,177,3,35,75,0,153,41,0,8,124,55,0,0,6,543,39,50,62,34,202,17,31,4,314,9,13,4,5,0,6,132,17,42,0,3,5,34,35,1145,23,300,299,4,0,2,37,319,530,65,24,4,0,89,0,1,201,37,31,501,0,70,95,3,0,2,122,80,69,47,1097,8,5,44,28,43,45,19,189,17,7,2,44,123,529,25};
+static const KeywordTable syntax_all_keywords_cpp = {
+	syntax_keywords_cpp, syntax_keyword_displacements_cpp, 747, 249, 9,
+	{-3, -5, -2, 3, -13, 11, 1, 6, 2},
+	{0x4c6c4cefu, 0xf23d538du, 0xa0bff3b9u, 0x1e52c027u, 0xc7ab881bu, 0x72bba509u, 0x4566cc27u, 0x49df2d33u, 0x818c729fu}
 };
 
-static const Keyword syntax_keywords_rust_A[2] = {{"AsMut", SYNTAX_BUILTIN},{"AsRef", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_B[1] = {{"Box", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_C[2] = {{"Clone", SYNTAX_BUILTIN},{"Copy", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_D[3] = {{"Default", SYNTAX_BUILTIN},{"DoubleEndedIterator", SYNTAX_BUILTIN},{"Drop", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_E[4] = {{"Eq", SYNTAX_BUILTIN},{"Err", SYNTAX_BUILTIN},{"ExactSizeIterator", SYNTAX_BUILTIN},{"Extend", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_F[4] = {{"Fn", SYNTAX_BUILTIN},{"FnMut", SYNTAX_BUILTIN},{"FnOnce", SYNTAX_BUILTIN},{"From", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_I[3] = {{"Into", SYNTAX_BUILTIN},{"IntoIterator", SYNTAX_BUILTIN},{"Iterator", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_N[1] = {{"None", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_O[3] = {{"Ok", SYNTAX_BUILTIN},{"Option", SYNTAX_BUILTIN},{"Ord", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_P[2] = {{"PartialEq", SYNTAX_BUILTIN},{"PartialOrd", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_R[1] = {{"Result", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_S[6] = {{"Self", SYNTAX_KEYWORD},{"Send", SYNTAX_BUILTIN},{"Sized", SYNTAX_BUILTIN},{"Some", SYNTAX_BUILTIN},{"String", SYNTAX_BUILTIN},{"Sync", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_T[2] = {{"ToOwned", SYNTAX_BUILTIN},{"ToString", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_U[1] = {{"Unpin", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_V[1] = {{"Vec", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_a[8] = {{"abstract", SYNTAX_KEYWORD},{"as", SYNTAX_KEYWORD},{"asm!", SYNTAX_BUILTIN},{"assert!", SYNTAX_BUILTIN},{"assert_eq!", SYNTAX_BUILTIN},{"assert_ne!", SYNTAX_BUILTIN},{"async", SYNTAX_KEYWORD},{"await", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_b[4] = {{"become", SYNTAX_KEYWORD},{"bool", SYNTAX_BUILTIN},{"box", SYNTAX_KEYWORD},{"break", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_c[9] = {{"cfg!", SYNTAX_BUILTIN},{"char", SYNTAX_BUILTIN},{"column!", SYNTAX_BUILTIN},{"compile_error!", SYNTAX_BUILTIN},{"concat!", SYNTAX_BUILTIN},{"concat_idents!", SYNTAX_BUILTIN},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"crate", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_d[7] = {{"dbg!", SYNTAX_BUILTIN},{"debug_assert!", SYNTAX_BUILTIN},{"debug_assert_eq!", SYNTAX_BUILTIN},{"debug_assert_ne!", SYNTAX_BUILTIN},{"do", SYNTAX_KEYWORD},{"drop", SYNTAX_BUILTIN},{"dyn", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_e[6] = {{"else", SYNTAX_KEYWORD},{"enum", SYNTAX_KEYWORD},{"env!", SYNTAX_BUILTIN},{"eprint!", SYNTAX_BUILTIN},{"eprintln!", SYNTAX_BUILTIN},{"extern", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_f[10] = {{"f32", SYNTAX_BUILTIN},{"f64", SYNTAX_BUILTIN},{"false", SYNTAX_CONSTANT},{"file!", SYNTAX_BUILTIN},{"final", SYNTAX_KEYWORD},{"fn", SYNTAX_KEYWORD},{"for", SYNTAX_KEYWORD},{"format!", SYNTAX_BUILTIN},{"format_args!", SYNTAX_BUILTIN},{"format_args_nl!", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_g[1] = {{"global_asm!", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_i[19] = {{"i128", SYNTAX_BUILTIN},{"i16", SYNTAX_BUILTIN},{"i32", SYNTAX_BUILTIN},{"i64", SYNTAX_BUILTIN},{"i8", SYNTAX_BUILTIN},{"if", SYNTAX_KEYWORD},{"impl", SYNTAX_KEYWORD},{"in", SYNTAX_KEYWORD},{"include!", SYNTAX_BUILTIN},{"include_bytes!", SYNTAX_BUILTIN},{"include_str!", SYNTAX_BUILTIN},{"is_aarch64_feature_detected!", SYNTAX_BUILTIN},{"is_arm_feature_detected!", SYNTAX_BUILTIN},{"is_mips64_feature_detected!", SYNTAX_BUILTIN},{"is_mips_feature_detected!", SYNTAX_BUILTIN},{"is_powerpc64_feature_detected!", SYNTAX_BUILTIN},{"is_powerpc_feature_detected!", SYNTAX_BUILTIN},{"is_x86_feature_detected!", SYNTAX_BUILTIN},{"isize", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_l[5] = {{"let", SYNTAX_KEYWORD},{"line!", SYNTAX_BUILTIN},{"llvm_asm!", SYNTAX_BUILTIN},{"log_syntax!", SYNTAX_BUILTIN},{"loop", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_m[7] = {{"macro", SYNTAX_KEYWORD},{"match", SYNTAX_KEYWORD},{"matches!", SYNTAX_BUILTIN},{"mod", SYNTAX_KEYWORD},{"module_path!", SYNTAX_BUILTIN},{"move", SYNTAX_KEYWORD},{"mut", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_o[2] = {{"option_env!", SYNTAX_BUILTIN},{"override", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_p[5] = {{"panic!", SYNTAX_BUILTIN},{"print!", SYNTAX_BUILTIN},{"println!", SYNTAX_BUILTIN},{"priv", SYNTAX_KEYWORD},{"pub", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_r[2] = {{"ref", SYNTAX_KEYWORD},{"return", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_s[6] = {{"self", SYNTAX_KEYWORD},{"static", SYNTAX_KEYWORD},{"str", SYNTAX_BUILTIN},{"stringify!", SYNTAX_BUILTIN},{"struct", SYNTAX_KEYWORD},{"super", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_t[9] = {{"thread_local!", SYNTAX_BUILTIN},{"todo!", SYNTAX_BUILTIN},{"trace_macros!", SYNTAX_BUILTIN},{"trait", SYNTAX_KEYWORD},{"true", SYNTAX_CONSTANT},{"try", SYNTAX_KEYWORD},{"try!", SYNTAX_BUILTIN},{"type", SYNTAX_KEYWORD},{"typeof", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_u[12] = {{"u128", SYNTAX_BUILTIN},{"u16", SYNTAX_BUILTIN},{"u32", SYNTAX_BUILTIN},{"u64", SYNTAX_BUILTIN},{"u8", SYNTAX_BUILTIN},{"unimplemented!", SYNTAX_BUILTIN},{"union", SYNTAX_KEYWORD},{"unreachable!", SYNTAX_BUILTIN},{"unsafe", SYNTAX_KEYWORD},{"unsized", SYNTAX_KEYWORD},{"use", SYNTAX_KEYWORD},{"usize", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_v[2] = {{"vec!", SYNTAX_BUILTIN},{"virtual", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_rust_w[4] = {{"where", SYNTAX_KEYWORD},{"while", SYNTAX_KEYWORD},{"write!", SYNTAX_BUILTIN},{"writeln!", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_rust_y[1] = {{"yield", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_rust[128] = {
-	['A'] = {syntax_keywords_rust_A, arr_count(syntax_keywords_rust_A)}, ['B'] = {syntax_keywords_rust_B, arr_count(syntax_keywords_rust_B)}, ['C'] = {syntax_keywords_rust_C, arr_count(syntax_keywords_rust_C)}, ['D'] = {syntax_keywords_rust_D, arr_count(syntax_keywords_rust_D)}, ['E'] = {syntax_keywords_rust_E, arr_count(syntax_keywords_rust_E)}, ['F'] = {syntax_keywords_rust_F, arr_count(syntax_keywords_rust_F)}, ['I'] = {syntax_keywords_rust_I, arr_count(syntax_keywords_rust_I)}, ['N'] = {syntax_keywords_rust_N, arr_count(syntax_keywords_rust_N)}, ['O'] = {syntax_keywords_rust_O, arr_count(syntax_keywords_rust_O)}, ['P'] = {syntax_keywords_rust_P, arr_count(syntax_keywords_rust_P)}, ['R'] = {syntax_keywords_rust_R, arr_count(syntax_keywords_rust_R)}, ['S'] = {syntax_keywords_rust_S, arr_count(syntax_keywords_rust_S)}, ['T'] = {syntax_keywords_rust_T, arr_count(syntax_keywords_rust_T)}, ['U'] = {syntax_keywords_rust_U, arr_count(syntax_keywords_rust_U)}, ['V'] = {syntax_keywords_rust_V, arr_count(syntax_keywords_rust_V)}, ['a'] = {syntax_keywords_rust_a, arr_count(syntax_keywords_rust_a)}, ['b'] = {syntax_keywords_rust_b, arr_count(syntax_keywords_rust_b)}, ['c'] = {syntax_keywords_rust_c, arr_count(syntax_keywords_rust_c)}, ['d'] = {syntax_keywords_rust_d, arr_count(syntax_keywords_rust_d)}, ['e'] = {syntax_keywords_rust_e, arr_count(syntax_keywords_rust_e)}, ['f'] = {syntax_keywords_rust_f, arr_count(syntax_keywords_rust_f)}, ['g'] = {syntax_keywords_rust_g, arr_count(syntax_keywords_rust_g)}, ['i'] = {syntax_keywords_rust_i, arr_count(syntax_keywords_rust_i)}, ['l'] = {syntax_keywords_rust_l, arr_count(syntax_keywords_rust_l)}, ['m'] = {syntax_keywords_rust_m, arr_count(syntax_keywords_rust_m)}, ['o'] = {syntax_keywords_rust_o, arr_count(syntax_keywords_rust_o)}, ['p'] = {syntax_keywords_rust_p, arr_count(syntax_keywords_rust_p)}, ['r'] = {syntax_keywords_rust_r, arr_count(syntax_keywords_rust_r)}, ['s'] = {syntax_keywords_rust_s, arr_count(syntax_keywords_rust_s)}, ['t'] = {syntax_keywords_rust_t, arr_count(syntax_keywords_rust_t)}, ['u'] = {syntax_keywords_rust_u, arr_count(syntax_keywords_rust_u)}, ['v'] = {syntax_keywords_rust_v, arr_count(syntax_keywords_rust_v)}, ['w'] = {syntax_keywords_rust_w, arr_count(syntax_keywords_rust_w)}, ['y'] = {syntax_keywords_rust_y, arr_count(syntax_keywords_rust_y)}
+static const Keyword syntax_keywords_rust[155] = {{"Option", 6, SYNTAX_BUILTIN},{"for", 3, SYNTAX_KEYWORD},{"From", 4, SYNTAX_BUILTIN},{"await", 5, SYNTAX_KEYWORD},{"DoubleEndedIterator", 19, SYNTAX_BUILTIN},{"const", 5, SYNTAX_KEYWORD},{"f32", 3, SYNTAX_BUILTIN},{"Clone", 5, SYNTAX_BUILTIN},{"struct", 6, SYNTAX_KEYWORD},{"usize", 5, SYNTAX_BUILTIN},{"Sized", 5, SYNTAX_BUILTIN},{"Vec", 3, SYNTAX_BUILTIN},{"Drop", 4, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"false", 5, SYNTAX_CONSTANT},{"module_path!", 12, SYNTAX_BUILTIN},{"i16", 3, SYNTAX_BUILTIN},{"file!", 5, SYNTAX_BUILTIN},{"self", 4, SYNTAX_KEYWORD},{"str", 3, SYNTAX_BUILTIN},{"concat!", 7, SYNTAX_BUILTIN},{"box", 3, SYNTAX_KEYWORD},{"Self", 4, SYNTAX_KEYWORD},{"final", 5, SYNTAX_KEYWORD},{"Sync", 4, SYNTAX_BUILTIN},{"assert_eq!", 10, SYNTAX_BUILTIN},{"do", 2, SYNTAX_KEYWORD},{"enum", 4, SYNTAX_KEYWORD},{"as", 2, SYNTAX_KEYWORD},{"return", 6, SYNTAX_KEYWORD},{"include_str!", 12, SYNTAX_BUILTIN},{"IntoIterator", 12, SYNTAX_BUILTIN},{"debug_assert_eq!", 16, SYNTAX_BUILTIN},{"f64", 3, SYNTAX_BUILTIN},{"Eq", 2, SYNTAX_BUILTIN},{"Ord", 3, SYNTAX_BUILTIN},{"typeof", 6, SYNTAX_KEYWORD},{"PartialEq", 9, SYNTAX_BUILTIN},{"match", 5, SYNTAX_KEYWORD},{"mut", 3, SYNTAX_KEYWORD},{"break", 5, SYNTAX_KEYWORD},{"format_args!", 12, SYNTAX_BUILTIN},{"Extend", 6, SYNTAX_BUILTIN},{"option_env!", 11, SYNTAX_BUILTIN},{"override", 8, SYNTAX_KEYWORD},{"trace_macros!", 13, SYNTAX_BUILTIN},{"compile_error!", 14, SYNTAX_BUILTIN},{"type", 4, SYNTAX_KEYWORD},{"bool", 4, SYNTAX_BUILTIN},{"Copy", 4, SYNTAX_BUILTIN},{"ref", 3, SYNTAX_KEYWORD},{"ToOwned", 7, SYNTAX_BUILTIN},{"global_asm!", 11, SYNTAX_BUILTIN},{"String", 6, SYNTAX_BUILTIN},{"llvm_asm!", 9, SYNTAX_BUILTIN},{"abstract", 8, SYNTAX_KEYWORD},{"Some", 4, SYNTAX_BUILTIN},{"write!", 6, SYNTAX_BUILTIN},{"include!", 8, SYNTAX_BUILTIN},{"Fn", 2, SYNTAX_BUILTIN},{"column!", 7, SYNTAX_BUILTIN},{"eprint!", 7, SYNTAX_BUILTIN},{"try", 3, SYNTAX_KEYWORD},{"trait", 5, SYNTAX_KEYWORD},{"thread_local!", 13, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"extern", 6, SYNTAX_KEYWORD},{"i64", 3, SYNTAX_BUILTIN},{"asm!", 4, SYNTAX_BUILTIN},{"Ok", 2, SYNTAX_BUILTIN},{"Iterator", 8, SYNTAX_BUILTIN},{"stringify!", 10, SYNTAX_BUILTIN},{"if", 2, SYNTAX_KEYWORD},{"debug_assert!", 13, SYNTAX_BUILTIN},{"Box", 3, SYNTAX_BUILTIN},{"yield", 5, SYNTAX_KEYWORD},{"eprintln!", 9, SYNTAX_BUILTIN},{"vec!", 4, SYNTAX_BUILTIN},{"assert!", 7, SYNTAX_BUILTIN},{"Send", 4, SYNTAX_BUILTIN},{"u16", 3, SYNTAX_BUILTIN},{"println!", 8, SYNTAX_BUILTIN},{"i8", 2, SYNTAX_BUILTIN},{"FnOnce", 6, SYNTAX_BUILTIN},{"union", 5, SYNTAX_KEYWORD},{"dyn", 3, SYNTAX_KEYWORD},{"PartialOrd", 10, SYNTAX_BUILTIN},{"AsRef", 5, SYNTAX_BUILTIN},{"concat_idents!", 14, SYNTAX_BUILTIN},{"use", 3, SYNTAX_KEYWORD},{"env!", 4, SYNTAX_BUILTIN},{"static", 6, SYNTAX_KEYWORD},{"impl", 4, SYNTAX_KEYWORD},{"unsafe", 6, SYNTAX_KEYWORD},{"virtual", 7, SYNTAX_KEYWORD},{"i128", 4, SYNTAX_BUILTIN},{"super", 5, SYNTAX_KEYWORD},{"Into", 4, SYNTAX_BUILTIN},{"is_x86_feature_detected!", 24, SYNTAX_BUILTIN},{"Err", 3, SYNTAX_BUILTIN},{"None", 4, SYNTAX_BUILTIN},{"let", 3, SYNTAX_KEYWORD},{"pub", 3, SYNTAX_KEYWORD},{"format_args_nl!", 15, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"u128", 4, SYNTAX_BUILTIN},{"ToString", 8, SYNTAX_BUILTIN},{"include_bytes!", 14, SYNTAX_BUILTIN},{"format!", 7, SYNTAX_BUILTIN},{"priv", 4, SYNTAX_KEYWORD},{"is_powerpc64_feature_detected!", 30, SYNTAX_BUILTIN},{"is_arm_feature_detected!", 24, SYNTAX_BUILTIN},{"Result", 6, SYNTAX_BUILTIN},{"i32", 3, SYNTAX_BUILTIN},{"cfg!", 4, SYNTAX_BUILTIN},{"macro", 5, SYNTAX_KEYWORD},{"mod", 3, SYNTAX_KEYWORD},{"is_powerpc_feature_detected!", 28, SYNTAX_BUILTIN},{"become", 6, SYNTAX_KEYWORD},{"unimplemented!", 14, SYNTAX_BUILTIN},{"unreachable!", 12, SYNTAX_BUILTIN},{"assert_ne!", 10, SYNTAX_BUILTIN},{"Unpin", 5, SYNTAX_BUILTIN},{"unsized", 7, SYNTAX_KEYWORD},{"fn", 2, SYNTAX_KEYWORD},{"move", 4, SYNTAX_KEYWORD},{"matches!", 8, SYNTAX_BUILTIN},{"async", 5, SYNTAX_KEYWORD},{"u64", 3, SYNTAX_BUILTIN},{"crate", 5, SYNTAX_KEYWORD},{"loop", 4, SYNTAX_KEYWORD},{"where", 5, SYNTAX_KEYWORD},{"print!", 6, SYNTAX_BUILTIN},{"debug_assert_ne!", 16, SYNTAX_BUILTIN},{"u8", 2, SYNTAX_BUILTIN},{"while", 5, SYNTAX_KEYWORD},{"else", 4, SYNTAX_KEYWORD},{"try!", 4, SYNTAX_BUILTIN},{"is_mips_feature_detected!", 25, SYNTAX_BUILTIN},{"u32", 3, SYNTAX_BUILTIN},{"char", 4, SYNTAX_BUILTIN},{"todo!", 5, SYNTAX_BUILTIN},{"is_aarch64_feature_detected!", 28, SYNTAX_BUILTIN},{"dbg!", 4, SYNTAX_BUILTIN},{"log_syntax!", 11, SYNTAX_BUILTIN},{"AsMut", 5, SYNTAX_BUILTIN},{"is_mips64_feature_detected!", 27, SYNTAX_BUILTIN},{"writeln!", 8, SYNTAX_BUILTIN},{"isize", 5, SYNTAX_BUILTIN},{"line!", 5, SYNTAX_BUILTIN},{"panic!", 6, SYNTAX_BUILTIN},{"Default", 7, SYNTAX_BUILTIN},{"ExactSizeIterator", 17, SYNTAX_BUILTIN},{"drop", 4, SYNTAX_BUILTIN},{"FnMut", 5, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_rust[52] = {0,6,14,2,4,11,29,0,33,10,18,23,0,0,9,2,51,0,0,7,100,3,39,7,2,12,30,5,7,1,0,44,59,11,112,32,4,12,68,22,6,123,5,7,122,9,246,5,1,4,15,8};
+static const KeywordTable syntax_all_keywords_rust = {
+	syntax_keywords_rust, syntax_keyword_displacements_rust, 155, 52, 3,
+	{-12, 3, -2},
+	{0x94b4f6c7u, 0x80b0b8afu, 0x8a153c83u}
 };
 
-static const Keyword syntax_keywords_javascript_A[7] = {{"AggregateError", SYNTAX_BUILTIN},{"Array", SYNTAX_BUILTIN},{"ArrayBuffer", SYNTAX_BUILTIN},{"AsyncFunction", SYNTAX_BUILTIN},{"AsyncGenerator", SYNTAX_BUILTIN},{"AsyncGeneratorFunction", SYNTAX_BUILTIN},{"Atomics", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_B[4] = {{"BigInt", SYNTAX_BUILTIN},{"BigInt64Array", SYNTAX_BUILTIN},{"BigUint64Array", SYNTAX_BUILTIN},{"Boolean", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_D[2] = {{"DataView", SYNTAX_BUILTIN},{"Date", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_E[2] = {{"Error", SYNTAX_BUILTIN},{"EvalError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_F[4] = {{"FinalizationRegistry", SYNTAX_BUILTIN},{"Float32Array", SYNTAX_BUILTIN},{"Float64Array", SYNTAX_BUILTIN},{"Function", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_G[2] = {{"Generator", SYNTAX_BUILTIN},{"GeneratorFunction", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_I[6] = {{"Infinity", SYNTAX_BUILTIN},{"Int16Array", SYNTAX_BUILTIN},{"Int32Array", SYNTAX_BUILTIN},{"Int8Array", SYNTAX_BUILTIN},{"InternalError", SYNTAX_BUILTIN},{"Intl", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_J[1] = {{"JSON", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_M[2] = {{"Map", SYNTAX_BUILTIN},{"Math", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_N[2] = {{"NaN", SYNTAX_BUILTIN},{"Number", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_O[1] = {{"Object", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_P[2] = {{"Promise", SYNTAX_BUILTIN},{"Proxy", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_R[4] = {{"RangeError", SYNTAX_BUILTIN},{"ReferenceError", SYNTAX_BUILTIN},{"Reflect", SYNTAX_BUILTIN},{"RegExp", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_S[5] = {{"Set", SYNTAX_BUILTIN},{"SharedArrayBuffer", SYNTAX_BUILTIN},{"String", SYNTAX_BUILTIN},{"Symbol", SYNTAX_BUILTIN},{"SyntaxError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_T[2] = {{"TypeError", SYNTAX_BUILTIN},{"TypedArray", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_U[5] = {{"URIError", SYNTAX_BUILTIN},{"Uint16Array", SYNTAX_BUILTIN},{"Uint32Array", SYNTAX_BUILTIN},{"Uint8Array", SYNTAX_BUILTIN},{"Uint8ClampedArray", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_W[4] = {{"WeakMap", SYNTAX_BUILTIN},{"WeakRef", SYNTAX_BUILTIN},{"WeakSet", SYNTAX_BUILTIN},{"WebAssembly", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_a[3] = {{"arguments", SYNTAX_BUILTIN},{"async", SYNTAX_KEYWORD},{"await", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_b[1] = {{"break", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_c[7] = {{"case", SYNTAX_KEYWORD},{"catch", SYNTAX_KEYWORD},{"class", SYNTAX_KEYWORD},{"console", SYNTAX_BUILTIN},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"customElements", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_d[8] = {{"debugger", SYNTAX_KEYWORD},{"decodeURI", SYNTAX_BUILTIN},{"decodeURIComponent", SYNTAX_BUILTIN},{"default", SYNTAX_KEYWORD},{"delete", SYNTAX_KEYWORD},{"devicePixelRatio", SYNTAX_BUILTIN},{"do", SYNTAX_KEYWORD},{"document", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_e[6] = {{"else", SYNTAX_KEYWORD},{"encodeURI", SYNTAX_BUILTIN},{"encodeURIComponent", SYNTAX_BUILTIN},{"eval", SYNTAX_BUILTIN},{"export", SYNTAX_KEYWORD},{"extends", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_f[6] = {{"false", SYNTAX_CONSTANT},{"finally", SYNTAX_KEYWORD},{"for", SYNTAX_KEYWORD},{"frameElement", SYNTAX_BUILTIN},{"frames", SYNTAX_BUILTIN},{"function", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_g[1] = {{"globalThis", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_h[1] = {{"history", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_i[8] = {{"if", SYNTAX_KEYWORD},{"import", SYNTAX_KEYWORD},{"in", SYNTAX_KEYWORD},{"innerHeight", SYNTAX_BUILTIN},{"innerWidth", SYNTAX_BUILTIN},{"instanceof", SYNTAX_KEYWORD},{"isFinite", SYNTAX_BUILTIN},{"isNaN", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_l[4] = {{"let", SYNTAX_KEYWORD},{"localStorage", SYNTAX_BUILTIN},{"location", SYNTAX_BUILTIN},{"locationbar", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_m[1] = {{"menubar", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_n[3] = {{"navigator", SYNTAX_BUILTIN},{"new", SYNTAX_KEYWORD},{"null", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_javascript_o[4] = {{"of", SYNTAX_KEYWORD},{"opener", SYNTAX_BUILTIN},{"outerHeight", SYNTAX_BUILTIN},{"outerWidth", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_p[5] = {{"pageXOffset", SYNTAX_BUILTIN},{"pageYOffset", SYNTAX_BUILTIN},{"parseFloat", SYNTAX_BUILTIN},{"parseInt", SYNTAX_BUILTIN},{"personalbar", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_javascript_r[1] = {{"return", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_s[14] = {{"scheduler", SYNTAX_BUILTIN},{"screen", SYNTAX_BUILTIN},{"screenLeft", SYNTAX_BUILTIN},{"screenTop", SYNTAX_BUILTIN},{"screenX", SYNTAX_BUILTIN},{"screenY", SYNTAX_BUILTIN},{"scrollX", SYNTAX_BUILTIN},{"scrollY", SYNTAX_BUILTIN},{"scrollbars", SYNTAX_BUILTIN},{"sessionStorage", SYNTAX_BUILTIN},{"speechSynthesis", SYNTAX_BUILTIN},{"statusbar", SYNTAX_BUILTIN},{"super", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_t[6] = {{"this", SYNTAX_KEYWORD},{"throw", SYNTAX_KEYWORD},{"toolbar", SYNTAX_BUILTIN},{"true", SYNTAX_CONSTANT},{"try", SYNTAX_KEYWORD},{"typeof", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_u[1] = {{"undefined", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_javascript_v[3] = {{"var", SYNTAX_KEYWORD},{"visualViewport", SYNTAX_BUILTIN},{"void", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_w[3] = {{"while", SYNTAX_KEYWORD},{"window", SYNTAX_BUILTIN},{"with", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_javascript_y[1] = {{"yield", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_javascript[128] = {
-	['A'] = {syntax_keywords_javascript_A, arr_count(syntax_keywords_javascript_A)}, ['B'] = {syntax_keywords_javascript_B, arr_count(syntax_keywords_javascript_B)}, ['D'] = {syntax_keywords_javascript_D, arr_count(syntax_keywords_javascript_D)}, ['E'] = {syntax_keywords_javascript_E, arr_count(syntax_keywords_javascript_E)}, ['F'] = {syntax_keywords_javascript_F, arr_count(syntax_keywords_javascript_F)}, ['G'] = {syntax_keywords_javascript_G, arr_count(syntax_keywords_javascript_G)}, ['I'] = {syntax_keywords_javascript_I, arr_count(syntax_keywords_javascript_I)}, ['J'] = {syntax_keywords_javascript_J, arr_count(syntax_keywords_javascript_J)}, ['M'] = {syntax_keywords_javascript_M, arr_count(syntax_keywords_javascript_M)}, ['N'] = {syntax_keywords_javascript_N, arr_count(syntax_keywords_javascript_N)}, ['O'] = {syntax_keywords_javascript_O, arr_count(syntax_keywords_javascript_O)}, ['P'] = {syntax_keywords_javascript_P, arr_count(syntax_keywords_javascript_P)}, ['R'] = {syntax_keywords_javascript_R, arr_count(syntax_keywords_javascript_R)}, ['S'] = {syntax_keywords_javascript_S, arr_count(syntax_keywords_javascript_S)}, ['T'] = {syntax_keywords_javascript_T, arr_count(syntax_keywords_javascript_T)}, ['U'] = {syntax_keywords_javascript_U, arr_count(syntax_keywords_javascript_U)}, ['W'] = {syntax_keywords_javascript_W, arr_count(syntax_keywords_javascript_W)}, ['a'] = {syntax_keywords_javascript_a, arr_count(syntax_keywords_javascript_a)}, ['b'] = {syntax_keywords_javascript_b, arr_count(syntax_keywords_javascript_b)}, ['c'] = {syntax_keywords_javascript_c, arr_count(syntax_keywords_javascript_c)}, ['d'] = {syntax_keywords_javascript_d, arr_count(syntax_keywords_javascript_d)}, ['e'] = {syntax_keywords_javascript_e, arr_count(syntax_keywords_javascript_e)}, ['f'] = {syntax_keywords_javascript_f, arr_count(syntax_keywords_javascript_f)}, ['g'] = {syntax_keywords_javascript_g, arr_count(syntax_keywords_javascript_g)}, ['h'] = {syntax_keywords_javascript_h, arr_count(syntax_keywords_javascript_h)}, ['i'] = {syntax_keywords_javascript_i, arr_count(syntax_keywords_javascript_i)}, ['l'] = {syntax_keywords_javascript_l, arr_count(syntax_keywords_javascript_l)}, ['m'] = {syntax_keywords_javascript_m, arr_count(syntax_keywords_javascript_m)}, ['n'] = {syntax_keywords_javascript_n, arr_count(syntax_keywords_javascript_n)}, ['o'] = {syntax_keywords_javascript_o, arr_count(syntax_keywords_javascript_o)}, ['p'] = {syntax_keywords_javascript_p, arr_count(syntax_keywords_javascript_p)}, ['r'] = {syntax_keywords_javascript_r, arr_count(syntax_keywords_javascript_r)}, ['s'] = {syntax_keywords_javascript_s, arr_count(syntax_keywords_javascript_s)}, ['t'] = {syntax_keywords_javascript_t, arr_count(syntax_keywords_javascript_t)}, ['u'] = {syntax_keywords_javascript_u, arr_count(syntax_keywords_javascript_u)}, ['v'] = {syntax_keywords_javascript_v, arr_count(syntax_keywords_javascript_v)}, ['w'] = {syntax_keywords_javascript_w, arr_count(syntax_keywords_javascript_w)}, ['y'] = {syntax_keywords_javascript_y, arr_count(syntax_keywords_javascript_y)}
+static const Keyword syntax_keywords_javascript[142] = {{"opener", 6, SYNTAX_BUILTIN},{"encodeURIComponent", 18, SYNTAX_BUILTIN},{"with", 4, SYNTAX_KEYWORD},{"debugger", 8, SYNTAX_KEYWORD},{"Error", 5, SYNTAX_BUILTIN},{"encodeURI", 9, SYNTAX_BUILTIN},{"default", 7, SYNTAX_KEYWORD},{"case", 4, SYNTAX_KEYWORD},{"Atomics", 7, SYNTAX_BUILTIN},{"Array", 5, SYNTAX_BUILTIN},{"screenX", 7, SYNTAX_BUILTIN},{"innerHeight", 11, SYNTAX_BUILTIN},{"FinalizationRegistry", 20, SYNTAX_BUILTIN},{"yield", 5, SYNTAX_KEYWORD},{"export", 6, SYNTAX_KEYWORD},{"isNaN", 5, SYNTAX_BUILTIN},{"Int8Array", 9, SYNTAX_BUILTIN},{"parseFloat", 10, SYNTAX_BUILTIN},{"eval", 4, SYNTAX_BUILTIN},{"scheduler", 9, SYNTAX_BUILTIN},{"document", 8, SYNTAX_BUILTIN},{"speechSynthesis", 15, SYNTAX_BUILTIN},{"parseInt", 8, SYNTAX_BUILTIN},{"TypeError", 9, SYNTAX_BUILTIN},{"Object", 6, SYNTAX_BUILTIN},{"Boolean", 7, SYNTAX_BUILTIN},{"localStorage", 12, SYNTAX_BUILTIN},{"InternalError", 13, SYNTAX_BUILTIN},{"function", 8, SYNTAX_KEYWORD},{"globalThis", 10, SYNTAX_BUILTIN},{"new", 3, SYNTAX_KEYWORD},{"AsyncGeneratorFunction", 22, SYNTAX_BUILTIN},{"undefined", 9, SYNTAX_CONSTANT},{"Map", 3, SYNTAX_BUILTIN},{"BigInt64Array", 13, SYNTAX_BUILTIN},{"Int32Array", 10, SYNTAX_BUILTIN},{"TypedArray", 10, SYNTAX_BUILTIN},{"SharedArrayBuffer", 17, SYNTAX_BUILTIN},{"Infinity", 8, SYNTAX_BUILTIN},{"arguments", 9, SYNTAX_BUILTIN},{"SyntaxError", 11, SYNTAX_BUILTIN},{"Date", 4, SYNTAX_BUILTIN},{"console", 7, SYNTAX_BUILTIN},{"let", 3, SYNTAX_KEYWORD},{"Set", 3, SYNTAX_BUILTIN},{"window", 6, SYNTAX_BUILTIN},{"return", 6, SYNTAX_KEYWORD},{"Generator", 9, SYNTAX_BUILTIN},{"WeakRef", 7, SYNTAX_BUILTIN},{"AsyncGenerator", 14, SYNTAX_BUILTIN},{"NaN", 3, SYNTAX_BUILTIN},{"var", 3, SYNTAX_KEYWORD},{"scrollbars", 10, SYNTAX_BUILTIN},{"null", 4, SYNTAX_CONSTANT},{"finally", 7, SYNTAX_KEYWORD},{"history", 7, SYNTAX_BUILTIN},{"Uint32Array", 11, SYNTAX_BUILTIN},{"outerWidth", 10, SYNTAX_BUILTIN},{"EvalError", 9, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"if", 2, SYNTAX_KEYWORD},{"outerHeight", 11, SYNTAX_BUILTIN},{"WeakMap", 7, SYNTAX_BUILTIN},{"visualViewport", 14, SYNTAX_BUILTIN},{"Intl", 4, SYNTAX_BUILTIN},{"frames", 6, SYNTAX_BUILTIN},{"import", 6, SYNTAX_KEYWORD},{"Uint8Array", 10, SYNTAX_BUILTIN},{"WeakSet", 7, SYNTAX_BUILTIN},{"Function", 8, SYNTAX_BUILTIN},{"String", 6, SYNTAX_BUILTIN},{"AggregateError", 14, SYNTAX_BUILTIN},{"Uint16Array", 11, SYNTAX_BUILTIN},{"screenY", 7, SYNTAX_BUILTIN},{"RangeError", 10, SYNTAX_BUILTIN},{"location", 8, SYNTAX_BUILTIN},{"screenLeft", 10, SYNTAX_BUILTIN},{"toolbar", 7, SYNTAX_BUILTIN},{"instanceof", 10, SYNTAX_KEYWORD},{"Float32Array", 12, SYNTAX_BUILTIN},{"innerWidth", 10, SYNTAX_BUILTIN},{"typeof", 6, SYNTAX_KEYWORD},{"screen", 6, SYNTAX_BUILTIN},{"scrollY", 7, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"pageXOffset", 11, SYNTAX_BUILTIN},{"ReferenceError", 14, SYNTAX_BUILTIN},{"async", 5, SYNTAX_KEYWORD},{"for", 3, SYNTAX_KEYWORD},{"Symbol", 6, SYNTAX_BUILTIN},{"Number", 6, SYNTAX_BUILTIN},{"try", 3, SYNTAX_KEYWORD},{"Uint8ClampedArray", 17, SYNTAX_BUILTIN},{"screenTop", 9, SYNTAX_BUILTIN},{"AsyncFunction", 13, SYNTAX_BUILTIN},{"class", 5, SYNTAX_KEYWORD},{"devicePixelRatio", 16, SYNTAX_BUILTIN},{"isFinite", 8, SYNTAX_BUILTIN},{"GeneratorFunction", 17, SYNTAX_BUILTIN},{"extends", 7, SYNTAX_KEYWORD},{"scrollX", 7, SYNTAX_BUILTIN},{"catch", 5, SYNTAX_KEYWORD},{"throw", 5, SYNTAX_KEYWORD},{"BigInt", 6, SYNTAX_BUILTIN},{"frameElement", 12, SYNTAX_BUILTIN},{"decodeURIComponent", 18, SYNTAX_BUILTIN},{"super", 5, SYNTAX_KEYWORD},{"while", 5, SYNTAX_KEYWORD},{"navigator", 9, SYNTAX_BUILTIN},{"locationbar", 11, SYNTAX_BUILTIN},{"else", 4, SYNTAX_KEYWORD},{"sessionStorage", 14, SYNTAX_BUILTIN},{"delete", 6, SYNTAX_KEYWORD},{"this", 4, SYNTAX_KEYWORD},{"decodeURI", 9, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"customElements", 14, SYNTAX_BUILTIN},{"ArrayBuffer", 11, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"Promise", 7, SYNTAX_BUILTIN},{"const", 5, SYNTAX_KEYWORD},{"WebAssembly", 11, SYNTAX_BUILTIN},{"JSON", 4, SYNTAX_BUILTIN},{"DataView", 8, SYNTAX_BUILTIN},{"do", 2, SYNTAX_KEYWORD},{"menubar", 7, SYNTAX_BUILTIN},{"of", 2, SYNTAX_KEYWORD},{"BigUint64Array", 14, SYNTAX_BUILTIN},{"false", 5, SYNTAX_CONSTANT},{"URIError", 8, SYNTAX_BUILTIN},{"await", 5, SYNTAX_KEYWORD},{"switch", 6, SYNTAX_KEYWORD},{"personalbar", 11, SYNTAX_BUILTIN},{"Proxy", 5, SYNTAX_BUILTIN},{"RegExp", 6, SYNTAX_BUILTIN},{"Reflect", 7, SYNTAX_BUILTIN},{"void", 4, SYNTAX_KEYWORD},{"Float64Array", 12, SYNTAX_BUILTIN},{"Math", 4, SYNTAX_BUILTIN},{"Int16Array", 10, SYNTAX_BUILTIN},{"statusbar", 9, SYNTAX_BUILTIN},{"pageYOffset", 11, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_javascript[48] = {0,35,0,42,16,0,30,36,0,0,25,9,93,1,26,2,0,15,26,12,52,0,64,0,0,21,57,2,16,33,26,96,212,0,75,0,0,44,1,20,140,168,67,0,129,24,78,24};
+static const KeywordTable syntax_all_keywords_javascript = {
+	syntax_keywords_javascript, syntax_keyword_displacements_javascript, 142, 48, 3,
+	{0, 4, 6},
+	{0x95248411u, 0xb16d6aefu, 0xae20f0c1u}
 };
 
-static const Keyword syntax_keywords_json_f[1] = {{"false", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_json_n[1] = {{"null", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_json_t[1] = {{"true", SYNTAX_CONSTANT}};
-static const KeywordList syntax_all_keywords_json[128] = {
-	['f'] = {syntax_keywords_json_f, arr_count(syntax_keywords_json_f)}, ['n'] = {syntax_keywords_json_n, arr_count(syntax_keywords_json_n)}, ['t'] = {syntax_keywords_json_t, arr_count(syntax_keywords_json_t)}
+static const Keyword syntax_keywords_json[3] = {{"true", 4, SYNTAX_CONSTANT},{"null", 4, SYNTAX_CONSTANT},{"false", 5, SYNTAX_CONSTANT}};
+static const u16 syntax_keyword_displacements_json[1] = {12};
+static const KeywordTable syntax_all_keywords_json = {
+	syntax_keywords_json, syntax_keyword_displacements_json, 3, 1, 1,
+	{0},
+	{0x3ceb3ffdu}
 };
 
-static const Keyword syntax_keywords_typescript_A[7] = {{"AggregateError", SYNTAX_BUILTIN},{"Array", SYNTAX_BUILTIN},{"ArrayBuffer", SYNTAX_BUILTIN},{"AsyncFunction", SYNTAX_BUILTIN},{"AsyncGenerator", SYNTAX_BUILTIN},{"AsyncGeneratorFunction", SYNTAX_BUILTIN},{"Atomics", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_B[4] = {{"BigInt", SYNTAX_BUILTIN},{"BigInt64Array", SYNTAX_BUILTIN},{"BigUint64Array", SYNTAX_BUILTIN},{"Boolean", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_D[2] = {{"DataView", SYNTAX_BUILTIN},{"Date", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_E[2] = {{"Error", SYNTAX_BUILTIN},{"EvalError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_F[4] = {{"FinalizationRegistry", SYNTAX_BUILTIN},{"Float32Array", SYNTAX_BUILTIN},{"Float64Array", SYNTAX_BUILTIN},{"Function", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_G[2] = {{"Generator", SYNTAX_BUILTIN},{"GeneratorFunction", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_I[6] = {{"Infinity", SYNTAX_BUILTIN},{"Int16Array", SYNTAX_BUILTIN},{"Int32Array", SYNTAX_BUILTIN},{"Int8Array", SYNTAX_BUILTIN},{"InternalError", SYNTAX_BUILTIN},{"Intl", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_J[1] = {{"JSON", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_M[2] = {{"Map", SYNTAX_BUILTIN},{"Math", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_N[2] = {{"NaN", SYNTAX_BUILTIN},{"Number", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_O[1] = {{"Object", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_P[2] = {{"Promise", SYNTAX_BUILTIN},{"Proxy", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_R[4] = {{"RangeError", SYNTAX_BUILTIN},{"ReferenceError", SYNTAX_BUILTIN},{"Reflect", SYNTAX_BUILTIN},{"RegExp", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_S[5] = {{"Set", SYNTAX_BUILTIN},{"SharedArrayBuffer", SYNTAX_BUILTIN},{"String", SYNTAX_BUILTIN},{"Symbol", SYNTAX_BUILTIN},{"SyntaxError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_T[2] = {{"TypeError", SYNTAX_BUILTIN},{"TypedArray", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_U[5] = {{"URIError", SYNTAX_BUILTIN},{"Uint16Array", SYNTAX_BUILTIN},{"Uint32Array", SYNTAX_BUILTIN},{"Uint8Array", SYNTAX_BUILTIN},{"Uint8ClampedArray", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_W[4] = {{"WeakMap", SYNTAX_BUILTIN},{"WeakRef", SYNTAX_BUILTIN},{"WeakSet", SYNTAX_BUILTIN},{"WebAssembly", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_a[5] = {{"any", SYNTAX_KEYWORD},{"arguments", SYNTAX_BUILTIN},{"as", SYNTAX_KEYWORD},{"async", SYNTAX_KEYWORD},{"await", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_b[1] = {{"break", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_c[7] = {{"case", SYNTAX_KEYWORD},{"catch", SYNTAX_KEYWORD},{"class", SYNTAX_KEYWORD},{"console", SYNTAX_BUILTIN},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"customElements", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_d[8] = {{"debugger", SYNTAX_KEYWORD},{"decodeURI", SYNTAX_BUILTIN},{"decodeURIComponent", SYNTAX_BUILTIN},{"default", SYNTAX_KEYWORD},{"delete", SYNTAX_KEYWORD},{"devicePixelRatio", SYNTAX_BUILTIN},{"do", SYNTAX_KEYWORD},{"document", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_e[7] = {{"else", SYNTAX_KEYWORD},{"encodeURI", SYNTAX_BUILTIN},{"encodeURIComponent", SYNTAX_BUILTIN},{"enum", SYNTAX_KEYWORD},{"eval", SYNTAX_BUILTIN},{"export", SYNTAX_KEYWORD},{"extends", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_f[6] = {{"false", SYNTAX_CONSTANT},{"finally", SYNTAX_KEYWORD},{"for", SYNTAX_KEYWORD},{"frameElement", SYNTAX_BUILTIN},{"frames", SYNTAX_BUILTIN},{"function", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_g[2] = {{"get", SYNTAX_BUILTIN},{"globalThis", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_h[1] = {{"history", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_i[10] = {{"if", SYNTAX_KEYWORD},{"implements", SYNTAX_KEYWORD},{"import", SYNTAX_KEYWORD},{"in", SYNTAX_KEYWORD},{"innerHeight", SYNTAX_BUILTIN},{"innerWidth", SYNTAX_BUILTIN},{"instanceof", SYNTAX_KEYWORD},{"interface", SYNTAX_KEYWORD},{"isFinite", SYNTAX_BUILTIN},{"isNaN", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_l[4] = {{"let", SYNTAX_KEYWORD},{"localStorage", SYNTAX_BUILTIN},{"location", SYNTAX_BUILTIN},{"locationbar", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_m[2] = {{"menubar", SYNTAX_BUILTIN},{"module", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_n[4] = {{"navigator", SYNTAX_BUILTIN},{"new", SYNTAX_KEYWORD},{"null", SYNTAX_CONSTANT},{"number", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_o[4] = {{"of", SYNTAX_KEYWORD},{"opener", SYNTAX_BUILTIN},{"outerHeight", SYNTAX_BUILTIN},{"outerWidth", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_typescript_p[8] = {{"package", SYNTAX_KEYWORD},{"pageXOffset", SYNTAX_BUILTIN},{"pageYOffset", SYNTAX_BUILTIN},{"parseFloat", SYNTAX_BUILTIN},{"parseInt", SYNTAX_BUILTIN},{"personalbar", SYNTAX_BUILTIN},{"private", SYNTAX_KEYWORD},{"public", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_r[1] = {{"return", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_s[17] = {{"scheduler", SYNTAX_BUILTIN},{"screen", SYNTAX_BUILTIN},{"screenLeft", SYNTAX_BUILTIN},{"screenTop", SYNTAX_BUILTIN},{"screenX", SYNTAX_BUILTIN},{"screenY", SYNTAX_BUILTIN},{"scrollX", SYNTAX_BUILTIN},{"scrollY", SYNTAX_BUILTIN},{"scrollbars", SYNTAX_BUILTIN},{"sessionStorage", SYNTAX_BUILTIN},{"set", SYNTAX_BUILTIN},{"speechSynthesis", SYNTAX_BUILTIN},{"static", SYNTAX_KEYWORD},{"statusbar", SYNTAX_BUILTIN},{"string", SYNTAX_BUILTIN},{"super", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_t[7] = {{"this", SYNTAX_KEYWORD},{"throw", SYNTAX_KEYWORD},{"toolbar", SYNTAX_BUILTIN},{"true", SYNTAX_CONSTANT},{"try", SYNTAX_KEYWORD},{"type", SYNTAX_KEYWORD},{"typeof", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_u[1] = {{"undefined", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_typescript_v[3] = {{"var", SYNTAX_KEYWORD},{"visualViewport", SYNTAX_BUILTIN},{"void", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_w[3] = {{"while", SYNTAX_KEYWORD},{"window", SYNTAX_BUILTIN},{"with", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_typescript_y[1] = {{"yield", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_typescript[128] = {
-	['A'] = {syntax_keywords_typescript_A, arr_count(syntax_keywords_typescript_A)}, ['B'] = {syntax_keywords_typescript_B, arr_count(syntax_keywords_typescript_B)}, ['D'] = {syntax_keywords_typescript_D, arr_count(syntax_keywords_typescript_D)}, ['E'] = {syntax_keywords_typescript_E, arr_count(syntax_keywords_typescript_E)}, ['F'] = {syntax_keywords_typescript_F, arr_count(syntax_keywords_typescript_F)}, ['G'] = {syntax_keywords_typescript_G, arr_count(syntax_keywords_typescript_G)}, ['I'] = {syntax_keywords_typescript_I, arr_count(syntax_keywords_typescript_I)}, ['J'] = {syntax_keywords_typescript_J, arr_count(syntax_keywords_typescript_J)}, ['M'] = {syntax_keywords_typescript_M, arr_count(syntax_keywords_typescript_M)}, ['N'] = {syntax_keywords_typescript_N, arr_count(syntax_keywords_typescript_N)}, ['O'] = {syntax_keywords_typescript_O, arr_count(syntax_keywords_typescript_O)}, ['P'] = {syntax_keywords_typescript_P, arr_count(syntax_keywords_typescript_P)}, ['R'] = {syntax_keywords_typescript_R, arr_count(syntax_keywords_typescript_R)}, ['S'] = {syntax_keywords_typescript_S, arr_count(syntax_keywords_typescript_S)}, ['T'] = {syntax_keywords_typescript_T, arr_count(syntax_keywords_typescript_T)}, ['U'] = {syntax_keywords_typescript_U, arr_count(syntax_keywords_typescript_U)}, ['W'] = {syntax_keywords_typescript_W, arr_count(syntax_keywords_typescript_W)}, ['a'] = {syntax_keywords_typescript_a, arr_count(syntax_keywords_typescript_a)}, ['b'] = {syntax_keywords_typescript_b, arr_count(syntax_keywords_typescript_b)}, ['c'] = {syntax_keywords_typescript_c, arr_count(syntax_keywords_typescript_c)}, ['d'] = {syntax_keywords_typescript_d, arr_count(syntax_keywords_typescript_d)}, ['e'] = {syntax_keywords_typescript_e, arr_count(syntax_keywords_typescript_e)}, ['f'] = {syntax_keywords_typescript_f, arr_count(syntax_keywords_typescript_f)}, ['g'] = {syntax_keywords_typescript_g, arr_count(syntax_keywords_typescript_g)}, ['h'] = {syntax_keywords_typescript_h, arr_count(syntax_keywords_typescript_h)}, ['i'] = {syntax_keywords_typescript_i, arr_count(syntax_keywords_typescript_i)}, ['l'] = {syntax_keywords_typescript_l, arr_count(syntax_keywords_typescript_l)}, ['m'] = {syntax_keywords_typescript_m, arr_count(syntax_keywords_typescript_m)}, ['n'] = {syntax_keywords_typescript_n, arr_count(syntax_keywords_typescript_n)}, ['o'] = {syntax_keywords_typescript_o, arr_count(syntax_keywords_typescript_o)}, ['p'] = {syntax_keywords_typescript_p, arr_count(syntax_keywords_typescript_p)}, ['r'] = {syntax_keywords_typescript_r, arr_count(syntax_keywords_typescript_r)}, ['s'] = {syntax_keywords_typescript_s, arr_count(syntax_keywords_typescript_s)}, ['t'] = {syntax_keywords_typescript_t, arr_count(syntax_keywords_typescript_t)}, ['u'] = {syntax_keywords_typescript_u, arr_count(syntax_keywords_typescript_u)}, ['v'] = {syntax_keywords_typescript_v, arr_count(syntax_keywords_typescript_v)}, ['w'] = {syntax_keywords_typescript_w, arr_count(syntax_keywords_typescript_w)}, ['y'] = {syntax_keywords_typescript_y, arr_count(syntax_keywords_typescript_y)}
+static const Keyword syntax_keywords_typescript[157] = {{"personalbar", 11, SYNTAX_BUILTIN},{"RegExp", 6, SYNTAX_BUILTIN},{"string", 6, SYNTAX_BUILTIN},{"scrollX", 7, SYNTAX_BUILTIN},{"customElements", 14, SYNTAX_BUILTIN},{"while", 5, SYNTAX_KEYWORD},{"AsyncFunction", 13, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"menubar", 7, SYNTAX_BUILTIN},{"new", 3, SYNTAX_KEYWORD},{"do", 2, SYNTAX_KEYWORD},{"Reflect", 7, SYNTAX_BUILTIN},{"if", 2, SYNTAX_KEYWORD},{"Array", 5, SYNTAX_BUILTIN},{"TypedArray", 10, SYNTAX_BUILTIN},{"scrollY", 7, SYNTAX_BUILTIN},{"BigUint64Array", 14, SYNTAX_BUILTIN},{"toolbar", 7, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"DataView", 8, SYNTAX_BUILTIN},{"AsyncGenerator", 14, SYNTAX_BUILTIN},{"outerWidth", 10, SYNTAX_BUILTIN},{"BigInt", 6, SYNTAX_BUILTIN},{"decodeURI", 9, SYNTAX_BUILTIN},{"Uint8Array", 10, SYNTAX_BUILTIN},{"Function", 8, SYNTAX_BUILTIN},{"Float32Array", 12, SYNTAX_BUILTIN},{"catch", 5, SYNTAX_KEYWORD},{"sessionStorage", 14, SYNTAX_BUILTIN},{"instanceof", 10, SYNTAX_KEYWORD},{"WebAssembly", 11, SYNTAX_BUILTIN},{"package", 7, SYNTAX_KEYWORD},{"get", 3, SYNTAX_BUILTIN},{"WeakRef", 7, SYNTAX_BUILTIN},{"opener", 6, SYNTAX_BUILTIN},{"SharedArrayBuffer", 17, SYNTAX_BUILTIN},{"Math", 4, SYNTAX_BUILTIN},{"implements", 10, SYNTAX_KEYWORD},{"innerWidth", 10, SYNTAX_BUILTIN},{"default", 7, SYNTAX_KEYWORD},{"this", 4, SYNTAX_KEYWORD},{"SyntaxError", 11, SYNTAX_BUILTIN},{"location", 8, SYNTAX_BUILTIN},{"else", 4, SYNTAX_KEYWORD},{"enum", 4, SYNTAX_KEYWORD},{"with", 4, SYNTAX_KEYWORD},{"any", 3, SYNTAX_KEYWORD},{"await", 5, SYNTAX_KEYWORD},{"encodeURIComponent", 18, SYNTAX_BUILTIN},{"Map", 3, SYNTAX_BUILTIN},{"false", 5, SYNTAX_CONSTANT},{"throw", 5, SYNTAX_KEYWORD},{"window", 6, SYNTAX_BUILTIN},{"Uint32Array", 11, SYNTAX_BUILTIN},{"Symbol", 6, SYNTAX_BUILTIN},{"async", 5, SYNTAX_KEYWORD},{"Uint8ClampedArray", 17, SYNTAX_BUILTIN},{"let", 3, SYNTAX_KEYWORD},{"Date", 4, SYNTAX_BUILTIN},{"import", 6, SYNTAX_KEYWORD},{"for", 3, SYNTAX_KEYWORD},{"Error", 5, SYNTAX_BUILTIN},{"screenTop", 9, SYNTAX_BUILTIN},{"Int32Array", 10, SYNTAX_BUILTIN},{"debugger", 8, SYNTAX_KEYWORD},{"screenX", 7, SYNTAX_BUILTIN},{"history", 7, SYNTAX_BUILTIN},{"Float64Array", 12, SYNTAX_BUILTIN},{"isNaN", 5, SYNTAX_BUILTIN},{"scheduler", 9, SYNTAX_BUILTIN},{"null", 4, SYNTAX_CONSTANT},{"visualViewport", 14, SYNTAX_BUILTIN},{"static", 6, SYNTAX_KEYWORD},{"public", 6, SYNTAX_KEYWORD},{"document", 8, SYNTAX_BUILTIN},{"Proxy", 5, SYNTAX_BUILTIN},{"screenLeft", 10, SYNTAX_BUILTIN},{"URIError", 8, SYNTAX_BUILTIN},{"switch", 6, SYNTAX_KEYWORD},{"const", 5, SYNTAX_KEYWORD},{"private", 7, SYNTAX_KEYWORD},{"export", 6, SYNTAX_KEYWORD},{"void", 4, SYNTAX_KEYWORD},{"AggregateError", 14, SYNTAX_BUILTIN},{"console", 7, SYNTAX_BUILTIN},{"Atomics", 7, SYNTAX_BUILTIN},{"Number", 6, SYNTAX_BUILTIN},{"Boolean", 7, SYNTAX_BUILTIN},{"statusbar", 9, SYNTAX_BUILTIN},{"extends", 7, SYNTAX_KEYWORD},{"case", 4, SYNTAX_KEYWORD},{"as", 2, SYNTAX_KEYWORD},{"decodeURIComponent", 18, SYNTAX_BUILTIN},{"parseFloat", 10, SYNTAX_BUILTIN},{"AsyncGeneratorFunction", 22, SYNTAX_BUILTIN},{"interface", 9, SYNTAX_KEYWORD},{"finally", 7, SYNTAX_KEYWORD},{"TypeError", 9, SYNTAX_BUILTIN},{"eval", 4, SYNTAX_BUILTIN},{"Set", 3, SYNTAX_BUILTIN},{"pageXOffset", 11, SYNTAX_BUILTIN},{"set", 3, SYNTAX_BUILTIN},{"Object", 6, SYNTAX_BUILTIN},{"speechSynthesis", 15, SYNTAX_BUILTIN},{"encodeURI", 9, SYNTAX_BUILTIN},{"WeakSet", 7, SYNTAX_BUILTIN},{"Int16Array", 10, SYNTAX_BUILTIN},{"EvalError", 9, SYNTAX_BUILTIN},{"devicePixelRatio", 16, SYNTAX_BUILTIN},{"isFinite", 8, SYNTAX_BUILTIN},{"screenY", 7, SYNTAX_BUILTIN},{"globalThis", 10, SYNTAX_BUILTIN},{"var", 3, SYNTAX_KEYWORD},{"screen", 6, SYNTAX_BUILTIN},{"try", 3, SYNTAX_KEYWORD},{"localStorage", 12, SYNTAX_BUILTIN},{"locationbar", 11, SYNTAX_BUILTIN},{"WeakMap", 7, SYNTAX_BUILTIN},{"function", 8, SYNTAX_KEYWORD},{"Int8Array", 9, SYNTAX_BUILTIN},{"RangeError", 10, SYNTAX_BUILTIN},{"delete", 6, SYNTAX_KEYWORD},{"Intl", 4, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"navigator", 9, SYNTAX_BUILTIN},{"frames", 6, SYNTAX_BUILTIN},{"yield", 5, SYNTAX_KEYWORD},{"BigInt64Array", 13, SYNTAX_BUILTIN},{"Promise", 7, SYNTAX_BUILTIN},{"ArrayBuffer", 11, SYNTAX_BUILTIN},{"frameElement", 12, SYNTAX_BUILTIN},{"number", 6, SYNTAX_BUILTIN},{"innerHeight", 11, SYNTAX_BUILTIN},{"Generator", 9, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"undefined", 9, SYNTAX_CONSTANT},{"scrollbars", 10, SYNTAX_BUILTIN},{"module", 6, SYNTAX_KEYWORD},{"pageYOffset", 11, SYNTAX_BUILTIN},{"type", 4, SYNTAX_KEYWORD},{"return", 6, SYNTAX_KEYWORD},{"outerHeight", 11, SYNTAX_BUILTIN},{"JSON", 4, SYNTAX_BUILTIN},{"InternalError", 13, SYNTAX_BUILTIN},{"super", 5, SYNTAX_KEYWORD},{"parseInt", 8, SYNTAX_BUILTIN},{"FinalizationRegistry", 20, SYNTAX_BUILTIN},{"Uint16Array", 11, SYNTAX_BUILTIN},{"typeof", 6, SYNTAX_KEYWORD},{"NaN", 3, SYNTAX_BUILTIN},{"GeneratorFunction", 17, SYNTAX_BUILTIN},{"arguments", 9, SYNTAX_BUILTIN},{"of", 2, SYNTAX_KEYWORD},{"class", 5, SYNTAX_KEYWORD},{"Infinity", 8, SYNTAX_BUILTIN},{"ReferenceError", 14, SYNTAX_BUILTIN},{"String", 6, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_typescript[53] = {11,0,0,7,3,0,0,6,110,98,79,19,34,12,6,16,9,1,5,11,0,2,1,64,45,43,55,13,60,7,2,0,2,14,4,1,90,2,7,1,7,224,21,0,25,52,4,227,58,8,40,61,93};
+static const KeywordTable syntax_all_keywords_typescript = {
+	syntax_keywords_typescript, syntax_keyword_displacements_typescript, 157, 53, 4,
+	{0, 4, 6, 1},
+	{0x9c94a947u, 0x7dabc5ddu, 0x398c8575u, 0x291d9a1du}
 };
 
-static const Keyword syntax_keywords_go_a[1] = {{"append", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_b[3] = {{"bool", SYNTAX_BUILTIN},{"break", SYNTAX_KEYWORD},{"byte", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_c[11] = {{"cap", SYNTAX_BUILTIN},{"case", SYNTAX_KEYWORD},{"chan", SYNTAX_KEYWORD},{"close", SYNTAX_BUILTIN},{"comparable", SYNTAX_BUILTIN},{"complex", SYNTAX_BUILTIN},{"complex128", SYNTAX_BUILTIN},{"complex64", SYNTAX_BUILTIN},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"copy", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_d[3] = {{"default", SYNTAX_KEYWORD},{"defer", SYNTAX_KEYWORD},{"delete", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_e[2] = {{"else", SYNTAX_KEYWORD},{"error", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_f[6] = {{"fallthrough", SYNTAX_KEYWORD},{"false", SYNTAX_CONSTANT},{"float32", SYNTAX_BUILTIN},{"float64", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"func", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_go_g[2] = {{"go", SYNTAX_KEYWORD},{"goto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_go_i[10] = {{"if", SYNTAX_KEYWORD},{"imag", SYNTAX_BUILTIN},{"import", SYNTAX_KEYWORD},{"int", SYNTAX_BUILTIN},{"int16", SYNTAX_BUILTIN},{"int32", SYNTAX_BUILTIN},{"int64", SYNTAX_BUILTIN},{"int8", SYNTAX_BUILTIN},{"interface", SYNTAX_KEYWORD},{"iota", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_go_l[1] = {{"len", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_m[2] = {{"make", SYNTAX_BUILTIN},{"map", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_go_n[2] = {{"new", SYNTAX_BUILTIN},{"nil", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_go_p[4] = {{"package", SYNTAX_KEYWORD},{"panic", SYNTAX_BUILTIN},{"print", SYNTAX_BUILTIN},{"println", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_r[5] = {{"range", SYNTAX_KEYWORD},{"real", SYNTAX_BUILTIN},{"recover", SYNTAX_BUILTIN},{"return", SYNTAX_KEYWORD},{"rune", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_s[4] = {{"select", SYNTAX_KEYWORD},{"string", SYNTAX_BUILTIN},{"struct", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_go_t[2] = {{"true", SYNTAX_CONSTANT},{"type", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_go_u[6] = {{"uint", SYNTAX_BUILTIN},{"uint16", SYNTAX_BUILTIN},{"uint32", SYNTAX_BUILTIN},{"uint64", SYNTAX_BUILTIN},{"uint8", SYNTAX_BUILTIN},{"uintptr", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_go_v[1] = {{"var", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_go[128] = {
-	['a'] = {syntax_keywords_go_a, arr_count(syntax_keywords_go_a)}, ['b'] = {syntax_keywords_go_b, arr_count(syntax_keywords_go_b)}, ['c'] = {syntax_keywords_go_c, arr_count(syntax_keywords_go_c)}, ['d'] = {syntax_keywords_go_d, arr_count(syntax_keywords_go_d)}, ['e'] = {syntax_keywords_go_e, arr_count(syntax_keywords_go_e)}, ['f'] = {syntax_keywords_go_f, arr_count(syntax_keywords_go_f)}, ['g'] = {syntax_keywords_go_g, arr_count(syntax_keywords_go_g)}, ['i'] = {syntax_keywords_go_i, arr_count(syntax_keywords_go_i)}, ['l'] = {syntax_keywords_go_l, arr_count(syntax_keywords_go_l)}, ['m'] = {syntax_keywords_go_m, arr_count(syntax_keywords_go_m)}, ['n'] = {syntax_keywords_go_n, arr_count(syntax_keywords_go_n)}, ['p'] = {syntax_keywords_go_p, arr_count(syntax_keywords_go_p)}, ['r'] = {syntax_keywords_go_r, arr_count(syntax_keywords_go_r)}, ['s'] = {syntax_keywords_go_s, arr_count(syntax_keywords_go_s)}, ['t'] = {syntax_keywords_go_t, arr_count(syntax_keywords_go_t)}, ['u'] = {syntax_keywords_go_u, arr_count(syntax_keywords_go_u)}, ['v'] = {syntax_keywords_go_v, arr_count(syntax_keywords_go_v)}
+static const Keyword syntax_keywords_go[65] = {{"uint32", 6, SYNTAX_BUILTIN},{"if", 2, SYNTAX_KEYWORD},{"type", 4, SYNTAX_KEYWORD},{"real", 4, SYNTAX_BUILTIN},{"uintptr", 7, SYNTAX_BUILTIN},{"append", 6, SYNTAX_BUILTIN},{"package", 7, SYNTAX_KEYWORD},{"string", 6, SYNTAX_BUILTIN},{"uint8", 5, SYNTAX_BUILTIN},{"return", 6, SYNTAX_KEYWORD},{"uint64", 6, SYNTAX_BUILTIN},{"int8", 4, SYNTAX_BUILTIN},{"struct", 6, SYNTAX_KEYWORD},{"uint16", 6, SYNTAX_BUILTIN},{"cap", 3, SYNTAX_BUILTIN},{"complex64", 9, SYNTAX_BUILTIN},{"complex", 7, SYNTAX_BUILTIN},{"new", 3, SYNTAX_BUILTIN},{"else", 4, SYNTAX_KEYWORD},{"interface", 9, SYNTAX_KEYWORD},{"iota", 4, SYNTAX_CONSTANT},{"nil", 3, SYNTAX_CONSTANT},{"print", 5, SYNTAX_BUILTIN},{"bool", 4, SYNTAX_BUILTIN},{"println", 7, SYNTAX_BUILTIN},{"copy", 4, SYNTAX_BUILTIN},{"imag", 4, SYNTAX_BUILTIN},{"len", 3, SYNTAX_BUILTIN},{"float32", 7, SYNTAX_BUILTIN},{"complex128", 10, SYNTAX_BUILTIN},{"comparable", 10, SYNTAX_BUILTIN},{"delete", 6, SYNTAX_BUILTIN},{"int", 3, SYNTAX_BUILTIN},{"for", 3, SYNTAX_KEYWORD},{"const", 5, SYNTAX_KEYWORD},{"select", 6, SYNTAX_KEYWORD},{"panic", 5, SYNTAX_BUILTIN},{"default", 7, SYNTAX_KEYWORD},{"map", 3, SYNTAX_KEYWORD},{"func", 4, SYNTAX_KEYWORD},{"defer", 5, SYNTAX_KEYWORD},{"range", 5, SYNTAX_KEYWORD},{"close", 5, SYNTAX_BUILTIN},{"case", 4, SYNTAX_KEYWORD},{"goto", 4, SYNTAX_KEYWORD},{"float64", 7, SYNTAX_BUILTIN},{"var", 3, SYNTAX_KEYWORD},{"make", 4, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"go", 2, SYNTAX_KEYWORD},{"break", 5, SYNTAX_KEYWORD},{"import", 6, SYNTAX_KEYWORD},{"switch", 6, SYNTAX_KEYWORD},{"recover", 7, SYNTAX_BUILTIN},{"false", 5, SYNTAX_CONSTANT},{"int32", 5, SYNTAX_BUILTIN},{"uint", 4, SYNTAX_BUILTIN},{"fallthrough", 11, SYNTAX_KEYWORD},{"int64", 5, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"rune", 4, SYNTAX_BUILTIN},{"int16", 5, SYNTAX_BUILTIN},{"chan", 4, SYNTAX_KEYWORD},{"byte", 4, SYNTAX_BUILTIN},{"error", 5, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_go[22] = {0,2,3,16,3,10,17,0,1,3,26,10,2,36,10,0,14,19,30,52,26,20};
+static const KeywordTable syntax_all_keywords_go = {
+	syntax_keywords_go, syntax_keyword_displacements_go, 65, 22, 3,
+	{6, -5, 1},
+	{0x6a2ca9a3u, 0x49f1b611u, 0x49a6b7edu}
 };
 
-static const Keyword syntax_keywords_java_a[2] = {{"abstract", SYNTAX_KEYWORD},{"assert", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_b[3] = {{"boolean", SYNTAX_KEYWORD},{"break", SYNTAX_KEYWORD},{"byte", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_c[6] = {{"case", SYNTAX_KEYWORD},{"catch", SYNTAX_KEYWORD},{"char", SYNTAX_KEYWORD},{"class", SYNTAX_KEYWORD},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_d[3] = {{"default", SYNTAX_KEYWORD},{"do", SYNTAX_KEYWORD},{"double", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_e[3] = {{"else", SYNTAX_KEYWORD},{"enum", SYNTAX_KEYWORD},{"extends", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_f[5] = {{"false", SYNTAX_CONSTANT},{"final", SYNTAX_KEYWORD},{"finally", SYNTAX_KEYWORD},{"float", SYNTAX_KEYWORD},{"for", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_g[1] = {{"goto", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_i[6] = {{"if", SYNTAX_KEYWORD},{"implements", SYNTAX_KEYWORD},{"import", SYNTAX_KEYWORD},{"instanceof", SYNTAX_KEYWORD},{"int", SYNTAX_KEYWORD},{"interface", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_l[1] = {{"long", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_n[3] = {{"native", SYNTAX_KEYWORD},{"new", SYNTAX_KEYWORD},{"null", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_java_p[4] = {{"package", SYNTAX_KEYWORD},{"private", SYNTAX_KEYWORD},{"protected", SYNTAX_KEYWORD},{"public", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_r[1] = {{"return", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_s[6] = {{"short", SYNTAX_KEYWORD},{"static", SYNTAX_KEYWORD},{"strictfp", SYNTAX_KEYWORD},{"super", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD},{"synchronized", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_t[6] = {{"this", SYNTAX_KEYWORD},{"throw", SYNTAX_KEYWORD},{"throws", SYNTAX_KEYWORD},{"transient", SYNTAX_KEYWORD},{"true", SYNTAX_CONSTANT},{"try", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_v[3] = {{"var", SYNTAX_KEYWORD},{"void", SYNTAX_KEYWORD},{"volatile", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_java_w[1] = {{"while", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_java[128] = {
-	['a'] = {syntax_keywords_java_a, arr_count(syntax_keywords_java_a)}, ['b'] = {syntax_keywords_java_b, arr_count(syntax_keywords_java_b)}, ['c'] = {syntax_keywords_java_c, arr_count(syntax_keywords_java_c)}, ['d'] = {syntax_keywords_java_d, arr_count(syntax_keywords_java_d)}, ['e'] = {syntax_keywords_java_e, arr_count(syntax_keywords_java_e)}, ['f'] = {syntax_keywords_java_f, arr_count(syntax_keywords_java_f)}, ['g'] = {syntax_keywords_java_g, arr_count(syntax_keywords_java_g)}, ['i'] = {syntax_keywords_java_i, arr_count(syntax_keywords_java_i)}, ['l'] = {syntax_keywords_java_l, arr_count(syntax_keywords_java_l)}, ['n'] = {syntax_keywords_java_n, arr_count(syntax_keywords_java_n)}, ['p'] = {syntax_keywords_java_p, arr_count(syntax_keywords_java_p)}, ['r'] = {syntax_keywords_java_r, arr_count(syntax_keywords_java_r)}, ['s'] = {syntax_keywords_java_s, arr_count(syntax_keywords_java_s)}, ['t'] = {syntax_keywords_java_t, arr_count(syntax_keywords_java_t)}, ['v'] = {syntax_keywords_java_v, arr_count(syntax_keywords_java_v)}, ['w'] = {syntax_keywords_java_w, arr_count(syntax_keywords_java_w)}
+static const Keyword syntax_keywords_java[54] = {{"int", 3, SYNTAX_KEYWORD},{"else", 4, SYNTAX_KEYWORD},{"long", 4, SYNTAX_KEYWORD},{"extends", 7, SYNTAX_KEYWORD},{"if", 2, SYNTAX_KEYWORD},{"instanceof", 10, SYNTAX_KEYWORD},{"private", 7, SYNTAX_KEYWORD},{"false", 5, SYNTAX_CONSTANT},{"var", 3, SYNTAX_KEYWORD},{"true", 4, SYNTAX_CONSTANT},{"new", 3, SYNTAX_KEYWORD},{"continue", 8, SYNTAX_KEYWORD},{"throw", 5, SYNTAX_KEYWORD},{"import", 6, SYNTAX_KEYWORD},{"short", 5, SYNTAX_KEYWORD},{"final", 5, SYNTAX_KEYWORD},{"this", 4, SYNTAX_KEYWORD},{"catch", 5, SYNTAX_KEYWORD},{"case", 4, SYNTAX_KEYWORD},{"float", 5, SYNTAX_KEYWORD},{"char", 4, SYNTAX_KEYWORD},{"boolean", 7, SYNTAX_KEYWORD},{"while", 5, SYNTAX_KEYWORD},{"implements", 10, SYNTAX_KEYWORD},{"finally", 7, SYNTAX_KEYWORD},{"double", 6, SYNTAX_KEYWORD},{"transient", 9, SYNTAX_KEYWORD},{"synchronized", 12, SYNTAX_KEYWORD},{"byte", 4, SYNTAX_KEYWORD},{"for", 3, SYNTAX_KEYWORD},{"strictfp", 8, SYNTAX_KEYWORD},{"null", 4, SYNTAX_CONSTANT},{"static", 6, SYNTAX_KEYWORD},{"throws", 6, SYNTAX_KEYWORD},{"try", 3, SYNTAX_KEYWORD},{"return", 6, SYNTAX_KEYWORD},{"void", 4, SYNTAX_KEYWORD},{"const", 5, SYNTAX_KEYWORD},{"public", 6, SYNTAX_KEYWORD},{"goto", 4, SYNTAX_KEYWORD},{"break", 5, SYNTAX_KEYWORD},{"assert", 6, SYNTAX_KEYWORD},{"package", 7, SYNTAX_KEYWORD},{"abstract", 8, SYNTAX_KEYWORD},{"super", 5, SYNTAX_KEYWORD},{"enum", 4, SYNTAX_KEYWORD},{"class", 5, SYNTAX_KEYWORD},{"volatile", 8, SYNTAX_KEYWORD},{"native", 6, SYNTAX_KEYWORD},{"default", 7, SYNTAX_KEYWORD},{"switch", 6, SYNTAX_KEYWORD},{"interface", 9, SYNTAX_KEYWORD},{"protected", 9, SYNTAX_KEYWORD},{"do", 2, SYNTAX_KEYWORD}};
+static const u16 syntax_keyword_displacements_java[18] = {1,0,11,18,0,0,266,0,7,1,16,1,1,5,293,618,1,42};
+static const KeywordTable syntax_all_keywords_java = {
+	syntax_keywords_java, syntax_keyword_displacements_java, 54, 18, 2,
+	{2, 0},
+	{0xe9e4817bu, 0xfabf7431u}
 };
 
-static const Keyword syntax_keywords_python_A[3] = {{"ArithmeticError", SYNTAX_BUILTIN},{"AssertionError", SYNTAX_BUILTIN},{"AttributeError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_B[5] = {{"BaseException", SYNTAX_BUILTIN},{"BlockingIOError", SYNTAX_BUILTIN},{"BrokenPipeError", SYNTAX_BUILTIN},{"BufferError", SYNTAX_BUILTIN},{"BytesWarning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_C[5] = {{"ChildProcessError", SYNTAX_BUILTIN},{"ConnectionAbortedError", SYNTAX_BUILTIN},{"ConnectionError", SYNTAX_BUILTIN},{"ConnectionRefusedError", SYNTAX_BUILTIN},{"ConnectionResetError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_D[1] = {{"DeprecationWarning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_E[4] = {{"EOFError", SYNTAX_BUILTIN},{"Ellipsis", SYNTAX_BUILTIN},{"EnvironmentError", SYNTAX_BUILTIN},{"Exception", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_F[5] = {{"False", SYNTAX_BUILTIN},{"FileExistsError", SYNTAX_BUILTIN},{"FileNotFoundError", SYNTAX_BUILTIN},{"FloatingPointError", SYNTAX_BUILTIN},{"FutureWarning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_G[1] = {{"GeneratorExit", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_I[7] = {{"IOError", SYNTAX_BUILTIN},{"ImportError", SYNTAX_BUILTIN},{"ImportWarning", SYNTAX_BUILTIN},{"IndentationError", SYNTAX_BUILTIN},{"IndexError", SYNTAX_BUILTIN},{"InterruptedError", SYNTAX_BUILTIN},{"IsADirectoryError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_K[2] = {{"KeyError", SYNTAX_BUILTIN},{"KeyboardInterrupt", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_L[1] = {{"LookupError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_M[2] = {{"MemoryError", SYNTAX_BUILTIN},{"ModuleNotFoundError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_N[5] = {{"NameError", SYNTAX_BUILTIN},{"None", SYNTAX_BUILTIN},{"NotADirectoryError", SYNTAX_BUILTIN},{"NotImplemented", SYNTAX_BUILTIN},{"NotImplementedError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_O[2] = {{"OSError", SYNTAX_BUILTIN},{"OverflowError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_P[3] = {{"PendingDeprecationWarning", SYNTAX_BUILTIN},{"PermissionError", SYNTAX_BUILTIN},{"ProcessLookupError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_R[5] = {{"RecursionError", SYNTAX_BUILTIN},{"ReferenceError", SYNTAX_BUILTIN},{"ResourceWarning", SYNTAX_BUILTIN},{"RuntimeError", SYNTAX_BUILTIN},{"RuntimeWarning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_S[6] = {{"StopAsyncIteration", SYNTAX_BUILTIN},{"StopIteration", SYNTAX_BUILTIN},{"SyntaxError", SYNTAX_BUILTIN},{"SyntaxWarning", SYNTAX_BUILTIN},{"SystemError", SYNTAX_BUILTIN},{"SystemExit", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_T[4] = {{"TabError", SYNTAX_BUILTIN},{"TimeoutError", SYNTAX_BUILTIN},{"True", SYNTAX_BUILTIN},{"TypeError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_U[7] = {{"UnboundLocalError", SYNTAX_BUILTIN},{"UnicodeDecodeError", SYNTAX_BUILTIN},{"UnicodeEncodeError", SYNTAX_BUILTIN},{"UnicodeError", SYNTAX_BUILTIN},{"UnicodeTranslateError", SYNTAX_BUILTIN},{"UnicodeWarning", SYNTAX_BUILTIN},{"UserWarning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_V[1] = {{"ValueError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_W[2] = {{"Warning", SYNTAX_BUILTIN},{"WindowsError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_Z[1] = {{"ZeroDivisionError", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_x5f[8] = {{"__build_class__", SYNTAX_BUILTIN},{"__debug__", SYNTAX_BUILTIN},{"__doc__", SYNTAX_BUILTIN},{"__import__", SYNTAX_BUILTIN},{"__loader__", SYNTAX_BUILTIN},{"__name__", SYNTAX_BUILTIN},{"__package__", SYNTAX_BUILTIN},{"__spec__", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_a[9] = {{"abs", SYNTAX_BUILTIN},{"all", SYNTAX_BUILTIN},{"and", SYNTAX_KEYWORD},{"any", SYNTAX_BUILTIN},{"as", SYNTAX_KEYWORD},{"ascii", SYNTAX_BUILTIN},{"assert", SYNTAX_KEYWORD},{"async", SYNTAX_KEYWORD},{"await", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_python_b[6] = {{"bin", SYNTAX_BUILTIN},{"bool", SYNTAX_BUILTIN},{"break", SYNTAX_KEYWORD},{"breakpoint", SYNTAX_BUILTIN},{"bytearray", SYNTAX_BUILTIN},{"bytes", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_c[9] = {{"callable", SYNTAX_BUILTIN},{"chr", SYNTAX_BUILTIN},{"class", SYNTAX_KEYWORD},{"classmethod", SYNTAX_BUILTIN},{"compile", SYNTAX_BUILTIN},{"complex", SYNTAX_BUILTIN},{"continue", SYNTAX_KEYWORD},{"copyright", SYNTAX_BUILTIN},{"credits", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_d[6] = {{"def", SYNTAX_KEYWORD},{"del", SYNTAX_KEYWORD},{"delattr", SYNTAX_BUILTIN},{"dict", SYNTAX_BUILTIN},{"dir", SYNTAX_BUILTIN},{"divmod", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_e[7] = {{"elif", SYNTAX_KEYWORD},{"else", SYNTAX_KEYWORD},{"enumerate", SYNTAX_BUILTIN},{"eval", SYNTAX_BUILTIN},{"except", SYNTAX_KEYWORD},{"exec", SYNTAX_BUILTIN},{"exit", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_f[7] = {{"filter", SYNTAX_BUILTIN},{"finally", SYNTAX_KEYWORD},{"float", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"format", SYNTAX_BUILTIN},{"from", SYNTAX_KEYWORD},{"frozenset", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_g[3] = {{"getattr", SYNTAX_BUILTIN},{"global", SYNTAX_KEYWORD},{"globals", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_h[4] = {{"hasattr", SYNTAX_BUILTIN},{"hash", SYNTAX_BUILTIN},{"help", SYNTAX_BUILTIN},{"hex", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_i[10] = {{"id", SYNTAX_BUILTIN},{"if", SYNTAX_KEYWORD},{"import", SYNTAX_KEYWORD},{"in", SYNTAX_KEYWORD},{"input", SYNTAX_BUILTIN},{"int", SYNTAX_BUILTIN},{"is", SYNTAX_KEYWORD},{"isinstance", SYNTAX_BUILTIN},{"issubclass", SYNTAX_BUILTIN},{"iter", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_l[5] = {{"lambda", SYNTAX_KEYWORD},{"len", SYNTAX_BUILTIN},{"license", SYNTAX_BUILTIN},{"list", SYNTAX_BUILTIN},{"locals", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_m[4] = {{"map", SYNTAX_BUILTIN},{"max", SYNTAX_BUILTIN},{"memoryview", SYNTAX_BUILTIN},{"min", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_n[3] = {{"next", SYNTAX_BUILTIN},{"nonlocal", SYNTAX_KEYWORD},{"not", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_python_o[5] = {{"object", SYNTAX_BUILTIN},{"oct", SYNTAX_BUILTIN},{"open", SYNTAX_BUILTIN},{"or", SYNTAX_KEYWORD},{"ord", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_p[4] = {{"pass", SYNTAX_KEYWORD},{"pow", SYNTAX_BUILTIN},{"print", SYNTAX_BUILTIN},{"property", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_q[1] = {{"quit", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_r[6] = {{"raise", SYNTAX_KEYWORD},{"range", SYNTAX_BUILTIN},{"repr", SYNTAX_BUILTIN},{"return", SYNTAX_KEYWORD},{"reversed", SYNTAX_BUILTIN},{"round", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_s[8] = {{"set", SYNTAX_BUILTIN},{"setattr", SYNTAX_BUILTIN},{"slice", SYNTAX_BUILTIN},{"sorted", SYNTAX_BUILTIN},{"staticmethod", SYNTAX_BUILTIN},{"str", SYNTAX_BUILTIN},{"sum", SYNTAX_BUILTIN},{"super", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_t[3] = {{"try", SYNTAX_KEYWORD},{"tuple", SYNTAX_BUILTIN},{"type", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_v[1] = {{"vars", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_python_w[2] = {{"while", SYNTAX_KEYWORD},{"with", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_python_y[1] = {{"yield", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_python_z[1] = {{"zip", SYNTAX_BUILTIN}};
-static const KeywordList syntax_all_keywords_python[128] = {
-	['A'] = {syntax_keywords_python_A, arr_count(syntax_keywords_python_A)}, ['B'] = {syntax_keywords_python_B, arr_count(syntax_keywords_python_B)}, ['C'] = {syntax_keywords_python_C, arr_count(syntax_keywords_python_C)}, ['D'] = {syntax_keywords_python_D, arr_count(syntax_keywords_python_D)}, ['E'] = {syntax_keywords_python_E, arr_count(syntax_keywords_python_E)}, ['F'] = {syntax_keywords_python_F, arr_count(syntax_keywords_python_F)}, ['G'] = {syntax_keywords_python_G, arr_count(syntax_keywords_python_G)}, ['I'] = {syntax_keywords_python_I, arr_count(syntax_keywords_python_I)}, ['K'] = {syntax_keywords_python_K, arr_count(syntax_keywords_python_K)}, ['L'] = {syntax_keywords_python_L, arr_count(syntax_keywords_python_L)}, ['M'] = {syntax_keywords_python_M, arr_count(syntax_keywords_python_M)}, ['N'] = {syntax_keywords_python_N, arr_count(syntax_keywords_python_N)}, ['O'] = {syntax_keywords_python_O, arr_count(syntax_keywords_python_O)}, ['P'] = {syntax_keywords_python_P, arr_count(syntax_keywords_python_P)}, ['R'] = {syntax_keywords_python_R, arr_count(syntax_keywords_python_R)}, ['S'] = {syntax_keywords_python_S, arr_count(syntax_keywords_python_S)}, ['T'] = {syntax_keywords_python_T, arr_count(syntax_keywords_python_T)}, ['U'] = {syntax_keywords_python_U, arr_count(syntax_keywords_python_U)}, ['V'] = {syntax_keywords_python_V, arr_count(syntax_keywords_python_V)}, ['W'] = {syntax_keywords_python_W, arr_count(syntax_keywords_python_W)}, ['Z'] = {syntax_keywords_python_Z, arr_count(syntax_keywords_python_Z)}, ['_'] = {syntax_keywords_python_x5f, arr_count(syntax_keywords_python_x5f)}, ['a'] = {syntax_keywords_python_a, arr_count(syntax_keywords_python_a)}, ['b'] = {syntax_keywords_python_b, arr_count(syntax_keywords_python_b)}, ['c'] = {syntax_keywords_python_c, arr_count(syntax_keywords_python_c)}, ['d'] = {syntax_keywords_python_d, arr_count(syntax_keywords_python_d)}, ['e'] = {syntax_keywords_python_e, arr_count(syntax_keywords_python_e)}, ['f'] = {syntax_keywords_python_f, arr_count(syntax_keywords_python_f)}, ['g'] = {syntax_keywords_python_g, arr_count(syntax_keywords_python_g)}, ['h'] = {syntax_keywords_python_h, arr_count(syntax_keywords_python_h)}, ['i'] = {syntax_keywords_python_i, arr_count(syntax_keywords_python_i)}, ['l'] = {syntax_keywords_python_l, arr_count(syntax_keywords_python_l)}, ['m'] = {syntax_keywords_python_m, arr_count(syntax_keywords_python_m)}, ['n'] = {syntax_keywords_python_n, arr_count(syntax_keywords_python_n)}, ['o'] = {syntax_keywords_python_o, arr_count(syntax_keywords_python_o)}, ['p'] = {syntax_keywords_python_p, arr_count(syntax_keywords_python_p)}, ['q'] = {syntax_keywords_python_q, arr_count(syntax_keywords_python_q)}, ['r'] = {syntax_keywords_python_r, arr_count(syntax_keywords_python_r)}, ['s'] = {syntax_keywords_python_s, arr_count(syntax_keywords_python_s)}, ['t'] = {syntax_keywords_python_t, arr_count(syntax_keywords_python_t)}, ['v'] = {syntax_keywords_python_v, arr_count(syntax_keywords_python_v)}, ['w'] = {syntax_keywords_python_w, arr_count(syntax_keywords_python_w)}, ['y'] = {syntax_keywords_python_y, arr_count(syntax_keywords_python_y)}, ['z'] = {syntax_keywords_python_z, arr_count(syntax_keywords_python_z)}
+static const Keyword syntax_keywords_python[185] = {{"next", 4, SYNTAX_BUILTIN},{"UserWarning", 11, SYNTAX_BUILTIN},{"credits", 7, SYNTAX_BUILTIN},{"callable", 8, SYNTAX_BUILTIN},{"print", 5, SYNTAX_BUILTIN},{"def", 3, SYNTAX_KEYWORD},{"TimeoutError", 12, SYNTAX_BUILTIN},{"class", 5, SYNTAX_KEYWORD},{"UnboundLocalError", 17, SYNTAX_BUILTIN},{"None", 4, SYNTAX_BUILTIN},{"except", 6, SYNTAX_KEYWORD},{"async", 5, SYNTAX_KEYWORD},{"ord", 3, SYNTAX_BUILTIN},{"all", 3, SYNTAX_BUILTIN},{"str", 3, SYNTAX_BUILTIN},{"SyntaxWarning", 13, SYNTAX_BUILTIN},{"lambda", 6, SYNTAX_KEYWORD},{"copyright", 9, SYNTAX_BUILTIN},{"Warning", 7, SYNTAX_BUILTIN},{"vars", 4, SYNTAX_BUILTIN},{"BaseException", 13, SYNTAX_BUILTIN},{"Exception", 9, SYNTAX_BUILTIN},{"round", 5, SYNTAX_BUILTIN},{"raise", 5, SYNTAX_KEYWORD},{"locals", 6, SYNTAX_BUILTIN},{"pow", 3, SYNTAX_BUILTIN},{"slice", 5, SYNTAX_BUILTIN},{"ValueError", 10, SYNTAX_BUILTIN},{"for", 3, SYNTAX_KEYWORD},{"exec", 4, SYNTAX_BUILTIN},{"BlockingIOError", 15, SYNTAX_BUILTIN},{"ProcessLookupError", 18, SYNTAX_BUILTIN},{"memoryview", 10, SYNTAX_BUILTIN},{"__spec__", 8, SYNTAX_BUILTIN},{"pass", 4, SYNTAX_KEYWORD},{"DeprecationWarning", 18, SYNTAX_BUILTIN},{"getattr", 7, SYNTAX_BUILTIN},{"SyntaxError", 11, SYNTAX_BUILTIN},{"NotADirectoryError", 18, SYNTAX_BUILTIN},{"FutureWarning", 13, SYNTAX_BUILTIN},{"breakpoint", 10, SYNTAX_BUILTIN},{"chr", 3, SYNTAX_BUILTIN},{"filter", 6, SYNTAX_BUILTIN},{"global", 6, SYNTAX_KEYWORD},{"RuntimeWarning", 14, SYNTAX_BUILTIN},{"BrokenPipeError", 15, SYNTAX_BUILTIN},{"LookupError", 11, SYNTAX_BUILTIN},{"UnicodeDecodeError", 18, SYNTAX_BUILTIN},{"KeyboardInterrupt", 17, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"staticmethod", 12, SYNTAX_BUILTIN},{"compile", 7, SYNTAX_BUILTIN},{"help", 4, SYNTAX_BUILTIN},{"id", 2, SYNTAX_BUILTIN},{"quit", 4, SYNTAX_BUILTIN},{"SystemError", 11, SYNTAX_BUILTIN},{"len", 3, SYNTAX_BUILTIN},{"input", 5, SYNTAX_BUILTIN},{"ConnectionError", 15, SYNTAX_BUILTIN},{"hasattr", 7, SYNTAX_BUILTIN},{"NameError", 9, SYNTAX_BUILTIN},{"bytes", 5, SYNTAX_BUILTIN},{"repr", 4, SYNTAX_BUILTIN},{"UnicodeError", 12, SYNTAX_BUILTIN},{"MemoryError", 11, SYNTAX_BUILTIN},{"await", 5, SYNTAX_KEYWORD},{"zip", 3, SYNTAX_BUILTIN},{"divmod", 6, SYNTAX_BUILTIN},{"yield", 5, SYNTAX_KEYWORD},{"complex", 7, SYNTAX_BUILTIN},{"finally", 7, SYNTAX_KEYWORD},{"bool", 4, SYNTAX_BUILTIN},{"hex", 3, SYNTAX_BUILTIN},{"FloatingPointError", 18, SYNTAX_BUILTIN},{"return", 6, SYNTAX_KEYWORD},{"ModuleNotFoundError", 19, SYNTAX_BUILTIN},{"is", 2, SYNTAX_KEYWORD},{"if", 2, SYNTAX_KEYWORD},{"IndexError", 10, SYNTAX_BUILTIN},{"issubclass", 10, SYNTAX_BUILTIN},{"RecursionError", 14, SYNTAX_BUILTIN},{"map", 3, SYNTAX_BUILTIN},{"and", 3, SYNTAX_KEYWORD},{"EnvironmentError", 16, SYNTAX_BUILTIN},{"ImportWarning", 13, SYNTAX_BUILTIN},{"int", 3, SYNTAX_BUILTIN},{"PermissionError", 15, SYNTAX_BUILTIN},{"object", 6, SYNTAX_BUILTIN},{"ascii", 5, SYNTAX_BUILTIN},{"delattr", 7, SYNTAX_BUILTIN},{"StopIteration", 13, SYNTAX_BUILTIN},{"assert", 6, SYNTAX_KEYWORD},{"dir", 3, SYNTAX_BUILTIN},{"try", 3, SYNTAX_KEYWORD},{"ChildProcessError", 17, SYNTAX_BUILTIN},{"license", 7, SYNTAX_BUILTIN},{"IsADirectoryError", 17, SYNTAX_BUILTIN},{"hash", 4, SYNTAX_BUILTIN},{"IndentationError", 16, SYNTAX_BUILTIN},{"ZeroDivisionError", 17, SYNTAX_BUILTIN},{"globals", 7, SYNTAX_BUILTIN},{"nonlocal", 8, SYNTAX_KEYWORD},{"type", 4, SYNTAX_BUILTIN},{"open", 4, SYNTAX_BUILTIN},{"__debug__", 9, SYNTAX_BUILTIN},{"set", 3, SYNTAX_BUILTIN},{"EOFError", 8, SYNTAX_BUILTIN},{"__doc__", 7, SYNTAX_BUILTIN},{"__loader__", 10, SYNTAX_BUILTIN},{"TabError", 8, SYNTAX_BUILTIN},{"UnicodeEncodeError", 18, SYNTAX_BUILTIN},{"min", 3, SYNTAX_BUILTIN},{"InterruptedError", 16, SYNTAX_BUILTIN},{"BytesWarning", 12, SYNTAX_BUILTIN},{"ConnectionAbortedError", 22, SYNTAX_BUILTIN},{"abs", 3, SYNTAX_BUILTIN},{"dict", 4, SYNTAX_BUILTIN},{"ImportError", 11, SYNTAX_BUILTIN},{"OverflowError", 13, SYNTAX_BUILTIN},{"sum", 3, SYNTAX_BUILTIN},{"sorted", 6, SYNTAX_BUILTIN},{"ResourceWarning", 15, SYNTAX_BUILTIN},{"iter", 4, SYNTAX_BUILTIN},{"NotImplementedError", 19, SYNTAX_BUILTIN},{"IOError", 7, SYNTAX_BUILTIN},{"NotImplemented", 14, SYNTAX_BUILTIN},{"elif", 4, SYNTAX_KEYWORD},{"else", 4, SYNTAX_KEYWORD},{"RuntimeError", 12, SYNTAX_BUILTIN},{"FileExistsError", 15, SYNTAX_BUILTIN},{"float", 5, SYNTAX_BUILTIN},{"WindowsError", 12, SYNTAX_BUILTIN},{"TypeError", 9, SYNTAX_BUILTIN},{"ArithmeticError", 15, SYNTAX_BUILTIN},{"classmethod", 11, SYNTAX_BUILTIN},{"oct", 3, SYNTAX_BUILTIN},{"tuple", 5, SYNTAX_BUILTIN},{"or", 2, SYNTAX_KEYWORD},{"UnicodeWarning", 14, SYNTAX_BUILTIN},{"format", 6, SYNTAX_BUILTIN},{"AssertionError", 14, SYNTAX_BUILTIN},{"PendingDeprecationWarning", 25, SYNTAX_BUILTIN},{"not", 3, SYNTAX_KEYWORD},{"FileNotFoundError", 17, SYNTAX_BUILTIN},{"UnicodeTranslateError", 21, SYNTAX_BUILTIN},{"setattr", 7, SYNTAX_BUILTIN},{"super", 5, SYNTAX_BUILTIN},{"max", 3, SYNTAX_BUILTIN},{"bytearray", 9, SYNTAX_BUILTIN},{"with", 4, SYNTAX_KEYWORD},{"reversed", 8, SYNTAX_BUILTIN},{"as", 2, SYNTAX_KEYWORD},{"property", 8, SYNTAX_BUILTIN},{"enumerate", 9, SYNTAX_BUILTIN},{"BufferError", 11, SYNTAX_BUILTIN},{"KeyError", 8, SYNTAX_BUILTIN},{"GeneratorExit", 13, SYNTAX_BUILTIN},{"bin", 3, SYNTAX_BUILTIN},{"eval", 4, SYNTAX_BUILTIN},{"__package__", 11, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"frozenset", 9, SYNTAX_BUILTIN},{"True", 4, SYNTAX_BUILTIN},{"False", 5, SYNTAX_BUILTIN},{"StopAsyncIteration", 18, SYNTAX_BUILTIN},{"AttributeError", 14, SYNTAX_BUILTIN},{"del", 3, SYNTAX_KEYWORD},{"__build_class__", 15, SYNTAX_BUILTIN},{"ReferenceError", 14, SYNTAX_BUILTIN},{"any", 3, SYNTAX_BUILTIN},{"__name__", 8, SYNTAX_BUILTIN},{"import", 6, SYNTAX_KEYWORD},{"exit", 4, SYNTAX_BUILTIN},{"__import__", 10, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"list", 4, SYNTAX_BUILTIN},{"isinstance", 10, SYNTAX_BUILTIN},{"range", 5, SYNTAX_BUILTIN},{"SystemExit", 10, SYNTAX_BUILTIN},{"ConnectionRefusedError", 22, SYNTAX_BUILTIN},{"ConnectionResetError", 20, SYNTAX_BUILTIN},{"Ellipsis", 8, SYNTAX_BUILTIN},{"from", 4, SYNTAX_KEYWORD},{"while", 5, SYNTAX_KEYWORD},{"OSError", 7, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_python[62] = {34,1,3,12,18,5,33,0,1,64,16,1,40,24,12,0,11,13,0,0,2,0,26,2,0,6,5,34,13,7,39,0,40,9,0,17,226,0,6,87,2,74,81,46,52,5,4,6,126,0,112,4,6,2350,23,40,19,3,143,240,13,85};
+static const KeywordTable syntax_all_keywords_python = {
+	syntax_keywords_python, syntax_keyword_displacements_python, 185, 62, 4,
+	{-12, 5, 2, 7},
+	{0xe675127fu, 0xd897843du, 0xce042465u, 0x1cf13d15u}
 };
 
-static const Keyword syntax_keywords_html_a[10] = {{"accept-charset=", SYNTAX_BUILTIN},{"accept=", SYNTAX_BUILTIN},{"accesskey=", SYNTAX_BUILTIN},{"action=", SYNTAX_BUILTIN},{"align=", SYNTAX_BUILTIN},{"alt=", SYNTAX_BUILTIN},{"async=", SYNTAX_BUILTIN},{"autocomplete=", SYNTAX_BUILTIN},{"autofocus=", SYNTAX_BUILTIN},{"autoplay=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_b[2] = {{"bgcolor=", SYNTAX_BUILTIN},{"border=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_c[11] = {{"charset=", SYNTAX_BUILTIN},{"checked=", SYNTAX_BUILTIN},{"cite=", SYNTAX_BUILTIN},{"class=", SYNTAX_BUILTIN},{"color=", SYNTAX_BUILTIN},{"cols=", SYNTAX_BUILTIN},{"colspan=", SYNTAX_BUILTIN},{"content=", SYNTAX_BUILTIN},{"contenteditable=", SYNTAX_BUILTIN},{"controls=", SYNTAX_BUILTIN},{"coords=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_d[9] = {{"data=", SYNTAX_BUILTIN},{"datetime=", SYNTAX_BUILTIN},{"default=", SYNTAX_BUILTIN},{"defer=", SYNTAX_BUILTIN},{"dir=", SYNTAX_BUILTIN},{"dirname=", SYNTAX_BUILTIN},{"disabled=", SYNTAX_BUILTIN},{"download=", SYNTAX_BUILTIN},{"draggable=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_e[1] = {{"enctype=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_f[3] = {{"for=", SYNTAX_BUILTIN},{"form=", SYNTAX_BUILTIN},{"formaction=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_h[7] = {{"headers=", SYNTAX_BUILTIN},{"height=", SYNTAX_BUILTIN},{"hidden=", SYNTAX_BUILTIN},{"high=", SYNTAX_BUILTIN},{"href=", SYNTAX_BUILTIN},{"hreflang=", SYNTAX_BUILTIN},{"http-equiv=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_i[2] = {{"id=", SYNTAX_BUILTIN},{"ismap=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_k[1] = {{"kind=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_l[5] = {{"label=", SYNTAX_BUILTIN},{"lang=", SYNTAX_BUILTIN},{"list=", SYNTAX_BUILTIN},{"loop=", SYNTAX_BUILTIN},{"low=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_m[7] = {{"max=", SYNTAX_BUILTIN},{"maxlength=", SYNTAX_BUILTIN},{"media=", SYNTAX_BUILTIN},{"method=", SYNTAX_BUILTIN},{"min=", SYNTAX_BUILTIN},{"multiple=", SYNTAX_BUILTIN},{"muted=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_n[2] = {{"name=", SYNTAX_BUILTIN},{"novalidate=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_o[72] = {{"onabort=", SYNTAX_BUILTIN},{"onafterprint=", SYNTAX_BUILTIN},{"onbeforeprint=", SYNTAX_BUILTIN},{"onbeforeunload=", SYNTAX_BUILTIN},{"onblur=", SYNTAX_BUILTIN},{"oncanplay=", SYNTAX_BUILTIN},{"oncanplaythrough=", SYNTAX_BUILTIN},{"onchange=", SYNTAX_BUILTIN},{"onclick=", SYNTAX_BUILTIN},{"oncontextmenu=", SYNTAX_BUILTIN},{"oncopy=", SYNTAX_BUILTIN},{"oncuechange=", SYNTAX_BUILTIN},{"oncut=", SYNTAX_BUILTIN},{"ondblclick=", SYNTAX_BUILTIN},{"ondrag=", SYNTAX_BUILTIN},{"ondragend=", SYNTAX_BUILTIN},{"ondragenter=", SYNTAX_BUILTIN},{"ondragleave=", SYNTAX_BUILTIN},{"ondragover=", SYNTAX_BUILTIN},{"ondragstart=", SYNTAX_BUILTIN},{"ondrop=", SYNTAX_BUILTIN},{"ondurationchange=", SYNTAX_BUILTIN},{"onemptied=", SYNTAX_BUILTIN},{"onended=", SYNTAX_BUILTIN},{"onerror=", SYNTAX_BUILTIN},{"onfocus=", SYNTAX_BUILTIN},{"onhashchange=", SYNTAX_BUILTIN},{"oninput=", SYNTAX_BUILTIN},{"oninvalid=", SYNTAX_BUILTIN},{"onkeydown=", SYNTAX_BUILTIN},{"onkeypress=", SYNTAX_BUILTIN},{"onkeyup=", SYNTAX_BUILTIN},{"onload=", SYNTAX_BUILTIN},{"onloadeddata=", SYNTAX_BUILTIN},{"onloadedmetadata=", SYNTAX_BUILTIN},{"onloadstart=", SYNTAX_BUILTIN},{"onmousedown=", SYNTAX_BUILTIN},{"onmousemove=", SYNTAX_BUILTIN},{"onmouseout=", SYNTAX_BUILTIN},{"onmouseover=", SYNTAX_BUILTIN},{"onmouseup=", SYNTAX_BUILTIN},{"onmousewheel=", SYNTAX_BUILTIN},{"onoffline=", SYNTAX_BUILTIN},{"ononline=", SYNTAX_BUILTIN},{"onpagehide=", SYNTAX_BUILTIN},{"onpageshow=", SYNTAX_BUILTIN},{"onpaste=", SYNTAX_BUILTIN},{"onpause=", SYNTAX_BUILTIN},{"onplay=", SYNTAX_BUILTIN},{"onplaying=", SYNTAX_BUILTIN},{"onpopstate=", SYNTAX_BUILTIN},{"onprogress=", SYNTAX_BUILTIN},{"onratechange=", SYNTAX_BUILTIN},{"onreset=", SYNTAX_BUILTIN},{"onresize=", SYNTAX_BUILTIN},{"onscroll=", SYNTAX_BUILTIN},{"onsearch=", SYNTAX_BUILTIN},{"onseeked=", SYNTAX_BUILTIN},{"onseeking=", SYNTAX_BUILTIN},{"onselect=", SYNTAX_BUILTIN},{"onstalled=", SYNTAX_BUILTIN},{"onstorage=", SYNTAX_BUILTIN},{"onsubmit=", SYNTAX_BUILTIN},{"onsuspend=", SYNTAX_BUILTIN},{"ontimeupdate=", SYNTAX_BUILTIN},{"ontoggle=", SYNTAX_BUILTIN},{"onunload=", SYNTAX_BUILTIN},{"onvolumechange=", SYNTAX_BUILTIN},{"onwaiting=", SYNTAX_BUILTIN},{"onwheel=", SYNTAX_BUILTIN},{"open=", SYNTAX_BUILTIN},{"optimum=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_p[4] = {{"pattern=", SYNTAX_BUILTIN},{"placeholder=", SYNTAX_BUILTIN},{"poster=", SYNTAX_BUILTIN},{"preload=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_r[6] = {{"readonly=", SYNTAX_BUILTIN},{"rel=", SYNTAX_BUILTIN},{"required=", SYNTAX_BUILTIN},{"reversed=", SYNTAX_BUILTIN},{"rows=", SYNTAX_BUILTIN},{"rowspan=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_s[15] = {{"sandbox=", SYNTAX_BUILTIN},{"scope=", SYNTAX_BUILTIN},{"selected=", SYNTAX_BUILTIN},{"shape=", SYNTAX_BUILTIN},{"size=", SYNTAX_BUILTIN},{"sizes=", SYNTAX_BUILTIN},{"span=", SYNTAX_BUILTIN},{"spellcheck=", SYNTAX_BUILTIN},{"src=", SYNTAX_BUILTIN},{"srcdoc=", SYNTAX_BUILTIN},{"srclang=", SYNTAX_BUILTIN},{"srcset=", SYNTAX_BUILTIN},{"start=", SYNTAX_BUILTIN},{"step=", SYNTAX_BUILTIN},{"style=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_t[5] = {{"tabindex=", SYNTAX_BUILTIN},{"target=", SYNTAX_BUILTIN},{"title=", SYNTAX_BUILTIN},{"translate=", SYNTAX_BUILTIN},{"type=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_u[1] = {{"usemap=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_v[1] = {{"value=", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_html_w[2] = {{"width=", SYNTAX_BUILTIN},{"wrap=", SYNTAX_BUILTIN}};
-static const KeywordList syntax_all_keywords_html[128] = {
-	['a'] = {syntax_keywords_html_a, arr_count(syntax_keywords_html_a)}, ['b'] = {syntax_keywords_html_b, arr_count(syntax_keywords_html_b)}, ['c'] = {syntax_keywords_html_c, arr_count(syntax_keywords_html_c)}, ['d'] = {syntax_keywords_html_d, arr_count(syntax_keywords_html_d)}, ['e'] = {syntax_keywords_html_e, arr_count(syntax_keywords_html_e)}, ['f'] = {syntax_keywords_html_f, arr_count(syntax_keywords_html_f)}, ['h'] = {syntax_keywords_html_h, arr_count(syntax_keywords_html_h)}, ['i'] = {syntax_keywords_html_i, arr_count(syntax_keywords_html_i)}, ['k'] = {syntax_keywords_html_k, arr_count(syntax_keywords_html_k)}, ['l'] = {syntax_keywords_html_l, arr_count(syntax_keywords_html_l)}, ['m'] = {syntax_keywords_html_m, arr_count(syntax_keywords_html_m)}, ['n'] = {syntax_keywords_html_n, arr_count(syntax_keywords_html_n)}, ['o'] = {syntax_keywords_html_o, arr_count(syntax_keywords_html_o)}, ['p'] = {syntax_keywords_html_p, arr_count(syntax_keywords_html_p)}, ['r'] = {syntax_keywords_html_r, arr_count(syntax_keywords_html_r)}, ['s'] = {syntax_keywords_html_s, arr_count(syntax_keywords_html_s)}, ['t'] = {syntax_keywords_html_t, arr_count(syntax_keywords_html_t)}, ['u'] = {syntax_keywords_html_u, arr_count(syntax_keywords_html_u)}, ['v'] = {syntax_keywords_html_v, arr_count(syntax_keywords_html_v)}, ['w'] = {syntax_keywords_html_w, arr_count(syntax_keywords_html_w)}
+static const Keyword syntax_keywords_html[166] = {{"preload=", 8, SYNTAX_BUILTIN},{"onpagehide=", 11, SYNTAX_BUILTIN},{"low=", 4, SYNTAX_BUILTIN},{"usemap=", 7, SYNTAX_BUILTIN},{"ondragend=", 10, SYNTAX_BUILTIN},{"span=", 5, SYNTAX_BUILTIN},{"onkeydown=", 10, SYNTAX_BUILTIN},{"rows=", 5, SYNTAX_BUILTIN},{"onpageshow=", 11, SYNTAX_BUILTIN},{"default=", 8, SYNTAX_BUILTIN},{"onresize=", 9, SYNTAX_BUILTIN},{"onunload=", 9, SYNTAX_BUILTIN},{"onoffline=", 10, SYNTAX_BUILTIN},{"multiple=", 9, SYNTAX_BUILTIN},{"http-equiv=", 11, SYNTAX_BUILTIN},{"onstalled=", 10, SYNTAX_BUILTIN},{"muted=", 6, SYNTAX_BUILTIN},{"value=", 6, SYNTAX_BUILTIN},{"onsubmit=", 9, SYNTAX_BUILTIN},{"onstorage=", 10, SYNTAX_BUILTIN},{"async=", 6, SYNTAX_BUILTIN},{"hreflang=", 9, SYNTAX_BUILTIN},{"rel=", 4, SYNTAX_BUILTIN},{"content=", 8, SYNTAX_BUILTIN},{"onmousewheel=", 13, SYNTAX_BUILTIN},{"ononline=", 9, SYNTAX_BUILTIN},{"id=", 3, SYNTAX_BUILTIN},{"onmouseover=", 12, SYNTAX_BUILTIN},{"oncopy=", 7, SYNTAX_BUILTIN},{"onpaste=", 8, SYNTAX_BUILTIN},{"ontimeupdate=", 13, SYNTAX_BUILTIN},{"disabled=", 9, SYNTAX_BUILTIN},{"ondragleave=", 12, SYNTAX_BUILTIN},{"onplay=", 7, SYNTAX_BUILTIN},{"ondragenter=", 12, SYNTAX_BUILTIN},{"defer=", 6, SYNTAX_BUILTIN},{"tabindex=", 9, SYNTAX_BUILTIN},{"pattern=", 8, SYNTAX_BUILTIN},{"accept=", 7, SYNTAX_BUILTIN},{"onerror=", 8, SYNTAX_BUILTIN},{"list=", 5, SYNTAX_BUILTIN},{"onloadedmetadata=", 17, SYNTAX_BUILTIN},{"src=", 4, SYNTAX_BUILTIN},{"enctype=", 8, SYNTAX_BUILTIN},{"required=", 9, SYNTAX_BUILTIN},{"colspan=", 8, SYNTAX_BUILTIN},{"wrap=", 5, SYNTAX_BUILTIN},{"onscroll=", 9, SYNTAX_BUILTIN},{"media=", 6, SYNTAX_BUILTIN},{"for=", 4, SYNTAX_BUILTIN},{"reversed=", 9, SYNTAX_BUILTIN},{"height=", 7, SYNTAX_BUILTIN},{"readonly=", 9, SYNTAX_BUILTIN},{"step=", 5, SYNTAX_BUILTIN},{"scope=", 6, SYNTAX_BUILTIN},{"onpause=", 8, SYNTAX_BUILTIN},{"ismap=", 6, SYNTAX_BUILTIN},{"onmousedown=", 12, SYNTAX_BUILTIN},{"autocomplete=", 13, SYNTAX_BUILTIN},{"srcset=", 7, SYNTAX_BUILTIN},{"dirname=", 8, SYNTAX_BUILTIN},{"open=", 5, SYNTAX_BUILTIN},{"datetime=", 9, SYNTAX_BUILTIN},{"data=", 5, SYNTAX_BUILTIN},{"oncuechange=", 12, SYNTAX_BUILTIN},{"novalidate=", 11, SYNTAX_BUILTIN},{"contenteditable=", 16, SYNTAX_BUILTIN},{"width=", 6, SYNTAX_BUILTIN},{"accesskey=", 10, SYNTAX_BUILTIN},{"alt=", 4, SYNTAX_BUILTIN},{"onafterprint=", 13, SYNTAX_BUILTIN},{"download=", 9, SYNTAX_BUILTIN},{"onreset=", 8, SYNTAX_BUILTIN},{"oncanplaythrough=", 17, SYNTAX_BUILTIN},{"target=", 7, SYNTAX_BUILTIN},{"onbeforeprint=", 14, SYNTAX_BUILTIN},{"shape=", 6, SYNTAX_BUILTIN},{"onclick=", 8, SYNTAX_BUILTIN},{"onload=", 7, SYNTAX_BUILTIN},{"loop=", 5, SYNTAX_BUILTIN},{"kind=", 5, SYNTAX_BUILTIN},{"form=", 5, SYNTAX_BUILTIN},{"onblur=", 7, SYNTAX_BUILTIN},{"ondrop=", 7, SYNTAX_BUILTIN},{"onmouseup=", 10, SYNTAX_BUILTIN},{"onplaying=", 10, SYNTAX_BUILTIN},{"onfocus=", 8, SYNTAX_BUILTIN},{"max=", 4, SYNTAX_BUILTIN},{"onbeforeunload=", 15, SYNTAX_BUILTIN},{"rowspan=", 8, SYNTAX_BUILTIN},{"onloadstart=", 12, SYNTAX_BUILTIN},{"autofocus=", 10, SYNTAX_BUILTIN},{"controls=", 9, SYNTAX_BUILTIN},{"oninput=", 8, SYNTAX_BUILTIN},{"coords=", 7, SYNTAX_BUILTIN},{"onsearch=", 9, SYNTAX_BUILTIN},{"selected=", 9, SYNTAX_BUILTIN},{"bgcolor=", 8, SYNTAX_BUILTIN},{"ondrag=", 7, SYNTAX_BUILTIN},{"onseeking=", 10, SYNTAX_BUILTIN},{"onemptied=", 10, SYNTAX_BUILTIN},{"cols=", 5, SYNTAX_BUILTIN},{"poster=", 7, SYNTAX_BUILTIN},{"onmouseout=", 11, SYNTAX_BUILTIN},{"sandbox=", 8, SYNTAX_BUILTIN},{"onabort=", 8, SYNTAX_BUILTIN},{"oninvalid=", 10, SYNTAX_BUILTIN},{"ondragstart=", 12, SYNTAX_BUILTIN},{"class=", 6, SYNTAX_BUILTIN},{"ontoggle=", 9, SYNTAX_BUILTIN},{"cite=", 5, SYNTAX_BUILTIN},{"href=", 5, SYNTAX_BUILTIN},{"maxlength=", 10, SYNTAX_BUILTIN},{"onratechange=", 13, SYNTAX_BUILTIN},{"lang=", 5, SYNTAX_BUILTIN},{"charset=", 8, SYNTAX_BUILTIN},{"placeholder=", 12, SYNTAX_BUILTIN},{"accept-charset=", 15, SYNTAX_BUILTIN},{"name=", 5, SYNTAX_BUILTIN},{"optimum=", 8, SYNTAX_BUILTIN},{"headers=", 8, SYNTAX_BUILTIN},{"onloadeddata=", 13, SYNTAX_BUILTIN},{"translate=", 10, SYNTAX_BUILTIN},{"onkeyup=", 8, SYNTAX_BUILTIN},{"onsuspend=", 10, SYNTAX_BUILTIN},{"ondblclick=", 11, SYNTAX_BUILTIN},{"method=", 7, SYNTAX_BUILTIN},{"onhashchange=", 13, SYNTAX_BUILTIN},{"dir=", 4, SYNTAX_BUILTIN},{"sizes=", 6, SYNTAX_BUILTIN},{"action=", 7, SYNTAX_BUILTIN},{"color=", 6, SYNTAX_BUILTIN},{"oncut=", 6, SYNTAX_BUILTIN},{"ondurationchange=", 17, SYNTAX_BUILTIN},{"start=", 6, SYNTAX_BUILTIN},{"srclang=", 8, SYNTAX_BUILTIN},{"align=", 6, SYNTAX_BUILTIN},{"draggable=", 10, SYNTAX_BUILTIN},{"onmousemove=", 12, SYNTAX_BUILTIN},{"label=", 6, SYNTAX_BUILTIN},{"checked=", 8, SYNTAX_BUILTIN},{"oncanplay=", 10, SYNTAX_BUILTIN},{"formaction=", 11, SYNTAX_BUILTIN},{"onwaiting=", 10, SYNTAX_BUILTIN},{"high=", 5, SYNTAX_BUILTIN},{"title=", 6, SYNTAX_BUILTIN},{"min=", 4, SYNTAX_BUILTIN},{"style=", 6, SYNTAX_BUILTIN},{"onkeypress=", 11, SYNTAX_BUILTIN},{"onwheel=", 8, SYNTAX_BUILTIN},{"srcdoc=", 7, SYNTAX_BUILTIN},{"onselect=", 9, SYNTAX_BUILTIN},{"spellcheck=", 11, SYNTAX_BUILTIN},{"autoplay=", 9, SYNTAX_BUILTIN},{"type=", 5, SYNTAX_BUILTIN},{"onprogress=", 11, SYNTAX_BUILTIN},{"size=", 5, SYNTAX_BUILTIN},{"onchange=", 9, SYNTAX_BUILTIN},{"onseeked=", 9, SYNTAX_BUILTIN},{"border=", 7, SYNTAX_BUILTIN},{"onvolumechange=", 15, SYNTAX_BUILTIN},{"onpopstate=", 11, SYNTAX_BUILTIN},{"oncontextmenu=", 14, SYNTAX_BUILTIN},{"ondragover=", 11, SYNTAX_BUILTIN},{"hidden=", 7, SYNTAX_BUILTIN},{"onended=", 8, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_html[56] = {0,0,32,13,17,157,0,0,71,14,0,8,1,1,79,1,30,5,6,1,0,2,21,1,6,1,13,9,14,158,5,0,45,0,2,44,94,225,17,10,3,73,0,3,302,256,50,189,6,720,0,207,2,19,17,28};
+static const KeywordTable syntax_all_keywords_html = {
+	syntax_keywords_html, syntax_keyword_displacements_html, 166, 56, 3,
+	{2, -4, -2},
+	{0x2dc03943u, 0xa1e5c1f5u, 0x9a6e5fd3u}
 };
 
-static const Keyword syntax_keywords_config_f[1] = {{"false", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_config_n[1] = {{"no", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_config_o[2] = {{"off", SYNTAX_CONSTANT},{"on", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_config_t[1] = {{"true", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_config_y[1] = {{"yes", SYNTAX_CONSTANT}};
-static const KeywordList syntax_all_keywords_config[128] = {
-	['f'] = {syntax_keywords_config_f, arr_count(syntax_keywords_config_f)}, ['n'] = {syntax_keywords_config_n, arr_count(syntax_keywords_config_n)}, ['o'] = {syntax_keywords_config_o, arr_count(syntax_keywords_config_o)}, ['t'] = {syntax_keywords_config_t, arr_count(syntax_keywords_config_t)}, ['y'] = {syntax_keywords_config_y, arr_count(syntax_keywords_config_y)}
+static const Keyword syntax_keywords_config[6] = {{"yes", 3, SYNTAX_CONSTANT},{"off", 3, SYNTAX_CONSTANT},{"on", 2, SYNTAX_CONSTANT},{"true", 4, SYNTAX_CONSTANT},{"no", 2, SYNTAX_CONSTANT},{"false", 5, SYNTAX_CONSTANT}};
+static const u16 syntax_keyword_displacements_config[2] = {6,61};
+static const KeywordTable syntax_all_keywords_config = {
+	syntax_keywords_config, syntax_keyword_displacements_config, 6, 2, 1,
+	{0},
+	{0xcb1855ffu}
 };
 
-static const Keyword syntax_keywords_glsl_E[4] = {{"EmitStreamVertex", SYNTAX_BUILTIN},{"EmitVertex", SYNTAX_BUILTIN},{"EndPrimitive", SYNTAX_BUILTIN},{"EndStreamPrimitive", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_a[22] = {{"abs", SYNTAX_BUILTIN},{"acos", SYNTAX_BUILTIN},{"acosh", SYNTAX_BUILTIN},{"all", SYNTAX_BUILTIN},{"any", SYNTAX_BUILTIN},{"asin", SYNTAX_BUILTIN},{"asinh", SYNTAX_BUILTIN},{"atan", SYNTAX_BUILTIN},{"atanh", SYNTAX_BUILTIN},{"atomicAdd", SYNTAX_BUILTIN},{"atomicAnd", SYNTAX_BUILTIN},{"atomicCompSwap", SYNTAX_BUILTIN},{"atomicCounter", SYNTAX_BUILTIN},{"atomicCounterDecrement", SYNTAX_BUILTIN},{"atomicCounterIncrement", SYNTAX_BUILTIN},{"atomicExchange", SYNTAX_BUILTIN},{"atomicMax", SYNTAX_BUILTIN},{"atomicMin", SYNTAX_BUILTIN},{"atomicOr", SYNTAX_BUILTIN},{"atomicXor", SYNTAX_BUILTIN},{"atomic_uint", SYNTAX_KEYWORD},{"attribute", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_b[11] = {{"barrier", SYNTAX_BUILTIN},{"bitCount", SYNTAX_BUILTIN},{"bitfieldExtract", SYNTAX_BUILTIN},{"bitfieldInsert", SYNTAX_BUILTIN},{"bitfieldReverse", SYNTAX_BUILTIN},{"bool", SYNTAX_KEYWORD},{"break", SYNTAX_KEYWORD},{"buffer", SYNTAX_KEYWORD},{"bvec2", SYNTAX_KEYWORD},{"bvec3", SYNTAX_KEYWORD},{"bvec4", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_c[10] = {{"case", SYNTAX_KEYWORD},{"ceil", SYNTAX_BUILTIN},{"centroid", SYNTAX_KEYWORD},{"clamp", SYNTAX_BUILTIN},{"coherent", SYNTAX_KEYWORD},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"cos", SYNTAX_BUILTIN},{"cosh", SYNTAX_BUILTIN},{"cross", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_d[29] = {{"dFdx", SYNTAX_BUILTIN},{"dFdxCoarse", SYNTAX_BUILTIN},{"dFdxFine", SYNTAX_BUILTIN},{"dFdy", SYNTAX_BUILTIN},{"dFdyCoarse", SYNTAX_BUILTIN},{"dFdyFine", SYNTAX_BUILTIN},{"default", SYNTAX_KEYWORD},{"degrees", SYNTAX_BUILTIN},{"determinant", SYNTAX_BUILTIN},{"discard", SYNTAX_KEYWORD},{"distance", SYNTAX_BUILTIN},{"dmat2", SYNTAX_KEYWORD},{"dmat2x2", SYNTAX_KEYWORD},{"dmat2x3", SYNTAX_KEYWORD},{"dmat2x4", SYNTAX_KEYWORD},{"dmat3", SYNTAX_KEYWORD},{"dmat3x2", SYNTAX_KEYWORD},{"dmat3x3", SYNTAX_KEYWORD},{"dmat3x4", SYNTAX_KEYWORD},{"dmat4", SYNTAX_KEYWORD},{"dmat4x2", SYNTAX_KEYWORD},{"dmat4x3", SYNTAX_KEYWORD},{"dmat4x4", SYNTAX_KEYWORD},{"do", SYNTAX_KEYWORD},{"dot", SYNTAX_BUILTIN},{"double", SYNTAX_KEYWORD},{"dvec2", SYNTAX_KEYWORD},{"dvec3", SYNTAX_KEYWORD},{"dvec4", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_e[4] = {{"else", SYNTAX_KEYWORD},{"equal", SYNTAX_BUILTIN},{"exp", SYNTAX_BUILTIN},{"exp2", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_f[16] = {{"faceforward", SYNTAX_BUILTIN},{"false", SYNTAX_KEYWORD},{"findLSB", SYNTAX_BUILTIN},{"findMSB", SYNTAX_BUILTIN},{"flat", SYNTAX_KEYWORD},{"float", SYNTAX_KEYWORD},{"floatBitsToInt", SYNTAX_BUILTIN},{"floatBitsToUint", SYNTAX_BUILTIN},{"floor", SYNTAX_BUILTIN},{"fma", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"fract", SYNTAX_BUILTIN},{"frexp", SYNTAX_BUILTIN},{"fwidth", SYNTAX_BUILTIN},{"fwidthCoarse", SYNTAX_BUILTIN},{"fwidthFine", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_g[34] = {{"gl_ClipDistance", SYNTAX_BUILTIN},{"gl_CullDistance", SYNTAX_BUILTIN},{"gl_FragCoord", SYNTAX_BUILTIN},{"gl_FragDepth", SYNTAX_BUILTIN},{"gl_FrontFacing", SYNTAX_BUILTIN},{"gl_GlobalInvocationID", SYNTAX_BUILTIN},{"gl_HelperInvocation", SYNTAX_BUILTIN},{"gl_InstanceID", SYNTAX_BUILTIN},{"gl_InvocationID", SYNTAX_BUILTIN},{"gl_Layer", SYNTAX_BUILTIN},{"gl_LocalInvocationID", SYNTAX_BUILTIN},{"gl_LocalInvocationIndex", SYNTAX_BUILTIN},{"gl_NumSamples", SYNTAX_BUILTIN},{"gl_NumWorkGroups", SYNTAX_BUILTIN},{"gl_PatchVerticesIn", SYNTAX_BUILTIN},{"gl_PointCoord", SYNTAX_BUILTIN},{"gl_PointSize", SYNTAX_BUILTIN},{"gl_Position", SYNTAX_BUILTIN},{"gl_PrimitiveID", SYNTAX_BUILTIN},{"gl_PrimitiveIDIn", SYNTAX_BUILTIN},{"gl_SampleID", SYNTAX_BUILTIN},{"gl_SampleMask", SYNTAX_BUILTIN},{"gl_SampleMaskIn", SYNTAX_BUILTIN},{"gl_SamplePosition", SYNTAX_BUILTIN},{"gl_TessCoord", SYNTAX_BUILTIN},{"gl_TessLevelInner", SYNTAX_BUILTIN},{"gl_TessLevelOuter", SYNTAX_BUILTIN},{"gl_VertexID", SYNTAX_BUILTIN},{"gl_ViewportIndex", SYNTAX_BUILTIN},{"gl_WorkGroupID", SYNTAX_BUILTIN},{"gl_WorkGroupSize", SYNTAX_BUILTIN},{"greaterThan", SYNTAX_BUILTIN},{"greaterThanEqual", SYNTAX_BUILTIN},{"groupMemoryBarrier", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_h[1] = {{"highp", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_i[62] = {{"if", SYNTAX_KEYWORD},{"iimage1D", SYNTAX_KEYWORD},{"iimage1DArray", SYNTAX_KEYWORD},{"iimage2D", SYNTAX_KEYWORD},{"iimage2DArray", SYNTAX_KEYWORD},{"iimage2DMS", SYNTAX_KEYWORD},{"iimage2DMSArray", SYNTAX_KEYWORD},{"iimage2DRect", SYNTAX_KEYWORD},{"iimage3D", SYNTAX_KEYWORD},{"iimageBuffer", SYNTAX_KEYWORD},{"iimageCube", SYNTAX_KEYWORD},{"iimageCubeArray", SYNTAX_KEYWORD},{"image1D", SYNTAX_KEYWORD},{"image1DArray", SYNTAX_KEYWORD},{"image2D", SYNTAX_KEYWORD},{"image2DArray", SYNTAX_KEYWORD},{"image2DMS", SYNTAX_KEYWORD},{"image2DMSArray", SYNTAX_KEYWORD},{"image2DRect", SYNTAX_KEYWORD},{"image3D", SYNTAX_KEYWORD},{"imageAtomicAdd", SYNTAX_BUILTIN},{"imageAtomicAnd", SYNTAX_BUILTIN},{"imageAtomicCompSwap", SYNTAX_BUILTIN},{"imageAtomicExchange", SYNTAX_BUILTIN},{"imageAtomicMax", SYNTAX_BUILTIN},{"imageAtomicMin", SYNTAX_BUILTIN},{"imageAtomicOr", SYNTAX_BUILTIN},{"imageAtomicXor", SYNTAX_BUILTIN},{"imageBuffer", SYNTAX_KEYWORD},{"imageCube", SYNTAX_KEYWORD},{"imageCubeArray", SYNTAX_KEYWORD},{"imageLoad", SYNTAX_BUILTIN},{"imageSamples", SYNTAX_BUILTIN},{"imageSize", SYNTAX_BUILTIN},{"imageStore", SYNTAX_BUILTIN},{"imulExtended", SYNTAX_BUILTIN},{"in", SYNTAX_KEYWORD},{"inout", SYNTAX_KEYWORD},{"int", SYNTAX_KEYWORD},{"intBitsToFloat", SYNTAX_BUILTIN},{"interpolateAtCentroid", SYNTAX_BUILTIN},{"interpolateAtOffset", SYNTAX_BUILTIN},{"interpolateAtSample", SYNTAX_BUILTIN},{"invariant", SYNTAX_KEYWORD},{"inverse", SYNTAX_BUILTIN},{"inversesqrt", SYNTAX_BUILTIN},{"isampler1D", SYNTAX_KEYWORD},{"isampler1DArray", SYNTAX_KEYWORD},{"isampler2D", SYNTAX_KEYWORD},{"isampler2DArray", SYNTAX_KEYWORD},{"isampler2DMS", SYNTAX_KEYWORD},{"isampler2DMSArray", SYNTAX_KEYWORD},{"isampler2DRect", SYNTAX_KEYWORD},{"isampler3D", SYNTAX_KEYWORD},{"isamplerBuffer", SYNTAX_KEYWORD},{"isamplerCube", SYNTAX_KEYWORD},{"isamplerCubeArray", SYNTAX_KEYWORD},{"isinf", SYNTAX_BUILTIN},{"isnan", SYNTAX_BUILTIN},{"ivec2", SYNTAX_KEYWORD},{"ivec3", SYNTAX_KEYWORD},{"ivec4", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_l[8] = {{"layout", SYNTAX_KEYWORD},{"ldexp", SYNTAX_BUILTIN},{"length", SYNTAX_BUILTIN},{"lessThan", SYNTAX_BUILTIN},{"lessThanEqual", SYNTAX_BUILTIN},{"log", SYNTAX_BUILTIN},{"log2", SYNTAX_BUILTIN},{"lowp", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_m[24] = {{"mat2", SYNTAX_KEYWORD},{"mat2x2", SYNTAX_KEYWORD},{"mat2x3", SYNTAX_KEYWORD},{"mat2x4", SYNTAX_KEYWORD},{"mat3", SYNTAX_KEYWORD},{"mat3x2", SYNTAX_KEYWORD},{"mat3x3", SYNTAX_KEYWORD},{"mat3x4", SYNTAX_KEYWORD},{"mat4", SYNTAX_KEYWORD},{"mat4x2", SYNTAX_KEYWORD},{"mat4x3", SYNTAX_KEYWORD},{"mat4x4", SYNTAX_KEYWORD},{"matrixCompMult", SYNTAX_BUILTIN},{"max", SYNTAX_BUILTIN},{"mediump", SYNTAX_KEYWORD},{"memoryBarrier", SYNTAX_BUILTIN},{"memoryBarrierAtomicCounter", SYNTAX_BUILTIN},{"memoryBarrierBuffer", SYNTAX_BUILTIN},{"memoryBarrierImage", SYNTAX_BUILTIN},{"memoryBarrierShared", SYNTAX_BUILTIN},{"min", SYNTAX_BUILTIN},{"mix", SYNTAX_BUILTIN},{"mod", SYNTAX_BUILTIN},{"modf", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_n[9] = {{"noise", SYNTAX_BUILTIN},{"noise1", SYNTAX_BUILTIN},{"noise2", SYNTAX_BUILTIN},{"noise3", SYNTAX_BUILTIN},{"noise4", SYNTAX_BUILTIN},{"noperspective", SYNTAX_KEYWORD},{"normalize", SYNTAX_BUILTIN},{"not", SYNTAX_BUILTIN},{"notEqual", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_o[2] = {{"out", SYNTAX_KEYWORD},{"outerProduct", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_p[11] = {{"packDouble2x32", SYNTAX_BUILTIN},{"packHalf2x16", SYNTAX_BUILTIN},{"packSnorm2x16", SYNTAX_BUILTIN},{"packSnorm4x8", SYNTAX_BUILTIN},{"packUnorm", SYNTAX_BUILTIN},{"packUnorm2x16", SYNTAX_BUILTIN},{"packUnorm4x8", SYNTAX_BUILTIN},{"patch", SYNTAX_KEYWORD},{"pow", SYNTAX_BUILTIN},{"precise", SYNTAX_KEYWORD},{"precision", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_r[9] = {{"radians", SYNTAX_BUILTIN},{"readonly", SYNTAX_KEYWORD},{"reflect", SYNTAX_BUILTIN},{"refract", SYNTAX_BUILTIN},{"removedTypes", SYNTAX_BUILTIN},{"restrict", SYNTAX_KEYWORD},{"return", SYNTAX_KEYWORD},{"round", SYNTAX_BUILTIN},{"roundEven", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_s[30] = {{"sample", SYNTAX_KEYWORD},{"sampler1D", SYNTAX_KEYWORD},{"sampler1DArray", SYNTAX_KEYWORD},{"sampler1DArrayShadow", SYNTAX_KEYWORD},{"sampler1DShadow", SYNTAX_KEYWORD},{"sampler2D", SYNTAX_KEYWORD},{"sampler2DArray", SYNTAX_KEYWORD},{"sampler2DArrayShadow", SYNTAX_KEYWORD},{"sampler2DMS", SYNTAX_KEYWORD},{"sampler2DMSArray", SYNTAX_KEYWORD},{"sampler2DRect", SYNTAX_KEYWORD},{"sampler2DRectShadow", SYNTAX_KEYWORD},{"sampler2DShadow", SYNTAX_KEYWORD},{"sampler3D", SYNTAX_KEYWORD},{"samplerBuffer", SYNTAX_KEYWORD},{"samplerCube", SYNTAX_KEYWORD},{"samplerCubeArray", SYNTAX_KEYWORD},{"samplerCubeArrayShadow", SYNTAX_KEYWORD},{"samplerCubeShadow", SYNTAX_KEYWORD},{"shared", SYNTAX_KEYWORD},{"sign", SYNTAX_BUILTIN},{"sin", SYNTAX_BUILTIN},{"sinh", SYNTAX_BUILTIN},{"smooth", SYNTAX_KEYWORD},{"smoothstep", SYNTAX_BUILTIN},{"sqrt", SYNTAX_BUILTIN},{"step", SYNTAX_BUILTIN},{"struct", SYNTAX_KEYWORD},{"subroutine", SYNTAX_KEYWORD},{"switch", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_t[26] = {{"tan", SYNTAX_BUILTIN},{"tanh", SYNTAX_BUILTIN},{"texelFetch", SYNTAX_BUILTIN},{"texelFetchOffset", SYNTAX_BUILTIN},{"texture", SYNTAX_BUILTIN},{"textureGather", SYNTAX_BUILTIN},{"textureGatherOffset", SYNTAX_BUILTIN},{"textureGatherOffsets", SYNTAX_BUILTIN},{"textureGrad", SYNTAX_BUILTIN},{"textureGradOffset", SYNTAX_BUILTIN},{"textureLod", SYNTAX_BUILTIN},{"textureLodOffset", SYNTAX_BUILTIN},{"textureOffset", SYNTAX_BUILTIN},{"textureProj", SYNTAX_BUILTIN},{"textureProjGrad", SYNTAX_BUILTIN},{"textureProjGradOffset", SYNTAX_BUILTIN},{"textureProjLod", SYNTAX_BUILTIN},{"textureProjLodOffset", SYNTAX_BUILTIN},{"textureProjOffset", SYNTAX_BUILTIN},{"textureQueryLevels", SYNTAX_BUILTIN},{"textureQueryLod", SYNTAX_BUILTIN},{"textureSamples", SYNTAX_BUILTIN},{"textureSize", SYNTAX_BUILTIN},{"transpose", SYNTAX_BUILTIN},{"true", SYNTAX_KEYWORD},{"trunc", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_glsl_u[38] = {{"uaddCarry", SYNTAX_BUILTIN},{"uimage1D", SYNTAX_KEYWORD},{"uimage1DArray", SYNTAX_KEYWORD},{"uimage2D", SYNTAX_KEYWORD},{"uimage2DArray", SYNTAX_KEYWORD},{"uimage2DMS", SYNTAX_KEYWORD},{"uimage2DMSArray", SYNTAX_KEYWORD},{"uimage2DRect", SYNTAX_KEYWORD},{"uimage3D", SYNTAX_KEYWORD},{"uimageBuffer", SYNTAX_KEYWORD},{"uimageCube", SYNTAX_KEYWORD},{"uimageCubeArray", SYNTAX_KEYWORD},{"uint", SYNTAX_KEYWORD},{"uintBitsToFloat", SYNTAX_BUILTIN},{"umulExtended", SYNTAX_BUILTIN},{"uniform", SYNTAX_KEYWORD},{"unpackDouble2x32", SYNTAX_BUILTIN},{"unpackHalf2x16", SYNTAX_BUILTIN},{"unpackSnorm2x16", SYNTAX_BUILTIN},{"unpackSnorm4x8", SYNTAX_BUILTIN},{"unpackUnorm", SYNTAX_BUILTIN},{"unpackUnorm2x16", SYNTAX_BUILTIN},{"unpackUnorm4x8", SYNTAX_BUILTIN},{"usampler1D", SYNTAX_KEYWORD},{"usampler1DArray", SYNTAX_KEYWORD},{"usampler2D", SYNTAX_KEYWORD},{"usampler2DArray", SYNTAX_KEYWORD},{"usampler2DMS", SYNTAX_KEYWORD},{"usampler2DMSArray", SYNTAX_KEYWORD},{"usampler2DRect", SYNTAX_KEYWORD},{"usampler3D", SYNTAX_KEYWORD},{"usamplerBuffer", SYNTAX_KEYWORD},{"usamplerCube", SYNTAX_KEYWORD},{"usamplerCubeArray", SYNTAX_KEYWORD},{"usubBorrow", SYNTAX_BUILTIN},{"uvec2", SYNTAX_KEYWORD},{"uvec3", SYNTAX_KEYWORD},{"uvec4", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_v[6] = {{"varying", SYNTAX_KEYWORD},{"vec2", SYNTAX_KEYWORD},{"vec3", SYNTAX_KEYWORD},{"vec4", SYNTAX_KEYWORD},{"void", SYNTAX_KEYWORD},{"volatile", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_glsl_w[2] = {{"while", SYNTAX_KEYWORD},{"writeonly", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_glsl[128] = {
-	['E'] = {syntax_keywords_glsl_E, arr_count(syntax_keywords_glsl_E)}, ['a'] = {syntax_keywords_glsl_a, arr_count(syntax_keywords_glsl_a)}, ['b'] = {syntax_keywords_glsl_b, arr_count(syntax_keywords_glsl_b)}, ['c'] = {syntax_keywords_glsl_c, arr_count(syntax_keywords_glsl_c)}, ['d'] = {syntax_keywords_glsl_d, arr_count(syntax_keywords_glsl_d)}, ['e'] = {syntax_keywords_glsl_e, arr_count(syntax_keywords_glsl_e)}, ['f'] = {syntax_keywords_glsl_f, arr_count(syntax_keywords_glsl_f)}, ['g'] = {syntax_keywords_glsl_g, arr_count(syntax_keywords_glsl_g)}, ['h'] = {syntax_keywords_glsl_h, arr_count(syntax_keywords_glsl_h)}, ['i'] = {syntax_keywords_glsl_i, arr_count(syntax_keywords_glsl_i)}, ['l'] = {syntax_keywords_glsl_l, arr_count(syntax_keywords_glsl_l)}, ['m'] = {syntax_keywords_glsl_m, arr_count(syntax_keywords_glsl_m)}, ['n'] = {syntax_keywords_glsl_n, arr_count(syntax_keywords_glsl_n)}, ['o'] = {syntax_keywords_glsl_o, arr_count(syntax_keywords_glsl_o)}, ['p'] = {syntax_keywords_glsl_p, arr_count(syntax_keywords_glsl_p)}, ['r'] = {syntax_keywords_glsl_r, arr_count(syntax_keywords_glsl_r)}, ['s'] = {syntax_keywords_glsl_s, arr_count(syntax_keywords_glsl_s)}, ['t'] = {syntax_keywords_glsl_t, arr_count(syntax_keywords_glsl_t)}, ['u'] = {syntax_keywords_glsl_u, arr_count(syntax_keywords_glsl_u)}, ['v'] = {syntax_keywords_glsl_v, arr_count(syntax_keywords_glsl_v)}, ['w'] = {syntax_keywords_glsl_w, arr_count(syntax_keywords_glsl_w)}
+static const Keyword syntax_keywords_glsl[358] = {{"unpackSnorm2x16", 15, SYNTAX_BUILTIN},{"vec3", 4, SYNTAX_KEYWORD},{"samplerCubeShadow", 17, SYNTAX_KEYWORD},{"dmat3", 5, SYNTAX_KEYWORD},{"sampler2DArray", 14, SYNTAX_KEYWORD},{"sampler3D", 9, SYNTAX_KEYWORD},{"atan", 4, SYNTAX_BUILTIN},{"sampler1DArrayShadow", 20, SYNTAX_KEYWORD},{"bitfieldExtract", 15, SYNTAX_BUILTIN},{"dmat2x3", 7, SYNTAX_KEYWORD},{"usampler2D", 10, SYNTAX_KEYWORD},{"fwidthCoarse", 12, SYNTAX_BUILTIN},{"uimageBuffer", 12, SYNTAX_KEYWORD},{"dvec2", 5, SYNTAX_KEYWORD},{"sampler1DShadow", 15, SYNTAX_KEYWORD},{"inverse", 7, SYNTAX_BUILTIN},{"round", 5, SYNTAX_BUILTIN},{"textureLod", 10, SYNTAX_BUILTIN},{"flat", 4, SYNTAX_KEYWORD},{"uimage2DRect", 12, SYNTAX_KEYWORD},{"min", 3, SYNTAX_BUILTIN},{"imageCube", 9, SYNTAX_KEYWORD},{"dmat4x4", 7, SYNTAX_KEYWORD},{"isampler2DMSArray", 17, SYNTAX_KEYWORD},{"bvec3", 5, SYNTAX_KEYWORD},{"samplerBuffer", 13, SYNTAX_KEYWORD},{"attribute", 9, SYNTAX_KEYWORD},{"sampler2DShadow", 15, SYNTAX_KEYWORD},{"samplerCubeArrayShadow", 22, SYNTAX_KEYWORD},{"vec2", 4, SYNTAX_KEYWORD},{"isampler2D", 10, SYNTAX_KEYWORD},{"textureGather", 13, SYNTAX_BUILTIN},{"mat2x3", 6, SYNTAX_KEYWORD},{"exp2", 4, SYNTAX_BUILTIN},{"out", 3, SYNTAX_KEYWORD},{"bvec2", 5, SYNTAX_KEYWORD},{"imageAtomicOr", 13, SYNTAX_BUILTIN},{"iimage2D", 8, SYNTAX_KEYWORD},{"lowp", 4, SYNTAX_KEYWORD},{"discard", 7, SYNTAX_KEYWORD},{"acos", 4, SYNTAX_BUILTIN},{"uniform", 7, SYNTAX_KEYWORD},{"gl_FragDepth", 12, SYNTAX_BUILTIN},{"uimage3D", 8, SYNTAX_KEYWORD},{"imageLoad", 9, SYNTAX_BUILTIN},{"false", 5, SYNTAX_KEYWORD},{"dmat3x2", 7, SYNTAX_KEYWORD},{"textureProjGradOffset", 21, SYNTAX_BUILTIN},{"transpose", 9, SYNTAX_BUILTIN},{"usampler2DRect", 14, SYNTAX_KEYWORD},{"fwidthFine", 10, SYNTAX_BUILTIN},{"mod", 3, SYNTAX_BUILTIN},{"clamp", 5, SYNTAX_BUILTIN},{"gl_TessCoord", 12, SYNTAX_BUILTIN},{"noise", 5, SYNTAX_BUILTIN},{"varying", 7, SYNTAX_KEYWORD},{"imageAtomicCompSwap", 19, SYNTAX_BUILTIN},{"floatBitsToInt", 14, SYNTAX_BUILTIN},{"image1D", 7, SYNTAX_KEYWORD},{"case", 4, SYNTAX_KEYWORD},{"usamplerCubeArray", 17, SYNTAX_KEYWORD},{"cos", 3, SYNTAX_BUILTIN},{"void", 4, SYNTAX_KEYWORD},{"imageAtomicExchange", 19, SYNTAX_BUILTIN},{"unpackDouble2x32", 16, SYNTAX_BUILTIN},{"gl_Position", 11, SYNTAX_BUILTIN},{"usamplerBuffer", 14, SYNTAX_KEYWORD},{"equal", 5, SYNTAX_BUILTIN},{"inout", 5, SYNTAX_KEYWORD},{"default", 7, SYNTAX_KEYWORD},{"asinh", 5, SYNTAX_BUILTIN},{"gl_FrontFacing", 14, SYNTAX_BUILTIN},{"gl_VertexID", 11, SYNTAX_BUILTIN},{"image2DMS", 9, SYNTAX_KEYWORD},{"usampler2DMSArray", 17, SYNTAX_KEYWORD},{"restrict", 8, SYNTAX_KEYWORD},{"textureSamples", 14, SYNTAX_BUILTIN},{"imageCubeArray", 14, SYNTAX_KEYWORD},{"isinf", 5, SYNTAX_BUILTIN},{"noperspective", 13, SYNTAX_KEYWORD},{"mat2x2", 6, SYNTAX_KEYWORD},{"dFdxCoarse", 10, SYNTAX_BUILTIN},{"textureGrad", 11, SYNTAX_BUILTIN},{"length", 6, SYNTAX_BUILTIN},{"textureQueryLevels", 18, SYNTAX_BUILTIN},{"EndPrimitive", 12, SYNTAX_BUILTIN},{"cross", 5, SYNTAX_BUILTIN},{"while", 5, SYNTAX_KEYWORD},{"precision", 9, SYNTAX_KEYWORD},{"ceil", 4, SYNTAX_BUILTIN},{"textureQueryLod", 15, SYNTAX_BUILTIN},{"volatile", 8, SYNTAX_KEYWORD},{"intBitsToFloat", 14, SYNTAX_BUILTIN},{"uimageCubeArray", 15, SYNTAX_KEYWORD},{"not", 3, SYNTAX_BUILTIN},{"image2D", 7, SYNTAX_KEYWORD},{"texture", 7, SYNTAX_BUILTIN},{"bitfieldReverse", 15, SYNTAX_BUILTIN},{"bool", 4, SYNTAX_KEYWORD},{"ldexp", 5, SYNTAX_BUILTIN},{"mat3", 4, SYNTAX_KEYWORD},{"dmat2", 5, SYNTAX_KEYWORD},{"dmat4x3", 7, SYNTAX_KEYWORD},{"patch", 5, SYNTAX_KEYWORD},{"mat4x2", 6, SYNTAX_KEYWORD},{"unpackUnorm4x8", 14, SYNTAX_BUILTIN},{"mat2", 4, SYNTAX_KEYWORD},{"gl_SampleMask", 13, SYNTAX_BUILTIN},{"usampler1D", 10, SYNTAX_KEYWORD},{"isamplerCube", 12, SYNTAX_KEYWORD},{"gl_PointSize", 12, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"int", 3, SYNTAX_KEYWORD},{"gl_InvocationID", 15, SYNTAX_BUILTIN},{"sampler1DArray", 14, SYNTAX_KEYWORD},{"EmitVertex", 10, SYNTAX_BUILTIN},{"mix", 3, SYNTAX_BUILTIN},{"imageAtomicAdd", 14, SYNTAX_BUILTIN},{"tanh", 4, SYNTAX_BUILTIN},{"sin", 3, SYNTAX_BUILTIN},{"memoryBarrierBuffer", 19, SYNTAX_BUILTIN},{"switch", 6, SYNTAX_KEYWORD},{"image1DArray", 12, SYNTAX_KEYWORD},{"gl_ClipDistance", 15, SYNTAX_BUILTIN},{"gl_TessLevelInner", 17, SYNTAX_BUILTIN},{"iimageCubeArray", 15, SYNTAX_KEYWORD},{"acosh", 5, SYNTAX_BUILTIN},{"memoryBarrierAtomicCounter", 26, SYNTAX_BUILTIN},{"sampler1D", 9, SYNTAX_KEYWORD},{"usampler1DArray", 15, SYNTAX_KEYWORD},{"textureLodOffset", 16, SYNTAX_BUILTIN},{"ivec2", 5, SYNTAX_KEYWORD},{"else", 4, SYNTAX_KEYWORD},{"usampler3D", 10, SYNTAX_KEYWORD},{"interpolateAtSample", 19, SYNTAX_BUILTIN},{"sampler2DMSArray", 16, SYNTAX_KEYWORD},{"gl_Layer", 8, SYNTAX_BUILTIN},{"coherent", 8, SYNTAX_KEYWORD},{"atomicMax", 9, SYNTAX_BUILTIN},{"mat3x2", 6, SYNTAX_KEYWORD},{"uimage2DMSArray", 15, SYNTAX_KEYWORD},{"ivec4", 5, SYNTAX_KEYWORD},{"iimage2DArray", 13, SYNTAX_KEYWORD},{"dmat2x4", 7, SYNTAX_KEYWORD},{"max", 3, SYNTAX_BUILTIN},{"dvec3", 5, SYNTAX_KEYWORD},{"degrees", 7, SYNTAX_BUILTIN},{"isampler1D", 10, SYNTAX_KEYWORD},{"sampler2DArrayShadow", 20, SYNTAX_KEYWORD},{"memoryBarrierShared", 19, SYNTAX_BUILTIN},{"any", 3, SYNTAX_BUILTIN},{"interpolateAtOffset", 19, SYNTAX_BUILTIN},{"uimage2DMS", 10, SYNTAX_KEYWORD},{"usampler2DMS", 12, SYNTAX_KEYWORD},{"centroid", 8, SYNTAX_KEYWORD},{"iimage3D", 8, SYNTAX_KEYWORD},{"distance", 8, SYNTAX_BUILTIN},{"gl_SampleMaskIn", 15, SYNTAX_BUILTIN},{"usubBorrow", 10, SYNTAX_BUILTIN},{"dot", 3, SYNTAX_BUILTIN},{"isnan", 5, SYNTAX_BUILTIN},{"do", 2, SYNTAX_KEYWORD},{"writeonly", 9, SYNTAX_KEYWORD},{"cosh", 4, SYNTAX_BUILTIN},{"image2DRect", 11, SYNTAX_KEYWORD},{"mat4x4", 6, SYNTAX_KEYWORD},{"dFdy", 4, SYNTAX_BUILTIN},{"findMSB", 7, SYNTAX_BUILTIN},{"uimage2DArray", 13, SYNTAX_KEYWORD},{"uimage1DArray", 13, SYNTAX_KEYWORD},{"textureProj", 11, SYNTAX_BUILTIN},{"greaterThan", 11, SYNTAX_BUILTIN},{"mat2x4", 6, SYNTAX_KEYWORD},{"unpackSnorm4x8", 14, SYNTAX_BUILTIN},{"atomicXor", 9, SYNTAX_BUILTIN},{"struct", 6, SYNTAX_KEYWORD},{"interpolateAtCentroid", 21, SYNTAX_BUILTIN},{"sampler2DRectShadow", 19, SYNTAX_KEYWORD},{"isampler3D", 10, SYNTAX_KEYWORD},{"uint", 4, SYNTAX_KEYWORD},{"samplerCubeArray", 16, SYNTAX_KEYWORD},{"sqrt", 4, SYNTAX_BUILTIN},{"usampler2DArray", 15, SYNTAX_KEYWORD},{"asin", 4, SYNTAX_BUILTIN},{"gl_HelperInvocation", 19, SYNTAX_BUILTIN},{"imageBuffer", 11, SYNTAX_KEYWORD},{"subroutine", 10, SYNTAX_KEYWORD},{"dmat4x2", 7, SYNTAX_KEYWORD},{"textureSize", 11, SYNTAX_BUILTIN},{"iimage1D", 8, SYNTAX_KEYWORD},{"bitCount", 8, SYNTAX_BUILTIN},{"samplerCube", 11, SYNTAX_KEYWORD},{"uvec4", 5, SYNTAX_KEYWORD},{"mat4x3", 6, SYNTAX_KEYWORD},{"sinh", 4, SYNTAX_BUILTIN},{"uvec3", 5, SYNTAX_KEYWORD},{"atomicCompSwap", 14, SYNTAX_BUILTIN},{"textureGatherOffset", 19, SYNTAX_BUILTIN},{"isamplerCubeArray", 17, SYNTAX_KEYWORD},{"mat4", 4, SYNTAX_KEYWORD},{"shared", 6, SYNTAX_KEYWORD},{"gl_GlobalInvocationID", 21, SYNTAX_BUILTIN},{"if", 2, SYNTAX_KEYWORD},{"imageSamples", 12, SYNTAX_BUILTIN},{"gl_PrimitiveIDIn", 16, SYNTAX_BUILTIN},{"atomicOr", 8, SYNTAX_BUILTIN},{"iimage1DArray", 13, SYNTAX_KEYWORD},{"imageAtomicMax", 14, SYNTAX_BUILTIN},{"packSnorm4x8", 12, SYNTAX_BUILTIN},{"imageAtomicXor", 14, SYNTAX_BUILTIN},{"gl_SampleID", 11, SYNTAX_BUILTIN},{"atomicAdd", 9, SYNTAX_BUILTIN},{"memoryBarrier", 13, SYNTAX_BUILTIN},{"invariant", 9, SYNTAX_KEYWORD},{"true", 4, SYNTAX_KEYWORD},{"smooth", 6, SYNTAX_KEYWORD},{"fma", 3, SYNTAX_BUILTIN},{"pow", 3, SYNTAX_BUILTIN},{"gl_CullDistance", 15, SYNTAX_BUILTIN},{"gl_TessLevelOuter", 17, SYNTAX_BUILTIN},{"sampler2D", 9, SYNTAX_KEYWORD},{"mat3x4", 6, SYNTAX_KEYWORD},{"uimage2D", 8, SYNTAX_KEYWORD},{"log", 3, SYNTAX_BUILTIN},{"noise1", 6, SYNTAX_BUILTIN},{"double", 6, SYNTAX_KEYWORD},{"atanh", 5, SYNTAX_BUILTIN},{"bitfieldInsert", 14, SYNTAX_BUILTIN},{"fwidth", 6, SYNTAX_BUILTIN},{"gl_FragCoord", 12, SYNTAX_BUILTIN},{"layout", 6, SYNTAX_KEYWORD},{"iimageBuffer", 12, SYNTAX_KEYWORD},{"notEqual", 8, SYNTAX_BUILTIN},{"ivec3", 5, SYNTAX_KEYWORD},{"image3D", 7, SYNTAX_KEYWORD},{"textureGradOffset", 17, SYNTAX_BUILTIN},{"atomicCounter", 13, SYNTAX_BUILTIN},{"gl_PrimitiveID", 14, SYNTAX_BUILTIN},{"gl_SamplePosition", 17, SYNTAX_BUILTIN},{"gl_WorkGroupID", 14, SYNTAX_BUILTIN},{"uimageCube", 10, SYNTAX_KEYWORD},{"isampler2DMS", 12, SYNTAX_KEYWORD},{"highp", 5, SYNTAX_KEYWORD},{"tan", 3, SYNTAX_BUILTIN},{"textureProjLodOffset", 20, SYNTAX_BUILTIN},{"lessThan", 8, SYNTAX_BUILTIN},{"sampler2DMS", 11, SYNTAX_KEYWORD},{"iimageCube", 10, SYNTAX_KEYWORD},{"log2", 4, SYNTAX_BUILTIN},{"dFdyFine", 8, SYNTAX_BUILTIN},{"floatBitsToUint", 15, SYNTAX_BUILTIN},{"uaddCarry", 9, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"lessThanEqual", 13, SYNTAX_BUILTIN},{"isamplerBuffer", 14, SYNTAX_KEYWORD},{"EmitStreamVertex", 16, SYNTAX_BUILTIN},{"fract", 5, SYNTAX_BUILTIN},{"outerProduct", 12, SYNTAX_BUILTIN},{"textureProjOffset", 17, SYNTAX_BUILTIN},{"abs", 3, SYNTAX_BUILTIN},{"imageStore", 10, SYNTAX_BUILTIN},{"groupMemoryBarrier", 18, SYNTAX_BUILTIN},{"sample", 6, SYNTAX_KEYWORD},{"memoryBarrierImage", 18, SYNTAX_BUILTIN},{"imulExtended", 12, SYNTAX_BUILTIN},{"step", 4, SYNTAX_BUILTIN},{"findLSB", 7, SYNTAX_BUILTIN},{"noise4", 6, SYNTAX_BUILTIN},{"image2DArray", 12, SYNTAX_KEYWORD},{"iimage2DMS", 10, SYNTAX_KEYWORD},{"atomicCounterIncrement", 22, SYNTAX_BUILTIN},{"packHalf2x16", 12, SYNTAX_BUILTIN},{"umulExtended", 12, SYNTAX_BUILTIN},{"dFdx", 4, SYNTAX_BUILTIN},{"bvec4", 5, SYNTAX_KEYWORD},{"mat3x3", 6, SYNTAX_KEYWORD},{"sign", 4, SYNTAX_BUILTIN},{"dmat4", 5, SYNTAX_KEYWORD},{"imageAtomicAnd", 14, SYNTAX_BUILTIN},{"iimage2DRect", 12, SYNTAX_KEYWORD},{"precise", 7, SYNTAX_KEYWORD},{"sampler2DRect", 13, SYNTAX_KEYWORD},{"gl_LocalInvocationIndex", 23, SYNTAX_BUILTIN},{"packDouble2x32", 14, SYNTAX_BUILTIN},{"image2DMSArray", 14, SYNTAX_KEYWORD},{"roundEven", 9, SYNTAX_BUILTIN},{"float", 5, SYNTAX_KEYWORD},{"dmat2x2", 7, SYNTAX_KEYWORD},{"imageSize", 9, SYNTAX_BUILTIN},{"dmat3x3", 7, SYNTAX_KEYWORD},{"unpackHalf2x16", 14, SYNTAX_BUILTIN},{"gl_WorkGroupSize", 16, SYNTAX_BUILTIN},{"atomic_uint", 11, SYNTAX_KEYWORD},{"usamplerCube", 12, SYNTAX_KEYWORD},{"uimage1D", 8, SYNTAX_KEYWORD},{"isampler2DRect", 14, SYNTAX_KEYWORD},{"return", 6, SYNTAX_KEYWORD},{"determinant", 11, SYNTAX_BUILTIN},{"gl_PatchVerticesIn", 18, SYNTAX_BUILTIN},{"uvec2", 5, SYNTAX_KEYWORD},{"inversesqrt", 11, SYNTAX_BUILTIN},{"reflect", 7, SYNTAX_BUILTIN},{"matrixCompMult", 14, SYNTAX_BUILTIN},{"isampler1DArray", 15, SYNTAX_KEYWORD},{"exp", 3, SYNTAX_BUILTIN},{"refract", 7, SYNTAX_BUILTIN},{"textureProjGrad", 15, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"dFdxFine", 8, SYNTAX_BUILTIN},{"gl_NumSamples", 13, SYNTAX_BUILTIN},{"iimage2DMSArray", 15, SYNTAX_KEYWORD},{"EndStreamPrimitive", 18, SYNTAX_BUILTIN},{"normalize", 9, SYNTAX_BUILTIN},{"const", 5, SYNTAX_KEYWORD},{"textureOffset", 13, SYNTAX_BUILTIN},{"atomicAnd", 9, SYNTAX_BUILTIN},{"trunc", 5, SYNTAX_BUILTIN},{"mediump", 7, SYNTAX_KEYWORD},{"unpackUnorm", 11, SYNTAX_BUILTIN},{"greaterThanEqual", 16, SYNTAX_BUILTIN},{"texelFetch", 10, SYNTAX_BUILTIN},{"smoothstep", 10, SYNTAX_BUILTIN},{"gl_PointCoord", 13, SYNTAX_BUILTIN},{"packUnorm4x8", 12, SYNTAX_BUILTIN},{"noise2", 6, SYNTAX_BUILTIN},{"textureProjLod", 14, SYNTAX_BUILTIN},{"radians", 7, SYNTAX_BUILTIN},{"atomicCounterDecrement", 22, SYNTAX_BUILTIN},{"dFdyCoarse", 10, SYNTAX_BUILTIN},{"floor", 5, SYNTAX_BUILTIN},{"texelFetchOffset", 16, SYNTAX_BUILTIN},{"atomicExchange", 14, SYNTAX_BUILTIN},{"gl_ViewportIndex", 16, SYNTAX_BUILTIN},{"noise3", 6, SYNTAX_BUILTIN},{"packUnorm2x16", 13, SYNTAX_BUILTIN},{"barrier", 7, SYNTAX_BUILTIN},{"packUnorm", 9, SYNTAX_BUILTIN},{"packSnorm2x16", 13, SYNTAX_BUILTIN},{"imageAtomicMin", 14, SYNTAX_BUILTIN},{"all", 3, SYNTAX_BUILTIN},{"faceforward", 11, SYNTAX_BUILTIN},{"textureGatherOffsets", 20, SYNTAX_BUILTIN},{"for", 3, SYNTAX_KEYWORD},{"vec4", 4, SYNTAX_KEYWORD},{"gl_LocalInvocationID", 20, SYNTAX_BUILTIN},{"buffer", 6, SYNTAX_KEYWORD},{"gl_NumWorkGroups", 16, SYNTAX_BUILTIN},{"gl_InstanceID", 13, SYNTAX_BUILTIN},{"atomicMin", 9, SYNTAX_BUILTIN},{"modf", 4, SYNTAX_BUILTIN},{"frexp", 5, SYNTAX_BUILTIN},{"removedTypes", 12, SYNTAX_BUILTIN},{"uintBitsToFloat", 15, SYNTAX_BUILTIN},{"readonly", 8, SYNTAX_KEYWORD},{"dmat3x4", 7, SYNTAX_KEYWORD},{"dvec4", 5, SYNTAX_KEYWORD},{"unpackUnorm2x16", 15, SYNTAX_BUILTIN},{"isampler2DArray", 15, SYNTAX_KEYWORD}};
+static const u16 syntax_keyword_displacements_glsl[120] = {7,4,3,2,59,7,2,11,2,16,22,18,0,0,23,0,5,0,43,3,22,3,0,27,12,0,43,9,1,19,23,2,8,0,1,4,4,32,4,1,9,36,6,4,20,28,1,9,64,5,6,8,6,6,21,0,0,10,13,0,135,19,11,21,84,1,2,9,50,6,3,157,0,142,9,4,89,0,65,3,1,2,188,12,162,0,199,1,41,79,0,0,111,34,101,115,1,9,45,109,105,16,1,888,483,0,4,1,56,3,69,181,246,359,31,633,3,909,84,49};
+static const KeywordTable syntax_all_keywords_glsl = {
+	syntax_keywords_glsl, syntax_keyword_displacements_glsl, 358, 120, 8,
+	{7, 0, -3, -2, -7, -9, -8, 3},
+	{0xc3c91347u, 0xfd561dd5u, 0x3d59b443u, 0x35039651u, 0x6429b299u, 0xbe261063u, 0x4facb27bu, 0xe3fd2e31u}
 };
 
-static const Keyword syntax_keywords_css_x21[1] = {{"!important", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_x2d[1] = {{"-webkit-line-clamp:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_x40[25] = {{"@annotation", SYNTAX_KEYWORD},{"@bottom-center", SYNTAX_KEYWORD},{"@character-variant", SYNTAX_KEYWORD},{"@charset", SYNTAX_KEYWORD},{"@counter-style", SYNTAX_KEYWORD},{"@font-face", SYNTAX_KEYWORD},{"@font-feature-values", SYNTAX_KEYWORD},{"@historical-forms", SYNTAX_KEYWORD},{"@import", SYNTAX_KEYWORD},{"@keyframes", SYNTAX_KEYWORD},{"@layer", SYNTAX_KEYWORD},{"@left-bottom", SYNTAX_KEYWORD},{"@media", SYNTAX_KEYWORD},{"@namespace", SYNTAX_KEYWORD},{"@ornaments", SYNTAX_KEYWORD},{"@page", SYNTAX_KEYWORD},{"@property", SYNTAX_KEYWORD},{"@right-bottom", SYNTAX_KEYWORD},{"@scroll-timeline", SYNTAX_KEYWORD},{"@styleset", SYNTAX_KEYWORD},{"@stylistic", SYNTAX_KEYWORD},{"@supports", SYNTAX_KEYWORD},{"@swash", SYNTAX_KEYWORD},{"@top-center", SYNTAX_KEYWORD},{"@viewport", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_css_a[65] = {{"a", SYNTAX_KEYWORD},{"abbr", SYNTAX_KEYWORD},{"above", SYNTAX_CONSTANT},{"abs", SYNTAX_BUILTIN},{"absolute", SYNTAX_CONSTANT},{"accent-color:", SYNTAX_BUILTIN},{"acos", SYNTAX_BUILTIN},{"acronym", SYNTAX_KEYWORD},{"active", SYNTAX_CONSTANT},{"add", SYNTAX_CONSTANT},{"additive", SYNTAX_CONSTANT},{"additive-symbols:", SYNTAX_BUILTIN},{"address", SYNTAX_KEYWORD},{"after-edge", SYNTAX_CONSTANT},{"alias", SYNTAX_CONSTANT},{"aliceblue", SYNTAX_CONSTANT},{"align-content:", SYNTAX_BUILTIN},{"align-items:", SYNTAX_BUILTIN},{"align-self:", SYNTAX_BUILTIN},{"align-tracks:", SYNTAX_BUILTIN},{"all-petite-caps", SYNTAX_CONSTANT},{"all-scroll", SYNTAX_CONSTANT},{"all-small-caps", SYNTAX_CONSTANT},{"all:", SYNTAX_BUILTIN},{"alpha", SYNTAX_CONSTANT},{"alphabetic", SYNTAX_CONSTANT},{"alternate", SYNTAX_CONSTANT},{"alternate-reverse", SYNTAX_CONSTANT},{"always", SYNTAX_CONSTANT},{"animation-composition:", SYNTAX_BUILTIN},{"animation-delay:", SYNTAX_BUILTIN},{"animation-direction:", SYNTAX_BUILTIN},{"animation-duration:", SYNTAX_BUILTIN},{"animation-fill-mode:", SYNTAX_BUILTIN},{"animation-iteration-count:", SYNTAX_BUILTIN},{"animation-name:", SYNTAX_BUILTIN},{"animation-play-state:", SYNTAX_BUILTIN},{"animation-timeline:", SYNTAX_BUILTIN},{"animation-timing-function:", SYNTAX_BUILTIN},{"animation:", SYNTAX_BUILTIN},{"annotation", SYNTAX_BUILTIN},{"antialiased", SYNTAX_CONSTANT},{"antiquewhite", SYNTAX_CONSTANT},{"appearance:", SYNTAX_BUILTIN},{"applet", SYNTAX_KEYWORD},{"aqua", SYNTAX_CONSTANT},{"aquamarine", SYNTAX_CONSTANT},{"area", SYNTAX_KEYWORD},{"article", SYNTAX_KEYWORD},{"ascent-override:", SYNTAX_BUILTIN},{"aside", SYNTAX_KEYWORD},{"asin", SYNTAX_BUILTIN},{"aspect-ratio:", SYNTAX_BUILTIN},{"atan", SYNTAX_BUILTIN},{"atan2", SYNTAX_BUILTIN},{"attr", SYNTAX_BUILTIN},{"audio", SYNTAX_KEYWORD},{"auto", SYNTAX_CONSTANT},{"auto-pos", SYNTAX_CONSTANT},{"available", SYNTAX_CONSTANT},{"avoid", SYNTAX_CONSTANT},{"avoid-column", SYNTAX_CONSTANT},{"avoid-page", SYNTAX_CONSTANT},{"avoid-region", SYNTAX_CONSTANT},{"azure", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_b[127] = {{"b", SYNTAX_KEYWORD},{"backdrop-filter:", SYNTAX_BUILTIN},{"backface-visibility:", SYNTAX_BUILTIN},{"background-attachment:", SYNTAX_BUILTIN},{"background-blend-mode:", SYNTAX_BUILTIN},{"background-clip:", SYNTAX_BUILTIN},{"background-color:", SYNTAX_BUILTIN},{"background-image:", SYNTAX_BUILTIN},{"background-origin:", SYNTAX_BUILTIN},{"background-position-x:", SYNTAX_BUILTIN},{"background-position-y:", SYNTAX_BUILTIN},{"background-position:", SYNTAX_BUILTIN},{"background-repeat:", SYNTAX_BUILTIN},{"background-size:", SYNTAX_BUILTIN},{"background:", SYNTAX_BUILTIN},{"backwards", SYNTAX_CONSTANT},{"balance", SYNTAX_CONSTANT},{"base", SYNTAX_KEYWORD},{"baseline", SYNTAX_CONSTANT},{"bdi", SYNTAX_KEYWORD},{"bdo", SYNTAX_KEYWORD},{"before-edge", SYNTAX_CONSTANT},{"beige", SYNTAX_CONSTANT},{"below", SYNTAX_CONSTANT},{"bevel", SYNTAX_CONSTANT},{"bgsound", SYNTAX_KEYWORD},{"bidi-override", SYNTAX_CONSTANT},{"big", SYNTAX_KEYWORD},{"bisque", SYNTAX_CONSTANT},{"black", SYNTAX_CONSTANT},{"blanchedalmond", SYNTAX_CONSTANT},{"bleed:", SYNTAX_BUILTIN},{"blink", SYNTAX_KEYWORD},{"block", SYNTAX_CONSTANT},{"block-axis", SYNTAX_CONSTANT},{"block-end", SYNTAX_CONSTANT},{"block-overflow:", SYNTAX_BUILTIN},{"block-size:", SYNTAX_BUILTIN},{"block-start", SYNTAX_CONSTANT},{"blockquote", SYNTAX_KEYWORD},{"blue", SYNTAX_CONSTANT},{"blueviolet", SYNTAX_CONSTANT},{"blur", SYNTAX_BUILTIN},{"body", SYNTAX_KEYWORD},{"bold", SYNTAX_CONSTANT},{"bolder", SYNTAX_CONSTANT},{"border-block-color:", SYNTAX_BUILTIN},{"border-block-end-color:", SYNTAX_BUILTIN},{"border-block-end-style:", SYNTAX_BUILTIN},{"border-block-end-width:", SYNTAX_BUILTIN},{"border-block-end:", SYNTAX_BUILTIN},{"border-block-start-color:", SYNTAX_BUILTIN},{"border-block-start-style:", SYNTAX_BUILTIN},{"border-block-start-width:", SYNTAX_BUILTIN},{"border-block-start:", SYNTAX_BUILTIN},{"border-block-style:", SYNTAX_BUILTIN},{"border-block-width:", SYNTAX_BUILTIN},{"border-block:", SYNTAX_BUILTIN},{"border-bottom-color:", SYNTAX_BUILTIN},{"border-bottom-left-radius:", SYNTAX_BUILTIN},{"border-bottom-right-radius:", SYNTAX_BUILTIN},{"border-bottom-style:", SYNTAX_BUILTIN},{"border-bottom-width:", SYNTAX_BUILTIN},{"border-bottom:", SYNTAX_BUILTIN},{"border-box", SYNTAX_CONSTANT},{"border-collapse:", SYNTAX_BUILTIN},{"border-color:", SYNTAX_BUILTIN},{"border-end-end-radius:", SYNTAX_BUILTIN},{"border-end-start-radius:", SYNTAX_BUILTIN},{"border-image-outset:", SYNTAX_BUILTIN},{"border-image-repeat:", SYNTAX_BUILTIN},{"border-image-slice:", SYNTAX_BUILTIN},{"border-image-source:", SYNTAX_BUILTIN},{"border-image-width:", SYNTAX_BUILTIN},{"border-image:", SYNTAX_BUILTIN},{"border-inline-color:", SYNTAX_BUILTIN},{"border-inline-end-color:", SYNTAX_BUILTIN},{"border-inline-end-style:", SYNTAX_BUILTIN},{"border-inline-end-width:", SYNTAX_BUILTIN},{"border-inline-end:", SYNTAX_BUILTIN},{"border-inline-start-color:", SYNTAX_BUILTIN},{"border-inline-start-style:", SYNTAX_BUILTIN},{"border-inline-start-width:", SYNTAX_BUILTIN},{"border-inline-start:", SYNTAX_BUILTIN},{"border-inline-style:", SYNTAX_BUILTIN},{"border-inline-width:", SYNTAX_BUILTIN},{"border-inline:", SYNTAX_BUILTIN},{"border-left-color:", SYNTAX_BUILTIN},{"border-left-style:", SYNTAX_BUILTIN},{"border-left-width:", SYNTAX_BUILTIN},{"border-left:", SYNTAX_BUILTIN},{"border-radius:", SYNTAX_BUILTIN},{"border-right-color:", SYNTAX_BUILTIN},{"border-right-style:", SYNTAX_BUILTIN},{"border-right-width:", SYNTAX_BUILTIN},{"border-right:", SYNTAX_BUILTIN},{"border-spacing:", SYNTAX_BUILTIN},{"border-start-end-radius:", SYNTAX_BUILTIN},{"border-start-start-radius:", SYNTAX_BUILTIN},{"border-style:", SYNTAX_BUILTIN},{"border-top-color:", SYNTAX_BUILTIN},{"border-top-left-radius:", SYNTAX_BUILTIN},{"border-top-right-radius:", SYNTAX_BUILTIN},{"border-top-style:", SYNTAX_BUILTIN},{"border-top-width:", SYNTAX_BUILTIN},{"border-top:", SYNTAX_BUILTIN},{"border-width:", SYNTAX_BUILTIN},{"border:", SYNTAX_BUILTIN},{"both", SYNTAX_CONSTANT},{"bottom", SYNTAX_CONSTANT},{"bottom-outside", SYNTAX_CONSTANT},{"bottom:", SYNTAX_BUILTIN},{"box-decoration-break:", SYNTAX_BUILTIN},{"box-shadow:", SYNTAX_BUILTIN},{"box-sizing:", SYNTAX_BUILTIN},{"br", SYNTAX_KEYWORD},{"break-after:", SYNTAX_BUILTIN},{"break-all", SYNTAX_CONSTANT},{"break-before:", SYNTAX_BUILTIN},{"break-inside:", SYNTAX_BUILTIN},{"break-word", SYNTAX_CONSTANT},{"brightness", SYNTAX_BUILTIN},{"brown", SYNTAX_CONSTANT},{"bullets", SYNTAX_CONSTANT},{"burlywood", SYNTAX_CONSTANT},{"butt", SYNTAX_CONSTANT},{"button", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_css_c[84] = {{"cadetblue", SYNTAX_CONSTANT},{"calc", SYNTAX_BUILTIN},{"canvas", SYNTAX_KEYWORD},{"capitalize", SYNTAX_CONSTANT},{"caption", SYNTAX_KEYWORD},{"caption-side:", SYNTAX_BUILTIN},{"caret-color:", SYNTAX_BUILTIN},{"caret-shape:", SYNTAX_BUILTIN},{"caret:", SYNTAX_BUILTIN},{"cell", SYNTAX_CONSTANT},{"center", SYNTAX_CONSTANT},{"central", SYNTAX_CONSTANT},{"char", SYNTAX_CONSTANT},{"character-variant", SYNTAX_BUILTIN},{"chartreuse", SYNTAX_CONSTANT},{"chocolate", SYNTAX_CONSTANT},{"circle", SYNTAX_BUILTIN},{"cite", SYNTAX_KEYWORD},{"clamp", SYNTAX_BUILTIN},{"clear:", SYNTAX_BUILTIN},{"clip-path:", SYNTAX_BUILTIN},{"clip:", SYNTAX_BUILTIN},{"clone", SYNTAX_CONSTANT},{"close-quote", SYNTAX_CONSTANT},{"closest-corner", SYNTAX_CONSTANT},{"closest-side", SYNTAX_CONSTANT},{"code", SYNTAX_KEYWORD},{"col", SYNTAX_KEYWORD},{"col-resize", SYNTAX_CONSTANT},{"colgroup", SYNTAX_KEYWORD},{"collapse", SYNTAX_CONSTANT},{"color-burn", SYNTAX_CONSTANT},{"color-dodge", SYNTAX_CONSTANT},{"color-scheme:", SYNTAX_BUILTIN},{"color:", SYNTAX_BUILTIN},{"column", SYNTAX_CONSTANT},{"column-count:", SYNTAX_BUILTIN},{"column-fill:", SYNTAX_BUILTIN},{"column-gap:", SYNTAX_BUILTIN},{"column-reverse", SYNTAX_CONSTANT},{"column-rule-color:", SYNTAX_BUILTIN},{"column-rule-style:", SYNTAX_BUILTIN},{"column-rule-width:", SYNTAX_BUILTIN},{"column-rule:", SYNTAX_BUILTIN},{"column-span:", SYNTAX_BUILTIN},{"column-width:", SYNTAX_BUILTIN},{"columns:", SYNTAX_BUILTIN},{"common-ligatures", SYNTAX_CONSTANT},{"compact", SYNTAX_CONSTANT},{"condensed", SYNTAX_CONSTANT},{"conic-gradient", SYNTAX_BUILTIN},{"contain-intrinsic-block-size:", SYNTAX_BUILTIN},{"contain-intrinsic-height:", SYNTAX_BUILTIN},{"contain-intrinsic-inline-size:", SYNTAX_BUILTIN},{"contain-intrinsic-size:", SYNTAX_BUILTIN},{"contain-intrinsic-width:", SYNTAX_BUILTIN},{"contain:", SYNTAX_BUILTIN},{"content", SYNTAX_KEYWORD},{"content-box", SYNTAX_CONSTANT},{"content-visibility:", SYNTAX_BUILTIN},{"content:", SYNTAX_BUILTIN},{"contents", SYNTAX_CONSTANT},{"context-menu", SYNTAX_CONSTANT},{"contextual", SYNTAX_CONSTANT},{"contrast", SYNTAX_BUILTIN},{"copy", SYNTAX_CONSTANT},{"coral", SYNTAX_CONSTANT},{"cornflowerblue", SYNTAX_CONSTANT},{"cornsilk", SYNTAX_CONSTANT},{"cos", SYNTAX_BUILTIN},{"counter-increment:", SYNTAX_BUILTIN},{"counter-reset:", SYNTAX_BUILTIN},{"counter-set:", SYNTAX_BUILTIN},{"counters", SYNTAX_BUILTIN},{"cover", SYNTAX_CONSTANT},{"crimson", SYNTAX_CONSTANT},{"crisp-edges", SYNTAX_CONSTANT},{"crispEdges", SYNTAX_CONSTANT},{"cross-fade", SYNTAX_BUILTIN},{"crosshair", SYNTAX_CONSTANT},{"cubic-bezier", SYNTAX_BUILTIN},{"cursor:", SYNTAX_BUILTIN},{"cyan", SYNTAX_CONSTANT},{"cyclic", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_d[61] = {{"dark", SYNTAX_CONSTANT},{"darkblue", SYNTAX_CONSTANT},{"darkcyan", SYNTAX_CONSTANT},{"darken", SYNTAX_CONSTANT},{"darkgoldenrod", SYNTAX_CONSTANT},{"darkgray", SYNTAX_CONSTANT},{"darkgreen", SYNTAX_CONSTANT},{"darkgrey", SYNTAX_CONSTANT},{"darkkhaki", SYNTAX_CONSTANT},{"darkmagenta", SYNTAX_CONSTANT},{"darkolivegreen", SYNTAX_CONSTANT},{"darkorange", SYNTAX_CONSTANT},{"darkorchid", SYNTAX_CONSTANT},{"darkred", SYNTAX_CONSTANT},{"darksalmon", SYNTAX_CONSTANT},{"darkseagreen", SYNTAX_CONSTANT},{"darkslateblue", SYNTAX_CONSTANT},{"darkslategray", SYNTAX_CONSTANT},{"darkslategrey", SYNTAX_CONSTANT},{"darkturquoise", SYNTAX_CONSTANT},{"darkviolet", SYNTAX_CONSTANT},{"dashed", SYNTAX_CONSTANT},{"data", SYNTAX_KEYWORD},{"datalist", SYNTAX_KEYWORD},{"dd", SYNTAX_KEYWORD},{"decimal", SYNTAX_CONSTANT},{"deeppink", SYNTAX_CONSTANT},{"deepskyblue", SYNTAX_CONSTANT},{"default", SYNTAX_CONSTANT},{"del", SYNTAX_KEYWORD},{"dense", SYNTAX_CONSTANT},{"descent-override:", SYNTAX_BUILTIN},{"details", SYNTAX_KEYWORD},{"dfn", SYNTAX_KEYWORD},{"diagonal-fractions", SYNTAX_CONSTANT},{"dialog", SYNTAX_KEYWORD},{"difference", SYNTAX_CONSTANT},{"digits", SYNTAX_CONSTANT},{"dimgray", SYNTAX_CONSTANT},{"dimgrey", SYNTAX_CONSTANT},{"dir", SYNTAX_KEYWORD},{"direction:", SYNTAX_BUILTIN},{"disabled", SYNTAX_CONSTANT},{"disc", SYNTAX_CONSTANT},{"discretionary-ligatures", SYNTAX_CONSTANT},{"display:", SYNTAX_BUILTIN},{"distribute", SYNTAX_CONSTANT},{"distribute-all-lines", SYNTAX_CONSTANT},{"distribute-letter", SYNTAX_CONSTANT},{"distribute-space", SYNTAX_CONSTANT},{"div", SYNTAX_KEYWORD},{"dl", SYNTAX_KEYWORD},{"dodgerblue", SYNTAX_CONSTANT},{"dot", SYNTAX_CONSTANT},{"dotted", SYNTAX_CONSTANT},{"double", SYNTAX_CONSTANT},{"double-circle", SYNTAX_CONSTANT},{"downleft", SYNTAX_CONSTANT},{"downright", SYNTAX_CONSTANT},{"drop-shadow", SYNTAX_BUILTIN},{"dt", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_css_e[25] = {{"e-resize", SYNTAX_CONSTANT},{"each-line", SYNTAX_CONSTANT},{"ease", SYNTAX_CONSTANT},{"ease-in", SYNTAX_CONSTANT},{"ease-in-out", SYNTAX_CONSTANT},{"ease-out", SYNTAX_CONSTANT},{"economy", SYNTAX_CONSTANT},{"element", SYNTAX_BUILTIN},{"ellipse", SYNTAX_BUILTIN},{"ellipsis", SYNTAX_CONSTANT},{"em", SYNTAX_KEYWORD},{"embed", SYNTAX_KEYWORD},{"empty-cells:", SYNTAX_BUILTIN},{"end", SYNTAX_CONSTANT},{"env", SYNTAX_BUILTIN},{"evenodd", SYNTAX_CONSTANT},{"ew-resize", SYNTAX_CONSTANT},{"exact", SYNTAX_CONSTANT},{"exclude", SYNTAX_CONSTANT},{"exclusion", SYNTAX_CONSTANT},{"exp", SYNTAX_BUILTIN},{"expanded", SYNTAX_CONSTANT},{"extends", SYNTAX_CONSTANT},{"extra-condensed", SYNTAX_CONSTANT},{"extra-expanded", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_f[60] = {{"fallback:", SYNTAX_BUILTIN},{"farthest-corner", SYNTAX_CONSTANT},{"farthest-side", SYNTAX_CONSTANT},{"fieldset", SYNTAX_KEYWORD},{"figcaption", SYNTAX_KEYWORD},{"figure", SYNTAX_KEYWORD},{"fill", SYNTAX_CONSTANT},{"fill-available", SYNTAX_CONSTANT},{"fill-box", SYNTAX_CONSTANT},{"filled", SYNTAX_CONSTANT},{"filter:", SYNTAX_BUILTIN},{"firebrick", SYNTAX_CONSTANT},{"fit-content", SYNTAX_CONSTANT},{"fixed", SYNTAX_CONSTANT},{"flat", SYNTAX_CONSTANT},{"flex-basis:", SYNTAX_BUILTIN},{"flex-direction:", SYNTAX_BUILTIN},{"flex-flow:", SYNTAX_BUILTIN},{"flex-grow:", SYNTAX_BUILTIN},{"flex-shrink:", SYNTAX_BUILTIN},{"flex-wrap:", SYNTAX_BUILTIN},{"flex:", SYNTAX_BUILTIN},{"flip", SYNTAX_CONSTANT},{"float:", SYNTAX_BUILTIN},{"floralwhite", SYNTAX_CONSTANT},{"flow-root", SYNTAX_CONSTANT},{"font", SYNTAX_KEYWORD},{"font-display:", SYNTAX_BUILTIN},{"font-family:", SYNTAX_BUILTIN},{"font-feature-settings:", SYNTAX_BUILTIN},{"font-kerning:", SYNTAX_BUILTIN},{"font-language-override:", SYNTAX_BUILTIN},{"font-optical-sizing:", SYNTAX_BUILTIN},{"font-size-adjust:", SYNTAX_BUILTIN},{"font-size:", SYNTAX_BUILTIN},{"font-stretch:", SYNTAX_BUILTIN},{"font-style:", SYNTAX_BUILTIN},{"font-synthesis:", SYNTAX_BUILTIN},{"font-variant-alternates:", SYNTAX_BUILTIN},{"font-variant-caps:", SYNTAX_BUILTIN},{"font-variant-east-asian:", SYNTAX_BUILTIN},{"font-variant-ligatures:", SYNTAX_BUILTIN},{"font-variant-numeric:", SYNTAX_BUILTIN},{"font-variant-position:", SYNTAX_BUILTIN},{"font-variant:", SYNTAX_BUILTIN},{"font-variation-settings:", SYNTAX_BUILTIN},{"font-weight:", SYNTAX_BUILTIN},{"font:", SYNTAX_BUILTIN},{"footer", SYNTAX_KEYWORD},{"forced-color-adjust:", SYNTAX_BUILTIN},{"forestgreen", SYNTAX_CONSTANT},{"form", SYNTAX_KEYWORD},{"format", SYNTAX_BUILTIN},{"forwards", SYNTAX_CONSTANT},{"frame", SYNTAX_KEYWORD},{"frameset", SYNTAX_KEYWORD},{"freeze", SYNTAX_CONSTANT},{"from-image", SYNTAX_CONSTANT},{"fuchsia", SYNTAX_CONSTANT},{"full-width", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_g[30] = {{"gainsboro", SYNTAX_CONSTANT},{"gap:", SYNTAX_BUILTIN},{"geometricPrecision", SYNTAX_CONSTANT},{"georgian", SYNTAX_CONSTANT},{"ghostwhite", SYNTAX_CONSTANT},{"gold", SYNTAX_CONSTANT},{"goldenrod", SYNTAX_CONSTANT},{"grab", SYNTAX_CONSTANT},{"grabbing", SYNTAX_CONSTANT},{"gray", SYNTAX_CONSTANT},{"grayscale", SYNTAX_BUILTIN},{"green", SYNTAX_CONSTANT},{"greenyellow", SYNTAX_CONSTANT},{"grey", SYNTAX_CONSTANT},{"grid-area:", SYNTAX_BUILTIN},{"grid-auto-columns:", SYNTAX_BUILTIN},{"grid-auto-flow:", SYNTAX_BUILTIN},{"grid-auto-rows:", SYNTAX_BUILTIN},{"grid-column-end:", SYNTAX_BUILTIN},{"grid-column-start:", SYNTAX_BUILTIN},{"grid-column:", SYNTAX_BUILTIN},{"grid-row-end:", SYNTAX_BUILTIN},{"grid-row-start:", SYNTAX_BUILTIN},{"grid-row:", SYNTAX_BUILTIN},{"grid-template-areas:", SYNTAX_BUILTIN},{"grid-template-columns:", SYNTAX_BUILTIN},{"grid-template-rows:", SYNTAX_BUILTIN},{"grid-template:", SYNTAX_BUILTIN},{"grid:", SYNTAX_BUILTIN},{"groove", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_h[34] = {{"h1", SYNTAX_KEYWORD},{"h2", SYNTAX_KEYWORD},{"h3", SYNTAX_KEYWORD},{"h4", SYNTAX_KEYWORD},{"h5", SYNTAX_KEYWORD},{"h6", SYNTAX_KEYWORD},{"hand", SYNTAX_CONSTANT},{"hanging", SYNTAX_CONSTANT},{"hanging-punctuation:", SYNTAX_BUILTIN},{"hard-light", SYNTAX_CONSTANT},{"head", SYNTAX_KEYWORD},{"header", SYNTAX_KEYWORD},{"height:", SYNTAX_BUILTIN},{"help", SYNTAX_CONSTANT},{"hgroup", SYNTAX_KEYWORD},{"hidden", SYNTAX_CONSTANT},{"hide", SYNTAX_CONSTANT},{"historical-forms", SYNTAX_CONSTANT},{"historical-ligatures", SYNTAX_CONSTANT},{"honeydew", SYNTAX_CONSTANT},{"horizontal", SYNTAX_CONSTANT},{"horizontal-tb", SYNTAX_CONSTANT},{"hotpink", SYNTAX_CONSTANT},{"hr", SYNTAX_KEYWORD},{"hsl", SYNTAX_BUILTIN},{"hsla", SYNTAX_BUILTIN},{"html", SYNTAX_KEYWORD},{"hue", SYNTAX_CONSTANT},{"hue-rotate", SYNTAX_BUILTIN},{"hwb", SYNTAX_BUILTIN},{"hyphenate-character:", SYNTAX_BUILTIN},{"hyphenate-limit-chars:", SYNTAX_BUILTIN},{"hyphens:", SYNTAX_BUILTIN},{"hypot", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_i[55] = {{"i", SYNTAX_KEYWORD},{"icon", SYNTAX_CONSTANT},{"ideograph-alpha", SYNTAX_CONSTANT},{"ideograph-numeric", SYNTAX_CONSTANT},{"ideograph-parenthesis", SYNTAX_CONSTANT},{"ideograph-space", SYNTAX_CONSTANT},{"ideographic", SYNTAX_CONSTANT},{"iframe", SYNTAX_KEYWORD},{"image", SYNTAX_BUILTIN},{"image-orientation:", SYNTAX_BUILTIN},{"image-rendering:", SYNTAX_BUILTIN},{"image-resolution:", SYNTAX_BUILTIN},{"image-set", SYNTAX_BUILTIN},{"img", SYNTAX_KEYWORD},{"inactive", SYNTAX_CONSTANT},{"indianred", SYNTAX_CONSTANT},{"indigo", SYNTAX_CONSTANT},{"infinite", SYNTAX_CONSTANT},{"inherit", SYNTAX_CONSTANT},{"inherits:", SYNTAX_BUILTIN},{"initial", SYNTAX_CONSTANT},{"initial-letter-align:", SYNTAX_BUILTIN},{"initial-letter:", SYNTAX_BUILTIN},{"initial-value:", SYNTAX_BUILTIN},{"inline", SYNTAX_CONSTANT},{"inline-axis", SYNTAX_CONSTANT},{"inline-block", SYNTAX_CONSTANT},{"inline-end", SYNTAX_CONSTANT},{"inline-flex", SYNTAX_CONSTANT},{"inline-grid", SYNTAX_CONSTANT},{"inline-list-item", SYNTAX_CONSTANT},{"inline-size:", SYNTAX_BUILTIN},{"inline-start", SYNTAX_CONSTANT},{"inline-table", SYNTAX_CONSTANT},{"input", SYNTAX_KEYWORD},{"input-security:", SYNTAX_BUILTIN},{"ins", SYNTAX_KEYWORD},{"inset", SYNTAX_BUILTIN},{"inset-block-end:", SYNTAX_BUILTIN},{"inset-block-start:", SYNTAX_BUILTIN},{"inset-block:", SYNTAX_BUILTIN},{"inset-inline-end:", SYNTAX_BUILTIN},{"inset-inline-start:", SYNTAX_BUILTIN},{"inset-inline:", SYNTAX_BUILTIN},{"inside", SYNTAX_CONSTANT},{"inter-character", SYNTAX_CONSTANT},{"inter-ideograph", SYNTAX_CONSTANT},{"inter-word", SYNTAX_CONSTANT},{"intersect", SYNTAX_CONSTANT},{"invert", SYNTAX_BUILTIN},{"isolate", SYNTAX_CONSTANT},{"isolate-override", SYNTAX_CONSTANT},{"isolation:", SYNTAX_BUILTIN},{"italic", SYNTAX_CONSTANT},{"ivory", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_j[10] = {{"jis04", SYNTAX_CONSTANT},{"jis78", SYNTAX_CONSTANT},{"jis83", SYNTAX_CONSTANT},{"jis90", SYNTAX_CONSTANT},{"justify", SYNTAX_CONSTANT},{"justify-all", SYNTAX_CONSTANT},{"justify-content:", SYNTAX_BUILTIN},{"justify-items:", SYNTAX_BUILTIN},{"justify-self:", SYNTAX_BUILTIN},{"justify-tracks:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_k[5] = {{"kannada", SYNTAX_CONSTANT},{"kbd", SYNTAX_KEYWORD},{"keep-all", SYNTAX_CONSTANT},{"keygen", SYNTAX_KEYWORD},{"khaki", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_l[65] = {{"lab", SYNTAX_BUILTIN},{"label", SYNTAX_KEYWORD},{"landscape", SYNTAX_CONSTANT},{"large", SYNTAX_CONSTANT},{"larger", SYNTAX_CONSTANT},{"lavender", SYNTAX_CONSTANT},{"lavenderblush", SYNTAX_CONSTANT},{"lawngreen", SYNTAX_CONSTANT},{"layer", SYNTAX_BUILTIN},{"lch", SYNTAX_BUILTIN},{"leader", SYNTAX_BUILTIN},{"left", SYNTAX_CONSTANT},{"left:", SYNTAX_BUILTIN},{"legend", SYNTAX_KEYWORD},{"lemonchiffon", SYNTAX_CONSTANT},{"letter-spacing:", SYNTAX_BUILTIN},{"li", SYNTAX_KEYWORD},{"light", SYNTAX_CONSTANT},{"lightblue", SYNTAX_CONSTANT},{"lightcoral", SYNTAX_CONSTANT},{"lightcyan", SYNTAX_CONSTANT},{"lighten", SYNTAX_CONSTANT},{"lighter", SYNTAX_CONSTANT},{"lightgoldenrodyellow", SYNTAX_CONSTANT},{"lightgray", SYNTAX_CONSTANT},{"lightgreen", SYNTAX_CONSTANT},{"lightgrey", SYNTAX_CONSTANT},{"lightpink", SYNTAX_CONSTANT},{"lightsalmon", SYNTAX_CONSTANT},{"lightseagreen", SYNTAX_CONSTANT},{"lightskyblue", SYNTAX_CONSTANT},{"lightslategray", SYNTAX_CONSTANT},{"lightslategrey", SYNTAX_CONSTANT},{"lightsteelblue", SYNTAX_CONSTANT},{"lightyellow", SYNTAX_CONSTANT},{"lime", SYNTAX_CONSTANT},{"limegreen", SYNTAX_CONSTANT},{"line", SYNTAX_CONSTANT},{"line-break:", SYNTAX_BUILTIN},{"line-clamp:", SYNTAX_BUILTIN},{"line-edge", SYNTAX_CONSTANT},{"line-gap-override:", SYNTAX_BUILTIN},{"line-height-step:", SYNTAX_BUILTIN},{"line-height:", SYNTAX_BUILTIN},{"line-through", SYNTAX_CONSTANT},{"linear", SYNTAX_CONSTANT},{"linear-gradient", SYNTAX_BUILTIN},{"linearRGB", SYNTAX_CONSTANT},{"linen", SYNTAX_CONSTANT},{"lining-nums", SYNTAX_CONSTANT},{"link", SYNTAX_KEYWORD},{"list-item", SYNTAX_CONSTANT},{"list-style-image:", SYNTAX_BUILTIN},{"list-style-position:", SYNTAX_BUILTIN},{"list-style-type:", SYNTAX_BUILTIN},{"list-style:", SYNTAX_BUILTIN},{"local", SYNTAX_BUILTIN},{"log", SYNTAX_BUILTIN},{"loose", SYNTAX_CONSTANT},{"lowercase", SYNTAX_CONSTANT},{"lr", SYNTAX_CONSTANT},{"lr-tb", SYNTAX_CONSTANT},{"ltr", SYNTAX_CONSTANT},{"luminance", SYNTAX_CONSTANT},{"luminosity", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_m[92] = {{"magenta", SYNTAX_CONSTANT},{"main", SYNTAX_KEYWORD},{"main-size", SYNTAX_CONSTANT},{"mandatory", SYNTAX_CONSTANT},{"manipulation", SYNTAX_CONSTANT},{"manual", SYNTAX_CONSTANT},{"map", SYNTAX_KEYWORD},{"margin-block-end:", SYNTAX_BUILTIN},{"margin-block-start:", SYNTAX_BUILTIN},{"margin-block:", SYNTAX_BUILTIN},{"margin-bottom:", SYNTAX_BUILTIN},{"margin-box", SYNTAX_CONSTANT},{"margin-inline-end:", SYNTAX_BUILTIN},{"margin-inline-start:", SYNTAX_BUILTIN},{"margin-inline:", SYNTAX_BUILTIN},{"margin-left:", SYNTAX_BUILTIN},{"margin-right:", SYNTAX_BUILTIN},{"margin-top:", SYNTAX_BUILTIN},{"margin-trim:", SYNTAX_BUILTIN},{"margin:", SYNTAX_BUILTIN},{"mark", SYNTAX_KEYWORD},{"marks:", SYNTAX_BUILTIN},{"maroon", SYNTAX_CONSTANT},{"marquee", SYNTAX_KEYWORD},{"mask-border-mode:", SYNTAX_BUILTIN},{"mask-border-outset:", SYNTAX_BUILTIN},{"mask-border-repeat:", SYNTAX_BUILTIN},{"mask-border-slice:", SYNTAX_BUILTIN},{"mask-border-source:", SYNTAX_BUILTIN},{"mask-border-width:", SYNTAX_BUILTIN},{"mask-border:", SYNTAX_BUILTIN},{"mask-clip:", SYNTAX_BUILTIN},{"mask-composite:", SYNTAX_BUILTIN},{"mask-image:", SYNTAX_BUILTIN},{"mask-mode:", SYNTAX_BUILTIN},{"mask-origin:", SYNTAX_BUILTIN},{"mask-position:", SYNTAX_BUILTIN},{"mask-repeat:", SYNTAX_BUILTIN},{"mask-size:", SYNTAX_BUILTIN},{"mask-type:", SYNTAX_BUILTIN},{"mask:", SYNTAX_BUILTIN},{"masonry-auto-flow:", SYNTAX_BUILTIN},{"match-parent", SYNTAX_CONSTANT},{"match-source", SYNTAX_CONSTANT},{"math-depth:", SYNTAX_BUILTIN},{"math-shift:", SYNTAX_BUILTIN},{"math-style:", SYNTAX_BUILTIN},{"mathematical", SYNTAX_CONSTANT},{"matrix", SYNTAX_BUILTIN},{"matrix3d", SYNTAX_BUILTIN},{"max", SYNTAX_BUILTIN},{"max-block-size:", SYNTAX_BUILTIN},{"max-content", SYNTAX_CONSTANT},{"max-height:", SYNTAX_BUILTIN},{"max-inline-size:", SYNTAX_BUILTIN},{"max-lines:", SYNTAX_BUILTIN},{"max-width:", SYNTAX_BUILTIN},{"max-zoom:", SYNTAX_BUILTIN},{"medium", SYNTAX_CONSTANT},{"mediumaquamarine", SYNTAX_CONSTANT},{"mediumblue", SYNTAX_CONSTANT},{"mediumorchid", SYNTAX_CONSTANT},{"mediumpurple", SYNTAX_CONSTANT},{"mediumseagreen", SYNTAX_CONSTANT},{"mediumslateblue", SYNTAX_CONSTANT},{"mediumspringgreen", SYNTAX_CONSTANT},{"mediumturquoise", SYNTAX_CONSTANT},{"mediumvioletred", SYNTAX_CONSTANT},{"menu", SYNTAX_KEYWORD},{"menuitem", SYNTAX_KEYWORD},{"message-box", SYNTAX_CONSTANT},{"meta", SYNTAX_KEYWORD},{"meter", SYNTAX_KEYWORD},{"middle", SYNTAX_CONSTANT},{"midnightblue", SYNTAX_CONSTANT},{"min", SYNTAX_BUILTIN},{"min-block-size:", SYNTAX_BUILTIN},{"min-content", SYNTAX_CONSTANT},{"min-height:", SYNTAX_BUILTIN},{"min-inline-size:", SYNTAX_BUILTIN},{"min-width:", SYNTAX_BUILTIN},{"min-zoom:", SYNTAX_BUILTIN},{"minmax", SYNTAX_BUILTIN},{"mintcream", SYNTAX_CONSTANT},{"mistyrose", SYNTAX_CONSTANT},{"miter", SYNTAX_CONSTANT},{"mix-blend-mode:", SYNTAX_BUILTIN},{"mixed", SYNTAX_CONSTANT},{"moccasin", SYNTAX_CONSTANT},{"mod", SYNTAX_BUILTIN},{"move", SYNTAX_CONSTANT},{"multiply", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_n[34] = {{"n-resize", SYNTAX_CONSTANT},{"narrower", SYNTAX_CONSTANT},{"nav", SYNTAX_KEYWORD},{"navajowhite", SYNTAX_CONSTANT},{"navy", SYNTAX_CONSTANT},{"ne-resize", SYNTAX_CONSTANT},{"nearest-neighbor", SYNTAX_CONSTANT},{"negative:", SYNTAX_BUILTIN},{"nesw-resize", SYNTAX_CONSTANT},{"newspaper", SYNTAX_CONSTANT},{"no-change", SYNTAX_CONSTANT},{"no-clip", SYNTAX_CONSTANT},{"no-close-quote", SYNTAX_CONSTANT},{"no-common-ligatures", SYNTAX_CONSTANT},{"no-contextual", SYNTAX_CONSTANT},{"no-discretionary-ligatures", SYNTAX_CONSTANT},{"no-drop", SYNTAX_CONSTANT},{"no-historical-ligatures", SYNTAX_CONSTANT},{"no-open-quote", SYNTAX_CONSTANT},{"no-repeat", SYNTAX_CONSTANT},{"nobr", SYNTAX_KEYWORD},{"noembed", SYNTAX_KEYWORD},{"noframes", SYNTAX_KEYWORD},{"none", SYNTAX_CONSTANT},{"nonzero", SYNTAX_CONSTANT},{"normal", SYNTAX_CONSTANT},{"noscript", SYNTAX_KEYWORD},{"not-allowed", SYNTAX_CONSTANT},{"nowrap", SYNTAX_CONSTANT},{"ns-resize", SYNTAX_CONSTANT},{"numbers", SYNTAX_CONSTANT},{"numeric", SYNTAX_CONSTANT},{"nw-resize", SYNTAX_CONSTANT},{"nwse-resize", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_o[56] = {{"object", SYNTAX_KEYWORD},{"object-fit:", SYNTAX_BUILTIN},{"object-position:", SYNTAX_BUILTIN},{"oblique", SYNTAX_CONSTANT},{"offset-anchor:", SYNTAX_BUILTIN},{"offset-distance:", SYNTAX_BUILTIN},{"offset-path:", SYNTAX_BUILTIN},{"offset-position:", SYNTAX_BUILTIN},{"offset-rotate:", SYNTAX_BUILTIN},{"offset:", SYNTAX_BUILTIN},{"ol", SYNTAX_KEYWORD},{"oldlace", SYNTAX_CONSTANT},{"oldstyle-nums", SYNTAX_CONSTANT},{"olive", SYNTAX_CONSTANT},{"olivedrab", SYNTAX_CONSTANT},{"opacity", SYNTAX_BUILTIN},{"open", SYNTAX_CONSTANT},{"open-quote", SYNTAX_CONSTANT},{"optgroup", SYNTAX_KEYWORD},{"optimizeLegibility", SYNTAX_CONSTANT},{"optimizeQuality", SYNTAX_CONSTANT},{"optimizeSpeed", SYNTAX_CONSTANT},{"option", SYNTAX_KEYWORD},{"optional", SYNTAX_CONSTANT},{"orange", SYNTAX_CONSTANT},{"orangered", SYNTAX_CONSTANT},{"orchid", SYNTAX_CONSTANT},{"order:", SYNTAX_BUILTIN},{"ordinal", SYNTAX_CONSTANT},{"orientation:", SYNTAX_BUILTIN},{"ornaments", SYNTAX_BUILTIN},{"orphans:", SYNTAX_BUILTIN},{"outline-color:", SYNTAX_BUILTIN},{"outline-offset:", SYNTAX_BUILTIN},{"outline-style:", SYNTAX_BUILTIN},{"outline-width:", SYNTAX_BUILTIN},{"outline:", SYNTAX_BUILTIN},{"output", SYNTAX_KEYWORD},{"outset", SYNTAX_CONSTANT},{"outside", SYNTAX_CONSTANT},{"over", SYNTAX_CONSTANT},{"overflow-anchor:", SYNTAX_BUILTIN},{"overflow-block:", SYNTAX_BUILTIN},{"overflow-clip-margin:", SYNTAX_BUILTIN},{"overflow-inline:", SYNTAX_BUILTIN},{"overflow-wrap:", SYNTAX_BUILTIN},{"overflow-x:", SYNTAX_BUILTIN},{"overflow-y:", SYNTAX_BUILTIN},{"overflow:", SYNTAX_BUILTIN},{"overlay", SYNTAX_CONSTANT},{"overline", SYNTAX_CONSTANT},{"overscroll-behavior-block:", SYNTAX_BUILTIN},{"overscroll-behavior-inline:", SYNTAX_BUILTIN},{"overscroll-behavior-x:", SYNTAX_BUILTIN},{"overscroll-behavior-y:", SYNTAX_BUILTIN},{"overscroll-behavior:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_p[67] = {{"p", SYNTAX_KEYWORD},{"pad:", SYNTAX_BUILTIN},{"padding-block-end:", SYNTAX_BUILTIN},{"padding-block-start:", SYNTAX_BUILTIN},{"padding-block:", SYNTAX_BUILTIN},{"padding-bottom:", SYNTAX_BUILTIN},{"padding-inline-end:", SYNTAX_BUILTIN},{"padding-inline-start:", SYNTAX_BUILTIN},{"padding-inline:", SYNTAX_BUILTIN},{"padding-left:", SYNTAX_BUILTIN},{"padding-right:", SYNTAX_BUILTIN},{"padding-top:", SYNTAX_BUILTIN},{"padding:", SYNTAX_BUILTIN},{"page", SYNTAX_CONSTANT},{"page-break-after:", SYNTAX_BUILTIN},{"page-break-before:", SYNTAX_BUILTIN},{"page-break-inside:", SYNTAX_BUILTIN},{"paint", SYNTAX_BUILTIN},{"paint-order:", SYNTAX_BUILTIN},{"painted", SYNTAX_CONSTANT},{"palegoldenrod", SYNTAX_CONSTANT},{"palegreen", SYNTAX_CONSTANT},{"paleturquoise", SYNTAX_CONSTANT},{"palevioletred", SYNTAX_CONSTANT},{"pan-down", SYNTAX_CONSTANT},{"pan-left", SYNTAX_CONSTANT},{"pan-right", SYNTAX_CONSTANT},{"pan-up", SYNTAX_CONSTANT},{"pan-x", SYNTAX_CONSTANT},{"pan-y", SYNTAX_CONSTANT},{"papayawhip", SYNTAX_CONSTANT},{"param", SYNTAX_KEYWORD},{"path", SYNTAX_BUILTIN},{"paused", SYNTAX_CONSTANT},{"peachpuff", SYNTAX_CONSTANT},{"perspective", SYNTAX_BUILTIN},{"perspective-origin:", SYNTAX_BUILTIN},{"peru", SYNTAX_CONSTANT},{"petite-caps", SYNTAX_CONSTANT},{"picture", SYNTAX_KEYWORD},{"pink", SYNTAX_CONSTANT},{"pixelated", SYNTAX_CONSTANT},{"place-content:", SYNTAX_BUILTIN},{"place-items:", SYNTAX_BUILTIN},{"place-self:", SYNTAX_BUILTIN},{"plaintext", SYNTAX_CONSTANT},{"plum", SYNTAX_CONSTANT},{"pointer", SYNTAX_CONSTANT},{"pointer-events:", SYNTAX_BUILTIN},{"polygon", SYNTAX_BUILTIN},{"portal", SYNTAX_KEYWORD},{"portrait", SYNTAX_CONSTANT},{"position:", SYNTAX_BUILTIN},{"pow", SYNTAX_BUILTIN},{"powderblue", SYNTAX_CONSTANT},{"pre", SYNTAX_KEYWORD},{"pre-line", SYNTAX_CONSTANT},{"pre-wrap", SYNTAX_CONSTANT},{"prefix:", SYNTAX_BUILTIN},{"preserve-3d", SYNTAX_CONSTANT},{"print-color-adjust:", SYNTAX_BUILTIN},{"progress", SYNTAX_KEYWORD},{"progressive", SYNTAX_CONSTANT},{"proportional-nums", SYNTAX_CONSTANT},{"proportional-width", SYNTAX_CONSTANT},{"proximity", SYNTAX_CONSTANT},{"purple", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_q[2] = {{"q", SYNTAX_KEYWORD},{"quotes:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_r[54] = {{"radial", SYNTAX_CONSTANT},{"radial-gradient", SYNTAX_BUILTIN},{"range:", SYNTAX_BUILTIN},{"rb", SYNTAX_KEYWORD},{"rect", SYNTAX_BUILTIN},{"recto", SYNTAX_CONSTANT},{"red", SYNTAX_CONSTANT},{"region", SYNTAX_CONSTANT},{"relative", SYNTAX_CONSTANT},{"rem", SYNTAX_BUILTIN},{"remove", SYNTAX_CONSTANT},{"repeat", SYNTAX_BUILTIN},{"repeating-conic-gradient", SYNTAX_BUILTIN},{"repeating-linear-gradient", SYNTAX_BUILTIN},{"repeating-radial-gradient", SYNTAX_BUILTIN},{"reset-size", SYNTAX_CONSTANT},{"resize:", SYNTAX_BUILTIN},{"reverse", SYNTAX_CONSTANT},{"reversed", SYNTAX_BUILTIN},{"revert", SYNTAX_CONSTANT},{"rgb", SYNTAX_BUILTIN},{"rgba", SYNTAX_BUILTIN},{"ridge", SYNTAX_CONSTANT},{"right", SYNTAX_CONSTANT},{"right:", SYNTAX_BUILTIN},{"rl", SYNTAX_CONSTANT},{"rl-tb", SYNTAX_CONSTANT},{"rosybrown", SYNTAX_CONSTANT},{"rotate", SYNTAX_BUILTIN},{"rotate3d", SYNTAX_BUILTIN},{"rotateX", SYNTAX_BUILTIN},{"rotateY", SYNTAX_BUILTIN},{"rotateZ", SYNTAX_BUILTIN},{"round", SYNTAX_CONSTANT},{"row", SYNTAX_CONSTANT},{"row-gap:", SYNTAX_BUILTIN},{"row-resize", SYNTAX_CONSTANT},{"row-reverse", SYNTAX_CONSTANT},{"row-severse", SYNTAX_CONSTANT},{"royalblue", SYNTAX_CONSTANT},{"rp", SYNTAX_KEYWORD},{"rt", SYNTAX_KEYWORD},{"rtc", SYNTAX_KEYWORD},{"rtl", SYNTAX_CONSTANT},{"ruby", SYNTAX_KEYWORD},{"ruby-align:", SYNTAX_BUILTIN},{"ruby-base", SYNTAX_CONSTANT},{"ruby-base-container", SYNTAX_CONSTANT},{"ruby-merge:", SYNTAX_BUILTIN},{"ruby-position:", SYNTAX_BUILTIN},{"ruby-text", SYNTAX_CONSTANT},{"ruby-text-container", SYNTAX_CONSTANT},{"run-in", SYNTAX_CONSTANT},{"running", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_s[144] = {{"s", SYNTAX_KEYWORD},{"s-resize", SYNTAX_CONSTANT},{"sRGB", SYNTAX_CONSTANT},{"saddlebrown", SYNTAX_CONSTANT},{"salmon", SYNTAX_CONSTANT},{"samp", SYNTAX_KEYWORD},{"sandybrown", SYNTAX_CONSTANT},{"saturate", SYNTAX_BUILTIN},{"saturation", SYNTAX_CONSTANT},{"scale", SYNTAX_BUILTIN},{"scale-down", SYNTAX_CONSTANT},{"scale3d", SYNTAX_BUILTIN},{"scaleX", SYNTAX_BUILTIN},{"scaleY", SYNTAX_BUILTIN},{"scaleZ", SYNTAX_BUILTIN},{"screen", SYNTAX_CONSTANT},{"script", SYNTAX_KEYWORD},{"scroll", SYNTAX_BUILTIN},{"scroll-behavior:", SYNTAX_BUILTIN},{"scroll-margin-block-end:", SYNTAX_BUILTIN},{"scroll-margin-block-start:", SYNTAX_BUILTIN},{"scroll-margin-block:", SYNTAX_BUILTIN},{"scroll-margin-bottom:", SYNTAX_BUILTIN},{"scroll-margin-inline-end:", SYNTAX_BUILTIN},{"scroll-margin-inline-start:", SYNTAX_BUILTIN},{"scroll-margin-inline:", SYNTAX_BUILTIN},{"scroll-margin-left:", SYNTAX_BUILTIN},{"scroll-margin-right:", SYNTAX_BUILTIN},{"scroll-margin-top:", SYNTAX_BUILTIN},{"scroll-margin:", SYNTAX_BUILTIN},{"scroll-padding-block-end:", SYNTAX_BUILTIN},{"scroll-padding-block-start:", SYNTAX_BUILTIN},{"scroll-padding-block:", SYNTAX_BUILTIN},{"scroll-padding-bottom:", SYNTAX_BUILTIN},{"scroll-padding-inline-end:", SYNTAX_BUILTIN},{"scroll-padding-inline-start:", SYNTAX_BUILTIN},{"scroll-padding-inline:", SYNTAX_BUILTIN},{"scroll-padding-left:", SYNTAX_BUILTIN},{"scroll-padding-right:", SYNTAX_BUILTIN},{"scroll-padding-top:", SYNTAX_BUILTIN},{"scroll-padding:", SYNTAX_BUILTIN},{"scroll-snap-align:", SYNTAX_BUILTIN},{"scroll-snap-stop:", SYNTAX_BUILTIN},{"scroll-snap-type:", SYNTAX_BUILTIN},{"scroll-timeline-axis:", SYNTAX_BUILTIN},{"scroll-timeline-name:", SYNTAX_BUILTIN},{"scroll-timeline:", SYNTAX_BUILTIN},{"scrollbar-color:", SYNTAX_BUILTIN},{"scrollbar-gutter:", SYNTAX_BUILTIN},{"scrollbar-width:", SYNTAX_BUILTIN},{"se-resize", SYNTAX_CONSTANT},{"seagreen", SYNTAX_CONSTANT},{"seashell", SYNTAX_CONSTANT},{"section", SYNTAX_KEYWORD},{"select", SYNTAX_KEYWORD},{"selector", SYNTAX_BUILTIN},{"semi-condensed", SYNTAX_CONSTANT},{"semi-expanded", SYNTAX_CONSTANT},{"separate", SYNTAX_CONSTANT},{"sepia", SYNTAX_BUILTIN},{"sesame", SYNTAX_CONSTANT},{"shadow", SYNTAX_KEYWORD},{"shape-image-threshold:", SYNTAX_BUILTIN},{"shape-margin:", SYNTAX_BUILTIN},{"shape-outside:", SYNTAX_BUILTIN},{"show", SYNTAX_CONSTANT},{"sideways", SYNTAX_CONSTANT},{"sideways-left", SYNTAX_CONSTANT},{"sideways-lr", SYNTAX_CONSTANT},{"sideways-right", SYNTAX_CONSTANT},{"sideways-rl", SYNTAX_CONSTANT},{"sienna", SYNTAX_CONSTANT},{"sign", SYNTAX_BUILTIN},{"silver", SYNTAX_CONSTANT},{"simplified", SYNTAX_CONSTANT},{"sin", SYNTAX_BUILTIN},{"size-adjust:", SYNTAX_BUILTIN},{"size:", SYNTAX_BUILTIN},{"skew", SYNTAX_BUILTIN},{"skewX", SYNTAX_BUILTIN},{"skewY", SYNTAX_BUILTIN},{"skyblue", SYNTAX_CONSTANT},{"slashed-zero", SYNTAX_CONSTANT},{"slateblue", SYNTAX_CONSTANT},{"slategray", SYNTAX_CONSTANT},{"slategrey", SYNTAX_CONSTANT},{"slice", SYNTAX_CONSTANT},{"slot", SYNTAX_KEYWORD},{"small", SYNTAX_CONSTANT},{"small-caps", SYNTAX_CONSTANT},{"small-caption", SYNTAX_CONSTANT},{"smaller", SYNTAX_CONSTANT},{"smooth", SYNTAX_CONSTANT},{"snow", SYNTAX_CONSTANT},{"soft-light", SYNTAX_CONSTANT},{"solid", SYNTAX_CONSTANT},{"source", SYNTAX_KEYWORD},{"space", SYNTAX_CONSTANT},{"space-around", SYNTAX_CONSTANT},{"space-between", SYNTAX_CONSTANT},{"space-evenly", SYNTAX_CONSTANT},{"spacer", SYNTAX_KEYWORD},{"span", SYNTAX_KEYWORD},{"speak-as:", SYNTAX_BUILTIN},{"spell-out", SYNTAX_CONSTANT},{"springgreen", SYNTAX_CONSTANT},{"sqrt", SYNTAX_BUILTIN},{"square", SYNTAX_CONSTANT},{"src:", SYNTAX_BUILTIN},{"stacked-fractions", SYNTAX_CONSTANT},{"start", SYNTAX_CONSTANT},{"static", SYNTAX_CONSTANT},{"status-bar", SYNTAX_CONSTANT},{"steelblue", SYNTAX_CONSTANT},{"step-end", SYNTAX_CONSTANT},{"step-start", SYNTAX_CONSTANT},{"steps", SYNTAX_BUILTIN},{"sticky", SYNTAX_CONSTANT},{"stretch", SYNTAX_CONSTANT},{"strict", SYNTAX_CONSTANT},{"strike", SYNTAX_KEYWORD},{"stroke", SYNTAX_CONSTANT},{"stroke-box", SYNTAX_CONSTANT},{"strong", SYNTAX_KEYWORD},{"style", SYNTAX_CONSTANT},{"styleset", SYNTAX_BUILTIN},{"stylistic", SYNTAX_BUILTIN},{"sub", SYNTAX_KEYWORD},{"subgrid", SYNTAX_CONSTANT},{"subpixel-antialiased", SYNTAX_CONSTANT},{"subtract", SYNTAX_CONSTANT},{"suffix:", SYNTAX_BUILTIN},{"summary", SYNTAX_KEYWORD},{"sup", SYNTAX_KEYWORD},{"super", SYNTAX_CONSTANT},{"supports", SYNTAX_BUILTIN},{"svg", SYNTAX_KEYWORD},{"sw-resize", SYNTAX_CONSTANT},{"swap", SYNTAX_CONSTANT},{"swash", SYNTAX_BUILTIN},{"symbolic", SYNTAX_CONSTANT},{"symbols", SYNTAX_BUILTIN},{"syntax:", SYNTAX_BUILTIN},{"system:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_t[89] = {{"tab-size:", SYNTAX_BUILTIN},{"table", SYNTAX_KEYWORD},{"table-caption", SYNTAX_CONSTANT},{"table-cell", SYNTAX_CONSTANT},{"table-column", SYNTAX_CONSTANT},{"table-column-group", SYNTAX_CONSTANT},{"table-footer-group", SYNTAX_CONSTANT},{"table-header-group", SYNTAX_CONSTANT},{"table-layout:", SYNTAX_BUILTIN},{"table-row", SYNTAX_CONSTANT},{"table-row-group", SYNTAX_CONSTANT},{"tabular-nums", SYNTAX_CONSTANT},{"tan", SYNTAX_BUILTIN},{"target-counter", SYNTAX_BUILTIN},{"target-counters", SYNTAX_BUILTIN},{"target-text", SYNTAX_BUILTIN},{"tb", SYNTAX_CONSTANT},{"tb-rl", SYNTAX_CONSTANT},{"tbody", SYNTAX_KEYWORD},{"td", SYNTAX_KEYWORD},{"teal", SYNTAX_CONSTANT},{"template", SYNTAX_KEYWORD},{"text", SYNTAX_CONSTANT},{"text-after-edge", SYNTAX_CONSTANT},{"text-align-last:", SYNTAX_BUILTIN},{"text-align:", SYNTAX_BUILTIN},{"text-before-edge", SYNTAX_CONSTANT},{"text-bottom", SYNTAX_CONSTANT},{"text-combine-upright:", SYNTAX_BUILTIN},{"text-decoration-color:", SYNTAX_BUILTIN},{"text-decoration-line:", SYNTAX_BUILTIN},{"text-decoration-skip-ink:", SYNTAX_BUILTIN},{"text-decoration-skip:", SYNTAX_BUILTIN},{"text-decoration-style:", SYNTAX_BUILTIN},{"text-decoration-thickness:", SYNTAX_BUILTIN},{"text-decoration:", SYNTAX_BUILTIN},{"text-emphasis-color:", SYNTAX_BUILTIN},{"text-emphasis-position:", SYNTAX_BUILTIN},{"text-emphasis-style:", SYNTAX_BUILTIN},{"text-emphasis:", SYNTAX_BUILTIN},{"text-indent:", SYNTAX_BUILTIN},{"text-justify:", SYNTAX_BUILTIN},{"text-orientation:", SYNTAX_BUILTIN},{"text-overflow:", SYNTAX_BUILTIN},{"text-rendering:", SYNTAX_BUILTIN},{"text-shadow:", SYNTAX_BUILTIN},{"text-size-adjust:", SYNTAX_BUILTIN},{"text-top", SYNTAX_CONSTANT},{"text-transform:", SYNTAX_BUILTIN},{"text-underline-offset:", SYNTAX_BUILTIN},{"text-underline-position:", SYNTAX_BUILTIN},{"textarea", SYNTAX_KEYWORD},{"tfoot", SYNTAX_KEYWORD},{"th", SYNTAX_KEYWORD},{"thead", SYNTAX_KEYWORD},{"thick", SYNTAX_CONSTANT},{"thin", SYNTAX_CONSTANT},{"thistle", SYNTAX_CONSTANT},{"time", SYNTAX_KEYWORD},{"title", SYNTAX_KEYWORD},{"titling-caps", SYNTAX_CONSTANT},{"tomato", SYNTAX_CONSTANT},{"top", SYNTAX_CONSTANT},{"top-outside", SYNTAX_CONSTANT},{"top:", SYNTAX_BUILTIN},{"touch", SYNTAX_CONSTANT},{"touch-action:", SYNTAX_BUILTIN},{"tr", SYNTAX_KEYWORD},{"track", SYNTAX_KEYWORD},{"traditional", SYNTAX_CONSTANT},{"transform-box:", SYNTAX_BUILTIN},{"transform-origin:", SYNTAX_BUILTIN},{"transform-style:", SYNTAX_BUILTIN},{"transform:", SYNTAX_BUILTIN},{"transition-delay:", SYNTAX_BUILTIN},{"transition-duration:", SYNTAX_BUILTIN},{"transition-property:", SYNTAX_BUILTIN},{"transition-timing-function:", SYNTAX_BUILTIN},{"transition:", SYNTAX_BUILTIN},{"translate", SYNTAX_BUILTIN},{"translate3d", SYNTAX_BUILTIN},{"translateX", SYNTAX_BUILTIN},{"translateY", SYNTAX_BUILTIN},{"translateZ", SYNTAX_BUILTIN},{"transparent", SYNTAX_CONSTANT},{"triangle", SYNTAX_CONSTANT},{"tt", SYNTAX_KEYWORD},{"turquoise", SYNTAX_CONSTANT},{"type", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_u[18] = {{"u", SYNTAX_KEYWORD},{"ul", SYNTAX_KEYWORD},{"ultra-condensed", SYNTAX_CONSTANT},{"ultra-expanded", SYNTAX_CONSTANT},{"under", SYNTAX_CONSTANT},{"underline", SYNTAX_CONSTANT},{"unicase", SYNTAX_CONSTANT},{"unicode-bidi:", SYNTAX_BUILTIN},{"unicode-range:", SYNTAX_BUILTIN},{"unset", SYNTAX_CONSTANT},{"upleft", SYNTAX_CONSTANT},{"uppercase", SYNTAX_CONSTANT},{"upright", SYNTAX_CONSTANT},{"url", SYNTAX_BUILTIN},{"use-glyph-orientation", SYNTAX_CONSTANT},{"use-script", SYNTAX_CONSTANT},{"user-select:", SYNTAX_BUILTIN},{"user-zoom:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_v[17] = {{"var", SYNTAX_BUILTIN},{"verso", SYNTAX_CONSTANT},{"vertical", SYNTAX_CONSTANT},{"vertical-align:", SYNTAX_BUILTIN},{"vertical-ideographic", SYNTAX_CONSTANT},{"vertical-lr", SYNTAX_CONSTANT},{"vertical-rl", SYNTAX_CONSTANT},{"vertical-text", SYNTAX_CONSTANT},{"video", SYNTAX_KEYWORD},{"view-box", SYNTAX_CONSTANT},{"viewport-fit:", SYNTAX_BUILTIN},{"violet", SYNTAX_CONSTANT},{"visibility:", SYNTAX_BUILTIN},{"visible", SYNTAX_CONSTANT},{"visibleFill", SYNTAX_CONSTANT},{"visiblePainted", SYNTAX_CONSTANT},{"visibleStroke", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_w[21] = {{"w-resize", SYNTAX_CONSTANT},{"wait", SYNTAX_CONSTANT},{"wavy", SYNTAX_CONSTANT},{"wbr", SYNTAX_KEYWORD},{"weight", SYNTAX_CONSTANT},{"wheat", SYNTAX_CONSTANT},{"white", SYNTAX_CONSTANT},{"white-space:", SYNTAX_BUILTIN},{"whitesmoke", SYNTAX_CONSTANT},{"whitespace", SYNTAX_CONSTANT},{"wider", SYNTAX_CONSTANT},{"widows:", SYNTAX_BUILTIN},{"width:", SYNTAX_BUILTIN},{"will-change:", SYNTAX_BUILTIN},{"word-break:", SYNTAX_BUILTIN},{"word-spacing:", SYNTAX_BUILTIN},{"word-wrap:", SYNTAX_BUILTIN},{"words", SYNTAX_CONSTANT},{"wrap", SYNTAX_CONSTANT},{"wrap-reverse", SYNTAX_CONSTANT},{"writing-mode:", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_css_x[6] = {{"x", SYNTAX_CONSTANT},{"x-large", SYNTAX_CONSTANT},{"x-small", SYNTAX_CONSTANT},{"xmp", SYNTAX_KEYWORD},{"xx-large", SYNTAX_CONSTANT},{"xx-small", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_y[3] = {{"y", SYNTAX_CONSTANT},{"yellow", SYNTAX_CONSTANT},{"yellowgreen", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_css_z[5] = {{"z-index:", SYNTAX_BUILTIN},{"zero", SYNTAX_CONSTANT},{"zoom-in", SYNTAX_CONSTANT},{"zoom-out", SYNTAX_CONSTANT},{"zoom:", SYNTAX_BUILTIN}};
-static const KeywordList syntax_all_keywords_css[128] = {
-	['!'] = {syntax_keywords_css_x21, arr_count(syntax_keywords_css_x21)}, ['-'] = {syntax_keywords_css_x2d, arr_count(syntax_keywords_css_x2d)}, ['@'] = {syntax_keywords_css_x40, arr_count(syntax_keywords_css_x40)}, ['a'] = {syntax_keywords_css_a, arr_count(syntax_keywords_css_a)}, ['b'] = {syntax_keywords_css_b, arr_count(syntax_keywords_css_b)}, ['c'] = {syntax_keywords_css_c, arr_count(syntax_keywords_css_c)}, ['d'] = {syntax_keywords_css_d, arr_count(syntax_keywords_css_d)}, ['e'] = {syntax_keywords_css_e, arr_count(syntax_keywords_css_e)}, ['f'] = {syntax_keywords_css_f, arr_count(syntax_keywords_css_f)}, ['g'] = {syntax_keywords_css_g, arr_count(syntax_keywords_css_g)}, ['h'] = {syntax_keywords_css_h, arr_count(syntax_keywords_css_h)}, ['i'] = {syntax_keywords_css_i, arr_count(syntax_keywords_css_i)}, ['j'] = {syntax_keywords_css_j, arr_count(syntax_keywords_css_j)}, ['k'] = {syntax_keywords_css_k, arr_count(syntax_keywords_css_k)}, ['l'] = {syntax_keywords_css_l, arr_count(syntax_keywords_css_l)}, ['m'] = {syntax_keywords_css_m, arr_count(syntax_keywords_css_m)}, ['n'] = {syntax_keywords_css_n, arr_count(syntax_keywords_css_n)}, ['o'] = {syntax_keywords_css_o, arr_count(syntax_keywords_css_o)}, ['p'] = {syntax_keywords_css_p, arr_count(syntax_keywords_css_p)}, ['q'] = {syntax_keywords_css_q, arr_count(syntax_keywords_css_q)}, ['r'] = {syntax_keywords_css_r, arr_count(syntax_keywords_css_r)}, ['s'] = {syntax_keywords_css_s, arr_count(syntax_keywords_css_s)}, ['t'] = {syntax_keywords_css_t, arr_count(syntax_keywords_css_t)}, ['u'] = {syntax_keywords_css_u, arr_count(syntax_keywords_css_u)}, ['v'] = {syntax_keywords_css_v, arr_count(syntax_keywords_css_v)}, ['w'] = {syntax_keywords_css_w, arr_count(syntax_keywords_css_w)}, ['x'] = {syntax_keywords_css_x, arr_count(syntax_keywords_css_x)}, ['y'] = {syntax_keywords_css_y, arr_count(syntax_keywords_css_y)}, ['z'] = {syntax_keywords_css_z, arr_count(syntax_keywords_css_z)}
+static const Keyword syntax_keywords_css[1256] = {{"avoid-region", 12, SYNTAX_CONSTANT},{"overscroll-behavior:", 20, SYNTAX_BUILTIN},{"pan-right", 9, SYNTAX_CONSTANT},{"param", 5, SYNTAX_KEYWORD},{"a", 1, SYNTAX_KEYWORD},{"padding-block-start:", 20, SYNTAX_BUILTIN},{"border-block-start-width:", 25, SYNTAX_BUILTIN},{"asin", 4, SYNTAX_BUILTIN},{"additive-symbols:", 17, SYNTAX_BUILTIN},{"pre-line", 8, SYNTAX_CONSTANT},{"img", 3, SYNTAX_KEYWORD},{"titling-caps", 12, SYNTAX_CONSTANT},{"selector", 8, SYNTAX_BUILTIN},{"lr-tb", 5, SYNTAX_CONSTANT},{"small-caption", 13, SYNTAX_CONSTANT},{"lining-nums", 11, SYNTAX_CONSTANT},{"page-break-before:", 18, SYNTAX_BUILTIN},{"margin-block-end:", 17, SYNTAX_BUILTIN},{"papayawhip", 10, SYNTAX_CONSTANT},{"deepskyblue", 11, SYNTAX_CONSTANT},{"offset-position:", 16, SYNTAX_BUILTIN},{"end", 3, SYNTAX_CONSTANT},{"text-decoration-thickness:", 26, SYNTAX_BUILTIN},{"scroll-padding-block-end:", 25, SYNTAX_BUILTIN},{"line-gap-override:", 18, SYNTAX_BUILTIN},{"cornflowerblue", 14, SYNTAX_CONSTANT},{"border-top-style:", 17, SYNTAX_BUILTIN},{"indianred", 9, SYNTAX_CONSTANT},{"@bottom-center", 14, SYNTAX_KEYWORD},{"text-align:", 11, SYNTAX_BUILTIN},{"lightskyblue", 12, SYNTAX_CONSTANT},{"below", 5, SYNTAX_CONSTANT},{"circle", 6, SYNTAX_BUILTIN},{"contextual", 10, SYNTAX_CONSTANT},{"code", 4, SYNTAX_KEYWORD},{"base", 4, SYNTAX_KEYWORD},{"inter-character", 15, SYNTAX_CONSTANT},{"under", 5, SYNTAX_CONSTANT},{"size:", 5, SYNTAX_BUILTIN},{"@media", 6, SYNTAX_KEYWORD},{"grey", 4, SYNTAX_CONSTANT},{"magenta", 7, SYNTAX_CONSTANT},{"scroll-padding:", 15, SYNTAX_BUILTIN},{"start", 5, SYNTAX_CONSTANT},{"summary", 7, SYNTAX_KEYWORD},{"scroll-padding-inline-start:", 28, SYNTAX_BUILTIN},{"lightpink", 9, SYNTAX_CONSTANT},{"show", 4, SYNTAX_CONSTANT},{"lightgreen", 10, SYNTAX_CONSTANT},{"lightsalmon", 11, SYNTAX_CONSTANT},{"columns:", 8, SYNTAX_BUILTIN},{"@counter-style", 14, SYNTAX_KEYWORD},{"box-shadow:", 11, SYNTAX_BUILTIN},{"midnightblue", 12, SYNTAX_CONSTANT},{"grid-auto-rows:", 15, SYNTAX_BUILTIN},{"wheat", 5, SYNTAX_CONSTANT},{"output", 6, SYNTAX_KEYWORD},{"page-break-after:", 17, SYNTAX_BUILTIN},{"tfoot", 5, SYNTAX_KEYWORD},{"aspect-ratio:", 13, SYNTAX_BUILTIN},{"table-cell", 10, SYNTAX_CONSTANT},{"h1", 2, SYNTAX_KEYWORD},{"ew-resize", 9, SYNTAX_CONSTANT},{"alternate", 9, SYNTAX_CONSTANT},{"se-resize", 9, SYNTAX_CONSTANT},{"text-rendering:", 15, SYNTAX_BUILTIN},{"optgroup", 8, SYNTAX_KEYWORD},{"w-resize", 8, SYNTAX_CONSTANT},{"accent-color:", 13, SYNTAX_BUILTIN},{"thick", 5, SYNTAX_CONSTANT},{"font-display:", 13, SYNTAX_BUILTIN},{"extra-condensed", 15, SYNTAX_CONSTANT},{"relative", 8, SYNTAX_CONSTANT},{"atan", 4, SYNTAX_BUILTIN},{"acos", 4, SYNTAX_BUILTIN},{"tb-rl", 5, SYNTAX_CONSTANT},{"peru", 4, SYNTAX_CONSTANT},{"always", 6, SYNTAX_CONSTANT},{"clip-path:", 10, SYNTAX_BUILTIN},{"border-top-color:", 17, SYNTAX_BUILTIN},{"place-content:", 14, SYNTAX_BUILTIN},{"infinite", 8, SYNTAX_CONSTANT},{"@font-face", 10, SYNTAX_KEYWORD},{"e-resize", 8, SYNTAX_CONSTANT},{"darkorange", 10, SYNTAX_CONSTANT},{"row-gap:", 8, SYNTAX_BUILTIN},{"rtc", 3, SYNTAX_KEYWORD},{"right", 5, SYNTAX_CONSTANT},{"abs", 3, SYNTAX_BUILTIN},{"decimal", 7, SYNTAX_CONSTANT},{"mask-border-repeat:", 19, SYNTAX_BUILTIN},{"rl-tb", 5, SYNTAX_CONSTANT},{"h6", 2, SYNTAX_KEYWORD},{"economy", 7, SYNTAX_CONSTANT},{"darkorchid", 10, SYNTAX_CONSTANT},{"ruby-align:", 11, SYNTAX_BUILTIN},{"overflow-x:", 11, SYNTAX_BUILTIN},{"padding-right:", 14, SYNTAX_BUILTIN},{"h3", 2, SYNTAX_KEYWORD},{"env", 3, SYNTAX_BUILTIN},{"oldlace", 7, SYNTAX_CONSTANT},{"loose", 5, SYNTAX_CONSTANT},{"viewport-fit:", 13, SYNTAX_BUILTIN},{"darkviolet", 10, SYNTAX_CONSTANT},{"difference", 10, SYNTAX_CONSTANT},{"max-lines:", 10, SYNTAX_BUILTIN},{"border-image:", 13, SYNTAX_BUILTIN},{"font-synthesis:", 15, SYNTAX_BUILTIN},{"text-transform:", 15, SYNTAX_BUILTIN},{"underline", 9, SYNTAX_CONSTANT},{"full-width", 10, SYNTAX_CONSTANT},{"column-rule-style:", 18, SYNTAX_BUILTIN},{"marquee", 7, SYNTAX_KEYWORD},{"petite-caps", 11, SYNTAX_CONSTANT},{"visibleStroke", 13, SYNTAX_CONSTANT},{"optimizeSpeed", 13, SYNTAX_CONSTANT},{"text-after-edge", 15, SYNTAX_CONSTANT},{"rt", 2, SYNTAX_KEYWORD},{"transform:", 10, SYNTAX_BUILTIN},{"message-box", 11, SYNTAX_CONSTANT},{"darkred", 7, SYNTAX_CONSTANT},{"no-close-quote", 14, SYNTAX_CONSTANT},{"translateZ", 10, SYNTAX_BUILTIN},{"caret-shape:", 12, SYNTAX_BUILTIN},{"height:", 7, SYNTAX_BUILTIN},{"initial-letter-align:", 21, SYNTAX_BUILTIN},{"portrait", 8, SYNTAX_CONSTANT},{"paint-order:", 12, SYNTAX_BUILTIN},{"violet", 6, SYNTAX_CONSTANT},{"stylistic", 9, SYNTAX_BUILTIN},{"stroke-box", 10, SYNTAX_CONSTANT},{"figure", 6, SYNTAX_KEYWORD},{"char", 4, SYNTAX_CONSTANT},{"print-color-adjust:", 19, SYNTAX_BUILTIN},{"inline-list-item", 16, SYNTAX_CONSTANT},{"no-historical-ligatures", 23, SYNTAX_CONSTANT},{"ideograph-alpha", 15, SYNTAX_CONSTANT},{"red", 3, SYNTAX_CONSTANT},{"scroll-padding-bottom:", 22, SYNTAX_BUILTIN},{"scroll-margin-block-end:", 24, SYNTAX_BUILTIN},{"aqua", 4, SYNTAX_CONSTANT},{"inset-block-start:", 18, SYNTAX_BUILTIN},{"dotted", 6, SYNTAX_CONSTANT},{"normal", 6, SYNTAX_CONSTANT},{"flex-basis:", 11, SYNTAX_BUILTIN},{"static", 6, SYNTAX_CONSTANT},{"grid-template-columns:", 22, SYNTAX_BUILTIN},{"shape-outside:", 14, SYNTAX_BUILTIN},{"chartreuse", 10, SYNTAX_CONSTANT},{"colgroup", 8, SYNTAX_KEYWORD},{"image", 5, SYNTAX_BUILTIN},{"whitesmoke", 10, SYNTAX_CONSTANT},{"y", 1, SYNTAX_CONSTANT},{"text-size-adjust:", 17, SYNTAX_BUILTIN},{"border-spacing:", 15, SYNTAX_BUILTIN},{"border-end-start-radius:", 24, SYNTAX_BUILTIN},{"flex:", 5, SYNTAX_BUILTIN},{"scroll-margin-left:", 19, SYNTAX_BUILTIN},{"size-adjust:", 12, SYNTAX_BUILTIN},{"block-axis", 10, SYNTAX_CONSTANT},{"alias", 5, SYNTAX_CONSTANT},{"steps", 5, SYNTAX_BUILTIN},{"border-box", 10, SYNTAX_CONSTANT},{"@import", 7, SYNTAX_KEYWORD},{"mathematical", 12, SYNTAX_CONSTANT},{"border-top-right-radius:", 24, SYNTAX_BUILTIN},{"source", 6, SYNTAX_KEYWORD},{"downright", 9, SYNTAX_CONSTANT},{"list-style-type:", 16, SYNTAX_BUILTIN},{"reset-size", 10, SYNTAX_CONSTANT},{"figcaption", 10, SYNTAX_KEYWORD},{"touch-action:", 13, SYNTAX_BUILTIN},{"flex-wrap:", 10, SYNTAX_BUILTIN},{"medium", 6, SYNTAX_CONSTANT},{"text-overflow:", 14, SYNTAX_BUILTIN},{"shape-image-threshold:", 22, SYNTAX_BUILTIN},{"square", 6, SYNTAX_CONSTANT},{"use-glyph-orientation", 21, SYNTAX_CONSTANT},{"no-clip", 7, SYNTAX_CONSTANT},{"widows:", 7, SYNTAX_BUILTIN},{"justify-items:", 14, SYNTAX_BUILTIN},{"border-block-end-width:", 23, SYNTAX_BUILTIN},{"khaki", 5, SYNTAX_CONSTANT},{"coral", 5, SYNTAX_CONSTANT},{"distribute-all-lines", 20, SYNTAX_CONSTANT},{"mask-border-slice:", 18, SYNTAX_BUILTIN},{"padding-inline:", 15, SYNTAX_BUILTIN},{"xmp", 3, SYNTAX_KEYWORD},{"column-rule-width:", 18, SYNTAX_BUILTIN},{"step-start", 10, SYNTAX_CONSTANT},{"nav", 3, SYNTAX_KEYWORD},{"scrollbar-gutter:", 17, SYNTAX_BUILTIN},{"vertical-rl", 11, SYNTAX_CONSTANT},{"pad:", 4, SYNTAX_BUILTIN},{"fit-content", 11, SYNTAX_CONSTANT},{"overscroll-behavior-y:", 22, SYNTAX_BUILTIN},{"triangle", 8, SYNTAX_CONSTANT},{"mask-composite:", 15, SYNTAX_BUILTIN},{"masonry-auto-flow:", 18, SYNTAX_BUILTIN},{"table-column", 12, SYNTAX_CONSTANT},{"float:", 6, SYNTAX_BUILTIN},{"jis83", 5, SYNTAX_CONSTANT},{"polygon", 7, SYNTAX_BUILTIN},{"hotpink", 7, SYNTAX_CONSTANT},{"cell", 4, SYNTAX_CONSTANT},{"break-inside:", 13, SYNTAX_BUILTIN},{"border-inline-start-width:", 26, SYNTAX_BUILTIN},{"inline-size:", 12, SYNTAX_BUILTIN},{"darkslategray", 13, SYNTAX_CONSTANT},{"overscroll-behavior-block:", 26, SYNTAX_BUILTIN},{"tabular-nums", 12, SYNTAX_CONSTANT},{"section", 7, SYNTAX_KEYWORD},{"palegreen", 9, SYNTAX_CONSTANT},{"slateblue", 9, SYNTAX_CONSTANT},{"unicase", 7, SYNTAX_CONSTANT},{"filled", 6, SYNTAX_CONSTANT},{"no-contextual", 13, SYNTAX_CONSTANT},{"word-break:", 11, SYNTAX_BUILTIN},{"portal", 6, SYNTAX_KEYWORD},{"background-repeat:", 18, SYNTAX_BUILTIN},{"pan-up", 6, SYNTAX_CONSTANT},{"target-counters", 15, SYNTAX_BUILTIN},{"text", 4, SYNTAX_CONSTANT},{"all-small-caps", 14, SYNTAX_CONSTANT},{"row", 3, SYNTAX_CONSTANT},{"double", 6, SYNTAX_CONSTANT},{"page-break-inside:", 18, SYNTAX_BUILTIN},{"ruby-text-container", 19, SYNTAX_CONSTANT},{"lightcyan", 9, SYNTAX_CONSTANT},{"cover", 5, SYNTAX_CONSTANT},{"rtl", 3, SYNTAX_CONSTANT},{"hsl", 3, SYNTAX_BUILTIN},{"historical-ligatures", 20, SYNTAX_CONSTANT},{"running", 7, SYNTAX_CONSTANT},{"tbody", 5, SYNTAX_KEYWORD},{"@page", 5, SYNTAX_KEYWORD},{"text-bottom", 11, SYNTAX_CONSTANT},{"background-blend-mode:", 22, SYNTAX_BUILTIN},{"text-underline-offset:", 22, SYNTAX_BUILTIN},{"pixelated", 9, SYNTAX_CONSTANT},{"column-reverse", 14, SYNTAX_CONSTANT},{"break-before:", 13, SYNTAX_BUILTIN},{"scale", 5, SYNTAX_BUILTIN},{"yellow", 6, SYNTAX_CONSTANT},{"unicode-range:", 14, SYNTAX_BUILTIN},{"perspective-origin:", 19, SYNTAX_BUILTIN},{"character-variant", 17, SYNTAX_BUILTIN},{"contrast", 8, SYNTAX_BUILTIN},{"hypot", 5, SYNTAX_BUILTIN},{"swap", 4, SYNTAX_CONSTANT},{"border-block-start-color:", 25, SYNTAX_BUILTIN},{"dark", 4, SYNTAX_CONSTANT},{"ruby-position:", 14, SYNTAX_BUILTIN},{"head", 4, SYNTAX_KEYWORD},{"scroll-margin-inline-start:", 27, SYNTAX_BUILTIN},{"ideograph-parenthesis", 21, SYNTAX_CONSTANT},{"block-overflow:", 15, SYNTAX_BUILTIN},{"expanded", 8, SYNTAX_CONSTANT},{"top:", 4, SYNTAX_BUILTIN},{"small-caps", 10, SYNTAX_CONSTANT},{"border-left-style:", 18, SYNTAX_BUILTIN},{"border-block:", 13, SYNTAX_BUILTIN},{"column-count:", 13, SYNTAX_BUILTIN},{"shape-margin:", 13, SYNTAX_BUILTIN},{"scroll-padding-inline-end:", 26, SYNTAX_BUILTIN},{"fixed", 5, SYNTAX_CONSTANT},{"minmax", 6, SYNTAX_BUILTIN},{"dot", 3, SYNTAX_CONSTANT},{"inline-end", 10, SYNTAX_CONSTANT},{"hyphens:", 8, SYNTAX_BUILTIN},{"rgb", 3, SYNTAX_BUILTIN},{"grid-row-start:", 15, SYNTAX_BUILTIN},{"crimson", 7, SYNTAX_CONSTANT},{"larger", 6, SYNTAX_CONSTANT},{"strict", 6, SYNTAX_CONSTANT},{"p", 1, SYNTAX_KEYWORD},{"padding-inline-end:", 19, SYNTAX_BUILTIN},{"display:", 8, SYNTAX_BUILTIN},{"caption-side:", 13, SYNTAX_BUILTIN},{"font-variant:", 13, SYNTAX_BUILTIN},{"background-position-x:", 22, SYNTAX_BUILTIN},{"background-color:", 17, SYNTAX_BUILTIN},{"text-decoration-style:", 22, SYNTAX_BUILTIN},{"darkgreen", 9, SYNTAX_CONSTANT},{"position:", 9, SYNTAX_BUILTIN},{"large", 5, SYNTAX_CONSTANT},{"big", 3, SYNTAX_KEYWORD},{"hand", 4, SYNTAX_CONSTANT},{"color:", 6, SYNTAX_BUILTIN},{"caption", 7, SYNTAX_KEYWORD},{"outline-offset:", 15, SYNTAX_BUILTIN},{"none", 4, SYNTAX_CONSTANT},{"bleed:", 6, SYNTAX_BUILTIN},{"text-orientation:", 17, SYNTAX_BUILTIN},{"place-items:", 12, SYNTAX_BUILTIN},{"row-resize", 10, SYNTAX_CONSTANT},{"darksalmon", 10, SYNTAX_CONSTANT},{"darken", 6, SYNTAX_CONSTANT},{"margin:", 7, SYNTAX_BUILTIN},{"thistle", 7, SYNTAX_CONSTANT},{"jis04", 5, SYNTAX_CONSTANT},{"initial-value:", 14, SYNTAX_BUILTIN},{"details", 7, SYNTAX_KEYWORD},{"right:", 6, SYNTAX_BUILTIN},{"inline-axis", 11, SYNTAX_CONSTANT},{"darkseagreen", 12, SYNTAX_CONSTANT},{"slashed-zero", 12, SYNTAX_CONSTANT},{"inset", 5, SYNTAX_BUILTIN},{"scroll-margin-top:", 18, SYNTAX_BUILTIN},{"overflow-y:", 11, SYNTAX_BUILTIN},{"@left-bottom", 12, SYNTAX_KEYWORD},{"justify-all", 11, SYNTAX_CONSTANT},{"horizontal-tb", 13, SYNTAX_CONSTANT},{"form", 4, SYNTAX_KEYWORD},{"bisque", 6, SYNTAX_CONSTANT},{"animation-delay:", 16, SYNTAX_BUILTIN},{"border-block-start:", 19, SYNTAX_BUILTIN},{"border-radius:", 14, SYNTAX_BUILTIN},{"hwb", 3, SYNTAX_BUILTIN},{"no-change", 9, SYNTAX_CONSTANT},{"@top-center", 11, SYNTAX_KEYWORD},{"transition-property:", 20, SYNTAX_BUILTIN},{"skyblue", 7, SYNTAX_CONSTANT},{"break-after:", 12, SYNTAX_BUILTIN},{"numeric", 7, SYNTAX_CONSTANT},{"double-circle", 13, SYNTAX_CONSTANT},{"animation-fill-mode:", 20, SYNTAX_BUILTIN},{"scroll-snap-type:", 17, SYNTAX_BUILTIN},{"ideographic", 11, SYNTAX_CONSTANT},{"mixed", 5, SYNTAX_CONSTANT},{"newspaper", 9, SYNTAX_CONSTANT},{"border-image-repeat:", 20, SYNTAX_BUILTIN},{"border-inline-start-style:", 26, SYNTAX_BUILTIN},{"acronym", 7, SYNTAX_KEYWORD},{"match-parent", 12, SYNTAX_CONSTANT},{"translateX", 10, SYNTAX_BUILTIN},{"landscape", 9, SYNTAX_CONSTANT},{"s", 1, SYNTAX_KEYWORD},{"drop-shadow", 11, SYNTAX_BUILTIN},{"keep-all", 8, SYNTAX_CONSTANT},{"super", 5, SYNTAX_CONSTANT},{"hard-light", 10, SYNTAX_CONSTANT},{"max-width:", 10, SYNTAX_BUILTIN},{"outset", 6, SYNTAX_CONSTANT},{"downleft", 8, SYNTAX_CONSTANT},{"region", 6, SYNTAX_CONSTANT},{"table-caption", 13, SYNTAX_CONSTANT},{"pointer-events:", 15, SYNTAX_BUILTIN},{"padding-left:", 13, SYNTAX_BUILTIN},{"deeppink", 8, SYNTAX_CONSTANT},{"light", 5, SYNTAX_CONSTANT},{"tr", 2, SYNTAX_KEYWORD},{"sideways-rl", 11, SYNTAX_CONSTANT},{"meta", 4, SYNTAX_KEYWORD},{"wbr", 3, SYNTAX_KEYWORD},{"avoid", 5, SYNTAX_CONSTANT},{"user-zoom:", 10, SYNTAX_BUILTIN},{"inline-grid", 11, SYNTAX_CONSTANT},{"after-edge", 10, SYNTAX_CONSTANT},{"dialog", 6, SYNTAX_KEYWORD},{"leader", 6, SYNTAX_BUILTIN},{"top-outside", 11, SYNTAX_CONSTANT},{"area", 4, SYNTAX_KEYWORD},{"src:", 4, SYNTAX_BUILTIN},{"column-width:", 13, SYNTAX_BUILTIN},{"crosshair", 9, SYNTAX_CONSTANT},{"counter-reset:", 14, SYNTAX_BUILTIN},{"cadetblue", 9, SYNTAX_CONSTANT},{"flip", 4, SYNTAX_CONSTANT},{"sandybrown", 10, SYNTAX_CONSTANT},{"justify-content:", 16, SYNTAX_BUILTIN},{"isolate", 7, SYNTAX_CONSTANT},{"max-inline-size:", 16, SYNTAX_BUILTIN},{"backwards", 9, SYNTAX_CONSTANT},{"contain-intrinsic-size:", 23, SYNTAX_BUILTIN},{"vertical-text", 13, SYNTAX_CONSTANT},{"font-variant-position:", 22, SYNTAX_BUILTIN},{"verso", 5, SYNTAX_CONSTANT},{"samp", 4, SYNTAX_KEYWORD},{"q", 1, SYNTAX_KEYWORD},{"attr", 4, SYNTAX_BUILTIN},{"address", 7, SYNTAX_KEYWORD},{"h4", 2, SYNTAX_KEYWORD},{"repeat", 6, SYNTAX_BUILTIN},{"wavy", 4, SYNTAX_CONSTANT},{"snow", 4, SYNTAX_CONSTANT},{"min-content", 11, SYNTAX_CONSTANT},{"nobr", 4, SYNTAX_KEYWORD},{"path", 4, SYNTAX_BUILTIN},{"plum", 4, SYNTAX_CONSTANT},{"n-resize", 8, SYNTAX_CONSTANT},{"mediumseagreen", 14, SYNTAX_CONSTANT},{"noscript", 8, SYNTAX_KEYWORD},{"menu", 4, SYNTAX_KEYWORD},{"seagreen", 8, SYNTAX_CONSTANT},{"u", 1, SYNTAX_KEYWORD},{"@namespace", 10, SYNTAX_KEYWORD},{"floralwhite", 11, SYNTAX_CONSTANT},{"target-counter", 14, SYNTAX_BUILTIN},{"purple", 6, SYNTAX_CONSTANT},{"ivory", 5, SYNTAX_CONSTANT},{"ne-resize", 9, SYNTAX_CONSTANT},{"@supports", 9, SYNTAX_KEYWORD},{"element", 7, SYNTAX_BUILTIN},{"mediumaquamarine", 16, SYNTAX_CONSTANT},{"linearRGB", 9, SYNTAX_CONSTANT},{"descent-override:", 17, SYNTAX_BUILTIN},{"lime", 4, SYNTAX_CONSTANT},{"visible", 7, SYNTAX_CONSTANT},{"color-burn", 10, SYNTAX_CONSTANT},{"perspective", 11, SYNTAX_BUILTIN},{"progress", 8, SYNTAX_KEYWORD},{"transition:", 11, SYNTAX_BUILTIN},{"will-change:", 12, SYNTAX_BUILTIN},{"cos", 3, SYNTAX_BUILTIN},{"grid-area:", 10, SYNTAX_BUILTIN},{"lightgrey", 9, SYNTAX_CONSTANT},{"strong", 6, SYNTAX_KEYWORD},{"springgreen", 11, SYNTAX_CONSTANT},{"border-start-start-radius:", 26, SYNTAX_BUILTIN},{"lightgoldenrodyellow", 20, SYNTAX_CONSTANT},{"hsla", 4, SYNTAX_BUILTIN},{"min-block-size:", 15, SYNTAX_BUILTIN},{"rgba", 4, SYNTAX_BUILTIN},{"writing-mode:", 13, SYNTAX_BUILTIN},{"use-script", 10, SYNTAX_CONSTANT},{"i", 1, SYNTAX_KEYWORD},{"inset-block:", 12, SYNTAX_BUILTIN},{"grid-auto-columns:", 18, SYNTAX_BUILTIN},{"dimgrey", 7, SYNTAX_CONSTANT},{"darkgrey", 8, SYNTAX_CONSTANT},{"orientation:", 12, SYNTAX_BUILTIN},{"table-column-group", 18, SYNTAX_CONSTANT},{"indigo", 6, SYNTAX_CONSTANT},{"lightyellow", 11, SYNTAX_CONSTANT},{"datalist", 8, SYNTAX_KEYWORD},{"active", 6, SYNTAX_CONSTANT},{"all-petite-caps", 15, SYNTAX_CONSTANT},{"cyclic", 6, SYNTAX_CONSTANT},{"animation-iteration-count:", 26, SYNTAX_BUILTIN},{"scroll-margin-inline-end:", 25, SYNTAX_BUILTIN},{"block-end", 9, SYNTAX_CONSTANT},{"log", 3, SYNTAX_BUILTIN},{"proportional-width", 18, SYNTAX_CONSTANT},{"caret-color:", 12, SYNTAX_BUILTIN},{"condensed", 9, SYNTAX_CONSTANT},{"green", 5, SYNTAX_CONSTANT},{"scrollbar-width:", 16, SYNTAX_BUILTIN},{"image-set", 9, SYNTAX_BUILTIN},{"whitespace", 10, SYNTAX_CONSTANT},{"col-resize", 10, SYNTAX_CONSTANT},{"border-bottom-color:", 20, SYNTAX_BUILTIN},{"embed", 5, SYNTAX_KEYWORD},{"center", 6, SYNTAX_CONSTANT},{"gap:", 4, SYNTAX_BUILTIN},{"svg", 3, SYNTAX_KEYWORD},{"blockquote", 10, SYNTAX_KEYWORD},{"border-right:", 13, SYNTAX_BUILTIN},{"justify-self:", 13, SYNTAX_BUILTIN},{"font-variant-caps:", 18, SYNTAX_BUILTIN},{"soft-light", 10, SYNTAX_CONSTANT},{"overflow-wrap:", 14, SYNTAX_BUILTIN},{"box-decoration-break:", 21, SYNTAX_BUILTIN},{"wrap-reverse", 12, SYNTAX_CONSTANT},{"dl", 2, SYNTAX_KEYWORD},{"column-rule:", 12, SYNTAX_BUILTIN},{"row-severse", 11, SYNTAX_CONSTANT},{"no-drop", 7, SYNTAX_CONSTANT},{"blink", 5, SYNTAX_KEYWORD},{"text-decoration-skip-ink:", 25, SYNTAX_BUILTIN},{"ornaments", 9, SYNTAX_BUILTIN},{"silver", 6, SYNTAX_CONSTANT},{"transition-timing-function:", 27, SYNTAX_BUILTIN},{"palegoldenrod", 13, SYNTAX_CONSTANT},{"olivedrab", 9, SYNTAX_CONSTANT},{"scroll-padding-block:", 21, SYNTAX_BUILTIN},{"groove", 6, SYNTAX_CONSTANT},{"crispEdges", 10, SYNTAX_CONSTANT},{"bold", 4, SYNTAX_CONSTANT},{"luminance", 9, SYNTAX_CONSTANT},{"bullets", 7, SYNTAX_CONSTANT},{"text-emphasis-position:", 23, SYNTAX_BUILTIN},{"lighten", 7, SYNTAX_CONSTANT},{"tab-size:", 9, SYNTAX_BUILTIN},{"margin-right:", 13, SYNTAX_BUILTIN},{"background-image:", 17, SYNTAX_BUILTIN},{"opacity", 7, SYNTAX_BUILTIN},{"each-line", 9, SYNTAX_CONSTANT},{"inline-flex", 11, SYNTAX_CONSTANT},{"inset-inline:", 13, SYNTAX_BUILTIN},{"inline-start", 12, SYNTAX_CONSTANT},{"inline-table", 12, SYNTAX_CONSTANT},{"empty-cells:", 12, SYNTAX_BUILTIN},{"min-zoom:", 9, SYNTAX_BUILTIN},{"white-space:", 12, SYNTAX_BUILTIN},{"margin-trim:", 12, SYNTAX_BUILTIN},{"navy", 4, SYNTAX_CONSTANT},{"darkslategrey", 13, SYNTAX_CONSTANT},{"min-width:", 10, SYNTAX_BUILTIN},{"th", 2, SYNTAX_KEYWORD},{"scaleY", 6, SYNTAX_BUILTIN},{"margin-box", 10, SYNTAX_CONSTANT},{"table-layout:", 13, SYNTAX_BUILTIN},{"border-width:", 13, SYNTAX_BUILTIN},{"text-emphasis-color:", 20, SYNTAX_BUILTIN},{"farthest-side", 13, SYNTAX_CONSTANT},{"visibleFill", 11, SYNTAX_CONSTANT},{"stretch", 7, SYNTAX_CONSTANT},{"grab", 4, SYNTAX_CONSTANT},{"brown", 5, SYNTAX_CONSTANT},{"multiply", 8, SYNTAX_CONSTANT},{"h5", 2, SYNTAX_KEYWORD},{"isolation:", 10, SYNTAX_BUILTIN},{"backface-visibility:", 20, SYNTAX_BUILTIN},{"z-index:", 8, SYNTAX_BUILTIN},{"border-block-style:", 19, SYNTAX_BUILTIN},{"border-left-width:", 18, SYNTAX_BUILTIN},{"list-style:", 11, SYNTAX_BUILTIN},{"font-language-override:", 23, SYNTAX_BUILTIN},{"image-rendering:", 16, SYNTAX_BUILTIN},{"ins", 3, SYNTAX_KEYWORD},{"abbr", 4, SYNTAX_KEYWORD},{"background-attachment:", 22, SYNTAX_BUILTIN},{"list-item", 9, SYNTAX_CONSTANT},{"darkolivegreen", 14, SYNTAX_CONSTANT},{"width:", 6, SYNTAX_BUILTIN},{"strike", 6, SYNTAX_KEYWORD},{"geometricPrecision", 18, SYNTAX_CONSTANT},{"marks:", 6, SYNTAX_BUILTIN},{"counters", 8, SYNTAX_BUILTIN},{"forced-color-adjust:", 20, SYNTAX_BUILTIN},{"available", 9, SYNTAX_CONSTANT},{"narrower", 8, SYNTAX_CONSTANT},{"ultra-condensed", 15, SYNTAX_CONSTANT},{"translate3d", 11, SYNTAX_BUILTIN},{"reversed", 8, SYNTAX_BUILTIN},{"maroon", 6, SYNTAX_CONSTANT},{"lightslategray", 14, SYNTAX_CONSTANT},{"word-wrap:", 10, SYNTAX_BUILTIN},{"line-through", 12, SYNTAX_CONSTANT},{"fill-box", 8, SYNTAX_CONSTANT},{"border-collapse:", 16, SYNTAX_BUILTIN},{"middle", 6, SYNTAX_CONSTANT},{"@ornaments", 10, SYNTAX_KEYWORD},{"spell-out", 9, SYNTAX_CONSTANT},{"historical-forms", 16, SYNTAX_CONSTANT},{"mask-border-mode:", 17, SYNTAX_BUILTIN},{"text-underline-position:", 24, SYNTAX_BUILTIN},{"paused", 6, SYNTAX_CONSTANT},{"page", 4, SYNTAX_CONSTANT},{"mediumturquoise", 15, SYNTAX_CONSTANT},{"margin-top:", 11, SYNTAX_BUILTIN},{"link", 4, SYNTAX_KEYWORD},{"words", 5, SYNTAX_CONSTANT},{"mask-clip:", 10, SYNTAX_BUILTIN},{"menuitem", 8, SYNTAX_KEYWORD},{"align-content:", 14, SYNTAX_BUILTIN},{"del", 3, SYNTAX_KEYWORD},{"border-bottom-width:", 20, SYNTAX_BUILTIN},{"scroll-timeline:", 16, SYNTAX_BUILTIN},{"hr", 2, SYNTAX_KEYWORD},{"sesame", 6, SYNTAX_CONSTANT},{"text-decoration-line:", 21, SYNTAX_BUILTIN},{"round", 5, SYNTAX_CONSTANT},{"border-top-width:", 17, SYNTAX_BUILTIN},{"scroll-timeline-axis:", 21, SYNTAX_BUILTIN},{"stroke", 6, SYNTAX_CONSTANT},{"unicode-bidi:", 13, SYNTAX_BUILTIN},{"prefix:", 7, SYNTAX_BUILTIN},{"font-variation-settings:", 24, SYNTAX_BUILTIN},{"nonzero", 7, SYNTAX_CONSTANT},{"saturate", 8, SYNTAX_BUILTIN},{"line-clamp:", 11, SYNTAX_BUILTIN},{"grid:", 5, SYNTAX_BUILTIN},{"fallback:", 9, SYNTAX_BUILTIN},{"justify", 7, SYNTAX_CONSTANT},{"rotateX", 7, SYNTAX_BUILTIN},{"grid-column:", 12, SYNTAX_BUILTIN},{"scale-down", 10, SYNTAX_CONSTANT},{"atan2", 5, SYNTAX_BUILTIN},{"oblique", 7, SYNTAX_CONSTANT},{"mask-border:", 12, SYNTAX_BUILTIN},{"paleturquoise", 13, SYNTAX_CONSTANT},{"sideways", 8, SYNTAX_CONSTANT},{"scroll-padding-top:", 19, SYNTAX_BUILTIN},{"script", 6, SYNTAX_KEYWORD},{"left", 4, SYNTAX_CONSTANT},{"seashell", 8, SYNTAX_CONSTANT},{"border-image-width:", 19, SYNTAX_BUILTIN},{"sqrt", 4, SYNTAX_BUILTIN},{"block", 5, SYNTAX_CONSTANT},{"bdi", 3, SYNTAX_KEYWORD},{"blur", 4, SYNTAX_BUILTIN},{"lightcoral", 10, SYNTAX_CONSTANT},{"palevioletred", 13, SYNTAX_CONSTANT},{"text-emphasis:", 14, SYNTAX_BUILTIN},{"scroll-padding-left:", 20, SYNTAX_BUILTIN},{"gold", 4, SYNTAX_CONSTANT},{"border-inline-end-width:", 24, SYNTAX_BUILTIN},{"offset-distance:", 16, SYNTAX_BUILTIN},{"kbd", 3, SYNTAX_KEYWORD},{"sideways-left", 13, SYNTAX_CONSTANT},{"grid-row:", 9, SYNTAX_BUILTIN},{"ultra-expanded", 14, SYNTAX_CONSTANT},{"azure", 5, SYNTAX_CONSTANT},{"@font-feature-values", 20, SYNTAX_KEYWORD},{"mask-border-width:", 18, SYNTAX_BUILTIN},{"scale3d", 7, SYNTAX_BUILTIN},{"sup", 3, SYNTAX_KEYWORD},{"linear", 6, SYNTAX_CONSTANT},{"disc", 4, SYNTAX_CONSTANT},{"border-inline:", 14, SYNTAX_BUILTIN},{"slot", 4, SYNTAX_KEYWORD},{"time", 4, SYNTAX_KEYWORD},{"farthest-corner", 15, SYNTAX_CONSTANT},{"dd", 2, SYNTAX_KEYWORD},{"mediumspringgreen", 17, SYNTAX_CONSTANT},{"separate", 8, SYNTAX_CONSTANT},{"exclude", 7, SYNTAX_CONSTANT},{"avoid-column", 12, SYNTAX_CONSTANT},{"inherit", 7, SYNTAX_CONSTANT},{"fieldset", 8, SYNTAX_KEYWORD},{"tt", 2, SYNTAX_KEYWORD},{"text-align-last:", 16, SYNTAX_BUILTIN},{"hanging-punctuation:", 20, SYNTAX_BUILTIN},{"object", 6, SYNTAX_KEYWORD},{"ideograph-numeric", 17, SYNTAX_CONSTANT},{"border-image-outset:", 20, SYNTAX_BUILTIN},{"invert", 6, SYNTAX_BUILTIN},{"ol", 2, SYNTAX_KEYWORD},{"legend", 6, SYNTAX_KEYWORD},{"ruby-base", 9, SYNTAX_CONSTANT},{"above", 5, SYNTAX_CONSTANT},{"header", 6, SYNTAX_KEYWORD},{"left:", 5, SYNTAX_BUILTIN},{"space", 5, SYNTAX_CONSTANT},{"data", 4, SYNTAX_KEYWORD},{"padding-inline-start:", 21, SYNTAX_BUILTIN},{"aliceblue", 9, SYNTAX_CONSTANT},{"text-decoration-skip:", 21, SYNTAX_BUILTIN},{"space-evenly", 12, SYNTAX_CONSTANT},{"simplified", 10, SYNTAX_CONSTANT},{"h2", 2, SYNTAX_KEYWORD},{"keygen", 6, SYNTAX_KEYWORD},{"border-left-color:", 18, SYNTAX_BUILTIN},{"cursor:", 7, SYNTAX_BUILTIN},{"border-end-end-radius:", 22, SYNTAX_BUILTIN},{"column-span:", 12, SYNTAX_BUILTIN},{"span", 4, SYNTAX_KEYWORD},{"style", 5, SYNTAX_CONSTANT},{"word-spacing:", 13, SYNTAX_BUILTIN},{"collapse", 8, SYNTAX_CONSTANT},{"status-bar", 10, SYNTAX_CONSTANT},{"no-common-ligatures", 19, SYNTAX_CONSTANT},{"step-end", 8, SYNTAX_CONSTANT},{"border-block-end-style:", 23, SYNTAX_BUILTIN},{"translateY", 10, SYNTAX_BUILTIN},{"auto", 4, SYNTAX_CONSTANT},{"proximity", 9, SYNTAX_CONSTANT},{"lr", 2, SYNTAX_CONSTANT},{"content", 7, SYNTAX_KEYWORD},{"mediumpurple", 12, SYNTAX_CONSTANT},{"close-quote", 11, SYNTAX_CONSTANT},{"rotateZ", 7, SYNTAX_BUILTIN},{"li", 2, SYNTAX_KEYWORD},{"linear-gradient", 15, SYNTAX_BUILTIN},{"default", 7, SYNTAX_CONSTANT},{"exp", 3, SYNTAX_BUILTIN},{"lighter", 7, SYNTAX_CONSTANT},{"content-visibility:", 19, SYNTAX_BUILTIN},{"wrap", 4, SYNTAX_CONSTANT},{"gray", 4, SYNTAX_CONSTANT},{"button", 6, SYNTAX_KEYWORD},{"zero", 4, SYNTAX_CONSTANT},{"scaleZ", 6, SYNTAX_BUILTIN},{"orphans:", 8, SYNTAX_BUILTIN},{"inside", 6, SYNTAX_CONSTANT},{"border-inline-color:", 20, SYNTAX_BUILTIN},{"shadow", 6, SYNTAX_KEYWORD},{"evenodd", 7, SYNTAX_CONSTANT},{"styleset", 8, SYNTAX_BUILTIN},{"mask-repeat:", 12, SYNTAX_BUILTIN},{"grid-auto-flow:", 15, SYNTAX_BUILTIN},{"hidden", 6, SYNTAX_CONSTANT},{"mediumvioletred", 15, SYNTAX_CONSTANT},{"dir", 3, SYNTAX_KEYWORD},{"ghostwhite", 10, SYNTAX_CONSTANT},{"font-style:", 11, SYNTAX_BUILTIN},{"limegreen", 9, SYNTAX_CONSTANT},{"content:", 8, SYNTAX_BUILTIN},{"open", 4, SYNTAX_CONSTANT},{"ruby-base-container", 19, SYNTAX_CONSTANT},{"alternate-reverse", 17, SYNTAX_CONSTANT},{"option", 6, SYNTAX_KEYWORD},{"inline", 6, SYNTAX_CONSTANT},{"column-rule-color:", 18, SYNTAX_BUILTIN},{"text-combine-upright:", 21, SYNTAX_BUILTIN},{"brightness", 10, SYNTAX_BUILTIN},{"transparent", 11, SYNTAX_CONSTANT},{"aside", 5, SYNTAX_KEYWORD},{"pan-down", 8, SYNTAX_CONSTANT},{"font-family:", 12, SYNTAX_BUILTIN},{"font-kerning:", 13, SYNTAX_BUILTIN},{"user-select:", 12, SYNTAX_BUILTIN},{"linen", 5, SYNTAX_CONSTANT},{"resize:", 7, SYNTAX_BUILTIN},{"over", 4, SYNTAX_CONSTANT},{"no-repeat", 9, SYNTAX_CONSTANT},{"border-start-end-radius:", 24, SYNTAX_BUILTIN},{"html", 4, SYNTAX_KEYWORD},{"scroll-margin-block-start:", 26, SYNTAX_BUILTIN},{"overscroll-behavior-inline:", 27, SYNTAX_BUILTIN},{"overflow-clip-margin:", 21, SYNTAX_BUILTIN},{"ruby", 4, SYNTAX_KEYWORD},{"mask-origin:", 12, SYNTAX_BUILTIN},{"mark", 4, SYNTAX_KEYWORD},{"td", 2, SYNTAX_KEYWORD},{"!important", 10, SYNTAX_CONSTANT},{"darkgoldenrod", 13, SYNTAX_CONSTANT},{"meter", 5, SYNTAX_KEYWORD},{"lightslategrey", 14, SYNTAX_CONSTANT},{"input", 5, SYNTAX_KEYWORD},{"scroll-margin-block:", 20, SYNTAX_BUILTIN},{"scroll-margin-right:", 20, SYNTAX_BUILTIN},{"common-ligatures", 16, SYNTAX_CONSTANT},{"yellowgreen", 11, SYNTAX_CONSTANT},{"space-between", 13, SYNTAX_CONSTANT},{"central", 7, SYNTAX_CONSTANT},{"distribute-letter", 17, SYNTAX_CONSTANT},{"font-optical-sizing:", 20, SYNTAX_BUILTIN},{"hue", 3, SYNTAX_CONSTANT},{"inherits:", 9, SYNTAX_BUILTIN},{"bevel", 5, SYNTAX_CONSTANT},{"scroll", 6, SYNTAX_BUILTIN},{"numbers", 7, SYNTAX_CONSTANT},{"mix-blend-mode:", 15, SYNTAX_BUILTIN},{"column-gap:", 11, SYNTAX_BUILTIN},{"orchid", 6, SYNTAX_CONSTANT},{"content-box", 11, SYNTAX_CONSTANT},{"closest-side", 12, SYNTAX_CONSTANT},{"manipulation", 12, SYNTAX_CONSTANT},{"orangered", 9, SYNTAX_CONSTANT},{"context-menu", 12, SYNTAX_CONSTANT},{"mask-type:", 10, SYNTAX_BUILTIN},{"initial-letter:", 15, SYNTAX_BUILTIN},{"ordinal", 7, SYNTAX_CONSTANT},{"clip:", 5, SYNTAX_BUILTIN},{"inline-block", 12, SYNTAX_CONSTANT},{"order:", 6, SYNTAX_BUILTIN},{"local", 5, SYNTAX_BUILTIN},{"cross-fade", 10, SYNTAX_BUILTIN},{"darkmagenta", 11, SYNTAX_CONSTANT},{"powderblue", 10, SYNTAX_CONSTANT},{"tomato", 6, SYNTAX_CONSTANT},{"aquamarine", 10, SYNTAX_CONSTANT},{"rotate", 6, SYNTAX_BUILTIN},{"auto-pos", 8, SYNTAX_CONSTANT},{"additive", 8, SYNTAX_CONSTANT},{"@swash", 6, SYNTAX_KEYWORD},{"blueviolet", 10, SYNTAX_CONSTANT},{"proportional-nums", 17, SYNTAX_CONSTANT},{"mediumblue", 10, SYNTAX_CONSTANT},{"repeating-radial-gradient", 25, SYNTAX_BUILTIN},{"scroll-timeline-name:", 21, SYNTAX_BUILTIN},{"semi-condensed", 14, SYNTAX_CONSTANT},{"sepia", 5, SYNTAX_BUILTIN},{"isolate-override", 16, SYNTAX_CONSTANT},{"sin", 3, SYNTAX_BUILTIN},{"align-items:", 12, SYNTAX_BUILTIN},{"text-emphasis-style:", 20, SYNTAX_BUILTIN},{"flex-grow:", 10, SYNTAX_BUILTIN},{"audio", 5, SYNTAX_KEYWORD},{"border-bottom:", 14, SYNTAX_BUILTIN},{"@stylistic", 10, SYNTAX_KEYWORD},{"bidi-override", 13, SYNTAX_CONSTANT},{"add", 3, SYNTAX_CONSTANT},{"turquoise", 9, SYNTAX_CONSTANT},{"black", 5, SYNTAX_CONSTANT},{"ruby-merge:", 11, SYNTAX_BUILTIN},{"border-block-start-style:", 25, SYNTAX_BUILTIN},{"contain:", 8, SYNTAX_BUILTIN},{"caret:", 6, SYNTAX_BUILTIN},{"baseline", 8, SYNTAX_CONSTANT},{"lemonchiffon", 12, SYNTAX_CONSTANT},{"hgroup", 6, SYNTAX_KEYWORD},{"cite", 4, SYNTAX_KEYWORD},{"border-inline-start-color:", 26, SYNTAX_BUILTIN},{"bgsound", 7, SYNTAX_KEYWORD},{"animation-play-state:", 21, SYNTAX_BUILTIN},{"line", 4, SYNTAX_CONSTANT},{"jis90", 5, SYNTAX_CONSTANT},{"negative:", 9, SYNTAX_BUILTIN},{"margin-bottom:", 14, SYNTAX_BUILTIN},{"grid-template-rows:", 19, SYNTAX_BUILTIN},{"font-size:", 10, SYNTAX_BUILTIN},{"background-position:", 20, SYNTAX_BUILTIN},{"subtract", 8, SYNTAX_CONSTANT},{"@property", 9, SYNTAX_KEYWORD},{"symbolic", 8, SYNTAX_CONSTANT},{"optimizeLegibility", 18, SYNTAX_CONSTANT},{"font-weight:", 12, SYNTAX_BUILTIN},{"xx-small", 8, SYNTAX_CONSTANT},{"font-variant-ligatures:", 23, SYNTAX_BUILTIN},{"reverse", 7, SYNTAX_CONSTANT},{"lavender", 8, SYNTAX_CONSTANT},{"pre", 3, SYNTAX_KEYWORD},{"col", 3, SYNTAX_KEYWORD},{"preserve-3d", 11, SYNTAX_CONSTANT},{"x-large", 7, SYNTAX_CONSTANT},{"backdrop-filter:", 16, SYNTAX_BUILTIN},{"salmon", 6, SYNTAX_CONSTANT},{"alpha", 5, SYNTAX_CONSTANT},{"dense", 5, SYNTAX_CONSTANT},{"counter-increment:", 18, SYNTAX_BUILTIN},{"upright", 7, SYNTAX_CONSTANT},{"royalblue", 9, SYNTAX_CONSTANT},{"discretionary-ligatures", 23, SYNTAX_CONSTANT},{"@right-bottom", 13, SYNTAX_KEYWORD},{"cubic-bezier", 12, SYNTAX_BUILTIN},{"all:", 4, SYNTAX_BUILTIN},{"scroll-margin-inline:", 21, SYNTAX_BUILTIN},{"flex-shrink:", 12, SYNTAX_BUILTIN},{"background-origin:", 18, SYNTAX_BUILTIN},{"both", 4, SYNTAX_CONSTANT},{"conic-gradient", 14, SYNTAX_BUILTIN},{"padding-block:", 14, SYNTAX_BUILTIN},{"rotateY", 7, SYNTAX_BUILTIN},{"sticky", 6, SYNTAX_CONSTANT},{"@layer", 6, SYNTAX_KEYWORD},{"margin-left:", 12, SYNTAX_BUILTIN},{"clone", 5, SYNTAX_CONSTANT},{"border-color:", 13, SYNTAX_BUILTIN},{"line-height-step:", 17, SYNTAX_BUILTIN},{"mod", 3, SYNTAX_BUILTIN},{"ruby-text", 9, SYNTAX_CONSTANT},{"block-size:", 11, SYNTAX_BUILTIN},{"dt", 2, SYNTAX_KEYWORD},{"target-text", 11, SYNTAX_BUILTIN},{"min-inline-size:", 16, SYNTAX_BUILTIN},{"oldstyle-nums", 13, SYNTAX_CONSTANT},{"darkslateblue", 13, SYNTAX_CONSTANT},{"traditional", 11, SYNTAX_CONSTANT},{"solid", 5, SYNTAX_CONSTANT},{"transform-box:", 14, SYNTAX_BUILTIN},{"small", 5, SYNTAX_CONSTANT},{"article", 7, SYNTAX_KEYWORD},{"input-security:", 15, SYNTAX_BUILTIN},{"frame", 5, SYNTAX_KEYWORD},{"exact", 5, SYNTAX_CONSTANT},{"background-clip:", 16, SYNTAX_BUILTIN},{"object-fit:", 11, SYNTAX_BUILTIN},{"noframes", 8, SYNTAX_KEYWORD},{"table-row", 9, SYNTAX_CONSTANT},{"slice", 5, SYNTAX_CONSTANT},{"map", 3, SYNTAX_KEYWORD},{"inter-word", 10, SYNTAX_CONSTANT},{"table", 5, SYNTAX_KEYWORD},{"rect", 4, SYNTAX_BUILTIN},{"fuchsia", 7, SYNTAX_CONSTANT},{"lab", 3, SYNTAX_BUILTIN},{"grid-template:", 14, SYNTAX_BUILTIN},{"all-scroll", 10, SYNTAX_CONSTANT},{"outline-style:", 14, SYNTAX_BUILTIN},{"grayscale", 9, SYNTAX_BUILTIN},{"place-self:", 11, SYNTAX_BUILTIN},{"min", 3, SYNTAX_BUILTIN},{"inset-block-end:", 16, SYNTAX_BUILTIN},{"border-inline-end:", 18, SYNTAX_BUILTIN},{"body", 4, SYNTAX_KEYWORD},{"upleft", 6, SYNTAX_CONSTANT},{"padding-top:", 12, SYNTAX_BUILTIN},{"match-source", 12, SYNTAX_CONSTANT},{"unset", 5, SYNTAX_CONSTANT},{"padding:", 8, SYNTAX_BUILTIN},{"max-block-size:", 15, SYNTAX_BUILTIN},{"line-edge", 9, SYNTAX_CONSTANT},{"digits", 6, SYNTAX_CONSTANT},{"border-bottom-style:", 20, SYNTAX_BUILTIN},{"table-footer-group", 18, SYNTAX_CONSTANT},{"border-inline-end-style:", 24, SYNTAX_BUILTIN},{"range:", 6, SYNTAX_BUILTIN},{"outside", 7, SYNTAX_CONSTANT},{"overflow-block:", 15, SYNTAX_BUILTIN},{"smooth", 6, SYNTAX_CONSTANT},{"appearance:", 11, SYNTAX_BUILTIN},{"border-block-width:", 19, SYNTAX_BUILTIN},{"border-left:", 12, SYNTAX_BUILTIN},{"track", 5, SYNTAX_KEYWORD},{"contain-intrinsic-width:", 24, SYNTAX_BUILTIN},{"format", 6, SYNTAX_BUILTIN},{"swash", 5, SYNTAX_BUILTIN},{"border-right-width:", 19, SYNTAX_BUILTIN},{"-webkit-line-clamp:", 19, SYNTAX_BUILTIN},{"color-dodge", 11, SYNTAX_CONSTANT},{"x-small", 7, SYNTAX_CONSTANT},{"border-top-left-radius:", 23, SYNTAX_BUILTIN},{"tb", 2, SYNTAX_CONSTANT},{"vertical", 8, SYNTAX_CONSTANT},{"pan-y", 5, SYNTAX_CONSTANT},{"gainsboro", 9, SYNTAX_CONSTANT},{"vertical-lr", 11, SYNTAX_CONSTANT},{"color-scheme:", 13, SYNTAX_BUILTIN},{"overflow-inline:", 16, SYNTAX_BUILTIN},{"@scroll-timeline", 16, SYNTAX_KEYWORD},{"lightsteelblue", 14, SYNTAX_CONSTANT},{"border:", 7, SYNTAX_BUILTIN},{"move", 4, SYNTAX_CONSTANT},{"transform-style:", 16, SYNTAX_BUILTIN},{"extra-expanded", 14, SYNTAX_CONSTANT},{"margin-inline-start:", 20, SYNTAX_BUILTIN},{"math-depth:", 11, SYNTAX_BUILTIN},{"ns-resize", 9, SYNTAX_CONSTANT},{"br", 2, SYNTAX_KEYWORD},{"text-before-edge", 16, SYNTAX_CONSTANT},{"transition-duration:", 20, SYNTAX_BUILTIN},{"math-style:", 11, SYNTAX_BUILTIN},{"max-content", 11, SYNTAX_CONSTANT},{"no-open-quote", 13, SYNTAX_CONSTANT},{"border-inline-end-color:", 24, SYNTAX_BUILTIN},{"image-resolution:", 17, SYNTAX_BUILTIN},{"closest-corner", 14, SYNTAX_CONSTANT},{"border-style:", 13, SYNTAX_BUILTIN},{"main", 4, SYNTAX_KEYWORD},{"list-style-image:", 17, SYNTAX_BUILTIN},{"overflow:", 9, SYNTAX_BUILTIN},{"georgian", 8, SYNTAX_CONSTANT},{"border-inline-style:", 20, SYNTAX_BUILTIN},{"letter-spacing:", 15, SYNTAX_BUILTIN},{"ease", 4, SYNTAX_CONSTANT},{"border-bottom-right-radius:", 27, SYNTAX_BUILTIN},{"noembed", 7, SYNTAX_KEYWORD},{"transition-delay:", 17, SYNTAX_BUILTIN},{"line-height:", 12, SYNTAX_BUILTIN},{"orange", 6, SYNTAX_CONSTANT},{"iframe", 6, SYNTAX_KEYWORD},{"dfn", 3, SYNTAX_KEYWORD},{"thead", 5, SYNTAX_KEYWORD},{"butt", 4, SYNTAX_CONSTANT},{"max", 3, SYNTAX_BUILTIN},{"lightseagreen", 13, SYNTAX_CONSTANT},{"not-allowed", 11, SYNTAX_CONSTANT},{"compact", 7, SYNTAX_CONSTANT},{"mistyrose", 9, SYNTAX_CONSTANT},{"help", 4, SYNTAX_CONSTANT},{"label", 5, SYNTAX_KEYWORD},{"offset:", 7, SYNTAX_BUILTIN},{"mediumslateblue", 15, SYNTAX_CONSTANT},{"background-size:", 16, SYNTAX_BUILTIN},{"mask-border-outset:", 19, SYNTAX_BUILTIN},{"box-sizing:", 11, SYNTAX_BUILTIN},{"sienna", 6, SYNTAX_CONSTANT},{"scroll-behavior:", 16, SYNTAX_BUILTIN},{"hyphenate-character:", 20, SYNTAX_BUILTIN},{"contain-intrinsic-height:", 25, SYNTAX_BUILTIN},{"font-variant-alternates:", 24, SYNTAX_BUILTIN},{"line-break:", 11, SYNTAX_BUILTIN},{"lavenderblush", 13, SYNTAX_CONSTANT},{"offset-rotate:", 14, SYNTAX_BUILTIN},{"font", 4, SYNTAX_KEYWORD},{"outline-width:", 14, SYNTAX_BUILTIN},{"slategray", 9, SYNTAX_CONSTANT},{"copy", 4, SYNTAX_CONSTANT},{"fill-available", 14, SYNTAX_CONSTANT},{"border-bottom-left-radius:", 26, SYNTAX_BUILTIN},{"blue", 4, SYNTAX_CONSTANT},{"font-variant-numeric:", 21, SYNTAX_BUILTIN},{"bolder", 6, SYNTAX_CONSTANT},{"sw-resize", 9, SYNTAX_CONSTANT},{"translate", 9, SYNTAX_BUILTIN},{"grid-template-areas:", 20, SYNTAX_BUILTIN},{"cyan", 4, SYNTAX_CONSTANT},{"disabled", 8, SYNTAX_CONSTANT},{"footer", 6, SYNTAX_KEYWORD},{"matrix3d", 8, SYNTAX_BUILTIN},{"nesw-resize", 11, SYNTAX_CONSTANT},{"rem", 3, SYNTAX_BUILTIN},{"saturation", 10, SYNTAX_CONSTANT},{"italic", 6, SYNTAX_CONSTANT},{"thin", 4, SYNTAX_CONSTANT},{"xx-large", 8, SYNTAX_CONSTANT},{"border-block-color:", 19, SYNTAX_BUILTIN},{"ellipse", 7, SYNTAX_BUILTIN},{"font:", 5, SYNTAX_BUILTIN},{"progressive", 11, SYNTAX_CONSTANT},{"overscroll-behavior-x:", 22, SYNTAX_BUILTIN},{"distribute", 10, SYNTAX_CONSTANT},{"inter-ideograph", 15, SYNTAX_CONSTANT},{"visibility:", 11, SYNTAX_BUILTIN},{"b", 1, SYNTAX_KEYWORD},{"sRGB", 4, SYNTAX_CONSTANT},{"overlay", 7, SYNTAX_CONSTANT},{"darkkhaki", 9, SYNTAX_CONSTANT},{"url", 3, SYNTAX_BUILTIN},{"skewX", 5, SYNTAX_BUILTIN},{"from-image", 10, SYNTAX_CONSTANT},{"frameset", 8, SYNTAX_KEYWORD},{"open-quote", 10, SYNTAX_CONSTANT},{"system:", 7, SYNTAX_BUILTIN},{"ellipsis", 8, SYNTAX_CONSTANT},{"justify-tracks:", 15, SYNTAX_BUILTIN},{"subpixel-antialiased", 20, SYNTAX_CONSTANT},{"mintcream", 9, SYNTAX_CONSTANT},{"template", 8, SYNTAX_KEYWORD},{"title", 5, SYNTAX_KEYWORD},{"syntax:", 7, SYNTAX_BUILTIN},{"scroll-padding-right:", 21, SYNTAX_BUILTIN},{"nowrap", 6, SYNTAX_CONSTANT},{"applet", 6, SYNTAX_KEYWORD},{"text-decoration:", 16, SYNTAX_BUILTIN},{"symbols", 7, SYNTAX_BUILTIN},{"plaintext", 9, SYNTAX_CONSTANT},{"painted", 7, SYNTAX_CONSTANT},{"bdo", 3, SYNTAX_KEYWORD},{"olive", 5, SYNTAX_CONSTANT},{"darkblue", 8, SYNTAX_CONSTANT},{"pointer", 7, SYNTAX_CONSTANT},{"paint", 5, SYNTAX_BUILTIN},{"sideways-right", 14, SYNTAX_CONSTANT},{"transform-origin:", 17, SYNTAX_BUILTIN},{"grid-column-start:", 18, SYNTAX_BUILTIN},{"s-resize", 8, SYNTAX_CONSTANT},{"grid-row-end:", 13, SYNTAX_BUILTIN},{"break-word", 10, SYNTAX_CONSTANT},{"lightblue", 9, SYNTAX_CONSTANT},{"firebrick", 9, SYNTAX_CONSTANT},{"nearest-neighbor", 16, SYNTAX_CONSTANT},{"jis78", 5, SYNTAX_CONSTANT},{"@keyframes", 10, SYNTAX_KEYWORD},{"zoom-out", 8, SYNTAX_CONSTANT},{"clear:", 6, SYNTAX_BUILTIN},{"lowercase", 9, SYNTAX_CONSTANT},{"type", 4, SYNTAX_BUILTIN},{"border-right-color:", 19, SYNTAX_BUILTIN},{"var", 3, SYNTAX_BUILTIN},{"extends", 7, SYNTAX_CONSTANT},{"subgrid", 7, SYNTAX_CONSTANT},{"mandatory", 9, SYNTAX_CONSTANT},{"scroll-margin-bottom:", 21, SYNTAX_BUILTIN},{"capitalize", 10, SYNTAX_CONSTANT},{"scrollbar-color:", 16, SYNTAX_BUILTIN},{"align-self:", 11, SYNTAX_BUILTIN},{"remove", 6, SYNTAX_CONSTANT},{"horizontal", 10, SYNTAX_CONSTANT},{"skewY", 5, SYNTAX_BUILTIN},{"navajowhite", 11, SYNTAX_CONSTANT},{"ltr", 3, SYNTAX_CONSTANT},{"mask-image:", 11, SYNTAX_BUILTIN},{"animation-name:", 15, SYNTAX_BUILTIN},{"inset-inline-end:", 17, SYNTAX_BUILTIN},{"diagonal-fractions", 18, SYNTAX_CONSTANT},{"burlywood", 9, SYNTAX_CONSTANT},{"animation-duration:", 19, SYNTAX_BUILTIN},{"offset-anchor:", 14, SYNTAX_BUILTIN},{"hyphenate-limit-chars:", 22, SYNTAX_BUILTIN},{"pan-left", 8, SYNTAX_CONSTANT},{"scroll-padding-block-start:", 27, SYNTAX_BUILTIN},{"sign", 4, SYNTAX_BUILTIN},{"@styleset", 9, SYNTAX_KEYWORD},{"mask-position:", 14, SYNTAX_BUILTIN},{"break-all", 9, SYNTAX_CONSTANT},{"ascent-override:", 16, SYNTAX_BUILTIN},{"slategrey", 9, SYNTAX_CONSTANT},{"video", 5, SYNTAX_KEYWORD},{"inset-inline-start:", 19, SYNTAX_BUILTIN},{"space-around", 12, SYNTAX_CONSTANT},{"ideograph-space", 15, SYNTAX_CONSTANT},{"@charset", 8, SYNTAX_KEYWORD},{"rb", 2, SYNTAX_KEYWORD},{"margin-inline:", 14, SYNTAX_BUILTIN},{"text-top", 8, SYNTAX_CONSTANT},{"text-shadow:", 12, SYNTAX_BUILTIN},{"mask:", 5, SYNTAX_BUILTIN},{"smaller", 7, SYNTAX_CONSTANT},{"darkgray", 8, SYNTAX_CONSTANT},{"flow-root", 9, SYNTAX_CONSTANT},{"crisp-edges", 11, SYNTAX_CONSTANT},{"filter:", 7, SYNTAX_BUILTIN},{"animation-direction:", 20, SYNTAX_BUILTIN},{"border-block-end:", 17, SYNTAX_BUILTIN},{"flex-direction:", 15, SYNTAX_BUILTIN},{"margin-block:", 13, SYNTAX_BUILTIN},{"lightgray", 9, SYNTAX_CONSTANT},{"touch", 5, SYNTAX_CONSTANT},{"dashed", 6, SYNTAX_CONSTANT},{"honeydew", 8, SYNTAX_CONSTANT},{"layer", 5, SYNTAX_BUILTIN},{"optional", 8, SYNTAX_CONSTANT},{"antialiased", 11, SYNTAX_CONSTANT},{"antiquewhite", 12, SYNTAX_CONSTANT},{"screen", 6, SYNTAX_CONSTANT},{"font-stretch:", 13, SYNTAX_BUILTIN},{"calc", 4, SYNTAX_BUILTIN},{"list-style-position:", 20, SYNTAX_BUILTIN},{"object-position:", 16, SYNTAX_BUILTIN},{"matrix", 6, SYNTAX_BUILTIN},{"spacer", 6, SYNTAX_KEYWORD},{"beige", 5, SYNTAX_CONSTANT},{"quotes:", 7, SYNTAX_BUILTIN},{"rosybrown", 9, SYNTAX_CONSTANT},{"nw-resize", 9, SYNTAX_CONSTANT},{"image-orientation:", 18, SYNTAX_BUILTIN},{"div", 3, SYNTAX_KEYWORD},{"saddlebrown", 11, SYNTAX_CONSTANT},{"animation-timing-function:", 26, SYNTAX_BUILTIN},{"background:", 11, SYNTAX_BUILTIN},{"hanging", 7, SYNTAX_CONSTANT},{"skew", 4, SYNTAX_BUILTIN},{"margin-block-start:", 19, SYNTAX_BUILTIN},{"balance", 7, SYNTAX_CONSTANT},{"teal", 4, SYNTAX_CONSTANT},{"visiblePainted", 14, SYNTAX_CONSTANT},{"pink", 4, SYNTAX_CONSTANT},{"direction:", 10, SYNTAX_BUILTIN},{"rl", 2, SYNTAX_CONSTANT},{"supports", 8, SYNTAX_BUILTIN},{"mask-mode:", 10, SYNTAX_BUILTIN},{"@character-variant", 18, SYNTAX_KEYWORD},{"text-justify:", 13, SYNTAX_BUILTIN},{"bottom", 6, SYNTAX_CONSTANT},{"inactive", 8, SYNTAX_CONSTANT},{"border-inline-start:", 20, SYNTAX_BUILTIN},{"overflow-anchor:", 16, SYNTAX_BUILTIN},{"nwse-resize", 11, SYNTAX_CONSTANT},{"optimizeQuality", 15, SYNTAX_CONSTANT},{"steelblue", 9, SYNTAX_CONSTANT},{"freeze", 6, SYNTAX_CONSTANT},{"lawngreen", 9, SYNTAX_CONSTANT},{"@viewport", 9, SYNTAX_KEYWORD},{"font-size-adjust:", 17, SYNTAX_BUILTIN},{"miter", 5, SYNTAX_CONSTANT},{"animation-composition:", 22, SYNTAX_BUILTIN},{"annotation", 10, SYNTAX_BUILTIN},{"animation-timeline:", 19, SYNTAX_BUILTIN},{"ridge", 5, SYNTAX_CONSTANT},{"mask-border-source:", 19, SYNTAX_BUILTIN},{"wider", 5, SYNTAX_CONSTANT},{"tan", 3, SYNTAX_BUILTIN},{"repeating-conic-gradient", 24, SYNTAX_BUILTIN},{"margin-inline-end:", 18, SYNTAX_BUILTIN},{"dodgerblue", 10, SYNTAX_CONSTANT},{"max-zoom:", 9, SYNTAX_BUILTIN},{"hue-rotate", 10, SYNTAX_BUILTIN},{"column-fill:", 12, SYNTAX_BUILTIN},{"moccasin", 8, SYNTAX_CONSTANT},{"pre-wrap", 8, SYNTAX_CONSTANT},{"scroll-margin:", 14, SYNTAX_BUILTIN},{"overline", 8, SYNTAX_CONSTANT},{"revert", 6, SYNTAX_CONSTANT},{"font-variant-east-asian:", 24, SYNTAX_BUILTIN},{"outline:", 8, SYNTAX_BUILTIN},{"ul", 2, SYNTAX_KEYWORD},{"dimgray", 7, SYNTAX_CONSTANT},{"rp", 2, SYNTAX_KEYWORD},{"counter-set:", 12, SYNTAX_BUILTIN},{"semi-expanded", 13, SYNTAX_CONSTANT},{"before-edge", 11, SYNTAX_CONSTANT},{"contain-intrinsic-inline-size:", 30, SYNTAX_BUILTIN},{"ease-in-out", 11, SYNTAX_CONSTANT},{"contain-intrinsic-block-size:", 29, SYNTAX_BUILTIN},{"animation:", 10, SYNTAX_BUILTIN},{"kannada", 7, SYNTAX_CONSTANT},{"view-box", 8, SYNTAX_CONSTANT},{"canvas", 6, SYNTAX_KEYWORD},{"pan-x", 5, SYNTAX_CONSTANT},{"@annotation", 11, SYNTAX_KEYWORD},{"padding-bottom:", 15, SYNTAX_BUILTIN},{"border-image-slice:", 19, SYNTAX_BUILTIN},{"recto", 5, SYNTAX_CONSTANT},{"background-position-y:", 22, SYNTAX_BUILTIN},{"table-header-group", 18, SYNTAX_CONSTANT},{"vertical-align:", 15, SYNTAX_BUILTIN},{"font-feature-settings:", 22, SYNTAX_BUILTIN},{"pow", 3, SYNTAX_BUILTIN},{"em", 2, SYNTAX_KEYWORD},{"border-top:", 11, SYNTAX_BUILTIN},{"top", 3, SYNTAX_CONSTANT},{"wait", 4, SYNTAX_CONSTANT},{"zoom-in", 7, SYNTAX_CONSTANT},{"sub", 3, SYNTAX_KEYWORD},{"peachpuff", 9, SYNTAX_CONSTANT},{"border-inline-width:", 20, SYNTAX_BUILTIN},{"bottom:", 7, SYNTAX_BUILTIN},{"darkturquoise", 13, SYNTAX_CONSTANT},{"zoom:", 5, SYNTAX_BUILTIN},{"picture", 7, SYNTAX_KEYWORD},{"scaleX", 6, SYNTAX_BUILTIN},{"mask-size:", 10, SYNTAX_BUILTIN},{"uppercase", 9, SYNTAX_CONSTANT},{"exclusion", 9, SYNTAX_CONSTANT},{"text-decoration-color:", 22, SYNTAX_BUILTIN},{"repeating-linear-gradient", 25, SYNTAX_BUILTIN},{"radial", 6, SYNTAX_CONSTANT},{"goldenrod", 9, SYNTAX_CONSTANT},{"fill", 4, SYNTAX_CONSTANT},{"no-discretionary-ligatures", 26, SYNTAX_CONSTANT},{"white", 5, SYNTAX_CONSTANT},{"luminosity", 10, SYNTAX_CONSTANT},{"math-shift:", 11, SYNTAX_BUILTIN},{"select", 6, SYNTAX_KEYWORD},{"align-tracks:", 13, SYNTAX_BUILTIN},{"sideways-lr", 11, SYNTAX_CONSTANT},{"speak-as:", 9, SYNTAX_BUILTIN},{"border-right-style:", 19, SYNTAX_BUILTIN},{"manual", 6, SYNTAX_CONSTANT},{"row-reverse", 11, SYNTAX_CONSTANT},{"weight", 6, SYNTAX_CONSTANT},{"main-size", 9, SYNTAX_CONSTANT},{"blanchedalmond", 14, SYNTAX_CONSTANT},{"column", 6, SYNTAX_CONSTANT},{"initial", 7, SYNTAX_CONSTANT},{"icon", 4, SYNTAX_CONSTANT},{"forwards", 8, SYNTAX_CONSTANT},{"lch", 3, SYNTAX_BUILTIN},{"block-start", 11, SYNTAX_CONSTANT},{"textarea", 8, SYNTAX_KEYWORD},{"greenyellow", 11, SYNTAX_CONSTANT},{"scroll-snap-stop:", 17, SYNTAX_BUILTIN},{"run-in", 6, SYNTAX_CONSTANT},{"avoid-page", 10, SYNTAX_CONSTANT},{"bottom-outside", 14, SYNTAX_CONSTANT},{"border-image-source:", 20, SYNTAX_BUILTIN},{"vertical-ideographic", 20, SYNTAX_CONSTANT},{"forestgreen", 11, SYNTAX_CONSTANT},{"scroll-padding-inline:", 22, SYNTAX_BUILTIN},{"padding-block-end:", 18, SYNTAX_BUILTIN},{"mediumorchid", 12, SYNTAX_CONSTANT},{"cornsilk", 8, SYNTAX_CONSTANT},{"chocolate", 9, SYNTAX_CONSTANT},{"clamp", 5, SYNTAX_BUILTIN},{"stacked-fractions", 17, SYNTAX_CONSTANT},{"intersect", 9, SYNTAX_CONSTANT},{"offset-path:", 12, SYNTAX_BUILTIN},{"distribute-space", 16, SYNTAX_CONSTANT},{"@historical-forms", 17, SYNTAX_KEYWORD},{"absolute", 8, SYNTAX_CONSTANT},{"contents", 8, SYNTAX_CONSTANT},{"border-block-end-color:", 23, SYNTAX_BUILTIN},{"rotate3d", 8, SYNTAX_BUILTIN},{"outline-color:", 14, SYNTAX_BUILTIN},{"flex-flow:", 10, SYNTAX_BUILTIN},{"ease-out", 8, SYNTAX_CONSTANT},{"grid-column-end:", 16, SYNTAX_BUILTIN},{"x", 1, SYNTAX_CONSTANT},{"alphabetic", 10, SYNTAX_CONSTANT},{"scroll-snap-align:", 18, SYNTAX_BUILTIN},{"grabbing", 8, SYNTAX_CONSTANT},{"darkcyan", 8, SYNTAX_CONSTANT},{"min-height:", 11, SYNTAX_BUILTIN},{"radial-gradient", 15, SYNTAX_BUILTIN},{"hide", 4, SYNTAX_CONSTANT},{"text-indent:", 12, SYNTAX_BUILTIN},{"ease-in", 7, SYNTAX_CONSTANT},{"table-row-group", 15, SYNTAX_CONSTANT},{"suffix:", 7, SYNTAX_BUILTIN},{"flat", 4, SYNTAX_CONSTANT},{"max-height:", 11, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_css[419] = {0,7,31,34,0,0,0,5,7,37,1,25,8,0,0,0,1,4,19,29,93,8,1,0,3,1,2,2,4,12,3,0,1,26,2,126,27,1,31,0,42,29,0,35,3,3,1,2,2,12,0,4,2,3,248,108,2,1,11,54,0,8,21,12,1,2,61,13,0,15,27,0,10,65,0,24,2,240,21,0,0,22,72,0,12,49,10,6,81,19,1,81,1,1,71,1,144,0,0,3,48,21,0,0,1,158,10,5,72,2,11,52,11,68,1,61,7,11,18,8,4,2,5,4,51,26,7,4,50,31,85,166,11,2,0,21,14,8,9,2,5,26,11,148,163,39,39,266,4,58,7,21,74,8,101,147,45,16,1,3,45,2,4,15,8,58,19,9,69,162,24,15,6,47,24,1,0,16,1,6,108,6,0,0,13,1,0,2,0,0,27,63,19,0,55,294,0,63,117,42,18,11,0,44,196,130,18,13,0,59,4,23,4,109,40,3,33,0,1,291,0,8,213,11,19,228,229,45,3,1,26,51,1,12,12,9,7,1,0,16,73,41,16,506,130,2,76,0,534,129,0,0,24,0,0,0,9,2,57,21,520,72,154,12,1,0,517,143,110,22,8,50,39,30,22,7,157,10,0,64,10,65,0,65,38,2,2,72,34,1,76,5,14,91,0,26,53,0,24,38,200,41,62,1,0,19,8,7,16,7,0,22,6,1,309,31,0,33,18,65,41,23,1,2,95,21,1,13,17,134,16,8,43,1,5,98,0,18,234,148,1,2,111,6,9,45,27,132,652,457,40,79,8,9,631,31,157,0,395,553,90,145,116,6,3,6,38,7,27,463,203,29,154,623,564,98,659,119,340,256,578,5,107,1,0,1332,455,18,0,0,65,56,2,21,0,4,152,123,652,55,10,7,96,6,7,0,13,1,106,84,18,0,25,4,0,233,32,572,375};
+static const KeywordTable syntax_all_keywords_css = {
+	syntax_keywords_css, syntax_keyword_displacements_css, 1256, 419, 9,
+	{-6, 9, 2, -2, -14, 1, -3, 4, 5},
+	{0x8c091c95u, 0x1e298797u, 0x1cfab2efu, 0x8b03294du, 0x70a06a91u, 0xb57caea7u, 0xeae2f2b5u, 0x6dad0667u, 0xbd3233dfu}
 };
 
-static const Keyword syntax_keywords_gdscript_A[91] = {{"AABB", SYNTAX_BUILTIN},{"AESContext", SYNTAX_BUILTIN},{"AStar2D", SYNTAX_BUILTIN},{"AStar3D", SYNTAX_BUILTIN},{"AStarGrid2D", SYNTAX_BUILTIN},{"AcceptDialog", SYNTAX_BUILTIN},{"AnimatableBody2D", SYNTAX_BUILTIN},{"AnimatableBody3D", SYNTAX_BUILTIN},{"AnimatedSprite2D", SYNTAX_BUILTIN},{"AnimatedSprite3D", SYNTAX_BUILTIN},{"AnimatedTexture", SYNTAX_BUILTIN},{"Animation", SYNTAX_BUILTIN},{"AnimationLibrary", SYNTAX_BUILTIN},{"AnimationNode", SYNTAX_BUILTIN},{"AnimationNodeAdd2", SYNTAX_BUILTIN},{"AnimationNodeAdd3", SYNTAX_BUILTIN},{"AnimationNodeAnimation", SYNTAX_BUILTIN},{"AnimationNodeBlend2", SYNTAX_BUILTIN},{"AnimationNodeBlend3", SYNTAX_BUILTIN},{"AnimationNodeBlendSpace1D", SYNTAX_BUILTIN},{"AnimationNodeBlendSpace2D", SYNTAX_BUILTIN},{"AnimationNodeBlendTree", SYNTAX_BUILTIN},{"AnimationNodeOneShot", SYNTAX_BUILTIN},{"AnimationNodeOutput", SYNTAX_BUILTIN},{"AnimationNodeStateMachine", SYNTAX_BUILTIN},{"AnimationNodeStateMachinePlayback", SYNTAX_BUILTIN},{"AnimationNodeStateMachineTransition", SYNTAX_BUILTIN},{"AnimationNodeSub2", SYNTAX_BUILTIN},{"AnimationNodeSync", SYNTAX_BUILTIN},{"AnimationNodeTimeScale", SYNTAX_BUILTIN},{"AnimationNodeTimeSeek", SYNTAX_BUILTIN},{"AnimationNodeTransition", SYNTAX_BUILTIN},{"AnimationPlayer", SYNTAX_BUILTIN},{"AnimationRootNode", SYNTAX_BUILTIN},{"AnimationTree", SYNTAX_BUILTIN},{"Area2D", SYNTAX_BUILTIN},{"Area3D", SYNTAX_BUILTIN},{"Array", SYNTAX_BUILTIN},{"ArrayMesh", SYNTAX_BUILTIN},{"ArrayOccluder3D", SYNTAX_BUILTIN},{"AspectRatioContainer", SYNTAX_BUILTIN},{"AtlasTexture", SYNTAX_BUILTIN},{"AudioBusLayout", SYNTAX_BUILTIN},{"AudioEffect", SYNTAX_BUILTIN},{"AudioEffectAmplify", SYNTAX_BUILTIN},{"AudioEffectBandLimitFilter", SYNTAX_BUILTIN},{"AudioEffectBandPassFilter", SYNTAX_BUILTIN},{"AudioEffectCapture", SYNTAX_BUILTIN},{"AudioEffectChorus", SYNTAX_BUILTIN},{"AudioEffectCompressor", SYNTAX_BUILTIN},{"AudioEffectDelay", SYNTAX_BUILTIN},{"AudioEffectDistortion", SYNTAX_BUILTIN},{"AudioEffectEQ", SYNTAX_BUILTIN},{"AudioEffectEQ10", SYNTAX_BUILTIN},{"AudioEffectEQ21", SYNTAX_BUILTIN},{"AudioEffectEQ6", SYNTAX_BUILTIN},{"AudioEffectFilter", SYNTAX_BUILTIN},{"AudioEffectHighPassFilter", SYNTAX_BUILTIN},{"AudioEffectHighShelfFilter", SYNTAX_BUILTIN},{"AudioEffectInstance", SYNTAX_BUILTIN},{"AudioEffectLimiter", SYNTAX_BUILTIN},{"AudioEffectLowPassFilter", SYNTAX_BUILTIN},{"AudioEffectLowShelfFilter", SYNTAX_BUILTIN},{"AudioEffectNotchFilter", SYNTAX_BUILTIN},{"AudioEffectPanner", SYNTAX_BUILTIN},{"AudioEffectPhaser", SYNTAX_BUILTIN},{"AudioEffectPitchShift", SYNTAX_BUILTIN},{"AudioEffectRecord", SYNTAX_BUILTIN},{"AudioEffectReverb", SYNTAX_BUILTIN},{"AudioEffectSpectrumAnalyzer", SYNTAX_BUILTIN},{"AudioEffectSpectrumAnalyzerInstance", SYNTAX_BUILTIN},{"AudioEffectStereoEnhance", SYNTAX_BUILTIN},{"AudioListener2D", SYNTAX_BUILTIN},{"AudioListener3D", SYNTAX_BUILTIN},{"AudioServer", SYNTAX_BUILTIN},{"AudioStream", SYNTAX_BUILTIN},{"AudioStreamGenerator", SYNTAX_BUILTIN},{"AudioStreamGeneratorPlayback", SYNTAX_BUILTIN},{"AudioStreamMP3", SYNTAX_BUILTIN},{"AudioStreamMicrophone", SYNTAX_BUILTIN},{"AudioStreamOggVorbis", SYNTAX_BUILTIN},{"AudioStreamPlayback", SYNTAX_BUILTIN},{"AudioStreamPlaybackOggVorbis", SYNTAX_BUILTIN},{"AudioStreamPlaybackPolyphonic", SYNTAX_BUILTIN},{"AudioStreamPlaybackResampled", SYNTAX_BUILTIN},{"AudioStreamPlayer", SYNTAX_BUILTIN},{"AudioStreamPlayer2D", SYNTAX_BUILTIN},{"AudioStreamPlayer3D", SYNTAX_BUILTIN},{"AudioStreamPolyphonic", SYNTAX_BUILTIN},{"AudioStreamRandomizer", SYNTAX_BUILTIN},{"AudioStreamWAV", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_B[14] = {{"BackBufferCopy", SYNTAX_BUILTIN},{"BaseButton", SYNTAX_BUILTIN},{"BaseMaterial3D", SYNTAX_BUILTIN},{"Basis", SYNTAX_BUILTIN},{"BitMap", SYNTAX_BUILTIN},{"Bone2D", SYNTAX_BUILTIN},{"BoneAttachment3D", SYNTAX_BUILTIN},{"BoneMap", SYNTAX_BUILTIN},{"BoxContainer", SYNTAX_BUILTIN},{"BoxMesh", SYNTAX_BUILTIN},{"BoxOccluder3D", SYNTAX_BUILTIN},{"BoxShape3D", SYNTAX_BUILTIN},{"Button", SYNTAX_BUILTIN},{"ButtonGroup", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_C[77] = {{"CPUParticles2D", SYNTAX_BUILTIN},{"CPUParticles3D", SYNTAX_BUILTIN},{"CSGBox3D", SYNTAX_BUILTIN},{"CSGCombiner3D", SYNTAX_BUILTIN},{"CSGCylinder3D", SYNTAX_BUILTIN},{"CSGMesh3D", SYNTAX_BUILTIN},{"CSGPolygon3D", SYNTAX_BUILTIN},{"CSGPrimitive3D", SYNTAX_BUILTIN},{"CSGShape3D", SYNTAX_BUILTIN},{"CSGSphere3D", SYNTAX_BUILTIN},{"CSGTorus3D", SYNTAX_BUILTIN},{"CSharpScript", SYNTAX_BUILTIN},{"Callable", SYNTAX_BUILTIN},{"CallbackTweener", SYNTAX_BUILTIN},{"Camera2D", SYNTAX_BUILTIN},{"Camera3D", SYNTAX_BUILTIN},{"CameraAttributes", SYNTAX_BUILTIN},{"CameraAttributesPhysical", SYNTAX_BUILTIN},{"CameraAttributesPractical", SYNTAX_BUILTIN},{"CameraFeed", SYNTAX_BUILTIN},{"CameraServer", SYNTAX_BUILTIN},{"CameraTexture", SYNTAX_BUILTIN},{"CanvasGroup", SYNTAX_BUILTIN},{"CanvasItem", SYNTAX_BUILTIN},{"CanvasItemMaterial", SYNTAX_BUILTIN},{"CanvasLayer", SYNTAX_BUILTIN},{"CanvasModulate", SYNTAX_BUILTIN},{"CanvasTexture", SYNTAX_BUILTIN},{"CapsuleMesh", SYNTAX_BUILTIN},{"CapsuleShape2D", SYNTAX_BUILTIN},{"CapsuleShape3D", SYNTAX_BUILTIN},{"CenterContainer", SYNTAX_BUILTIN},{"CharFXTransform", SYNTAX_BUILTIN},{"CharacterBody2D", SYNTAX_BUILTIN},{"CharacterBody3D", SYNTAX_BUILTIN},{"CheckBox", SYNTAX_BUILTIN},{"CheckButton", SYNTAX_BUILTIN},{"CircleShape2D", SYNTAX_BUILTIN},{"ClassDB", SYNTAX_BUILTIN},{"CodeEdit", SYNTAX_BUILTIN},{"CodeHighlighter", SYNTAX_BUILTIN},{"CollisionObject2D", SYNTAX_BUILTIN},{"CollisionObject3D", SYNTAX_BUILTIN},{"CollisionPolygon2D", SYNTAX_BUILTIN},{"CollisionPolygon3D", SYNTAX_BUILTIN},{"CollisionShape2D", SYNTAX_BUILTIN},{"CollisionShape3D", SYNTAX_BUILTIN},{"Color", SYNTAX_BUILTIN},{"ColorPicker", SYNTAX_BUILTIN},{"ColorPickerButton", SYNTAX_BUILTIN},{"ColorRect", SYNTAX_BUILTIN},{"CompressedCubemap", SYNTAX_BUILTIN},{"CompressedCubemapArray", SYNTAX_BUILTIN},{"CompressedTexture2D", SYNTAX_BUILTIN},{"CompressedTexture2DArray", SYNTAX_BUILTIN},{"CompressedTexture3D", SYNTAX_BUILTIN},{"CompressedTextureLayered", SYNTAX_BUILTIN},{"ConcavePolygonShape2D", SYNTAX_BUILTIN},{"ConcavePolygonShape3D", SYNTAX_BUILTIN},{"ConeTwistJoint3D", SYNTAX_BUILTIN},{"ConfigFile", SYNTAX_BUILTIN},{"ConfirmationDialog", SYNTAX_BUILTIN},{"Container", SYNTAX_BUILTIN},{"Control", SYNTAX_BUILTIN},{"ConvexPolygonShape2D", SYNTAX_BUILTIN},{"ConvexPolygonShape3D", SYNTAX_BUILTIN},{"Crypto", SYNTAX_BUILTIN},{"CryptoKey", SYNTAX_BUILTIN},{"Cubemap", SYNTAX_BUILTIN},{"CubemapArray", SYNTAX_BUILTIN},{"Curve", SYNTAX_BUILTIN},{"Curve2D", SYNTAX_BUILTIN},{"Curve3D", SYNTAX_BUILTIN},{"CurveTexture", SYNTAX_BUILTIN},{"CurveXYZTexture", SYNTAX_BUILTIN},{"CylinderMesh", SYNTAX_BUILTIN},{"CylinderShape3D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_D[8] = {{"DTLSServer", SYNTAX_BUILTIN},{"DampedSpringJoint2D", SYNTAX_BUILTIN},{"Decal", SYNTAX_BUILTIN},{"Dictionary", SYNTAX_BUILTIN},{"DirAccess", SYNTAX_BUILTIN},{"DirectionalLight2D", SYNTAX_BUILTIN},{"DirectionalLight3D", SYNTAX_BUILTIN},{"DisplayServer", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_E[55] = {{"ENetConnection", SYNTAX_BUILTIN},{"ENetMultiplayerPeer", SYNTAX_BUILTIN},{"ENetPacketPeer", SYNTAX_BUILTIN},{"EditorCommandPalette", SYNTAX_BUILTIN},{"EditorDebuggerPlugin", SYNTAX_BUILTIN},{"EditorDebuggerSession", SYNTAX_BUILTIN},{"EditorExportPlatform", SYNTAX_BUILTIN},{"EditorExportPlatformAndroid", SYNTAX_BUILTIN},{"EditorExportPlatformIOS", SYNTAX_BUILTIN},{"EditorExportPlatformLinuxBSD", SYNTAX_BUILTIN},{"EditorExportPlatformMacOS", SYNTAX_BUILTIN},{"EditorExportPlatformPC", SYNTAX_BUILTIN},{"EditorExportPlatformWeb", SYNTAX_BUILTIN},{"EditorExportPlatformWindows", SYNTAX_BUILTIN},{"EditorExportPlugin", SYNTAX_BUILTIN},{"EditorFeatureProfile", SYNTAX_BUILTIN},{"EditorFileDialog", SYNTAX_BUILTIN},{"EditorFileSystem", SYNTAX_BUILTIN},{"EditorFileSystemDirectory", SYNTAX_BUILTIN},{"EditorFileSystemImportFormatSupportQuery", SYNTAX_BUILTIN},{"EditorImportPlugin", SYNTAX_BUILTIN},{"EditorInspector", SYNTAX_BUILTIN},{"EditorInspectorPlugin", SYNTAX_BUILTIN},{"EditorInterface", SYNTAX_BUILTIN},{"EditorNode3DGizmo", SYNTAX_BUILTIN},{"EditorNode3DGizmoPlugin", SYNTAX_BUILTIN},{"EditorPaths", SYNTAX_BUILTIN},{"EditorPlugin", SYNTAX_BUILTIN},{"EditorProperty", SYNTAX_BUILTIN},{"EditorResourceConversionPlugin", SYNTAX_BUILTIN},{"EditorResourcePicker", SYNTAX_BUILTIN},{"EditorResourcePreview", SYNTAX_BUILTIN},{"EditorResourcePreviewGenerator", SYNTAX_BUILTIN},{"EditorResourceTooltipPlugin", SYNTAX_BUILTIN},{"EditorSceneFormatImporter", SYNTAX_BUILTIN},{"EditorSceneFormatImporterBlend", SYNTAX_BUILTIN},{"EditorSceneFormatImporterFBX", SYNTAX_BUILTIN},{"EditorSceneFormatImporterGLTF", SYNTAX_BUILTIN},{"EditorScenePostImport", SYNTAX_BUILTIN},{"EditorScenePostImportPlugin", SYNTAX_BUILTIN},{"EditorScript", SYNTAX_BUILTIN},{"EditorScriptPicker", SYNTAX_BUILTIN},{"EditorSelection", SYNTAX_BUILTIN},{"EditorSettings", SYNTAX_BUILTIN},{"EditorSpinSlider", SYNTAX_BUILTIN},{"EditorSyntaxHighlighter", SYNTAX_BUILTIN},{"EditorTranslationParserPlugin", SYNTAX_BUILTIN},{"EditorUndoRedoManager", SYNTAX_BUILTIN},{"EditorVCSInterface", SYNTAX_BUILTIN},{"EncodedObjectAsID", SYNTAX_BUILTIN},{"Engine", SYNTAX_BUILTIN},{"EngineDebugger", SYNTAX_BUILTIN},{"EngineProfiler", SYNTAX_BUILTIN},{"Environment", SYNTAX_BUILTIN},{"Expression", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_F[10] = {{"FastNoiseLite", SYNTAX_BUILTIN},{"FileAccess", SYNTAX_BUILTIN},{"FileDialog", SYNTAX_BUILTIN},{"FileSystemDock", SYNTAX_BUILTIN},{"FlowContainer", SYNTAX_BUILTIN},{"FogMaterial", SYNTAX_BUILTIN},{"FogVolume", SYNTAX_BUILTIN},{"Font", SYNTAX_BUILTIN},{"FontFile", SYNTAX_BUILTIN},{"FontVariation", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_G[45] = {{"GDExtension", SYNTAX_BUILTIN},{"GDExtensionManager", SYNTAX_BUILTIN},{"GDScript", SYNTAX_BUILTIN},{"GLTFAccessor", SYNTAX_BUILTIN},{"GLTFAnimation", SYNTAX_BUILTIN},{"GLTFBufferView", SYNTAX_BUILTIN},{"GLTFCamera", SYNTAX_BUILTIN},{"GLTFDocument", SYNTAX_BUILTIN},{"GLTFDocumentExtension", SYNTAX_BUILTIN},{"GLTFDocumentExtensionConvertImporterMesh", SYNTAX_BUILTIN},{"GLTFLight", SYNTAX_BUILTIN},{"GLTFMesh", SYNTAX_BUILTIN},{"GLTFNode", SYNTAX_BUILTIN},{"GLTFPhysicsBody", SYNTAX_BUILTIN},{"GLTFPhysicsShape", SYNTAX_BUILTIN},{"GLTFSkeleton", SYNTAX_BUILTIN},{"GLTFSkin", SYNTAX_BUILTIN},{"GLTFSpecGloss", SYNTAX_BUILTIN},{"GLTFState", SYNTAX_BUILTIN},{"GLTFTexture", SYNTAX_BUILTIN},{"GLTFTextureSampler", SYNTAX_BUILTIN},{"GPUParticles2D", SYNTAX_BUILTIN},{"GPUParticles3D", SYNTAX_BUILTIN},{"GPUParticlesAttractor3D", SYNTAX_BUILTIN},{"GPUParticlesAttractorBox3D", SYNTAX_BUILTIN},{"GPUParticlesAttractorSphere3D", SYNTAX_BUILTIN},{"GPUParticlesAttractorVectorField3D", SYNTAX_BUILTIN},{"GPUParticlesCollision3D", SYNTAX_BUILTIN},{"GPUParticlesCollisionBox3D", SYNTAX_BUILTIN},{"GPUParticlesCollisionHeightField3D", SYNTAX_BUILTIN},{"GPUParticlesCollisionSDF3D", SYNTAX_BUILTIN},{"GPUParticlesCollisionSphere3D", SYNTAX_BUILTIN},{"Generic6DOFJoint3D", SYNTAX_BUILTIN},{"Geometry2D", SYNTAX_BUILTIN},{"Geometry3D", SYNTAX_BUILTIN},{"GeometryInstance3D", SYNTAX_BUILTIN},{"GodotSharp", SYNTAX_BUILTIN},{"Gradient", SYNTAX_BUILTIN},{"GradientTexture1D", SYNTAX_BUILTIN},{"GradientTexture2D", SYNTAX_BUILTIN},{"GraphEdit", SYNTAX_BUILTIN},{"GraphNode", SYNTAX_BUILTIN},{"GridContainer", SYNTAX_BUILTIN},{"GridMap", SYNTAX_BUILTIN},{"GrooveJoint2D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_H[12] = {{"HBoxContainer", SYNTAX_BUILTIN},{"HFlowContainer", SYNTAX_BUILTIN},{"HMACContext", SYNTAX_BUILTIN},{"HScrollBar", SYNTAX_BUILTIN},{"HSeparator", SYNTAX_BUILTIN},{"HSlider", SYNTAX_BUILTIN},{"HSplitContainer", SYNTAX_BUILTIN},{"HTTPClient", SYNTAX_BUILTIN},{"HTTPRequest", SYNTAX_BUILTIN},{"HashingContext", SYNTAX_BUILTIN},{"HeightMapShape3D", SYNTAX_BUILTIN},{"HingeJoint3D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_I[33] = {{"INF", SYNTAX_CONSTANT},{"IP", SYNTAX_BUILTIN},{"Image", SYNTAX_BUILTIN},{"ImageFormatLoader", SYNTAX_BUILTIN},{"ImageFormatLoaderExtension", SYNTAX_BUILTIN},{"ImageTexture", SYNTAX_BUILTIN},{"ImageTexture3D", SYNTAX_BUILTIN},{"ImageTextureLayered", SYNTAX_BUILTIN},{"ImmediateMesh", SYNTAX_BUILTIN},{"ImporterMesh", SYNTAX_BUILTIN},{"ImporterMeshInstance3D", SYNTAX_BUILTIN},{"Input", SYNTAX_BUILTIN},{"InputEvent", SYNTAX_BUILTIN},{"InputEventAction", SYNTAX_BUILTIN},{"InputEventFromWindow", SYNTAX_BUILTIN},{"InputEventGesture", SYNTAX_BUILTIN},{"InputEventJoypadButton", SYNTAX_BUILTIN},{"InputEventJoypadMotion", SYNTAX_BUILTIN},{"InputEventKey", SYNTAX_BUILTIN},{"InputEventMIDI", SYNTAX_BUILTIN},{"InputEventMagnifyGesture", SYNTAX_BUILTIN},{"InputEventMouse", SYNTAX_BUILTIN},{"InputEventMouseButton", SYNTAX_BUILTIN},{"InputEventMouseMotion", SYNTAX_BUILTIN},{"InputEventPanGesture", SYNTAX_BUILTIN},{"InputEventScreenDrag", SYNTAX_BUILTIN},{"InputEventScreenTouch", SYNTAX_BUILTIN},{"InputEventShortcut", SYNTAX_BUILTIN},{"InputEventWithModifiers", SYNTAX_BUILTIN},{"InputMap", SYNTAX_BUILTIN},{"InstancePlaceholder", SYNTAX_BUILTIN},{"IntervalTweener", SYNTAX_BUILTIN},{"ItemList", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_J[9] = {{"JNISingleton", SYNTAX_BUILTIN},{"JSON", SYNTAX_BUILTIN},{"JSONRPC", SYNTAX_BUILTIN},{"JavaClass", SYNTAX_BUILTIN},{"JavaClassWrapper", SYNTAX_BUILTIN},{"JavaScriptBridge", SYNTAX_BUILTIN},{"JavaScriptObject", SYNTAX_BUILTIN},{"Joint2D", SYNTAX_BUILTIN},{"Joint3D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_K[2] = {{"KinematicCollision2D", SYNTAX_BUILTIN},{"KinematicCollision3D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_L[14] = {{"Label", SYNTAX_BUILTIN},{"Label3D", SYNTAX_BUILTIN},{"LabelSettings", SYNTAX_BUILTIN},{"Light2D", SYNTAX_BUILTIN},{"Light3D", SYNTAX_BUILTIN},{"LightOccluder2D", SYNTAX_BUILTIN},{"LightmapGI", SYNTAX_BUILTIN},{"LightmapGIData", SYNTAX_BUILTIN},{"LightmapProbe", SYNTAX_BUILTIN},{"Lightmapper", SYNTAX_BUILTIN},{"LightmapperRD", SYNTAX_BUILTIN},{"Line2D", SYNTAX_BUILTIN},{"LineEdit", SYNTAX_BUILTIN},{"LinkButton", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_M[30] = {{"MainLoop", SYNTAX_BUILTIN},{"MarginContainer", SYNTAX_BUILTIN},{"Marker2D", SYNTAX_BUILTIN},{"Marker3D", SYNTAX_BUILTIN},{"Marshalls", SYNTAX_BUILTIN},{"Material", SYNTAX_BUILTIN},{"MenuBar", SYNTAX_BUILTIN},{"MenuButton", SYNTAX_BUILTIN},{"Mesh", SYNTAX_BUILTIN},{"MeshConvexDecompositionSettings", SYNTAX_BUILTIN},{"MeshDataTool", SYNTAX_BUILTIN},{"MeshInstance2D", SYNTAX_BUILTIN},{"MeshInstance3D", SYNTAX_BUILTIN},{"MeshLibrary", SYNTAX_BUILTIN},{"MeshTexture", SYNTAX_BUILTIN},{"MethodTweener", SYNTAX_BUILTIN},{"MissingNode", SYNTAX_BUILTIN},{"MissingResource", SYNTAX_BUILTIN},{"MobileVRInterface", SYNTAX_BUILTIN},{"MovieWriter", SYNTAX_BUILTIN},{"MultiMesh", SYNTAX_BUILTIN},{"MultiMeshInstance2D", SYNTAX_BUILTIN},{"MultiMeshInstance3D", SYNTAX_BUILTIN},{"MultiplayerAPI", SYNTAX_BUILTIN},{"MultiplayerAPIExtension", SYNTAX_BUILTIN},{"MultiplayerPeer", SYNTAX_BUILTIN},{"MultiplayerPeerExtension", SYNTAX_BUILTIN},{"MultiplayerSpawner", SYNTAX_BUILTIN},{"MultiplayerSynchronizer", SYNTAX_BUILTIN},{"Mutex", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_N[28] = {{"NAN", SYNTAX_CONSTANT},{"NavigationAgent2D", SYNTAX_BUILTIN},{"NavigationAgent3D", SYNTAX_BUILTIN},{"NavigationLink2D", SYNTAX_BUILTIN},{"NavigationLink3D", SYNTAX_BUILTIN},{"NavigationMesh", SYNTAX_BUILTIN},{"NavigationMeshGenerator", SYNTAX_BUILTIN},{"NavigationMeshSourceGeometryData3D", SYNTAX_BUILTIN},{"NavigationObstacle2D", SYNTAX_BUILTIN},{"NavigationObstacle3D", SYNTAX_BUILTIN},{"NavigationPathQueryParameters2D", SYNTAX_BUILTIN},{"NavigationPathQueryParameters3D", SYNTAX_BUILTIN},{"NavigationPathQueryResult2D", SYNTAX_BUILTIN},{"NavigationPathQueryResult3D", SYNTAX_BUILTIN},{"NavigationPolygon", SYNTAX_BUILTIN},{"NavigationRegion2D", SYNTAX_BUILTIN},{"NavigationRegion3D", SYNTAX_BUILTIN},{"NavigationServer2D", SYNTAX_BUILTIN},{"NavigationServer3D", SYNTAX_BUILTIN},{"NinePatchRect", SYNTAX_BUILTIN},{"Node", SYNTAX_BUILTIN},{"Node2D", SYNTAX_BUILTIN},{"Node3D", SYNTAX_BUILTIN},{"Node3DGizmo", SYNTAX_BUILTIN},{"NodePath", SYNTAX_BUILTIN},{"Noise", SYNTAX_BUILTIN},{"NoiseTexture2D", SYNTAX_BUILTIN},{"NoiseTexture3D", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_O[19] = {{"ORMMaterial3D", SYNTAX_BUILTIN},{"OS", SYNTAX_BUILTIN},{"Object", SYNTAX_BUILTIN},{"Occluder3D", SYNTAX_BUILTIN},{"OccluderInstance3D", SYNTAX_BUILTIN},{"OccluderPolygon2D", SYNTAX_BUILTIN},{"OfflineMultiplayerPeer", SYNTAX_BUILTIN},{"OggPacketSequence", SYNTAX_BUILTIN},{"OggPacketSequencePlayback", SYNTAX_BUILTIN},{"OmniLight3D", SYNTAX_BUILTIN},{"OpenXRAction", SYNTAX_BUILTIN},{"OpenXRActionMap", SYNTAX_BUILTIN},{"OpenXRActionSet", SYNTAX_BUILTIN},{"OpenXRHand", SYNTAX_BUILTIN},{"OpenXRIPBinding", SYNTAX_BUILTIN},{"OpenXRInteractionProfile", SYNTAX_BUILTIN},{"OpenXRInterface", SYNTAX_BUILTIN},{"OptimizedTranslation", SYNTAX_BUILTIN},{"OptionButton", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_P[89] = {{"PCKPacker", SYNTAX_BUILTIN},{"PI", SYNTAX_CONSTANT},{"PackedByteArray", SYNTAX_BUILTIN},{"PackedColorArray", SYNTAX_BUILTIN},{"PackedDataContainer", SYNTAX_BUILTIN},{"PackedDataContainerRef", SYNTAX_BUILTIN},{"PackedFloat32Array", SYNTAX_BUILTIN},{"PackedFloat64Array", SYNTAX_BUILTIN},{"PackedInt32Array", SYNTAX_BUILTIN},{"PackedInt64Array", SYNTAX_BUILTIN},{"PackedScene", SYNTAX_BUILTIN},{"PackedStringArray", SYNTAX_BUILTIN},{"PackedVector2Array", SYNTAX_BUILTIN},{"PackedVector3Array", SYNTAX_BUILTIN},{"PacketPeer", SYNTAX_BUILTIN},{"PacketPeerDTLS", SYNTAX_BUILTIN},{"PacketPeerExtension", SYNTAX_BUILTIN},{"PacketPeerStream", SYNTAX_BUILTIN},{"PacketPeerUDP", SYNTAX_BUILTIN},{"Panel", SYNTAX_BUILTIN},{"PanelContainer", SYNTAX_BUILTIN},{"PanoramaSkyMaterial", SYNTAX_BUILTIN},{"ParallaxBackground", SYNTAX_BUILTIN},{"ParallaxLayer", SYNTAX_BUILTIN},{"ParticleProcessMaterial", SYNTAX_BUILTIN},{"Path2D", SYNTAX_BUILTIN},{"Path3D", SYNTAX_BUILTIN},{"PathFollow2D", SYNTAX_BUILTIN},{"PathFollow3D", SYNTAX_BUILTIN},{"Performance", SYNTAX_BUILTIN},{"PhysicalBone2D", SYNTAX_BUILTIN},{"PhysicalBone3D", SYNTAX_BUILTIN},{"PhysicalSkyMaterial", SYNTAX_BUILTIN},{"PhysicsBody2D", SYNTAX_BUILTIN},{"PhysicsBody3D", SYNTAX_BUILTIN},{"PhysicsDirectBodyState2D", SYNTAX_BUILTIN},{"PhysicsDirectBodyState2DExtension", SYNTAX_BUILTIN},{"PhysicsDirectBodyState3D", SYNTAX_BUILTIN},{"PhysicsDirectBodyState3DExtension", SYNTAX_BUILTIN},{"PhysicsDirectSpaceState2D", SYNTAX_BUILTIN},{"PhysicsDirectSpaceState2DExtension", SYNTAX_BUILTIN},{"PhysicsDirectSpaceState3D", SYNTAX_BUILTIN},{"PhysicsDirectSpaceState3DExtension", SYNTAX_BUILTIN},{"PhysicsMaterial", SYNTAX_BUILTIN},{"PhysicsPointQueryParameters2D", SYNTAX_BUILTIN},{"PhysicsPointQueryParameters3D", SYNTAX_BUILTIN},{"PhysicsRayQueryParameters2D", SYNTAX_BUILTIN},{"PhysicsRayQueryParameters3D", SYNTAX_BUILTIN},{"PhysicsServer2D", SYNTAX_BUILTIN},{"PhysicsServer2DExtension", SYNTAX_BUILTIN},{"PhysicsServer2DManager", SYNTAX_BUILTIN},{"PhysicsServer3D", SYNTAX_BUILTIN},{"PhysicsServer3DExtension", SYNTAX_BUILTIN},{"PhysicsServer3DManager", SYNTAX_BUILTIN},{"PhysicsServer3DRenderingServerHandler", SYNTAX_BUILTIN},{"PhysicsShapeQueryParameters2D", SYNTAX_BUILTIN},{"PhysicsShapeQueryParameters3D", SYNTAX_BUILTIN},{"PhysicsTestMotionParameters2D", SYNTAX_BUILTIN},{"PhysicsTestMotionParameters3D", SYNTAX_BUILTIN},{"PhysicsTestMotionResult2D", SYNTAX_BUILTIN},{"PhysicsTestMotionResult3D", SYNTAX_BUILTIN},{"PinJoint2D", SYNTAX_BUILTIN},{"PinJoint3D", SYNTAX_BUILTIN},{"PlaceholderCubemap", SYNTAX_BUILTIN},{"PlaceholderCubemapArray", SYNTAX_BUILTIN},{"PlaceholderMaterial", SYNTAX_BUILTIN},{"PlaceholderMesh", SYNTAX_BUILTIN},{"PlaceholderTexture2D", SYNTAX_BUILTIN},{"PlaceholderTexture2DArray", SYNTAX_BUILTIN},{"PlaceholderTexture3D", SYNTAX_BUILTIN},{"PlaceholderTextureLayered", SYNTAX_BUILTIN},{"Plane", SYNTAX_BUILTIN},{"PlaneMesh", SYNTAX_BUILTIN},{"PointLight2D", SYNTAX_BUILTIN},{"PointMesh", SYNTAX_BUILTIN},{"Polygon2D", SYNTAX_BUILTIN},{"PolygonOccluder3D", SYNTAX_BUILTIN},{"PolygonPathFinder", SYNTAX_BUILTIN},{"Popup", SYNTAX_BUILTIN},{"PopupMenu", SYNTAX_BUILTIN},{"PopupPanel", SYNTAX_BUILTIN},{"PortableCompressedTexture2D", SYNTAX_BUILTIN},{"PrimitiveMesh", SYNTAX_BUILTIN},{"PrismMesh", SYNTAX_BUILTIN},{"ProceduralSkyMaterial", SYNTAX_BUILTIN},{"ProgressBar", SYNTAX_BUILTIN},{"ProjectSettings", SYNTAX_BUILTIN},{"Projection", SYNTAX_BUILTIN},{"PropertyTweener", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_Q[3] = {{"QuadMesh", SYNTAX_BUILTIN},{"QuadOccluder3D", SYNTAX_BUILTIN},{"Quaternion", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_R[47] = {{"RDAttachmentFormat", SYNTAX_BUILTIN},{"RDFramebufferPass", SYNTAX_BUILTIN},{"RDPipelineColorBlendState", SYNTAX_BUILTIN},{"RDPipelineColorBlendStateAttachment", SYNTAX_BUILTIN},{"RDPipelineDepthStencilState", SYNTAX_BUILTIN},{"RDPipelineMultisampleState", SYNTAX_BUILTIN},{"RDPipelineRasterizationState", SYNTAX_BUILTIN},{"RDPipelineSpecializationConstant", SYNTAX_BUILTIN},{"RDSamplerState", SYNTAX_BUILTIN},{"RDShaderFile", SYNTAX_BUILTIN},{"RDShaderSPIRV", SYNTAX_BUILTIN},{"RDShaderSource", SYNTAX_BUILTIN},{"RDTextureFormat", SYNTAX_BUILTIN},{"RDTextureView", SYNTAX_BUILTIN},{"RDUniform", SYNTAX_BUILTIN},{"RDVertexAttribute", SYNTAX_BUILTIN},{"RID", SYNTAX_BUILTIN},{"RandomNumberGenerator", SYNTAX_BUILTIN},{"Range", SYNTAX_BUILTIN},{"RayCast2D", SYNTAX_BUILTIN},{"RayCast3D", SYNTAX_BUILTIN},{"Rect2", SYNTAX_BUILTIN},{"Rect2i", SYNTAX_BUILTIN},{"RectangleShape2D", SYNTAX_BUILTIN},{"RefCounted", SYNTAX_BUILTIN},{"ReferenceRect", SYNTAX_BUILTIN},{"ReflectionProbe", SYNTAX_BUILTIN},{"RegEx", SYNTAX_BUILTIN},{"RegExMatch", SYNTAX_BUILTIN},{"RemoteTransform2D", SYNTAX_BUILTIN},{"RemoteTransform3D", SYNTAX_BUILTIN},{"RenderingDevice", SYNTAX_BUILTIN},{"RenderingServer", SYNTAX_BUILTIN},{"Resource", SYNTAX_BUILTIN},{"ResourceFormatLoader", SYNTAX_BUILTIN},{"ResourceFormatSaver", SYNTAX_BUILTIN},{"ResourceImporter", SYNTAX_BUILTIN},{"ResourceLoader", SYNTAX_BUILTIN},{"ResourcePreloader", SYNTAX_BUILTIN},{"ResourceSaver", SYNTAX_BUILTIN},{"ResourceUID", SYNTAX_BUILTIN},{"RibbonTrailMesh", SYNTAX_BUILTIN},{"RichTextEffect", SYNTAX_BUILTIN},{"RichTextLabel", SYNTAX_BUILTIN},{"RigidBody2D", SYNTAX_BUILTIN},{"RigidBody3D", SYNTAX_BUILTIN},{"RootMotionView", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_S[81] = {{"SceneMultiplayer", SYNTAX_BUILTIN},{"SceneReplicationConfig", SYNTAX_BUILTIN},{"SceneState", SYNTAX_BUILTIN},{"SceneTree", SYNTAX_BUILTIN},{"SceneTreeTimer", SYNTAX_BUILTIN},{"Script", SYNTAX_BUILTIN},{"ScriptCreateDialog", SYNTAX_BUILTIN},{"ScriptEditor", SYNTAX_BUILTIN},{"ScriptEditorBase", SYNTAX_BUILTIN},{"ScriptExtension", SYNTAX_BUILTIN},{"ScriptLanguage", SYNTAX_BUILTIN},{"ScriptLanguageExtension", SYNTAX_BUILTIN},{"ScrollBar", SYNTAX_BUILTIN},{"ScrollContainer", SYNTAX_BUILTIN},{"SegmentShape2D", SYNTAX_BUILTIN},{"Semaphore", SYNTAX_BUILTIN},{"SeparationRayShape2D", SYNTAX_BUILTIN},{"SeparationRayShape3D", SYNTAX_BUILTIN},{"Separator", SYNTAX_BUILTIN},{"Shader", SYNTAX_BUILTIN},{"ShaderGlobalsOverride", SYNTAX_BUILTIN},{"ShaderInclude", SYNTAX_BUILTIN},{"ShaderMaterial", SYNTAX_BUILTIN},{"Shape2D", SYNTAX_BUILTIN},{"Shape3D", SYNTAX_BUILTIN},{"ShapeCast2D", SYNTAX_BUILTIN},{"ShapeCast3D", SYNTAX_BUILTIN},{"Shortcut", SYNTAX_BUILTIN},{"Signal", SYNTAX_BUILTIN},{"Skeleton2D", SYNTAX_BUILTIN},{"Skeleton3D", SYNTAX_BUILTIN},{"SkeletonIK3D", SYNTAX_BUILTIN},{"SkeletonModification2D", SYNTAX_BUILTIN},{"SkeletonModification2DCCDIK", SYNTAX_BUILTIN},{"SkeletonModification2DFABRIK", SYNTAX_BUILTIN},{"SkeletonModification2DJiggle", SYNTAX_BUILTIN},{"SkeletonModification2DLookAt", SYNTAX_BUILTIN},{"SkeletonModification2DPhysicalBones", SYNTAX_BUILTIN},{"SkeletonModification2DStackHolder", SYNTAX_BUILTIN},{"SkeletonModification2DTwoBoneIK", SYNTAX_BUILTIN},{"SkeletonModificationStack2D", SYNTAX_BUILTIN},{"SkeletonProfile", SYNTAX_BUILTIN},{"SkeletonProfileHumanoid", SYNTAX_BUILTIN},{"Skin", SYNTAX_BUILTIN},{"SkinReference", SYNTAX_BUILTIN},{"Sky", SYNTAX_BUILTIN},{"Slider", SYNTAX_BUILTIN},{"SliderJoint3D", SYNTAX_BUILTIN},{"SoftBody3D", SYNTAX_BUILTIN},{"SphereMesh", SYNTAX_BUILTIN},{"SphereOccluder3D", SYNTAX_BUILTIN},{"SphereShape3D", SYNTAX_BUILTIN},{"SpinBox", SYNTAX_BUILTIN},{"SplitContainer", SYNTAX_BUILTIN},{"SpotLight3D", SYNTAX_BUILTIN},{"SpringArm3D", SYNTAX_BUILTIN},{"Sprite2D", SYNTAX_BUILTIN},{"Sprite3D", SYNTAX_BUILTIN},{"SpriteBase3D", SYNTAX_BUILTIN},{"SpriteFrames", SYNTAX_BUILTIN},{"StandardMaterial3D", SYNTAX_BUILTIN},{"StaticBody2D", SYNTAX_BUILTIN},{"StaticBody3D", SYNTAX_BUILTIN},{"StreamPeer", SYNTAX_BUILTIN},{"StreamPeerBuffer", SYNTAX_BUILTIN},{"StreamPeerExtension", SYNTAX_BUILTIN},{"StreamPeerGZIP", SYNTAX_BUILTIN},{"StreamPeerTCP", SYNTAX_BUILTIN},{"StreamPeerTLS", SYNTAX_BUILTIN},{"String", SYNTAX_BUILTIN},{"StringName", SYNTAX_BUILTIN},{"StyleBox", SYNTAX_BUILTIN},{"StyleBoxEmpty", SYNTAX_BUILTIN},{"StyleBoxFlat", SYNTAX_BUILTIN},{"StyleBoxLine", SYNTAX_BUILTIN},{"StyleBoxTexture", SYNTAX_BUILTIN},{"SubViewport", SYNTAX_BUILTIN},{"SubViewportContainer", SYNTAX_BUILTIN},{"SurfaceTool", SYNTAX_BUILTIN},{"SyntaxHighlighter", SYNTAX_BUILTIN},{"SystemFont", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_T[47] = {{"TAU", SYNTAX_CONSTANT},{"TCPServer", SYNTAX_BUILTIN},{"TLSOptions", SYNTAX_BUILTIN},{"TabBar", SYNTAX_BUILTIN},{"TabContainer", SYNTAX_BUILTIN},{"TextEdit", SYNTAX_BUILTIN},{"TextLine", SYNTAX_BUILTIN},{"TextMesh", SYNTAX_BUILTIN},{"TextParagraph", SYNTAX_BUILTIN},{"TextServer", SYNTAX_BUILTIN},{"TextServerAdvanced", SYNTAX_BUILTIN},{"TextServerDummy", SYNTAX_BUILTIN},{"TextServerExtension", SYNTAX_BUILTIN},{"TextServerFallback", SYNTAX_BUILTIN},{"TextServerManager", SYNTAX_BUILTIN},{"Texture", SYNTAX_BUILTIN},{"Texture2D", SYNTAX_BUILTIN},{"Texture2DArray", SYNTAX_BUILTIN},{"Texture3D", SYNTAX_BUILTIN},{"TextureButton", SYNTAX_BUILTIN},{"TextureLayered", SYNTAX_BUILTIN},{"TextureProgressBar", SYNTAX_BUILTIN},{"TextureRect", SYNTAX_BUILTIN},{"Theme", SYNTAX_BUILTIN},{"ThemeDB", SYNTAX_BUILTIN},{"Thread", SYNTAX_BUILTIN},{"TileData", SYNTAX_BUILTIN},{"TileMap", SYNTAX_BUILTIN},{"TileMapPattern", SYNTAX_BUILTIN},{"TileSet", SYNTAX_BUILTIN},{"TileSetAtlasSource", SYNTAX_BUILTIN},{"TileSetScenesCollectionSource", SYNTAX_BUILTIN},{"TileSetSource", SYNTAX_BUILTIN},{"Time", SYNTAX_BUILTIN},{"Timer", SYNTAX_BUILTIN},{"TorusMesh", SYNTAX_BUILTIN},{"TouchScreenButton", SYNTAX_BUILTIN},{"Transform2D", SYNTAX_BUILTIN},{"Transform3D", SYNTAX_BUILTIN},{"Translation", SYNTAX_BUILTIN},{"TranslationServer", SYNTAX_BUILTIN},{"Tree", SYNTAX_BUILTIN},{"TreeItem", SYNTAX_BUILTIN},{"TriangleMesh", SYNTAX_BUILTIN},{"TubeTrailMesh", SYNTAX_BUILTIN},{"Tween", SYNTAX_BUILTIN},{"Tweener", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_U[4] = {{"UDPServer", SYNTAX_BUILTIN},{"UPNP", SYNTAX_BUILTIN},{"UPNPDevice", SYNTAX_BUILTIN},{"UndoRedo", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_V[135] = {{"VBoxContainer", SYNTAX_BUILTIN},{"VFlowContainer", SYNTAX_BUILTIN},{"VScrollBar", SYNTAX_BUILTIN},{"VSeparator", SYNTAX_BUILTIN},{"VSlider", SYNTAX_BUILTIN},{"VSplitContainer", SYNTAX_BUILTIN},{"Variant", SYNTAX_BUILTIN},{"Vector2", SYNTAX_BUILTIN},{"Vector2i", SYNTAX_BUILTIN},{"Vector3", SYNTAX_BUILTIN},{"Vector3i", SYNTAX_BUILTIN},{"Vector4", SYNTAX_BUILTIN},{"Vector4i", SYNTAX_BUILTIN},{"VehicleBody3D", SYNTAX_BUILTIN},{"VehicleWheel3D", SYNTAX_BUILTIN},{"VideoStream", SYNTAX_BUILTIN},{"VideoStreamPlayback", SYNTAX_BUILTIN},{"VideoStreamPlayer", SYNTAX_BUILTIN},{"VideoStreamTheora", SYNTAX_BUILTIN},{"Viewport", SYNTAX_BUILTIN},{"ViewportTexture", SYNTAX_BUILTIN},{"VisibleOnScreenEnabler2D", SYNTAX_BUILTIN},{"VisibleOnScreenEnabler3D", SYNTAX_BUILTIN},{"VisibleOnScreenNotifier2D", SYNTAX_BUILTIN},{"VisibleOnScreenNotifier3D", SYNTAX_BUILTIN},{"VisualInstance3D", SYNTAX_BUILTIN},{"VisualShader", SYNTAX_BUILTIN},{"VisualShaderNode", SYNTAX_BUILTIN},{"VisualShaderNodeBillboard", SYNTAX_BUILTIN},{"VisualShaderNodeBooleanConstant", SYNTAX_BUILTIN},{"VisualShaderNodeBooleanParameter", SYNTAX_BUILTIN},{"VisualShaderNodeClamp", SYNTAX_BUILTIN},{"VisualShaderNodeColorConstant", SYNTAX_BUILTIN},{"VisualShaderNodeColorFunc", SYNTAX_BUILTIN},{"VisualShaderNodeColorOp", SYNTAX_BUILTIN},{"VisualShaderNodeColorParameter", SYNTAX_BUILTIN},{"VisualShaderNodeComment", SYNTAX_BUILTIN},{"VisualShaderNodeCompare", SYNTAX_BUILTIN},{"VisualShaderNodeConstant", SYNTAX_BUILTIN},{"VisualShaderNodeCubemap", SYNTAX_BUILTIN},{"VisualShaderNodeCubemapParameter", SYNTAX_BUILTIN},{"VisualShaderNodeCurveTexture", SYNTAX_BUILTIN},{"VisualShaderNodeCurveXYZTexture", SYNTAX_BUILTIN},{"VisualShaderNodeCustom", SYNTAX_BUILTIN},{"VisualShaderNodeDerivativeFunc", SYNTAX_BUILTIN},{"VisualShaderNodeDeterminant", SYNTAX_BUILTIN},{"VisualShaderNodeDistanceFade", SYNTAX_BUILTIN},{"VisualShaderNodeDotProduct", SYNTAX_BUILTIN},{"VisualShaderNodeExpression", SYNTAX_BUILTIN},{"VisualShaderNodeFaceForward", SYNTAX_BUILTIN},{"VisualShaderNodeFloatConstant", SYNTAX_BUILTIN},{"VisualShaderNodeFloatFunc", SYNTAX_BUILTIN},{"VisualShaderNodeFloatOp", SYNTAX_BUILTIN},{"VisualShaderNodeFloatParameter", SYNTAX_BUILTIN},{"VisualShaderNodeFresnel", SYNTAX_BUILTIN},{"VisualShaderNodeGlobalExpression", SYNTAX_BUILTIN},{"VisualShaderNodeGroupBase", SYNTAX_BUILTIN},{"VisualShaderNodeIf", SYNTAX_BUILTIN},{"VisualShaderNodeInput", SYNTAX_BUILTIN},{"VisualShaderNodeIntConstant", SYNTAX_BUILTIN},{"VisualShaderNodeIntFunc", SYNTAX_BUILTIN},{"VisualShaderNodeIntOp", SYNTAX_BUILTIN},{"VisualShaderNodeIntParameter", SYNTAX_BUILTIN},{"VisualShaderNodeIs", SYNTAX_BUILTIN},{"VisualShaderNodeLinearSceneDepth", SYNTAX_BUILTIN},{"VisualShaderNodeMix", SYNTAX_BUILTIN},{"VisualShaderNodeMultiplyAdd", SYNTAX_BUILTIN},{"VisualShaderNodeOuterProduct", SYNTAX_BUILTIN},{"VisualShaderNodeOutput", SYNTAX_BUILTIN},{"VisualShaderNodeParameter", SYNTAX_BUILTIN},{"VisualShaderNodeParameterRef", SYNTAX_BUILTIN},{"VisualShaderNodeParticleAccelerator", SYNTAX_BUILTIN},{"VisualShaderNodeParticleBoxEmitter", SYNTAX_BUILTIN},{"VisualShaderNodeParticleConeVelocity", SYNTAX_BUILTIN},{"VisualShaderNodeParticleEmit", SYNTAX_BUILTIN},{"VisualShaderNodeParticleEmitter", SYNTAX_BUILTIN},{"VisualShaderNodeParticleMeshEmitter", SYNTAX_BUILTIN},{"VisualShaderNodeParticleMultiplyByAxisAngle", SYNTAX_BUILTIN},{"VisualShaderNodeParticleOutput", SYNTAX_BUILTIN},{"VisualShaderNodeParticleRandomness", SYNTAX_BUILTIN},{"VisualShaderNodeParticleRingEmitter", SYNTAX_BUILTIN},{"VisualShaderNodeParticleSphereEmitter", SYNTAX_BUILTIN},{"VisualShaderNodeProximityFade", SYNTAX_BUILTIN},{"VisualShaderNodeRandomRange", SYNTAX_BUILTIN},{"VisualShaderNodeRemap", SYNTAX_BUILTIN},{"VisualShaderNodeResizableBase", SYNTAX_BUILTIN},{"VisualShaderNodeSDFRaymarch", SYNTAX_BUILTIN},{"VisualShaderNodeSDFToScreenUV", SYNTAX_BUILTIN},{"VisualShaderNodeSample3D", SYNTAX_BUILTIN},{"VisualShaderNodeScreenUVToSDF", SYNTAX_BUILTIN},{"VisualShaderNodeSmoothStep", SYNTAX_BUILTIN},{"VisualShaderNodeStep", SYNTAX_BUILTIN},{"VisualShaderNodeSwitch", SYNTAX_BUILTIN},{"VisualShaderNodeTexture", SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DArray", SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DArrayParameter", SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DParameter", SYNTAX_BUILTIN},{"VisualShaderNodeTexture3D", SYNTAX_BUILTIN},{"VisualShaderNodeTexture3DParameter", SYNTAX_BUILTIN},{"VisualShaderNodeTextureParameter", SYNTAX_BUILTIN},{"VisualShaderNodeTextureParameterTriplanar", SYNTAX_BUILTIN},{"VisualShaderNodeTextureSDF", SYNTAX_BUILTIN},{"VisualShaderNodeTextureSDFNormal", SYNTAX_BUILTIN},{"VisualShaderNodeTransformCompose", SYNTAX_BUILTIN},{"VisualShaderNodeTransformConstant", SYNTAX_BUILTIN},{"VisualShaderNodeTransformDecompose", SYNTAX_BUILTIN},{"VisualShaderNodeTransformFunc", SYNTAX_BUILTIN},{"VisualShaderNodeTransformOp", SYNTAX_BUILTIN},{"VisualShaderNodeTransformParameter", SYNTAX_BUILTIN},{"VisualShaderNodeTransformVecMult", SYNTAX_BUILTIN},{"VisualShaderNodeUIntConstant", SYNTAX_BUILTIN},{"VisualShaderNodeUIntFunc", SYNTAX_BUILTIN},{"VisualShaderNodeUIntOp", SYNTAX_BUILTIN},{"VisualShaderNodeUIntParameter", SYNTAX_BUILTIN},{"VisualShaderNodeUVFunc", SYNTAX_BUILTIN},{"VisualShaderNodeUVPolarCoord", SYNTAX_BUILTIN},{"VisualShaderNodeVarying", SYNTAX_BUILTIN},{"VisualShaderNodeVaryingGetter", SYNTAX_BUILTIN},{"VisualShaderNodeVaryingSetter", SYNTAX_BUILTIN},{"VisualShaderNodeVec2Constant", SYNTAX_BUILTIN},{"VisualShaderNodeVec2Parameter", SYNTAX_BUILTIN},{"VisualShaderNodeVec3Constant", SYNTAX_BUILTIN},{"VisualShaderNodeVec3Parameter", SYNTAX_BUILTIN},{"VisualShaderNodeVec4Constant", SYNTAX_BUILTIN},{"VisualShaderNodeVec4Parameter", SYNTAX_BUILTIN},{"VisualShaderNodeVectorBase", SYNTAX_BUILTIN},{"VisualShaderNodeVectorCompose", SYNTAX_BUILTIN},{"VisualShaderNodeVectorDecompose", SYNTAX_BUILTIN},{"VisualShaderNodeVectorDistance", SYNTAX_BUILTIN},{"VisualShaderNodeVectorFunc", SYNTAX_BUILTIN},{"VisualShaderNodeVectorLen", SYNTAX_BUILTIN},{"VisualShaderNodeVectorOp", SYNTAX_BUILTIN},{"VisualShaderNodeVectorRefract", SYNTAX_BUILTIN},{"VoxelGI", SYNTAX_BUILTIN},{"VoxelGIData", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_W[16] = {{"WeakRef", SYNTAX_BUILTIN},{"WebRTCDataChannel", SYNTAX_BUILTIN},{"WebRTCDataChannelExtension", SYNTAX_BUILTIN},{"WebRTCMultiplayerPeer", SYNTAX_BUILTIN},{"WebRTCPeerConnection", SYNTAX_BUILTIN},{"WebRTCPeerConnectionExtension", SYNTAX_BUILTIN},{"WebSocketMultiplayerPeer", SYNTAX_BUILTIN},{"WebSocketPeer", SYNTAX_BUILTIN},{"WebXRInterface", SYNTAX_BUILTIN},{"Window", SYNTAX_BUILTIN},{"WorkerThreadPool", SYNTAX_BUILTIN},{"World2D", SYNTAX_BUILTIN},{"World3D", SYNTAX_BUILTIN},{"WorldBoundaryShape2D", SYNTAX_BUILTIN},{"WorldBoundaryShape3D", SYNTAX_BUILTIN},{"WorldEnvironment", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_X[12] = {{"X509Certificate", SYNTAX_BUILTIN},{"XMLParser", SYNTAX_BUILTIN},{"XRAnchor3D", SYNTAX_BUILTIN},{"XRCamera3D", SYNTAX_BUILTIN},{"XRController3D", SYNTAX_BUILTIN},{"XRInterface", SYNTAX_BUILTIN},{"XRInterfaceExtension", SYNTAX_BUILTIN},{"XRNode3D", SYNTAX_BUILTIN},{"XROrigin3D", SYNTAX_BUILTIN},{"XRPose", SYNTAX_BUILTIN},{"XRPositionalTracker", SYNTAX_BUILTIN},{"XRServer", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_Z[2] = {{"ZIPPacker", SYNTAX_BUILTIN},{"ZIPReader", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_a[11] = {{"abs", SYNTAX_BUILTIN},{"absf", SYNTAX_BUILTIN},{"absi", SYNTAX_BUILTIN},{"acos", SYNTAX_BUILTIN},{"and", SYNTAX_KEYWORD},{"as", SYNTAX_KEYWORD},{"asin", SYNTAX_BUILTIN},{"assert", SYNTAX_KEYWORD},{"atan", SYNTAX_BUILTIN},{"atan2", SYNTAX_BUILTIN},{"await", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_b[7] = {{"bezier_derivative", SYNTAX_BUILTIN},{"bezier_interpolate", SYNTAX_BUILTIN},{"bool", SYNTAX_BUILTIN},{"break", SYNTAX_KEYWORD},{"breakpoint", SYNTAX_KEYWORD},{"bytes_to_var", SYNTAX_BUILTIN},{"bytes_to_var_with_objects", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_c[16] = {{"ceil", SYNTAX_BUILTIN},{"ceilf", SYNTAX_BUILTIN},{"ceili", SYNTAX_BUILTIN},{"clamp", SYNTAX_BUILTIN},{"clampf", SYNTAX_BUILTIN},{"clampi", SYNTAX_BUILTIN},{"class", SYNTAX_KEYWORD},{"class_name", SYNTAX_KEYWORD},{"const", SYNTAX_KEYWORD},{"continue", SYNTAX_KEYWORD},{"cos", SYNTAX_BUILTIN},{"cosh", SYNTAX_BUILTIN},{"cubic_interpolate", SYNTAX_BUILTIN},{"cubic_interpolate_angle", SYNTAX_BUILTIN},{"cubic_interpolate_angle_in_time", SYNTAX_BUILTIN},{"cubic_interpolate_in_time", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_d[2] = {{"db_to_linear", SYNTAX_BUILTIN},{"deg_to_rad", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_e[7] = {{"ease", SYNTAX_BUILTIN},{"elif", SYNTAX_KEYWORD},{"else", SYNTAX_KEYWORD},{"enum", SYNTAX_KEYWORD},{"error_string", SYNTAX_BUILTIN},{"exp", SYNTAX_BUILTIN},{"extends", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_f[9] = {{"false", SYNTAX_CONSTANT},{"float", SYNTAX_BUILTIN},{"floor", SYNTAX_BUILTIN},{"floorf", SYNTAX_BUILTIN},{"floori", SYNTAX_BUILTIN},{"fmod", SYNTAX_BUILTIN},{"for", SYNTAX_KEYWORD},{"fposmod", SYNTAX_BUILTIN},{"func", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_h[1] = {{"hash", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_i[14] = {{"if", SYNTAX_KEYWORD},{"in", SYNTAX_KEYWORD},{"instance_from_id", SYNTAX_BUILTIN},{"int", SYNTAX_BUILTIN},{"inverse_lerp", SYNTAX_BUILTIN},{"is", SYNTAX_KEYWORD},{"is_equal_approx", SYNTAX_BUILTIN},{"is_finite", SYNTAX_BUILTIN},{"is_inf", SYNTAX_BUILTIN},{"is_instance_id_valid", SYNTAX_BUILTIN},{"is_instance_valid", SYNTAX_BUILTIN},{"is_nan", SYNTAX_BUILTIN},{"is_same", SYNTAX_BUILTIN},{"is_zero_approx", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_l[5] = {{"lerp", SYNTAX_BUILTIN},{"lerp_angle", SYNTAX_BUILTIN},{"lerpf", SYNTAX_BUILTIN},{"linear_to_db", SYNTAX_BUILTIN},{"log", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_m[8] = {{"match", SYNTAX_KEYWORD},{"max", SYNTAX_BUILTIN},{"maxf", SYNTAX_BUILTIN},{"maxi", SYNTAX_BUILTIN},{"min", SYNTAX_BUILTIN},{"minf", SYNTAX_BUILTIN},{"mini", SYNTAX_BUILTIN},{"move_toward", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_n[3] = {{"nearest_po2", SYNTAX_BUILTIN},{"not", SYNTAX_KEYWORD},{"null", SYNTAX_CONSTANT}};
-static const Keyword syntax_keywords_gdscript_o[1] = {{"or", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_p[14] = {{"pass", SYNTAX_KEYWORD},{"pingpong", SYNTAX_BUILTIN},{"posmod", SYNTAX_BUILTIN},{"pow", SYNTAX_BUILTIN},{"preload", SYNTAX_KEYWORD},{"print", SYNTAX_BUILTIN},{"print_rich", SYNTAX_BUILTIN},{"print_verbose", SYNTAX_BUILTIN},{"printerr", SYNTAX_BUILTIN},{"printraw", SYNTAX_BUILTIN},{"prints", SYNTAX_BUILTIN},{"printt", SYNTAX_BUILTIN},{"push_error", SYNTAX_BUILTIN},{"push_warning", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_r[15] = {{"rad_to_deg", SYNTAX_BUILTIN},{"rand_from_seed", SYNTAX_BUILTIN},{"randf", SYNTAX_BUILTIN},{"randf_range", SYNTAX_BUILTIN},{"randfn", SYNTAX_BUILTIN},{"randi", SYNTAX_BUILTIN},{"randi_range", SYNTAX_BUILTIN},{"randomize", SYNTAX_BUILTIN},{"remap", SYNTAX_BUILTIN},{"return", SYNTAX_KEYWORD},{"rid_allocate_id", SYNTAX_BUILTIN},{"rid_from_int64", SYNTAX_BUILTIN},{"round", SYNTAX_BUILTIN},{"roundf", SYNTAX_BUILTIN},{"roundi", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_s[18] = {{"seed", SYNTAX_BUILTIN},{"self", SYNTAX_KEYWORD},{"sign", SYNTAX_BUILTIN},{"signal", SYNTAX_KEYWORD},{"signf", SYNTAX_BUILTIN},{"signi", SYNTAX_BUILTIN},{"sin", SYNTAX_BUILTIN},{"sinh", SYNTAX_BUILTIN},{"smoothstep", SYNTAX_BUILTIN},{"snapped", SYNTAX_BUILTIN},{"snappedf", SYNTAX_BUILTIN},{"snappedi", SYNTAX_BUILTIN},{"sqrt", SYNTAX_BUILTIN},{"static", SYNTAX_KEYWORD},{"step_decimals", SYNTAX_BUILTIN},{"str", SYNTAX_BUILTIN},{"str_to_var", SYNTAX_BUILTIN},{"super", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_t[4] = {{"tan", SYNTAX_BUILTIN},{"tanh", SYNTAX_BUILTIN},{"true", SYNTAX_CONSTANT},{"typeof", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_v[5] = {{"var", SYNTAX_KEYWORD},{"var_to_bytes", SYNTAX_BUILTIN},{"var_to_bytes_with_objects", SYNTAX_BUILTIN},{"var_to_str", SYNTAX_BUILTIN},{"void", SYNTAX_KEYWORD}};
-static const Keyword syntax_keywords_gdscript_w[5] = {{"weakref", SYNTAX_BUILTIN},{"while", SYNTAX_KEYWORD},{"wrap", SYNTAX_BUILTIN},{"wrapf", SYNTAX_BUILTIN},{"wrapi", SYNTAX_BUILTIN}};
-static const Keyword syntax_keywords_gdscript_y[1] = {{"yield", SYNTAX_KEYWORD}};
-static const KeywordList syntax_all_keywords_gdscript[128] = {
-	['A'] = {syntax_keywords_gdscript_A, arr_count(syntax_keywords_gdscript_A)}, ['B'] = {syntax_keywords_gdscript_B, arr_count(syntax_keywords_gdscript_B)}, ['C'] = {syntax_keywords_gdscript_C, arr_count(syntax_keywords_gdscript_C)}, ['D'] = {syntax_keywords_gdscript_D, arr_count(syntax_keywords_gdscript_D)}, ['E'] = {syntax_keywords_gdscript_E, arr_count(syntax_keywords_gdscript_E)}, ['F'] = {syntax_keywords_gdscript_F, arr_count(syntax_keywords_gdscript_F)}, ['G'] = {syntax_keywords_gdscript_G, arr_count(syntax_keywords_gdscript_G)}, ['H'] = {syntax_keywords_gdscript_H, arr_count(syntax_keywords_gdscript_H)}, ['I'] = {syntax_keywords_gdscript_I, arr_count(syntax_keywords_gdscript_I)}, ['J'] = {syntax_keywords_gdscript_J, arr_count(syntax_keywords_gdscript_J)}, ['K'] = {syntax_keywords_gdscript_K, arr_count(syntax_keywords_gdscript_K)}, ['L'] = {syntax_keywords_gdscript_L, arr_count(syntax_keywords_gdscript_L)}, ['M'] = {syntax_keywords_gdscript_M, arr_count(syntax_keywords_gdscript_M)}, ['N'] = {syntax_keywords_gdscript_N, arr_count(syntax_keywords_gdscript_N)}, ['O'] = {syntax_keywords_gdscript_O, arr_count(syntax_keywords_gdscript_O)}, ['P'] = {syntax_keywords_gdscript_P, arr_count(syntax_keywords_gdscript_P)}, ['Q'] = {syntax_keywords_gdscript_Q, arr_count(syntax_keywords_gdscript_Q)}, ['R'] = {syntax_keywords_gdscript_R, arr_count(syntax_keywords_gdscript_R)}, ['S'] = {syntax_keywords_gdscript_S, arr_count(syntax_keywords_gdscript_S)}, ['T'] = {syntax_keywords_gdscript_T, arr_count(syntax_keywords_gdscript_T)}, ['U'] = {syntax_keywords_gdscript_U, arr_count(syntax_keywords_gdscript_U)}, ['V'] = {syntax_keywords_gdscript_V, arr_count(syntax_keywords_gdscript_V)}, ['W'] = {syntax_keywords_gdscript_W, arr_count(syntax_keywords_gdscript_W)}, ['X'] = {syntax_keywords_gdscript_X, arr_count(syntax_keywords_gdscript_X)}, ['Z'] = {syntax_keywords_gdscript_Z, arr_count(syntax_keywords_gdscript_Z)}, ['a'] = {syntax_keywords_gdscript_a, arr_count(syntax_keywords_gdscript_a)}, ['b'] = {syntax_keywords_gdscript_b, arr_count(syntax_keywords_gdscript_b)}, ['c'] = {syntax_keywords_gdscript_c, arr_count(syntax_keywords_gdscript_c)}, ['d'] = {syntax_keywords_gdscript_d, arr_count(syntax_keywords_gdscript_d)}, ['e'] = {syntax_keywords_gdscript_e, arr_count(syntax_keywords_gdscript_e)}, ['f'] = {syntax_keywords_gdscript_f, arr_count(syntax_keywords_gdscript_f)}, ['h'] = {syntax_keywords_gdscript_h, arr_count(syntax_keywords_gdscript_h)}, ['i'] = {syntax_keywords_gdscript_i, arr_count(syntax_keywords_gdscript_i)}, ['l'] = {syntax_keywords_gdscript_l, arr_count(syntax_keywords_gdscript_l)}, ['m'] = {syntax_keywords_gdscript_m, arr_count(syntax_keywords_gdscript_m)}, ['n'] = {syntax_keywords_gdscript_n, arr_count(syntax_keywords_gdscript_n)}, ['o'] = {syntax_keywords_gdscript_o, arr_count(syntax_keywords_gdscript_o)}, ['p'] = {syntax_keywords_gdscript_p, arr_count(syntax_keywords_gdscript_p)}, ['r'] = {syntax_keywords_gdscript_r, arr_count(syntax_keywords_gdscript_r)}, ['s'] = {syntax_keywords_gdscript_s, arr_count(syntax_keywords_gdscript_s)}, ['t'] = {syntax_keywords_gdscript_t, arr_count(syntax_keywords_gdscript_t)}, ['v'] = {syntax_keywords_gdscript_v, arr_count(syntax_keywords_gdscript_v)}, ['w'] = {syntax_keywords_gdscript_w, arr_count(syntax_keywords_gdscript_w)}, ['y'] = {syntax_keywords_gdscript_y, arr_count(syntax_keywords_gdscript_y)}
+static const Keyword syntax_keywords_gdscript[1029] = {{"StyleBoxTexture", 15, SYNTAX_BUILTIN},{"InputEventMouseMotion", 21, SYNTAX_BUILTIN},{"AudioEffectHighShelfFilter", 26, SYNTAX_BUILTIN},{"InputEventMIDI", 14, SYNTAX_BUILTIN},{"VisualShaderNodeTexture", 23, SYNTAX_BUILTIN},{"AnimatableBody3D", 16, SYNTAX_BUILTIN},{"VisualShaderNodeLinearSceneDepth", 32, SYNTAX_BUILTIN},{"RDShaderSPIRV", 13, SYNTAX_BUILTIN},{"Curve3D", 7, SYNTAX_BUILTIN},{"randf_range", 11, SYNTAX_BUILTIN},{"RDTextureFormat", 15, SYNTAX_BUILTIN},{"NoiseTexture2D", 14, SYNTAX_BUILTIN},{"AudioStreamMicrophone", 21, SYNTAX_BUILTIN},{"cubic_interpolate_angle_in_time", 31, SYNTAX_BUILTIN},{"VisualShaderNodeVec4Constant", 28, SYNTAX_BUILTIN},{"GraphEdit", 9, SYNTAX_BUILTIN},{"HTTPRequest", 11, SYNTAX_BUILTIN},{"JavaScriptObject", 16, SYNTAX_BUILTIN},{"GridContainer", 13, SYNTAX_BUILTIN},{"AABB", 4, SYNTAX_BUILTIN},{"FileDialog", 10, SYNTAX_BUILTIN},{"Vector4i", 8, SYNTAX_BUILTIN},{"AnimationNodeAnimation", 22, SYNTAX_BUILTIN},{"EditorResourcePreviewGenerator", 30, SYNTAX_BUILTIN},{"LightmapProbe", 13, SYNTAX_BUILTIN},{"Path3D", 6, SYNTAX_BUILTIN},{"StyleBoxFlat", 12, SYNTAX_BUILTIN},{"PhysicsTestMotionParameters2D", 29, SYNTAX_BUILTIN},{"SkeletonModification2DLookAt", 28, SYNTAX_BUILTIN},{"TextParagraph", 13, SYNTAX_BUILTIN},{"SkeletonProfileHumanoid", 23, SYNTAX_BUILTIN},{"RDPipelineRasterizationState", 28, SYNTAX_BUILTIN},{"RDShaderFile", 12, SYNTAX_BUILTIN},{"AnimationRootNode", 17, SYNTAX_BUILTIN},{"AudioEffectRecord", 17, SYNTAX_BUILTIN},{"AudioStreamRandomizer", 21, SYNTAX_BUILTIN},{"EditorSettings", 14, SYNTAX_BUILTIN},{"NavigationMeshSourceGeometryData3D", 34, SYNTAX_BUILTIN},{"if", 2, SYNTAX_KEYWORD},{"CodeHighlighter", 15, SYNTAX_BUILTIN},{"X509Certificate", 15, SYNTAX_BUILTIN},{"AudioStreamPlayer3D", 19, SYNTAX_BUILTIN},{"PhysicsDirectBodyState3DExtension", 33, SYNTAX_BUILTIN},{"ENetConnection", 14, SYNTAX_BUILTIN},{"AudioEffect", 11, SYNTAX_BUILTIN},{"GodotSharp", 10, SYNTAX_BUILTIN},{"OpenXRInteractionProfile", 24, SYNTAX_BUILTIN},{"is_instance_id_valid", 20, SYNTAX_BUILTIN},{"var", 3, SYNTAX_KEYWORD},{"EncodedObjectAsID", 17, SYNTAX_BUILTIN},{"SphereOccluder3D", 16, SYNTAX_BUILTIN},{"ProgressBar", 11, SYNTAX_BUILTIN},{"PackedVector3Array", 18, SYNTAX_BUILTIN},{"VisualShaderNodeVectorCompose", 29, SYNTAX_BUILTIN},{"RichTextLabel", 13, SYNTAX_BUILTIN},{"typeof", 6, SYNTAX_BUILTIN},{"Shortcut", 8, SYNTAX_BUILTIN},{"SpriteBase3D", 12, SYNTAX_BUILTIN},{"NavigationLink3D", 16, SYNTAX_BUILTIN},{"RandomNumberGenerator", 21, SYNTAX_BUILTIN},{"ease", 4, SYNTAX_BUILTIN},{"GeometryInstance3D", 18, SYNTAX_BUILTIN},{"AnimatableBody2D", 16, SYNTAX_BUILTIN},{"CenterContainer", 15, SYNTAX_BUILTIN},{"WorldBoundaryShape3D", 20, SYNTAX_BUILTIN},{"AudioEffectBandPassFilter", 25, SYNTAX_BUILTIN},{"AnimationNodeTimeScale", 22, SYNTAX_BUILTIN},{"wrapi", 5, SYNTAX_BUILTIN},{"PhysicsMaterial", 15, SYNTAX_BUILTIN},{"XRPose", 6, SYNTAX_BUILTIN},{"CompressedTexture2D", 19, SYNTAX_BUILTIN},{"for", 3, SYNTAX_KEYWORD},{"CSGPolygon3D", 12, SYNTAX_BUILTIN},{"Gradient", 8, SYNTAX_BUILTIN},{"VisualShaderNodeParticleConeVelocity", 36, SYNTAX_BUILTIN},{"VisualShaderNodeColorConstant", 29, SYNTAX_BUILTIN},{"EditorExportPlatformWeb", 23, SYNTAX_BUILTIN},{"roundf", 6, SYNTAX_BUILTIN},{"is", 2, SYNTAX_KEYWORD},{"LinkButton", 10, SYNTAX_BUILTIN},{"floor", 5, SYNTAX_BUILTIN},{"StreamPeerExtension", 19, SYNTAX_BUILTIN},{"PhysicsDirectBodyState3D", 24, SYNTAX_BUILTIN},{"ConeTwistJoint3D", 16, SYNTAX_BUILTIN},{"PlaneMesh", 9, SYNTAX_BUILTIN},{"FileSystemDock", 14, SYNTAX_BUILTIN},{"PhysicsPointQueryParameters3D", 29, SYNTAX_BUILTIN},{"AudioEffectAmplify", 18, SYNTAX_BUILTIN},{"GLTFCamera", 10, SYNTAX_BUILTIN},{"VisualShaderNodeTextureSDFNormal", 32, SYNTAX_BUILTIN},{"VisualShaderNodeUIntParameter", 29, SYNTAX_BUILTIN},{"CollisionShape2D", 16, SYNTAX_BUILTIN},{"AnimationNodeAdd3", 17, SYNTAX_BUILTIN},{"SkeletonModification2DTwoBoneIK", 31, SYNTAX_BUILTIN},{"VisualShaderNodeParticleSphereEmitter", 37, SYNTAX_BUILTIN},{"Container", 9, SYNTAX_BUILTIN},{"StyleBox", 8, SYNTAX_BUILTIN},{"PackedInt64Array", 16, SYNTAX_BUILTIN},{"NavigationRegion2D", 18, SYNTAX_BUILTIN},{"GLTFAnimation", 13, SYNTAX_BUILTIN},{"AnimationNodeBlend2", 19, SYNTAX_BUILTIN},{"GPUParticlesCollision3D", 23, SYNTAX_BUILTIN},{"Expression", 10, SYNTAX_BUILTIN},{"EditorCommandPalette", 20, SYNTAX_BUILTIN},{"InputEventPanGesture", 20, SYNTAX_BUILTIN},{"AudioStreamPlaybackPolyphonic", 29, SYNTAX_BUILTIN},{"CylinderMesh", 12, SYNTAX_BUILTIN},{"VisualShaderNodeConstant", 24, SYNTAX_BUILTIN},{"PointLight2D", 12, SYNTAX_BUILTIN},{"ItemList", 8, SYNTAX_BUILTIN},{"BackBufferCopy", 14, SYNTAX_BUILTIN},{"lerp", 4, SYNTAX_BUILTIN},{"snappedf", 8, SYNTAX_BUILTIN},{"cubic_interpolate", 17, SYNTAX_BUILTIN},{"ScriptExtension", 15, SYNTAX_BUILTIN},{"WebSocketMultiplayerPeer", 24, SYNTAX_BUILTIN},{"ShapeCast3D", 11, SYNTAX_BUILTIN},{"ProjectSettings", 15, SYNTAX_BUILTIN},{"PlaceholderTexture2DArray", 25, SYNTAX_BUILTIN},{"RegExMatch", 10, SYNTAX_BUILTIN},{"PhysicsDirectSpaceState3D", 25, SYNTAX_BUILTIN},{"WebXRInterface", 14, SYNTAX_BUILTIN},{"clamp", 5, SYNTAX_BUILTIN},{"JSONRPC", 7, SYNTAX_BUILTIN},{"VisualShaderNodeResizableBase", 29, SYNTAX_BUILTIN},{"AnimatedSprite3D", 16, SYNTAX_BUILTIN},{"ShaderInclude", 13, SYNTAX_BUILTIN},{"ParallaxLayer", 13, SYNTAX_BUILTIN},{"InputMap", 8, SYNTAX_BUILTIN},{"PacketPeer", 10, SYNTAX_BUILTIN},{"Rect2i", 6, SYNTAX_BUILTIN},{"CSGSphere3D", 11, SYNTAX_BUILTIN},{"VisualShaderNodeIntParameter", 28, SYNTAX_BUILTIN},{"EditorVCSInterface", 18, SYNTAX_BUILTIN},{"AudioEffectDelay", 16, SYNTAX_BUILTIN},{"NavigationRegion3D", 18, SYNTAX_BUILTIN},{"EditorNode3DGizmoPlugin", 23, SYNTAX_BUILTIN},{"CSGTorus3D", 10, SYNTAX_BUILTIN},{"PanelContainer", 14, SYNTAX_BUILTIN},{"VisualShaderNodeVaryingSetter", 29, SYNTAX_BUILTIN},{"MultiplayerAPIExtension", 23, SYNTAX_BUILTIN},{"ENetMultiplayerPeer", 19, SYNTAX_BUILTIN},{"GLTFLight", 9, SYNTAX_BUILTIN},{"EditorFileSystem", 16, SYNTAX_BUILTIN},{"IntervalTweener", 15, SYNTAX_BUILTIN},{"rand_from_seed", 14, SYNTAX_BUILTIN},{"str", 3, SYNTAX_BUILTIN},{"VisualShaderNodeDerivativeFunc", 30, SYNTAX_BUILTIN},{"OptionButton", 12, SYNTAX_BUILTIN},{"is_inf", 6, SYNTAX_BUILTIN},{"CallbackTweener", 15, SYNTAX_BUILTIN},{"ParticleProcessMaterial", 23, SYNTAX_BUILTIN},{"Quaternion", 10, SYNTAX_BUILTIN},{"VisualShaderNodeExpression", 26, SYNTAX_BUILTIN},{"ImageTextureLayered", 19, SYNTAX_BUILTIN},{"VisualShaderNodeParameter", 25, SYNTAX_BUILTIN},{"Callable", 8, SYNTAX_BUILTIN},{"VisualShaderNodeFloatOp", 23, SYNTAX_BUILTIN},{"preload", 7, SYNTAX_KEYWORD},{"ImageFormatLoader", 17, SYNTAX_BUILTIN},{"UDPServer", 9, SYNTAX_BUILTIN},{"is_finite", 9, SYNTAX_BUILTIN},{"Plane", 5, SYNTAX_BUILTIN},{"EditorFileSystemImportFormatSupportQuery", 40, SYNTAX_BUILTIN},{"CheckButton", 11, SYNTAX_BUILTIN},{"SpriteFrames", 12, SYNTAX_BUILTIN},{"VisualShaderNodeGlobalExpression", 32, SYNTAX_BUILTIN},{"randi_range", 11, SYNTAX_BUILTIN},{"CharacterBody2D", 15, SYNTAX_BUILTIN},{"AudioEffectPitchShift", 21, SYNTAX_BUILTIN},{"Marker3D", 8, SYNTAX_BUILTIN},{"while", 5, SYNTAX_KEYWORD},{"ZIPPacker", 9, SYNTAX_BUILTIN},{"TabContainer", 12, SYNTAX_BUILTIN},{"IP", 2, SYNTAX_BUILTIN},{"class_name", 10, SYNTAX_KEYWORD},{"PhysicsServer3DManager", 22, SYNTAX_BUILTIN},{"TileSetAtlasSource", 18, SYNTAX_BUILTIN},{"maxi", 4, SYNTAX_BUILTIN},{"XRAnchor3D", 10, SYNTAX_BUILTIN},{"Cubemap", 7, SYNTAX_BUILTIN},{"PhysicsBody2D", 13, SYNTAX_BUILTIN},{"printraw", 8, SYNTAX_BUILTIN},{"Material", 8, SYNTAX_BUILTIN},{"InstancePlaceholder", 19, SYNTAX_BUILTIN},{"continue", 8, SYNTAX_KEYWORD},{"PhysicsDirectBodyState2DExtension", 33, SYNTAX_BUILTIN},{"PortableCompressedTexture2D", 27, SYNTAX_BUILTIN},{"Camera3D", 8, SYNTAX_BUILTIN},{"VisualShaderNodeParticleRandomness", 34, SYNTAX_BUILTIN},{"cosh", 4, SYNTAX_BUILTIN},{"GLTFSkin", 8, SYNTAX_BUILTIN},{"VSlider", 7, SYNTAX_BUILTIN},{"AudioEffectSpectrumAnalyzerInstance", 35, SYNTAX_BUILTIN},{"VisualShaderNodeUVPolarCoord", 28, SYNTAX_BUILTIN},{"StreamPeer", 10, SYNTAX_BUILTIN},{"InputEventMouse", 15, SYNTAX_BUILTIN},{"InputEventFromWindow", 20, SYNTAX_BUILTIN},{"Node3D", 6, SYNTAX_BUILTIN},{"Vector4", 7, SYNTAX_BUILTIN},{"WebRTCDataChannelExtension", 26, SYNTAX_BUILTIN},{"EditorResourceConversionPlugin", 30, SYNTAX_BUILTIN},{"GLTFAccessor", 12, SYNTAX_BUILTIN},{"OptimizedTranslation", 20, SYNTAX_BUILTIN},{"Vector3", 7, SYNTAX_BUILTIN},{"Skeleton3D", 10, SYNTAX_BUILTIN},{"AStar3D", 7, SYNTAX_BUILTIN},{"VisualShaderNodeVec4Parameter", 29, SYNTAX_BUILTIN},{"UPNP", 4, SYNTAX_BUILTIN},{"MarginContainer", 15, SYNTAX_BUILTIN},{"VisualShaderNodeVec3Constant", 28, SYNTAX_BUILTIN},{"PhysicsDirectSpaceState2DExtension", 34, SYNTAX_BUILTIN},{"ResourceLoader", 14, SYNTAX_BUILTIN},{"TextureLayered", 14, SYNTAX_BUILTIN},{"EditorExportPlatformIOS", 23, SYNTAX_BUILTIN},{"CameraAttributesPractical", 25, SYNTAX_BUILTIN},{"is_same", 7, SYNTAX_BUILTIN},{"PackedDataContainerRef", 22, SYNTAX_BUILTIN},{"AnimationPlayer", 15, SYNTAX_BUILTIN},{"NavigationPathQueryParameters3D", 31, SYNTAX_BUILTIN},{"MultiplayerSpawner", 18, SYNTAX_BUILTIN},{"CryptoKey", 9, SYNTAX_BUILTIN},{"exp", 3, SYNTAX_BUILTIN},{"VisualShaderNodeScreenUVToSDF", 29, SYNTAX_BUILTIN},{"InputEventScreenTouch", 21, SYNTAX_BUILTIN},{"MissingNode", 11, SYNTAX_BUILTIN},{"MultiplayerAPI", 14, SYNTAX_BUILTIN},{"WebSocketPeer", 13, SYNTAX_BUILTIN},{"LightmapperRD", 13, SYNTAX_BUILTIN},{"Joint2D", 7, SYNTAX_BUILTIN},{"ArrayOccluder3D", 15, SYNTAX_BUILTIN},{"nearest_po2", 11, SYNTAX_BUILTIN},{"Geometry2D", 10, SYNTAX_BUILTIN},{"XMLParser", 9, SYNTAX_BUILTIN},{"SceneState", 10, SYNTAX_BUILTIN},{"Decal", 5, SYNTAX_BUILTIN},{"RootMotionView", 14, SYNTAX_BUILTIN},{"TAU", 3, SYNTAX_CONSTANT},{"GLTFDocumentExtensionConvertImporterMesh", 40, SYNTAX_BUILTIN},{"XRNode3D", 8, SYNTAX_BUILTIN},{"TextServerManager", 17, SYNTAX_BUILTIN},{"PathFollow2D", 12, SYNTAX_BUILTIN},{"EditorSceneFormatImporter", 25, SYNTAX_BUILTIN},{"return", 6, SYNTAX_KEYWORD},{"CurveXYZTexture", 15, SYNTAX_BUILTIN},{"atan2", 5, SYNTAX_BUILTIN},{"print_rich", 10, SYNTAX_BUILTIN},{"AnimationNodeStateMachineTransition", 35, SYNTAX_BUILTIN},{"ceilf", 5, SYNTAX_BUILTIN},{"AudioEffectSpectrumAnalyzer", 27, SYNTAX_BUILTIN},{"CanvasLayer", 11, SYNTAX_BUILTIN},{"EngineDebugger", 14, SYNTAX_BUILTIN},{"HashingContext", 14, SYNTAX_BUILTIN},{"RDSamplerState", 14, SYNTAX_BUILTIN},{"GDScript", 8, SYNTAX_BUILTIN},{"VisualShaderNodeTextureParameter", 32, SYNTAX_BUILTIN},{"VisualShaderNodeCubemapParameter", 32, SYNTAX_BUILTIN},{"PlaceholderMesh", 15, SYNTAX_BUILTIN},{"PlaceholderTexture3D", 20, SYNTAX_BUILTIN},{"INF", 3, SYNTAX_CONSTANT},{"snappedi", 8, SYNTAX_BUILTIN},{"VisualShaderNodeOuterProduct", 28, SYNTAX_BUILTIN},{"ConcavePolygonShape2D", 21, SYNTAX_BUILTIN},{"CSGCylinder3D", 13, SYNTAX_BUILTIN},{"FontFile", 8, SYNTAX_BUILTIN},{"var_to_bytes_with_objects", 25, SYNTAX_BUILTIN},{"QuadOccluder3D", 14, SYNTAX_BUILTIN},{"MeshConvexDecompositionSettings", 31, SYNTAX_BUILTIN},{"KinematicCollision2D", 20, SYNTAX_BUILTIN},{"Occluder3D", 10, SYNTAX_BUILTIN},{"VideoStreamTheora", 17, SYNTAX_BUILTIN},{"AnimationTree", 13, SYNTAX_BUILTIN},{"HSlider", 7, SYNTAX_BUILTIN},{"CSGBox3D", 8, SYNTAX_BUILTIN},{"RDPipelineSpecializationConstant", 32, SYNTAX_BUILTIN},{"TextMesh", 8, SYNTAX_BUILTIN},{"SurfaceTool", 11, SYNTAX_BUILTIN},{"HingeJoint3D", 12, SYNTAX_BUILTIN},{"atan", 4, SYNTAX_BUILTIN},{"Label3D", 7, SYNTAX_BUILTIN},{"PCKPacker", 9, SYNTAX_BUILTIN},{"CollisionShape3D", 16, SYNTAX_BUILTIN},{"Texture", 7, SYNTAX_BUILTIN},{"VSplitContainer", 15, SYNTAX_BUILTIN},{"CompressedTexture3D", 19, SYNTAX_BUILTIN},{"VisualShaderNodeParticleBoxEmitter", 34, SYNTAX_BUILTIN},{"AudioEffectChorus", 17, SYNTAX_BUILTIN},{"Marshalls", 9, SYNTAX_BUILTIN},{"RDFramebufferPass", 17, SYNTAX_BUILTIN},{"BoxOccluder3D", 13, SYNTAX_BUILTIN},{"EditorScript", 12, SYNTAX_BUILTIN},{"PhysicsBody3D", 13, SYNTAX_BUILTIN},{"AudioStreamOggVorbis", 20, SYNTAX_BUILTIN},{"StaticBody3D", 12, SYNTAX_BUILTIN},{"Polygon2D", 9, SYNTAX_BUILTIN},{"HScrollBar", 10, SYNTAX_BUILTIN},{"EditorFileSystemDirectory", 25, SYNTAX_BUILTIN},{"VisibleOnScreenNotifier2D", 25, SYNTAX_BUILTIN},{"GraphNode", 9, SYNTAX_BUILTIN},{"ceil", 4, SYNTAX_BUILTIN},{"else", 4, SYNTAX_KEYWORD},{"Area2D", 6, SYNTAX_BUILTIN},{"AudioStreamPlaybackOggVorbis", 28, SYNTAX_BUILTIN},{"BoxMesh", 7, SYNTAX_BUILTIN},{"AnimationNodeOneShot", 20, SYNTAX_BUILTIN},{"MultiplayerSynchronizer", 23, SYNTAX_BUILTIN},{"AnimationNodeTimeSeek", 21, SYNTAX_BUILTIN},{"TextServerDummy", 15, SYNTAX_BUILTIN},{"SpotLight3D", 11, SYNTAX_BUILTIN},{"ThemeDB", 7, SYNTAX_BUILTIN},{"instance_from_id", 16, SYNTAX_BUILTIN},{"CurveTexture", 12, SYNTAX_BUILTIN},{"EditorInspectorPlugin", 21, SYNTAX_BUILTIN},{"PackedStringArray", 17, SYNTAX_BUILTIN},{"InputEventJoypadMotion", 22, SYNTAX_BUILTIN},{"VisualShaderNodeBooleanConstant", 31, SYNTAX_BUILTIN},{"TileMap", 7, SYNTAX_BUILTIN},{"VisualShaderNodeParticleAccelerator", 35, SYNTAX_BUILTIN},{"VisualShaderNodeFloatParameter", 30, SYNTAX_BUILTIN},{"TextureButton", 13, SYNTAX_BUILTIN},{"Engine", 6, SYNTAX_BUILTIN},{"StreamPeerGZIP", 14, SYNTAX_BUILTIN},{"AnimationNodeTransition", 23, SYNTAX_BUILTIN},{"World3D", 7, SYNTAX_BUILTIN},{"RemoteTransform3D", 17, SYNTAX_BUILTIN},{"TorusMesh", 9, SYNTAX_BUILTIN},{"EditorSceneFormatImporterFBX", 28, SYNTAX_BUILTIN},{"acos", 4, SYNTAX_BUILTIN},{"Time", 4, SYNTAX_BUILTIN},{"Curve", 5, SYNTAX_BUILTIN},{"EditorResourceTooltipPlugin", 27, SYNTAX_BUILTIN},{"NavigationObstacle3D", 20, SYNTAX_BUILTIN},{"VisualShaderNodeRandomRange", 27, SYNTAX_BUILTIN},{"TouchScreenButton", 17, SYNTAX_BUILTIN},{"yield", 5, SYNTAX_KEYWORD},{"seed", 4, SYNTAX_BUILTIN},{"XROrigin3D", 10, SYNTAX_BUILTIN},{"GLTFSpecGloss", 13, SYNTAX_BUILTIN},{"NinePatchRect", 13, SYNTAX_BUILTIN},{"ConcavePolygonShape3D", 21, SYNTAX_BUILTIN},{"EditorSpinSlider", 16, SYNTAX_BUILTIN},{"absi", 4, SYNTAX_BUILTIN},{"NavigationMesh", 14, SYNTAX_BUILTIN},{"MeshInstance2D", 14, SYNTAX_BUILTIN},{"SliderJoint3D", 13, SYNTAX_BUILTIN},{"StandardMaterial3D", 18, SYNTAX_BUILTIN},{"ImageTexture", 12, SYNTAX_BUILTIN},{"Viewport", 8, SYNTAX_BUILTIN},{"PinJoint3D", 10, SYNTAX_BUILTIN},{"CSGCombiner3D", 13, SYNTAX_BUILTIN},{"VisualShaderNodeParticleEmitter", 31, SYNTAX_BUILTIN},{"posmod", 6, SYNTAX_BUILTIN},{"AudioEffectEQ10", 15, SYNTAX_BUILTIN},{"TabBar", 6, SYNTAX_BUILTIN},{"CanvasModulate", 14, SYNTAX_BUILTIN},{"EditorExportPlatformPC", 22, SYNTAX_BUILTIN},{"PrimitiveMesh", 13, SYNTAX_BUILTIN},{"VisualShaderNodeIntConstant", 27, SYNTAX_BUILTIN},{"bezier_interpolate", 18, SYNTAX_BUILTIN},{"AudioEffectBandLimitFilter", 26, SYNTAX_BUILTIN},{"var_to_str", 10, SYNTAX_BUILTIN},{"VideoStreamPlayback", 19, SYNTAX_BUILTIN},{"AnimationNodeSub2", 17, SYNTAX_BUILTIN},{"AnimatedTexture", 15, SYNTAX_BUILTIN},{"XRInterfaceExtension", 20, SYNTAX_BUILTIN},{"VisibleOnScreenNotifier3D", 25, SYNTAX_BUILTIN},{"GLTFPhysicsBody", 15, SYNTAX_BUILTIN},{"OfflineMultiplayerPeer", 22, SYNTAX_BUILTIN},{"Curve2D", 7, SYNTAX_BUILTIN},{"SceneMultiplayer", 16, SYNTAX_BUILTIN},{"Color", 5, SYNTAX_BUILTIN},{"VisualShaderNodeTexture3D", 25, SYNTAX_BUILTIN},{"TextureRect", 11, SYNTAX_BUILTIN},{"AudioStreamMP3", 14, SYNTAX_BUILTIN},{"AudioStreamPolyphonic", 21, SYNTAX_BUILTIN},{"ZIPReader", 9, SYNTAX_BUILTIN},{"Rect2", 5, SYNTAX_BUILTIN},{"EditorSyntaxHighlighter", 23, SYNTAX_BUILTIN},{"LabelSettings", 13, SYNTAX_BUILTIN},{"CollisionObject3D", 17, SYNTAX_BUILTIN},{"ViewportTexture", 15, SYNTAX_BUILTIN},{"VisualShaderNodeSample3D", 24, SYNTAX_BUILTIN},{"VisualShaderNodeOutput", 22, SYNTAX_BUILTIN},{"Script", 6, SYNTAX_BUILTIN},{"wrap", 4, SYNTAX_BUILTIN},{"PlaceholderCubemapArray", 23, SYNTAX_BUILTIN},{"GLTFDocument", 12, SYNTAX_BUILTIN},{"AudioEffectNotchFilter", 22, SYNTAX_BUILTIN},{"AnimationNodeAdd2", 17, SYNTAX_BUILTIN},{"ClassDB", 7, SYNTAX_BUILTIN},{"AudioEffectLowPassFilter", 24, SYNTAX_BUILTIN},{"is_equal_approx", 15, SYNTAX_BUILTIN},{"cubic_interpolate_angle", 23, SYNTAX_BUILTIN},{"Path2D", 6, SYNTAX_BUILTIN},{"PackedFloat32Array", 18, SYNTAX_BUILTIN},{"HSplitContainer", 15, SYNTAX_BUILTIN},{"ColorPicker", 11, SYNTAX_BUILTIN},{"MobileVRInterface", 17, SYNTAX_BUILTIN},{"EditorExportPlatform", 20, SYNTAX_BUILTIN},{"error_string", 12, SYNTAX_BUILTIN},{"GradientTexture2D", 17, SYNTAX_BUILTIN},{"PhysicsDirectSpaceState2D", 25, SYNTAX_BUILTIN},{"AnimationNodeSync", 17, SYNTAX_BUILTIN},{"VisualShaderNodeDotProduct", 26, SYNTAX_BUILTIN},{"GPUParticles2D", 14, SYNTAX_BUILTIN},{"OmniLight3D", 11, SYNTAX_BUILTIN},{"ArrayMesh", 9, SYNTAX_BUILTIN},{"ConvexPolygonShape2D", 20, SYNTAX_BUILTIN},{"signf", 5, SYNTAX_BUILTIN},{"Mesh", 4, SYNTAX_BUILTIN},{"JSON", 4, SYNTAX_BUILTIN},{"ReflectionProbe", 15, SYNTAX_BUILTIN},{"ScriptLanguage", 14, SYNTAX_BUILTIN},{"AnimationNode", 13, SYNTAX_BUILTIN},{"SkeletonModification2DCCDIK", 27, SYNTAX_BUILTIN},{"VideoStreamPlayer", 17, SYNTAX_BUILTIN},{"AESContext", 10, SYNTAX_BUILTIN},{"Dictionary", 10, SYNTAX_BUILTIN},{"Semaphore", 9, SYNTAX_BUILTIN},{"TileSet", 7, SYNTAX_BUILTIN},{"CompressedTextureLayered", 24, SYNTAX_BUILTIN},{"floorf", 6, SYNTAX_BUILTIN},{"CharFXTransform", 15, SYNTAX_BUILTIN},{"TileSetScenesCollectionSource", 29, SYNTAX_BUILTIN},{"SphereMesh", 10, SYNTAX_BUILTIN},{"NavigationMeshGenerator", 23, SYNTAX_BUILTIN},{"XRInterface", 11, SYNTAX_BUILTIN},{"FontVariation", 13, SYNTAX_BUILTIN},{"SkeletonProfile", 15, SYNTAX_BUILTIN},{"EditorExportPlatformAndroid", 27, SYNTAX_BUILTIN},{"Slider", 6, SYNTAX_BUILTIN},{"VideoStream", 11, SYNTAX_BUILTIN},{"Window", 6, SYNTAX_BUILTIN},{"NavigationServer3D", 18, SYNTAX_BUILTIN},{"ResourceFormatSaver", 19, SYNTAX_BUILTIN},{"SkeletonModification2DJiggle", 28, SYNTAX_BUILTIN},{"AudioEffectEQ", 13, SYNTAX_BUILTIN},{"AspectRatioContainer", 20, SYNTAX_BUILTIN},{"VisualShader", 12, SYNTAX_BUILTIN},{"DirectionalLight2D", 18, SYNTAX_BUILTIN},{"SplitContainer", 14, SYNTAX_BUILTIN},{"signi", 5, SYNTAX_BUILTIN},{"Button", 6, SYNTAX_BUILTIN},{"VisualShaderNodeCubemap", 23, SYNTAX_BUILTIN},{"SystemFont", 10, SYNTAX_BUILTIN},{"InputEventScreenDrag", 20, SYNTAX_BUILTIN},{"Shader", 6, SYNTAX_BUILTIN},{"GPUParticlesAttractorBox3D", 26, SYNTAX_BUILTIN},{"rid_from_int64", 14, SYNTAX_BUILTIN},{"Node", 4, SYNTAX_BUILTIN},{"VisualShaderNodeColorParameter", 30, SYNTAX_BUILTIN},{"AudioEffectEQ21", 15, SYNTAX_BUILTIN},{"OpenXRActionSet", 15, SYNTAX_BUILTIN},{"CSGMesh3D", 9, SYNTAX_BUILTIN},{"ShapeCast2D", 11, SYNTAX_BUILTIN},{"OpenXRHand", 10, SYNTAX_BUILTIN},{"Node2D", 6, SYNTAX_BUILTIN},{"InputEventAction", 16, SYNTAX_BUILTIN},{"CapsuleShape2D", 14, SYNTAX_BUILTIN},{"Theme", 5, SYNTAX_BUILTIN},{"BitMap", 6, SYNTAX_BUILTIN},{"MultiplayerPeerExtension", 24, SYNTAX_BUILTIN},{"ButtonGroup", 11, SYNTAX_BUILTIN},{"CollisionPolygon2D", 18, SYNTAX_BUILTIN},{"wrapf", 5, SYNTAX_BUILTIN},{"AudioStreamPlaybackResampled", 28, SYNTAX_BUILTIN},{"CameraAttributes", 16, SYNTAX_BUILTIN},{"InputEvent", 10, SYNTAX_BUILTIN},{"SkeletonModification2D", 22, SYNTAX_BUILTIN},{"round", 5, SYNTAX_BUILTIN},{"SkeletonModification2DPhysicalBones", 35, SYNTAX_BUILTIN},{"Tween", 5, SYNTAX_BUILTIN},{"cubic_interpolate_in_time", 25, SYNTAX_BUILTIN},{"StringName", 10, SYNTAX_BUILTIN},{"Texture2D", 9, SYNTAX_BUILTIN},{"ScriptEditorBase", 16, SYNTAX_BUILTIN},{"ImporterMeshInstance3D", 22, SYNTAX_BUILTIN},{"VisualShaderNodeParameterRef", 28, SYNTAX_BUILTIN},{"LightmapGI", 10, SYNTAX_BUILTIN},{"Sprite3D", 8, SYNTAX_BUILTIN},{"JNISingleton", 12, SYNTAX_BUILTIN},{"XRController3D", 14, SYNTAX_BUILTIN},{"Panel", 5, SYNTAX_BUILTIN},{"Object", 6, SYNTAX_BUILTIN},{"CanvasTexture", 13, SYNTAX_BUILTIN},{"VisualShaderNodeIs", 18, SYNTAX_BUILTIN},{"PhysicsTestMotionParameters3D", 29, SYNTAX_BUILTIN},{"FogVolume", 9, SYNTAX_BUILTIN},{"CameraTexture", 13, SYNTAX_BUILTIN},{"EditorInterface", 15, SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DArrayParameter", 39, SYNTAX_BUILTIN},{"AnimationNodeOutput", 19, SYNTAX_BUILTIN},{"NodePath", 8, SYNTAX_BUILTIN},{"VisualShaderNodeTransformDecompose", 34, SYNTAX_BUILTIN},{"AnimationNodeStateMachine", 25, SYNTAX_BUILTIN},{"VisualShaderNodeFloatFunc", 25, SYNTAX_BUILTIN},{"PackedFloat64Array", 18, SYNTAX_BUILTIN},{"bytes_to_var", 12, SYNTAX_BUILTIN},{"CodeEdit", 8, SYNTAX_BUILTIN},{"CharacterBody3D", 15, SYNTAX_BUILTIN},{"GLTFMesh", 8, SYNTAX_BUILTIN},{"EditorExportPlatformWindows", 27, SYNTAX_BUILTIN},{"CheckBox", 8, SYNTAX_BUILTIN},{"Transform3D", 11, SYNTAX_BUILTIN},{"MultiMeshInstance3D", 19, SYNTAX_BUILTIN},{"EditorExportPlugin", 18, SYNTAX_BUILTIN},{"HFlowContainer", 14, SYNTAX_BUILTIN},{"KinematicCollision3D", 20, SYNTAX_BUILTIN},{"AnimatedSprite2D", 16, SYNTAX_BUILTIN},{"World2D", 7, SYNTAX_BUILTIN},{"VScrollBar", 10, SYNTAX_BUILTIN},{"VisualShaderNodeVectorDecompose", 31, SYNTAX_BUILTIN},{"Mutex", 5, SYNTAX_BUILTIN},{"InputEventShortcut", 18, SYNTAX_BUILTIN},{"PropertyTweener", 15, SYNTAX_BUILTIN},{"MeshTexture", 11, SYNTAX_BUILTIN},{"VisualShaderNodeVaryingGetter", 29, SYNTAX_BUILTIN},{"Tweener", 7, SYNTAX_BUILTIN},{"EditorInspector", 15, SYNTAX_BUILTIN},{"RibbonTrailMesh", 15, SYNTAX_BUILTIN},{"VisualShaderNodeColorFunc", 25, SYNTAX_BUILTIN},{"BoxContainer", 12, SYNTAX_BUILTIN},{"VBoxContainer", 13, SYNTAX_BUILTIN},{"Lightmapper", 11, SYNTAX_BUILTIN},{"VisualShaderNodeTransformVecMult", 32, SYNTAX_BUILTIN},{"Skeleton2D", 10, SYNTAX_BUILTIN},{"AStarGrid2D", 11, SYNTAX_BUILTIN},{"Shape3D", 7, SYNTAX_BUILTIN},{"VisualShaderNodeUIntFunc", 24, SYNTAX_BUILTIN},{"RDVertexAttribute", 17, SYNTAX_BUILTIN},{"NavigationPathQueryResult3D", 27, SYNTAX_BUILTIN},{"WorkerThreadPool", 16, SYNTAX_BUILTIN},{"VisualShaderNodeProximityFade", 29, SYNTAX_BUILTIN},{"NavigationLink2D", 16, SYNTAX_BUILTIN},{"Vector2", 7, SYNTAX_BUILTIN},{"pow", 3, SYNTAX_BUILTIN},{"VisualShaderNodeTransformOp", 27, SYNTAX_BUILTIN},{"GPUParticles3D", 14, SYNTAX_BUILTIN},{"MeshInstance3D", 14, SYNTAX_BUILTIN},{"CubemapArray", 12, SYNTAX_BUILTIN},{"Thread", 6, SYNTAX_BUILTIN},{"ImmediateMesh", 13, SYNTAX_BUILTIN},{"ColorRect", 9, SYNTAX_BUILTIN},{"OccluderPolygon2D", 17, SYNTAX_BUILTIN},{"TileSetSource", 13, SYNTAX_BUILTIN},{"AudioListener2D", 15, SYNTAX_BUILTIN},{"AudioEffectStereoEnhance", 24, SYNTAX_BUILTIN},{"PackedVector2Array", 18, SYNTAX_BUILTIN},{"EditorFeatureProfile", 20, SYNTAX_BUILTIN},{"hash", 4, SYNTAX_BUILTIN},{"EditorProperty", 14, SYNTAX_BUILTIN},{"sinh", 4, SYNTAX_BUILTIN},{"VisualShaderNodeCurveXYZTexture", 31, SYNTAX_BUILTIN},{"Light2D", 7, SYNTAX_BUILTIN},{"PhysicsRayQueryParameters3D", 27, SYNTAX_BUILTIN},{"remap", 5, SYNTAX_BUILTIN},{"CameraServer", 12, SYNTAX_BUILTIN},{"EditorDebuggerSession", 21, SYNTAX_BUILTIN},{"AudioEffectPhaser", 17, SYNTAX_BUILTIN},{"WebRTCPeerConnection", 20, SYNTAX_BUILTIN},{"minf", 4, SYNTAX_BUILTIN},{"VisibleOnScreenEnabler3D", 24, SYNTAX_BUILTIN},{"EditorImportPlugin", 18, SYNTAX_BUILTIN},{"NavigationAgent3D", 17, SYNTAX_BUILTIN},{"printt", 6, SYNTAX_BUILTIN},{"XRServer", 8, SYNTAX_BUILTIN},{"GradientTexture1D", 17, SYNTAX_BUILTIN},{"JavaClass", 9, SYNTAX_BUILTIN},{"GPUParticlesCollisionHeightField3D", 34, SYNTAX_BUILTIN},{"SyntaxHighlighter", 17, SYNTAX_BUILTIN},{"QuadMesh", 8, SYNTAX_BUILTIN},{"Array", 5, SYNTAX_BUILTIN},{"ResourceImporter", 16, SYNTAX_BUILTIN},{"GLTFTexture", 11, SYNTAX_BUILTIN},{"TLSOptions", 10, SYNTAX_BUILTIN},{"PackedDataContainer", 19, SYNTAX_BUILTIN},{"elif", 4, SYNTAX_KEYWORD},{"match", 5, SYNTAX_KEYWORD},{"ImporterMesh", 12, SYNTAX_BUILTIN},{"GLTFDocumentExtension", 21, SYNTAX_BUILTIN},{"VisualShaderNodeVectorLen", 25, SYNTAX_BUILTIN},{"randomize", 9, SYNTAX_BUILTIN},{"AnimationNodeBlendTree", 22, SYNTAX_BUILTIN},{"Control", 7, SYNTAX_BUILTIN},{"ImageFormatLoaderExtension", 26, SYNTAX_BUILTIN},{"ScriptLanguageExtension", 23, SYNTAX_BUILTIN},{"void", 4, SYNTAX_KEYWORD},{"AudioStreamGeneratorPlayback", 28, SYNTAX_BUILTIN},{"max", 3, SYNTAX_BUILTIN},{"EditorScriptPicker", 18, SYNTAX_BUILTIN},{"not", 3, SYNTAX_KEYWORD},{"OpenXRActionMap", 15, SYNTAX_BUILTIN},{"sqrt", 4, SYNTAX_BUILTIN},{"AudioEffectCapture", 18, SYNTAX_BUILTIN},{"VisualShaderNodeTransformParameter", 34, SYNTAX_BUILTIN},{"ScrollContainer", 15, SYNTAX_BUILTIN},{"OggPacketSequence", 17, SYNTAX_BUILTIN},{"RefCounted", 10, SYNTAX_BUILTIN},{"GPUParticlesCollisionBox3D", 26, SYNTAX_BUILTIN},{"floori", 6, SYNTAX_BUILTIN},{"ceili", 5, SYNTAX_BUILTIN},{"TextLine", 8, SYNTAX_BUILTIN},{"RDPipelineMultisampleState", 26, SYNTAX_BUILTIN},{"signal", 6, SYNTAX_KEYWORD},{"GLTFPhysicsShape", 16, SYNTAX_BUILTIN},{"VisualShaderNodeUVFunc", 22, SYNTAX_BUILTIN},{"GLTFNode", 8, SYNTAX_BUILTIN},{"MethodTweener", 13, SYNTAX_BUILTIN},{"WebRTCMultiplayerPeer", 21, SYNTAX_BUILTIN},{"weakref", 7, SYNTAX_BUILTIN},{"null", 4, SYNTAX_CONSTANT},{"VisualShaderNodeParticleMeshEmitter", 35, SYNTAX_BUILTIN},{"MultiplayerPeer", 15, SYNTAX_BUILTIN},{"Performance", 11, SYNTAX_BUILTIN},{"RDUniform", 9, SYNTAX_BUILTIN},{"class", 5, SYNTAX_KEYWORD},{"ReferenceRect", 13, SYNTAX_BUILTIN},{"SpringArm3D", 11, SYNTAX_BUILTIN},{"as", 2, SYNTAX_KEYWORD},{"EditorUndoRedoManager", 21, SYNTAX_BUILTIN},{"CameraFeed", 10, SYNTAX_BUILTIN},{"Area3D", 6, SYNTAX_BUILTIN},{"db_to_linear", 12, SYNTAX_BUILTIN},{"RDPipelineDepthStencilState", 27, SYNTAX_BUILTIN},{"AnimationLibrary", 16, SYNTAX_BUILTIN},{"TCPServer", 9, SYNTAX_BUILTIN},{"AudioEffectLowShelfFilter", 25, SYNTAX_BUILTIN},{"MainLoop", 8, SYNTAX_BUILTIN},{"is_nan", 6, SYNTAX_BUILTIN},{"CSGShape3D", 10, SYNTAX_BUILTIN},{"CPUParticles2D", 14, SYNTAX_BUILTIN},{"randi", 5, SYNTAX_BUILTIN},{"PhysicsServer3D", 15, SYNTAX_BUILTIN},{"RDPipelineColorBlendState", 25, SYNTAX_BUILTIN},{"Texture2DArray", 14, SYNTAX_BUILTIN},{"fmod", 4, SYNTAX_BUILTIN},{"EditorSelection", 15, SYNTAX_BUILTIN},{"move_toward", 11, SYNTAX_BUILTIN},{"Shape2D", 7, SYNTAX_BUILTIN},{"AtlasTexture", 12, SYNTAX_BUILTIN},{"FogMaterial", 11, SYNTAX_BUILTIN},{"StreamPeerTCP", 13, SYNTAX_BUILTIN},{"MeshDataTool", 12, SYNTAX_BUILTIN},{"Generic6DOFJoint3D", 18, SYNTAX_BUILTIN},{"TubeTrailMesh", 13, SYNTAX_BUILTIN},{"static", 6, SYNTAX_KEYWORD},{"CapsuleMesh", 11, SYNTAX_BUILTIN},{"PopupPanel", 10, SYNTAX_BUILTIN},{"maxf", 4, SYNTAX_BUILTIN},{"CompressedCubemapArray", 22, SYNTAX_BUILTIN},{"VisualShaderNodeFaceForward", 27, SYNTAX_BUILTIN},{"SkeletonModification2DFABRIK", 28, SYNTAX_BUILTIN},{"VisualShaderNodeTextureSDF", 26, SYNTAX_BUILTIN},{"VisualShaderNodeDistanceFade", 28, SYNTAX_BUILTIN},{"OggPacketSequencePlayback", 25, SYNTAX_BUILTIN},{"BoxShape3D", 10, SYNTAX_BUILTIN},{"RectangleShape2D", 16, SYNTAX_BUILTIN},{"TextServerAdvanced", 18, SYNTAX_BUILTIN},{"AnimationNodeStateMachinePlayback", 33, SYNTAX_BUILTIN},{"SubViewport", 11, SYNTAX_BUILTIN},{"DirAccess", 9, SYNTAX_BUILTIN},{"RichTextEffect", 14, SYNTAX_BUILTIN},{"rad_to_deg", 10, SYNTAX_BUILTIN},{"LightOccluder2D", 15, SYNTAX_BUILTIN},{"fposmod", 7, SYNTAX_BUILTIN},{"VisualShaderNodeBooleanParameter", 32, SYNTAX_BUILTIN},{"asin", 4, SYNTAX_BUILTIN},{"GPUParticlesCollisionSphere3D", 29, SYNTAX_BUILTIN},{"TextServerFallback", 18, SYNTAX_BUILTIN},{"InputEventMouseButton", 21, SYNTAX_BUILTIN},{"GLTFTextureSampler", 18, SYNTAX_BUILTIN},{"print_verbose", 13, SYNTAX_BUILTIN},{"HSeparator", 10, SYNTAX_BUILTIN},{"PathFollow3D", 12, SYNTAX_BUILTIN},{"randf", 5, SYNTAX_BUILTIN},{"VisualShaderNodeFloatConstant", 29, SYNTAX_BUILTIN},{"RDShaderSource", 14, SYNTAX_BUILTIN},{"VisualShaderNodeVectorFunc", 26, SYNTAX_BUILTIN},{"VisualShaderNodeVec2Parameter", 29, SYNTAX_BUILTIN},{"GPUParticlesAttractorVectorField3D", 34, SYNTAX_BUILTIN},{"false", 5, SYNTAX_CONSTANT},{"NavigationPolygon", 17, SYNTAX_BUILTIN},{"SeparationRayShape3D", 20, SYNTAX_BUILTIN},{"AudioListener3D", 15, SYNTAX_BUILTIN},{"VisualShaderNodeSDFRaymarch", 27, SYNTAX_BUILTIN},{"var_to_bytes", 12, SYNTAX_BUILTIN},{"LightmapGIData", 14, SYNTAX_BUILTIN},{"RegEx", 5, SYNTAX_BUILTIN},{"await", 5, SYNTAX_KEYWORD},{"InputEventKey", 13, SYNTAX_BUILTIN},{"Timer", 5, SYNTAX_BUILTIN},{"NavigationServer2D", 18, SYNTAX_BUILTIN},{"RenderingServer", 15, SYNTAX_BUILTIN},{"or", 2, SYNTAX_KEYWORD},{"VisualInstance3D", 16, SYNTAX_BUILTIN},{"PhysicsTestMotionResult3D", 25, SYNTAX_BUILTIN},{"CanvasItemMaterial", 18, SYNTAX_BUILTIN},{"linear_to_db", 12, SYNTAX_BUILTIN},{"RayCast2D", 9, SYNTAX_BUILTIN},{"randfn", 6, SYNTAX_BUILTIN},{"MissingResource", 15, SYNTAX_BUILTIN},{"CircleShape2D", 13, SYNTAX_BUILTIN},{"PolygonOccluder3D", 17, SYNTAX_BUILTIN},{"ConfirmationDialog", 18, SYNTAX_BUILTIN},{"ResourceFormatLoader", 20, SYNTAX_BUILTIN},{"EditorTranslationParserPlugin", 29, SYNTAX_BUILTIN},{"VisualShaderNodeUIntConstant", 28, SYNTAX_BUILTIN},{"ShaderMaterial", 14, SYNTAX_BUILTIN},{"VisibleOnScreenEnabler2D", 24, SYNTAX_BUILTIN},{"ParallaxBackground", 18, SYNTAX_BUILTIN},{"InputEventGesture", 17, SYNTAX_BUILTIN},{"SphereShape3D", 13, SYNTAX_BUILTIN},{"StreamPeerTLS", 13, SYNTAX_BUILTIN},{"TriangleMesh", 12, SYNTAX_BUILTIN},{"abs", 3, SYNTAX_BUILTIN},{"PackedColorArray", 16, SYNTAX_BUILTIN},{"const", 5, SYNTAX_KEYWORD},{"VisualShaderNodeCompare", 23, SYNTAX_BUILTIN},{"print", 5, SYNTAX_BUILTIN},{"String", 6, SYNTAX_BUILTIN},{"clampi", 6, SYNTAX_BUILTIN},{"PhysicsDirectBodyState2D", 24, SYNTAX_BUILTIN},{"WorldEnvironment", 16, SYNTAX_BUILTIN},{"pingpong", 8, SYNTAX_BUILTIN},{"GPUParticlesAttractor3D", 23, SYNTAX_BUILTIN},{"RemoteTransform2D", 17, SYNTAX_BUILTIN},{"self", 4, SYNTAX_KEYWORD},{"step_decimals", 13, SYNTAX_BUILTIN},{"HeightMapShape3D", 16, SYNTAX_BUILTIN},{"PlaceholderCubemap", 18, SYNTAX_BUILTIN},{"RenderingDevice", 15, SYNTAX_BUILTIN},{"PI", 2, SYNTAX_CONSTANT},{"DampedSpringJoint2D", 19, SYNTAX_BUILTIN},{"log", 3, SYNTAX_BUILTIN},{"PackedScene", 11, SYNTAX_BUILTIN},{"SoftBody3D", 10, SYNTAX_BUILTIN},{"Light3D", 7, SYNTAX_BUILTIN},{"SkeletonModification2DStackHolder", 33, SYNTAX_BUILTIN},{"min", 3, SYNTAX_BUILTIN},{"Vector3i", 8, SYNTAX_BUILTIN},{"OpenXRIPBinding", 15, SYNTAX_BUILTIN},{"VisualShaderNodeVectorBase", 26, SYNTAX_BUILTIN},{"RID", 3, SYNTAX_BUILTIN},{"VisualShaderNodeTransformFunc", 29, SYNTAX_BUILTIN},{"AudioEffectHighPassFilter", 25, SYNTAX_BUILTIN},{"PhysicsRayQueryParameters2D", 27, SYNTAX_BUILTIN},{"Crypto", 6, SYNTAX_BUILTIN},{"CSGPrimitive3D", 14, SYNTAX_BUILTIN},{"PacketPeerUDP", 13, SYNTAX_BUILTIN},{"PinJoint2D", 10, SYNTAX_BUILTIN},{"GridMap", 7, SYNTAX_BUILTIN},{"str_to_var", 10, SYNTAX_BUILTIN},{"CylinderShape3D", 15, SYNTAX_BUILTIN},{"RayCast3D", 9, SYNTAX_BUILTIN},{"SceneTreeTimer", 14, SYNTAX_BUILTIN},{"VisualShaderNodeGroupBase", 25, SYNTAX_BUILTIN},{"LineEdit", 8, SYNTAX_BUILTIN},{"SkinReference", 13, SYNTAX_BUILTIN},{"AudioEffectCompressor", 21, SYNTAX_BUILTIN},{"Resource", 8, SYNTAX_BUILTIN},{"VoxelGIData", 11, SYNTAX_BUILTIN},{"CanvasItem", 10, SYNTAX_BUILTIN},{"EditorScenePostImport", 21, SYNTAX_BUILTIN},{"ResourcePreloader", 17, SYNTAX_BUILTIN},{"VisualShaderNodeMix", 19, SYNTAX_BUILTIN},{"UndoRedo", 8, SYNTAX_BUILTIN},{"NoiseTexture3D", 14, SYNTAX_BUILTIN},{"true", 4, SYNTAX_CONSTANT},{"pass", 4, SYNTAX_KEYWORD},{"XRCamera3D", 10, SYNTAX_BUILTIN},{"EngineProfiler", 14, SYNTAX_BUILTIN},{"Label", 5, SYNTAX_BUILTIN},{"OpenXRAction", 12, SYNTAX_BUILTIN},{"PolygonPathFinder", 17, SYNTAX_BUILTIN},{"DTLSServer", 10, SYNTAX_BUILTIN},{"VisualShaderNodeParticleRingEmitter", 35, SYNTAX_BUILTIN},{"absf", 4, SYNTAX_BUILTIN},{"MultiMesh", 9, SYNTAX_BUILTIN},{"AudioEffectEQ6", 14, SYNTAX_BUILTIN},{"InputEventJoypadButton", 22, SYNTAX_BUILTIN},{"VisualShaderNode", 16, SYNTAX_BUILTIN},{"RDAttachmentFormat", 18, SYNTAX_BUILTIN},{"bezier_derivative", 17, SYNTAX_BUILTIN},{"VisualShaderNodeSmoothStep", 26, SYNTAX_BUILTIN},{"VisualShaderNodeCustom", 22, SYNTAX_BUILTIN},{"VisualShaderNodeVectorRefract", 29, SYNTAX_BUILTIN},{"PhysicsDirectSpaceState3DExtension", 34, SYNTAX_BUILTIN},{"Variant", 7, SYNTAX_BUILTIN},{"Bone2D", 6, SYNTAX_BUILTIN},{"FastNoiseLite", 13, SYNTAX_BUILTIN},{"Signal", 6, SYNTAX_BUILTIN},{"Popup", 5, SYNTAX_BUILTIN},{"VisualShaderNodeTransformConstant", 33, SYNTAX_BUILTIN},{"breakpoint", 10, SYNTAX_KEYWORD},{"snapped", 7, SYNTAX_BUILTIN},{"GPUParticlesCollisionSDF3D", 26, SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DParameter", 34, SYNTAX_BUILTIN},{"VisualShaderNodeCurveTexture", 28, SYNTAX_BUILTIN},{"AudioEffectLimiter", 18, SYNTAX_BUILTIN},{"JavaScriptBridge", 16, SYNTAX_BUILTIN},{"PhysicalBone3D", 14, SYNTAX_BUILTIN},{"CapsuleShape3D", 14, SYNTAX_BUILTIN},{"PacketPeerStream", 16, SYNTAX_BUILTIN},{"GLTFState", 9, SYNTAX_BUILTIN},{"Animation", 9, SYNTAX_BUILTIN},{"BoneAttachment3D", 16, SYNTAX_BUILTIN},{"VisualShaderNodeFresnel", 23, SYNTAX_BUILTIN},{"VisualShaderNodeUIntOp", 22, SYNTAX_BUILTIN},{"EditorDebuggerPlugin", 20, SYNTAX_BUILTIN},{"EditorExportPlatformMacOS", 25, SYNTAX_BUILTIN},{"bool", 4, SYNTAX_BUILTIN},{"PanoramaSkyMaterial", 19, SYNTAX_BUILTIN},{"ConvexPolygonShape3D", 20, SYNTAX_BUILTIN},{"VisualShaderNodeParticleEmit", 28, SYNTAX_BUILTIN},{"NavigationObstacle2D", 20, SYNTAX_BUILTIN},{"VisualShaderNodeComment", 23, SYNTAX_BUILTIN},{"Transform2D", 11, SYNTAX_BUILTIN},{"TextServer", 10, SYNTAX_BUILTIN},{"DisplayServer", 13, SYNTAX_BUILTIN},{"AudioEffectDistortion", 21, SYNTAX_BUILTIN},{"PhysicsServer2DManager", 22, SYNTAX_BUILTIN},{"GLTFBufferView", 14, SYNTAX_BUILTIN},{"StyleBoxLine", 12, SYNTAX_BUILTIN},{"printerr", 8, SYNTAX_BUILTIN},{"is_zero_approx", 14, SYNTAX_BUILTIN},{"ColorPickerButton", 17, SYNTAX_BUILTIN},{"SeparationRayShape2D", 20, SYNTAX_BUILTIN},{"CanvasGroup", 11, SYNTAX_BUILTIN},{"PhysicsServer2DExtension", 24, SYNTAX_BUILTIN},{"Input", 5, SYNTAX_BUILTIN},{"Font", 4, SYNTAX_BUILTIN},{"lerpf", 5, SYNTAX_BUILTIN},{"AnimationNodeBlendSpace1D", 25, SYNTAX_BUILTIN},{"VisualShaderNodeTransformCompose", 32, SYNTAX_BUILTIN},{"AudioStreamPlayer", 17, SYNTAX_BUILTIN},{"ResourceUID", 11, SYNTAX_BUILTIN},{"PlaceholderMaterial", 19, SYNTAX_BUILTIN},{"AudioStreamPlayer2D", 19, SYNTAX_BUILTIN},{"VisualShaderNodeParticleMultiplyByAxisAngle", 43, SYNTAX_BUILTIN},{"GrooveJoint2D", 13, SYNTAX_BUILTIN},{"TranslationServer", 17, SYNTAX_BUILTIN},{"MenuBar", 7, SYNTAX_BUILTIN},{"sign", 4, SYNTAX_BUILTIN},{"WebRTCPeerConnectionExtension", 29, SYNTAX_BUILTIN},{"prints", 6, SYNTAX_BUILTIN},{"VisualShaderNodeParticleOutput", 30, SYNTAX_BUILTIN},{"AudioEffectInstance", 19, SYNTAX_BUILTIN},{"WebRTCDataChannel", 17, SYNTAX_BUILTIN},{"PackedInt32Array", 16, SYNTAX_BUILTIN},{"CollisionObject2D", 17, SYNTAX_BUILTIN},{"PhysicalSkyMaterial", 19, SYNTAX_BUILTIN},{"tanh", 4, SYNTAX_BUILTIN},{"VisualShaderNodeVec2Constant", 28, SYNTAX_BUILTIN},{"CameraAttributesPhysical", 24, SYNTAX_BUILTIN},{"MultiMeshInstance2D", 19, SYNTAX_BUILTIN},{"GDExtensionManager", 18, SYNTAX_BUILTIN},{"ConfigFile", 10, SYNTAX_BUILTIN},{"HTTPClient", 10, SYNTAX_BUILTIN},{"InputEventMagnifyGesture", 24, SYNTAX_BUILTIN},{"PackedByteArray", 15, SYNTAX_BUILTIN},{"OS", 2, SYNTAX_BUILTIN},{"AudioEffectPanner", 17, SYNTAX_BUILTIN},{"PhysicalBone2D", 14, SYNTAX_BUILTIN},{"Skin", 4, SYNTAX_BUILTIN},{"assert", 6, SYNTAX_KEYWORD},{"VisualShaderNodeVarying", 23, SYNTAX_BUILTIN},{"SubViewportContainer", 20, SYNTAX_BUILTIN},{"EditorResourcePicker", 20, SYNTAX_BUILTIN},{"AnimationNodeBlendSpace2D", 25, SYNTAX_BUILTIN},{"VisualShaderNodeClamp", 21, SYNTAX_BUILTIN},{"AnimationNodeBlend3", 19, SYNTAX_BUILTIN},{"Line2D", 6, SYNTAX_BUILTIN},{"AudioBusLayout", 14, SYNTAX_BUILTIN},{"VisualShaderNodeColorOp", 23, SYNTAX_BUILTIN},{"ScrollBar", 9, SYNTAX_BUILTIN},{"SegmentShape2D", 14, SYNTAX_BUILTIN},{"RigidBody2D", 11, SYNTAX_BUILTIN},{"AudioEffectReverb", 17, SYNTAX_BUILTIN},{"PhysicsShapeQueryParameters2D", 29, SYNTAX_BUILTIN},{"break", 5, SYNTAX_KEYWORD},{"clampf", 6, SYNTAX_BUILTIN},{"NavigationAgent2D", 17, SYNTAX_BUILTIN},{"DirectionalLight3D", 18, SYNTAX_BUILTIN},{"PhysicsServer3DRenderingServerHandler", 37, SYNTAX_BUILTIN},{"ShaderGlobalsOverride", 21, SYNTAX_BUILTIN},{"Node3DGizmo", 11, SYNTAX_BUILTIN},{"MovieWriter", 11, SYNTAX_BUILTIN},{"MenuButton", 10, SYNTAX_BUILTIN},{"HMACContext", 11, SYNTAX_BUILTIN},{"CompressedCubemap", 17, SYNTAX_BUILTIN},{"CollisionPolygon3D", 18, SYNTAX_BUILTIN},{"Geometry3D", 10, SYNTAX_BUILTIN},{"Environment", 11, SYNTAX_BUILTIN},{"TextServerExtension", 19, SYNTAX_BUILTIN},{"ProceduralSkyMaterial", 21, SYNTAX_BUILTIN},{"VisualShaderNodeDeterminant", 27, SYNTAX_BUILTIN},{"GDExtension", 11, SYNTAX_BUILTIN},{"PacketPeerExtension", 19, SYNTAX_BUILTIN},{"rid_allocate_id", 15, SYNTAX_BUILTIN},{"NAN", 3, SYNTAX_CONSTANT},{"sin", 3, SYNTAX_BUILTIN},{"PhysicsServer3DExtension", 24, SYNTAX_BUILTIN},{"PointMesh", 9, SYNTAX_BUILTIN},{"VSeparator", 10, SYNTAX_BUILTIN},{"AudioEffectFilter", 17, SYNTAX_BUILTIN},{"EditorResourcePreview", 21, SYNTAX_BUILTIN},{"EditorPlugin", 12, SYNTAX_BUILTIN},{"Sky", 3, SYNTAX_BUILTIN},{"ORMMaterial3D", 13, SYNTAX_BUILTIN},{"XRPositionalTracker", 19, SYNTAX_BUILTIN},{"VisualShaderNodeTextureParameterTriplanar", 41, SYNTAX_BUILTIN},{"Vector2i", 8, SYNTAX_BUILTIN},{"Camera2D", 8, SYNTAX_BUILTIN},{"VisualShaderNodeVec3Parameter", 29, SYNTAX_BUILTIN},{"BoneMap", 7, SYNTAX_BUILTIN},{"VisualShaderNodeVectorOp", 24, SYNTAX_BUILTIN},{"VisualShaderNodeBillboard", 25, SYNTAX_BUILTIN},{"Texture3D", 9, SYNTAX_BUILTIN},{"AudioStreamWAV", 14, SYNTAX_BUILTIN},{"RDTextureView", 13, SYNTAX_BUILTIN},{"RigidBody3D", 11, SYNTAX_BUILTIN},{"TextureProgressBar", 18, SYNTAX_BUILTIN},{"tan", 3, SYNTAX_BUILTIN},{"Sprite2D", 8, SYNTAX_BUILTIN},{"NavigationPathQueryParameters2D", 31, SYNTAX_BUILTIN},{"push_error", 10, SYNTAX_BUILTIN},{"AcceptDialog", 12, SYNTAX_BUILTIN},{"cos", 3, SYNTAX_BUILTIN},{"VisualShaderNodeMultiplyAdd", 27, SYNTAX_BUILTIN},{"WorldBoundaryShape2D", 20, SYNTAX_BUILTIN},{"VisualShaderNodeIf", 18, SYNTAX_BUILTIN},{"WeakRef", 7, SYNTAX_BUILTIN},{"PrismMesh", 9, SYNTAX_BUILTIN},{"VFlowContainer", 14, SYNTAX_BUILTIN},{"VisualShaderNodeTexture3DParameter", 34, SYNTAX_BUILTIN},{"Noise", 5, SYNTAX_BUILTIN},{"SceneTree", 9, SYNTAX_BUILTIN},{"Joint3D", 7, SYNTAX_BUILTIN},{"EditorExportPlatformLinuxBSD", 28, SYNTAX_BUILTIN},{"PacketPeerDTLS", 14, SYNTAX_BUILTIN},{"AStar2D", 7, SYNTAX_BUILTIN},{"ENetPacketPeer", 14, SYNTAX_BUILTIN},{"SkeletonIK3D", 12, SYNTAX_BUILTIN},{"PopupMenu", 9, SYNTAX_BUILTIN},{"inverse_lerp", 12, SYNTAX_BUILTIN},{"StaticBody2D", 12, SYNTAX_BUILTIN},{"PhysicsServer2D", 15, SYNTAX_BUILTIN},{"PhysicsShapeQueryParameters3D", 29, SYNTAX_BUILTIN},{"VisualShaderNodeTexture2DArray", 30, SYNTAX_BUILTIN},{"lerp_angle", 10, SYNTAX_BUILTIN},{"EditorNode3DGizmo", 17, SYNTAX_BUILTIN},{"roundi", 6, SYNTAX_BUILTIN},{"TileMapPattern", 14, SYNTAX_BUILTIN},{"VisualShaderNodeVectorDistance", 30, SYNTAX_BUILTIN},{"HBoxContainer", 13, SYNTAX_BUILTIN},{"Tree", 4, SYNTAX_BUILTIN},{"VoxelGI", 7, SYNTAX_BUILTIN},{"FlowContainer", 13, SYNTAX_BUILTIN},{"VisualShaderNodeIntFunc", 23, SYNTAX_BUILTIN},{"UPNPDevice", 10, SYNTAX_BUILTIN},{"EditorScenePostImportPlugin", 27, SYNTAX_BUILTIN},{"InputEventWithModifiers", 23, SYNTAX_BUILTIN},{"AudioServer", 11, SYNTAX_BUILTIN},{"is_instance_valid", 17, SYNTAX_BUILTIN},{"func", 4, SYNTAX_KEYWORD},{"EditorSceneFormatImporterGLTF", 29, SYNTAX_BUILTIN},{"ImageTexture3D", 14, SYNTAX_BUILTIN},{"VisualShaderNodeSwitch", 22, SYNTAX_BUILTIN},{"AudioStreamGenerator", 20, SYNTAX_BUILTIN},{"FileAccess", 10, SYNTAX_BUILTIN},{"VisualShaderNodeStep", 20, SYNTAX_BUILTIN},{"MeshLibrary", 11, SYNTAX_BUILTIN},{"smoothstep", 10, SYNTAX_BUILTIN},{"VehicleWheel3D", 14, SYNTAX_BUILTIN},{"PhysicsTestMotionResult2D", 25, SYNTAX_BUILTIN},{"Translation", 11, SYNTAX_BUILTIN},{"PhysicsPointQueryParameters2D", 29, SYNTAX_BUILTIN},{"Image", 5, SYNTAX_BUILTIN},{"VisualShaderNodeSDFToScreenUV", 29, SYNTAX_BUILTIN},{"EditorFileDialog", 16, SYNTAX_BUILTIN},{"GLTFSkeleton", 12, SYNTAX_BUILTIN},{"CompressedTexture2DArray", 24, SYNTAX_BUILTIN},{"CSharpScript", 12, SYNTAX_BUILTIN},{"VisualShaderNodeIntOp", 21, SYNTAX_BUILTIN},{"SceneReplicationConfig", 22, SYNTAX_BUILTIN},{"bytes_to_var_with_objects", 25, SYNTAX_BUILTIN},{"PlaceholderTextureLayered", 25, SYNTAX_BUILTIN},{"TileData", 8, SYNTAX_BUILTIN},{"ScriptCreateDialog", 18, SYNTAX_BUILTIN},{"Range", 5, SYNTAX_BUILTIN},{"OpenXRInterface", 15, SYNTAX_BUILTIN},{"EditorSceneFormatImporterBlend", 30, SYNTAX_BUILTIN},{"BaseMaterial3D", 14, SYNTAX_BUILTIN},{"StreamPeerBuffer", 16, SYNTAX_BUILTIN},{"Projection", 10, SYNTAX_BUILTIN},{"TextEdit", 8, SYNTAX_BUILTIN},{"StyleBoxEmpty", 13, SYNTAX_BUILTIN},{"ScriptEditor", 12, SYNTAX_BUILTIN},{"RDPipelineColorBlendStateAttachment", 35, SYNTAX_BUILTIN},{"enum", 4, SYNTAX_KEYWORD},{"extends", 7, SYNTAX_KEYWORD},{"float", 5, SYNTAX_BUILTIN},{"deg_to_rad", 10, SYNTAX_BUILTIN},{"Marker2D", 8, SYNTAX_BUILTIN},{"push_warning", 12, SYNTAX_BUILTIN},{"VisualShaderNodeRemap", 21, SYNTAX_BUILTIN},{"AudioStream", 11, SYNTAX_BUILTIN},{"NavigationPathQueryResult2D", 27, SYNTAX_BUILTIN},{"int", 3, SYNTAX_BUILTIN},{"GPUParticlesAttractorSphere3D", 29, SYNTAX_BUILTIN},{"VehicleBody3D", 13, SYNTAX_BUILTIN},{"AudioStreamPlayback", 19, SYNTAX_BUILTIN},{"VisualShaderNodeInput", 21, SYNTAX_BUILTIN},{"Basis", 5, SYNTAX_BUILTIN},{"mini", 4, SYNTAX_BUILTIN},{"and", 3, SYNTAX_KEYWORD},{"SkeletonModificationStack2D", 27, SYNTAX_BUILTIN},{"JavaClassWrapper", 16, SYNTAX_BUILTIN},{"Separator", 9, SYNTAX_BUILTIN},{"in", 2, SYNTAX_KEYWORD},{"ResourceSaver", 13, SYNTAX_BUILTIN},{"TreeItem", 8, SYNTAX_BUILTIN},{"EditorPaths", 11, SYNTAX_BUILTIN},{"PlaceholderTexture2D", 20, SYNTAX_BUILTIN},{"OccluderInstance3D", 18, SYNTAX_BUILTIN},{"SpinBox", 7, SYNTAX_BUILTIN},{"CPUParticles3D", 14, SYNTAX_BUILTIN},{"super", 5, SYNTAX_KEYWORD},{"BaseButton", 10, SYNTAX_BUILTIN}};
+static const u16 syntax_keyword_displacements_gdscript[343] = {2,0,2,6,10,18,8,2,4,0,2,3,2,30,7,15,10,13,2,0,37,3,5,0,10,6,7,33,2,1,19,2,28,0,27,0,4,24,0,1,4,41,23,4,46,42,27,0,13,0,2,30,34,1,27,59,7,9,40,0,73,0,4,2,5,1,2,3,23,7,8,11,9,0,1,2,6,4,3,0,47,6,6,7,18,16,0,82,58,2,0,5,13,78,0,26,12,7,40,14,14,20,1,11,11,0,6,46,0,20,0,4,3,24,0,0,14,2,0,0,18,11,67,17,7,0,0,113,13,84,167,7,0,31,24,32,20,1,101,4,0,3,16,17,50,1,1,0,2,60,71,4,1,4,11,0,29,0,1,18,16,0,12,37,11,7,1,24,29,4,81,10,3,15,15,2,65,0,62,18,34,99,22,10,0,59,0,0,67,21,5,1,9,6,9,8,0,3,84,188,6,27,1,2,36,2,5,123,14,33,8,18,245,15,28,62,15,1,18,3,13,22,0,16,31,47,21,16,4,33,22,13,82,0,4,32,6,208,124,5,30,13,38,0,7,19,12,10,6,91,0,41,53,35,111,1,43,128,0,185,32,141,235,21,28,0,169,78,24,0,0,0,15,1,98,11,235,37,2,20,1,19,0,21,139,112,91,29,135,1,189,2,7,51,223,160,176,224,3,51,130,2,0,112,183,110,43,98,35,22,16,7,57,28,187,125,60,85,10,136,166,95,0,209,540,37,561,421,127,24,103,341,0,170,0,0,43,286,21,532,3,4,8};
+static const KeywordTable syntax_all_keywords_gdscript = {
+	syntax_keywords_gdscript, syntax_keyword_displacements_gdscript, 1029, 343, 11,
+	{-10, -2, 7, -5, -16, 23, 12, -9, -7, -11, 1},
+	{0x9abc6581u, 0x4ef7ff05u, 0xb3cddcb1u, 0x9dc200e7u, 0x866018cfu, 0x29879525u, 0xbf0d0517u, 0x88cea72bu, 0x8f50f44fu, 0xf0ab6d13u, 0xdb9fac4fu}
 };
 
-static const Keyword syntax_keywords_comment_B[1] = {{"BUG", SYNTAX_TODO}};
-static const Keyword syntax_keywords_comment_F[1] = {{"FIXME", SYNTAX_TODO}};
-static const Keyword syntax_keywords_comment_O[1] = {{"OPTIMIZE", SYNTAX_TODO}};
-static const Keyword syntax_keywords_comment_T[2] = {{"TEMP", SYNTAX_TODO},{"TODO", SYNTAX_TODO}};
-static const Keyword syntax_keywords_comment_X[1] = {{"XXX", SYNTAX_TODO}};
-static const KeywordList syntax_all_keywords_comment[128] = {
-	['B'] = {syntax_keywords_comment_B, arr_count(syntax_keywords_comment_B)}, ['F'] = {syntax_keywords_comment_F, arr_count(syntax_keywords_comment_F)}, ['O'] = {syntax_keywords_comment_O, arr_count(syntax_keywords_comment_O)}, ['T'] = {syntax_keywords_comment_T, arr_count(syntax_keywords_comment_T)}, ['X'] = {syntax_keywords_comment_X, arr_count(syntax_keywords_comment_X)}
+static const Keyword syntax_keywords_comment[6] = {{"XXX", 3, SYNTAX_TODO},{"TEMP", 4, SYNTAX_TODO},{"OPTIMIZE", 8, SYNTAX_TODO},{"BUG", 3, SYNTAX_TODO},{"TODO", 4, SYNTAX_TODO},{"FIXME", 5, SYNTAX_TODO}};
+static const u16 syntax_keyword_displacements_comment[2] = {0,25};
+static const KeywordTable syntax_all_keywords_comment = {
+	syntax_keywords_comment, syntax_keyword_displacements_comment, 6, 2, 1,
+	{1},
+	{0xcb1855ffu}
 };
 
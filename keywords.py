@@ -1,7 +1,13 @@
 #!/usr/bin/env python3
 
 # creates lists of keywords for all languages
-# to make keyword lookup more efficient, the lists are split up by their first letter
+# to make keyword lookup more efficient, each list is turned into a minimal perfect hash table:
+# the hash of an identifier only looks at its length and a few of its characters
+# (chosen so that they're different for every keyword in the language),
+# so looking up an identifier takes one hash and one comparison.
+# the hash here must match syntax_keyword_hash in syntax.c
+
+import random
 
 types = [
 	'SYNTAX_KEYWORD', 'SYNTAX_CONSTANT', 'SYNTAX_BUILTIN',
@@ -9,36 +15,108 @@ types = [
 ]
 exec('\n'.join(['{} = {}'.format(type, i) for (i, type) in enumerate(types)]))
 
+# maximum number of character positions which can be used in the hash
+MAX_POSITIONS = 12
+
 def process_keywords(keywords):
 	keyword_types = {}
 	for (type,kwd) in keywords:
 		if kwd in keyword_types:
 			print('repeated keyword:', kwd)
 		keyword_types[kwd] = type
-	
-	keywords_by_c = {}
-	for (type,kwd) in keywords:
-		c = kwd[0]
-		if c in keywords_by_c:
-			keywords_by_c[c].append((kwd, type))
-		else:
-			keywords_by_c[c] = [(kwd, type)]
-	return keywords_by_c
+	return keyword_types
+
+def char_at(kwd, pos):
+	# positive positions count from the start of the identifier, negative ones from the end.
+	# positions past the end of the identifier are clamped to it.
+	i = min(pos, len(kwd) - 1) if pos >= 0 else max(len(kwd) + pos, 0)
+	return ord(kwd[i])
+
+def hash_key(kwd, positions):
+	return (len(kwd),) + tuple(char_at(kwd, pos) for pos in positions)
+
+# greedily pick character positions until every keyword has a different hash key
+def choose_positions(kwds):
+	candidates = list(range(MAX_POSITIONS * 2)) + [-i for i in range(1, MAX_POSITIONS * 2 + 1)]
+	positions = []
+	while len(set(hash_key(kwd, positions) for kwd in kwds)) < len(kwds):
+		if len(positions) >= MAX_POSITIONS:
+			raise ValueError("couldn't tell keywords apart: {}".format(kwds))
+		best = max(candidates, key=lambda pos: len(set(hash_key(kwd, positions + [pos]) for kwd in kwds)))
+		positions.append(best)
+		candidates.remove(best)
+	return positions
+
+def u32(x):
+	return x & 0xffffffff
+
+# each character position gets its own (odd) multiplier, so that the multiplications don't depend on each other
+def keyword_hash(multipliers, positions, kwd):
+	h = u32(len(kwd) * 0x9e3779b1)
+	for (mult, pos) in zip(multipliers, positions):
+		h = u32(h + char_at(kwd, pos) * mult)
+	h = u32((h ^ (h >> 16)) * 0x7feb352d)
+	return h ^ (h >> 15)
+
+# maps x to [0, n) -- this is faster than x % n
+def range_reduce(x, n):
+	return (x * n) >> 32
+
+def keyword_slot(h, displacement, n):
+	x = h ^ displacement
+	x = u32((x ^ (x >> 15)) * 0x85ebca6b)
+	x ^= x >> 13
+	return range_reduce(x, n)
+
+# hash-and-displace: keywords are put into buckets by their hash,
+# and each bucket gets a displacement which sends its keywords to free slots
+def build_table(kwds, positions):
+	n = len(kwds)
+	nbuckets = (n + 2) // 3
+	rng = random.Random(len(kwds))
+	for attempt in range(1000):
+		multipliers = [rng.getrandbits(32) | 1 for _ in positions]
+		hashes = {kwd: keyword_hash(multipliers, positions, kwd) for kwd in kwds}
+		if len(set(hashes.values())) < n:
+			continue
+		buckets = [[] for _ in range(nbuckets)]
+		for kwd in kwds:
+			buckets[range_reduce(hashes[kwd], nbuckets)].append(kwd)
+		slots = [None] * n
+		displacements = [0] * nbuckets
+		ok = True
+		for b in sorted(range(nbuckets), key=lambda b: -len(buckets[b])):
+			if not buckets[b]:
+				break
+			for d in range(1 << 16):
+				s = [keyword_slot(hashes[kwd], d, n) for kwd in buckets[b]]
+				if len(set(s)) == len(s) and all(slots[i] is None for i in s):
+					for (kwd, i) in zip(buckets[b], s):
+						slots[i] = kwd
+					displacements[b] = d
+					break
+			else:
+				ok = False
+				break
+		if ok:
+			return (multipliers, slots, displacements)
+	raise ValueError("couldn't build perfect hash table")
 
 def output_keywords(file, keywords, language):
-	keywords = process_keywords(keywords)
-	def escape(c):
-		if c.isalpha():
-			return c
-		else:
-			return 'x{:x}'.format(ord(c))
-	for (c, kwds) in sorted(keywords.items()):
-		kwds = list(sorted(kwds))
-		file.write('static const Keyword syntax_keywords_{}_{}[{}] = {{'.format(language, escape(c), len(kwds)))
-		file.write(','.join(map(lambda kwd: '{"'+kwd[0]+'", ' + types[kwd[1]] + '}', kwds)) + '};\n')
-	file.write('static const KeywordList syntax_all_keywords_{}[128] = {{\n'.format(language))
-	file.write('\t'+', '.join(["['{}'] = {{syntax_keywords_{}_{}, arr_count(syntax_keywords_{}_{})}}".format(
-		c, language, escape(c), language, escape(c)) for c in sorted(keywords.keys())]) + '\n')
+	keyword_types = process_keywords(keywords)
+	kwds = sorted(keyword_types.keys())
+	assert all(len(kwd) < 256 for kwd in kwds)
+	positions = choose_positions(kwds)
+	(multipliers, slots, displacements) = build_table(kwds, positions)
+	file.write('static const Keyword syntax_keywords_{}[{}] = {{'.format(language, len(slots)))
+	file.write(','.join('{{"{}", {}, {}}}'.format(kwd, len(kwd), types[keyword_types[kwd]]) for kwd in slots) + '};\n')
+	file.write('static const u16 syntax_keyword_displacements_{}[{}] = {{'.format(language, len(displacements)))
+	file.write(','.join(map(str, displacements)) + '};\n')
+	file.write('static const KeywordTable syntax_all_keywords_{} = {{\n'.format(language))
+	file.write('\tsyntax_keywords_{0}, syntax_keyword_displacements_{0}, {1}, {2}, {3},\n'.format(
+		language, len(slots), len(displacements), len(positions)))
+	file.write('\t{{{}}},\n'.format(', '.join(map(str, positions))))
+	file.write('\t{{{}}}\n'.format(', '.join('0x{:08x}u'.format(m) for m in multipliers)))
 	file.write('};\n\n')
 
 def cant_overlap(*args):
@@ -914,12 +992,23 @@ file.write('''// keywords for all languages ted supports
 ''')
 file.write('''typedef struct {
 	const char *str;
+	u8 len;
 	SyntaxCharType type;
 } Keyword;
 typedef struct {
+	/// keywords, in the order given by their hashes
 	const Keyword *keywords;
-	size_t len;
-} KeywordList;\n\n''')
+	/// displacement for each bucket
+	const u16 *displacements;
+	u32 len;
+	u32 nbuckets;
+	/// number of character positions used in the hash
+	u32 npositions;
+	/// character positions used in the hash. negative positions count from the end of the identifier.
+	i8 positions[%d];
+	/// multiplier for each character position
+	u32 multipliers[%d];
+} KeywordTable;\n\n''' % (MAX_POSITIONS, MAX_POSITIONS))
 
 def label(kwds, l):
 	return [(l, kwd) for kwd in kwds]
@@ -0,0 +1,906 @@
+// table-driven syntax highlighting for languages defined in syntax/*.cfg files.
+//
+// a language definition is a list of regions (comments, strings, etc.) and word lists (keywords, etc.):
+//
+//     name = "Lua"
+//     extensions = .lua
+//     comment = "--[[" "]]" multi-line
+//     comment = "--"
+//     string = "\"" "\"" escape "\\"
+//     keyword = and break do else elseif end for function if local ...
+//
+// the start strings of all the regions are compiled into one DFA (a trie), and each region's end string
+// (and start string, for nested regions) into an Aho-Corasick automaton, so highlighting a line
+// is mostly just table lookups.
+
+#include "ted-internal.h"
+
+/// maximum number of regions in a language
+#define LEXER_MAX_REGIONS 254
+/// maximum nesting depth of nested regions
+#define LEXER_MAX_DEPTH 0xffffu
+
+// the SyntaxState for a lexer is
+//   (1 + index of the multi-line region we're in, or 0) | (nesting depth << LEXER_STATE_DEPTH_SHIFT)
+enum {
+	LEXER_STATE_REGION_MASK = 0xffu,
+	LEXER_STATE_DEPTH_SHIFT = 8,
+};
+
+// character classes (only for ASCII characters -- non-ASCII word characters are always identifier characters)
+enum {
+	LEXER_CHAR_IDENT_START = 0x1,
+	LEXER_CHAR_IDENT = 0x2,
+	LEXER_CHAR_DIGIT = 0x4,
+	/// a region can start with this character
+	LEXER_CHAR_REGION_START = 0x8,
+};
+
+// outputs of region automata
+enum {
+	LEXER_OUTPUT_END = 1,
+	LEXER_OUTPUT_NESTED_START = 2,
+};
+
+/// an automaton over ASCII characters. non-ASCII characters are all treated as 0.
+typedef struct {
+	/// `transitions[128 * s + c]` is the state after reading `c` in state `s`
+	u16 *transitions;
+	/// `outputs[s]` is 1 + the index of the pattern which has been matched in state `s`, or 0.
+	u8 *outputs;
+} LexerAutomaton;
+
+typedef struct {
+	SyntaxCharType type;
+	/// can this region continue onto the next line?
+	bool multi_line;
+	/// can this region be nested in itself (e.g. Rust's block comments)?
+	bool nested;
+	/// escape character (e.g. \ for strings), or 0
+	char escape;
+	/// `NULL` if the region ends at the end of the line
+	char *end;
+	/// finds the end of the region (and nested starts)
+	LexerAutomaton automaton;
+} LexerRegion;
+
+typedef struct {
+	/// `NULL` for empty slots
+	char32_t *str;
+	u32 len;
+	SyntaxCharType type;
+} LexerWord;
+
+struct Lexer {
+	char name[30];
+	char lsp_identifier[32];
+	Language id;
+	/// highlight numbers?
+	bool numbers;
+	u8 char_classes[128];
+	/// recognizes the start of every region. state 0 is dead, and state 1 is the initial state.
+	LexerAutomaton starts;
+	LexerRegion *regions;
+	/// keywords, builtins, etc. (open addressing hash table with a power of 2 size)
+	LexerWord *words;
+	char **extensions;
+};
+
+typedef struct {
+	const char *path;
+	u32 line_number;
+	char error[256];
+} LexerReader;
+
+static void lexer_err(LexerReader *reader, PRINTF_FORMAT_STRING const char *fmt, ...) ATTRIBUTE_PRINTF(2, 3);
+static void lexer_err(LexerReader *reader, const char *fmt, ...) {
+	if (*reader->error) return; // only report the first error
+	char message[200];
+	va_list args;
+	va_start(args, fmt);
+	vsnprintf(message, sizeof message, fmt, args);
+	va_end(args);
+	strbuf_printf(reader->error, "%s:%" PRIu32 ": %s", reader->path, reader->line_number, message);
+}
+
+static void lexer_automaton_free(LexerAutomaton *automaton) {
+	arr_free(automaton->transitions);
+	arr_free(automaton->outputs);
+}
+
+// add a state with no transitions
+static u32 lexer_automaton_add_state(LexerAutomaton *automaton) {
+	u32 state = arr_len(automaton->outputs);
+	arr_add(automaton->outputs, 0);
+	for (int c = 0; c < 128; ++c)
+		arr_add(automaton->transitions, 0);
+	return state;
+}
+
+// if `anchored` is true, this builds a DFA which only matches `patterns` at the start of the input (a trie).
+// otherwise, it builds an Aho-Corasick automaton, which finds the patterns anywhere in the input.
+static bool lexer_automaton_build(LexerReader *reader, LexerAutomaton *automaton, const char *const *patterns, u32 npatterns, bool anchored) {
+	memset(automaton, 0, sizeof *automaton);
+	if (anchored)
+		lexer_automaton_add_state(automaton); // dead state
+	const u32 root = lexer_automaton_add_state(automaton);
+	for (u32 p = 0; p < npatterns; ++p) {
+		u32 state = root;
+		for (const char *s = patterns[p]; *s; ++s) {
+			u32 c = (u8)*s;
+			u32 next = automaton->transitions[128 * state + c];
+			if (!next) {
+				next = lexer_automaton_add_state(automaton);
+				if (next > U16_MAX) {
+					if (anchored)
+						lexer_err(reader, "Region starts are too long in total (they need more than %d automaton states).", U16_MAX);
+					else
+						lexer_err(reader, "Region end %s is too long.", patterns[0]);
+					lexer_automaton_free(automaton);
+					return false;
+				}
+				automaton->transitions[128 * state + c] = (u16)next;
+			}
+			state = next;
+		}
+		if (automaton->outputs[state]) {
+			if (anchored)
+				lexer_err(reader, "Two regions start with %s.", patterns[p]);
+			else // (the patterns are the end and start of a nested region)
+				lexer_err(reader, "Nested region starts and ends with %s, so it can't be nested.", patterns[p]);
+			lexer_automaton_free(automaton);
+			return false;
+		}
+		automaton->outputs[state] = (u8)(p + 1);
+	}
+	if (anchored)
+		return true;
+
+	// compute failure transitions, breadth-first
+	u32 nstates = arr_len(automaton->outputs);
+	u32 *fail = calloc(nstates, sizeof *fail);
+	u32 *queue = NULL;
+	for (int c = 0; c < 128; ++c) {
+		u32 next = automaton->transitions[c];
+		if (next)
+			arr_add(queue, next);
+	}
+	for (u32 q = 0; q < arr_len(queue); ++q) {
+		u32 state = queue[q];
+		if (!automaton->outputs[state])
+			automaton->outputs[state] = automaton->outputs[fail[state]];
+		for (int c = 0; c < 128; ++c) {
+			u16 *next = &automaton->transitions[128 * state + (u32)c];
+			u16 fallback = automaton->transitions[128 * fail[state] + (u32)c];
+			if (*next) {
+				fail[*next] = fallback;
+				arr_add(queue, *next);
+			} else {
+				*next = fallback;
+			}
+		}
+	}
+	arr_free(queue);
+	free(fail);
+	return true;
+}
+
+static u32 lexer_word_hash(const char32_t *str, u32 len) {
+	u32 hash = 0x811c9dc5u ^ len;
+	for (u32 i = 0; i < len; ++i)
+		hash = (hash ^ str[i]) * 0x01000193u;
+	return hash;
+}
+
+static SyntaxCharType lexer_word_type(const Lexer *lexer, const char32_t *str, u32 len) {
+	if (!lexer->words) return SYNTAX_NORMAL;
+	u32 mask = arr_len(lexer->words) - 1;
+	for (u32 slot = lexer_word_hash(str, len) & mask; ; slot = (slot + 1) & mask) {
+		const LexerWord *word = &lexer->words[slot];
+		if (!word->str)
+			return SYNTAX_NORMAL;
+		if (word->len == len && memcmp(word->str, str, len * sizeof *str) == 0)
+			return word->type;
+	}
+}
+
+static bool lexer_is_quoted(const char *token) {
+	return token[0] == '"';
+}
+
+static void lexer_add_words(LexerReader *reader, LexerWord **words, char **strs, SyntaxCharType type) {
+	arr_foreach_ptr(strs, char *, pstr) {
+		LexerWord *word = arr_addp(*words);
+		if (!word) break;
+		const char *str = lexer_is_quoted(*pstr) ? *pstr + 1 : *pstr;
+		size_t len = strlen(str);
+		word->str = calloc(len + 1, sizeof *word->str);
+		const char *p = str, *end = str + len;
+		while (p < end) {
+			char32_t c = 0;
+			size_t n = unicode_utf8_to_utf32(&c, p, (size_t)(end - p));
+			if (n == 0 || n >= (size_t)-2) {
+				lexer_err(reader, "Invalid UTF-8 in %s.", str);
+				break;
+			}
+			word->str[word->len++] = c;
+			p += n;
+		}
+		word->type = type;
+	}
+}
+
+// turn the list of words into a hash table
+static LexerWord *lexer_build_word_table(LexerWord *words) {
+	u32 nwords = arr_len(words);
+	if (!nwords) return NULL;
+	u32 size = 8;
+	while (size < 2 * nwords)
+		size *= 2;
+	LexerWord *table = NULL;
+	arr_set_len(table, size);
+	arr_foreach_ptr(words, LexerWord, word) {
+		u32 mask = size - 1;
+		u32 slot = lexer_word_hash(word->str, word->len) & mask;
+		while (table[slot].str) {
+			if (table[slot].len == word->len && memcmp(table[slot].str, word->str, word->len * sizeof *word->str) == 0)
+				break; // repeated word -- the later one wins
+			slot = (slot + 1) & mask;
+		}
+		free(table[slot].str);
+		table[slot] = *word;
+	}
+	arr_free(words);
+	return table;
+}
+
+void lexer_free(Lexer *lexer) {
+	if (!lexer) return;
+	lexer_automaton_free(&lexer->starts);
+	arr_foreach_ptr(lexer->regions, LexerRegion, region) {
+		free(region->end);
+		lexer_automaton_free(&region->automaton);
+	}
+	arr_free(lexer->regions);
+	arr_foreach_ptr(lexer->words, LexerWord, word)
+		free(word->str);
+	arr_free(lexer->words);
+	arr_foreach_ptr(lexer->extensions, char *, ext)
+		free(*ext);
+	arr_free(lexer->extensions);
+	free(lexer);
+}
+
+// split `value` into tokens. quoted tokens (which can contain \" and \\) are returned with the quote at the start.
+static char **lexer_tokenize(LexerReader *reader, const char *value) {
+	char **tokens = NULL;
+	const char *p = value;
+	while (1) {
+		p += strspn(p, " \t\r");
+		if (!*p) break;
+		// (a token is never longer than what's left of the value, plus the quote)
+		char *token = calloc(strlen(p) + 2, 1), *q = token;
+		if (*p == '"') {
+			*q++ = '"';
+			++p;
+			while (*p != '"') {
+				if (!*p) {
+					lexer_err(reader, "Unterminated string.");
+					break;
+				}
+				if (*p == '\\' && (p[1] == '"' || p[1] == '\\'))
+					++p;
+				*q++ = *p++;
+			}
+			if (*p) ++p;
+		} else {
+			size_t len = strcspn(p, " \t\r");
+			memcpy(q, p, len);
+			p += len;
+		}
+		arr_add(tokens, token);
+	}
+	return tokens;
+}
+
+static void lexer_free_tokens(char **tokens) {
+	arr_foreach_ptr(tokens, char *, token)
+		free(*token);
+	arr_free(tokens);
+}
+
+static bool lexer_is_ascii(const char *s) {
+	for (; *s; ++s)
+		if ((u8)*s >= 128)
+			return false;
+	return true;
+}
+
+static SyntaxCharType lexer_type_from_str(const char *str) {
+	static const struct {
+		const char *name;
+		SyntaxCharType type;
+	} types[] = {
+		{"keyword", SYNTAX_KEYWORD},
+		{"builtin", SYNTAX_BUILTIN},
+		{"constant", SYNTAX_CONSTANT},
+		{"comment", SYNTAX_COMMENT},
+		{"preprocessor", SYNTAX_PREPROCESSOR},
+		{"string", SYNTAX_STRING},
+		{"character", SYNTAX_CHARACTER},
+	};
+	for (size_t i = 0; i < arr_count(types); ++i)
+		if (streq(types[i].name, str))
+			return types[i].type;
+	return SYNTAX_NORMAL;
+}
+
+// parse a line like   string = "\"" "\"" escape "\\"
+static void lexer_parse_region(LexerReader *reader, LexerRegion *region, char **region_starts, char **tokens) {
+	u32 ntokens = arr_len(tokens);
+	u32 t = 1;
+	if (t < ntokens && lexer_is_quoted(tokens[t])) {
+		const char *end = tokens[t] + 1;
+		if (!*end) {
+			lexer_err(reader, "Empty region end.");
+			return;
+		}
+		if (!lexer_is_ascii(end)) {
+			lexer_err(reader, "Region ends must be ASCII.");
+			return;
+		}
+		region->end = str_dup(end);
+		++t;
+	}
+	for (; t < ntokens; ++t) {
+		const char *flag = tokens[t];
+		if (streq(flag, "multi-line")) {
+			region->multi_line = true;
+		} else if (streq(flag, "nested")) {
+			region->nested = true;
+		} else if (streq(flag, "escape") && t + 1 < ntokens && lexer_is_quoted(tokens[t + 1])) {
+			const char *escape = tokens[++t] + 1;
+			if (strlen(escape) != 1 || !lexer_is_ascii(escape)) {
+				lexer_err(reader, "Escape must be a single ASCII character.");
+				return;
+			}
+			region->escape = escape[0];
+		} else {
+			lexer_err(reader, "Unrecognized region option: %s (expected multi-line, nested, or escape \"c\").", flag);
+			return;
+		}
+	}
+	if (!region->end && (region->multi_line || region->nested)) {
+		lexer_err(reader, "Regions which end at the end of the line can't be multi-line or nested.");
+		return;
+	}
+	if (region->end) {
+		const char *patterns[2] = {region->end, region_starts[arr_len(region_starts) - 1]};
+		lexer_automaton_build(reader, &region->automaton, patterns, region->nested ? 2 : 1, false);
+	}
+}
+
+static bool lexer_parse_bool(LexerReader *reader, const char *value) {
+	if (streq(value, "on") || streq(value, "yes") || streq(value, "true"))
+		return true;
+	if (!(streq(value, "off") || streq(value, "no") || streq(value, "false")))
+		lexer_err(reader, "Expected on or off, not %s.", value);
+	return false;
+}
+
+static void lexer_parse_line(LexerReader *reader, Lexer *lexer, char ***region_starts, LexerWord **words, char *line) {
+	char *equals = strchr(line, '=');
+	if (!equals) {
+		lexer_err(reader, "Expected key = value.");
+		return;
+	}
+	*equals = '\0';
+	char *key = line, *value = equals + 1;
+	str_trim(key);
+	str_trim(value);
+	char **tokens = lexer_tokenize(reader, value);
+	const char *first = tokens ? tokens[0] : "";
+	// value without quotes
+	const char *first_str = lexer_is_quoted(first) ? first + 1 : first;
+	SyntaxCharType type = lexer_type_from_str(key);
+	if (streq(key, "name")) {
+		if (strlen(first_str) >= sizeof lexer->name)
+			lexer_err(reader, "Name too long.");
+		strbuf_cpy(lexer->name, first_str);
+	} else if (streq(key, "lsp-identifier")) {
+		strbuf_cpy(lexer->lsp_identifier, first_str);
+	} else if (streq(key, "id")) {
+		char *endp = NULL;
+		unsigned long long id = strtoull(first_str, &endp, 10);
+		if (*endp || id < LANG_USER_MIN || id >= LANG_USER_MAX)
+			lexer_err(reader, "Language IDs must be numbers from %d to %d.", LANG_USER_MIN, LANG_USER_MAX - 1);
+		else
+			lexer->id = (Language)id;
+	} else if (streq(key, "numbers")) {
+		lexer->numbers = lexer_parse_bool(reader, first_str);
+	} else if (streq(key, "identifier-chars")) {
+		// extra characters which can appear in identifiers, e.g. $ in JavaScript
+		for (const char *p = first_str; *p; ++p) {
+			if ((u8)*p < 128)
+				lexer->char_classes[(u8)*p] |= LEXER_CHAR_IDENT_START | LEXER_CHAR_IDENT;
+		}
+	} else if (streq(key, "extensions")) {
+		arr_foreach_ptr(tokens, char *, token) {
+			char *ext = *token;
+			if (lexer_is_quoted(ext)) ++ext;
+			size_t len = strcspn(ext, ",");
+			if (len)
+				arr_add(lexer->extensions, strn_dup(ext, len));
+		}
+	} else if (type != SYNTAX_NORMAL && arr_len(tokens) && lexer_is_quoted(first)) {
+		const char *start = first + 1;
+		if (!*start) {
+			lexer_err(reader, "Empty region start.");
+		} else if (!lexer_is_ascii(start)) {
+			lexer_err(reader, "Region starts must be ASCII.");
+		} else if (arr_len(lexer->regions) >= LEXER_MAX_REGIONS) {
+			lexer_err(reader, "Too many regions (the maximum is %d).", LEXER_MAX_REGIONS);
+		} else {
+			arr_add(*region_starts, str_dup(start));
+			LexerRegion *region = arr_addp(lexer->regions);
+			region->type = type;
+			lexer_parse_region(reader, region, *region_starts, tokens);
+		}
+	} else if (type != SYNTAX_NORMAL) {
+		lexer_add_words(reader, words, tokens, type);
+	} else {
+		lexer_err(reader, "Unrecognized key: %s", key);
+	}
+	lexer_free_tokens(tokens);
+}
+
+// read a language definition from `fp`. `path` is only used for error messages.
+static Lexer *lexer_read(const char *path, FILE *fp, char *error, size_t error_size) {
+	LexerReader reader = {.path = path};
+	Lexer *lexer = calloc(1, sizeof *lexer);
+	lexer->numbers = true;
+	strbuf_cpy(lexer->lsp_identifier, "text");
+	for (int c = 0; c < 128; ++c) {
+		if (isalpha(c) || c == '_')
+			lexer->char_classes[c] |= LEXER_CHAR_IDENT_START | LEXER_CHAR_IDENT;
+		if (isdigit(c))
+			lexer->char_classes[c] |= LEXER_CHAR_IDENT | LEXER_CHAR_DIGIT;
+	}
+	char **region_starts = NULL;
+	LexerWord *words = NULL;
+	char line[4096];
+	while (!*reader.error && fgets(line, sizeof line, fp)) {
+		++reader.line_number;
+		line[strcspn(line, "\r\n")] = '\0';
+		const char *p = line + strspn(line, " \t");
+		if (*p == '#' || *p == '\0')
+			continue;
+		lexer_parse_line(&reader, lexer, &region_starts, &words, line);
+	}
+
+	if (!*reader.error && !lexer->name[0])
+		lexer_err(&reader, "No name for language. Add a line like: name = \"My language\"");
+	if (!*reader.error)
+		lexer_automaton_build(&reader, &lexer->starts, (const char *const *)region_starts, arr_len(region_starts), true);
+	if (!*reader.error) {
+		for (int c = 0; c < 128; ++c)
+			if (lexer->starts.transitions[128 + c])
+				lexer->char_classes[c] |= LEXER_CHAR_REGION_START;
+	}
+	arr_foreach_ptr(region_starts, char *, start)
+		free(*start);
+	arr_free(region_starts);
+	lexer->words = lexer_build_word_table(words);
+	if (!lexer->id) {
+		// derive the ID from the name so that it stays the same across runs
+		char32_t name[sizeof lexer->name] = {0};
+		u32 len = 0;
+		for (const char *p = lexer->name; *p; ++p)
+			name[len++] = (u8)*p;
+		lexer->id = LANG_USER_MIN + lexer_word_hash(name, len) % (LANG_USER_MAX - LANG_USER_MIN);
+	}
+
+	if (*reader.error) {
+		str_cpy(error, error_size, reader.error);
+		lexer_free(lexer);
+		return NULL;
+	}
+	return lexer;
+}
+
+static Lexer *lexer_load(const char *path, char *error, size_t error_size) {
+	FILE *fp = fopen(path, "rb");
+	if (!fp) {
+		str_printf(error, error_size, "Couldn't open %s.", path);
+		return NULL;
+	}
+	Lexer *lexer = lexer_read(path, fp, error, error_size);
+	fclose(fp);
+	return lexer;
+}
+
+static void lexer_fill(SyntaxCharType *char_types, u32 start, u32 end, SyntaxCharType type) {
+	if (char_types)
+		memset(char_types + start, type, (end - start) * sizeof *char_types);
+}
+
+// continue the region starting from line[i]. returns the index of the character after the end of the region,
+// or line_len if it doesn't end on this line (in which case *ended is set to false).
+static u32 lexer_scan_region(const LexerRegion *region, const char32_t *line, u32 line_len, u32 i, u32 *depth, bool *ended) {
+	*ended = false;
+	if (!region->end)
+		return line_len;
+	const u16 *transitions = region->automaton.transitions;
+	const u8 *outputs = region->automaton.outputs;
+	const char32_t escape = (char32_t)region->escape;
+	u32 state = 0;
+	while (i < line_len) {
+		char32_t c = line[i++];
+		if (escape && c == escape) {
+			// skip the escaped character
+			if (i < line_len) ++i;
+			state = 0;
+			continue;
+		}
+		state = transitions[128 * state + (c < 128 ? c : 0)];
+		switch (outputs[state]) {
+		case LEXER_OUTPUT_END:
+			if (*depth == 0) {
+				*ended = true;
+				return i;
+			}
+			--*depth;
+			state = 0;
+			break;
+		case LEXER_OUTPUT_NESTED_START:
+			if (*depth < LEXER_MAX_DEPTH)
+				++*depth;
+			state = 0;
+			break;
+		}
+	}
+	return line_len;
+}
+
+void lexer_highlight(const Lexer *lexer, SyntaxState *state, const char32_t *line, u32 line_len, SyntaxCharType *char_types) {
+	const u8 *char_classes = lexer->char_classes;
+	u32 region_index = *state & LEXER_STATE_REGION_MASK;
+	u32 depth = *state >> LEXER_STATE_DEPTH_SHIFT;
+	u32 i = 0;
+	if (region_index) {
+		// continue multi-line region from the previous line
+		bool ended = false;
+		i = lexer_scan_region(&lexer->regions[region_index - 1], line, line_len, 0, &depth, &ended);
+		lexer_fill(char_types, 0, i, lexer->regions[region_index - 1].type);
+		if (ended)
+			region_index = depth = 0;
+	}
+
+	while (i < line_len) {
+		char32_t c = line[i];
+		u32 char_class = c < 128 ? char_classes[c]
+			: is32_word(c) ? LEXER_CHAR_IDENT_START | LEXER_CHAR_IDENT : 0;
+		if (char_class & LEXER_CHAR_REGION_START) {
+			// find the longest region start here
+			const u16 *transitions = lexer->starts.transitions;
+			const u8 *outputs = lexer->starts.outputs;
+			u32 s = 1, match = 0, match_end = 0;
+			for (u32 j = i; j < line_len; ) {
+				char32_t d = line[j++];
+				s = transitions[128 * s + (d < 128 ? d : 0)];
+				if (!s) break;
+				if (outputs[s]) {
+					match = outputs[s];
+					match_end = j;
+				}
+			}
+			if (match) {
+				const LexerRegion *region = &lexer->regions[match - 1];
+				bool ended = false;
+				depth = 0;
+				u32 end = lexer_scan_region(region, line, line_len, match_end, &depth, &ended);
+				lexer_fill(char_types, i, end, region->type);
+				if (!ended && region->multi_line)
+					region_index = match;
+				i = end;
+				continue;
+			}
+		}
+		if (char_class & LEXER_CHAR_DIGIT) {
+			if (lexer->numbers) {
+				// number literal, like 123, 0x1f, 1.5e-3, 10ul
+				bool hex = c == '0' && i + 1 < line_len && (line[i + 1] == 'x' || line[i + 1] == 'X');
+				u32 end = i + 1;
+				while (end < line_len) {
+					char32_t d = line[end];
+					if (d < 128 && (char_classes[d] & LEXER_CHAR_IDENT)) {
+						++end;
+					} else if (d == '.' && end + 1 < line_len && line[end + 1] < 128 && (char_classes[line[end + 1]] & LEXER_CHAR_DIGIT)) {
+						end += 2;
+					} else if ((d == '+' || d == '-') && !hex && (line[end - 1] == 'e' || line[end - 1] == 'E')) {
+						++end;
+					} else {
+						break;
+					}
+				}
+				lexer_fill(char_types, i, end, SYNTAX_CONSTANT);
+				i = end;
+				continue;
+			}
+		} else if (char_class & LEXER_CHAR_IDENT_START) {
+			u32 end = i + 1;
+			while (end < line_len) {
+				char32_t d = line[end];
+				if (d < 128 ? !(char_classes[d] & LEXER_CHAR_IDENT) : !is32_word(d))
+					break;
+				++end;
+			}
+			lexer_fill(char_types, i, end, lexer_word_type(lexer, &line[i], end - i));
+			i = end;
+			continue;
+		}
+		if (char_types) char_types[i] = SYNTAX_NORMAL;
+		++i;
+	}
+	*state = region_index ? region_index | depth << LEXER_STATE_DEPTH_SHIFT : 0;
+}
+
+bool lexer_matches_filename(const Lexer *lexer, const char *filename, int *score) {
+	bool matches = false;
+	arr_foreach_ptr(lexer->extensions, char *const, ext) {
+		int len = (int)strlen(*ext);
+		if (len > *score && str_has_suffix(filename, *ext)) {
+			*score = len;
+			matches = true;
+		}
+	}
+	return matches;
+}
+
+static void lexer_load_directory(Ted *ted, const char *dir, char ***loaded_files) {
+	FsDirectoryEntry **entries = fs_list_directory(dir);
+	if (!entries) return;
+	for (FsDirectoryEntry **entry = entries; *entry; ++entry) {
+		const char *filename = (*entry)->name;
+		if ((*entry)->type != FS_FILE || !str_has_suffix(filename, ".cfg"))
+			continue;
+		bool overridden = false;
+		arr_foreach_ptr(*loaded_files, char *, loaded)
+			overridden |= streq(*loaded, filename);
+		if (overridden)
+			continue;
+		char path[TED_PATH_MAX];
+		path_full(dir, filename, path, sizeof path);
+		char error[256] = {0};
+		Lexer *lexer = lexer_load(path, error, sizeof error);
+		if (!lexer) {
+			ted_error(ted, "%s", error);
+			continue;
+		}
+		LanguageInfo info = {.id = lexer->id};
+		strbuf_cpy(info.name, lexer->name);
+		strbuf_cpy(info.lsp_identifier, lexer->lsp_identifier);
+		if (!syntax_register_lexer(&info, lexer)) {
+			ted_error(ted, "%s: there is already a language named %s (or with ID %" PRIu32 ").", path, lexer->name, lexer->id);
+			lexer_free(lexer);
+			continue;
+		}
+		arr_add(*loaded_files, str_dup(filename));
+	}
+	fs_dir_entries_free(entries);
+}
+
+void lexer_load_languages(Ted *ted) {
+	char **loaded_files = NULL;
+	char dir[TED_PATH_MAX];
+	// local definitions override global ones with the same file name
+	strbuf_printf(dir, "%s%csyntax", ted->local_data_dir, PATH_SEPARATOR);
+	lexer_load_directory(ted, dir, &loaded_files);
+	strbuf_printf(dir, "%s%csyntax", ted->global_data_dir, PATH_SEPARATOR);
+	lexer_load_directory(ted, dir, &loaded_files);
+	arr_foreach_ptr(loaded_files, char *, file)
+		free(*file);
+	arr_free(loaded_files);
+}
+
+// time how long `highlighter` or `lexer` takes to highlight `lines` (and return the number of seconds)
+static double lexer_benchmark_highlight(Language lang, const Lexer *lexer, char32_t **lines, SyntaxCharType *char_types, int iterations) {
+	double start = time_get_seconds();
+	for (int iter = 0; iter < iterations; ++iter) {
+		SyntaxState state = 0;
+		arr_foreach_ptr(lines, char32_t *, line) {
+			if (lexer)
+				lexer_highlight(lexer, &state, *line, arr_len(*line), char_types);
+			else
+				syntax_highlight(&state, lang, *line, arr_len(*line), char_types);
+		}
+	}
+	return time_get_seconds() - start;
+}
+
+void lexer_benchmark(const char *definition_path, const char *const *filenames, u32 nfilenames) {
+	char error[256] = {0};
+	Lexer *lexer = lexer_load(definition_path, error, sizeof error);
+	if (!lexer) {
+		printf("%s\n", error);
+		return;
+	}
+	Language builtin = language_from_str(lexer->name);
+	if (builtin == LANG_NONE)
+		printf("%s isn't a built-in language, so there's nothing to compare against.\n", lexer->name);
+	const int iterations = 20;
+	for (u32 f = 0; f < nfilenames; ++f) {
+		FILE *fp = fopen(filenames[f], "rb");
+		if (!fp) {
+			printf("Couldn't open %s.\n", filenames[f]);
+			continue;
+		}
+		// split the file into UTF-32 lines
+		char32_t **lines = NULL;
+		u64 nchars = 0;
+		u32 max_len = 0;
+		char buf[8192];
+		while (fgets(buf, sizeof buf, fp)) {
+			buf[strcspn(buf, "\r\n")] = '\0';
+			char32_t *line = NULL;
+			const char *p = buf, *end = buf + strlen(buf);
+			while (p < end) {
+				char32_t c = 0;
+				size_t n = unicode_utf8_to_utf32(&c, p, (size_t)(end - p));
+				if (n == 0 || n >= (size_t)-2) {
+					c = 0xFFFD;
+					n = 1;
+				}
+				arr_add(line, c);
+				p += n;
+			}
+			nchars += arr_len(line);
+			max_len = max_u32(max_len, arr_len(line));
+			arr_add(lines, line);
+		}
+		fclose(fp);
+
+		SyntaxCharType *char_types = calloc(max_len + 1, sizeof *char_types);
+		SyntaxCharType *builtin_types = calloc(max_len + 1, sizeof *builtin_types);
+		// how many characters are highlighted the same way as the built-in highlighter?
+		u64 agree = 0;
+		if (builtin != LANG_NONE) {
+			SyntaxState state = 0, builtin_state = 0;
+			arr_foreach_ptr(lines, char32_t *, line) {
+				u32 len = arr_len(*line);
+				lexer_highlight(lexer, &state, *line, len, char_types);
+				syntax_highlight(&builtin_state, builtin, *line, len, builtin_types);
+				for (u32 i = 0; i < len; ++i)
+					agree += char_types[i] == builtin_types[i];
+			}
+		}
+
+		printf("%s (%" PRIu32 " lines):\n", filenames[f], arr_len(lines));
+		double mchars = (double)nchars * iterations * 1e-6;
+		double t = lexer_benchmark_highlight(LANG_NONE, lexer, lines, char_types, iterations);
+		printf("  table-driven %-12s %8.1f M chars/s\n", lexer->name, mchars / t);
+		if (builtin != LANG_NONE) {
+			t = lexer_benchmark_highlight(builtin, NULL, lines, char_types, iterations);
+			printf("  built-in     %-12s %8.1f M chars/s\n", language_to_str(builtin), mchars / t);
+			printf("  %.1f%% of characters highlighted the same way\n", nchars ? 100.0 * (double)agree / (double)nchars : 100.0);
+		}
+		free(char_types);
+		free(builtin_types);
+		arr_foreach_ptr(lines, char32_t *, line)
+			arr_free(*line);
+		arr_free(lines);
+	}
+	lexer_free(lexer);
+}
+
+static Lexer *lexer_test_load(const char *definition, char *error, size_t error_size) {
+	FILE *fp = tmpfile();
+	if (!fp) {
+		fprintf(stderr, "couldn't create temporary file for lexer test\n");
+		exit(1);
+	}
+	fputs(definition, fp);
+	rewind(fp);
+	Lexer *lexer = lexer_read("test.cfg", fp, error, error_size);
+	fclose(fp);
+	return lexer;
+}
+
+// highlight `line` and check the types against `expected`, which has one character per type (see below),
+// and the state after the line against `expected_state`.
+static void lexer_test_line(const Lexer *lexer, SyntaxState *state, const char *line, const char *expected, SyntaxState expected_state) {
+	const char type_chars[] = "nkbcpsh#t";
+	char32_t line32[64] = {0};
+	SyntaxCharType char_types[64] = {0};
+	char got[64] = {0};
+	u32 len = (u32)strlen(line);
+	assert(len < arr_count(line32) && strlen(expected) == len);
+	for (u32 i = 0; i < len; ++i)
+		line32[i] = (u8)line[i];
+	lexer_highlight(lexer, state, line32, len, char_types);
+	for (u32 i = 0; i < len; ++i)
+		got[i] = char_types[i] < sizeof type_chars - 1 ? type_chars[char_types[i]] : '?';
+	if (!streq(got, expected) || *state != expected_state) {
+		fprintf(stderr, "lexer highlighted %s as %s, state %" PRIu32 " (expected %s, state %" PRIu32 ")\n",
+			line, got, *state, expected, expected_state);
+		exit(1);
+	}
+}
+
+static void lexer_test_expect_error(const char *definition, const char *expected_error) {
+	char error[256] = {0};
+	Lexer *lexer = lexer_test_load(definition, error, sizeof error);
+	if (lexer || !strstr(error, expected_error)) {
+		fprintf(stderr, "lexer definition should have failed with \"%s\", but got \"%s\":\n%s\n",
+			expected_error, error, definition);
+		exit(1);
+	}
+}
+
+void lexer_test(Ted *ted) {
+	(void)ted;
+	char error[256] = {0};
+	Lexer *lexer = lexer_test_load(
+		"name = \"Lexer test\"\n"
+		"comment = \"//\"\n"
+		"comment = \"/*\" \"*/\" multi-line nested\n"
+		"string = \"\\\"\" \"\\\"\" escape \"\\\\\"\n"
+		"string = \"`\" \"`\" multi-line escape \"\\\\\"\n"
+		"keyword = if return\n",
+		error, sizeof error);
+	if (!lexer) {
+		fprintf(stderr, "lexer test definition failed to load: %s\n", error);
+		exit(1);
+	}
+	// the state in the multi-line regions is 1 + region index, plus the depth in the high bits
+	const SyntaxState block_comment = 2, template = 4;
+	SyntaxState state = 0;
+	// single-line regions end at the end of the line
+	lexer_test_line(lexer, &state, "if x // a */", "kknnnccccccc", 0);
+	lexer_test_line(lexer, &state, "return 12", "kkkkkkn##", 0);
+	// multi-line and nested regions
+	lexer_test_line(lexer, &state, "x /* a", "nncccc", block_comment);
+	lexer_test_line(lexer, &state, "b */ if", "ccccnkk", 0);
+	lexer_test_line(lexer, &state, "/* a /* b /* c */", "ccccccccccccccccc", block_comment | 1 << LEXER_STATE_DEPTH_SHIFT);
+	lexer_test_line(lexer, &state, "/* */", "ccccc", block_comment | 1 << LEXER_STATE_DEPTH_SHIFT);
+	lexer_test_line(lexer, &state, "*/ x */ x", "cccccccnn", 0);
+	// escapes
+	lexer_test_line(lexer, &state, "\"a\\\"b\" if", "ssssssnkk", 0);
+	lexer_test_line(lexer, &state, "\"a\\\\\" if", "sssssnkk", 0);
+	// an escape at the end of a line ends a single-line region, but continues a multi-line one
+	lexer_test_line(lexer, &state, "\"ab\\", "ssss", 0);
+	lexer_test_line(lexer, &state, "if", "kk", 0);
+	lexer_test_line(lexer, &state, "`a\\`b\\", "ssssss", template);
+	lexer_test_line(lexer, &state, "` if", "snkk", 0);
+	lexer_free(lexer);
+
+	// bad definitions
+	lexer_test_expect_error("name = \"x\"\ncomment = \"#\"\nstring = \"#\" \"#\"\n", "Two regions start with #.");
+	lexer_test_expect_error("name = \"x\"\ncomment = \"|\" \"|\" nested\n", "Nested region starts and ends with |");
+	lexer_test_expect_error("name = \"x\"\ncomment = \"#\" multi-line\n", "can't be multi-line or nested");
+	lexer_test_expect_error("name = \"x\"\ncomment = \"\"\n", "Empty region start.");
+	lexer_test_expect_error("comment = \"#\"\n", "No name for language.");
+	{
+		// more than 65535 states in the automaton for the region starts
+		StrBuilder builder = str_builder_new();
+		str_builder_append(&builder, "name = \"x\"\n");
+		for (int i = 0; i < 20; ++i) {
+			str_builder_appendf(&builder, "comment = \"%c", 'a' + i);
+			for (int j = 0; j < 4000; ++j)
+				str_builder_append(&builder, "x");
+			str_builder_append(&builder, "\"\n");
+		}
+		lexer_test_expect_error(builder.str, "Region starts are too long");
+		str_builder_free(&builder);
+	}
+	{
+		// the same patterns in an unanchored automaton
+		LexerReader reader = {.path = "test"};
+		LexerAutomaton automaton = {0};
+		const char *const patterns[] = {"ab", "ab"};
+		if (lexer_automaton_build(&reader, &automaton, patterns, 2, false) || !*reader.error) {
+			fprintf(stderr, "lexer_automaton_build accepted duplicate patterns\n");
+			exit(1);
+		}
+	}
+}
@@ -85,6 +85,47 @@ void json_debug_print_value(const JSON *json, JSONValue value) {
 	}
 }
 
+void json_write_value(const JSON *json, JSONValue value, StrBuilder *builder) {
+	switch (value.type) {
+	case JSON_UNDEFINED:
+	case JSON_NULL: str_builder_append(builder, "null"); break;
+	case JSON_FALSE: str_builder_append(builder, "false"); break;
+	case JSON_TRUE: str_builder_append(builder, "true"); break;
+	case JSON_NUMBER: {
+		double number = value.val.number;
+		if (number == floor(number) && fabs(number) < 1e15)
+			str_builder_appendf(builder, "%.0f", number);
+		else
+			str_builder_appendf(builder, "%.17g", number);
+		} break;
+	case JSON_STRING: {
+		// strings are kept escaped in json->text
+		const JSONString string = value.val.string;
+		str_builder_appendf(builder, "\"%.*s\"", (int)string.len, json->text + string.pos);
+		} break;
+	case JSON_ARRAY: {
+		const JSONArray array = value.val.array;
+		str_builder_append(builder, "[");
+		for (u32 i = 0; i < array.len; ++i) {
+			if (i) str_builder_append(builder, ",");
+			json_write_value(json, json->values[array.elements + i], builder);
+		}
+		str_builder_append(builder, "]");
+		} break;
+	case JSON_OBJECT: {
+		const JSONObject obj = value.val.object;
+		str_builder_append(builder, "{");
+		for (u32 i = 0; i < obj.len; ++i) {
+			if (i) str_builder_append(builder, ",");
+			json_write_value(json, json->values[obj.items + i], builder);
+			str_builder_append(builder, ":");
+			json_write_value(json, json->values[obj.items + obj.len + i], builder);
+		}
+		str_builder_append(builder, "}");
+		} break;
+	}
+}
+
 // count number of comma-separated values until
 // closing ] or }
 static u32 json_count(JSON *json, u32 index) {
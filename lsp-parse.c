@@ -149,6 +149,24 @@ static uint32_t *parse_trigger_characters(const JSON *json, JSONArray trigger_ch
 	return array;
 }
 
+static LSPSemanticTokenType *parse_semantic_token_legend(const JSON *json, JSONArray token_types) {
+	LSPSemanticTokenType *types = NULL;
+	arr_reserve(types, token_types.len);
+	for (u32 i = 0; i < token_types.len; ++i) {
+		char name[32] = {0};
+		json_string_get(json, json_array_get_string(json, token_types, i), name, sizeof name);
+		LSPSemanticTokenType type = LSP_SEMANTIC_TOKEN_OTHER;
+		for (int t = LSP_SEMANTIC_TOKEN_MIN; t <= LSP_SEMANTIC_TOKEN_MAX; ++t) {
+			if (streq(name, lsp_semantic_token_type_to_str((LSPSemanticTokenType)t))) {
+				type = (LSPSemanticTokenType)t;
+				break;
+			}
+		}
+		arr_add(types, type);
+	}
+	return types;
+}
+
 static void parse_capabilities(LSP *lsp, const JSON *json, JSONObject capabilities) {
 	LSPCapabilities *cap = &lsp->capabilities;
 	{
@@ -274,6 +292,57 @@ static void parse_capabilities(LSP *lsp, const JSON *json, JSONObject capabiliti
 		cap->range_formatting_support = true;
 	}
 	
+	// check SemanticTokensOptions
+	JSONValue semantic_tokens_value = json_object_get(json, capabilities, "semanticTokensProvider");
+	if (semantic_tokens_value.type == JSON_OBJECT) {
+		JSONObject semantic_tokens = semantic_tokens_value.val.object;
+		JSONValue full = json_object_get(json, semantic_tokens, "full");
+		cap->semantic_tokens_support = full.type == JSON_OBJECT || full.type == JSON_TRUE;
+		cap->semantic_tokens_delta_support = full.type == JSON_OBJECT
+			&& json_object_get_bool(json, full.val.object, "delta", false);
+		JSONValue range = json_object_get(json, semantic_tokens, "range");
+		cap->semantic_tokens_range_support = range.type == JSON_OBJECT || range.type == JSON_TRUE;
+		JSONObject legend = json_object_get_object(json, semantic_tokens, "legend");
+		lsp->semantic_token_types = parse_semantic_token_legend(json,
+			json_object_get_array(json, legend, "tokenTypes"));
+	}
+	
+	// check DiagnosticOptions
+	JSONValue diagnostic_value = json_object_get(json, capabilities, "diagnosticProvider");
+	if (diagnostic_value.type == JSON_OBJECT) {
+		cap->document_diagnostic_support = true;
+		cap->workspace_diagnostic_support = json_object_get_bool(json,
+			diagnostic_value.val.object, "workspaceDiagnostics", false);
+	}
+	
+	// check for textDocument/foldingRange support
+	JSONValue folding_range_value = json_object_get(json, capabilities, "foldingRangeProvider");
+	if (folding_range_value.type == JSON_OBJECT || folding_range_value.type == JSON_TRUE) {
+		cap->folding_range_support = true;
+	}
+	
+	// check for textDocument/inlayHint support
+	JSONValue inlay_hint_value = json_object_get(json, capabilities, "inlayHintProvider");
+	if (inlay_hint_value.type == JSON_OBJECT || inlay_hint_value.type == JSON_TRUE) {
+		cap->inlay_hint_support = true;
+	}
+	
+	// check for textDocument/documentSymbol support
+	JSONValue document_symbol_value = json_object_get(json, capabilities, "documentSymbolProvider");
+	if (document_symbol_value.type == JSON_OBJECT || document_symbol_value.type == JSON_TRUE) {
+		cap->document_symbols_support = true;
+	}
+	
+	// check for call/type hierarchy support
+	JSONValue call_hierarchy_value = json_object_get(json, capabilities, "callHierarchyProvider");
+	if (call_hierarchy_value.type == JSON_OBJECT || call_hierarchy_value.type == JSON_TRUE) {
+		cap->call_hierarchy_support = true;
+	}
+	JSONValue type_hierarchy_value = json_object_get(json, capabilities, "typeHierarchyProvider");
+	if (type_hierarchy_value.type == JSON_OBJECT || type_hierarchy_value.type == JSON_TRUE) {
+		cap->type_hierarchy_support = true;
+	}
+	
 	JSONObject workspace = json_object_get_object(json, capabilities, "workspace");
 	// check WorkspaceFoldersServerCapabilities
 	JSONObject workspace_folders = json_object_get_object(json, workspace, "workspaceFolders");
@@ -692,9 +761,10 @@ static bool parse_symbol_information(LSP *lsp, const JSON *json, JSONValue value
 	return true;
 }
 
-static bool parse_workspace_symbols_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+// `result_value` is the response's result, or the value of a $/progress notification
+static bool parse_workspace_symbols_result(LSP *lsp, const JSON *json, JSONValue result_value, LSPResponse *response) {
 	LSPResponseWorkspaceSymbols *syms = &response->data.workspace_symbols;
-	JSONArray result = json_force_array(json_get(json, "result"));
+	JSONArray result = json_force_array(result_value);
 	arr_set_len(syms->symbols, result.len);
 	for (size_t i = 0; i < result.len; ++i) {
 		LSPSymbolInformation *info = &syms->symbols[i];
@@ -705,6 +775,143 @@ static bool parse_workspace_symbols_response(LSP *lsp, const JSON *json, LSPResp
 	return true;
 }
 
+static bool parse_workspace_symbols_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	return parse_workspace_symbols_result(lsp, json, json_get(json, "result"), response);
+}
+
+// parses a DocumentSymbol and its children (recursively)
+static bool parse_document_symbol(LSP *lsp, const JSON *json, JSONValue value,
+	LSPResponse *response, u32 parent, u32 depth) {
+	if (!lsp_expect_object(lsp, value, "DocumentSymbol"))
+		return false;
+	if (depth > 100) {
+		// don't overflow the stack if the server is being silly
+		return true;
+	}
+	JSONObject object = value.val.object;
+	LSPResponseDocumentSymbols *syms = &response->data.document_symbols;
+	const u32 index = arr_len(syms->symbols);
+	LSPDocumentSymbol *symbol = arr_addp(syms->symbols);
+	if (!symbol) return false;
+	symbol->parent = parent;
+	
+	JSONValue name_value = json_object_get(json, object, "name");
+	if (!lsp_expect_string(lsp, name_value, "DocumentSymbol.name"))
+		return false;
+	symbol->name = lsp_response_add_json_string(response, json, name_value.val.string);
+	JSONString detail = json_object_get_string(json, object, "detail");
+	symbol->detail = lsp_response_add_json_string(response, json, detail);
+	
+	double kind = json_object_get_number(json, object, "kind");
+	if (isfinite(kind) && kind >= LSP_SYMBOL_KIND_MIN && kind <= LSP_SYMBOL_KIND_MAX)
+		symbol->kind = (LSPSymbolKind)kind;
+	
+	if (!parse_range(lsp, json, json_object_get(json, object, "range"), &symbol->range))
+		return false;
+	JSONValue selection_range = json_object_get(json, object, "selectionRange");
+	if (selection_range.type == JSON_UNDEFINED) {
+		symbol->selection_range = symbol->range;
+	} else if (!parse_range(lsp, json, selection_range, &symbol->selection_range)) {
+		return false;
+	}
+	
+	// (symbol might be invalidated by the recursive calls)
+	JSONArray children = json_object_get_array(json, object, "children");
+	for (u32 i = 0; i < children.len; ++i) {
+		JSONValue child = json_array_get(json, children, i);
+		if (!parse_document_symbol(lsp, json, child, response, index, depth + 1))
+			return false;
+	}
+	return true;
+}
+
+static bool parse_document_symbols_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	LSPResponseDocumentSymbols *syms = &response->data.document_symbols;
+	JSONArray result = json_force_array(json_get(json, "result"));
+	for (u32 i = 0; i < result.len; ++i) {
+		JSONValue value = json_array_get(json, result, i);
+		if (value.type == JSON_OBJECT
+			&& json_object_get(json, value.val.object, "location").type != JSON_UNDEFINED) {
+			// old-style SymbolInformation -- there's no hierarchy here
+			LSPSymbolInformation info = {0};
+			if (!parse_symbol_information(lsp, json, value, response, &info))
+				return false;
+			LSPDocumentSymbol *symbol = arr_addp(syms->symbols);
+			if (!symbol) return false;
+			symbol->name = info.name;
+			symbol->detail = info.container;
+			symbol->kind = info.kind;
+			symbol->range = symbol->selection_range = info.location.range;
+			symbol->parent = U32_MAX;
+		} else if (!parse_document_symbol(lsp, json, value, response, U32_MAX, 0)) {
+			return false;
+		}
+	}
+	return true;
+}
+
+// parses CallHierarchyItem or TypeHierarchyItem
+static bool parse_hierarchy_item(LSP *lsp, const JSON *json, JSONValue value,
+	LSPResponse *response, LSPHierarchyItem *item) {
+	if (!lsp_expect_object(lsp, value, "hierarchy item"))
+		return false;
+	JSONObject object = value.val.object;
+	
+	JSONValue name_value = json_object_get(json, object, "name");
+	if (!lsp_expect_string(lsp, name_value, "hierarchy item name"))
+		return false;
+	item->name = lsp_response_add_json_string(response, json, name_value.val.string);
+	JSONString detail = json_object_get_string(json, object, "detail");
+	item->detail = lsp_response_add_json_string(response, json, detail);
+	
+	double kind = json_object_get_number(json, object, "kind");
+	if (isfinite(kind) && kind >= LSP_SYMBOL_KIND_MIN && kind <= LSP_SYMBOL_KIND_MAX)
+		item->kind = (LSPSymbolKind)kind;
+	
+	if (!parse_document_uri(lsp, json, json_object_get(json, object, "uri"), &item->document))
+		return false;
+	if (!parse_range(lsp, json, json_object_get(json, object, "range"), &item->range))
+		return false;
+	if (!parse_range(lsp, json, json_object_get(json, object, "selectionRange"), &item->selection_range))
+		return false;
+	
+	JSONValue data = json_object_get(json, object, "data");
+	if (data.type != JSON_UNDEFINED) {
+		// we have to give this back to the server exactly as it is
+		StrBuilder builder = str_builder_new();
+		json_write_value(json, data, &builder);
+		item->data = lsp_response_add_string(response, builder.str);
+		str_builder_free(&builder);
+	}
+	return true;
+}
+
+static bool parse_hierarchy_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	LSPResponseHierarchy *hierarchy = &response->data.hierarchy;
+	// (null means "no items")
+	JSONArray result = json_force_array(json_get(json, "result"));
+	for (u32 i = 0; i < result.len; ++i) {
+		JSONValue value = json_array_get(json, result, i);
+		switch (response->request.type) {
+		case LSP_REQUEST_INCOMING_CALLS:
+			// CallHierarchyIncomingCall
+			value = json_object_get(json, json_force_object(value), "from");
+			break;
+		case LSP_REQUEST_OUTGOING_CALLS:
+			// CallHierarchyOutgoingCall
+			value = json_object_get(json, json_force_object(value), "to");
+			break;
+		default:
+			break;
+		}
+		LSPHierarchyItem *item = arr_addp(hierarchy->items);
+		if (!item) return false;
+		if (!parse_hierarchy_item(lsp, json, value, response, item))
+			return false;
+	}
+	return true;
+}
+
 // fills request->id/id_string appropriately given the request's json
 // returns true on success
 static WarnUnusedResult bool parse_id(const JSON *json, LSPRequest *request) {
@@ -747,12 +954,13 @@ static bool parse_window_message(LSP *lsp, const JSON *json, LSPRequest *request
 	return true;
 }
 
-static bool parse_diagnostic(LSP *lsp, LSPRequest *request, const JSON *json, JSONObject diagnostic_in, LSPDiagnostic *diagnostic_out) {
+// strings are added to `message`
+static bool parse_diagnostic(LSP *lsp, LSPMessageBase *message, const JSON *json, JSONObject diagnostic_in, LSPDiagnostic *diagnostic_out) {
 	if (!parse_range(lsp, json, json_object_get(json, diagnostic_in, "range"),
 		&diagnostic_out->range))
 		return false;
-	diagnostic_out->message = lsp_request_add_json_string(
-		request, json,
+	diagnostic_out->message = lsp_message_add_json_string(
+		message, json,
 		json_object_get_string(json, diagnostic_in, "message")
 	);
 	JSONValue severity_val = json_object_get(json, diagnostic_in, "severity");
@@ -769,13 +977,13 @@ static bool parse_diagnostic(LSP *lsp, LSPRequest *request, const JSON *json, JS
 		int code = (int)code_val.val.number;
 		char string[32] = {0};
 		strbuf_printf(string, "%d", code);
-		diagnostic_out->code = lsp_request_add_string(request, string);
+		diagnostic_out->code = lsp_message_add_string(message, string);
 	} else if (code_val.type == JSON_STRING) {
-		diagnostic_out->code = lsp_request_add_json_string(request, json, code_val.val.string);
+		diagnostic_out->code = lsp_message_add_json_string(message, json, code_val.val.string);
 	}
 	JSONObject code_description = json_object_get_object(json, diagnostic_in, "codeDescription");
-	diagnostic_out->code_description_uri = lsp_request_add_json_string(
-		request, json,
+	diagnostic_out->code_description_uri = lsp_message_add_json_string(
+		message, json,
 		json_object_get_string(json, code_description, "href")
 	);
 	return true;
@@ -791,7 +999,7 @@ static bool parse_publish_diagnostics(LSP *lsp, const JSON *json, LSPRequest *re
 	for (u32 i = 0; i < diagnostics.len; ++i) {
 		JSONObject diagnostic_in = json_array_get_object(json, diagnostics, i);
 		LSPDiagnostic *diagnostic_out = arr_addp(pub->diagnostics);
-		if (!parse_diagnostic(lsp, request, json, diagnostic_in, diagnostic_out))
+		if (!parse_diagnostic(lsp, &request->base, json, diagnostic_in, diagnostic_out))
 			return false;
 	}
 	return true;
@@ -836,6 +1044,18 @@ static bool parse_server2client_request(LSP *lsp, JSON *json, LSPRequest *reques
 		}
 		lsp_send_response(lsp, &response);
 		return false;
+	} else if (streq(method, "workspace/diagnostic/refresh")) {
+		// reply right away, and let ted know it should pull diagnostics again
+		LSPResponse response = {0};
+		LSPRequest *r = &response.request;
+		r->type = LSP_REQUEST_DIAGNOSTIC_REFRESH;
+		if (!parse_id(json, r)) {
+			debug_println("Bad ID in workspace/diagnostic/refresh request. This shouldn't happen.");
+			return false;
+		}
+		lsp_send_response(lsp, &response);
+		request->type = LSP_REQUEST_DIAGNOSTIC_REFRESH;
+		return true;
 	} else if (str_has_prefix(method, "$/") || str_has_prefix(method, "telemetry/")) {
 		// we can safely ignore this
 	} else if (streq(method, "textDocument/publishDiagnostics")) {
@@ -981,22 +1201,13 @@ static bool parse_highlight_response(LSP *lsp, const JSON *json, LSPResponse *re
 static int references_location_cmp(void *context, const void *av, const void *bv) {
 	// IMPORTANT: don't change this comparison function.
 	// it matters in ide-usages.c
-	LSP *lsp = context;
-	const LSPLocation *a = av, *b = bv;
-	const char *a_path = lsp_document_path(lsp, a->document);
-	const char *b_path = lsp_document_path(lsp, b->document);
-	int cmp = strcmp(a_path, b_path);
-	if (cmp) return cmp;
-	u32 a_line = a->range.start.line;
-	u32 b_line = b->range.start.line;
-	if (a_line < b_line) return -1;
-	if (a_line > b_line) return +1;
-	return 0;
+	return lsp_references_location_cmp(context, av, bv);
 }
 
-static bool parse_references_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+// `result_value` is the response's result, or the value of a $/progress notification
+static bool parse_references_result(LSP *lsp, const JSON *json, JSONValue result_value, LSPResponse *response) {
 	LSPResponseReferences *refs = &response->data.references;
-	JSONArray result = json_force_array(json_get(json, "result"));
+	JSONArray result = json_force_array(result_value);
 	for (u32 r = 0; r < result.len; ++r) {
 		JSONValue location_in = json_array_get(json, result, r);
 		LSPLocation *location_out = arr_addp(refs->locations);
@@ -1007,6 +1218,10 @@ static bool parse_references_response(LSP *lsp, const JSON *json, LSPResponse *r
 	return true;
 }
 
+static bool parse_references_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	return parse_references_result(lsp, json, json_get(json, "result"), response);
+}
+
 static bool parse_document_link_response(LSP *lsp, const JSON *json, LSPResponse *response) {
 	LSPResponseDocumentLink *data = &response->data.document_link;
 	JSONArray result = json_force_array(json_get(json, "result"));
@@ -1032,6 +1247,62 @@ static bool parse_document_link_response(LSP *lsp, const JSON *json, LSPResponse
 	return true;
 }
 
+static bool parse_folding_range_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	LSPResponseFoldingRange *data = &response->data.folding_range;
+	JSONArray result = json_force_array(json_get(json, "result"));
+	
+	for (u32 i = 0; i < result.len; ++i) {
+		JSONObject range_object = json_array_get_object(json, result, i);
+		JSONValue start_line = json_object_get(json, range_object, "startLine");
+		JSONValue end_line = json_object_get(json, range_object, "endLine");
+		if (!lsp_expect_number(lsp, start_line, "folding range start line")
+			|| !lsp_expect_number(lsp, end_line, "folding range end line"))
+			return false;
+		if (end_line.val.number <= start_line.val.number)
+			continue; // nothing to fold
+		LSPFoldingRange *range = arr_addp(data->ranges);
+		if (!range) break;
+		range->start_line = (u32)start_line.val.number;
+		range->end_line = (u32)end_line.val.number;
+	}
+	return true;
+}
+
+static bool parse_inlay_hint_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	LSPResponseInlayHint *data = &response->data.inlay_hint;
+	JSONArray result = json_force_array(json_get(json, "result"));
+	
+	for (u32 i = 0; i < result.len; ++i) {
+		JSONObject hint_object = json_array_get_object(json, result, i);
+		LSPInlayHint *hint = arr_addp(data->hints);
+		if (!hint) break;
+		if (!parse_position(lsp, json, json_object_get(json, hint_object, "position"), &hint->position))
+			return false;
+		JSONValue label = json_object_get(json, hint_object, "label");
+		if (label.type == JSON_STRING) {
+			hint->label = lsp_response_add_json_string(response, json, label.val.string);
+		} else if (label.type == JSON_ARRAY) {
+			// InlayHintLabelPart[] -- we just want the text
+			StrBuilder text = str_builder_new();
+			JSONArray parts = label.val.array;
+			for (u32 p = 0; p < parts.len; ++p) {
+				JSONObject part = json_array_get_object(json, parts, p);
+				char *value = json_string_get_alloc(json, json_object_get_string(json, part, "value"));
+				str_builder_append(&text, value);
+				free(value);
+			}
+			hint->label = lsp_response_add_string(response, text.str ? text.str : "");
+			str_builder_free(&text);
+		} else {
+			lsp_set_error(lsp, "Bad inlay hint label type: %s", json_type_to_str(label.type));
+			return false;
+		}
+		hint->padding_left = json_object_get_bool(json, hint_object, "paddingLeft", false);
+		hint->padding_right = json_object_get_bool(json, hint_object, "paddingRight", false);
+	}
+	return true;
+}
+
 static bool parse_formatting_response(LSP *lsp, const JSON *json, LSPResponse *response) {
 	JSONValue edits_val = json_get(json, "result");
 	if (!(edits_val.type == JSON_ARRAY || edits_val.type == JSON_NULL)) {
@@ -1048,6 +1319,180 @@ static bool parse_formatting_response(LSP *lsp, const JSON *json, LSPResponse *r
 	return true;
 }
 
+// append the integers in `array` to `*data`
+static bool parse_semantic_tokens_data(LSP *lsp, const JSON *json, JSONValue array_value, u32 **data) {
+	if (array_value.type != JSON_ARRAY) {
+		lsp_set_error(lsp, "Expected array for semantic tokens data; got %s",
+			json_type_to_str(array_value.type));
+		return false;
+	}
+	JSONArray array = array_value.val.array;
+	arr_reserve(*data, arr_len(*data) + array.len);
+	for (u32 i = 0; i < array.len; ++i) {
+		double x = json_array_get_number(json, array, i);
+		arr_add(*data, x >= 0 && x <= U32_MAX ? (u32)x : 0);
+	}
+	return true;
+}
+
+static bool parse_semantic_tokens_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	// result: SemanticTokens | SemanticTokensDelta | null
+	LSPResponseSemanticTokens *tokens = &response->data.semantic_tokens;
+	JSONValue result = json_get(json, "result");
+	if (result.type == JSON_NULL)
+		return true;
+	if (result.type != JSON_OBJECT) {
+		lsp_set_error(lsp, "Expected SemanticTokens or null for semantic tokens response; got %s",
+			json_type_to_str(result.type));
+		return false;
+	}
+	JSONObject object = result.val.object;
+	tokens->result_id = lsp_response_add_json_string(response, json,
+		json_object_get_string(json, object, "resultId"));
+	JSONValue edits_value = json_object_get(json, object, "edits");
+	if (edits_value.type == JSON_UNDEFINED) {
+		return parse_semantic_tokens_data(lsp, json, json_object_get(json, object, "data"), &tokens->data);
+	}
+	
+	tokens->is_delta = true;
+	JSONArray edits = json_force_array(edits_value);
+	for (u32 i = 0; i < edits.len; ++i) {
+		JSONObject edit_object = json_array_get_object(json, edits, i);
+		LSPSemanticTokensEdit *edit = arr_addp(tokens->edits);
+		edit->start = (u32)json_object_get_number(json, edit_object, "start");
+		edit->delete_count = (u32)json_object_get_number(json, edit_object, "deleteCount");
+		edit->data_start = arr_len(tokens->data);
+		JSONValue data = json_object_get(json, edit_object, "data");
+		if (data.type != JSON_UNDEFINED
+			&& !parse_semantic_tokens_data(lsp, json, data, &tokens->data))
+			return false;
+		edit->data_len = arr_len(tokens->data) - edit->data_start;
+	}
+	return true;
+}
+
+// parse a FullDocumentDiagnosticReport or UnchangedDocumentDiagnosticReport
+static bool parse_diagnostic_report(LSP *lsp, const JSON *json, LSPResponse *response, JSONObject report_in, LSPDocumentID document) {
+	LSPResponseDiagnostic *diagnostic = &response->data.diagnostic;
+	LSPDiagnosticReport *report = arr_addp(diagnostic->reports);
+	if (!report) return false;
+	report->document = document;
+	report->result_id = lsp_response_add_json_string(response, json,
+		json_object_get_string(json, report_in, "resultId"));
+	char kind[16] = {0};
+	json_string_get(json, json_object_get_string(json, report_in, "kind"), kind, sizeof kind);
+	if (streq(kind, "unchanged")) {
+		report->unchanged = true;
+		return true;
+	}
+	report->diagnostics_start = arr_len(diagnostic->diagnostics);
+	JSONArray items = json_object_get_array(json, report_in, "items");
+	for (u32 i = 0; i < items.len; ++i) {
+		JSONObject diagnostic_in = json_array_get_object(json, items, i);
+		LSPDiagnostic *diagnostic_out = arr_addp(diagnostic->diagnostics);
+		if (!parse_diagnostic(lsp, &response->base, json, diagnostic_in, diagnostic_out))
+			return false;
+	}
+	report->diagnostics_count = arr_len(diagnostic->diagnostics) - report->diagnostics_start;
+	return true;
+}
+
+static bool parse_document_diagnostic_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	// result: DocumentDiagnosticReport | null
+	JSONValue result = json_get(json, "result");
+	if (result.type == JSON_NULL)
+		return true;
+	if (result.type != JSON_OBJECT) {
+		lsp_set_error(lsp, "Expected DocumentDiagnosticReport for diagnostic response; got %s",
+			json_type_to_str(result.type));
+		return false;
+	}
+	return parse_diagnostic_report(lsp, json, response, result.val.object,
+		response->request.data.document_diagnostic.document);
+}
+
+static bool parse_workspace_diagnostic_response(LSP *lsp, const JSON *json, LSPResponse *response) {
+	// result: WorkspaceDiagnosticReport
+	JSONObject result = json_force_object(json_get(json, "result"));
+	JSONArray items = json_object_get_array(json, result, "items");
+	for (u32 i = 0; i < items.len; ++i) {
+		JSONObject item = json_array_get_object(json, items, i);
+		LSPDocumentID document = 0;
+		if (!parse_document_uri(lsp, json, json_object_get(json, item, "uri"), &document))
+			return false;
+		if (!parse_diagnostic_report(lsp, json, response, item, document))
+			return false;
+	}
+	return true;
+}
+
+// `response` is now the client's responsibility
+static void add_response_to_messages(LSP *lsp, LSPResponse *response) {
+	SDL_LockMutex(lsp->messages_mutex);
+	LSPMessage *message = arr_addp(lsp->messages_server2client);
+	response->base.type = LSP_RESPONSE;
+	message->response = *response;
+	SDL_UnlockMutex(lsp->messages_mutex);
+	lsp_notify_client();
+}
+
+// a $/progress notification whose token is the partialResultToken of one of our requests
+// (LSP_PARTIAL_RESULT_TOKEN_PREFIX followed by its ID) contains a batch of partial results for it.
+// these are passed on as responses with `partial` set.
+//
+// returns false if this isn't a $/progress notification.
+static bool process_partial_result(LSP *lsp, const JSON *json) {
+	char method[16] = {0};
+	json_string_get(json, json_force_string(json_get(json, "method")), method, sizeof method);
+	if (!streq(method, "$/progress"))
+		return false;
+	JSONValue token = json_get(json, "params.token");
+	char token_str[32] = {0};
+	if (token.type == JSON_STRING)
+		json_string_get(json, token.val.string, token_str, sizeof token_str);
+	const char *const prefix = LSP_PARTIAL_RESULT_TOKEN_PREFIX;
+	if (!str_has_prefix(token_str, prefix))
+		return true; // work done progress, or something else we don't care about
+	const char *id_str = token_str + strlen(prefix);
+	char *endp = NULL;
+	const unsigned long id = strtoul(id_str, &endp, 10);
+	if (!isdigit((u8)*id_str) || *endp || id == 0 || id > U32_MAX)
+		return true;
+	
+	LSPResponse response = {0};
+	response.partial = true;
+	SDL_LockMutex(lsp->messages_mutex);
+	arr_foreach_ptr(lsp->requests_sent, const LSPRequest, req) {
+		if (req->id == id) {
+			// the request is still pending, so we need our own copy of it
+			response.request = *req;
+			response.request.base.string_data = arr_copy(req->base.string_data);
+			break;
+		}
+	}
+	SDL_UnlockMutex(lsp->messages_mutex);
+	
+	JSONValue value = json_get(json, "params.value");
+	bool add_to_messages = false;
+	switch (response.request.type) {
+	case LSP_REQUEST_REFERENCES:
+		add_to_messages = parse_references_result(lsp, json, value, &response);
+		break;
+	case LSP_REQUEST_WORKSPACE_SYMBOLS:
+		add_to_messages = parse_workspace_symbols_result(lsp, json, value, &response);
+		break;
+	default:
+		// cancelled request, or one which we didn't ask for partial results for
+		break;
+	}
+	if (add_to_messages) {
+		add_response_to_messages(lsp, &response);
+	} else {
+		lsp_response_free(&response);
+	}
+	return true;
+}
+
 void process_message(LSP *lsp, JSON *json) {
 		
 	#if 0
@@ -1128,6 +1573,34 @@ void process_message(LSP *lsp, JSON *json) {
 			case LSP_REQUEST_DOCUMENT_LINK:
 				add_to_messages = parse_document_link_response(lsp, json, &response);
 				break;
+			case LSP_REQUEST_SEMANTIC_TOKENS:
+			case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+			case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+				add_to_messages = parse_semantic_tokens_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+				add_to_messages = parse_document_diagnostic_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+				add_to_messages = parse_workspace_diagnostic_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_FOLDING_RANGE:
+				add_to_messages = parse_folding_range_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_INLAY_HINT:
+				add_to_messages = parse_inlay_hint_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_DOCUMENT_SYMBOLS:
+				add_to_messages = parse_document_symbols_response(lsp, json, &response);
+				break;
+			case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+			case LSP_REQUEST_INCOMING_CALLS:
+			case LSP_REQUEST_OUTGOING_CALLS:
+			case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+			case LSP_REQUEST_SUPERTYPES:
+			case LSP_REQUEST_SUBTYPES:
+				add_to_messages = parse_hierarchy_response(lsp, json, &response);
+				break;
 			case LSP_REQUEST_INITIALIZE:
 				if (!lsp->initialized) {
 					// it's the response to our initialize request!
@@ -1164,15 +1637,13 @@ void process_message(LSP *lsp, JSON *json) {
 			}
 			
 			if (add_to_messages) {
-				SDL_LockMutex(lsp->messages_mutex);
-				LSPMessage *message = arr_addp(lsp->messages_server2client);
-				response.base.type = LSP_RESPONSE;
-				message->response = response;
-				SDL_UnlockMutex(lsp->messages_mutex);
+				add_response_to_messages(lsp, &response);
 			} else {
 				lsp_response_free(&response);
 			}
 		}
+	} else if (process_partial_result(lsp, json)) {
+		// (already dealt with)
 	} else if (json_has(json, "method")) {
 		// server-to-client request
 		LSPRequest request = {0};
@@ -1182,6 +1653,7 @@ void process_message(LSP *lsp, JSON *json) {
 			request.base.type = LSP_REQUEST;
 			message->request = request;
 			SDL_UnlockMutex(lsp->messages_mutex);
+			lsp_notify_client();
 		} else {
 			lsp_request_free(&request);
 		}
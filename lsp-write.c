@@ -158,6 +158,14 @@ static void write_key_string(JSONWriter *o, const char *key, const char *s) {
 	write_string(o, s);
 }
 
+// ask for results to be streamed to us with $/progress
+// (see process_partial_result in lsp-parse.c)
+static void write_key_partial_result_token(JSONWriter *o, const LSPRequest *request) {
+	char token[32];
+	strbuf_printf(token, LSP_PARTIAL_RESULT_TOKEN_PREFIX "%" PRIu32, request->id);
+	write_key_string(o, "partialResultToken", token);
+}
+
 static void write_arr_elem_string(JSONWriter *o, const char *s) {
 	write_arr_elem(o);
 	write_string(o, s);
@@ -249,6 +257,24 @@ static void write_document_position(JSONWriter *o, LSPDocumentPosition pos) {
 	write_key_position(o, "position", pos.pos);
 }
 
+static void write_hierarchy_item(JSONWriter *o, const LSPRequest *request, const LSPHierarchyItem *item) {
+	write_obj_start(o);
+		write_key_string(o, "name", lsp_request_string(request, item->name));
+		write_key_number(o, "kind", item->kind);
+		const char *detail = lsp_request_string(request, item->detail);
+		if (*detail)
+			write_key_string(o, "detail", detail);
+		write_key_file_uri(o, "uri", item->document);
+		write_key_range(o, "range", item->range);
+		write_key_range(o, "selectionRange", item->selection_range);
+		const char *data = lsp_request_string(request, item->data);
+		if (*data) {
+			write_key(o, "data");
+			str_builder_append(o->builder, data);
+		}
+	write_obj_end(o);
+}
+
 static const char *lsp_request_method(LSPRequest *request) {
 	switch (request->type) {
 	case LSP_REQUEST_NONE: break;
@@ -278,6 +304,8 @@ static const char *lsp_request_method(LSPRequest *request) {
 		return "textDocument/signatureHelp";
 	case LSP_REQUEST_PUBLISH_DIAGNOSTICS:
 		return "textDocument/publishDiagnostics";
+	case LSP_REQUEST_DIAGNOSTIC_REFRESH:
+		return "workspace/diagnostic/refresh";
 	case LSP_REQUEST_HOVER:
 		return "textDocument/hover";
 	case LSP_REQUEST_REFERENCES:
@@ -308,6 +336,34 @@ static const char *lsp_request_method(LSPRequest *request) {
 		return "textDocument/rangeFormatting";
 	case LSP_REQUEST_FORMATTING:
 		return "textDocument/formatting";
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+		return "textDocument/semanticTokens/full";
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+		return "textDocument/semanticTokens/full/delta";
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+		return "textDocument/semanticTokens/range";
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+		return "textDocument/diagnostic";
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+		return "workspace/diagnostic";
+	case LSP_REQUEST_FOLDING_RANGE:
+		return "textDocument/foldingRange";
+	case LSP_REQUEST_INLAY_HINT:
+		return "textDocument/inlayHint";
+	case LSP_REQUEST_DOCUMENT_SYMBOLS:
+		return "textDocument/documentSymbol";
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+		return "textDocument/prepareCallHierarchy";
+	case LSP_REQUEST_INCOMING_CALLS:
+		return "callHierarchy/incomingCalls";
+	case LSP_REQUEST_OUTGOING_CALLS:
+		return "callHierarchy/outgoingCalls";
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+		return "textDocument/prepareTypeHierarchy";
+	case LSP_REQUEST_SUPERTYPES:
+		return "typeHierarchy/supertypes";
+	case LSP_REQUEST_SUBTYPES:
+		return "typeHierarchy/subtypes";
 	}
 	assert(0);
 	return "$/ignore";
@@ -398,6 +454,7 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 	case LSP_REQUEST_LOG_MESSAGE:
 	case LSP_REQUEST_WORKSPACE_FOLDERS:
 	case LSP_REQUEST_PUBLISH_DIAGNOSTICS:
+	case LSP_REQUEST_DIAGNOSTIC_REFRESH:
 		assert(0);
 		break;
 	case LSP_REQUEST_SHUTDOWN:
@@ -465,6 +522,58 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 					write_key_obj_start(o, "publishDiagnostics");
 						write_key_bool(o, "codeDescriptionSupport", true);
 					write_obj_end(o);
+					
+					// semantic tokens capabilities
+					write_key_obj_start(o, "semanticTokens");
+						write_key_obj_start(o, "requests");
+							write_key_bool(o, "range", true);
+							write_key_obj_start(o, "full");
+								write_key_bool(o, "delta", true);
+							write_obj_end(o);
+						write_obj_end(o);
+						write_key_arr_start(o, "tokenTypes");
+							for (int i = LSP_SEMANTIC_TOKEN_MIN; i <= LSP_SEMANTIC_TOKEN_MAX; ++i)
+								write_arr_elem_string(o, lsp_semantic_token_type_to_str((LSPSemanticTokenType)i));
+						write_arr_end(o);
+						// we don't do anything with modifiers
+						write_key_arr_start(o, "tokenModifiers");
+						write_arr_end(o);
+						write_key_arr_start(o, "formats");
+							write_arr_elem_string(o, "relative");
+						write_arr_end(o);
+						write_key_bool(o, "overlappingTokenSupport", false);
+						write_key_bool(o, "multilineTokenSupport", false);
+					write_obj_end(o);
+					
+					// pull diagnostics capabilities
+					write_key_obj_start(o, "diagnostic");
+						write_key_bool(o, "relatedDocumentSupport", false);
+					write_obj_end(o);
+					
+					// folding range capabilities
+					write_key_obj_start(o, "foldingRange");
+						// we can only fold entire lines
+						write_key_bool(o, "lineFoldingOnly", true);
+					write_obj_end(o);
+					
+					// inlay hint capabilities
+					write_key_obj_start(o, "inlayHint");
+						// we don't send inlayHint/resolve requests
+						// (the label is all we show, and servers always include it)
+					write_obj_end(o);
+					
+					// document symbol capabilities
+					write_key_obj_start(o, "documentSymbol");
+						write_symbol_kind_support(o);
+						write_symbol_tag_support(o);
+						write_key_bool(o, "hierarchicalDocumentSymbolSupport", true);
+					write_obj_end(o);
+					
+					// call/type hierarchy capabilities
+					write_key_obj_start(o, "callHierarchy");
+					write_obj_end(o);
+					write_key_obj_start(o, "typeHierarchy");
+					write_obj_end(o);
 				write_obj_end(o);
 				write_key_obj_start(o, "workspace");
 					write_key_bool(o, "workspaceFolders", true);
@@ -481,6 +590,10 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 						write_symbol_tag_support(o);
 						// resolve is kind of a pain to implement. i'm not doing it yet.
 					write_obj_end(o);
+					write_key_obj_start(o, "diagnostics");
+						// (we pull diagnostics again when we get a workspace/diagnostic/refresh request)
+						write_key_bool(o, "refreshSupport", true);
+					write_obj_end(o);
 				write_obj_end(o);
 			write_obj_end(o);
 			SDL_LockMutex(lsp->workspace_folders_mutex);
@@ -596,6 +709,7 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 				// why, LSP, why
 				write_key_bool(o, "includeDeclaration", refs->include_declaration);
 			write_obj_end(o);
+			write_key_partial_result_token(o, request);
 		write_obj_end(o);
 	} break;
 	case LSP_REQUEST_DOCUMENT_LINK: {
@@ -606,6 +720,85 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 			write_obj_end(o);
 		write_obj_end(o);
 	} break;
+	case LSP_REQUEST_FOLDING_RANGE: {
+		const LSPRequestFoldingRange *folding = &request->data.folding_range;
+		write_key_obj_start(o, "params");
+			write_key_obj_start(o, "textDocument");
+				write_key_file_uri(o, "uri", folding->document);
+			write_obj_end(o);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_INLAY_HINT: {
+		const LSPRequestInlayHint *hint = &request->data.inlay_hint;
+		write_key_obj_start(o, "params");
+			write_key_obj_start(o, "textDocument");
+				write_key_file_uri(o, "uri", hint->document);
+			write_obj_end(o);
+			write_key_range(o, "range", hint->range);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_DOCUMENT_SYMBOLS: {
+		const LSPRequestDocumentSymbols *syms = &request->data.document_symbols;
+		write_key_obj_start(o, "params");
+			write_key_obj_start(o, "textDocument");
+				write_key_file_uri(o, "uri", syms->document);
+			write_obj_end(o);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY: {
+		const LSPRequestHierarchy *hierarchy = &request->data.hierarchy;
+		write_key_obj_start(o, "params");
+			write_document_position(o, hierarchy->position);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES: {
+		const LSPRequestHierarchy *hierarchy = &request->data.hierarchy;
+		write_key_obj_start(o, "params");
+			write_key(o, "item");
+			write_hierarchy_item(o, request, &hierarchy->item);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE: {
+		const LSPRequestSemanticTokens *tokens = &request->data.semantic_tokens;
+		write_key_obj_start(o, "params");
+			write_key_obj_start(o, "textDocument");
+				write_key_file_uri(o, "uri", tokens->document);
+			write_obj_end(o);
+			if (request->type == LSP_REQUEST_SEMANTIC_TOKENS_DELTA)
+				write_key_string(o, "previousResultId", lsp_request_string(request, tokens->previous_result_id));
+			if (request->type == LSP_REQUEST_SEMANTIC_TOKENS_RANGE)
+				write_key_range(o, "range", tokens->range);
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC: {
+		const LSPRequestDocumentDiagnostic *diagnostic = &request->data.document_diagnostic;
+		write_key_obj_start(o, "params");
+			write_key_obj_start(o, "textDocument");
+				write_key_file_uri(o, "uri", diagnostic->document);
+			write_obj_end(o);
+			if (!lsp_string_is_empty(diagnostic->previous_result_id))
+				write_key_string(o, "previousResultId", lsp_request_string(request, diagnostic->previous_result_id));
+		write_obj_end(o);
+	} break;
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC: {
+		const LSPRequestWorkspaceDiagnostic *diagnostic = &request->data.workspace_diagnostic;
+		write_key_obj_start(o, "params");
+			write_key_arr_start(o, "previousResultIds");
+			arr_foreach_ptr(diagnostic->previous_result_ids, const LSPPreviousResultID, prev) {
+				write_arr_elem_obj_start(o);
+					write_key_file_uri(o, "uri", prev->document);
+					write_key_string(o, "value", lsp_request_string(request, prev->result_id));
+				write_obj_end(o);
+			}
+			write_arr_end(o);
+		write_obj_end(o);
+	} break;
 	case LSP_REQUEST_RENAME: {
 		const LSPRequestRename *rename = &request->data.rename;
 		write_key_obj_start(o, "params");
@@ -617,6 +810,7 @@ void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder) {
 		const LSPRequestWorkspaceSymbols *syms = &request->data.workspace_symbols;
 		write_key_obj_start(o, "params");
 			write_key_string(o, "query", lsp_request_string(request, syms->query));
+			write_key_partial_result_token(o, request);
 		write_obj_end(o);
 	} break;
 	case LSP_REQUEST_DID_CHANGE_WORKSPACE_FOLDERS: {
@@ -699,6 +893,7 @@ static void write_response(LSP *lsp, LSPResponse *response, StrBuilder *builder)
 			SDL_UnlockMutex(lsp->workspace_folders_mutex);
 			break;
 		case LSP_REQUEST_SHOW_MESSAGE:
+		case LSP_REQUEST_DIAGNOSTIC_REFRESH:
 			write_null(o);
 			break;
 		default:
@@ -21,6 +21,12 @@ static LSPRequestID get_request_id(void) {
 	return id;
 }
 
+void lsp_notify_client(void) {
+	// an empty user event is enough to wake up SDL_WaitEvent
+	SDL_Event event = {.type = SDL_USEREVENT};
+	SDL_PushEvent(&event);
+}
+
 bool lsp_get_error(LSP *lsp, char *error, size_t error_size, bool clear) {
 	bool has_err = false;
 	SDL_LockMutex(lsp->error_mutex);
@@ -51,7 +57,7 @@ char *lsp_message_alloc_string(LSPMessageBase *message, size_t len, LSPString *s
 	return message->string_data + offset;
 }
 
-static LSPString lsp_message_add_string(LSPMessageBase *message, const char *string) {
+LSPString lsp_message_add_string(LSPMessageBase *message, const char *string) {
 	LSPString ret = {0};
 	size_t len = strlen(string);
 	if (len == 0) {
@@ -61,7 +67,7 @@ static LSPString lsp_message_add_string(LSPMessageBase *message, const char *str
 	memcpy(dest, string, len);
 	return ret;
 }
-static LSPString lsp_message_add_json_string(LSPMessageBase *message, const JSON *json, JSONString string) {
+LSPString lsp_message_add_json_string(LSPMessageBase *message, const JSON *json, JSONString string) {
 	LSPString ret = {0};
 	size_t len = string.len;
 	if (len == 0) {
@@ -120,11 +126,28 @@ void lsp_request_free(LSPRequest *r) {
 	case LSP_REQUEST_HIGHLIGHT:
 	case LSP_REQUEST_DID_CLOSE:
 	case LSP_REQUEST_WORKSPACE_FOLDERS:
+	case LSP_REQUEST_DIAGNOSTIC_REFRESH:
 	case LSP_REQUEST_DOCUMENT_LINK:
 	case LSP_REQUEST_CONFIGURATION:
 	case LSP_REQUEST_DID_OPEN:
 	case LSP_REQUEST_FORMATTING:
 	case LSP_REQUEST_RANGE_FORMATTING:
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+	case LSP_REQUEST_FOLDING_RANGE:
+	case LSP_REQUEST_INLAY_HINT:
+	case LSP_REQUEST_DOCUMENT_SYMBOLS:
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES:
+		break;
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+		arr_free(r->data.workspace_diagnostic.previous_result_ids);
 		break;
 	case LSP_REQUEST_PUBLISH_DIAGNOSTICS: {
 		LSPRequestPublishDiagnostics *pub = &r->data.publish_diagnostics;
@@ -184,6 +207,34 @@ void lsp_response_free(LSPResponse *r) {
 	case LSP_REQUEST_FORMATTING:
 		arr_free(r->data.formatting.edits);
 		break;
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+		arr_free(r->data.semantic_tokens.data);
+		arr_free(r->data.semantic_tokens.edits);
+		break;
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+		arr_free(r->data.diagnostic.reports);
+		arr_free(r->data.diagnostic.diagnostics);
+		break;
+	case LSP_REQUEST_FOLDING_RANGE:
+		arr_free(r->data.folding_range.ranges);
+		break;
+	case LSP_REQUEST_INLAY_HINT:
+		arr_free(r->data.inlay_hint.hints);
+		break;
+	case LSP_REQUEST_DOCUMENT_SYMBOLS:
+		arr_free(r->data.document_symbols.symbols);
+		break;
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES:
+		arr_free(r->data.hierarchy.items);
+		break;
 	default:
 		break;
 	}
@@ -230,6 +281,7 @@ static bool lsp_supports_request(LSP *lsp, const LSPRequest *request) {
 	case LSP_REQUEST_LOG_MESSAGE:
 	case LSP_REQUEST_WORKSPACE_FOLDERS:
 	case LSP_REQUEST_PUBLISH_DIAGNOSTICS:
+	case LSP_REQUEST_DIAGNOSTIC_REFRESH:
 		return false;
 	case LSP_REQUEST_DID_OPEN:
 	case LSP_REQUEST_DID_CLOSE:
@@ -273,6 +325,30 @@ static bool lsp_supports_request(LSP *lsp, const LSPRequest *request) {
 		return cap->formatting_support;
 	case LSP_REQUEST_RANGE_FORMATTING:
 		return cap->range_formatting_support;
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+		return cap->semantic_tokens_support;
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+		return cap->semantic_tokens_delta_support;
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+		return cap->semantic_tokens_range_support;
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+		return cap->document_diagnostic_support;
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+		return cap->workspace_diagnostic_support;
+	case LSP_REQUEST_FOLDING_RANGE:
+		return cap->folding_range_support;
+	case LSP_REQUEST_INLAY_HINT:
+		return cap->inlay_hint_support;
+	case LSP_REQUEST_DOCUMENT_SYMBOLS:
+		return cap->document_symbols_support;
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+		return cap->call_hierarchy_support;
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES:
+		return cap->type_hierarchy_support;
 	}
 	assert(0);
 	return false;
@@ -313,9 +389,24 @@ static bool request_type_is_notification(LSPRequestType type) {
 	case LSP_REQUEST_RENAME:
 	case LSP_REQUEST_WORKSPACE_SYMBOLS:
 	case LSP_REQUEST_WORKSPACE_FOLDERS:
+	case LSP_REQUEST_DIAGNOSTIC_REFRESH:
 	case LSP_REQUEST_DOCUMENT_LINK:
 	case LSP_REQUEST_FORMATTING:
 	case LSP_REQUEST_RANGE_FORMATTING:
+	case LSP_REQUEST_SEMANTIC_TOKENS:
+	case LSP_REQUEST_SEMANTIC_TOKENS_DELTA:
+	case LSP_REQUEST_SEMANTIC_TOKENS_RANGE:
+	case LSP_REQUEST_DOCUMENT_DIAGNOSTIC:
+	case LSP_REQUEST_WORKSPACE_DIAGNOSTIC:
+	case LSP_REQUEST_FOLDING_RANGE:
+	case LSP_REQUEST_INLAY_HINT:
+	case LSP_REQUEST_DOCUMENT_SYMBOLS:
+	case LSP_REQUEST_PREPARE_CALL_HIERARCHY:
+	case LSP_REQUEST_INCOMING_CALLS:
+	case LSP_REQUEST_OUTGOING_CALLS:
+	case LSP_REQUEST_PREPARE_TYPE_HIERARCHY:
+	case LSP_REQUEST_SUPERTYPES:
+	case LSP_REQUEST_SUBTYPES:
 		return false;
 	}
 	assert(0);
@@ -828,6 +919,7 @@ void lsp_free(LSP *lsp) {
 	arr_free(lsp->completion_trigger_chars);
 	arr_free(lsp->signature_help_trigger_chars);
 	arr_free(lsp->signature_help_retrigger_chars);
+	arr_free(lsp->semantic_token_types);
 	free(lsp->command);
 	free(lsp->configuration_to_send);
 	memset(lsp, 0, sizeof *lsp);
@@ -877,6 +969,18 @@ LSPDocumentPosition lsp_location_end_position(LSPLocation location) {
 	};
 }
 
+int lsp_references_location_cmp(LSP *lsp, const LSPLocation *a, const LSPLocation *b) {
+	const char *a_path = lsp_document_path(lsp, a->document);
+	const char *b_path = lsp_document_path(lsp, b->document);
+	int cmp = strcmp(a_path, b_path);
+	if (cmp) return cmp;
+	u32 a_line = a->range.start.line;
+	u32 b_line = b->range.start.line;
+	if (a_line < b_line) return -1;
+	if (a_line > b_line) return +1;
+	return 0;
+}
+
 const uint32_t *lsp_completion_trigger_chars(LSP *lsp) {
 	return lsp->completion_trigger_chars;
 }
@@ -889,6 +993,43 @@ const uint32_t *lsp_signature_help_retrigger_chars(LSP *lsp) {
 	return lsp->signature_help_retrigger_chars;
 }
 
+LSPSemanticTokenType lsp_semantic_token_type(LSP *lsp, u32 index) {
+	if (index >= arr_len(lsp->semantic_token_types))
+		return LSP_SEMANTIC_TOKEN_OTHER;
+	return lsp->semantic_token_types[index];
+}
+
+const char *lsp_semantic_token_type_to_str(LSPSemanticTokenType type) {
+	static const char *const names[LSP_SEMANTIC_TOKEN_MAX + 1] = {
+		[LSP_SEMANTIC_TOKEN_NAMESPACE] = "namespace",
+		[LSP_SEMANTIC_TOKEN_TYPE] = "type",
+		[LSP_SEMANTIC_TOKEN_CLASS] = "class",
+		[LSP_SEMANTIC_TOKEN_ENUM] = "enum",
+		[LSP_SEMANTIC_TOKEN_INTERFACE] = "interface",
+		[LSP_SEMANTIC_TOKEN_STRUCT] = "struct",
+		[LSP_SEMANTIC_TOKEN_TYPE_PARAMETER] = "typeParameter",
+		[LSP_SEMANTIC_TOKEN_PARAMETER] = "parameter",
+		[LSP_SEMANTIC_TOKEN_VARIABLE] = "variable",
+		[LSP_SEMANTIC_TOKEN_PROPERTY] = "property",
+		[LSP_SEMANTIC_TOKEN_ENUM_MEMBER] = "enumMember",
+		[LSP_SEMANTIC_TOKEN_EVENT] = "event",
+		[LSP_SEMANTIC_TOKEN_FUNCTION] = "function",
+		[LSP_SEMANTIC_TOKEN_METHOD] = "method",
+		[LSP_SEMANTIC_TOKEN_MACRO] = "macro",
+		[LSP_SEMANTIC_TOKEN_KEYWORD] = "keyword",
+		[LSP_SEMANTIC_TOKEN_MODIFIER] = "modifier",
+		[LSP_SEMANTIC_TOKEN_COMMENT] = "comment",
+		[LSP_SEMANTIC_TOKEN_STRING] = "string",
+		[LSP_SEMANTIC_TOKEN_NUMBER] = "number",
+		[LSP_SEMANTIC_TOKEN_REGEXP] = "regexp",
+		[LSP_SEMANTIC_TOKEN_OPERATOR] = "operator",
+		[LSP_SEMANTIC_TOKEN_DECORATOR] = "decorator",
+	};
+	if (type < LSP_SEMANTIC_TOKEN_MIN || type > LSP_SEMANTIC_TOKEN_MAX)
+		return "";
+	return names[type];
+}
+
 bool lsp_covers_path(LSP *lsp, const char *path) {
 	bool ret = false;
 	SDL_LockMutex(lsp->workspace_folders_mutex);
@@ -91,11 +91,26 @@ typedef enum {
 	LSP_REQUEST_RANGE_FORMATTING, //< textDocument/rangeFormatting
 	LSP_REQUEST_WORKSPACE_SYMBOLS, //< workspace/symbol
 	LSP_REQUEST_DID_CHANGE_WORKSPACE_FOLDERS, //< workspace/didChangeWorkspaceFolders
+	LSP_REQUEST_SEMANTIC_TOKENS, //< textDocument/semanticTokens/full
+	LSP_REQUEST_SEMANTIC_TOKENS_DELTA, //< textDocument/semanticTokens/full/delta
+	LSP_REQUEST_SEMANTIC_TOKENS_RANGE, //< textDocument/semanticTokens/range
+	LSP_REQUEST_DOCUMENT_DIAGNOSTIC, //< textDocument/diagnostic
+	LSP_REQUEST_WORKSPACE_DIAGNOSTIC, //< workspace/diagnostic
+	LSP_REQUEST_FOLDING_RANGE, //< textDocument/foldingRange
+	LSP_REQUEST_INLAY_HINT, //< textDocument/inlayHint
+	LSP_REQUEST_DOCUMENT_SYMBOLS, //< textDocument/documentSymbol
+	LSP_REQUEST_PREPARE_CALL_HIERARCHY, //< textDocument/prepareCallHierarchy
+	LSP_REQUEST_INCOMING_CALLS, //< callHierarchy/incomingCalls
+	LSP_REQUEST_OUTGOING_CALLS, //< callHierarchy/outgoingCalls
+	LSP_REQUEST_PREPARE_TYPE_HIERARCHY, //< textDocument/prepareTypeHierarchy
+	LSP_REQUEST_SUPERTYPES, //< typeHierarchy/supertypes
+	LSP_REQUEST_SUBTYPES, //< typeHierarchy/subtypes
 	// server-to-client
 	LSP_REQUEST_SHOW_MESSAGE, //< window/showMessage and window/showMessageRequest
 	LSP_REQUEST_LOG_MESSAGE, //< window/logMessage
 	LSP_REQUEST_WORKSPACE_FOLDERS, //< workspace/workspaceFolders - NOTE: this is handled directly in lsp-parse.c (because it only needs information from the LSP struct)
 	LSP_REQUEST_PUBLISH_DIAGNOSTICS, //< textDocument/publishDiagnostics
+	LSP_REQUEST_DIAGNOSTIC_REFRESH, //< workspace/diagnostic/refresh
 } LSPRequestType;
 
 typedef enum {
@@ -140,6 +155,41 @@ typedef struct {
 	LSPDocumentChangeEvent *changes; // dynamic array
 } LSPRequestDidChange;
 
+typedef enum {
+	// LSP doesn't actually define this but this will be used for unrecognized values
+	//  (in case they add more symbol kinds in the future)
+	LSP_SYMBOL_OTHER = 0,
+	
+	#define LSP_SYMBOL_KIND_MIN 1
+	LSP_SYMBOL_FILE = 1,
+	LSP_SYMBOL_MODULE = 2,
+	LSB_SYMBOL_NAMESPACE = 3,
+	LSP_SYMBOL_PACKAGE = 4,
+	LSP_SYMBOL_CLASS = 5,
+	LSP_SYMBOL_METHOD = 6,
+	LSP_SYMBOL_PROPERTY = 7,
+	LSP_SYMBOL_FIELD = 8,
+	LSP_SYMBOL_CONSTRUCTOR = 9,
+	LSP_SYMBOL_ENUM = 10,
+	LSP_SYMBOL_INTERFACE = 11,
+	LSP_SYMBOL_FUNCTION = 12,
+	LSP_SYMBOL_VARIABLE = 13,
+	LSP_SYMBOL_CONSTANT = 14,
+	LSP_SYMBOL_STRING = 15,
+	LSP_SYMBOL_NUMBER = 16,
+	LSP_SYMBOL_BOOLEAN = 17,
+	LSP_SYMBOL_ARRAY = 18,
+	LSP_SYMBOL_OBJECT = 19,
+	LSP_SYMBOL_KEY = 20,
+	LSP_SYMBOL_NULL = 21,
+	LSP_SYMBOL_ENUMMEMBER = 22,
+	LSP_SYMBOL_STRUCT = 23,
+	LSP_SYMBOL_EVENT = 24,
+	LSP_SYMBOL_OPERATOR = 25,
+	LSP_SYMBOL_TYPEPARAMETER = 26,
+	#define LSP_SYMBOL_KIND_MAX 26
+} LSPSymbolKind;
+
 typedef enum {
 	LSP_WINDOW_MESSAGE_ERROR = 1,
 	LSP_WINDOW_MESSAGE_WARNING = 2,
@@ -227,6 +277,70 @@ typedef struct {
 	LSPString query;
 } LSPRequestWorkspaceSymbols;
 
+typedef struct {
+	LSPDocumentID document;
+	/// (`LSP_REQUEST_SEMANTIC_TOKENS_DELTA` only) `resultId` of the last response for this document
+	LSPString previous_result_id;
+	/// (`LSP_REQUEST_SEMANTIC_TOKENS_RANGE` only) range to get tokens for
+	LSPRange range;
+} LSPRequestSemanticTokens;
+
+typedef struct {
+	LSPDocumentID document;
+	/// `resultId` of the last report for this document (may be empty)
+	LSPString previous_result_id;
+} LSPRequestDocumentDiagnostic;
+
+typedef struct {
+	LSPDocumentID document;
+} LSPRequestFoldingRange;
+
+typedef struct {
+	LSPDocumentID document;
+	/// range to get hints for
+	LSPRange range;
+} LSPRequestInlayHint;
+
+typedef struct {
+	LSPDocumentID document;
+} LSPRequestDocumentSymbols;
+
+/// CallHierarchyItem or TypeHierarchyItem in the LSP spec
+typedef struct {
+	LSPString name;
+	/// may be empty
+	LSPString detail;
+	LSPSymbolKind kind;
+	LSPDocumentID document;
+	/// range of the whole definition
+	LSPRange range;
+	/// range of the item's name
+	LSPRange selection_range;
+	/// the item's `data` field, as JSON text (empty if there isn't one).
+	///
+	/// this needs to be sent back to the server unchanged.
+	LSPString data;
+} LSPHierarchyItem;
+
+typedef struct {
+	// for LSP_REQUEST_PREPARE_CALL_HIERARCHY and LSP_REQUEST_PREPARE_TYPE_HIERARCHY
+	LSPDocumentPosition position;
+	// for LSP_REQUEST_INCOMING_CALLS, LSP_REQUEST_OUTGOING_CALLS,
+	// LSP_REQUEST_SUPERTYPES, and LSP_REQUEST_SUBTYPES
+	LSPHierarchyItem item;
+} LSPRequestHierarchy;
+
+/// `PreviousResultId` in the LSP spec
+typedef struct {
+	LSPDocumentID document;
+	LSPString result_id;
+} LSPPreviousResultID;
+
+typedef struct {
+	/// dynamic array of the last `resultId`s we got for each document
+	LSPPreviousResultID *previous_result_ids;
+} LSPRequestWorkspaceDiagnostic;
+
 typedef struct {
 	LSPDocumentPosition position;
 	LSPString new_name;
@@ -290,44 +404,18 @@ typedef struct {
 		LSPRequestPublishDiagnostics publish_diagnostics;
 		// LSP_REQUEST_FORMATTING and LSP_REQUEST_RANGE_FORMATTING
 		LSPRequestFormatting formatting;
+		// LSP_REQUEST_SEMANTIC_TOKENS, LSP_REQUEST_SEMANTIC_TOKENS_DELTA, or LSP_REQUEST_SEMANTIC_TOKENS_RANGE
+		LSPRequestSemanticTokens semantic_tokens;
+		LSPRequestDocumentDiagnostic document_diagnostic;
+		LSPRequestWorkspaceDiagnostic workspace_diagnostic;
+		LSPRequestFoldingRange folding_range;
+		LSPRequestInlayHint inlay_hint;
+		LSPRequestDocumentSymbols document_symbols;
+		/// `LSP_REQUEST_PREPARE_CALL_HIERARCHY`, `LSP_REQUEST_INCOMING_CALLS`, etc.
+		LSPRequestHierarchy hierarchy;
 	} data;
 } LSPRequest;
 
-typedef enum {
-	// LSP doesn't actually define this but this will be used for unrecognized values
-	//  (in case they add more symbol kinds in the future)
-	LSP_SYMBOL_OTHER = 0,
-	
-	#define LSP_SYMBOL_KIND_MIN 1
-	LSP_SYMBOL_FILE = 1,
-	LSP_SYMBOL_MODULE = 2,
-	LSB_SYMBOL_NAMESPACE = 3,
-	LSP_SYMBOL_PACKAGE = 4,
-	LSP_SYMBOL_CLASS = 5,
-	LSP_SYMBOL_METHOD = 6,
-	LSP_SYMBOL_PROPERTY = 7,
-	LSP_SYMBOL_FIELD = 8,
-	LSP_SYMBOL_CONSTRUCTOR = 9,
-	LSP_SYMBOL_ENUM = 10,
-	LSP_SYMBOL_INTERFACE = 11,
-	LSP_SYMBOL_FUNCTION = 12,
-	LSP_SYMBOL_VARIABLE = 13,
-	LSP_SYMBOL_CONSTANT = 14,
-	LSP_SYMBOL_STRING = 15,
-	LSP_SYMBOL_NUMBER = 16,
-	LSP_SYMBOL_BOOLEAN = 17,
-	LSP_SYMBOL_ARRAY = 18,
-	LSP_SYMBOL_OBJECT = 19,
-	LSP_SYMBOL_KEY = 20,
-	LSP_SYMBOL_NULL = 21,
-	LSP_SYMBOL_ENUMMEMBER = 22,
-	LSP_SYMBOL_STRUCT = 23,
-	LSP_SYMBOL_EVENT = 24,
-	LSP_SYMBOL_OPERATOR = 25,
-	LSP_SYMBOL_TYPEPARAMETER = 26,
-	#define LSP_SYMBOL_KIND_MAX 26
-} LSPSymbolKind;
-
 typedef enum {
 	#define LSP_COMPLETION_KIND_MIN 1
 	LSP_COMPLETION_TEXT = 1,
@@ -459,6 +547,8 @@ typedef struct {
 
 typedef struct {
 	// these will be sorted by path (alphabetically), then by line number
+	// (see \ref lsp_references_location_cmp).
+	// if the response is partial, only the locations in this batch are sorted.
 	LSPLocation *locations;
 } LSPResponseReferences;
 
@@ -552,12 +642,152 @@ typedef struct {
 	LSPTextEdit *edits;
 } LSPResponseFormatting;
 
+/// `SemanticTokenTypes` in the LSP spec
+typedef enum {
+	// LSP doesn't actually define this but this will be used for unrecognized values
+	LSP_SEMANTIC_TOKEN_OTHER = 0,
+	#define LSP_SEMANTIC_TOKEN_MIN 1
+	LSP_SEMANTIC_TOKEN_NAMESPACE = 1,
+	LSP_SEMANTIC_TOKEN_TYPE = 2,
+	LSP_SEMANTIC_TOKEN_CLASS = 3,
+	LSP_SEMANTIC_TOKEN_ENUM = 4,
+	LSP_SEMANTIC_TOKEN_INTERFACE = 5,
+	LSP_SEMANTIC_TOKEN_STRUCT = 6,
+	LSP_SEMANTIC_TOKEN_TYPE_PARAMETER = 7,
+	LSP_SEMANTIC_TOKEN_PARAMETER = 8,
+	LSP_SEMANTIC_TOKEN_VARIABLE = 9,
+	LSP_SEMANTIC_TOKEN_PROPERTY = 10,
+	LSP_SEMANTIC_TOKEN_ENUM_MEMBER = 11,
+	LSP_SEMANTIC_TOKEN_EVENT = 12,
+	LSP_SEMANTIC_TOKEN_FUNCTION = 13,
+	LSP_SEMANTIC_TOKEN_METHOD = 14,
+	LSP_SEMANTIC_TOKEN_MACRO = 15,
+	LSP_SEMANTIC_TOKEN_KEYWORD = 16,
+	LSP_SEMANTIC_TOKEN_MODIFIER = 17,
+	LSP_SEMANTIC_TOKEN_COMMENT = 18,
+	LSP_SEMANTIC_TOKEN_STRING = 19,
+	LSP_SEMANTIC_TOKEN_NUMBER = 20,
+	LSP_SEMANTIC_TOKEN_REGEXP = 21,
+	LSP_SEMANTIC_TOKEN_OPERATOR = 22,
+	LSP_SEMANTIC_TOKEN_DECORATOR = 23,
+	#define LSP_SEMANTIC_TOKEN_MAX 23
+} LSPSemanticTokenType;
+
+/// `SemanticTokensEdit` in the LSP spec
+typedef struct {
+	/// index into the previous response's data to start replacing at
+	u32 start;
+	/// number of integers to remove
+	u32 delete_count;
+	/// integers to insert are `LSPResponseSemanticTokens.data[data_start..data_start+data_len]`
+	u32 data_start;
+	u32 data_len;
+} LSPSemanticTokensEdit;
+
+typedef struct {
+	/// pass this as `previous_result_id` to get a delta next time (may be empty)
+	LSPString result_id;
+	/// if this is true, \ref edits should be applied to the data from the last response,
+	/// otherwise \ref data contains all the tokens.
+	bool is_delta;
+	/// dynamic array of integers in the LSP's format:
+	/// five per token (line delta, start character delta, length, type, modifiers),
+	/// with types being indices into the server's legend (see \ref lsp_semantic_token_type).
+	u32 *data;
+	/// dynamic array of edits (if \ref is_delta is true)
+	LSPSemanticTokensEdit *edits;
+} LSPResponseSemanticTokens;
+
+/// diagnostics for a single document from a pull diagnostics request
+typedef struct {
+	LSPDocumentID document;
+	/// pass this as the previous result ID next time (may be empty)
+	LSPString result_id;
+	/// if this is true, the diagnostics haven't changed since the report
+	/// with the previous result ID we sent, and \ref diagnostics_count is zero.
+	bool unchanged;
+	/// this report's diagnostics are `diagnostics[diagnostics_start..diagnostics_start+diagnostics_count]`
+	/// in \ref LSPResponseDiagnostic.
+	u32 diagnostics_start;
+	u32 diagnostics_count;
+} LSPDiagnosticReport;
+
+typedef struct {
+	/// dynamic array. for `LSP_REQUEST_DOCUMENT_DIAGNOSTIC`, this has exactly one report
+	/// (for the requested document), unless the response was `null`.
+	LSPDiagnosticReport *reports;
+	/// dynamic array
+	LSPDiagnostic *diagnostics;
+} LSPResponseDiagnostic;
+
+typedef struct {
+	/// line which stays visible when the range is folded
+	u32 start_line;
+	/// last line of the range
+	u32 end_line;
+} LSPFoldingRange;
+
+typedef struct {
+	/// dynamic array, in the order the server sent them
+	LSPFoldingRange *ranges;
+} LSPResponseFoldingRange;
+
+typedef struct {
+	/// the hint is shown just before this position
+	LSPPosition position;
+	/// text of the hint (if the server split it into parts, they are joined together)
+	LSPString label;
+	/// should there be a space before/after the hint?
+	bool padding_left, padding_right;
+} LSPInlayHint;
+
+typedef struct {
+	/// dynamic array, in the order the server sent them
+	LSPInlayHint *hints;
+} LSPResponseInlayHint;
+
+/// DocumentSymbol in the LSP spec
+///
+/// (servers which send SymbolInformation instead get converted to these.)
+typedef struct {
+	LSPString name;
+	/// e.g. the signature of a function (may be empty)
+	LSPString detail;
+	LSPSymbolKind kind;
+	/// range of the whole definition, e.g. including the body of a function
+	LSPRange range;
+	/// range of the symbol's name
+	LSPRange selection_range;
+	/// index of the symbol containing this one in \ref LSPResponseDocumentSymbols.symbols,
+	/// or `U32_MAX` for top-level symbols
+	u32 parent;
+} LSPDocumentSymbol;
+
+typedef struct {
+	/// dynamic array. parents always come before their children.
+	LSPDocumentSymbol *symbols;
+} LSPResponseDocumentSymbols;
+
+typedef struct {
+	/// dynamic array of items.
+	///
+	/// for incoming calls, these are the callers; for outgoing calls, the callees.
+	/// (the ranges of the calls themselves aren't kept.)
+	LSPHierarchyItem *items;
+} LSPResponseHierarchy;
+
 typedef struct {
 	LSPMessageBase base;
 	/// the request which this is a response to
 	LSPRequest request;
 	/// if not NULL, the data field will just be zeroed
 	LSPString error;
+	/// is this a batch of partial results (sent with `$/progress`)?
+	///
+	/// if so, the request is still pending and more results will follow,
+	/// ending with a normal response (which may have the rest of the results, or none).
+	/// this only happens for `LSP_REQUEST_REFERENCES` and `LSP_REQUEST_WORKSPACE_SYMBOLS`.
+	bool partial;
 	/// one of these is filled based on request.type
 	union {
 		LSPResponseCompletion completion;
@@ -572,6 +802,15 @@ typedef struct {
 		LSPResponseDocumentLink document_link;
 		/// `LSP_REQUEST_FORMATTING` or `LSP_REQUEST_RANGE_FORMATTING`
 		LSPResponseFormatting formatting;
+		/// `LSP_REQUEST_SEMANTIC_TOKENS`, `LSP_REQUEST_SEMANTIC_TOKENS_DELTA`, or `LSP_REQUEST_SEMANTIC_TOKENS_RANGE`
+		LSPResponseSemanticTokens semantic_tokens;
+		/// `LSP_REQUEST_DOCUMENT_DIAGNOSTIC` or `LSP_REQUEST_WORKSPACE_DIAGNOSTIC`
+		LSPResponseDiagnostic diagnostic;
+		LSPResponseFoldingRange folding_range;
+		LSPResponseInlayHint inlay_hint;
+		LSPResponseDocumentSymbols document_symbols;
+		/// `LSP_REQUEST_PREPARE_CALL_HIERARCHY`, `LSP_REQUEST_INCOMING_CALLS`, etc.
+		LSPResponseHierarchy hierarchy;
 	} data;
 } LSPResponse;
 
@@ -614,6 +853,16 @@ typedef struct {
 	bool document_link_support;
 	bool formatting_support;
 	bool range_formatting_support;
+	bool semantic_tokens_support;
+	bool semantic_tokens_delta_support;
+	bool semantic_tokens_range_support;
+	bool document_diagnostic_support;
+	bool workspace_diagnostic_support;
+	bool folding_range_support;
+	bool inlay_hint_support;
+	bool document_symbols_support;
+	bool call_hierarchy_support;
+	bool type_hierarchy_support;
 } LSPCapabilities;
 
 typedef struct LSP LSP;
@@ -673,6 +922,7 @@ const char *lsp_request_string(const LSPRequest *request, LSPString string);
 /// sets `*string` to the LSPString, and returns a pointer which you can write the string to.
 /// the returned pointer will be zeroed up to and including [len].
 char *lsp_message_alloc_string(LSPMessageBase *message, size_t len, LSPString *string);
+LSPString lsp_message_add_string(LSPMessageBase *message, const char *string);
 LSPString lsp_message_add_string32(LSPMessageBase *message, String32 string);
 LSPString lsp_request_add_string(LSPRequest *request, const char *string);
 LSPString lsp_response_add_string(LSPResponse *response, const char *string);
@@ -706,10 +956,19 @@ const uint32_t *lsp_completion_trigger_chars(LSP *lsp);
 const uint32_t *lsp_signature_help_trigger_chars(LSP *lsp);
 /// get dynamic array of signature help retrigger characters.
 const uint32_t *lsp_signature_help_retrigger_chars(LSP *lsp);
+/// get the semantic token type which the server calls `index` in its responses.
+///
+/// returns \ref LSP_SEMANTIC_TOKEN_OTHER for types we don't know about.
+LSPSemanticTokenType lsp_semantic_token_type(LSP *lsp, u32 index);
+/// name of `type` in the LSP spec (e.g. "enumMember")
+const char *lsp_semantic_token_type_to_str(LSPSemanticTokenType type);
 // get the start of location's range as a LSPDocumentPosition
 LSPDocumentPosition lsp_location_start_position(LSPLocation location);
 // get the end of location's range as a LSPDocumentPosition
 LSPDocumentPosition lsp_location_end_position(LSPLocation location);
+/// order used for the locations in a references response:
+/// by path (alphabetically), then by line number.
+int lsp_references_location_cmp(LSP *lsp, const LSPLocation *a, const LSPLocation *b);
 void lsp_free(LSP *lsp);
 // call this to free any global resources used by lsp*.c
 // not strictly necessary, but prevents valgrind errors & stuff.
@@ -796,6 +1055,9 @@ struct LSP {
 	char32_t *signature_help_trigger_chars; // dynamic array
 	// thread-safety: same as `capabilities`
 	char32_t *signature_help_retrigger_chars; // dynamic array
+	// thread-safety: same as `capabilities`
+	// semantic token types in the server's legend (dynamic array)
+	LSPSemanticTokenType *semantic_token_types;
 	LSPMutex workspace_folders_mutex;
 		// dynamic array of root directories of LSP workspace folders
 		LSPDocumentID *workspace_folders;
@@ -805,10 +1067,16 @@ struct LSP {
 
 #include "sdl-inc.h"
 
+/// wake up the client's main thread (it might be waiting for events)
+///
+/// call this when there's a new message or error for the client.
+void lsp_notify_client(void);
+
 #define lsp_set_error(lsp, ...) do {\
 		SDL_LockMutex(lsp->error_mutex);\
 		strbuf_printf(lsp->error, __VA_ARGS__);\
 		SDL_UnlockMutex(lsp->error_mutex);\
+		lsp_notify_client();\
 	} while (0)
 
 // a string
@@ -868,6 +1136,9 @@ typedef struct {
 
 
 void process_message(LSP *lsp, JSON *json);
+/// partialResultToken for a request is this followed by the request ID.
+/// (it's a string so that it can't be confused with the server's own progress tokens)
+#define LSP_PARTIAL_RESULT_TOKEN_PREFIX "ted-partial-"
 /// write request to string builder
 void write_request(LSP *lsp, LSPRequest *request, StrBuilder *builder);
 void write_message(LSP *lsp, LSPMessage *message, StrBuilder *builder);
@@ -912,10 +1183,13 @@ void json_string_get(const JSON *json, JSONString string, char *buf, size_t buf_
 /// returns a malloc'd null-terminated string.
 char *json_string_get_alloc(const JSON *json, JSONString string);
 void json_debug_print(const JSON *json);
+/// write `value` as JSON text to `builder`
+void json_write_value(const JSON *json, JSONValue value, StrBuilder *builder);
 size_t json_escape_to(char *out, size_t out_sz, const char *in);
 char *json_escape(const char *str);
 LSPString lsp_response_add_json_string(LSPResponse *response, const JSON *json, JSONString string);
 LSPString lsp_request_add_json_string(LSPRequest *request, const JSON *json, JSONString string);
+LSPString lsp_message_add_json_string(LSPMessageBase *message, const JSON *json, JSONString string);
 /// free resources used by lsp-write.c
 void lsp_write_quit(void);
 
@@ -58,10 +58,12 @@ FUTURE FEATURES:
 #error "Unrecognized operating system."
 #endif
 
+#include "bench.c"
 #include "gl.c"
 #include "text.c"
 #include "colors.c"
 #include "syntax.c"
+#include "lexer.c"
 #include "buffer.c"
 #include "ted.c"
 #include "ui.c"
@@ -78,7 +80,13 @@ FUTURE FEATURES:
 #include "ide-highlights.c"
 #include "ide-usages.c"
 #include "ide-document-link.c"
+#include "ide-diagnostics.c"
 #include "ide-format.c"
+#include "ide-semantic-tokens.c"
+#include "ide-folding.c"
+#include "ide-inlay-hints.c"
+#include "ide-document-symbols.c"
+#include "ide-hierarchy.c"
 #include "command.c"
 #include "macro.c"
 #include "config.c"
@@ -314,7 +322,7 @@ int main(int argc, char **argv) {
 		}
 	}
 	
-	bool test = false;
+	bool test = false, bench = false;
 	const char **starting_files = NULL;
 	for (int i = 1; i < dash_dash; ++i) {
 		if (streq(argv[i], "--help")) {
@@ -323,10 +331,34 @@ int main(int argc, char **argv) {
 			printf("For more information see https://github.com/pommicket/ted\n");
 			printf("\n");
 			printf("Usage: ted [--help] [--version] [--] [file names]\n");
+			printf("       ted --bench <fixture files>\n");
 			exit(0);
 		} else if (streq(argv[i], "--version")) {
 			printf("%s\n", TED_VERSION_FULL);
 			exit(0);
+		} else if (streq(argv[i], "--bench-text")) {
+			if (i + 1 >= dash_dash) {
+				fprintf(stderr, "Usage: ted --bench-text <font.ttf> [fallback.ttf]\n");
+				exit(EXIT_FAILURE);
+			}
+			text_benchmark(argv[i + 1], i + 2 < dash_dash ? argv[i + 2] : NULL);
+			exit(0);
+		} else if (streq(argv[i], "--bench-keywords")) {
+			if (i + 1 >= dash_dash) {
+				fprintf(stderr, "Usage: ted --bench-keywords <source files...>\n");
+				exit(EXIT_FAILURE);
+			}
+			syntax_keyword_benchmark((const char *const *)&argv[i + 1], (u32)(dash_dash - i - 1));
+			exit(0);
+		} else if (streq(argv[i], "--bench-syntax")) {
+			if (i + 2 >= dash_dash) {
+				fprintf(stderr, "Usage: ted --bench-syntax <language definition.cfg> <source files...>\n");
+				exit(EXIT_FAILURE);
+			}
+			lexer_benchmark(argv[i + 1], (const char *const *)&argv[i + 2], (u32)(dash_dash - i - 2));
+			exit(0);
+		} else if (streq(argv[i], "--bench")) {
+			bench = true;
 		}
 		#if DEBUG
 		else if (streq(argv[i], "--test")) {
@@ -345,6 +377,10 @@ int main(int argc, char **argv) {
 			arr_add(starting_files, argv[i]);
 		}
 	}
+	if (bench && arr_len(starting_files) == 0) {
+		fprintf(stderr, "Usage: ted --bench <fixture files>\n");
+		exit(EXIT_FAILURE);
+	}
 	
 	PROFILE_TIME(basic_init_end)
 	
@@ -453,7 +489,7 @@ int main(int argc, char **argv) {
 	
 	PROFILE_TIME(window_start)
 	SDL_Window *window = SDL_CreateWindow("ted", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED, 1280, 720,
-		(test ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN)|SDL_WINDOW_OPENGL|SDL_WINDOW_RESIZABLE);
+		(test || bench ? SDL_WINDOW_HIDDEN : SDL_WINDOW_SHOWN)|SDL_WINDOW_OPENGL|SDL_WINDOW_RESIZABLE);
 	if (!window)
 		die("%s", SDL_GetError());
 
@@ -530,10 +566,20 @@ int main(int argc, char **argv) {
 	hover_init(ted);
 	rename_symbol_init(ted);
 	document_link_init(ted);
+	semantic_tokens_init(ted);
+	diagnostics_init(ted);
+	folding_init(ted);
+	inlay_hints_init(ted);
+	document_symbols_init(ted);
+	hierarchy_init(ted);
 	PROFILE_TIME(gl_end)
 	
 	
+	ted->file_watcher = file_watcher_new();
+	
 	PROFILE_TIME(configs_start)
+	// languages need to be registered before we read the configs
+	lexer_load_languages(ted);
 	ted_load_configs(ted);
 	PROFILE_TIME(configs_end)
 	
@@ -568,6 +614,8 @@ int main(int argc, char **argv) {
 	}
 	
 	arr_free(starting_files);
+	if (bench)
+		bench_start(ted);
 	
 
 
@@ -586,7 +634,7 @@ int main(int argc, char **argv) {
 
 	Uint32 time_at_last_frame = SDL_GetTicks();
 
-	SDL_GL_SetSwapInterval(1); // vsync
+	SDL_GL_SetSwapInterval(bench ? 0 : 1); // vsync
 	
 	PROFILE_TIME(get_ready_end)
 	
@@ -617,9 +665,38 @@ int main(int argc, char **argv) {
 	double start_time = time_get_seconds();
 	double scroll_wheel_text_size_change = 0.0;
 	
+	ted_update_time(ted);
+	ted_redraw(ted);
 	while (!ted->quit) {
 		ted_update_time(ted);
+		if (!test && !bench && !ted_needs_redraw(ted) && !*ted->message
+			&& fabs(scroll_wheel_text_size_change) < 1) {
+			// nothing is changing -- instead of rendering the same frame again,
+			// sleep until there's an event (or something happens on its own, e.g. the cursor blinks).
+			// we still wake up every so often to check for file changes.
+			ted_check_for_file_changes(ted);
+			const double next_redraw = ted_next_redraw_time(ted);
+			double wait = next_redraw - ted->frame_time;
+			if (!ted_needs_redraw(ted) && !*ted->message && wait > 0) {
+				int wait_ms = (int)clampd(ceil(wait * 1000), 1, 250);
+				if (SDL_WaitEventTimeout(NULL, wait_ms)) {
+					ted_redraw(ted);
+					ted->frames_skipped += 1;
+				} else if (time_get_seconds() >= next_redraw) {
+					// once we're past next_redraw, ted_next_redraw_time will give a later time,
+					// so we need to remember to draw this frame now.
+					// (just this one frame -- ted_redraw would keep us rendering for a while,
+					// and with the cursor blinking we would never go idle.)
+					ted->redraw_once = true;
+					ted->frames_skipped += 1;
+				}
+				continue;
+			}
+		}
+		ted->frames_rendered += 1;
+		ted->redraw_once = false;
 		double frame_start = ted->frame_time;
+		bench_frame_begin(ted);
 
 		SDL_PumpEvents();
 		u32 key_modifier = ted_get_key_modifier(ted);		
@@ -651,6 +728,7 @@ int main(int argc, char **argv) {
 		while (SDL_PollEvent(&event)) {
 			TextBuffer *buffer = ted->active_buffer;
 			
+			ted_redraw(ted);
 			switch (event.type) {
 			case SDL_QUIT:
 				command_execute(ted, CMD_QUIT, 1);
@@ -836,18 +914,8 @@ int main(int argc, char **argv) {
 			}
 		}
 		
-		// check if active buffer should be reloaded
-		{
-			TextBuffer *active_buffer = ted->active_buffer;
-			if (active_buffer && buffer_externally_changed(active_buffer)) {
-				if (buffer_settings(active_buffer)->auto_reload)
-					buffer_reload(active_buffer);
-				else {
-					buffer_display_filename(active_buffer, ted->ask_reload, sizeof ted->ask_reload);
-					menu_open(ted, MENU_ASK_RELOAD);
-				}
-			}
-		}
+		// check if buffers/configs should be reloaded
+		ted_check_for_file_changes(ted);
 
 		double frame_dt;
 		{
@@ -894,6 +962,7 @@ int main(int argc, char **argv) {
 			LSP *lsp = ted->lsps[i];
 			LSPMessage message = {0};
 			while (lsp_next_message(lsp, &message)) {
+				ted_redraw(ted);
 				switch (message.type) {
 				case LSP_REQUEST: {
 					LSPRequest *r = &message.request;
@@ -908,8 +977,11 @@ int main(int argc, char **argv) {
 						ted_log(ted, "%s\n", lsp_request_string(r, m->message));
 						} break;
 					case LSP_REQUEST_PUBLISH_DIAGNOSTICS: {
-						ted_process_publish_diagnostics(ted, lsp, r);
+						diagnostics_process_publish(ted, lsp, r);
 					} break;
+					case LSP_REQUEST_DIAGNOSTIC_REFRESH:
+						diagnostics_process_refresh(ted, lsp);
+						break;
 					default: break;
 					}
 					} break;
@@ -920,6 +992,12 @@ int main(int argc, char **argv) {
 						// this is a bit spammy
 						// sometimes clang is just like "this request was cancelled cuz the cursor moved"
 						//ted_error(ted, "LSP error: %s", lsp_response_string(r, r->error));
+						semantic_tokens_process_lsp_response(ted, r);
+						diagnostics_process_lsp_response(ted, r);
+						folding_process_lsp_response(ted, r);
+						inlay_hints_process_lsp_response(ted, r);
+						document_symbols_process_lsp_response(ted, r);
+						hierarchy_process_lsp_response(ted, r);
 					} else {
 						// it's important that we send error responses here too.
 						// we don't want to be waiting around for a response that's never coming.
@@ -932,6 +1010,12 @@ int main(int argc, char **argv) {
 						usages_process_lsp_response(ted, r);
 						document_link_process_lsp_response(ted, r);
 						rename_symbol_process_lsp_response(ted, r);
+						semantic_tokens_process_lsp_response(ted, r);
+						diagnostics_process_lsp_response(ted, r);
+						folding_process_lsp_response(ted, r);
+						inlay_hints_process_lsp_response(ted, r);
+						document_symbols_process_lsp_response(ted, r);
+						hierarchy_process_lsp_response(ted, r);
 					}
 					} break;
 				}
@@ -943,6 +1027,7 @@ int main(int argc, char **argv) {
 		float window_width = ted->window_width, window_height = ted->window_height;
 
 		// set up GL
+		memset(&gl_frame_stats, 0, sizeof gl_frame_stats);
 		glEnable(GL_BLEND);
 		glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 		glViewport(0, 0, (GLsizei)window_width, (GLsizei)window_height);
@@ -1033,6 +1118,7 @@ int main(int argc, char **argv) {
 			if (arr_len(ted->nodes)) {
 				Node *node = ted->nodes[0];
 				float y1 = padding;
+				diagnostics_frame(ted);
 				node_frame(ted, node, rect4(x1, y1, x2, y));
 				autocomplete_frame(ted);
 				signature_help_frame(ted);
@@ -1040,8 +1126,13 @@ int main(int argc, char **argv) {
 				definitions_frame(ted);
 				highlights_frame(ted);
 				usages_frame(ted);
+				hierarchy_frame(ted);
 				document_link_frame(ted);
 				rename_symbol_frame(ted);
+				semantic_tokens_frame(ted);
+				folding_frame(ted);
+				inlay_hints_frame(ted);
+				document_symbols_frame(ted);
 			} else {
 				autocomplete_close(ted);
 				if (!ted->build_shown) {
@@ -1157,6 +1248,11 @@ int main(int argc, char **argv) {
 		buffer_check_valid(ted->build_buffer);
 	#endif
 	
+		// actually draw everything
+		double flush_start = bench_time_start();
+		gl_frame_flush();
+		bench_time_end(BENCH_GL_SUBMIT, flush_start);
+		
 		if (ted->dragging_tab_node)
 			ted->cursor = ted->cursor_move;
 
@@ -1170,7 +1266,7 @@ int main(int argc, char **argv) {
 		
 		double frame_end_noswap = time_get_seconds();
 		#if !PROFILE_FRAME
-		{
+		if (!bench) {
 			// annoyingly, SDL_GL_SwapWindow seems to be a busy loop on my laptop for some reason...
 			// this is why the framerate-cap settings exists
 			const Settings *settings = ted_default_settings(ted);
@@ -1195,23 +1291,31 @@ int main(int argc, char **argv) {
 		(void)frame_end_noswap;
 		SDL_GL_SetSwapInterval(0);
 		#endif
+		double swap_start = bench_time_start();
 		SDL_GL_SwapWindow(window);
+		bench_time_end(BENCH_SWAP, swap_start);
 		
 		PROFILE_TIME(frame_end)
 
 		assert(glGetError() == 0);
+		
+		ted_free_released_settings(ted);
 
 	#if PROFILE_FRAME
 		{
-			print("Frame: %.1f ms\n", (frame_end - frame_start) * 1000);
+			print("Frame: %.1f ms, %" PRIu32 " draw calls, %.1f KiB uploaded\n", (frame_end - frame_start) * 1000,
+				gl_frame_stats.draw_calls, (double)gl_frame_stats.upload_bytes / 1024);
 		}
 	#endif
+		bench_frame_end(ted, frame_end_noswap - frame_start);
 		if (test) {
 			ted_test(ted);
 			break;
 		}
 	}
 	
+	ted_log(ted, "rendered %" PRIu64 " frames, went idle %" PRIu64 " times\n",
+		ted->frames_rendered, ted->frames_skipped);
 	
 	for (size_t i = 0; i < arr_count(ted->mouse_clicks); ++i)
 		arr_clear(ted->mouse_clicks[i]);
@@ -1229,9 +1333,17 @@ int main(int argc, char **argv) {
 	format_quit(ted);
 	highlights_quit(ted);
 	usages_quit(ted);
-	session_write(ted);
+	if (!bench)
+		session_write(ted); // don't clobber the user's session with the fixtures
+	bench_quit();
 	rename_symbol_quit(ted);
 	document_link_quit(ted);
+	semantic_tokens_quit(ted);
+	diagnostics_quit(ted);
+	folding_quit(ted);
+	inlay_hints_quit(ted);
+	document_symbols_quit(ted);
+	hierarchy_quit(ted);
 	definitions_quit(ted);
 	menu_quit(ted);
 	arr_free(ted->edit_notifys);
@@ -1275,7 +1387,12 @@ int main(int argc, char **argv) {
 	buffer_free(ted->build_buffer);
 	buffer_free(ted->argument_buffer);
 	ted_free_fonts(ted);
+	text_quit();
 	config_free_all(ted);
+	shared_settings_decref(&ted->default_settings);
+	ted_free_released_settings(ted);
+	arr_free(ted->released_settings);
+	file_watcher_free(&ted->file_watcher);
 	macros_free(ted);
 	free(ted);
 #if _WIN32
@@ -445,6 +445,28 @@ void node_frame(Ted *ted, Node *node, Rect r) {
 		buffer_rect.size.y += border_thickness;
 		
 		buffer_rect.size.y -= tab_bar_height;
+		
+		char breadcrumb[256];
+		if (buffer_settings(buffer)->breadcrumbs
+			&& document_symbols_breadcrumb(ted, buffer, breadcrumb, sizeof breadcrumb)) {
+			// show which symbol the cursor is in, between the tabs and the buffer
+			Rect breadcrumb_rect = buffer_rect;
+			breadcrumb_rect.size.y = tab_bar_height;
+			gl_geometry_rect_border(breadcrumb_rect, border_thickness, settings_color(settings, COLOR_BORDER));
+			rect_shrink(&breadcrumb_rect, border_thickness);
+			TextRenderState text_state = text_render_state_default;
+			text_state.min_x = rect_x1(breadcrumb_rect);
+			text_state.max_x = rect_x2(breadcrumb_rect);
+			settings_color_floats(settings, COLOR_COMMENT, text_state.color);
+			text_state.x = breadcrumb_rect.pos.x + settings->padding;
+			text_state.y = breadcrumb_rect.pos.y;
+			text_utf8_with_state(font, &text_state, breadcrumb);
+			gl_geometry_draw();
+			text_render(font);
+			
+			buffer_rect.pos.y += tab_bar_height - border_thickness;
+			buffer_rect.size.y -= tab_bar_height - border_thickness;
+		}
 		buffer_render(buffer, buffer_rect);
 	} else {
 		float padding = settings->padding;
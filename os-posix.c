@@ -2,8 +2,10 @@
 
 #include "os.h"
 #include "util.h"
+#include "ds.h"
 #include <sys/types.h>
 #include <sys/stat.h>
+#include <sys/mman.h>
 #include <sys/wait.h>
 #include <sys/socket.h>
 #include <netinet/ip.h>
@@ -14,6 +16,13 @@
 #include <errno.h>
 #include <fcntl.h>
 #include <time.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#if __linux__
+#include <sys/inotify.h>
+#include <limits.h>
+#endif
 
 static FsType statbuf_path_type(const struct stat *statbuf) {
 	if (S_ISREG(statbuf->st_mode))
@@ -49,6 +58,28 @@ int64_t fs_file_size(const char *path) {
 		return -1;
 }
 
+const u8 *fs_map_file(const char *path, size_t *size) {
+	int fd = open(path, O_RDONLY | O_CLOEXEC);
+	if (fd == -1)
+		return NULL;
+	struct stat statbuf = {0};
+	void *data = MAP_FAILED;
+	if (fstat(fd, &statbuf) == 0 && statbuf.st_size > 0) {
+		data = mmap(NULL, (size_t)statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	}
+	// (the mapping stays valid after the file is closed)
+	close(fd);
+	if (data == MAP_FAILED)
+		return NULL;
+	*size = (size_t)statbuf.st_size;
+	return data;
+}
+
+void fs_unmap_file(const u8 *data, size_t size) {
+	if (data)
+		munmap((void *)data, size);
+}
+
 FsDirectoryEntry **fs_list_directory(const char *dirname) {
 	FsDirectoryEntry **entries = NULL;
 	DIR *dir = opendir(dirname);
@@ -503,3 +534,325 @@ void socket_close(Socket **psocket) {
 	free(s);
 	*psocket = NULL;
 }
+
+#if __linux__
+
+#define FILE_WATCHER_QUEUE_SIZE 256
+// which events we care about
+#define FILE_WATCHER_MASK (IN_MODIFY | IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ATTRIB)
+
+typedef struct {
+	int wd;
+	char name[NAME_MAX + 1];
+} FileWatcherEvent;
+
+typedef struct {
+	char *path;
+	u32 ref_count;
+	// index into `dirs` of the containing directory,
+	// or U32_MAX if we couldn't watch it (e.g. because it doesn't exist)
+	u32 dir;
+} FileWatcherPath;
+
+typedef struct {
+	char *dir;
+	// number of paths in this directory
+	u32 ref_count;
+	// note: two directories can have the same watch descriptor
+	// (if they're really the same directory, e.g. because of a symlink)
+	int wd;
+} FileWatcherDir;
+
+struct FileWatcher {
+	int inotify_fd;
+	// written to to tell the thread to stop
+	int quit_pipe[2];
+	pthread_t thread;
+	// single-producer (watcher thread), single-consumer (main thread) queue.
+	FileWatcherEvent queue[FILE_WATCHER_QUEUE_SIZE];
+	// index of next event to read (only written by main thread)
+	atomic_uint queue_head;
+	// index of next event to write (only written by watcher thread)
+	atomic_uint queue_tail;
+	// set if the queue filled up and events were dropped
+	atomic_bool overflowed;
+	// the following are only accessed by the main thread
+	FileWatcherPath *paths;
+	FileWatcherDir *dirs;
+	// paths which still need to be returned from file_watcher_poll because of an overflow
+	char **overflow_paths;
+};
+
+static void *file_watcher_thread(void *data) {
+	FileWatcher *watcher = data;
+	// inotify events need to be aligned
+	char buf[16384] __attribute__((aligned(__alignof__(struct inotify_event))));
+	while (1) {
+		struct pollfd fds[2] = {
+			{.fd = watcher->inotify_fd, .events = POLLIN},
+			{.fd = watcher->quit_pipe[0], .events = POLLIN},
+		};
+		if (poll(fds, 2, -1) < 0) {
+			if (errno == EINTR) continue;
+			break;
+		}
+		if (fds[1].revents)
+			break;
+		if (!(fds[0].revents & POLLIN))
+			continue;
+		ssize_t n = read(watcher->inotify_fd, buf, sizeof buf);
+		if (n <= 0) {
+			if (n < 0 && (errno == EINTR || errno == EAGAIN)) continue;
+			break;
+		}
+		for (char *p = buf; p < buf + n; ) {
+			const struct inotify_event *event = (const struct inotify_event *)p;
+			p += sizeof *event + event->len;
+			if (event->mask & IN_Q_OVERFLOW) {
+				atomic_store_explicit(&watcher->overflowed, true, memory_order_release);
+				continue;
+			}
+			if (!event->len) {
+				// event on the directory itself
+				continue;
+			}
+			unsigned tail = atomic_load_explicit(&watcher->queue_tail, memory_order_relaxed);
+			unsigned head = atomic_load_explicit(&watcher->queue_head, memory_order_acquire);
+			if (tail - head >= FILE_WATCHER_QUEUE_SIZE) {
+				atomic_store_explicit(&watcher->overflowed, true, memory_order_release);
+				continue;
+			}
+			FileWatcherEvent *out = &watcher->queue[tail % FILE_WATCHER_QUEUE_SIZE];
+			out->wd = event->wd;
+			str_cpy(out->name, sizeof out->name, event->name);
+			atomic_store_explicit(&watcher->queue_tail, tail + 1, memory_order_release);
+		}
+	}
+	return NULL;
+}
+
+FileWatcher *file_watcher_new(void) {
+	FileWatcher *watcher = calloc(1, sizeof *watcher);
+	if (!watcher) return NULL;
+	watcher->inotify_fd = inotify_init1(IN_CLOEXEC);
+	if (watcher->inotify_fd < 0) {
+		free(watcher);
+		return NULL;
+	}
+	if (pipe(watcher->quit_pipe) != 0) {
+		close(watcher->inotify_fd);
+		free(watcher);
+		return NULL;
+	}
+	atomic_init(&watcher->queue_head, 0);
+	atomic_init(&watcher->queue_tail, 0);
+	atomic_init(&watcher->overflowed, false);
+	if (pthread_create(&watcher->thread, NULL, file_watcher_thread, watcher) != 0) {
+		close(watcher->quit_pipe[0]);
+		close(watcher->quit_pipe[1]);
+		close(watcher->inotify_fd);
+		free(watcher);
+		return NULL;
+	}
+	return watcher;
+}
+
+// watch the directory containing path.
+// returns its index in watcher->dirs, or U32_MAX if it couldn't be watched.
+static u32 file_watcher_add_dir(FileWatcher *watcher, const char *path) {
+	char dir[4096];
+	str_cpy(dir, sizeof dir, path);
+	path_dirname(dir);
+	u32 dir_index = U32_MAX;
+	for (u32 i = 0; i < arr_len(watcher->dirs); ++i) {
+		if (streq(watcher->dirs[i].dir, dir)) {
+			dir_index = i;
+			break;
+		}
+	}
+	if (dir_index == U32_MAX) {
+		// note: this fails if the directory doesn't exist, or if
+		//  we've hit the limit on the number of inotify watches.
+		int wd = inotify_add_watch(watcher->inotify_fd, dir, FILE_WATCHER_MASK);
+		if (wd >= 0) {
+			dir_index = arr_len(watcher->dirs);
+			FileWatcherDir *d = arr_addp(watcher->dirs);
+			d->dir = str_dup(dir);
+			d->wd = wd;
+		}
+	}
+	if (dir_index != U32_MAX)
+		++watcher->dirs[dir_index].ref_count;
+	return dir_index;
+}
+
+bool file_watcher_add(FileWatcher *watcher, const char *path) {
+	if (!watcher || !*path) return false;
+	arr_foreach_ptr(watcher->paths, FileWatcherPath, p) {
+		if (streq(p->path, path)) {
+			++p->ref_count;
+			if (p->dir == U32_MAX) {
+				// try again
+				p->dir = file_watcher_add_dir(watcher, path);
+			}
+			return p->dir != U32_MAX;
+		}
+	}
+	const u32 dir_index = file_watcher_add_dir(watcher, path);
+	FileWatcherPath *p = arr_addp(watcher->paths);
+	p->path = str_dup(path);
+	p->ref_count = 1;
+	p->dir = dir_index;
+	return dir_index != U32_MAX;
+}
+
+bool file_watcher_is_watching(FileWatcher *watcher, const char *path) {
+	if (!watcher) return false;
+	arr_foreach_ptr(watcher->paths, const FileWatcherPath, p) {
+		if (streq(p->path, path))
+			return p->dir != U32_MAX;
+	}
+	return false;
+}
+
+static void file_watcher_remove_dir(FileWatcher *watcher, u32 dir_index) {
+	FileWatcherDir *d = &watcher->dirs[dir_index];
+	if (--d->ref_count) return;
+	const int wd = d->wd;
+	free(d->dir);
+	arr_remove(watcher->dirs, dir_index);
+	bool wd_in_use = false;
+	arr_foreach_ptr(watcher->dirs, const FileWatcherDir, other) {
+		if (other->wd == wd)
+			wd_in_use = true;
+	}
+	if (!wd_in_use)
+		inotify_rm_watch(watcher->inotify_fd, wd);
+	arr_foreach_ptr(watcher->paths, FileWatcherPath, p) {
+		if (p->dir != U32_MAX && p->dir > dir_index)
+			--p->dir;
+	}
+}
+
+void file_watcher_remove(FileWatcher *watcher, const char *path) {
+	if (!watcher) return;
+	for (u32 i = 0; i < arr_len(watcher->paths); ++i) {
+		FileWatcherPath *p = &watcher->paths[i];
+		if (!streq(p->path, path)) continue;
+		if (--p->ref_count) return;
+		const u32 dir_index = p->dir;
+		free(p->path);
+		arr_remove(watcher->paths, i);
+		if (dir_index != U32_MAX)
+			file_watcher_remove_dir(watcher, dir_index);
+		return;
+	}
+}
+
+bool file_watcher_poll(FileWatcher *watcher, char *path, size_t path_size) {
+	if (!watcher) return false;
+	if (atomic_load_explicit(&watcher->overflowed, memory_order_acquire)) {
+		// we missed some events, so assume everything changed
+		atomic_store_explicit(&watcher->overflowed, false, memory_order_relaxed);
+		arr_foreach_ptr(watcher->paths, FileWatcherPath, p) {
+			arr_add(watcher->overflow_paths, str_dup(p->path));
+		}
+	}
+	if (arr_len(watcher->overflow_paths)) {
+		char *overflow_path = arr_pop_last(watcher->overflow_paths);
+		str_cpy(path, path_size, overflow_path);
+		free(overflow_path);
+		return true;
+	}
+	while (1) {
+		unsigned head = atomic_load_explicit(&watcher->queue_head, memory_order_relaxed);
+		unsigned tail = atomic_load_explicit(&watcher->queue_tail, memory_order_acquire);
+		if (head == tail)
+			return false;
+		const FileWatcherEvent *event = &watcher->queue[head % FILE_WATCHER_QUEUE_SIZE];
+		bool found = false;
+		// (if the same directory was watched under two names, both of them get checked)
+		arr_foreach_ptr(watcher->dirs, const FileWatcherDir, dir) {
+			if (dir->wd != event->wd)
+				continue;
+			char changed[4096];
+			str_cpy(changed, sizeof changed, dir->dir);
+			if (!is_path_separator(changed[strlen(changed) - 1]))
+				str_cat(changed, sizeof changed, "/");
+			str_cat(changed, sizeof changed, event->name);
+			// check if we actually care about this file
+			arr_foreach_ptr(watcher->paths, FileWatcherPath, p) {
+				if (!streq(p->path, changed))
+					continue;
+				if (found) {
+					// (returned by the next call)
+					arr_add(watcher->overflow_paths, str_dup(changed));
+				} else {
+					str_cpy(path, path_size, changed);
+					found = true;
+				}
+				break;
+			}
+		}
+		atomic_store_explicit(&watcher->queue_head, head + 1, memory_order_release);
+		if (found)
+			return true;
+	}
+}
+
+void file_watcher_free(FileWatcher **pwatcher) {
+	FileWatcher *watcher = *pwatcher;
+	if (!watcher) return;
+	// tell thread to quit
+	if (write(watcher->quit_pipe[1], "", 1) == 1)
+		pthread_join(watcher->thread, NULL);
+	close(watcher->quit_pipe[0]);
+	close(watcher->quit_pipe[1]);
+	close(watcher->inotify_fd);
+	arr_foreach_ptr(watcher->paths, FileWatcherPath, p) {
+		free(p->path);
+	}
+	arr_free(watcher->paths);
+	arr_foreach_ptr(watcher->dirs, FileWatcherDir, d) {
+		free(d->dir);
+	}
+	arr_free(watcher->dirs);
+	arr_foreach_ptr(watcher->overflow_paths, char *, p) {
+		free(*p);
+	}
+	arr_free(watcher->overflow_paths);
+	free(watcher);
+	*pwatcher = NULL;
+}
+
+#else
+
+// no file watching on this platform -- changes are detected by polling instead.
+FileWatcher *file_watcher_new(void) {
+	return NULL;
+}
+
+bool file_watcher_add(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+	return false;
+}
+
+bool file_watcher_is_watching(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+	return false;
+}
+
+void file_watcher_remove(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+}
+
+bool file_watcher_poll(FileWatcher *watcher, char *path, size_t path_size) {
+	(void)watcher; (void)path; (void)path_size;
+	return false;
+}
+
+void file_watcher_free(FileWatcher **watcher) {
+	*watcher = NULL;
+}
+
+#endif
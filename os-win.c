@@ -54,6 +54,37 @@ int64_t fs_file_size(const char *path) {
 	return size;
 }
 
+const u8 *fs_map_file(const char *path, size_t *size) {
+	WCHAR wide_path[4100];
+	if (MultiByteToWideChar(CP_UTF8, 0, path, -1, wide_path, arr_count(wide_path)) == 0)
+		return NULL;
+	HANDLE file = CreateFileW(wide_path, GENERIC_READ,
+		FILE_SHARE_READ|FILE_SHARE_WRITE|FILE_SHARE_DELETE, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (file == INVALID_HANDLE_VALUE)
+		return NULL;
+	const u8 *data = NULL;
+	LARGE_INTEGER large = {0};
+	if (GetFileSizeEx(file, &large) && large.QuadPart > 0 && (u64)large.QuadPart <= SIZE_MAX) {
+		HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (mapping) {
+			data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+			// (the view keeps the mapping alive)
+			CloseHandle(mapping);
+		}
+	}
+	CloseHandle(file);
+	if (data)
+		*size = (size_t)large.QuadPart;
+	return data;
+}
+
+void fs_unmap_file(const u8 *data, size_t size) {
+	(void)size;
+	if (data)
+		UnmapViewOfFile(data);
+}
+
 FsDirectoryEntry **fs_list_directory(const char *dirname) {
 	char file_pattern[4100];
 	FsDirectoryEntry **files = NULL;
@@ -553,3 +584,31 @@ void socket_close(Socket **psocket) {
 	free(s);
 	*psocket = NULL;
 }
+
+// file watching isn't implemented on windows yet -- changes are detected by polling instead.
+FileWatcher *file_watcher_new(void) {
+	return NULL;
+}
+
+bool file_watcher_add(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+	return false;
+}
+
+bool file_watcher_is_watching(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+	return false;
+}
+
+void file_watcher_remove(FileWatcher *watcher, const char *path) {
+	(void)watcher; (void)path;
+}
+
+bool file_watcher_poll(FileWatcher *watcher, char *path, size_t path_size) {
+	(void)watcher; (void)path; (void)path_size;
+	return false;
+}
+
+void file_watcher_free(FileWatcher **watcher) {
+	*watcher = NULL;
+}
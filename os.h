@@ -32,6 +32,13 @@ FsPermission fs_path_permission(const char *path);
 bool fs_file_exists(const char *path);
 /// returns size of file or -1 on error
 int64_t fs_file_size(const char *path);
+/// map the contents of a file into memory (read-only).
+///
+/// returns `NULL` on error (or if the file is empty), otherwise sets `*size` to the size of the file.
+/// the mapping should be released with \ref fs_unmap_file.
+const u8 *fs_map_file(const char *path, size_t *size);
+/// release a mapping created by \ref fs_map_file.
+void fs_unmap_file(const u8 *data, size_t size);
 /// Returns a `NULL`-terminated array of the files/directories in this directory, or `NULL` on error.
 ///
 /// When you're done with the entries, call \ref fs_dir_entries_free (or call free on each entry, then on the whole array).
@@ -194,6 +201,36 @@ long long socket_write(Socket *socket, const char *data, size_t size);
 ///
 /// sets `*psocket` to `NULL`.
 void socket_close(Socket **psocket);
+typedef struct FileWatcher FileWatcher;
 
-#endif // OS_H_
+/// create a file watcher, which listens for changes to files in a background thread.
+///
+/// returns `NULL` if this isn't supported on this platform (then you'll have to check for changes yourself).
+/// all of the `file_watcher_*` functions do nothing if the watcher is `NULL`.
+FileWatcher *file_watcher_new(void);
+/// start watching `path` for changes.
+///
+/// actually, the directory containing `path` is watched, so this works even if
+/// `path` doesn't exist yet or gets replaced by renaming another file over it.
+///
+/// each call to this should be matched by a call to \ref file_watcher_remove.
+///
+/// returns false if `path` couldn't be watched (e.g. because its directory doesn't exist,
+/// or there are too many watches already), in which case you'll have to check for changes yourself.
+/// adding a path which couldn't be watched before tries again.
+bool file_watcher_add(FileWatcher *watcher, const char *path);
+/// is `path` (which was passed to \ref file_watcher_add) actually being watched?
+bool file_watcher_is_watching(FileWatcher *watcher, const char *path);
+/// stop watching `path`.
+void file_watcher_remove(FileWatcher *watcher, const char *path);
+/// get the next path (as passed to \ref file_watcher_add) which has changed.
+///
+/// returns false if nothing has changed since the last call.
+/// this doesn't make any system calls unless something has changed.
+bool file_watcher_poll(FileWatcher *watcher, char *path, size_t path_size);
+/// stop watching files and free resources.
+///
+/// sets `*watcher` to `NULL`.
+void file_watcher_free(FileWatcher **watcher);
 
+#endif // OS_H_
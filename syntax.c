@@ -3,6 +3,13 @@
 #include "ted-internal.h"
 #include "keywords.h"
 
+#if (__SSE2__ || _M_X64 || _M_AMD64) && !__TINYC__
+#define SYNTAX_SCAN_SSE2 1
+#include <emmintrin.h>
+#else
+#define SYNTAX_SCAN_SSE2 0
+#endif
+
 
 // ---- syntax state constants ----
 // syntax state is explained in development.md
@@ -174,20 +181,47 @@ bool syntax_is_opening_bracket(Language lang, char32_t c) {
 }
 
 // lookup the given string in the keywords table
-static const Keyword *syntax_keyword_lookup(const KeywordList *all_keywords, const char32_t *str, size_t len) {
-	if (!len) return NULL;
-
-	const KeywordList *list = &all_keywords[str[0] % 128];
-	const Keyword *keywords = list->keywords;
-	size_t nkeywords = list->len;
-	if (keywords) {
-		for (size_t k = 0; k < nkeywords; ++k) {
-			if (syntax_keyword_matches(str, len, keywords[k].str)) {
-				return &keywords[k];
-			}
-		}
+// this must match keyword_hash in keywords.py
+static u32 syntax_keyword_hash(const KeywordTable *table, const char32_t *str, size_t len) {
+	u32 h = (u32)len * 0x9e3779b1u;
+	for (u32 p = 0; p < table->npositions; ++p) {
+		int pos = table->positions[p];
+		// (positions past the end of the identifier are clamped to it)
+		size_t i = pos >= 0
+			? ((size_t)pos < len ? (size_t)pos : len - 1)
+			: ((size_t)-pos <= len ? len - (size_t)-pos : 0);
+		char32_t c = str[i];
+		// each position gets its own multiplier, so that the multiplications don't depend on each other
+		h += c * table->multipliers[p];
 	}
-	return NULL;
+	h = (h ^ (h >> 16)) * 0x7feb352du;
+	return h ^ (h >> 15);
+}
+
+// maps x to [0, n) -- this is faster than x % n
+static u32 syntax_keyword_range_reduce(u32 x, u32 n) {
+	return (u32)(((u64)x * n) >> 32);
+}
+
+// this must match keyword_slot in keywords.py
+static u32 syntax_keyword_slot(u32 hash, u32 displacement, u32 len) {
+	u32 x = hash ^ displacement;
+	x = (x ^ (x >> 15)) * 0x85ebca6bu;
+	x ^= x >> 13;
+	return syntax_keyword_range_reduce(x, len);
+}
+
+static const Keyword *syntax_keyword_lookup(const KeywordTable *table, const char32_t *str, size_t len) {
+	if (!len) return NULL;
+	u32 hash = syntax_keyword_hash(table, str, len);
+	u32 displacement = table->displacements[syntax_keyword_range_reduce(hash, table->nbuckets)];
+	const Keyword *keyword = &table->keywords[syntax_keyword_slot(hash, displacement, table->len)];
+	if (keyword->len != len)
+		return NULL;
+	for (size_t i = 0; i < len; ++i)
+		if (str[i] != (char32_t)keyword->str[i])
+			return NULL;
+	return keyword;
 }
 
 // fast function to figure out if something can be in a comment keyword (like _TODO_)
@@ -226,12 +260,71 @@ static SyntaxCharType syntax_highlight_comment(const char32_t *line, u32 i, u32
 		return SYNTAX_COMMENT;
 	
 	// look it up
-	const Keyword *kwd = syntax_keyword_lookup(syntax_all_keywords_comment, &line[start], end - start);
+	const Keyword *kwd = syntax_keyword_lookup(&syntax_all_keywords_comment, &line[start], end - start);
 	if (kwd)
 		return kwd->type;
 	return SYNTAX_COMMENT;
 }
 
+// returns the index of the first character in line[i..line_len) which is a, b, or c
+// (or an ASCII uppercase letter, if `uppercase` is set), or line_len if there isn't one.
+// inside comments and strings, most characters can't change the state,
+// so the highlighters use this to skip straight to the ones which can.
+static u32 syntax_scan(const char32_t *line, u32 i, u32 line_len, char32_t a, char32_t b, char32_t c, bool uppercase) {
+#if SYNTAX_SCAN_SSE2
+	// check 4 characters at a time.
+	// (code points are at most 0x10FFFF, so the signed comparisons are fine)
+	const __m128i va = _mm_set1_epi32((int)a), vb = _mm_set1_epi32((int)b), vc = _mm_set1_epi32((int)c);
+	const __m128i before_A = _mm_set1_epi32('A' - 1), after_Z = _mm_set1_epi32('Z' + 1);
+	for (; i + 4 <= line_len; i += 4) {
+		__m128i x = _mm_loadu_si128((const __m128i *)&line[i]);
+		__m128i match = _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi32(x, va), _mm_cmpeq_epi32(x, vb)), _mm_cmpeq_epi32(x, vc));
+		if (uppercase)
+			match = _mm_or_si128(match, _mm_and_si128(_mm_cmpgt_epi32(x, before_A), _mm_cmplt_epi32(x, after_Z)));
+		if (_mm_movemask_epi8(match))
+			break; // the loop below will find exactly where
+	}
+#endif
+	for (; i < line_len; ++i) {
+		char32_t x = line[i];
+		if (x == a || x == b || x == c || (uppercase && x >= 'A' && x <= 'Z'))
+			break;
+	}
+	return i;
+}
+
+// in a /* */ comment, skip to the next character which could end it (/), be part of a TODO (A-Z),
+// or be a line continuation (\).
+static u32 syntax_skip_block_comment(const char32_t *line, u32 i, u32 line_len) {
+	return syntax_scan(line, i, line_len, '/', '\\', '/', true);
+}
+
+// in a // comment, skip to the next character which could be part of a TODO or a line continuation.
+static u32 syntax_skip_line_comment(const char32_t *line, u32 i, u32 line_len) {
+	return syntax_scan(line, i, line_len, '\\', '\\', '\\', true);
+}
+
+// in a string delimited by `quote`, skip to the next character which could end it.
+static u32 syntax_skip_string(const char32_t *line, u32 i, u32 line_len, char32_t quote) {
+	return syntax_scan(line, i, line_len, quote, '\\', quote, false);
+}
+
+// in a raw string (no escapes), skip to the next `end` or ".
+static u32 syntax_skip_raw_string(const char32_t *line, u32 i, u32 line_len, char32_t end) {
+	return syntax_scan(line, i, line_len, end, '"', '"', false);
+}
+
+// highlight line[i..line_len) as a single-line comment
+static void syntax_highlight_line_comment(const char32_t *line, u32 i, u32 line_len, SyntaxCharType *char_types) {
+	while (i < line_len) {
+		u32 end = syntax_scan(line, i, line_len, 'A', 'A', 'A', true);
+		memset(&char_types[i], SYNTAX_COMMENT, end - i);
+		if (end < line_len)
+			char_types[end] = syntax_highlight_comment(line, end, line_len);
+		i = end + 1;
+	}
+}
+
 // does i continue the number literal from i-1
 static bool syntax_number_continues(Language lang, const char32_t *line, u32 line_len, u32 i) {
 	if (line[i] == '.') {
@@ -341,6 +434,27 @@ static void syntax_highlight_c_cpp(SyntaxState *state_ptr, const char32_t *line,
 	
 	int backslashes = 0;
 	for (u32 i = 0; i < line_len; ++i) {
+		// skip over the parts of comments and strings which can't change the state
+		u32 skip_to = i;
+		SyntaxCharType skip_type = SYNTAX_COMMENT;
+		if (in_raw_string) {
+			skip_to = syntax_skip_raw_string(line, i, line_len, ')');
+			skip_type = SYNTAX_STRING;
+		} else if (in_multi_line_comment) {
+			skip_to = syntax_skip_block_comment(line, i, line_len);
+		} else if (in_single_line_comment) {
+			skip_to = syntax_skip_line_comment(line, i, line_len);
+		} else if (in_string) {
+			skip_to = syntax_skip_string(line, i, line_len, '"');
+			skip_type = SYNTAX_STRING;
+		}
+		if (skip_to > i) {
+			if (char_types)
+				memset(&char_types[i], skip_type, skip_to - i);
+			backslashes = 0;
+			i = skip_to;
+			if (i == line_len) break;
+		}
 
 		// are there 1/2 characters left in the line?
 		bool has_1_char =  i + 1 < line_len;
@@ -439,16 +553,16 @@ static void syntax_highlight_c_cpp(SyntaxState *state_ptr, const char32_t *line,
 				Keyword const *keyword = NULL;
 				switch (lang) {
 				case LANG_CPP:
-					keyword = syntax_keyword_lookup(syntax_all_keywords_cpp, &line[i], keyword_len);
+					keyword = syntax_keyword_lookup(&syntax_all_keywords_cpp, &line[i], keyword_len);
 					if (!keyword)
-						keyword = syntax_keyword_lookup(syntax_all_keywords_c, &line[i], keyword_len);
+						keyword = syntax_keyword_lookup(&syntax_all_keywords_c, &line[i], keyword_len);
 					break;
 				case LANG_GLSL:
-					keyword = syntax_keyword_lookup(syntax_all_keywords_glsl, &line[i], keyword_len);
+					keyword = syntax_keyword_lookup(&syntax_all_keywords_glsl, &line[i], keyword_len);
 					break;
 				default:
 					assert(lang == LANG_C);
-					keyword = syntax_keyword_lookup(syntax_all_keywords_c, &line[i], keyword_len);
+					keyword = syntax_keyword_lookup(&syntax_all_keywords_c, &line[i], keyword_len);
 					break;
 				}
 				if (keyword) {
@@ -503,6 +617,20 @@ static void syntax_highlight_rust(SyntaxState *state, const char32_t *line, u32
 	int bracket_depth = 0;
 	
 	for (u32 i = 0; i < line_len; ++i) {
+		// skip over the parts of comments and strings which can't change the state
+		u32 skip_to = i;
+		if (comment_depth)
+			skip_to = syntax_skip_block_comment(line, i, line_len);
+		else if (in_string)
+			skip_to = syntax_skip_string(line, i, line_len, '"');
+		if (skip_to > i) {
+			if (char_types)
+				memset(&char_types[i], comment_depth ? SYNTAX_COMMENT : SYNTAX_STRING, skip_to - i);
+			backslashes = 0;
+			i = skip_to;
+			if (i == line_len) break;
+		}
+		
 		char32_t c = line[i];
 		bool dealt_with = false;
 		bool has_1_char = i + 1 < line_len;
@@ -526,10 +654,8 @@ static void syntax_highlight_rust(SyntaxState *state, const char32_t *line, u32
 				} else if (!comment_depth && has_1_char && line[i+1] == '/') {
 					// //
 					// just handle it all now
-					if (char_types) {
-						for (u32 j = i; j < line_len; ++j)
-							char_types[j] = syntax_highlight_comment(line, j, line_len);
-					}
+					if (char_types)
+						syntax_highlight_line_comment(line, i, line_len, char_types);
 					i = line_len - 1;
 					dealt_with = true;
 					break;
@@ -553,7 +679,7 @@ static void syntax_highlight_rust(SyntaxState *state, const char32_t *line, u32
 					char_types[i] = SYNTAX_STRING;
 					dealt_with = true;
 				}
-				if (has_1_char && line[i+1] == '\'') {
+				if (!in_string && has_1_char && line[i+1] == '\'') {
 					// b before byte char
 					char_types[i] = SYNTAX_CHARACTER;
 					dealt_with = true;
@@ -676,7 +802,7 @@ static void syntax_highlight_rust(SyntaxState *state, const char32_t *line, u32
 			}
 			if (char_types && !in_string && !comment_depth && !in_number) {
 				u32 keyword_len = syntax_keyword_len(LANG_RUST, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_rust, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_rust, &line[i], keyword_len);
 				if (keyword) {
 					SyntaxCharType type = keyword->type;
 					for (size_t j = 0; j < keyword_len; ++j) {
@@ -804,7 +930,7 @@ static void syntax_highlight_python(SyntaxState *state, const char32_t *line, u3
 			
 			if (char_types && !in_string && !in_number) {
 				u32 keyword_len = syntax_keyword_len(LANG_PYTHON, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_python, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_python, &line[i], keyword_len);
 				if (keyword) {
 					SyntaxCharType type = keyword->type;
 					for (size_t j = 0; j < keyword_len; ++j) {
@@ -1225,7 +1351,7 @@ static void syntax_highlight_html_like(SyntaxState *state, const char32_t *line,
 					assert(lang == LANG_HTML);
 					
 					u32 keyword_len = syntax_keyword_len(lang, line, i, line_len);
-					Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_html, &line[i], keyword_len);
+					Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_html, &line[i], keyword_len);
 					if (keyword) {
 						SyntaxCharType type = keyword->type;
 						for (size_t j = 0; j < keyword_len; ++j) {
@@ -1322,7 +1448,7 @@ static void syntax_highlight_cfg(SyntaxState *state, const char32_t *line, u32 l
 			if (is32_word(line[i-1]) || line[i-1] == '-' || !is32_word(line[i]))
 				break; // can't be a keyword on its own.
 			u32 keyword_len = syntax_keyword_len(LANG_CONFIG, line, i, line_len);
-			Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_config, &line[i], keyword_len);
+			Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_config, &line[i], keyword_len);
 			if (keyword) {
 				SyntaxCharType type = keyword->type;
 				for (size_t j = 0; j < keyword_len; ++j) {
@@ -1364,6 +1490,22 @@ static void syntax_highlight_javascript_like(
 	u32 backslashes = 0;
 	
 	for (u32 i = 0; i < line_len; ++i) {
+		// skip over the parts of comments and strings which can't change the state
+		u32 skip_to = i;
+		if (in_multiline_comment) {
+			skip_to = syntax_skip_block_comment(line, i, line_len);
+		} else if (in_string) {
+			char32_t quote = string_is_regex ? '/' : string_is_template ? '`' : string_is_dbl_quoted ? '"' : '\'';
+			skip_to = syntax_skip_string(line, i, line_len, quote);
+		}
+		if (skip_to > i) {
+			if (char_types)
+				memset(&char_types[i], in_multiline_comment ? SYNTAX_COMMENT : SYNTAX_STRING, skip_to - i);
+			backslashes = 0;
+			i = skip_to;
+			if (i == line_len) break;
+		}
+		
 		char32_t c = line[i];
 		bool dealt_with = false;
 		switch (c) {
@@ -1380,11 +1522,8 @@ static void syntax_highlight_javascript_like(
 				if (!dealt_with && i+1 < line_len) {
 					if (line[i+1] == '/') {
 						// single line comment
-						if (char_types) {
-							for (u32 j = i; j < line_len; j++) {
-								char_types[j] = syntax_highlight_comment(line, j, line_len);
-							}
-						}
+						if (char_types)
+							syntax_highlight_line_comment(line, i, line_len, char_types);
 						i = line_len - 1;
 						dealt_with = true;
 					} else if (line[i+1] == '*') {
@@ -1484,17 +1623,17 @@ static void syntax_highlight_javascript_like(
 			
 			if (char_types && !in_string && !in_number && !in_multiline_comment) {
 				u32 keyword_len = syntax_keyword_len(LANG_JAVASCRIPT, line, i, line_len);
-				const KeywordList *keywords = NULL;
+				const KeywordTable *keywords = NULL;
 				switch (language) {
 				case LANG_JAVASCRIPT:
-					keywords = syntax_all_keywords_javascript;
+					keywords = &syntax_all_keywords_javascript;
 					break;
 				case LANG_TYPESCRIPT:
-					keywords = syntax_all_keywords_typescript;
+					keywords = &syntax_all_keywords_typescript;
 					break;
 				default:
 					assert(language == LANG_JSON);
-					keywords = syntax_all_keywords_json;
+					keywords = &syntax_all_keywords_json;
 					break;
 				}
 				
@@ -1542,6 +1681,19 @@ static void syntax_highlight_java(SyntaxState *state_ptr, const char32_t *line,
 	
 	int backslashes = 0;
 	for (u32 i = 0; i < line_len; ++i) {
+		// skip over the parts of comments and strings which can't change the state
+		u32 skip_to = i;
+		if (in_multiline_comment)
+			skip_to = syntax_skip_block_comment(line, i, line_len);
+		else if (in_string)
+			skip_to = syntax_skip_string(line, i, line_len, '"');
+		if (skip_to > i) {
+			if (char_types)
+				memset(&char_types[i], in_multiline_comment ? SYNTAX_COMMENT : SYNTAX_STRING, skip_to - i);
+			backslashes = 0;
+			i = skip_to;
+			if (i == line_len) break;
+		}
 
 		// are there 1/2 characters left in the line?
 		bool has_1_char =  i + 1 < line_len;
@@ -1558,11 +1710,8 @@ static void syntax_highlight_java(SyntaxState *state_ptr, const char32_t *line,
 			if (!in_multiline_comment && !in_string && !in_char && has_1_char) {
 				if (line[i + 1] == '/') {
 					// //
-					if (char_types) {
-						for (u32 j = i; j < line_len; j++) {
-							char_types[j] = syntax_highlight_comment(line, j, line_len);
-						}
-					}
+					if (char_types)
+						syntax_highlight_line_comment(line, i, line_len, char_types);
 					i = line_len - 1;
 					dealt_with = true;
 				} else if (line[i + 1] == '*') {
@@ -1623,7 +1772,7 @@ static void syntax_highlight_java(SyntaxState *state_ptr, const char32_t *line,
 			// keywords don't matter for advancing the state
 			if (char_types && !in_multiline_comment && !in_number && !in_string && !in_char) {
 				u32 keyword_len = syntax_keyword_len(LANG_JAVA, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_java, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_java, &line[i], keyword_len);
 				
 				
 				if (keyword) {
@@ -1673,6 +1822,21 @@ static void syntax_highlight_go(SyntaxState *state_ptr, const char32_t *line, u3
 	
 	int backslashes = 0;
 	for (u32 i = 0; i < line_len; ++i) {
+		// skip over the parts of comments and strings which can't change the state
+		u32 skip_to = i;
+		if (in_multiline_comment)
+			skip_to = syntax_skip_block_comment(line, i, line_len);
+		else if (in_string && string_is_raw)
+			skip_to = syntax_skip_raw_string(line, i, line_len, '`');
+		else if (in_string)
+			skip_to = syntax_skip_string(line, i, line_len, '"');
+		if (skip_to > i) {
+			if (char_types)
+				memset(&char_types[i], in_multiline_comment ? SYNTAX_COMMENT : SYNTAX_STRING, skip_to - i);
+			backslashes = 0;
+			i = skip_to;
+			if (i == line_len) break;
+		}
 
 		// are there 1/2 characters left in the line?
 		bool has_1_char =  i + 1 < line_len;
@@ -1689,10 +1853,8 @@ static void syntax_highlight_go(SyntaxState *state_ptr, const char32_t *line, u3
 			if (!in_multiline_comment && !in_string && !in_char && has_1_char) {
 				if (line[i + 1] == '/') {
 					// //
-					if (char_types) {
-						for (u32 j = 0; j < line_len; ++j)
-							char_types[j] = syntax_highlight_comment(line, j, line_len);
-					}
+					if (char_types)
+						syntax_highlight_line_comment(line, 0, line_len, char_types);
 					i = line_len - 1;
 					dealt_with = true;
 				} else if (line[i + 1] == '*') {
@@ -1767,7 +1929,7 @@ static void syntax_highlight_go(SyntaxState *state_ptr, const char32_t *line, u3
 			// keywords don't matter for advancing the state
 			if (char_types && !in_multiline_comment && !in_number && !in_string && !in_char) {
 				u32 keyword_len = syntax_keyword_len(LANG_GO, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_go, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_go, &line[i], keyword_len);
 				
 				
 				if (keyword) {
@@ -1989,7 +2151,7 @@ static void syntax_highlight_css(SyntaxState *state_ptr, const char32_t *line, u
 			
 			if (char_types) {
 				u32 keyword_len = syntax_keyword_len(LANG_CSS, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_css, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_css, &line[i], keyword_len);
 				
 				// in braces, we only accept SYNTAX_KEYWORD, and outside we accept everything else
 				if (keyword && (keyword->type != SYNTAX_KEYWORD) == in_braces) {
@@ -2135,7 +2297,7 @@ static void syntax_highlight_gdscript(SyntaxState *state, const char32_t *line,
 			
 			if (char_types && !in_string && !in_number) {
 				u32 keyword_len = syntax_keyword_len(LANG_GDSCRIPT, line, i, line_len);
-				Keyword const *keyword = syntax_keyword_lookup(syntax_all_keywords_gdscript, &line[i], keyword_len);
+				Keyword const *keyword = syntax_keyword_lookup(&syntax_all_keywords_gdscript, &line[i], keyword_len);
 				if (keyword) {
 					SyntaxCharType type = keyword->type;
 					for (size_t j = 0; j < keyword_len; ++j) {
@@ -2173,6 +2335,8 @@ static void syntax_highlight_gdscript(SyntaxState *state, const char32_t *line,
 typedef struct {
 	Language lang;
 	SyntaxHighlightFunction func;
+	/// for languages defined in syntax/*.cfg files (`func` is NULL for these)
+	Lexer *lexer;
 } SyntaxHighlighter;
 
 static SyntaxHighlighter *syntax_highlighters = NULL; // dynamic array
@@ -2180,7 +2344,10 @@ static SyntaxHighlighter *syntax_highlighters = NULL; // dynamic array
 void syntax_highlight(SyntaxState *state, Language lang, const char32_t *line, u32 line_len, SyntaxCharType *char_types) {
 	arr_foreach_ptr(syntax_highlighters, SyntaxHighlighter, highlighter) {
 		if (highlighter->lang == lang) {
-			highlighter->func(state, line, line_len, char_types);
+			if (highlighter->lexer)
+				lexer_highlight(highlighter->lexer, state, line, line_len, char_types);
+			else
+				highlighter->func(state, line, line_len, char_types);
 			return;
 		}
 	}
@@ -2343,24 +2510,24 @@ void syntax_init(void) {
 	}
 }
 
-void syntax_register_language(const LanguageInfo *info) {
+static bool syntax_register_language_with_lexer(const LanguageInfo *info, Lexer *lexer) {
 	if (!info->id || info->id > LANG_USER_MAX) {
 		debug_println("Bad language ID: %" PRIu32, info->id);
-		return;
+		return false;
 	}
 	if (!info->name[0]) {
 		debug_println("Language with ID %" PRIu32 " has no name.", info->id);
-		return;
+		return false;
 	}
 	
 	arr_foreach_ptr(language_names, LanguageName, lname) {
 		if (streq(lname->name, info->name)) {
 			debug_println("Language named %s registered twice.", info->name);
-			return;
+			return false;
 		}
 		if (lname->lang == info->id) {
 			debug_println("Language with ID %" PRIu32 " registered twice.", info->id);
-			return;
+			return false;
 		}
 	}
 	{
@@ -2370,13 +2537,42 @@ void syntax_register_language(const LanguageInfo *info) {
 	}
 	
 	
-	if (info->highlighter) {
+	if (info->highlighter || lexer) {
 		SyntaxHighlighter *highlighter = arr_addp(syntax_highlighters);
 		highlighter->lang = info->id;
 		highlighter->func = info->highlighter;
+		highlighter->lexer = lexer;
 	}
 	
 	lsp_register_language(info->id, info->lsp_identifier);
+	return true;
+}
+
+void syntax_register_language(const LanguageInfo *info) {
+	syntax_register_language_with_lexer(info, NULL);
+}
+
+bool syntax_register_lexer(const LanguageInfo *info, Lexer *lexer) {
+	return syntax_register_language_with_lexer(info, lexer);
+}
+
+Language syntax_language_from_definition_extensions(const char *filename) {
+	int score = 0;
+	Language match = LANG_NONE;
+	arr_foreach_ptr(syntax_highlighters, SyntaxHighlighter, highlighter) {
+		if (highlighter->lexer && lexer_matches_filename(highlighter->lexer, filename, &score))
+			match = highlighter->lang;
+	}
+	return match;
+}
+
+u64 syntax_languages_hash(void) {
+	u64 hash = 0;
+	arr_foreach_ptr(language_names, LanguageName, lname) {
+		hash = hash * 31 + lname->lang;
+		hash = hash * 31 + str_hash(lname->name, strlen(lname->name));
+	}
+	return hash;
 }
 
 void syntax_quit(void) {
@@ -2384,5 +2580,176 @@ void syntax_quit(void) {
 		free(lname->name);
 	}
 	arr_clear(language_names);
+	arr_foreach_ptr(syntax_highlighters, SyntaxHighlighter, highlighter) {
+		lexer_free(highlighter->lexer);
+	}
 	arr_clear(syntax_highlighters);
 }
+
+// the way keywords were looked up before keywords.py generated perfect hash tables:
+// keywords are put into buckets by their first character, and then we compare against each one.
+// (only used by syntax_keyword_benchmark, for comparison)
+static const Keyword *syntax_keyword_lookup_bucketed(const Keyword **const buckets[128], const char32_t *str, size_t len) {
+	if (!len) return NULL;
+	arr_foreach_ptr(buckets[str[0] % 128], const Keyword *, pkeyword) {
+		if (syntax_keyword_matches(str, len, (*pkeyword)->str))
+			return *pkeyword;
+	}
+	return NULL;
+}
+
+static int syntax_keyword_ptr_cmp(const void *av, const void *bv) {
+	const Keyword *a = *(const Keyword *const *)av, *b = *(const Keyword *const *)bv;
+	return strcmp(a->str, b->str);
+}
+
+void syntax_keyword_benchmark(const char *const *filenames, u32 nfilenames) {
+	const KeywordTable *table = &syntax_all_keywords_cpp;
+	const int iterations = 20;
+	
+	// read all the identifiers in the files
+	char32_t *text = NULL;
+	u32 *ident_starts = NULL;
+	u8 *ident_lens = NULL;
+	for (u32 f = 0; f < nfilenames; ++f) {
+		FILE *fp = fopen(filenames[f], "rb");
+		if (!fp) {
+			printf("Couldn't open %s.\n", filenames[f]);
+			continue;
+		}
+		fseek(fp, 0, SEEK_END);
+		long size = ftell(fp);
+		fseek(fp, 0, SEEK_SET);
+		char *contents = size > 0 ? calloc(1, (size_t)size) : NULL;
+		if (contents && fread(contents, 1, (size_t)size, fp) != (size_t)size)
+			size = 0;
+		fclose(fp);
+		if (!contents) continue;
+		
+		const char *p = contents, *end = contents + size;
+		u32 ident_start = U32_MAX;
+		while (p < end) {
+			char32_t c = 0;
+			size_t bytes = unicode_utf8_to_utf32(&c, p, (size_t)(end - p));
+			if (bytes == 0 || bytes >= (size_t)-2) {
+				// null byte or invalid UTF-8
+				c = 0;
+				bytes = 1;
+			}
+			p += bytes;
+			u32 i = arr_len(text);
+			if (is32_word(c)) {
+				if (ident_start == U32_MAX) {
+					if (is32_digit(c)) {
+						// number, not an identifier
+						while (p < end && is32_word((char32_t)(u8)*p))
+							++p;
+					} else {
+						ident_start = i;
+					}
+				}
+			} else if (ident_start != U32_MAX) {
+				if (i - ident_start < 256) {
+					arr_add(ident_starts, ident_start);
+					arr_add(ident_lens, (u8)(i - ident_start));
+				}
+				ident_start = U32_MAX;
+			}
+			arr_add(text, c);
+		}
+		free(contents);
+	}
+	u32 nidents = arr_len(ident_starts);
+	if (!nidents) {
+		printf("No identifiers found.\n");
+		arr_free(text);
+		return;
+	}
+	
+	const Keyword **buckets[128] = {0};
+	{
+		// (keywords are in alphabetical order within each bucket, as they were in the old keywords.h)
+		const Keyword **sorted = calloc(table->len, sizeof *sorted);
+		for (u32 k = 0; k < table->len; ++k)
+			sorted[k] = &table->keywords[k];
+		qsort(sorted, table->len, sizeof *sorted, syntax_keyword_ptr_cmp);
+		for (u32 k = 0; k < table->len; ++k) {
+			arr_add(buckets[(u8)sorted[k]->str[0] % 128], sorted[k]);
+		}
+		free(sorted);
+	}
+	
+	u32 mismatches = 0, nkeywords = 0;
+	for (u32 i = 0; i < nidents; ++i) {
+		const char32_t *ident = &text[ident_starts[i]];
+		const Keyword *a = syntax_keyword_lookup(table, ident, ident_lens[i]);
+		const Keyword *b = syntax_keyword_lookup_bucketed(buckets, ident, ident_lens[i]);
+		nkeywords += a != NULL;
+		mismatches += a != b;
+	}
+	printf("%" PRIu32 " identifiers, %" PRIu32 " of which are C++ keywords.\n", nidents, nkeywords);
+	if (mismatches)
+		printf("Perfect hash and bucketed lookup disagree on %" PRIu32 " identifiers!\n", mismatches);
+	
+	for (int method = 0; method < 2; ++method) {
+		u64 found = 0;
+		double start = time_get_seconds();
+		for (int iter = 0; iter < iterations; ++iter) {
+			for (u32 i = 0; i < nidents; ++i) {
+				const char32_t *ident = &text[ident_starts[i]];
+				const Keyword *keyword = method
+					? syntax_keyword_lookup(table, ident, ident_lens[i])
+					: syntax_keyword_lookup_bucketed(buckets, ident, ident_lens[i]);
+				found += keyword != NULL;
+			}
+		}
+		double end = time_get_seconds();
+		printf("%s lookup: %.2fns per identifier (%" PRIu64 " found)\n",
+			method ? "perfect hash" : "bucketed", (end - start) * 1e9 / (iterations * (double)nidents), found);
+	}
+	
+	for (int c = 0; c < 128; ++c)
+		arr_free(buckets[c]);
+	arr_free(text);
+	arr_free(ident_starts);
+	arr_free(ident_lens);
+}
+
+void syntax_test(Ted *ted) {
+	(void)ted;
+	// make sure syntax_keyword_hash matches keyword_hash in keywords.py
+	const KeywordTable *const tables[] = {
+		&syntax_all_keywords_c, &syntax_all_keywords_cpp, &syntax_all_keywords_rust,
+		&syntax_all_keywords_javascript, &syntax_all_keywords_json, &syntax_all_keywords_typescript,
+		&syntax_all_keywords_go, &syntax_all_keywords_java, &syntax_all_keywords_python,
+		&syntax_all_keywords_html, &syntax_all_keywords_config, &syntax_all_keywords_glsl,
+		&syntax_all_keywords_css, &syntax_all_keywords_gdscript, &syntax_all_keywords_comment,
+	};
+	for (size_t t = 0; t < arr_count(tables); ++t) {
+		const KeywordTable *table = tables[t];
+		for (u32 k = 0; k < table->len; ++k) {
+			const Keyword *keyword = &table->keywords[k];
+			char32_t str[256] = {0};
+			for (u32 i = 0; i < keyword->len; ++i)
+				str[i] = (char32_t)keyword->str[i];
+			if (syntax_keyword_lookup(table, str, keyword->len) != keyword) {
+				fprintf(stderr, "keyword %s not found in its hash table (try running keywords.py)\n", keyword->str);
+				exit(1);
+			}
+		}
+	}
+	
+	// syntax_scan should find the same character whether or not it's in a 4-character block
+	char32_t line[19];
+	for (u32 len = 0; len <= arr_count(line); ++len) {
+		for (u32 pos = 0; pos <= len; ++pos) {
+			for (u32 i = 0; i < len; ++i)
+				line[i] = i == pos ? 'Q' : i % 2 ? 0x1F600 : 'a';
+			if (syntax_scan(line, 0, len, '"', '"', '"', true) != pos
+				|| syntax_scan(line, 0, len, '/', 'Q', '/', false) != pos) {
+				fprintf(stderr, "syntax_scan failed (length %" PRIu32 ", position %" PRIu32 ")\n", len, pos);
+				exit(1);
+			}
+		}
+	}
+}
@@ -56,6 +56,12 @@ typedef struct {
 	CommandArgument argument;
 } KeyAction;
 
+/// size and modification time of a file when we read it
+typedef struct {
+	int64_t size;
+	struct timespec modified;
+} FileStamp;
+
 /// Reference-counted texture
 typedef struct {
 	u32 ref_count;
@@ -75,6 +81,20 @@ typedef struct {
 	char extension[16];
 } LanguageExtension;
 
+/// perfect hash table mapping key combos to indices into \ref Settings::key_actions.
+///
+/// built by \ref settings_finalize.
+typedef struct {
+	/// log2 of the number of slots
+	u8 slot_bits;
+	/// number of buckets (length of \ref displacements)
+	u32 nbuckets;
+	/// which hash function to use for each bucket
+	u32 *displacements;
+	/// index into `key_actions` for each slot, or `U32_MAX` for empty slots
+	u32 *slots;
+} KeyActionTable;
+
 /// All of ted's settings
 ///
 /// NOTE: to add more options to ted, add fields here,
@@ -93,6 +113,7 @@ struct Settings {
 	u16 max_menu_width;
 	u16 error_display_time;
 	u16 lsp_port;
+	u16 minimap_width;
 	bool auto_indent;
 	bool auto_add_newline;
 	bool remove_trailing_whitespace;
@@ -113,6 +134,9 @@ struct Settings {
 	bool highlight_enabled;
 	bool highlight_auto;
 	bool document_links;
+	bool semantic_tokens;
+	bool inlay_hints;
+	bool breadcrumbs;
 	bool vsync;
 	bool save_backup;
 	bool crlf;
@@ -122,6 +146,7 @@ struct Settings {
 	bool force_monospace;
 	bool show_diagnostics;
 	bool autodetect_indentation;
+	bool minimap;
 	KeyCombo hover_key;
 	KeyCombo highlight_key;
 	u8 tab_width;
@@ -154,6 +179,8 @@ struct Settings {
 	LanguageExtension *language_extensions;
 	/// dynamic array, sorted by KEY_COMBO(modifier, key)
 	KeyAction *key_actions;
+	/// lookup table for `key_actions`. only present in finalized settings.
+	KeyActionTable key_action_table;
 };
 
 typedef enum {
@@ -175,6 +202,8 @@ typedef struct {
 	Language language;
 	/// path regex this config applies to
 	struct pcre2_real_code_8 *path;
+	/// match data for \ref path (reused for every match)
+	struct pcre2_real_match_data_8 *path_match_data;
 	/// path regex string
 	char *path_regex;
 	/// settings which this config specifies
@@ -183,6 +212,20 @@ typedef struct {
 	bool settings_set[sizeof (Settings)];
 } Config;
 
+/// merged settings from a particular list of configs.
+///
+/// these are shared by all buffers which the same configs apply to.
+typedef struct {
+	u32 ref_count;
+	/// value of `Ted::config_generation` when these settings were computed
+	u32 config_generation;
+	/// dynamic array of indices into `Ted::all_configs` which were merged (in order)
+	u32 *configs;
+	Settings settings;
+} SharedSettings;
+
+typedef SharedSettings *SharedSettingsPtr;
+
 typedef struct EditNotifyInfo {
 	EditNotify fn;
 	void *context;
@@ -217,6 +260,58 @@ typedef struct Usages Usages;
 /// data needed for formatting code
 typedef struct Formatting Formatting;
 
+/// data needed for LSP semantic tokens
+typedef struct SemanticTokens SemanticTokens;
+
+/// diagnostics for every document the LSP servers have told us about
+typedef struct DiagnosticStore DiagnosticStore;
+
+/// data needed for LSP folding ranges
+typedef struct Folding Folding;
+
+/// data needed for LSP inlay hints
+typedef struct InlayHints InlayHints;
+
+/// data needed for LSP document symbols (outline menu and breadcrumbs)
+typedef struct DocumentSymbols DocumentSymbols;
+
+/// data needed for call/type hierarchies
+typedef struct Hierarchy Hierarchy;
+
+/// which way to go through a call/type hierarchy
+typedef enum {
+	/// functions which call the one at the cursor
+	HIERARCHY_INCOMING_CALLS,
+	/// functions which the one at the cursor calls
+	HIERARCHY_OUTGOING_CALLS,
+	HIERARCHY_SUPERTYPES,
+	HIERARCHY_SUBTYPES,
+} HierarchyType;
+
+/// an inlay hint to show in a buffer (see \ref buffer_set_inlay_hints)
+typedef struct {
+	/// the hint is shown before this position
+	LSPPosition pos;
+	/// UTF-8 text, including any padding
+	const char *label;
+} InlayHint;
+
+/// a diagnostic, as kept in the \ref DiagnosticStore until it's shown in a buffer
+typedef struct {
+	LSPRange range;
+	MessageType severity;
+	/// offsets into the document's string data
+	u32 message, code, url;
+} StoredDiagnostic;
+
+/// a token from an LSP server's semantic tokens response
+typedef struct {
+	LSPPosition pos;
+	/// length in UTF-16 code units
+	u32 len;
+	SyntaxCharType type;
+} SemanticToken;
+
 /// max number of signatures to display at a time.
 #define SIGNATURE_HELP_MAX 5
 
@@ -272,6 +367,14 @@ struct Ted {
 	double frame_time;
 	/// current time as a human readable string (used for logs)
 	char frame_time_string[64];
+	/// keep rendering frames until this time (see \ref ted_redraw)
+	double redraw_until;
+	/// render the next frame even if nothing changed (e.g. the cursor blinked)
+	bool redraw_once;
+	/// number of frames rendered, and number of times we went idle
+	/// (waiting for an event or \ref ted_next_redraw_time) instead of rendering.
+	/// logged on exit.
+	u64 frames_rendered, frames_skipped;
 	
 	Macro *macros;
 	Macro *recording_macro;
@@ -288,11 +391,31 @@ struct Ted {
 	/// the old active buffer needs to be restored. that's what this stores.
 	TextBuffer *prev_active_buffer; 
 	Node *active_node;
+	/// watches open files and config files for changes.
+	///
+	/// this is `NULL` if file watching isn't supported on this platform.
+	FileWatcher *file_watcher;
 	Config *all_configs;
+	/// set of paths which have been passed to \ref config_read
+	StrHashTable config_paths;
+	/// incremented whenever `all_configs` might change
+	u32 config_generation;
+	/// dynamic array of paths of all config files we've tried to open (including ones which don't exist)
+	///
+	/// these are all watched for changes by \ref file_watcher.
+	char **config_files;
+	/// what each of \ref config_files was like when we read it
+	FileStamp *config_file_stamps;
+	/// number of errors reported while reading configs
+	u32 config_error_count;
+	/// dynamic array of settings which have been computed for the current configs
+	SharedSettings **settings_cache;
 	/// cwd where \ref default_settings was computed
 	char default_settings_cwd[TED_PATH_MAX];
 	/// settings to use when no buffer is open
-	Settings default_settings;
+	SharedSettings *default_settings;
+	/// settings which have been replaced this frame. see \ref ted_release_settings_later.
+	SharedSettings **released_settings;
 	float window_width, window_height;
 	vec2 mouse_pos;
 	u32 mouse_state;
@@ -353,6 +476,12 @@ struct Ted {
 	Usages *usages;
 	RenameSymbol *rename_symbol;
 	Formatting *formatting;
+	SemanticTokens *semantic_tokens;
+	DiagnosticStore *diagnostic_store;
+	Folding *folding;
+	InlayHints *inlay_hints;
+	DocumentSymbols *document_symbols;
+	Hierarchy *hierarchy;
 	/// process ID
 	int pid;
 	
@@ -437,6 +566,37 @@ struct Ted {
 	EditNotifyInfo *edit_notifys;
 };
 
+// === bench.c ===
+/// parts of the frame which are timed separately by `ted --bench`
+typedef enum {
+	/// all of \ref buffer_render (including the two below)
+	BENCH_BUFFER_RENDER,
+	BENCH_SYNTAX_HIGHLIGHT,
+	/// laying out & recording glyphs for lines of text, not including syntax highlighting
+	BENCH_TEXT_LAYOUT,
+	/// \ref gl_frame_flush at the end of the frame
+	BENCH_GL_SUBMIT,
+	/// SDL_GL_SwapWindow
+	BENCH_SWAP,
+	BENCH_TIMER_COUNT
+} BenchTimer;
+/// start benchmarking, using all the open buffers as fixtures (called by main() for `ted --bench`)
+void bench_start(Ted *ted);
+/// returns the current time if we're benchmarking, and 0 otherwise.
+double bench_time_start(void);
+/// add the time since `start` (from \ref bench_time_start) to `timer`.
+///
+/// returns the time elapsed (0 if we're not benchmarking).
+double bench_time_end(BenchTimer timer, double start);
+/// perform this frame's step of the current benchmark scenario.
+void bench_frame_begin(Ted *ted);
+/// record the timings for this frame. sets `ted->quit` once all scenarios are done.
+///
+/// `frame_time` is the CPU time of the frame, not including the buffer swap.
+void bench_frame_end(Ted *ted, double frame_time);
+/// free benchmark resources
+void bench_quit(void);
+
 // === buffer.c ===
 /// create a new empty buffer with no file name
 TextBuffer *buffer_new(Ted *ted);
@@ -467,6 +627,14 @@ LSPPosition buffer_cursor_pos_as_lsp_position(TextBuffer *buffer);
 LSPRange buffer_selection_as_lsp_range(TextBuffer *buffer);
 /// indicate that config has been reloaded so we need to recompute buffer settings
 void buffer_recompute_settings(TextBuffer *buffer);
+/// called when the file watcher reports a change to the buffer's file
+void buffer_file_changed_on_disk(TextBuffer *buffer);
+/// returns false if the buffer's file definitely hasn't been changed by another program
+/// since the last call to \ref buffer_externally_changed.
+///
+/// this doesn't make any system calls, unless the file watcher couldn't watch the buffer's file,
+/// in which case this returns true and occasionally tries watching it again.
+bool buffer_maybe_externally_changed(TextBuffer *buffer);
 /// Apply LSP TextEdit[] from response
 void buffer_apply_lsp_text_edits(TextBuffer *buffer, const LSPResponse *response, const LSPTextEdit *edits, size_t n_edits);
 /// Get the cursor position as an LSPDocumentPosition.
@@ -485,10 +653,55 @@ bool buffer_handle_click(Ted *ted, TextBuffer *buffer, vec2 click, u8 times);
 void buffer_center_cursor_next_frame(TextBuffer *buffer);
 /// perform a series of checks to make sure the buffer doesn't have any invalid values
 void buffer_check_valid(TextBuffer *buffer);
-void buffer_publish_diagnostics(TextBuffer *buffer, const LSPRequest *request, LSPDiagnostic *diagnostics);
+/// replace the buffer's diagnostics.
+///
+/// `generation` identifies this version of the diagnostics (it's what \ref buffer_diagnostics_generation will return).
+/// string fields of `diagnostics` are offsets into `strings`.
+void buffer_publish_diagnostics(TextBuffer *buffer, u32 generation, const StoredDiagnostic *diagnostics, size_t ndiagnostics, const char *strings);
+/// the `generation` passed to the last \ref buffer_publish_diagnostics, or 0 if
+/// the buffer's diagnostics have been cleared since then.
+u32 buffer_diagnostics_generation(TextBuffer *buffer);
+/// replace the semantic tokens on lines `first_line` through `last_line` (inclusive) with `tokens`.
+///
+/// `tokens` must be sorted by position. tokens outside of the lines are ignored.
+void buffer_set_semantic_tokens(TextBuffer *buffer, u32 first_line, u32 last_line, const SemanticToken *tokens, size_t ntokens);
+/// remove all semantic tokens from the buffer
+void buffer_clear_semantic_tokens(TextBuffer *buffer);
+/// has \ref buffer_set_semantic_tokens been called since the buffer was loaded/last cleared?
+bool buffer_has_semantic_tokens(TextBuffer *buffer);
+/// replace the inlay hints on lines `first_line` through `last_line` (inclusive) with `hints`.
+///
+/// hints outside of the lines are ignored.
+void buffer_set_inlay_hints(TextBuffer *buffer, u32 first_line, u32 last_line, const InlayHint *hints, size_t nhints);
+/// remove all inlay hints from the buffer
+void buffer_clear_inlay_hints(TextBuffer *buffer);
+/// hide lines `start+1` through `end` (inclusive), merging any folds already inside them.
+///
+/// returns false if there's nothing to fold, or `start` is hidden.
+bool buffer_fold(TextBuffer *buffer, u32 start, u32 end);
+/// remove the fold which hides `line` or starts at it.
+///
+/// returns false if there isn't one.
+bool buffer_unfold(TextBuffer *buffer, u32 line);
+/// remove all folds
+void buffer_unfold_all(TextBuffer *buffer);
+/// is `line` followed by a fold?
+bool buffer_line_is_folded(TextBuffer *buffer, u32 line);
+/// work out what to fold after `line` without help from an LSP server:
+/// up to the bracket matching an unclosed one on `line` (ignoring comments and strings),
+/// or otherwise the lines after it which are indented more.
+///
+/// returns false if there's nothing to fold.
+bool buffer_fold_range_at_line(TextBuffer *buffer, u32 line, u32 *end);
+/// test buffer stuff
+void buffer_test(Ted *ted);
 
 // === build.c ===
 void build_frame(Ted *ted, float x1, float y1, float x2, float y2);
+/// lines have been inserted into the build output (e.g. usages which came in later) at the
+/// (sorted) line numbers in `lines`. this finds errors in them without going through the whole
+/// output again, and stays on the current error.
+void build_lines_inserted(Ted *ted, const u32 *lines, u32 nlines);
 
 // === colors.c ====
 void color_init(void);
@@ -505,8 +718,26 @@ void command_execute_ex(Ted *ted, Command c, const CommandArgument *argument, co
 ///
 /// if the config with this path has already been read, this does nothing.
 void config_read(Ted *ted, const char *path, ConfigFormat format);
+/// load configs from the config snapshot in the local data directory, instead of parsing them.
+///
+/// `paths` are the config files which would otherwise be passed to \ref config_read.
+/// returns false if the snapshot doesn't exist or is out of date (in which case nothing is loaded).
+bool config_snapshot_load(Ted *ted, const char *const *paths, size_t npaths);
+/// save the currently loaded configs to the config snapshot.
+///
+/// this does nothing if there were errors reading the configs.
+void config_snapshot_save(Ted *ted, const char *const *paths, size_t npaths);
 void config_free_all(Ted *ted);
+/// has the config file at `path` been changed since we read it?
+///
+/// (we check this rather than trusting the file watcher, because we get notified about
+/// our own writes, and about every file if the watcher's queue overflows.)
+bool config_file_changed(Ted *ted, const char *path);
 void config_merge_into(Settings *dest, const Config *src_cfg);
+/// get action for key combo, or `NULL` if nothing is bound to it.
+///
+/// `settings` must have been finalized (see \ref settings_finalize).
+const KeyAction *settings_key_action(const Settings *settings, KeyCombo key_combo);
 /// call this after all your calls to \ref config_merge_into
 ///
 /// (this sorts key actions, etc.)
@@ -523,6 +754,8 @@ void find_init(Ted *ted);
 /// height of the find/find+replace menu in pixels
 float find_menu_height(Ted *ted);
 void find_menu_frame(Ted *ted, Rect menu_bounds);
+/// line number of the `index`th find result (there are `arr_len(ted->find_results)` of them, in order).
+u32 find_result_line(Ted *ted, u32 index);
 
 // === gl.c ===
 /// set by main()
@@ -532,10 +765,12 @@ extern int gl_version_major, gl_version_minor;
 /// macro trickery to avoid having to write every GL function multiple times
 #define gl_for_each_proc(do)\
 	do(DRAWARRAYS, DrawArrays)\
+	do(DRAWARRAYSINSTANCED, DrawArraysInstanced)\
 	do(GENTEXTURES, GenTextures)\
 	do(DELETETEXTURES, DeleteTextures)\
 	do(GENERATEMIPMAP, GenerateMipmap)\
 	do(TEXIMAGE2D, TexImage2D)\
+	do(TEXSUBIMAGE2D, TexSubImage2D)\
 	do(BINDTEXTURE, BindTexture)\
 	do(TEXPARAMETERI, TexParameteri)\
 	do(GETERROR, GetError)\
@@ -567,9 +802,11 @@ extern int gl_version_major, gl_version_minor;
 	do(DELETEBUFFERS, DeleteBuffers)\
 	do(BINDBUFFER, BindBuffer)\
 	do(BUFFERDATA, BufferData)\
+	do(BUFFERSUBDATA, BufferSubData)\
 	do(VERTEXATTRIBPOINTER, VertexAttribPointer)\
 	do(ENABLEVERTEXATTRIBARRAY, EnableVertexAttribArray)\
 	do(DISABLEVERTEXATTRIBARRAY, DisableVertexAttribArray)\
+	do(VERTEXATTRIBDIVISOR, VertexAttribDivisor)\
 	do(GENVERTEXARRAYS, GenVertexArrays)\
 	do(DELETEVERTEXARRAYS, DeleteVertexArrays)\
 	do(BINDVERTEXARRAY, BindVertexArray)\
@@ -605,6 +842,32 @@ void gl_rc_texture_incref(GlRcTexture *t);
 void gl_rc_texture_decref(GlRcTexture **pt);
 /// initialize geometry stuff
 void gl_geometry_init(void);
+/// a range of queued triangles or glyphs, which can be drawn with one draw call
+typedef struct {
+	/// font which the glyphs come from, or `NULL` for geometry (see \ref gl_geometry_rect)
+	/// and images (see \ref gl_image_rect)
+	Font *font;
+	/// index into the font's textures, the GL texture for images, or 0 for geometry
+	u32 texture;
+	/// index of first triangle/glyph/image quad
+	u32 first;
+	/// number of triangles/glyphs/image quads
+	u32 count;
+} GlBatch;
+/// what was drawn this frame
+typedef struct {
+	u32 draw_calls;
+	/// vertex and texture data sent to the GPU
+	u64 upload_bytes;
+} GlFrameStats;
+extern GlFrameStats gl_frame_stats;
+/// add a batch to be drawn by \ref gl_frame_flush (on top of all the batches before it).
+void gl_add_batch(GlBatch batch);
+/// draw all the batches queued by \ref gl_geometry_draw, \ref gl_image_rect and \ref text_render, in order.
+///
+/// all of the data for them is uploaded at once, and consecutive batches
+/// which use the same program and texture are merged.
+void gl_frame_flush(void);
 
 // === ide-autocomplete.c ===
 void autocomplete_init(Ted *ted);
@@ -622,6 +885,37 @@ void definition_goto(Ted *ted, LSP *lsp, const char *name, LSPDocumentPosition p
 void definitions_process_lsp_response(Ted *ted, LSP *lsp, const LSPResponse *response);
 void definitions_frame(Ted *ted);
 void definitions_quit(Ted *ted);
+/// convert LSP symbol kind to ted symbol kind
+SymbolKind symbol_kind_to_ted(LSPSymbolKind kind);
+
+// === ide-diagnostics.c ===
+void diagnostics_init(Ted *ted);
+void diagnostics_quit(Ted *ted);
+/// send pull diagnostics requests and give diagnostics to the buffers on screen.
+///
+/// this should be called before the buffers are rendered.
+void diagnostics_frame(Ted *ted);
+/// when the next request will be sent (so we know when to wake up)
+double diagnostics_next_update_time(Ted *ted);
+/// handle a `textDocument/publishDiagnostics` notification
+void diagnostics_process_publish(Ted *ted, LSP *lsp, const LSPRequest *request);
+/// pull all of `lsp`'s diagnostics again (for workspace/diagnostic/refresh)
+void diagnostics_process_refresh(Ted *ted, LSP *lsp);
+void diagnostics_process_lsp_response(Ted *ted, const LSPResponse *response);
+
+// === ide-document-symbols.c ===
+void document_symbols_init(Ted *ted);
+void document_symbols_quit(Ted *ted);
+void document_symbols_frame(Ted *ted);
+/// when the next request will be sent (so we know when to wake up)
+double document_symbols_next_update_time(Ted *ted);
+void document_symbols_process_lsp_response(Ted *ted, const LSPResponse *response);
+/// get the names of the symbols containing the cursor, e.g. `"Foo > bar"`.
+///
+/// returns false if we don't have any symbols for `buffer`.
+bool document_symbols_breadcrumb(Ted *ted, TextBuffer *buffer, char *out, size_t out_size);
+/// can we get document symbols for `buffer`? (as far as we know)
+bool document_symbols_available(Ted *ted, TextBuffer *buffer);
 
 // === ide-document-link.c ===
 void document_link_init(Ted *ted);
@@ -630,6 +924,16 @@ void document_link_frame(Ted *ted);
 void document_link_process_lsp_response(Ted *ted, const LSPResponse *response);
 
 
+// === ide-folding.c ===
+void folding_init(Ted *ted);
+void folding_quit(Ted *ted);
+void folding_frame(Ted *ted);
+/// when the next request will be sent (so we know when to wake up)
+double folding_next_update_time(Ted *ted);
+void folding_process_lsp_response(Ted *ted, const LSPResponse *response);
+/// fold the range at the cursor, or unfold it if it's already folded
+void folding_toggle(Ted *ted, TextBuffer *buffer);
+
 // === ide-format.c ===
 /// initialize formatting stuff
 void format_init(Ted *ted);
@@ -639,6 +943,16 @@ void format_cancel_request(Ted *ted);
 /// free formatting stuff
 void format_quit(Ted *ted);
 
+// === ide-hierarchy.c ===
+void hierarchy_init(Ted *ted);
+void hierarchy_quit(Ted *ted);
+void hierarchy_frame(Ted *ted);
+void hierarchy_process_lsp_response(Ted *ted, const LSPResponse *response);
+/// ask the server about the symbol at the cursor, and open the hierarchy menu once it responds
+void hierarchy_open(Ted *ted, HierarchyType type);
+/// expand/collapse the selected node in the hierarchy menu
+void hierarchy_toggle_expanded(Ted *ted);
+
 // === ide-highlights.c ===
 void highlights_init(Ted *ted);
 void highlights_quit(Ted *ted);
@@ -651,12 +965,28 @@ void hover_frame(Ted *ted, double dt);
 void hover_process_lsp_response(Ted *ted, const LSPResponse *response);
 void hover_quit(Ted *ted);
 
+// === ide-inlay-hints.c ===
+void inlay_hints_init(Ted *ted);
+void inlay_hints_quit(Ted *ted);
+void inlay_hints_frame(Ted *ted);
+/// when the next request will be sent (so we know when to wake up)
+double inlay_hints_next_update_time(Ted *ted);
+void inlay_hints_process_lsp_response(Ted *ted, const LSPResponse *response);
+
 // === ide-rename-symbol.c ===
 void rename_symbol_init(Ted *ted);
 void rename_symbol_quit(Ted *ted);
 void rename_symbol_frame(Ted *ted);
 void rename_symbol_process_lsp_response(Ted *ted, const LSPResponse *response);
 
+// === ide-semantic-tokens.c ===
+void semantic_tokens_init(Ted *ted);
+void semantic_tokens_quit(Ted *ted);
+void semantic_tokens_frame(Ted *ted);
+/// when the next request will be sent (so we know when to wake up)
+double semantic_tokens_next_update_time(Ted *ted);
+void semantic_tokens_process_lsp_response(Ted *ted, const LSPResponse *response);
+
 // === ide-signature-help.c ===
 void signature_help_init(Ted *ted);
 void signature_help_quit(Ted *ted);
@@ -669,6 +999,23 @@ void usages_process_lsp_response(Ted *ted, const LSPResponse *response);
 void usages_frame(Ted *ted);
 void usages_quit(Ted *ted);
 
+// === lexer.c ===
+/// language whose syntax highlighting is defined in a syntax/*.cfg file
+typedef struct Lexer Lexer;
+/// highlight a line using `lexer` (see \ref SyntaxHighlightFunction)
+void lexer_highlight(const Lexer *lexer, SyntaxState *state, const char32_t *line, u32 line_len, SyntaxCharType *char_types);
+/// does `filename` have one of the extensions in the language definition?
+///
+/// only extensions longer than `*score` are considered, and `*score` is set to the length of the matching extension.
+bool lexer_matches_filename(const Lexer *lexer, const char *filename, int *score);
+void lexer_free(Lexer *lexer);
+/// load language definitions from the syntax directories (this is called before reading configs)
+void lexer_load_languages(Ted *ted);
+/// compare the table-driven highlighter for the language defined in `definition_path`
+/// with the built-in highlighter for the language with the same name (for `ted --bench-syntax`)
+void lexer_benchmark(const char *definition_path, const char *const *filenames, u32 nfilenames);
+void lexer_test(Ted *ted);
+
 // === macro.c ===
 void macro_add(Ted *ted, Command command, const CommandArgument *argument);
 void macros_init(Ted *ted);
@@ -703,16 +1050,47 @@ void node_frame(Ted *ted, Node *node, Rect r);
 void syntax_init(void);
 /// free up resources used by `syntax.c`
 void syntax_quit(void);
+/// compare keyword lookup with the perfect hash tables from keywords.py against the old bucketed lookup,
+/// using the identifiers in the given files (for `ted --bench-keywords`)
+void syntax_keyword_benchmark(const char *const *filenames, u32 nfilenames);
+/// test syntax stuff
+void syntax_test(Ted *ted);
+/// register a language defined in a syntax/*.cfg file. returns false if there's already a language with the same name or ID.
+///
+/// on success, `lexer` will be freed by \ref syntax_quit.
+bool syntax_register_lexer(const LanguageInfo *info, Lexer *lexer);
+/// language for `filename` according to the `extensions` in language definitions, or `LANG_NONE`.
+Language syntax_language_from_definition_extensions(const char *filename);
+/// hash of the names and IDs of all registered languages
+u64 syntax_languages_hash(void);
 
 // === tags.c ===
 /// get all tags in the tags file as SymbolInfos.
 SymbolInfo *tags_get_symbols(Ted *ted);
 
+// === text.c ===
+/// upload glyph data and font textures for the text batches in `batches` (called by \ref gl_frame_flush)
+void text_upload_batches(const GlBatch *batches, u32 nbatches);
+/// draw a text batch (called by \ref gl_frame_flush).
+///
+/// `setup` should be `true` if the last thing drawn wasn't a text batch.
+void text_draw_batch(const GlBatch *batch, bool setup);
+/// get rid of glyphs which have been drawn by \ref text_draw_batch.
+void text_end_batches(void);
+
 // === ted.c ===
 /// perform all ted tests
 void ted_test(Ted *ted);
 /// update `ted->frame_time`
 void ted_update_time(Ted *ted);
+/// something changed -- keep rendering frames for a little while
+///
+/// (things like hover/autocomplete can take a moment to settle after an event)
+void ted_redraw(Ted *ted);
+/// does the next frame need to be rendered? if not, main will wait for events instead.
+bool ted_needs_redraw(Ted *ted);
+/// time at which something will change on its own (e.g. the cursor blinking), or `INFINITY`.
+double ted_next_redraw_time(Ted *ted);
 /// set ted's active buffer to something nice
 void ted_reset_active_buffer(Ted *ted);
 /// set ted's error message to the buffer's error.
@@ -727,18 +1105,36 @@ void ted_go_to_lsp_document_position(Ted *ted, LSP *lsp, LSPDocumentPosition pos
 void ted_cancel_lsp_request(Ted *ted, LSPServerRequestID *request);
 /// convert LSPWindowMessageType to MessageType
 MessageType ted_message_type_from_lsp(LSPWindowMessageType type);
+/// is `buffer` one of ted's open files (as opposed to e.g. the build buffer, or a buffer which has been closed)?
+bool ted_is_regular_buffer(Ted *ted, TextBuffer *buffer);
 /// delete buffer - does NOT remove it from the node tree
 void ted_delete_buffer(Ted *ted, TextBuffer *buffer);
 /// Returns a new buffer, or NULL on out of memory
 TextBuffer *ted_new_buffer(Ted *ted);
-/// Compute the settings for a file at the given path in the given language.
+/// Get the settings for a file at the given path in the given language.
 ///
-/// NOTE: this frees the previous settings stored in `*settings`. so make sure it's either zeroed or points to valid settings.
-void ted_compute_settings(Ted *ted, const char *path, Language language, Settings *settings);
+/// Settings are cached, so this is cheap if another file with the same
+/// applicable configs has already been seen.
+/// The reference count of the returned settings is incremented,
+/// so call \ref shared_settings_decref when you're done with them.
+SharedSettings *ted_get_settings(Ted *ted, const char *path, Language language);
+/// decrease reference count of `*settings`, freeing them if it hits 0, and set `*settings` to NULL.
+///
+/// does nothing if `*settings` is NULL.
+void shared_settings_decref(SharedSettings **settings);
+/// like \ref shared_settings_decref, but waits until the end of the frame,
+/// so that any pointers to the settings obtained this frame remain valid.
+void ted_release_settings_later(Ted *ted, SharedSettings **settings);
+/// release settings passed to \ref ted_release_settings_later. called at the end of each frame.
+void ted_free_released_settings(Ted *ted);
 /// check for orphaned nodes and node cycles
 void ted_check_for_node_problems(Ted *ted);
 /// load ted configuration
 void ted_load_configs(Ted *ted);
+/// reload buffers and configs which have been changed by other programs
+///
+/// this is called every frame.
+void ted_check_for_file_changes(Ted *ted);
 /// get colors to use for message box
 void ted_color_settings_for_message_type(MessageType type, ColorSetting *bg_color, ColorSetting *border_color);
 /// Load all the fonts ted will use, freeing any previous ones.
@@ -746,6 +1142,9 @@ void ted_load_fonts(Ted *ted);
 /// Free all of ted's fonts.
 void ted_free_fonts(Ted *ted);
 /// process textDocument/publishDiagnostics request
-void ted_process_publish_diagnostics(Ted *ted, LSP *lsp, LSPRequest *request);
+
+// === ui.c ===
+/// test selector filtering
+void selector_test(Ted *ted);
 
 #endif // TED_INTERNAL_H_
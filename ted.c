@@ -66,6 +66,56 @@ void ted_update_time(Ted *ted) {
 	ted->frame_time = time_get_seconds();
 }
 
+void ted_redraw(Ted *ted) {
+	const Settings *settings = ted_active_settings(ted);
+	double settle_time = 1.0;
+	if (settings->hover_enabled && settings->hover_time < 10)
+		settle_time += settings->hover_time;
+	ted->redraw_until = maxd(ted->redraw_until, time_get_seconds() + settle_time);
+}
+
+bool ted_needs_redraw(Ted *ted) {
+	if (ted->redraw_once || ted->frame_time < ted->redraw_until)
+		return true;
+	if (ted->building || menu_is_any_open(ted))
+		return true;
+	if (ted_active_settings(ted)->bg_shader) // might be animated
+		return true;
+	if (ted->mouse_state || ted_get_key_modifier(ted) == KEY_MODIFIER_ALT) // dragging/alt+arrow scrolling
+		return true;
+	return false;
+}
+
+double ted_next_redraw_time(Ted *ted) {
+	double t = INFINITY;
+	TextBuffer *buffer = ted->active_buffer;
+	if (buffer) {
+		// cursor blink
+		const Settings *settings = buffer_settings(buffer);
+		double time_on = settings->cursor_blink_time_on;
+		double time_off = settings->cursor_blink_time_off;
+		if (time_off > 0) {
+			double period = time_on + time_off;
+			double period_start = ted->frame_time - fmod(ted->frame_time, period);
+			double toggle = period_start + time_on;
+			if (toggle <= ted->frame_time)
+				toggle = period_start + period;
+			t = mind(t, toggle);
+		}
+	}
+	if (*ted->message_shown) {
+		// message box closing
+		t = mind(t, ted->message_time + ted_active_settings(ted)->error_display_time);
+	}
+	// debounced LSP requests
+	t = mind(t, semantic_tokens_next_update_time(ted));
+	t = mind(t, diagnostics_next_update_time(ted));
+	t = mind(t, folding_next_update_time(ted));
+	t = mind(t, inlay_hints_next_update_time(ted));
+	t = mind(t, document_symbols_next_update_time(ted));
+	return t;
+}
+
 TextBuffer *ted_active_buffer(Ted *ted) {
 	return ted->active_buffer;
 }
@@ -235,12 +285,22 @@ static int applicable_configs_cmp(void *context, const void *av, const void *bv)
 	return 0;
 }
 
-void ted_compute_settings(Ted *ted, const char *path, Language language, Settings *settings) {
-	settings_free(settings);
-	
+void shared_settings_decref(SharedSettings **psettings) {
+	SharedSettings *settings = *psettings;
+	if (!settings) return;
+	*psettings = NULL;
+	if (--settings->ref_count == 0) {
+		settings_free(&settings->settings);
+		arr_free(settings->configs);
+		free(settings);
+	}
+}
+
+SharedSettings *ted_get_settings(Ted *ted, const char *path, Language language) {
 	u32 root_editorconfig = 0;
 	if (path && *path) {
 		// check for .editorconfig and local .ted.cfg
+		// (config_read won't re-read configs we've already seen)
 		char editorconfig[2048], ted_cfg[2048];
 		for (size_t i = 0; (i == 0 || path[i - 1]) && i < sizeof editorconfig - 16; i++) {
 			editorconfig[i] = path[i];
@@ -285,20 +345,63 @@ void ted_compute_settings(Ted *ted, const char *path, Language language, Setting
 	}
 	qsort_with_context(applicable_configs, arr_len(applicable_configs),
 		sizeof applicable_configs[0], applicable_configs_cmp, ted->all_configs);
+	
+	// check if we've already merged these configs
+	for (u32 i = 0; i < arr_len(ted->settings_cache); ) {
+		SharedSettings *cached = ted->settings_cache[i];
+		if (cached->config_generation != ted->config_generation) {
+			// configs have changed since this was computed
+			shared_settings_decref(&ted->settings_cache[i]);
+			arr_remove(ted->settings_cache, i);
+			continue;
+		}
+		if (arr_len(cached->configs) == arr_len(applicable_configs)
+			&& memcmp(cached->configs, applicable_configs, arr_size_in_bytes(applicable_configs)) == 0) {
+			arr_free(applicable_configs);
+			++cached->ref_count;
+			return cached;
+		}
+		++i;
+	}
+	
+	SharedSettings *shared = calloc(1, sizeof *shared);
+	if (!shared) {
+		// this is pretty bad but we can't really do anything about it
+		die("Out of memory.");
+	}
 	arr_foreach_ptr(applicable_configs, const u32, i) {
-		config_merge_into(settings, &ted->all_configs[*i]);
+		config_merge_into(&shared->settings, &ted->all_configs[*i]);
 	}
-	arr_free(applicable_configs);
-	settings_finalize(ted, settings);
+	settings_finalize(ted, &shared->settings);
+	shared->configs = applicable_configs;
+	shared->config_generation = ted->config_generation;
+	// one reference for the cache, one for the caller
+	shared->ref_count = 2;
+	arr_add(ted->settings_cache, shared);
+	return shared;
+}
+
+void ted_release_settings_later(Ted *ted, SharedSettings **settings) {
+	if (!*settings) return;
+	arr_add(ted->released_settings, *settings);
+	*settings = NULL;
+}
+
+void ted_free_released_settings(Ted *ted) {
+	arr_foreach_ptr(ted->released_settings, SharedSettingsPtr, s) {
+		shared_settings_decref(s);
+	}
+	arr_clear(ted->released_settings);
 }
 
 Settings *ted_default_settings(Ted *ted) {
-	if (!streq(ted->default_settings_cwd, ted->cwd)) {
+	if (!ted->default_settings || !streq(ted->default_settings_cwd, ted->cwd)) {
 		// recompute default settings
-		ted_compute_settings(ted, ted->cwd, LANG_NONE, &ted->default_settings);
+		ted_release_settings_later(ted, &ted->default_settings);
+		ted->default_settings = ted_get_settings(ted, ted->cwd, LANG_NONE);
 		strbuf_cpy(ted->default_settings_cwd, ted->cwd);
 	}
-	return &ted->default_settings;
+	return &ted->default_settings->settings;
 }
 
 Settings *ted_active_settings(Ted *ted) {
@@ -392,7 +495,7 @@ void ted_path_full(Ted *ted, const char *relpath, char *abspath, size_t abspath_
 	path_full(ted->cwd, relpath, abspath, abspath_size);
 }
 
-static bool ted_is_regular_buffer(Ted *ted, TextBuffer *buffer) {
+bool ted_is_regular_buffer(Ted *ted, TextBuffer *buffer) {
 	return arr_index_of(ted->buffers, buffer) >= 0;
 }
 
@@ -486,8 +589,19 @@ float ted_get_ui_scaling(Ted *ted) {
 #endif
 }
 
+static void loaded_fonts_free(LoadedFont **fonts) {
+	arr_foreach_ptr(*fonts, LoadedFont, f) {
+		free(f->path);
+		text_font_free(f->font);
+	}
+	arr_clear(*fonts);
+}
+
 void ted_load_fonts(Ted *ted) {
-	ted_free_fonts(ted);
+	// the old fonts are freed after the new ones are loaded,
+	// so that font files used by both don't have to be opened again.
+	LoadedFont *old_fonts = ted->all_fonts;
+	ted->all_fonts = NULL;
 	const Settings *settings = ted_active_settings(ted);
 	ted->font = ted_load_multifont(ted, rc_str(settings->font, ""));
 	if (!ted->font) {
@@ -499,6 +613,7 @@ void ted_load_fonts(Ted *ted) {
 	if (!ted->font_bold) {
 		ted->font_bold = ted->font;
 	}
+	loaded_fonts_free(&old_fonts);
 }
 
 void ted_change_text_size(Ted *ted, float new_size) {
@@ -508,11 +623,7 @@ void ted_change_text_size(Ted *ted, float new_size) {
 }
 
 void ted_free_fonts(Ted *ted) {
-	arr_foreach_ptr(ted->all_fonts, LoadedFont, f) {
-		free(f->path);
-		text_font_free(f->font);
-	}
-	arr_clear(ted->all_fonts);
+	loaded_fonts_free(&ted->all_fonts);
 	ted->font = NULL;
 	ted->font_bold = NULL;
 }
@@ -779,14 +890,20 @@ void ted_load_configs(Ted *ted) {
 	}
 	
 	
-	config_read(ted, global_config_filename, CONFIG_TED_CFG);
-	config_read(ted, local_config_filename, CONFIG_TED_CFG);
+	const char *config_filenames[3] = {global_config_filename, local_config_filename};
+	size_t nconfig_filenames = 2;
+	char start_cwd_filename[TED_PATH_MAX];
 	if (ted->search_start_cwd) {
 		// read config in start_cwd
-		char start_cwd_filename[TED_PATH_MAX];
 		strbuf_printf(start_cwd_filename, "%s%c" TED_CFG, ted->start_cwd, PATH_SEPARATOR);
-		config_read(ted, start_cwd_filename, CONFIG_TED_CFG);
+		config_filenames[nconfig_filenames++] = start_cwd_filename;
 	}
+	
+	if (config_snapshot_load(ted, config_filenames, nconfig_filenames))
+		return;
+	for (size_t i = 0; i < nconfig_filenames; ++i)
+		config_read(ted, config_filenames[i], CONFIG_TED_CFG);
+	config_snapshot_save(ted, config_filenames, nconfig_filenames);
 }
 
 void ted_reload_configs(Ted *ted) {
@@ -798,6 +915,49 @@ void ted_reload_configs(Ted *ted) {
 	}
 }
 
+void ted_check_for_file_changes(Ted *ted) {
+	char path[TED_PATH_MAX];
+	bool configs_changed = false;
+	while (file_watcher_poll(ted->file_watcher, path, sizeof path)) {
+		ted_redraw(ted);
+		arr_foreach_ptr(ted->buffers, TextBufferPtr, pbuffer) {
+			const char *buffer_path = buffer_get_path(*pbuffer);
+			if (buffer_path && streq(buffer_path, path))
+				buffer_file_changed_on_disk(*pbuffer);
+		}
+		if (config_file_changed(ted, path))
+			configs_changed = true;
+	}
+	if (configs_changed && ted_default_settings(ted)->auto_reload_config)
+		ted_reload_configs(ted);
+	
+	if (ted->file_watcher) {
+		// we know exactly which files changed, so we can reload buffers in the background
+		// (without a file watcher, we only check the active buffer, to avoid calling stat on every file every frame.
+		//  buffers whose files couldn't be watched do get checked here every time, but there shouldn't be many of those.)
+		arr_foreach_ptr(ted->buffers, TextBufferPtr, pbuffer) {
+			TextBuffer *buffer = *pbuffer;
+			if (buffer == ted->active_buffer
+				|| !buffer_maybe_externally_changed(buffer)
+				|| !buffer_settings(buffer)->auto_reload)
+				continue;
+			if (buffer_externally_changed(buffer))
+				buffer_reload(buffer);
+		}
+	}
+	
+	TextBuffer *active_buffer = ted->active_buffer;
+	if (active_buffer && buffer_maybe_externally_changed(active_buffer)
+		&& buffer_externally_changed(active_buffer)) {
+		if (buffer_settings(active_buffer)->auto_reload)
+			buffer_reload(active_buffer);
+		else {
+			buffer_display_filename(active_buffer, ted->ask_reload, sizeof ted->ask_reload);
+			menu_open(ted, MENU_ASK_RELOAD);
+		}
+	}
+}
+
 void ted_press_key(Ted *ted, SDL_Keycode keycode, SDL_Keymod modifier) {
 	KeyCombo key_combo = KEY_COMBO(
 		(u32)((modifier & (KMOD_LCTRL|KMOD_RCTRL)) != 0) << KEY_MODIFIER_CTRL_BIT |
@@ -805,22 +965,11 @@ void ted_press_key(Ted *ted, SDL_Keycode keycode, SDL_Keymod modifier) {
 		(u32)((modifier & (KMOD_LALT|KMOD_RALT)) != 0) << KEY_MODIFIER_ALT_BIT,
 		keycode);
 	
-	const KeyAction *const key_actions = ted_active_settings(ted)->key_actions;
-	u32 lo = 0;
-	u32 hi = arr_len(key_actions);
-	while (lo < hi) {
-		u32 mid = (lo + hi) / 2;
-		if (key_actions[mid].key_combo.value < key_combo.value) {
-			lo = mid + 1;
-		} else if (key_actions[mid].key_combo.value > key_combo.value) {
-			hi = mid;
-		} else {
-			const CommandContext context = {0};
-			command_execute_ex(ted, key_actions[mid].command, &key_actions[mid].argument, &context);
-			return;
-		}
+	const KeyAction *action = settings_key_action(ted_active_settings(ted), key_combo);
+	if (action) {
+		const CommandContext context = {0};
+		command_execute_ex(ted, action->command, &action->argument, &context);
 	}
-	// nothing bound to this key
 }
 
 bool ted_get_mouse_buffer_pos(Ted *ted, TextBuffer **pbuffer, BufferPos *ppos) {
@@ -956,16 +1105,6 @@ bool ted_close_buffer_with_file(Ted *ted, const char *path) {
 	return true;
 }
 
-void ted_process_publish_diagnostics(Ted *ted, LSP *lsp, LSPRequest *request) {
-	assert(request->type == LSP_REQUEST_PUBLISH_DIAGNOSTICS);
-	LSPRequestPublishDiagnostics *pub = &request->data.publish_diagnostics;
-	const char *path = lsp_document_path(lsp, pub->document);
-	TextBuffer *buffer = ted_get_buffer_with_file(ted, path);
-	if (buffer) {
-		buffer_publish_diagnostics(buffer, request, pub->diagnostics);
-	}
-}
-
 
 vec2 ted_mouse_pos(Ted *ted) {
 	return ted->mouse_pos;
@@ -980,6 +1119,10 @@ void ted_test(Ted *ted) {
 	func(ted); \
 	if (ted->message_type == MESSAGE_ERROR) { fprintf(stderr, "ted produced an error.\n"); exit(1); }
 	run_test(config_test);
+	run_test(selector_test);
+	run_test(syntax_test);
+	run_test(lexer_test);
+	run_test(buffer_test);
 
 #undef run_test
 	printf("all good as far as i know :3\n");
@@ -269,6 +269,10 @@ typedef enum {
 #define MENU_SHELL "ted-shell"
 /// "Rename symbol"
 #define MENU_RENAME_SYMBOL "ted-rename-sym"
+/// symbols in the current file
+#define MENU_OUTLINE "ted-outline"
+/// call/type hierarchy
+#define MENU_HIERARCHY "ted-hierarchy"
 
 /// Information about a programming language
 ///
@@ -355,7 +359,7 @@ bool buffer_is_view_only(TextBuffer *buffer);
 void buffer_set_view_only(TextBuffer *buffer, bool view_only);
 /// amount scrolled horizontally, in terms of the width of a space character
 double buffer_get_scroll_columns(TextBuffer *buffer);
-/// number of lines scrolled vertically
+/// number of rows scrolled vertically (lines hidden by folds don't count)
 double buffer_get_scroll_lines(TextBuffer *buffer);
 /// set scroll position
 void buffer_scroll_to(TextBuffer *buffer, double cols, double lines);
@@ -886,8 +890,15 @@ i32 gl_uniform_location(u32 program, const char *uniform);
 void gl_geometry_rect(Rect r, u32 color_rgba);
 /// queue the border of a rectangle with the given color.
 void gl_geometry_rect_border(Rect r, float border_thickness, u32 color);
-/// draw all queued geometry
+/// draw all queued geometry (on top of anything drawn before it).
+///
+/// the geometry is actually sent to the GPU at the end of the frame,
+/// along with everything else, so calling this often is cheap.
 void gl_geometry_draw(void);
+/// queue `texture` stretched over the rectangle `r`.
+///
+/// this calls \ref gl_geometry_draw first, so that the image is drawn over any geometry queued before it.
+void gl_image_rect(Rect r, u32 texture);
 /// create an OpenGL texture object from an image file.
 u32 gl_load_texture_from_image(const char *path);
 
@@ -9,51 +9,170 @@ no_warn_start
 #endif
 no_warn_end
 
+/// positions are stored in units of 1/\ref GLYPH_POS_SCALE pixels
+#define GLYPH_POS_SCALE 4
+
+/// a single glyph, as sent to the GPU.
+///
+/// with instancing, this is expanded into a quad by the vertex shader.
 typedef struct {
-	vec2 pos;
-	vec2 tex_coord;
-	vec4 color;
-} TextVertex;
+	/// corners of the glyph (see \ref GLYPH_POS_SCALE)
+	i16 x0, y0, x1, y1;
+	/// texture coordinates of the corners, scaled so that 65535 = 1.0
+	u16 s0, t0, s1, t1;
+	/// RGBA color
+	u8 color[4];
+} GlyphInstance;
+static_assert_if_possible(sizeof(GlyphInstance) == 20)
 
+/// used when instancing isn't available (6 per glyph)
 typedef struct {
-	TextVertex vert1, vert2, vert3;
-} TextTriangle;
+	i16 x, y;
+	u16 s, t;
+	u8 color[4];
+} GlyphVertex;
+static_assert_if_possible(sizeof(GlyphVertex) == 12)
 
 typedef struct {
-	char32_t c;
+	/// has this character been loaded?
+	bool loaded;
 	int glyph_index;
 	u32 texture;
 	stbtt_packedchar data;
+	/// has this character been sent to the rasterization worker? (see \ref text_font_prefetch)
+	bool queued;
+	/// font in the fallback chain which is used to draw this character
+	/// (either this font or one of its fallbacks), or `NULL` if we haven't figured that out yet.
+	Font *owner;
 } CharInfo;
 
-// characters are split into this many "buckets" according to
-// their least significant bits. this is to create a Budget Hash Map™.
-// must be a power of 2.
-#define CHAR_BUCKET_COUNT (1 << 12)
+/// a glyph which has been rasterized, but not put into a font texture yet
+typedef struct {
+	char32_t c;
+	int glyph_index;
+	int width, height;
+	/// `width * height` bytes (including padding)
+	u8 *pixels;
+	/// texture coordinates here are relative to \ref pixels
+	stbtt_packedchar data;
+} GlyphBitmap;
+
+// character info is stored in a two-level table:
+// code points are split into pages of this many characters, and
+// pages are only allocated when a character from them is used.
+#define CHAR_PAGE_SIZE 256
+#define CHAR_PAGE_COUNT (UNICODE_CODE_POINTS / CHAR_PAGE_SIZE)
 
-#define FONT_TEXTURE_WIDTH 512 // width of each texture
-#define FONT_TEXTURE_HEIGHT 512 // height of each texture
+#define FONT_TEXTURE_WIDTH 1024 // width of each texture
+#define FONT_TEXTURE_HEIGHT 1024 // height of each texture
 
 typedef struct {
+	/// created when the texture is first uploaded (so that text can be laid out without a GL context)
 	GLuint tex;
-	bool needs_update;
+	/// rows of \ref pixels which have changed since the last upload (none if `dirty_y0 >= dirty_y1`)
+	u32 dirty_y0, dirty_y1;
+	/// no more characters can be added to this texture (\ref pixels are freed once it's uploaded)
+	bool full;
 	unsigned char *pixels;
 	stbtt_fontinfo stb_info;
 	stbtt_pack_context pack_context;
-	TextTriangle *triangles;
+	GlyphInstance *glyphs;
+	/// length of \ref glyphs when \ref text_run_record_start was called
+	u32 record_start;
+	/// glyphs before this index have been put into batches by \ref text_render
+	u32 batch_start;
+	/// is this texture used by the batches being drawn right now?
+	bool in_frame;
+	/// position of this texture's glyphs in `text_vbo` (if \ref in_frame is set)
+	u32 frame_offset;
 } FontTexture;
+typedef FontTexture *FontTexturePtr;
+
+/// font files smaller than this are read into memory instead of being mapped.
+///
+/// a mapped file which gets truncated while we're using it crashes ted with SIGBUS,
+/// so we only take that risk where it saves a lot of memory (e.g. huge CJK fallback fonts).
+#define FONT_FILE_MAP_MIN_SIZE (8 << 20)
+
+/// a font file, shared by all fonts loaded from it
+typedef struct {
+	char *path;
+	/// when the file was last modified, as of when we opened it
+	struct timespec modified;
+	const u8 *data;
+	size_t size;
+	/// is `data` mapped (as opposed to malloc'd)?
+	bool mapped;
+	/// number of fonts using this file
+	u32 refs;
+} FontFile;
+typedef FontFile *FontFilePtr;
+
+/// kerning between two glyphs (see \ref font_kerning)
+typedef struct {
+	/// `(glyph1 << 16) | glyph2`, or 0 for an empty slot
+	u32 glyphs;
+	/// in pixels
+	float kerning;
+} KerningPair;
 
 struct Font {
 	bool force_monospace;
+	/// see \ref text_font_generation
+	u32 generation;
 	float char_height;
+	/// scale from font units to pixels at \ref char_height
+	float scale;
+	/// open-addressing hash table of kerning pairs which have been looked up,
+	/// since finding them in the font's GPOS/kern tables is slow.
+	/// the capacity is a power of 2 (or 0).
+	KerningPair *kerning_pairs;
+	u32 kerning_pairs_capacity;
+	u32 kerning_pairs_count;
 	stbtt_fontinfo stb_info;
 	FontTexture *textures; // dynamic array of textures
-	CharInfo *char_info[CHAR_BUCKET_COUNT]; // each entry is a dynamic array of char info
+	CharInfo *char_pages[CHAR_PAGE_COUNT]; // each page is an array of CHAR_PAGE_SIZE char infos, or NULL
 	// TTF data (i.e. the contents of the TTF file)
-	u8 *ttf_data;
+	FontFile *file;
 	Font *fallback;
 };
 
+/// glyphs recorded from one of the textures of a font (or one of its fallbacks)
+typedef struct {
+	Font *font;
+	u32 texture;
+	/// y coordinates are relative to the y passed to \ref text_run_record_end
+	GlyphInstance *glyphs;
+} TextRunPart;
+
+struct TextRun {
+	TextRunPart *parts;
+};
+
+typedef struct {
+	Font *font;
+	GlyphBitmap bitmap;
+} GlyphJob;
+
+/// background thread which rasterizes glyphs before they're needed (see \ref text_font_prefetch)
+static struct {
+	SDL_Thread *thread;
+	SDL_mutex *mutex;
+	/// signalled when there are new jobs, or when a job is finished
+	SDL_cond *cond;
+	bool quit;
+	/// glyphs to rasterize (only `bitmap.c` is set)
+	GlyphJob *jobs;
+	/// rasterized glyphs, waiting to be put into font textures
+	GlyphJob *results;
+	/// font which the worker is using right now
+	Font *busy_font;
+} text_worker;
+
+static u32 font_generation_counter;
+/// all font files which are currently open
+static FontFile **font_files;
+
 const TextRenderState text_render_state_default = {
 	.render = true,
 	.wrap = false,
@@ -90,6 +209,18 @@ static void text_set_err(const char *fmt, ...) {
 
 void text_font_set_fallback(Font *font, Font *fallback) {
 	font->fallback = fallback;
+	// forget which characters come from which fonts
+	for (u32 i = 0; i < CHAR_PAGE_COUNT; i++) {
+		CharInfo *page = font->char_pages[i];
+		if (!page) continue;
+		for (u32 j = 0; j < CHAR_PAGE_SIZE; j++)
+			page[j].owner = NULL;
+	}
+	font->generation = ++font_generation_counter;
+}
+
+u32 text_font_generation(Font *font) {
+	return font->generation;
 }
 
 static GLuint text_program;
@@ -97,8 +228,22 @@ static GLuint text_vbo, text_vao;
 static GLuint text_v_pos, text_v_color, text_v_tex_coord;
 static GLint  text_u_sampler;
 static GLint  text_u_window_size;
+/// scratch space for expanding glyphs into vertices when instancing isn't available
+static GlyphVertex *text_vertices;
+/// textures used by the batches being drawn right now (see \ref text_upload_batches)
+static FontTexturePtr *text_frame_textures;
+
+/// are we using instanced rendering? (requires GL 3.3)
+static bool text_instanced;
+static GLuint text_instanced_program;
+static GLuint text_instanced_vao, text_corner_vbo;
+static GLuint text_instanced_v_corner, text_instanced_v_rect, text_instanced_v_tex_rect, text_instanced_v_color;
+static GLint  text_instanced_u_sampler;
+static GLint  text_instanced_u_window_size;
 
 bool text_init(void) {
+	// (the 0.5 in these shaders is 2 / GLYPH_POS_SCALE)
+	static_assert_if_possible(GLYPH_POS_SCALE == 4)
 	const char *vshader_code = "attribute vec4 v_color;\n\
 attribute vec2 v_pos;\n\
 attribute vec2 v_tex_coord;\n\
@@ -108,7 +253,22 @@ OUT vec2 tex_coord;\n\
 void main() {\n\
 	color = v_color;\n\
 	tex_coord = v_tex_coord;\n\
-	vec2 p = v_pos * (2.0 / u_window_size);\n\
+	vec2 p = v_pos * (0.5 / u_window_size);\n\
+	gl_Position = vec4(p.x - 1.0, 1.0 - p.y, 0.0, 1.0);\n\
+}\n\
+";
+	// one instance per glyph, six vertices per instance
+	const char *instanced_vshader_code = "attribute vec2 v_corner;\n\
+attribute vec4 v_rect;\n\
+attribute vec4 v_tex_rect;\n\
+attribute vec4 v_color;\n\
+uniform vec2 u_window_size;\n\
+OUT vec4 color;\n\
+OUT vec2 tex_coord;\n\
+void main() {\n\
+	color = v_color;\n\
+	tex_coord = mix(v_tex_rect.xy, v_tex_rect.zw, v_corner);\n\
+	vec2 p = mix(v_rect.xy, v_rect.zw, v_corner) * (0.5 / u_window_size);\n\
 	gl_Position = vec4(p.x - 1.0, 1.0 - p.y, 0.0, 1.0);\n\
 }\n\
 ";
@@ -129,14 +289,46 @@ void main() {\n\
 	text_u_window_size = gl_uniform_location(text_program, "u_window_size");
 	glGenBuffers(1, &text_vbo);
 	glGenVertexArrays(1, &text_vao);
+	
+	text_instanced = gl_version_major * 100 + gl_version_minor >= 303
+		&& glDrawArraysInstanced && glVertexAttribDivisor;
+	if (text_instanced) {
+		text_instanced_program = gl_compile_and_link_shaders(NULL, instanced_vshader_code, fshader_code);
+		text_instanced = text_instanced_program != 0;
+	}
+	if (text_instanced) {
+		text_instanced_v_corner = gl_attrib_location(text_instanced_program, "v_corner");
+		text_instanced_v_rect = gl_attrib_location(text_instanced_program, "v_rect");
+		text_instanced_v_tex_rect = gl_attrib_location(text_instanced_program, "v_tex_rect");
+		text_instanced_v_color = gl_attrib_location(text_instanced_program, "v_color");
+		text_instanced_u_sampler = gl_uniform_location(text_instanced_program, "sampler");
+		text_instanced_u_window_size = gl_uniform_location(text_instanced_program, "u_window_size");
+		
+		static const float corners[6][2] = {{0, 0}, {0, 1}, {1, 1}, {1, 1}, {1, 0}, {0, 0}};
+		glGenVertexArrays(1, &text_instanced_vao);
+		glBindVertexArray(text_instanced_vao);
+		glGenBuffers(1, &text_corner_vbo);
+		glBindBuffer(GL_ARRAY_BUFFER, text_corner_vbo);
+		glBufferData(GL_ARRAY_BUFFER, sizeof corners, corners, GL_STATIC_DRAW);
+		glVertexAttribPointer(text_instanced_v_corner, 2, GL_FLOAT, 0, sizeof corners[0], NULL);
+		glEnableVertexAttribArray(text_instanced_v_corner);
+		// the rest of the attributes come from text_vbo, one per glyph
+		glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
+		glVertexAttribPointer(text_instanced_v_rect, 4, GL_SHORT, 0, sizeof(GlyphInstance), (void *)offsetof(GlyphInstance, x0));
+		glEnableVertexAttribArray(text_instanced_v_rect);
+		glVertexAttribDivisor(text_instanced_v_rect, 1);
+		glVertexAttribPointer(text_instanced_v_tex_rect, 4, GL_UNSIGNED_SHORT, 1, sizeof(GlyphInstance), (void *)offsetof(GlyphInstance, s0));
+		glEnableVertexAttribArray(text_instanced_v_tex_rect);
+		glVertexAttribDivisor(text_instanced_v_tex_rect, 1);
+		glVertexAttribPointer(text_instanced_v_color, 4, GL_UNSIGNED_BYTE, 1, sizeof(GlyphInstance), (void *)offsetof(GlyphInstance, color));
+		glEnableVertexAttribArray(text_instanced_v_color);
+		glVertexAttribDivisor(text_instanced_v_color, 1);
+		glBindVertexArray(0);
+	}
 
 	return true;
 }
 
-static u32 char_bucket_index(char32_t c) {
-	return c & (CHAR_BUCKET_COUNT - 1);
-}
-
 
 static FontTexture *font_new_texture(Font *font) {
 	PROFILE_TIME(start);
@@ -146,9 +338,10 @@ static FontTexture *font_new_texture(Font *font) {
 		return NULL;
 	}
 	FontTexture *texture = arr_addp(font->textures);
-	stbtt_PackBegin(&texture->pack_context, pixels, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT,
+	// (glyphs are copied into pixels by font_add_glyph, so the pack context doesn't need them.
+	// passing NULL also stops stb_truetype from needlessly zeroing every page of the calloc'd bitmap.)
+	stbtt_PackBegin(&texture->pack_context, NULL, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT,
 		FONT_TEXTURE_WIDTH, 1, NULL);
-	glGenTextures(1, &texture->tex);
 	PROFILE_TIME(end);
 	texture->pixels = pixels;
 	#if PROFILE
@@ -158,151 +351,343 @@ static FontTexture *font_new_texture(Font *font) {
 }
 
 static void font_texture_update_if_needed(FontTexture *texture) {
-	if (texture->needs_update) {
-		PROFILE_TIME(start);
+	const u32 y0 = texture->dirty_y0, y1 = texture->dirty_y1;
+	if (y0 >= y1)
+		return;
+	PROFILE_TIME(start);
+	glGetError(); // clear error
+	if (!texture->tex) {
+		glGenTextures(1, &texture->tex);
 		glBindTexture(GL_TEXTURE_2D, texture->tex);
 		glTexImage2D(GL_TEXTURE_2D, 0, GL_RED, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT, 0, GL_RED, GL_UNSIGNED_BYTE, texture->pixels);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
 		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-		PROFILE_TIME(end);
-		
-		#if PROFILE
-		printf("- update font texture: %.1fms\n", 1e3 * (end - start));
-		#endif
-		texture->needs_update = false;
+		gl_frame_stats.upload_bytes += FONT_TEXTURE_WIDTH * FONT_TEXTURE_HEIGHT;
+	} else {
+		// only upload the rows which changed
+		glBindTexture(GL_TEXTURE_2D, texture->tex);
+		glTexSubImage2D(GL_TEXTURE_2D, 0, 0, (GLint)y0, FONT_TEXTURE_WIDTH, (GLsizei)(y1 - y0),
+			GL_RED, GL_UNSIGNED_BYTE, texture->pixels + y0 * FONT_TEXTURE_WIDTH);
+		gl_frame_stats.upload_bytes += FONT_TEXTURE_WIDTH * (y1 - y0);
+	}
+	PROFILE_TIME(end);
+	
+	#if PROFILE
+	printf("- update font texture (%u rows): %.1fms\n", (unsigned)(y1 - y0), 1e3 * (end - start));
+	#endif
+	texture->dirty_y0 = texture->dirty_y1 = 0;
+	if (texture->full) {
+		// no more characters will be added to this texture
+		free(texture->pixels);
+		texture->pixels = NULL;
 	}
 }
 
-static void font_texture_free(FontTexture *texture) {
-	glDeleteTextures(1, &texture->tex);
-	arr_free(texture->triangles);
-	if (texture->pixels) {
+// no more characters can be added to this texture
+static void font_texture_set_full(FontTexture *texture) {
+	stbtt_PackEnd(&texture->pack_context);
+	texture->full = true;
+	if (texture->dirty_y0 >= texture->dirty_y1) {
+		// (otherwise, the pixels are freed once they're uploaded, in font_texture_update_if_needed)
 		free(texture->pixels);
-		stbtt_PackEnd(&texture->pack_context);
+		texture->pixels = NULL;
 	}
+}
+
+static void font_texture_free(FontTexture *texture) {
+	if (texture->tex)
+		glDeleteTextures(1, &texture->tex);
+	arr_free(texture->glyphs);
+	if (!texture->full)
+		stbtt_PackEnd(&texture->pack_context);
+	free(texture->pixels);
 	memset(texture, 0, sizeof *texture);
 }
 
-// on success, *info is filled out.
-// success includes cases where c is not defined by the font so a substitute character is used.
-// failure only indicates something very bad.
-static Status text_load_char(Font *font, char32_t c, CharInfo *info) {
-	u32 bucket = char_bucket_index(c);
-	arr_foreach_ptr(font->char_info[bucket], CharInfo, i) {
-		if (i->c == c) {
-			// already loaded
-			*info = *i;
-			return true;
-		}
-	}
+// rasterize c by itself. this only reads from font, so it can be called from the rasterization worker.
+// returns false on failure.
+static bool glyph_rasterize(const Font *font, char32_t c, GlyphBitmap *bitmap) {
+	memset(bitmap, 0, sizeof *bitmap);
+	bitmap->c = c;
+	bitmap->glyph_index = stbtt_FindGlyphIndex(&font->stb_info, (int)c);
 	
-	glGetError(); // clear error
-	memset(info, 0, sizeof *info);
-	
-	info->glyph_index = stbtt_FindGlyphIndex(&font->stb_info, (int)c);
-	if (c != UNICODE_BOX_CHARACTER && info->glyph_index == 0) {
-		// this code point is not defined by the font
-		
-		// use the box character
-		if (!text_load_char(font, UNICODE_BOX_CHARACTER, info))
-			return false;
-		info->c = c;
-		arr_add(font->char_info[bucket], *info);
-		return true;
+	// we only need the fields which are used by GatherRects/RenderIntoRects
+	stbtt_pack_context context = {
+		.padding = 1,
+		.h_oversample = 1,
+		.v_oversample = 1,
+	};
+	stbtt_pack_range range = {
+		.font_size = font->char_height,
+		.first_unicode_codepoint_in_range = (int)c,
+		.num_chars = 1,
+		.chardata_for_range = &bitmap->data,
+	};
+	stbrp_rect rect = {0};
+	stbtt_PackFontRangesGatherRects(&context, &font->stb_info, &range, 1, &rect);
+	if (rect.w <= 0 || rect.h <= 0)
+		return false;
+	bitmap->width = rect.w;
+	bitmap->height = rect.h;
+	bitmap->pixels = calloc((size_t)rect.w, (size_t)rect.h);
+	if (!bitmap->pixels)
+		return false;
+	context.pixels = bitmap->pixels;
+	context.width = context.stride_in_bytes = rect.w;
+	context.height = rect.h;
+	rect.was_packed = 1;
+	if (!stbtt_PackFontRangesRenderIntoRects(&context, &font->stb_info, &range, 1, &rect)) {
+		free(bitmap->pixels);
+		bitmap->pixels = NULL;
+		return false;
 	}
-	
+	return true;
+}
+
+// put a rasterized glyph into one of font's textures, and fill out *info.
+static bool font_add_glyph(Font *font, const GlyphBitmap *bitmap, CharInfo *info) {
 	if (!font->textures) {
 		if (!font_new_texture(font))
 			return false;
 	}
 	
-	int success = 0;
 	FontTexture *texture = arr_lastp(font->textures);
-	for (int i = 0; i < 2; i++) {
-		info->c = c;
-		info->texture = arr_len(font->textures) - 1;
-		success = stbtt_PackFontRange(&texture->pack_context, font->ttf_data, 0, font->char_height,
-			(int)c, 1, &info->data);
-		if (success) break;
+	stbrp_rect rect = {.w = bitmap->width, .h = bitmap->height};
+	stbtt_PackFontRangesPackRects(&texture->pack_context, &rect, 1);
+	if (!rect.was_packed) {
 		// texture is full; create a new one
-		stbtt_PackEnd(&texture->pack_context);
-		font_texture_update_if_needed(texture);
-		free(texture->pixels);
-		texture->pixels = NULL;
-		debug_println("Create new texture for font %p (triggered by U+%04X)", (void *)font, c);
+		font_texture_set_full(texture);
+		debug_println("Create new texture for font %p (triggered by U+%04X)", (void *)font, bitmap->c);
 		texture = font_new_texture(font);
 		if (!texture)
 			return false;
+		stbtt_PackFontRangesPackRects(&texture->pack_context, &rect, 1);
+		if (!rect.was_packed) {
+			// a brand new texture couldn't fit the character.
+			// something has gone horribly wrong.
+			font_texture_free(texture);
+			arr_remove_last(font->textures);
+			text_set_err("Error rasterizing character %lc", (wchar_t)bitmap->c);
+			return false;
+		}
 	}
 	
-	if (!success) {
-		// a brand new texture couldn't fit the character.
-		// something has gone horribly wrong.
-		font_texture_free(texture);
-		arr_remove_last(font->textures);
-		text_set_err("Error rasterizing character %lc", (wchar_t)c);
-		return false;
+	const u32 x = (u32)rect.x, y = (u32)rect.y, w = (u32)bitmap->width, h = (u32)bitmap->height;
+	for (u32 row = 0; row < h; ++row) {
+		memcpy(&texture->pixels[(y + row) * FONT_TEXTURE_WIDTH + x], &bitmap->pixels[row * w], w);
+	}
+	if (texture->dirty_y0 >= texture->dirty_y1) {
+		texture->dirty_y0 = y;
+		texture->dirty_y1 = y + h;
+	} else {
+		texture->dirty_y0 = min_u32(texture->dirty_y0, y);
+		texture->dirty_y1 = max_u32(texture->dirty_y1, y + h);
 	}
 	
-	texture->needs_update = true;
-	
-	arr_add(font->char_info[bucket], *info);
+	info->loaded = true;
+	info->glyph_index = bitmap->glyph_index;
+	info->texture = arr_len(font->textures) - 1;
+	info->data = bitmap->data;
+	info->data.x0 = (unsigned short)(info->data.x0 + x);
+	info->data.x1 = (unsigned short)(info->data.x1 + x);
+	info->data.y0 = (unsigned short)(info->data.y0 + y);
+	info->data.y1 = (unsigned short)(info->data.y1 + y);
+	info->owner = NULL;
 	return true;
 }
 
-Font *text_font_load(const char *ttf_filename, float font_size) {
-	Font *font = NULL;
-	FILE *ttf_file = fopen(ttf_filename, "rb");
-	
-	text_clear_err();
+static void font_add_prefetched_glyphs(Font *font);
 
-	if (!ttf_file) {
-		text_set_err("Couldn't open font file.", ttf_filename);
-		return NULL;
+// returns the info for c in this font (not any of its fallbacks), loading it if necessary.
+// returns NULL on failure.
+// "success" includes cases where c is not defined by the font so a substitute character is used.
+// failure only indicates something very bad.
+static CharInfo *font_char_info(Font *font, char32_t c) {
+	assert(c < UNICODE_CODE_POINTS);
+	CharInfo **page = &font->char_pages[c / CHAR_PAGE_SIZE];
+	if (!*page) {
+		*page = calloc(CHAR_PAGE_SIZE, sizeof **page);
+		if (!*page) {
+			text_set_err("Not enough memory for character info.");
+			return NULL;
+		}
+	}
+	CharInfo *info = &(*page)[c % CHAR_PAGE_SIZE];
+	if (info->loaded) {
+		return info;
+	}
+	if (info->queued) {
+		// maybe the rasterization worker has finished it
+		font_add_prefetched_glyphs(font);
+		if (info->loaded)
+			return info;
 	}
 	
-	fseek(ttf_file, 0, SEEK_END);
-	u32 file_size = (u32)ftell(ttf_file);
-	fseek(ttf_file, 0, SEEK_SET);
-	if (file_size >= (50UL<<20)) { // fonts aren't usually bigger than 50 MB
-		text_set_err("Font file too big (%u megabytes).", (unsigned)(file_size >> 20));
+	if (c != UNICODE_BOX_CHARACTER && stbtt_FindGlyphIndex(&font->stb_info, (int)c) == 0) {
+		// this code point is not defined by the font
+		
+		// use the box character
+		const CharInfo *box = font_char_info(font, UNICODE_BOX_CHARACTER);
+		if (!box)
+			return NULL;
+		*info = *box;
+		info->owner = NULL;
+		return info;
 	}
 	
-	u8 *file_data = NULL;
-	if (!text_has_err()) {
-		file_data = calloc(1, file_size);
-		font = calloc(1, sizeof *font);
-		if (!file_data || !font) {
-			text_set_err("Not enough memory for font.");
+	// the rasterization worker didn't get to this character in time (or wasn't asked to);
+	// we'll have to do it ourselves.
+	GlyphBitmap bitmap = {0};
+	if (!glyph_rasterize(font, c, &bitmap)) {
+		text_set_err("Error rasterizing character %lc", (wchar_t)c);
+		return NULL;
+	}
+	bool success = font_add_glyph(font, &bitmap, info);
+	free(bitmap.pixels);
+	return success ? info : NULL;
+}
+
+// returns the info for c, and sets *pfont to the font in the fallback chain
+// which should be used to draw it. returns NULL on failure.
+static const CharInfo *text_load_char(Font **pfont, char32_t c) {
+	if (c >= UNICODE_CODE_POINTS) c = UNICODE_BOX_CHARACTER;
+	Font *font = *pfont;
+	const CharInfo *page = font->char_pages[c / CHAR_PAGE_SIZE];
+	if (page) {
+		const CharInfo *info = &page[c % CHAR_PAGE_SIZE];
+		if (info->owner == font) {
+			// fast path: already loaded, and it's in this font
+			return info;
 		}
 	}
 	
-	if (!text_has_err()) {
-		size_t bytes_read = fread(file_data, 1, file_size, ttf_file);
-		if (bytes_read != file_size) {
-			text_set_err("Couldn't read font file.");
+	CharInfo *own = font_char_info(font, c);
+	if (!own) return NULL;
+	if (!own->owner) {
+		Font *owner = font;
+		if (!own->glyph_index && font->fallback) {
+			// this font doesn't have c; try the fallback
+			owner = font->fallback;
+			if (!text_load_char(&owner, c))
+				return NULL;
 		}
+		own->owner = owner;
 	}
+	*pfont = own->owner;
+	if (own->owner == font)
+		return own;
+	// (this is already loaded, so it won't recurse any further)
+	return text_load_char(pfont, c);
+}
 
+static void font_file_free_data(const u8 *data, size_t size, bool mapped) {
+	if (mapped)
+		fs_unmap_file(data, size);
+	else
+		free((void *)data);
+}
+
+// open a font file, or add a reference to it if it's already open.
+static FontFile *font_file_open(const char *path) {
+	const struct timespec modified = time_last_modified(path);
+	const int64_t file_size = fs_file_size(path);
+	arr_foreach_ptr(font_files, FontFilePtr, pfile) {
+		FontFile *file = *pfile;
+		// (if the file has been replaced, this will open the new one, and
+		// fonts which still use the old one can keep using it.)
+		if (streq(file->path, path) && (int64_t)file->size == file_size
+			&& timespec_eq(file->modified, modified)) {
+			++file->refs;
+			return file;
+		}
+	}
 	
-	if (!text_has_err()) {
-		font->char_height = font_size;
-		font->ttf_data = file_data;
-		if (!stbtt_InitFont(&font->stb_info, file_data, 0)) {
-			text_set_err("Couldn't process font file - is this a valid TTF file?");
+	size_t size = 0;
+	const u8 *data = NULL;
+	bool mapped = false;
+	if (file_size >= FONT_FILE_MAP_MIN_SIZE) {
+		data = fs_map_file(path, &size);
+		mapped = true;
+	} else if (file_size > 0) {
+		FILE *fp = fopen(path, "rb");
+		if (fp) {
+			u8 *buf = malloc((size_t)file_size);
+			if (buf && fread(buf, 1, (size_t)file_size, fp) == (size_t)file_size) {
+				data = buf;
+				size = (size_t)file_size;
+			} else {
+				free(buf);
+			}
+			fclose(fp);
 		}
 	}
+	if (!data) {
+		text_set_err("Couldn't open font file.");
+		return NULL;
+	}
+	FontFile *file = calloc(1, sizeof *file);
+	char *path_copy = str_dup(path);
+	if (!file || !path_copy) {
+		text_set_err("Not enough memory for font.");
+		font_file_free_data(data, size, mapped);
+		free(file);
+		free(path_copy);
+		return NULL;
+	}
+	file->path = path_copy;
+	file->modified = modified;
+	file->data = data;
+	file->size = size;
+	file->mapped = mapped;
+	file->refs = 1;
+	arr_add(font_files, file);
+	return file;
+}
+
+static void font_file_close(FontFile *file) {
+	if (!file || --file->refs)
+		return;
+	arr_foreach_ptr(font_files, FontFilePtr, pfile) {
+		if (*pfile == file) {
+			arr_remove(font_files, (u32)(pfile - font_files));
+			break;
+		}
+	}
+	if (!arr_len(font_files))
+		arr_free(font_files);
+	font_file_free_data(file->data, file->size, file->mapped);
+	free(file->path);
+	free(file);
+}
+
+Font *text_font_load(const char *ttf_filename, float font_size) {
+	text_clear_err();
 	
-	if (text_has_err()) {
-		free(file_data);
+	FontFile *file = font_file_open(ttf_filename);
+	if (!file)
+		return NULL;
+	Font *font = calloc(1, sizeof *font);
+	if (!font) {
+		text_set_err("Not enough memory for font.");
+		font_file_close(file);
+		return NULL;
+	}
+	font->char_height = font_size;
+	font->file = file;
+	font->generation = ++font_generation_counter;
+	if (!stbtt_InitFont(&font->stb_info, (unsigned char *)file->data, 0)) {
+		text_set_err("Couldn't process font file - is this a valid TTF file?");
+		font_file_close(file);
 		free(font);
-		font = NULL;
+		return NULL;
 	}
-	fclose(ttf_file);
+	font->scale = stbtt_ScaleForPixelHeight(&font->stb_info, font_size);
 	return font;
 }
 
 void text_font_set_force_monospace(Font *font, bool force) {
+	if (force != font->force_monospace)
+		font->generation = ++font_generation_counter;
 	font->force_monospace = force;
 }
 
@@ -311,45 +696,170 @@ float text_font_char_height(Font *font) {
 }
 
 float text_font_char_width(Font *font, char32_t c) {
-	CharInfo info = {0};
-	if (text_load_char(font, c, &info)) {
-		if (!info.glyph_index && font->fallback)
-			return text_font_char_width(font->fallback, c);
-		return info.data.xadvance;
-	} else {
-		return 0;
+	const CharInfo *info = text_load_char(&font, c);
+	return info ? info->data.xadvance : 0;
+}
+
+static int text_worker_thread(void *userdata) {
+	(void)userdata;
+	SDL_LockMutex(text_worker.mutex);
+	while (!text_worker.quit) {
+		if (!arr_len(text_worker.jobs)) {
+			SDL_CondWait(text_worker.cond, text_worker.mutex);
+			continue;
+		}
+		GlyphJob job = arr_pop_last(text_worker.jobs);
+		text_worker.busy_font = job.font;
+		SDL_UnlockMutex(text_worker.mutex);
+		
+		bool success = glyph_rasterize(job.font, job.bitmap.c, &job.bitmap);
+		
+		SDL_LockMutex(text_worker.mutex);
+		text_worker.busy_font = NULL;
+		if (success)
+			arr_add(text_worker.results, job);
+		SDL_CondBroadcast(text_worker.cond);
 	}
+	SDL_UnlockMutex(text_worker.mutex);
+	return 0;
 }
 
-void text_render(Font *font) {
-	arr_foreach_ptr(font->textures, FontTexture, texture) {
-		size_t ntriangles = arr_len(texture->triangles);
-		if (!ntriangles) continue;
-		glActiveTexture(GL_TEXTURE0);
-		glBindTexture(GL_TEXTURE_2D, texture->tex);
-		font_texture_update_if_needed(texture);
-		// render these triangles
-		if (gl_version_major >= 3)
-			glBindVertexArray(text_vao);
-		glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
-		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)(ntriangles * sizeof(TextTriangle)), texture->triangles, GL_STREAM_DRAW);
-		glVertexAttribPointer(text_v_pos, 2, GL_FLOAT, 0, sizeof(TextVertex), (void *)offsetof(TextVertex, pos));
-		glEnableVertexAttribArray(text_v_pos);
-		glVertexAttribPointer(text_v_tex_coord, 2, GL_FLOAT, 0, sizeof(TextVertex), (void *)offsetof(TextVertex, tex_coord));
-		glEnableVertexAttribArray(text_v_tex_coord);
-		glVertexAttribPointer(text_v_color, 4, GL_FLOAT, 0, sizeof(TextVertex), (void *)offsetof(TextVertex, color));
-		glEnableVertexAttribArray(text_v_color);
-		glUseProgram(text_program);
-		glUniform1i(text_u_sampler, 0);
-		glUniform2f(text_u_window_size, gl_window_width, gl_window_height);
-		glDrawArrays(GL_TRIANGLES, 0, (GLsizei)(3 * ntriangles));
-		arr_clear(texture->triangles);
-		glBindTexture(GL_TEXTURE_2D, 0);
+static bool text_worker_start(void) {
+	if (text_worker.thread)
+		return true;
+	if (!text_worker.mutex) text_worker.mutex = SDL_CreateMutex();
+	if (!text_worker.cond) text_worker.cond = SDL_CreateCond();
+	if (!text_worker.mutex || !text_worker.cond)
+		return false;
+	text_worker.thread = SDL_CreateThread(text_worker_thread, "rasterize glyphs", NULL);
+	return text_worker.thread != NULL;
+}
+
+// make sure the rasterization worker isn't (and won't be) using font.
+static void text_worker_forget(Font *font) {
+	if (!text_worker.thread)
+		return;
+	SDL_LockMutex(text_worker.mutex);
+	for (u32 i = 0; i < arr_len(text_worker.jobs); ) {
+		if (text_worker.jobs[i].font == font)
+			arr_remove(text_worker.jobs, i);
+		else
+			++i;
+	}
+	for (u32 i = 0; i < arr_len(text_worker.results); ) {
+		if (text_worker.results[i].font == font) {
+			free(text_worker.results[i].bitmap.pixels);
+			arr_remove(text_worker.results, i);
+		} else {
+			++i;
+		}
+	}
+	while (text_worker.busy_font == font)
+		SDL_CondWait(text_worker.cond, text_worker.mutex);
+	SDL_UnlockMutex(text_worker.mutex);
+}
+
+void text_font_prefetch(Font *font, const char32_t *text, size_t len) {
+	GlyphJob *jobs = NULL;
+	for (size_t i = 0; i < len; ++i) {
+		char32_t c = text[i];
+		// (ASCII characters will get loaded pretty much immediately anyways)
+		if (c < 0x80 || c >= UNICODE_CODE_POINTS || (c >= 0x40000 && c < 0xE0000))
+			continue;
+		CharInfo *page = font->char_pages[c / CHAR_PAGE_SIZE];
+		if (page && (page[c % CHAR_PAGE_SIZE].loaded || page[c % CHAR_PAGE_SIZE].queued))
+			continue;
 		
-		// if i remove this i get
-		//    Texture state usage warning: The texture object (0) bound to texture image unit 0 does not have a defined base level and cannot be used for texture mapping
-		// (even with no other draw calls) which is really weird but whatever this is probably good practice anyways.
-		glUseProgram(0);
+		// figure out which font in the fallback chain will draw c
+		Font *owner = font;
+		while (owner && !stbtt_FindGlyphIndex(&owner->stb_info, (int)c))
+			owner = owner->fallback;
+		for (Font *f = font; f; f = f == owner ? NULL : f->fallback) {
+			CharInfo **p = &f->char_pages[c / CHAR_PAGE_SIZE];
+			if (!*p) *p = calloc(CHAR_PAGE_SIZE, sizeof **p);
+			if (!*p) break;
+			CharInfo *info = &(*p)[c % CHAR_PAGE_SIZE];
+			if (f == owner && !info->loaded && !info->queued) {
+				GlyphJob *job = arr_addp(jobs);
+				if (job) {
+					job->font = owner;
+					job->bitmap.c = c;
+				}
+			}
+			info->queued = true;
+		}
+	}
+	
+	if (arr_len(jobs) && text_worker_start()) {
+		SDL_LockMutex(text_worker.mutex);
+		arr_foreach_ptr(jobs, GlyphJob, job)
+			arr_add(text_worker.jobs, *job);
+		SDL_CondBroadcast(text_worker.cond);
+		SDL_UnlockMutex(text_worker.mutex);
+	}
+	arr_free(jobs);
+}
+
+// put glyphs which the worker has rasterized into font's textures
+static void font_add_prefetched_glyphs(Font *font) {
+	if (!text_worker.thread)
+		return;
+	GlyphJob *finished = NULL;
+	SDL_LockMutex(text_worker.mutex);
+	for (u32 i = 0; i < arr_len(text_worker.results); ) {
+		if (text_worker.results[i].font == font) {
+			arr_add(finished, text_worker.results[i]);
+			arr_remove(text_worker.results, i);
+		} else {
+			++i;
+		}
+	}
+	SDL_UnlockMutex(text_worker.mutex);
+	
+	arr_foreach_ptr(finished, GlyphJob, job) {
+		const GlyphBitmap *bitmap = &job->bitmap;
+		CharInfo *page = font->char_pages[bitmap->c / CHAR_PAGE_SIZE];
+		// (the character might have been needed before the worker got to it)
+		if (page && !page[bitmap->c % CHAR_PAGE_SIZE].loaded)
+			font_add_glyph(font, bitmap, &page[bitmap->c % CHAR_PAGE_SIZE]);
+		free(bitmap->pixels);
+	}
+	arr_free(finished);
+}
+
+void text_quit(void) {
+	if (text_worker.thread) {
+		SDL_LockMutex(text_worker.mutex);
+		text_worker.quit = true;
+		SDL_CondBroadcast(text_worker.cond);
+		SDL_UnlockMutex(text_worker.mutex);
+		SDL_WaitThread(text_worker.thread, NULL);
+		text_worker.thread = NULL;
+	}
+	arr_foreach_ptr(text_worker.results, GlyphJob, job)
+		free(job->bitmap.pixels);
+	arr_free(text_worker.results);
+	arr_free(text_worker.jobs);
+	if (text_worker.cond) SDL_DestroyCond(text_worker.cond);
+	if (text_worker.mutex) SDL_DestroyMutex(text_worker.mutex);
+	memset(&text_worker, 0, sizeof text_worker);
+}
+
+void text_render(Font *font) {
+	font_add_prefetched_glyphs(font);
+	u32 ntextures = arr_len(font->textures);
+	for (u32 t = 0; t < ntextures; ++t) {
+		FontTexture *texture = &font->textures[t];
+		u32 nglyphs = arr_len(texture->glyphs);
+		if (nglyphs > texture->batch_start) {
+			gl_add_batch((GlBatch){
+				.font = font,
+				.texture = t,
+				.first = texture->batch_start,
+				.count = nglyphs - texture->batch_start,
+			});
+			texture->batch_start = nglyphs;
+		}
 	}
 	
 	if (font->fallback) {
@@ -357,6 +867,241 @@ void text_render(Font *font) {
 	}
 }
 
+void text_upload_batches(const GlBatch *batches, u32 nbatches) {
+	// figure out where each texture's glyphs go in text_vbo
+	u32 nglyphs = 0;
+	for (u32 i = 0; i < nbatches; ++i) {
+		if (!batches[i].font) continue;
+		FontTexture *texture = &batches[i].font->textures[batches[i].texture];
+		if (texture->in_frame) continue;
+		texture->in_frame = true;
+		texture->frame_offset = nglyphs;
+		nglyphs += texture->batch_start;
+		arr_add(text_frame_textures, texture);
+	}
+	if (!nglyphs) return;
+	
+	glActiveTexture(GL_TEXTURE0);
+	arr_foreach_ptr(text_frame_textures, FontTexturePtr, ptexture) {
+		font_texture_update_if_needed(*ptexture);
+	}
+	
+	glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
+	if (text_instanced) {
+		const size_t size = nglyphs * sizeof(GlyphInstance);
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)size, NULL, GL_STREAM_DRAW);
+		arr_foreach_ptr(text_frame_textures, FontTexturePtr, ptexture) {
+			const FontTexture *texture = *ptexture;
+			glBufferSubData(GL_ARRAY_BUFFER, (GLintptr)(texture->frame_offset * sizeof(GlyphInstance)),
+				(GLsizeiptr)(texture->batch_start * sizeof(GlyphInstance)), texture->glyphs);
+		}
+		gl_frame_stats.upload_bytes += size;
+	} else {
+		// expand glyphs into vertices
+		arr_set_len(text_vertices, 6 * nglyphs);
+		if (!text_vertices) return;
+		arr_foreach_ptr(text_frame_textures, FontTexturePtr, ptexture) {
+			const FontTexture *texture = *ptexture;
+			GlyphVertex *out = &text_vertices[6 * texture->frame_offset];
+			for (u32 i = 0; i < texture->batch_start; ++i, out += 6) {
+				const GlyphInstance *g = &texture->glyphs[i];
+				GlyphVertex v_1 = {g->x0, g->y0, g->s0, g->t0, {0}};
+				GlyphVertex v_2 = {g->x0, g->y1, g->s0, g->t1, {0}};
+				GlyphVertex v_3 = {g->x1, g->y1, g->s1, g->t1, {0}};
+				GlyphVertex v_4 = {g->x1, g->y0, g->s1, g->t0, {0}};
+				memcpy(v_1.color, g->color, 4);
+				memcpy(v_2.color, g->color, 4);
+				memcpy(v_3.color, g->color, 4);
+				memcpy(v_4.color, g->color, 4);
+				out[0] = v_1; out[1] = v_2; out[2] = v_3;
+				out[3] = v_3; out[4] = v_4; out[5] = v_1;
+			}
+		}
+		glBufferData(GL_ARRAY_BUFFER, (GLsizeiptr)arr_size_in_bytes(text_vertices), text_vertices, GL_STREAM_DRAW);
+		gl_frame_stats.upload_bytes += arr_size_in_bytes(text_vertices);
+	}
+}
+
+void text_draw_batch(const GlBatch *batch, bool setup) {
+	const FontTexture *texture = &batch->font->textures[batch->texture];
+	if (!texture->in_frame) return;
+	const u32 first = texture->frame_offset + batch->first;
+	if (setup) {
+		glActiveTexture(GL_TEXTURE0);
+		if (text_instanced) {
+			glBindVertexArray(text_instanced_vao);
+			glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
+			glUseProgram(text_instanced_program);
+			glUniform1i(text_instanced_u_sampler, 0);
+			glUniform2f(text_instanced_u_window_size, gl_window_width, gl_window_height);
+		} else {
+			if (gl_version_major >= 3)
+				glBindVertexArray(text_vao);
+			glBindBuffer(GL_ARRAY_BUFFER, text_vbo);
+			glVertexAttribPointer(text_v_pos, 2, GL_SHORT, 0, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, x));
+			glEnableVertexAttribArray(text_v_pos);
+			glVertexAttribPointer(text_v_tex_coord, 2, GL_UNSIGNED_SHORT, 1, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, s));
+			glEnableVertexAttribArray(text_v_tex_coord);
+			glVertexAttribPointer(text_v_color, 4, GL_UNSIGNED_BYTE, 1, sizeof(GlyphVertex), (void *)offsetof(GlyphVertex, color));
+			glEnableVertexAttribArray(text_v_color);
+			glUseProgram(text_program);
+			glUniform1i(text_u_sampler, 0);
+			glUniform2f(text_u_window_size, gl_window_width, gl_window_height);
+		}
+	}
+	glBindTexture(GL_TEXTURE_2D, texture->tex);
+	if (text_instanced) {
+		// (glDrawArraysInstancedBaseInstance needs GL 4.2, so just point the per-glyph attributes at the first glyph)
+		const size_t offset = first * sizeof(GlyphInstance);
+		glVertexAttribPointer(text_instanced_v_rect, 4, GL_SHORT, 0, sizeof(GlyphInstance), (void *)(offset + offsetof(GlyphInstance, x0)));
+		glVertexAttribPointer(text_instanced_v_tex_rect, 4, GL_UNSIGNED_SHORT, 1, sizeof(GlyphInstance), (void *)(offset + offsetof(GlyphInstance, s0)));
+		glVertexAttribPointer(text_instanced_v_color, 4, GL_UNSIGNED_BYTE, 1, sizeof(GlyphInstance), (void *)(offset + offsetof(GlyphInstance, color)));
+		glDrawArraysInstanced(GL_TRIANGLES, 0, 6, (GLsizei)batch->count);
+	} else {
+		glDrawArrays(GL_TRIANGLES, (GLint)(6 * first), (GLsizei)(6 * batch->count));
+	}
+	++gl_frame_stats.draw_calls;
+}
+
+void text_end_batches(void) {
+	arr_foreach_ptr(text_frame_textures, FontTexturePtr, ptexture) {
+		FontTexture *texture = *ptexture;
+		const u32 ndrawn = texture->batch_start;
+		if (ndrawn == arr_len(texture->glyphs)) {
+			// (keep the memory around for next frame)
+			arr_set_len(texture->glyphs, 0);
+		} else {
+			// keep the glyphs which haven't been put in a batch yet
+			arr_remove_multiple(texture->glyphs, 0, ndrawn);
+		}
+		texture->record_start = texture->record_start > ndrawn ? texture->record_start - ndrawn : 0;
+		texture->batch_start = 0;
+		texture->in_frame = false;
+	}
+	arr_set_len(text_frame_textures, 0);
+	arr_set_len(text_vertices, 0);
+	glBindTexture(GL_TEXTURE_2D, 0);
+}
+
+static i16 glyph_pos_clamp(double p) {
+	return (i16)clampd(p, -32768, 32767);
+}
+
+void text_run_record_start(Font *font) {
+	for (Font *f = font; f; f = f->fallback) {
+		arr_foreach_ptr(f->textures, FontTexture, texture) {
+			texture->record_start = arr_len(texture->glyphs);
+		}
+	}
+}
+
+TextRun *text_run_record_end(Font *font, double y) {
+	TextRun *run = calloc(1, sizeof *run);
+	if (!run) return NULL;
+	// glyphs are positioned relative to floor(y) (see text_char_with_state),
+	// so moving the run by an integer amount gives exactly the same result as laying it out again.
+	const i32 y_origin = (i32)floor(y) * GLYPH_POS_SCALE;
+	for (Font *f = font; f; f = f->fallback) {
+		u32 ntextures = arr_len(f->textures);
+		for (u32 t = 0; t < ntextures; ++t) {
+			FontTexture *texture = &f->textures[t];
+			u32 start = texture->record_start, end = arr_len(texture->glyphs);
+			texture->record_start = end;
+			if (start >= end) continue;
+			TextRunPart *part = arr_addp(run->parts);
+			if (!part) break;
+			part->font = f;
+			part->texture = t;
+			arr_set_len(part->glyphs, end - start);
+			if (!part->glyphs) break;
+			memcpy(part->glyphs, &texture->glyphs[start], (end - start) * sizeof *part->glyphs);
+			arr_foreach_ptr(part->glyphs, GlyphInstance, glyph) {
+				glyph->y0 = glyph_pos_clamp(glyph->y0 - y_origin);
+				glyph->y1 = glyph_pos_clamp(glyph->y1 - y_origin);
+			}
+		}
+	}
+	return run;
+}
+
+void text_run_draw(const TextRun *run, double y) {
+	const i32 y_origin = (i32)floor(y) * GLYPH_POS_SCALE;
+	arr_foreach_ptr(run->parts, const TextRunPart, part) {
+		FontTexture *texture = &part->font->textures[part->texture];
+		u32 start = arr_len(texture->glyphs), count = arr_len(part->glyphs);
+		arr_set_len(texture->glyphs, start + count);
+		if (!texture->glyphs) return;
+		GlyphInstance *out = &texture->glyphs[start];
+		for (u32 i = 0; i < count; ++i) {
+			GlyphInstance glyph = part->glyphs[i];
+			glyph.y0 = glyph_pos_clamp(glyph.y0 + y_origin);
+			glyph.y1 = glyph_pos_clamp(glyph.y1 + y_origin);
+			out[i] = glyph;
+		}
+	}
+}
+
+void text_run_free(TextRun *run) {
+	if (!run) return;
+	arr_foreach_ptr(run->parts, TextRunPart, part) {
+		arr_free(part->glyphs);
+	}
+	arr_free(run->parts);
+	free(run);
+}
+
+static u32 kerning_pair_slot(u32 glyphs, u32 capacity) {
+	// (fibonacci hashing, using the high bits of the product)
+	return (u32)((u64)(u32)(glyphs * UINT32_C(2654435769)) * capacity >> 32);
+}
+
+// kerning adjustment in pixels between two glyphs of font
+static float font_kerning(Font *font, int glyph1, int glyph2) {
+	if (!font->stb_info.gpos && !font->stb_info.kern) {
+		// font doesn't do kerning (very common for monospace fonts)
+		return 0;
+	}
+	const u32 glyphs = (u32)glyph1 << 16 | (u32)glyph2;
+	if (font->kerning_pairs_capacity) {
+		const u32 mask = font->kerning_pairs_capacity - 1;
+		for (u32 i = kerning_pair_slot(glyphs, font->kerning_pairs_capacity); ; i = (i + 1) & mask) {
+			const KerningPair *pair = &font->kerning_pairs[i];
+			if (pair->glyphs == glyphs)
+				return pair->kerning;
+			if (!pair->glyphs)
+				break;
+		}
+	}
+	
+	const float kerning = (float)stbtt_GetGlyphKernAdvance(&font->stb_info, glyph1, glyph2) * font->scale;
+	
+	if (2 * (font->kerning_pairs_count + 1) > font->kerning_pairs_capacity) {
+		// grow table
+		const u32 new_capacity = font->kerning_pairs_capacity ? 2 * font->kerning_pairs_capacity : 1024;
+		KerningPair *new_pairs = calloc(new_capacity, sizeof *new_pairs);
+		if (!new_pairs)
+			return kerning;
+		for (u32 i = 0; i < font->kerning_pairs_capacity; ++i) {
+			const KerningPair *pair = &font->kerning_pairs[i];
+			if (!pair->glyphs) continue;
+			u32 j = kerning_pair_slot(pair->glyphs, new_capacity);
+			while (new_pairs[j].glyphs)
+				j = (j + 1) & (new_capacity - 1);
+			new_pairs[j] = *pair;
+		}
+		free(font->kerning_pairs);
+		font->kerning_pairs = new_pairs;
+		font->kerning_pairs_capacity = new_capacity;
+	}
+	u32 i = kerning_pair_slot(glyphs, font->kerning_pairs_capacity);
+	while (font->kerning_pairs[i].glyphs)
+		i = (i + 1) & (font->kerning_pairs_capacity - 1);
+	font->kerning_pairs[i].glyphs = glyphs;
+	font->kerning_pairs[i].kerning = kerning;
+	++font->kerning_pairs_count;
+	return kerning;
+}
+
 void text_char_with_state(Font *font, TextRenderState *state, char32_t c) {
 	bool wrapped = false;
 top:
@@ -364,8 +1109,6 @@ top:
 		// fuck
 		return;
 	}
-	CharInfo info = {0};
-
 	if (c >= 0x40000 && c < 0xE0000){
 		// these Unicode code points are currently unassigned. replace them with a Unicode box.
 		// (specifically, we don't want to use extra memory for pages which
@@ -374,14 +1117,11 @@ top:
 	}
 	if (c >= UNICODE_CODE_POINTS) c = UNICODE_BOX_CHARACTER; // code points this big should never appear in valid Unicode
 	
-	if (!text_load_char(font, c, &info))
+	// (this switches font to the fallback font if necessary)
+	const CharInfo *info = text_load_char(&font, c);
+	if (!info)
 		return;
 	
-	if (!info.glyph_index && font->fallback) {
-		text_char_with_state(font->fallback, state, c);
-		return;
-	}
-	
 	
 	const float char_height = font->char_height;
 	
@@ -393,11 +1133,8 @@ top:
 		goto ret;
 	}
 	
-	if (!font->force_monospace && state->prev_glyph && info.glyph_index) {
-		// kerning
-		state->x += (float)stbtt_GetGlyphKernAdvance(&font->stb_info,
-			(int)state->prev_glyph, (int)info.glyph_index)
-			* stbtt_ScaleForPixelHeight(&font->stb_info, font->char_height);
+	if (!font->force_monospace && state->prev_glyph && info->glyph_index) {
+		state->x += font_kerning(font, (int)state->prev_glyph, info->glyph_index);
 	}
 	
 	{
@@ -405,7 +1142,7 @@ top:
 		x = (float)(state->x - floor(state->x));
 		y = (float)(state->y - floor(state->y));
 		y += char_height * 0.75f;
-		stbtt_GetPackedQuad(&info.data, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT, 0, &x, &y, &q, 0);
+		stbtt_GetPackedQuad(&info->data, FONT_TEXTURE_WIDTH, FONT_TEXTURE_HEIGHT, 0, &x, &y, &q, 0);
 		y -= char_height * 0.75f;
 		
 		q.x0 += (float)floor(state->x);
@@ -458,20 +1195,29 @@ top:
 		y1 = max_y;
 	}
 	if (state->render) {
-		float r = state->color[0], g = state->color[1], b = state->color[2], a = state->color[3];
-		TextVertex v_1 = {{x0, y0}, {s0, t0}, {r, g, b, a}};
-		TextVertex v_2 = {{x0, y1}, {s0, t1}, {r, g, b, a}};
-		TextVertex v_3 = {{x1, y1}, {s1, t1}, {r, g, b, a}};
-		TextVertex v_4 = {{x1, y0}, {s1, t0}, {r, g, b, a}};
-		TextTriangle triangle1 = {v_1, v_2, v_3};
-		TextTriangle triangle2 = {v_3, v_4, v_1};
-		arr_add(font->textures[info.texture].triangles, triangle1);
-		arr_add(font->textures[info.texture].triangles, triangle2);
+		const float pos_scale = GLYPH_POS_SCALE;
+		const float pos_max = 32767 / pos_scale;
+		if (x0 < pos_max && y0 < pos_max && x1 > -pos_max && y1 > -pos_max) {
+			// (glyphs which can't be represented are way off screen anyways)
+			GlyphInstance glyph = {
+				.x0 = (i16)roundf(maxf(x0, -pos_max) * pos_scale),
+				.y0 = (i16)roundf(maxf(y0, -pos_max) * pos_scale),
+				.x1 = (i16)roundf(minf(x1, pos_max) * pos_scale),
+				.y1 = (i16)roundf(minf(y1, pos_max) * pos_scale),
+				.s0 = (u16)roundf(clampf(s0, 0, 1) * 65535),
+				.t0 = (u16)roundf(clampf(t0, 0, 1) * 65535),
+				.s1 = (u16)roundf(clampf(s1, 0, 1) * 65535),
+				.t1 = (u16)roundf(clampf(t1, 0, 1) * 65535),
+			};
+			for (int i = 0; i < 4; ++i)
+				glyph.color[i] = (u8)roundf(clampf(state->color[i], 0, 1) * 255);
+			arr_add(font->textures[info->texture].glyphs, glyph);
+		}
 	}
 	ret:
 	state->x_largest = maxd(state->x, state->x_largest);
 	state->y_largest = maxd(state->y, state->y_largest);
-	state->prev_glyph = info.glyph_index;
+	state->prev_glyph = info->glyph_index;
 }
 
 void text_utf8_with_state(Font *font, TextRenderState *state, const char *str) {
@@ -553,9 +1299,13 @@ void text_get_size32(Font *font, const char32_t *text, u64 len, float *width, fl
 
 
 static void font_free_char_info(Font *font) {
-	for (u32 i = 0; i < CHAR_BUCKET_COUNT; i++) {
-		arr_free(font->char_info[i]);
+	for (u32 i = 0; i < CHAR_PAGE_COUNT; i++) {
+		free(font->char_pages[i]);
+		font->char_pages[i] = NULL;
 	}
+	free(font->kerning_pairs);
+	font->kerning_pairs = NULL;
+	font->kerning_pairs_capacity = font->kerning_pairs_count = 0;
 }
 
 static void font_free_textures(Font *font) {
@@ -570,15 +1320,141 @@ void text_state_break_kerning(TextRenderState *state) {
 }
 
 void text_font_change_size(Font *font, float new_size) {
+	// draw anything which is using this font's textures before they go away
+	gl_frame_flush();
+	text_worker_forget(font);
 	font_free_textures(font);
 	font_free_char_info(font);
 	font->char_height = new_size;
+	font->scale = stbtt_ScaleForPixelHeight(&font->stb_info, new_size);
+	font->generation = ++font_generation_counter;
 	if (font->fallback)
 		text_font_change_size(font->fallback, new_size);
 }
 
+static void text_benchmark_char_lookup(Font *font, const char *name, const char32_t *text, u32 len) {
+	const int iterations = 100;
+	double total_width = 0;
+	// first time around, glyphs get rasterized
+	for (u32 i = 0; i < len; ++i)
+		total_width += text_font_char_width(font, text[i]);
+	double start = time_get_seconds();
+	for (int iter = 0; iter < iterations; ++iter)
+		for (u32 i = 0; i < len; ++i)
+			total_width += text_font_char_width(font, text[i]);
+	double end = time_get_seconds();
+	printf("%s character lookup: %.1fns per character (width sum %g)\n", name,
+		(end - start) * 1e9 / (iterations * (double)len), total_width);
+}
+
+void text_benchmark(const char *ttf_filename, const char *fallback_ttf_filename) {
+	// a 4K screen full of code
+	const float width = 3840, height = 2160, font_size = 16;
+	const int nframes = 200;
+	Font *font = text_font_load(ttf_filename, font_size);
+	if (!font) {
+		printf("Couldn't load %s: %s\n", ttf_filename, text_get_err());
+		return;
+	}
+	Font *fallback = NULL;
+	if (fallback_ttf_filename) {
+		fallback = text_font_load(fallback_ttf_filename, font_size);
+		if (!fallback) {
+			printf("Couldn't load %s: %s\n", fallback_ttf_filename, text_get_err());
+			text_font_free(font);
+			return;
+		}
+		text_font_set_fallback(font, fallback);
+	}
+	static const char *const code[] = {
+		"static Status buffer_line_set_len(TextBuffer *buffer, Line *line, u32 new_len) {",
+		"    if (new_len >= 8) {",
+		"        u32 curr_capacity = (u32)1 << (32 - util_count_leading_zeroes32(line->len));",
+		"        assert(curr_capacity > line->len); // 0x1FFFFF == max code point",
+		"        if (new_len >= curr_capacity) {",
+		"            char32_t *new_str = buffer_realloc(buffer, line->str, new_capacity * sizeof *line->str);",
+		"            if (!new_str) return false; /* allocation failed */",
+		"        }",
+		"    } else if (!line->str) {",
+		"        line->str = buffer_malloc(buffer, 8 * sizeof *line->str);",
+		"    }",
+		"    line->len = new_len;",
+		"    return true;",
+		"}",
+		"",
+	};
+	const int ncode = (int)(sizeof code / sizeof *code);
+	const float colors[4][4] = {{1, 1, 1, 1}, {0.5f, 0.8f, 1, 1}, {1, 0.6f, 0.4f, 1}, {0.6f, 0.6f, 0.6f, 1}};
+	
+	u64 nglyphs = 0;
+	double start = time_get_seconds();
+	for (int frame = 0; frame < nframes; ++frame) {
+		int line = 0;
+		for (float y = 0; y < height; y += font_size, ++line) {
+			TextRenderState state = text_render_state_default;
+			state.max_x = width;
+			state.max_y = height;
+			state.y = y;
+			memcpy(state.color, colors[line % 4], sizeof state.color);
+			// keep writing code until we get to the right side of the screen
+			for (int i = line; state.x < width; ++i)
+				text_utf8_with_state(font, &state, code[i % ncode]);
+		}
+		// throw away the glyphs instead of rendering them
+		for (Font *f = font; f; f = f->fallback) {
+			arr_foreach_ptr(f->textures, FontTexture, texture) {
+				nglyphs += arr_len(texture->glyphs);
+				arr_set_len(texture->glyphs, 0);
+			}
+		}
+	}
+	double end = time_get_seconds();
+	
+	double glyphs_per_frame = (double)nglyphs / nframes;
+	printf("%.0fx%.0f screen of %.0fpx text: %.0f glyphs per frame\n", width, height, font_size, glyphs_per_frame);
+	printf("generating glyphs: %.3fms per frame\n", (end - start) * 1000 / nframes);
+	printf("instanced: %.1f KiB per frame\n", glyphs_per_frame * sizeof(GlyphInstance) / 1024);
+	printf("non-instanced: %.1f KiB per frame\n", glyphs_per_frame * 6 * sizeof(GlyphVertex) / 1024);
+	// 6 vertices of 2 floats position, 2 floats texture coordinate, 4 floats color
+	printf("(float vertices would be %.1f KiB per frame)\n", glyphs_per_frame * 6 * 8 * sizeof(float) / 1024);
+	
+	{
+		// character lookups for different kinds of text
+		const u32 len = 10000;
+		char32_t *ascii = calloc(len, sizeof *ascii);
+		char32_t *cjk = calloc(len, sizeof *cjk);
+		char32_t *mixed = calloc(len, sizeof *mixed);
+		if (ascii && cjk && mixed) {
+			u32 seed = 12345;
+			#define BENCH_RAND() (seed = seed * 1103515245 + 12345, seed >> 8)
+			for (u32 i = 0; i < len; ++i) {
+				ascii[i] = 0x20 + BENCH_RAND() % 0x5f;
+				// (the first 2000 or so CJK unified ideographs)
+				cjk[i] = 0x4e00 + BENCH_RAND() % 0x800;
+				u32 r = BENCH_RAND() % 100;
+				if (r < 80) mixed[i] = 0x20 + BENCH_RAND() % 0x5f;
+				else if (r < 95) mixed[i] = 0x4e00 + BENCH_RAND() % 0x800;
+				else mixed[i] = 0x1f600 + BENCH_RAND() % 0x50; // emoji
+			}
+			#undef BENCH_RAND
+			text_benchmark_char_lookup(font, "ASCII", ascii, len);
+			text_benchmark_char_lookup(font, "CJK", cjk, len);
+			text_benchmark_char_lookup(font, "mixed", mixed, len);
+		}
+		free(ascii);
+		free(cjk);
+		free(mixed);
+	}
+	
+	text_font_free(font);
+	if (fallback)
+		text_font_free(fallback);
+}
+
 void text_font_free(Font *font) {
-	free(font->ttf_data);
+	gl_frame_flush();
+	text_worker_forget(font);
+	font_file_close(font->file);
 	font_free_textures(font);
 	font_free_char_info(font);
 	memset(font, 0, sizeof *font);
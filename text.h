@@ -21,6 +21,11 @@
 /// a font
 typedef struct Font Font;
 
+/// glyph geometry which has already been laid out, and can be drawn again cheaply.
+///
+/// see \ref text_run_record_start.
+typedef struct TextRun TextRun;
+
 /// text render state.
 ///
 /// do not construct this directly instead use \ref text_render_state_default.
@@ -69,6 +74,8 @@ typedef enum {
 
 /// returns false on error.
 bool text_init(void);
+/// stop the background rasterization thread (call this after freeing all fonts).
+void text_quit(void);
 /// is there error?
 bool text_has_err(void);
 /// Get the current error. Errors will NOT be overwritten with newer errors.
@@ -112,13 +119,46 @@ void text_utf8_with_state(Font *font, TextRenderState *state, const char *str);
 ///
 /// Use this when you go to the next line or something.
 void text_state_break_kerning(TextRenderState *state);
+/// Returns a number which changes whenever text drawn with this font might be laid out differently
+/// (e.g. the font size changed).
+///
+/// \ref TextRun "TextRuns" recorded with a different generation should not be drawn.
+u32 text_font_generation(Font *font);
+/// Start recording the text drawn with `font` (and its fallbacks) into a \ref TextRun.
+///
+/// The text is still rendered as normal.
+void text_run_record_start(Font *font);
+/// Stop recording text.
+///
+/// `y` is the y coordinate which the text was drawn at. Returns `NULL` if out of memory.
+TextRun *text_run_record_end(Font *font, double y);
+/// Draw a recorded run of text again, with its `y` coordinate changed to `y`.
+///
+/// For this to give the same result as drawing the text again,
+/// the fractional parts of the old and new `y` coordinates should be the same.
+void text_run_draw(const TextRun *run, double y);
+/// Free a \ref TextRun. Does nothing if `run` is `NULL`.
+void text_run_free(TextRun *run);
+/// Lay out a screen full of text (without rendering it),
+/// and print out how long that took and how much vertex data it produced,
+/// and how long it takes to look up ASCII/CJK/emoji characters.
+///
+/// `fallback_ttf_filename` can be `NULL`. Doesn't need a GL context.
+void text_benchmark(const char *ttf_filename, const char *fallback_ttf_filename);
 /// Free memory used by font.
 ///
 /// Does NOT free the font's fallback.
 void text_font_free(Font *font);
-/// Render all text drawn with \ref text_utf8, etc.
+/// Rasterize the characters in `text` in the background, so that they don't
+/// have to be rasterized when they're drawn.
+///
+/// Characters which are drawn before the background thread gets to them are
+/// still rasterized immediately.
+void text_font_prefetch(Font *font, const char32_t *text, size_t len);
+/// Render all text drawn with \ref text_utf8, etc. (on top of anything rendered before it).
 ///
 /// This will render the fallback font and its fallback, and so on.
+/// The text is actually sent to the GPU at the end of the frame, along with everything else.
 void text_render(Font *font);
 /// The "default" text rendering state - everything you need to just render text normally.
 /// This lets you do stuff like:
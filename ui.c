@@ -11,9 +11,21 @@ struct Selector {
 	SelectorEntry *entries;
 	char *search_term;
 	Rect bounds;
+	/// index into `entries` of the entry the cursor is on
 	u32 cursor;
 	float scroll;
 	bool enable_cursor;
+	/// dynamic array of keys for the entries which match `filter_term`.
+	///
+	/// each key is `(U32_MAX - score) << 32 | entry_index`, so sorting the keys
+	/// puts the best matches first (with ties broken by entry index).
+	/// only the first `filter_sorted` keys are guaranteed to be in sorted order.
+	u64 *filtered;
+	u32 filter_sorted;
+	/// search term which `filtered` was computed for
+	char *filter_term;
+	/// set when `entries` changes, so `filtered` needs to be recomputed from scratch.
+	bool filter_stale;
 };
 
 struct FileSelector {
@@ -29,6 +41,7 @@ static Status file_selector_cd_(Ted *ted, FileSelector *fs, const char *path, in
 
 static void selector_init(Selector *s) {
 	s->enable_cursor = true;
+	s->filter_stale = true;
 }
 
 Selector *selector_new(void) {
@@ -48,12 +61,17 @@ void selector_clear_entries(Selector *s) {
 		free((void *)e->detail);
 	}
 	arr_clear(s->entries);
+	s->filter_stale = true;
 }
 
 void selector_clear(Selector *s) {
 	selector_clear_entries(s);
 	free(s->search_term);
 	s->search_term = NULL;
+	free(s->filter_term);
+	s->filter_term = NULL;
+	arr_clear(s->filtered);
+	s->filter_sorted = 0;
 	s->scroll = 0;
 	s->cursor = 0;
 }
@@ -118,16 +136,213 @@ static u32 selector_max_displayable_entries(Ted *ted, const Selector *s) {
 	return (u32)(entries_h / char_height);
 }
 
-static bool selector_show_entry(Selector *s, const SelectorEntry *e) {
-	return !s->search_term || strstr_case_insensitive(e->name, s->search_term);
+/// score how well `name` matches the (lowercase) search term `term`.
+///
+/// returns false if `name` doesn't contain all the characters of `term`, in order.
+/// exact matches score highest, then prefixes, then substrings, then "fuzzy" matches
+/// (where the characters of `term` are spread out in `name`).
+static bool selector_match_score(const char *name, const char32_t *term, size_t term_len, u32 *score) {
+	char32_t name32_buf[256];
+	const size_t name_bytes = strlen(name);
+	char32_t *name32 = name_bytes <= arr_count(name32_buf) ? name32_buf
+		: malloc(name_bytes * sizeof *name32);
+	if (!name32) return false;
+	
+	// convert name to lowercase UTF-32
+	size_t name_len = 0;
+	for (const char *p = name, *end = name + name_bytes; p < end; ) {
+		char32_t c = (u8)*p;
+		if (c < 128) {
+			++p;
+		} else {
+			size_t n = unicode_utf8_to_utf32(&c, p, (size_t)(end - p));
+			if (n >= (size_t)-2) break; // invalid UTF-8
+			p += n;
+		}
+		name32[name_len++] = to32_lower(c);
+	}
+	
+	bool matches = false;
+	// find the first occurence of term as a substring
+	size_t substr_pos = SIZE_MAX;
+	for (size_t i = 0; i + term_len <= name_len; ++i) {
+		if (memcmp(&name32[i], term, term_len * sizeof *term) == 0) {
+			substr_pos = i;
+			break;
+		}
+	}
+	if (substr_pos == 0) {
+		matches = true;
+		*score = name_len == term_len ? 3u << 24 : 2u << 24;
+	} else if (substr_pos != SIZE_MAX) {
+		matches = true;
+		// prefer matches at the start of a word
+		bool word_start = !is32_alnum(name32[substr_pos - 1]);
+		*score = 1u << 24 | (u32)word_start << 23;
+	} else {
+		// find the first match of term as a subsequence
+		size_t t = 0, end = 0;
+		for (size_t i = 0; i < name_len && t < term_len; ++i) {
+			if (name32[i] == term[t]) {
+				if (++t == term_len)
+					end = i;
+			}
+		}
+		if (t == term_len) {
+			matches = true;
+			// go backwards from the end of the match to find the shortest span ending there
+			size_t start = end;
+			t = term_len;
+			for (size_t i = end + 1; i-- > 0; ) {
+				if (name32[i] == term[t - 1]) {
+					start = i;
+					if (--t == 0) break;
+				}
+			}
+			// fewer characters in between matched characters is better
+			size_t gaps = (end - start + 1) - term_len;
+			*score = (1u << 23) - 1 - (u32)min_u64(gaps, (1u << 23) - 1);
+		}
+	}
+	if (name32 != name32_buf)
+		free(name32);
+	return matches;
+}
+
+static int selector_key_cmp(const void *av, const void *bv) {
+	u64 a = *(const u64 *)av, b = *(const u64 *)bv;
+	return a < b ? -1 : a > b;
+}
+
+/// rearrange `keys` so that the `k` smallest ones come first (in no particular order).
+///
+/// the keys must be distinct.
+static void selector_select_smallest_keys(u64 *keys, u32 n, u32 k) {
+	if (k == 0 || k >= n) return;
+	u32 lo = 0, hi = n;
+	// quickselect for the (k-1)th smallest key
+	while (hi - lo > 1) {
+		// median-of-three pivot
+		u32 mid = lo + (hi - lo) / 2;
+		u32 pivot_idx = mid;
+		{
+			u64 a = keys[lo], b = keys[mid], c = keys[hi - 1];
+			if ((a < b) == (b < c)) pivot_idx = mid;
+			else if ((b < a) == (a < c)) pivot_idx = lo;
+			else pivot_idx = hi - 1;
+		}
+		u64 pivot = keys[pivot_idx];
+		keys[pivot_idx] = keys[hi - 1];
+		keys[hi - 1] = pivot;
+		u32 store = lo;
+		for (u32 i = lo; i < hi - 1; ++i) {
+			if (keys[i] < pivot) {
+				u64 tmp = keys[i]; keys[i] = keys[store]; keys[store] = tmp;
+				++store;
+			}
+		}
+		keys[hi - 1] = keys[store];
+		keys[store] = pivot;
+		if (store == k - 1) break;
+		if (store > k - 1) hi = store;
+		else lo = store + 1;
+	}
+}
+
+/// make sure the first `k` filtered entries are in sorted order.
+static void selector_sort_filtered(Selector *s, u32 k) {
+	const u32 n = arr_len(s->filtered);
+	if (k > n) k = n;
+	if (k <= s->filter_sorted) return;
+	// sort extra entries so that scrolling down doesn't require sorting every frame
+	k = min_u32(n, max_u32(k, 2 * s->filter_sorted + 64));
+	u64 *rest = s->filtered + s->filter_sorted;
+	const u32 n_rest = n - s->filter_sorted, k_rest = k - s->filter_sorted;
+	selector_select_smallest_keys(rest, n_rest, k_rest);
+	qsort(rest, k_rest, sizeof *rest, selector_key_cmp);
+	s->filter_sorted = k;
 }
 
+/// number of entries which match the search term
 static u32 selector_filtered_entry_count(Selector *s) {
-	u32 count = 0;
-	arr_foreach_ptr(s->entries, const SelectorEntry, e) {
-		count += selector_show_entry(s, e);
+	return arr_len(s->filtered);
+}
+
+/// index into `s->entries` of the `i_display`th displayed entry.
+static u32 selector_displayed_entry(Selector *s, u32 i_display) {
+	assert(i_display < arr_len(s->filtered));
+	selector_sort_filtered(s, i_display + 1);
+	return (u32)s->filtered[i_display];
+}
+
+/// returns the position of the cursor in the filtered entry list,
+/// or `U32_MAX` if the cursor entry doesn't match the search term.
+static u32 selector_cursor_display_index(Selector *s) {
+	u64 cursor_key = U64_MAX;
+	arr_foreach_ptr(s->filtered, const u64, key) {
+		if ((u32)*key == s->cursor) {
+			cursor_key = *key;
+			break;
+		}
 	}
-	return count;
+	if (cursor_key == U64_MAX) return U32_MAX;
+	u32 index = 0;
+	arr_foreach_ptr(s->filtered, const u64, key) {
+		index += *key < cursor_key;
+	}
+	return index;
+}
+
+/// recompute the filtered entry list, if the search term or entries have changed.
+static void selector_filter(Selector *s) {
+	const char *term = s->search_term && *s->search_term ? s->search_term : NULL;
+	const char *prev_term = s->filter_term;
+	if (!s->filter_stale) {
+		if (!term && !prev_term) return;
+		if (term && prev_term && streq(term, prev_term)) return;
+	}
+	
+	// if the search term has only been added to, only entries which matched the
+	// previous search term can match the new one.
+	const bool narrow = !s->filter_stale && term && prev_term && str_has_prefix(term, prev_term);
+	
+	const u32 n_entries = arr_len(s->entries);
+	if (!term) {
+		arr_set_len(s->filtered, n_entries);
+		for (u32 i = 0; i < n_entries; ++i)
+			s->filtered[i] = (u64)U32_MAX << 32 | i;
+		s->filter_sorted = n_entries;
+	} else {
+		String32 term32 = str32_from_utf8(term);
+		for (size_t i = 0; i < term32.len; ++i)
+			term32.str[i] = to32_lower(term32.str[i]);
+		u64 *filtered = NULL;
+		if (narrow) {
+			arr_foreach_ptr(s->filtered, const u64, key) {
+				u32 index = (u32)*key;
+				u32 score = 0;
+				if (selector_match_score(s->entries[index].name, term32.str, term32.len, &score))
+					arr_add(filtered, (u64)(U32_MAX - score) << 32 | index);
+			}
+		} else {
+			for (u32 i = 0; i < n_entries; ++i) {
+				u32 score = 0;
+				if (selector_match_score(s->entries[i].name, term32.str, term32.len, &score))
+					arr_add(filtered, (u64)(U32_MAX - score) << 32 | i);
+			}
+		}
+		str32_free(&term32);
+		arr_free(s->filtered);
+		s->filtered = filtered;
+		s->filter_sorted = 0;
+	}
+	free(s->filter_term);
+	s->filter_term = term ? str_dup(term) : NULL;
+	s->filter_stale = false;
+	
+	// make sure cursor points to an entry in the filtered list
+	if (arr_len(s->filtered) && selector_cursor_display_index(s) == U32_MAX)
+		s->cursor = selector_displayed_entry(s, 0);
 }
 
 static void selector_clamp_scroll(Ted *ted, Selector *s) {
@@ -137,22 +352,27 @@ static void selector_clamp_scroll(Ted *ted, Selector *s) {
 }
 
 static void selector_scroll_to_cursor(Ted *ted, Selector *s) {
+	u32 cursor_display = selector_cursor_display_index(s);
+	if (cursor_display == U32_MAX) return;
 	u32 max_entries = selector_max_displayable_entries(ted, s);
 	float scrolloff = ted_active_settings(ted)->scrolloff;
-	float min_scroll = (float)s->cursor - ((float)max_entries - scrolloff);
-	float max_scroll = (float)s->cursor - scrolloff;
+	float min_scroll = (float)cursor_display - ((float)max_entries - scrolloff);
+	float max_scroll = (float)cursor_display - scrolloff;
 	s->scroll = clampf(s->scroll, min_scroll, max_scroll);
 	selector_clamp_scroll(ted, s);
 }
 
 static void selector_move(Ted *ted, Selector *s, i32 direction) {
 	assert(direction == -1 || direction == 1);
-	if (!s->enable_cursor || selector_filtered_entry_count(s) == 0)
+	selector_filter(s);
+	u32 count = selector_filtered_entry_count(s);
+	if (!s->enable_cursor || count == 0)
 		return;
 	
-	do
-		s->cursor = (u32)mod_i64((i64)s->cursor + direction, arr_len(s->entries));
-	while (!selector_show_entry(s, &s->entries[s->cursor]));
+	u32 cursor_display = selector_cursor_display_index(s);
+	if (cursor_display == U32_MAX) cursor_display = 0;
+	cursor_display = (u32)mod_i64((i64)cursor_display + direction, count);
+	s->cursor = selector_displayed_entry(s, cursor_display);
 	selector_scroll_to_cursor(ted, s);
 }
 
@@ -165,25 +385,32 @@ void selector_down(Ted *ted, Selector *s) {
 }
 
 void selector_home(Ted *ted, Selector *s) {
+	selector_filter(s);
 	if (!s->enable_cursor || selector_filtered_entry_count(s) == 0)
 		return;
 	
-	s->cursor = 0;
-	while (!selector_show_entry(s, &s->entries[s->cursor]))
-		++s->cursor;
+	s->cursor = selector_displayed_entry(s, 0);
 	selector_scroll_to_cursor(ted, s);
 }
 
 void selector_end(Ted *ted, Selector *s) {
-	if (!s->enable_cursor || selector_filtered_entry_count(s) == 0)
+	selector_filter(s);
+	u32 count = selector_filtered_entry_count(s);
+	if (!s->enable_cursor || count == 0)
 		return;
 	
-	s->cursor = arr_len(s->entries) - 1;
-	while (!selector_show_entry(s, &s->entries[s->cursor]))
-		--s->cursor;
+	s->cursor = selector_displayed_entry(s, count - 1);
 	selector_scroll_to_cursor(ted, s);
 }
 
+/// range of displayed entries which are (at least partially) visible
+static void selector_visible_range(Ted *ted, Selector *s, u32 *first, u32 *end) {
+	u32 count = selector_filtered_entry_count(s);
+	float scroll = maxf(s->scroll, 0);
+	*first = min_u32((u32)scroll, count);
+	*end = min_u32((u32)scroll + selector_max_displayable_entries(ted, s) + 2, count);
+}
+
 static int selectory_entry_cmp_name(void *context, const void *av, const void *bv) {
 	const Selector *s = context;
 	const SelectorEntry *a = av, *b = bv;
@@ -199,6 +426,7 @@ static int selectory_entry_cmp_name(void *context, const void *av, const void *b
 
 void selector_sort_entries_by_name(Selector *s) {
 	qsort_with_context(s->entries, arr_len(s->entries), sizeof *s->entries, selectory_entry_cmp_name, s);
+	s->filter_stale = true;
 }
 
 static Rect selector_entry_rect_unclipped(Ted *ted, Selector *s, u32 i_display) {
@@ -240,17 +468,20 @@ char *selector_update(Ted *ted, Selector *s) {
 		free(prev_search_term);
 	}
 	
+	selector_filter(s);
+	
 	ted->selector_open = s;
-	u32 i_display = 0;
-	arr_foreach_ptr(s->entries, const SelectorEntry, e) {
-		if (!selector_show_entry(s, e)) continue;
-		Rect entry_rect = selector_entry_rect_clipped(ted, s, i_display++);
+	u32 first_visible = 0, end_visible = 0;
+	selector_visible_range(ted, s, &first_visible, &end_visible);
+	for (u32 i_display = first_visible; i_display < end_visible; ++i_display) {
+		Rect entry_rect = selector_entry_rect_clipped(ted, s, i_display);
 		
 		// check if this entry was clicked on
 		if (ted_clicked_in_rect(ted, entry_rect)) {
 			// this option was selected
-			s->cursor = (u32)(e - s->entries); // indicate the index of the selected entry using s->cursor
-			ret = str_dup(e->name);
+			u32 i = selector_displayed_entry(s, i_display);
+			s->cursor = i; // indicate the index of the selected entry using s->cursor
+			ret = str_dup(s->entries[i].name);
 			break;
 		}
 	}
@@ -260,7 +491,7 @@ char *selector_update(Ted *ted, Selector *s) {
 		if (!ret) {
 			if (s->enable_cursor) {
 				// select this option
-				if (s->cursor < arr_len(s->entries))
+				if (s->cursor < arr_len(s->entries) && selector_filtered_entry_count(s))
 					ret = str_dup(s->entries[s->cursor].name);
 
 			} else {
@@ -284,24 +515,8 @@ void selector_render(Ted *ted, Selector *s) {
 
 	Rect bounds = s->bounds;
 	
-	if (arr_len(s->entries)) {
-		// clamp cursor
-		s->cursor = clamp_u32(s->cursor, 0, arr_len(s->entries) - 1);
-		
-		// make sure cursor points to an entry in the filtered list
-		u32 prev = U32_MAX;
-		for (u32 i = 0; i < arr_len(s->entries); ++i) {
-			if (selector_show_entry(s, &s->entries[i]))
-				prev = i;
-			if (i >= s->cursor && prev != U32_MAX) {
-				s->cursor = prev;
-				break;
-			}
-		}
-		if (!selector_show_entry(s, &s->entries[s->cursor])) {
-			s->cursor = prev;
-		}
-	}
+	// (this also makes sure the cursor points to an entry in the filtered list)
+	selector_filter(s);
 	
 	
 	float x1, y1, x2, y2;
@@ -320,13 +535,13 @@ void selector_render(Ted *ted, Selector *s) {
 	text_state.max_y = y2;
 
 	// render entries themselves
-	u32 i_display = 0;
-	for (u32 i = 0; i < arr_len(s->entries); ++i) {
+	u32 first_visible = 0, end_visible = 0;
+	selector_visible_range(ted, s, &first_visible, &end_visible);
+	for (u32 i_display = first_visible; i_display < end_visible; ++i_display) {
+		const u32 i = selector_displayed_entry(s, i_display);
 		const SelectorEntry *entry = &s->entries[i];
-		if (!selector_show_entry(s, entry)) continue;
 		Rect r_unclipped = selector_entry_rect_unclipped(ted, s, i_display);
 		Rect r_clipped = selector_entry_rect_clipped(ted, s, i_display);
-		++i_display;
 		if (r_clipped.size.x * r_clipped.size.y <= 0) continue;
 		float x = r_unclipped.pos.x, y = r_unclipped.pos.y;
 		text_state.x = x; text_state.y = y;
@@ -509,6 +724,7 @@ static ColorSetting color_setting_for_file_type(FsType type) {
 
 void selector_sort_entries(Selector *s, int (*compar)(void *context, const SelectorEntry *e1, const SelectorEntry *e2), void *context) {
 	qsort_with_context(s->entries, arr_len(s->entries), sizeof *s->entries, (int (*) (void *, const void *, const void *))compar, context);
+	s->filter_stale = true;
 }
 
 char *file_selector_update(Ted *ted, FileSelector *fs) {
@@ -820,4 +1036,153 @@ void selector_add_entry(Selector *s, const SelectorEntry *entry) {
 		.userdata = entry->userdata,
 	};
 	arr_add(s->entries, s_entry);
+	if (s->filter_stale)
+		return;
+	
+	// add the new entry to `filtered` without recomputing it from scratch,
+	// so that entries can be added a few at a time (e.g. as results come in from an LSP server)
+	const u32 index = arr_len(s->entries) - 1;
+	u32 score = 0;
+	if (s->filter_term) {
+		String32 term32 = str32_from_utf8(s->filter_term);
+		for (size_t i = 0; i < term32.len; ++i)
+			term32.str[i] = to32_lower(term32.str[i]);
+		bool matches = selector_match_score(s_entry.name, term32.str, term32.len, &score);
+		str32_free(&term32);
+		if (!matches) return;
+	}
+	const u64 key = (u64)(U32_MAX - score) << 32 | index;
+	const u32 sorted = s->filter_sorted;
+	if (sorted && key < s->filtered[sorted - 1]) {
+		// goes in the sorted part
+		u32 lo = 0, hi = sorted - 1;
+		while (lo < hi) {
+			u32 mid = lo + (hi - lo) / 2;
+			if (s->filtered[mid] < key)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		arr_insert(s->filtered, lo, key);
+		++s->filter_sorted;
+	} else {
+		arr_add(s->filtered, key);
+		if (sorted == arr_len(s->filtered) - 1 && !s->filter_term)
+			++s->filter_sorted; // (keys with no search term are already in order)
+	}
+	if (arr_len(s->filtered) == 1)
+		s->cursor = index; // first entry which matches
+}
+
+static void selector_test_expect_order(Selector *s, const char *search_term, const char *const *expected, u32 n_expected) {
+	free(s->search_term);
+	s->search_term = str_dup(search_term);
+	selector_filter(s);
+	if (selector_filtered_entry_count(s) != n_expected) {
+		println("expected %u selector entries to match \"%s\" but got %u",
+			n_expected, search_term, selector_filtered_entry_count(s));
+		exit(1);
+	}
+	for (u32 i = 0; i < n_expected; ++i) {
+		const char *name = s->entries[selector_displayed_entry(s, i)].name;
+		if (!streq(name, expected[i])) {
+			println("expected selector entry #%u for \"%s\" to be \"%s\" but got \"%s\"",
+				i, search_term, expected[i], name);
+			exit(1);
+		}
+	}
+}
+
+void selector_test(Ted *ted) {
+	(void)ted;
+	Selector *s = selector_new();
+	static const char *const names[] = {
+		"buffer.c", "command.h", "Main.c", "main.cpp", "menu.c", "make.bat", "mac", "ui.c", "my_map",
+	};
+	for (size_t i = 0; i < arr_count(names); ++i) {
+		SelectorEntry entry = {.name = names[i]};
+		selector_add_entry(s, &entry);
+	}
+	{
+		// prefixes, then substrings (word starts first)
+		static const char *const expected[] = {"Main.c", "main.cpp", "make.bat", "mac", "my_map", "command.h"};
+		selector_test_expect_order(s, "ma", expected, arr_count(expected));
+	}
+	{
+		// exact match, then fuzzy matches
+		static const char *const expected[] = {"mac", "Main.c", "main.cpp"};
+		selector_test_expect_order(s, "mac", expected, arr_count(expected));
+	}
+	{
+		static const char *const expected[] = {"Main.c", "main.cpp"};
+		selector_test_expect_order(s, "mai", expected, arr_count(expected));
+	}
+	{
+		// (narrowing from "mai")
+		static const char *const expected[] = {"Main.c", "main.cpp"};
+		selector_test_expect_order(s, "main.", expected, arr_count(expected));
+	}
+	{
+		// fewer characters in between is better
+		static const char *const expected[] = {"mac", "Main.c", "main.cpp", "menu.c"};
+		selector_test_expect_order(s, "mc", expected, arr_count(expected));
+	}
+	selector_clear(s);
+	
+	// partial sorting should give the same order as a full sort
+	u32 seed = 12345;
+	for (u32 i = 0; i < 5000; ++i) {
+		char name[16];
+		for (u32 j = 0; j + 1 < sizeof name; ++j) {
+			seed = seed * 1103515245 + 12345;
+			name[j] = (char)('a' + (seed >> 16) % 6);
+		}
+		name[sizeof name - 1] = '\0';
+		SelectorEntry entry = {.name = name};
+		selector_add_entry(s, &entry);
+	}
+	free(s->search_term);
+	s->search_term = str_dup("abc");
+	selector_filter(s);
+	u64 *keys = arr_copy(s->filtered);
+	arr_qsort(keys, selector_key_cmp);
+	for (u32 i = 0; i < arr_len(keys); i += 7) {
+		if (selector_displayed_entry(s, i) != (u32)keys[i]) {
+			println("selector partial sort gave the wrong entry at position %u", i);
+			exit(1);
+		}
+	}
+	arr_free(keys);
+	
+	// adding entries one at a time should give the same order as filtering from scratch
+	for (u32 i = 0; i < 2000; ++i) {
+		char name[16];
+		for (u32 j = 0; j + 1 < sizeof name; ++j) {
+			seed = seed * 1103515245 + 12345;
+			name[j] = (char)('a' + (seed >> 16) % 6);
+		}
+		name[sizeof name - 1] = '\0';
+		SelectorEntry entry = {.name = name};
+		selector_add_entry(s, &entry);
+		if (i % 100 == 0 && i / 4 < selector_filtered_entry_count(s))
+			selector_displayed_entry(s, i / 4); // sort some of them in between
+	}
+	u32 *order = NULL;
+	for (u32 i = 0; i < selector_filtered_entry_count(s); ++i)
+		arr_add(order, selector_displayed_entry(s, i));
+	s->filter_stale = true;
+	selector_filter(s);
+	if (selector_filtered_entry_count(s) != arr_len(order)) {
+		println("selector has %u matching entries after adding entries, but should have %u",
+			arr_len(order), selector_filtered_entry_count(s));
+		exit(1);
+	}
+	for (u32 i = 0; i < arr_len(order); ++i) {
+		if (selector_displayed_entry(s, i) != order[i]) {
+			println("adding selector entries gave the wrong entry at position %u", i);
+			exit(1);
+		}
+	}
+	arr_free(order);
+	selector_free(s);
 }
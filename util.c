@@ -88,6 +88,13 @@ bool is32_graph(char32_t c) {
 	return c <= WINT_MAX && iswgraph((wint_t)c);
 }
 
+char32_t to32_lower(char32_t c) {
+	if (c < 128)
+		return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+	// on Windows, there is no way of finding the lower-case version of a codepoint outside the BMP. ):
+	return c < WINT_MAX ? (char32_t)towlower((wint_t)c) : c;
+}
+
 bool is_a_tty(FILE *out) {
 	#if _WIN32
 	int fd = _fileno(out);
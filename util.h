@@ -77,6 +77,8 @@ bool is32_alnum(char32_t c);
 bool is32_digit(char32_t c);
 /// `isgraph` for 32-bit chars.
 bool is32_graph(char32_t c);
+/// `tolower` for 32-bit chars.
+char32_t to32_lower(char32_t c);
 /// cross-platform `isatty`
 bool is_a_tty(FILE *out);
 /// returns terminal escape sequence for italics, or `""` if `out` is not a TTY.